@@ -0,0 +1,112 @@
+/**
+ * @file
+ * @brief Timeline of the solver and forward kinematics in Chrome trace
+ * format (also read by Perfetto).
+ */
+
+
+#ifndef IGM_TIMELINE_H
+#define IGM_TIMELINE_H
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include <stdio.h>
+
+
+/****************************************
+ * DEFINES
+ ****************************************/
+
+/// The maximal number of threads, which can record events.
+#define IGM_TIMELINE_MAX_THREADS 16
+/// The number of events, which are stored by a thread until they are
+/// written, the newer events are dropped if the buffer is full.
+#define IGM_TIMELINE_BUFFER_SIZE 4096
+
+
+/**
+ * @brief Hooks in the library, which are compiled only with
+ * IGM_TRACE_ENABLE. The name must be a string literal.
+ */
+#ifdef IGM_TRACE_ENABLE
+#define IGM_TIMELINE_SCOPE(name) igmTimelineScope igm_timeline_scope(name)
+#define IGM_TIMELINE_INSTANT(name) igmTimeline::instant(name)
+#else
+#define IGM_TIMELINE_SCOPE(name)
+#define IGM_TIMELINE_INSTANT(name)
+#endif
+
+
+
+/****************************************
+ * TYPEDEFS
+ ****************************************/
+
+/**
+ * @brief Registry of per-thread buffers of events. Each thread gets its own
+ * statically allocated buffer when it records the first event, recording
+ * is wait-free and does not allocate memory.
+ *
+ * @note Recording is disabled by default, see enable().
+ */
+class igmTimeline
+{
+    public:
+        static void enable (const bool);
+        static bool isEnabled ();
+
+        static void complete (const char *, const double, const double);
+        static void instant (const char *);
+
+        static double getTime ();
+        static unsigned int getDropped ();
+};
+
+
+
+/**
+ * @brief Records a complete event from construction till destruction.
+ */
+class igmTimelineScope
+{
+    public:
+        igmTimelineScope(const char *);
+        ~igmTimelineScope();
+
+
+    private:
+        const char *name;
+        /// Start time in microseconds, negative if recording is disabled.
+        double start;
+};
+
+
+
+/**
+ * @brief Writes the recorded events to a file in Chrome trace format (JSON
+ * array of events). The events are removed from the buffers, so the
+ * writer can be flushed periodically from a separate thread or once at
+ * shutdown.
+ *
+ * @note Only one writer may be flushed at a time.
+ */
+class igmTimelineWriter
+{
+    public:
+        igmTimelineWriter();
+        ~igmTimelineWriter();
+
+        int open (const char *);
+        int flush ();
+        void close ();
+
+
+    private:
+        FILE *file;
+        /// The number of written events.
+        unsigned int num_events;
+};
+
+#endif // IGM_TIMELINE_H
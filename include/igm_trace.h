@@ -0,0 +1,69 @@
+/**
+ * @file
+ * @brief Snapshot of the instrumentation of the solver (plain C structures),
+ * see igmTrace in nao_igm.h.
+ */
+
+
+#ifndef IGM_TRACE_H
+#define IGM_TRACE_H
+
+
+/****************************************
+ * DEFINES
+ ****************************************/
+
+/// The number of the most recent iterations stored in the trace.
+#define IGM_TRACE_SIZE 64
+
+
+
+/****************************************
+ * TYPEDEFS
+ ****************************************/
+
+/**
+ * @brief An iteration of the solver.
+ */
+typedef struct igmTraceRecord
+{
+    /// Index of the call of the solver (starting from 0).
+    unsigned int call;
+    /// Index of the iteration within the call (starting from 0).
+    int iter;
+
+    /// Infinity norm of the change of joint angles.
+    double norm_dq;
+    /// Infinity norm of the residuals of the constraints before the step.
+    double norm_err;
+
+    /// Time of evaluation of the generated function (seconds).
+    double kernel_time;
+    /// Time of solving the KKT system and updating the angles (seconds).
+    double solve_time;
+} igmTraceRecord;
+
+
+/**
+ * @brief Aggregate counters and the most recent iterations.
+ */
+typedef struct igmTraceSnapshot
+{
+    /// The number of calls of the solver.
+    unsigned int calls;
+    /// The total number of iterations.
+    unsigned long long iterations;
+    /// The number of calls, which did not converge.
+    unsigned int failures;
+
+    /// The total and the maximal duration of a call (seconds).
+    double total_time;
+    double max_time;
+
+    /// The number of valid records (<= IGM_TRACE_SIZE).
+    int num_records;
+    /// The most recent iterations, the oldest first.
+    igmTraceRecord records[IGM_TRACE_SIZE];
+} igmTraceSnapshot;
+
+#endif // IGM_TRACE_H
@@ -8,6 +8,46 @@
 #ifndef LEG2JOINTS_H
 #define LEG2JOINTS_H
 
+#include "joints_sensors_id.h"
+
+
+/****************************************
+ * DEFINES
+ ****************************************/
+
+/// Size of the output of LLeg2Joints() / RLeg2Joints().
+#define LEG2JOINTS_OUTPUT_SIZE 483
+
+/// Bit of a frame in the mask passed to LLeg2Joints_select() /
+/// RLeg2Joints_select().
+#define LEG2JOINTS_FRAME(id) (1u << (id))
+/// Mask selecting all frames.
+#define LEG2JOINTS_ALL_FRAMES ((1u << LEG2JOINTS_FRAMES_NUM) - 1)
+
+
+/****************************************
+ * TYPEDEFS 
+ ****************************************/
+
+/**
+ * @brief Frames in the output of LLeg2Joints() / RLeg2Joints(): the frames
+ * of joints are identified by jointSensorIDs and followed by the frames
+ * below. Frame 'id' is a 4x4 homogeneous matrix (column-major) starting at
+ * A[16*id], except for the CoM, which is a 3x1 vector.
+ */
+enum leg2JointsFrameIDs {
+    LEG2JOINTS_TORSO        = JOINTS_NUM,
+    LEG2JOINTS_LEFT_FOOT    = JOINTS_NUM + 1,
+    LEG2JOINTS_RIGHT_FOOT   = JOINTS_NUM + 2,
+    LEG2JOINTS_LEFT_HAND    = JOINTS_NUM + 3,
+    LEG2JOINTS_RIGHT_HAND   = JOINTS_NUM + 4,
+    LEG2JOINTS_HEAD         = JOINTS_NUM + 5,
+    LEG2JOINTS_COM          = JOINTS_NUM + 6,
+
+    LEG2JOINTS_FRAMES_NUM   = JOINTS_NUM + 7
+};
+
+
 /****************************************
  * PROTOTYPES 
  ****************************************/
@@ -15,6 +55,18 @@
 extern "C" {
     void LLeg2Joints(double *q,double *LL,double *A);
     void RLeg2Joints(double *q,double *RL,double *A);
+
+    // sin_q / cos_q: sine and cosine of joint angles, see jointTrig.
+    void LLeg2Joints_trig(const double *sin_q,const double *cos_q,const double *LL,double *A);
+    void RLeg2Joints_trig(const double *sin_q,const double *cos_q,const double *RL,double *A);
+
+    // frames: mask of frames (LEG2JOINTS_FRAME()), which must be computed;
+    // only the parts of kinematic chains leading to these frames are
+    // computed, other frames in A may be left unchanged or overwritten.
+    void LLeg2Joints_select(double *q,double *LL,unsigned int frames,double *A);
+    void RLeg2Joints_select(double *q,double *RL,unsigned int frames,double *A);
+    void LLeg2Joints_select_trig(const double *sin_q,const double *cos_q,const double *LL,const unsigned int frames,double *A);
+    void RLeg2Joints_select_trig(const double *sin_q,const double *cos_q,const double *RL,const unsigned int frames,double *A);
 }
 
 #endif //LEG2JOINTS_H
@@ -17,6 +17,8 @@
 
 #include <Eigen/Geometry>
 #include "joints_sensors_id.h"
+#include "igm_trace.h"
+#include "igm_timeline.h"
 
 
 
@@ -27,66 +29,634 @@
 using namespace Eigen;
 
 
+class igmSpeculation;
+
+
 enum igmSupportFoot {
     IGM_SUPPORT_RIGHT = 0,
     IGM_SUPPORT_LEFT = 1
 };
 
 
+/**
+ * @brief Evaluation of the leading matrix of the constraints (Jacobian)
+ * between iterations of the solver.
+ */
+enum igmJacobianUpdate {
+    /// Exact Jacobian is evaluated in each iteration.
+    IGM_JACOBIAN_EXACT = 0,
+    /// Jacobian is reused (chord method), only the residuals are evaluated.
+    IGM_JACOBIAN_CHORD = 1,
+    /// Jacobian is updated with Broyden rank-one updates, only the
+    /// residuals are evaluated.
+    IGM_JACOBIAN_BROYDEN = 2
+};
+
+
+/**
+ * @brief Precision of the iterations of the solver.
+ */
+enum igmPrecision {
+    /// All iterations are performed in double precision.
+    IGM_PRECISION_DOUBLE = 0,
+    /// All iterations are performed in single precision, hence the
+    /// tolerance must not be too small.
+    IGM_PRECISION_FLOAT = 1,
+    /// Single precision iterations are performed until the change of joint
+    /// angles is small enough (see igmOptions::mixed_precision_tol), the
+    /// solution is refined with double precision iterations.
+    IGM_PRECISION_MIXED = 2
+};
+
+
+/**
+ * @brief Status of the solver, see nao_igm::igmDeadline().
+ */
+enum igmStatus {
+    /// The solution is found.
+    IGM_CONVERGED = 0,
+    /// The time budget is exhausted.
+    IGM_BUDGET_EXHAUSTED = 1,
+    /// The residuals of the constraints grow.
+    IGM_DIVERGING = 2
+};
+
+
 #define POSITION_VECTOR_SIZE 3
 
+/// Size of a cache line, used for padding of shared data.
+#define IGM_CACHE_LINE_SIZE 64
+#define IGM_CACHE_LINE_DOUBLES (IGM_CACHE_LINE_SIZE / sizeof(double))
+
+/// Maximal change of a joint angle, for which sine and cosine are updated
+/// incrementally, see jointTrig::updateIncremental().
+#define IGM_TRIG_INCREMENT_MAX 0.1
+
+/// The number of recent durations used by igmTimeEstimate.
+#define IGM_TIME_ESTIMATE_WINDOW 16
+
+
+
+/**
+ * @brief Sine and cosine of joint angles, which are shared by all generated
+ * functions evaluated for the same joint angles.
+ */
+class jointTrig
+{
+    public:
+        jointTrig();
+
+        void update (const double *);
+        void updateIncremental (const double *, const int);
+
+        double sin_q[JOINTS_NUM];
+        double cos_q[JOINTS_NUM];
+
+
+    private:
+        /// Joint angles, for which sin_q and cos_q were computed.
+        double q[JOINTS_NUM];
+
+        /// The number of incremental updates since the last exact evaluation.
+        int num_increments[JOINTS_NUM];
+};
+
+
+
+/**
+ * @brief Options of the IGM solver, which do not change the problem.
+ */
+class igmOptions
+{
+    public:
+        igmOptions();
+
+        /// Update sine and cosine of joint angles between iterations using
+        /// angle-addition formulas instead of computing them from scratch,
+        /// the error is below 1e-13 with recomputation every
+        /// trig_refresh_period updates, see jointTrig::updateIncremental().
+        bool incremental_trig;
+
+        /// The number of incremental updates of sine and cosine of a joint
+        /// angle, after which they are computed from scratch.
+        int trig_refresh_period;
+
+        /// Evaluation of the Jacobian between iterations. Convergence is
+        /// confirmed by an iteration with exact Jacobian, hence the solution
+        /// agrees with the solution obtained with exact Jacobian within the
+        /// tolerance.
+        igmJacobianUpdate jacobian_update;
+
+        /// The maximal number of consecutive iterations with approximate
+        /// Jacobian.
+        int jacobian_refresh_period;
+
+        /// Exact Jacobian is evaluated if the infinity norm of the residuals
+        /// was not reduced at least by this factor in the last iteration.
+        double jacobian_stall_ratio;
+
+        /// If positive, the residuals of the constraints are evaluated
+        /// before each iteration (without the Jacobian), and the solver
+        /// stops if their infinity norm does not exceed this value.
+        double residual_tol;
+
+        /// Eliminate the constraint on the coupled joints L_HIP_YAW_PITCH and
+        /// R_HIP_YAW_PITCH by replacing them with one variable, the results
+        /// are the same up to rounding errors.
+        bool reduced_kkt;
+
+        /// Precision of iterations, used by igmSolve() only, i.e., ignored by
+        /// nao_igm::igmDeadline(). Single precision iterations always
+        /// evaluate the exact Jacobian and compute sine and cosine from
+        /// scratch.
+        igmPrecision precision;
+
+        /// IGM_PRECISION_MIXED: single precision iterations are performed
+        /// until the infinity norm of the change of joint angles does not
+        /// exceed this value (or the tolerance of the solver, if it is
+        /// larger), at least one double precision iteration follows.
+        double mixed_precision_tol;
+
+        /// Flush denormal results and inputs of floating point operations
+        /// to zero while the solver or forward kinematics is running, see
+        /// igmDenormalsScope. Denormals are not accurate anyway, but they
+        /// may slow down arithmetic operations by orders of magnitude.
+        bool flush_denormals;
+};
+
+
+
+/**
+ * @brief Enables flush-to-zero and denormals-are-zero modes of the floating
+ * point unit of the calling thread in the constructor and restores the
+ * previous modes in the destructor.
+ *
+ * @note The modes are changed only on x86 with SSE2, the scope has no
+ * effect on other architectures.
+ */
+class igmDenormalsScope
+{
+    public:
+        igmDenormalsScope(const bool);
+        ~igmDenormalsScope();
+
+
+    private:
+        /// True if the modes must be restored.
+        bool restore;
+        /// Control and status register saved in the constructor.
+        unsigned int csr;
+};
+
 
 
+/**
+ * @brief Joint angles, also serves as a per-thread context of the solver,
+ * see igmModel.
+ */
 class jointState
 {
     public:
         jointState();
 
         void initJointAngles();
-        int checkJointBounds();
+        int checkJointBounds() const;
 
         double q[JOINTS_NUM];
 
+        /// Sine and cosine of q, must be updated with trig.update(q).
+        jointTrig trig;
+
+        /// Bounds are constant and may be shared by threads.
+        static const double q_lower_bound[JOINTS_NUM];
+        static const double q_upper_bound[JOINTS_NUM];
+};
+
+
+
+/**
+ * @brief Result of forward kinematics cached for joint angles and a posture
+ * of the support foot, both are compared by content, so that q may be
+ * changed directly.
+ */
+class igmFKCache
+{
+    public:
+        igmFKCache();
+
+        bool lookup (const jointState &, const igmSupportFoot, const double *, double *, const int);
+        void store (const jointState &, const igmSupportFoot, const double *, const double *, const int);
+
+
+        /// The number of successful lookups.
+        int hits;
+        /// The number of failed lookups.
+        int misses;
+
 
     private:
-        void initBounds();
-        void setBounds (const jointSensorIDs, const double, const double);
+        /// True if a result is cached.
+        bool valid;
+        double q[JOINTS_NUM];
+        igmSupportFoot support_foot;
+        double support_foot_posture[16];
+        double result[16];
+};
+
+
+
+/**
+ * @brief Instrumentation of the solver: aggregate counters and a ring
+ * buffer of the most recent iterations, no memory is allocated.
+ *
+ * @note The solver records into the trace only if the library is compiled
+ * with IGM_TRACE_ENABLE, otherwise the hooks are removed and the trace
+ * stays empty.
+ */
+class igmTrace
+{
+    public:
+        igmTrace();
+
+        void reset();
+        void record (const int, const double, const double, const double, const double);
+        void endCall (const int, const bool, const double);
+        void getSnapshot (igmTraceSnapshot &) const;
 
-        static double q_lower_bound[JOINTS_NUM];
-        static double q_upper_bound[JOINTS_NUM];
+        static double getTime();
+
+
+    private:
+        /// Counters, records are stored in a ring buffer.
+        igmTraceSnapshot data;
+        /// Index of the next record in the ring buffer.
+        int next;
+};
+
+
+
+/**
+ * @brief Single-producer / single-consumer mailbox for joint angles based
+ * on a triple buffer: both write() and read() are wait-free, the reader
+ * always gets the latest complete snapshot.
+ */
+class jointStateMailbox
+{
+    public:
+        jointStateMailbox();
+
+        void write (const double *);
+        bool read (jointState &);
+
+
+    private:
+        /// Snapshots, padded to avoid false sharing.
+        double buffer[3][JOINTS_NUM + IGM_CACHE_LINE_DOUBLES];
+
+        /// Index of the buffer owned by the writer.
+        int back;
+        char padding_back[IGM_CACHE_LINE_SIZE];
+        /// Index of the buffer exchanged between the writer and the
+        /// reader, IGM_MAILBOX_FRESH is set if it contains a snapshot, which
+        /// has not been read.
+        int middle;
+        char padding_middle[IGM_CACHE_LINE_SIZE];
+        /// Index of the buffer owned by the reader.
+        int front;
 };
 
 
 
-class nao_igm 
+/**
+ * @brief Prediction of the solution of the IGM from solutions obtained on
+ * the previous control ticks.
+ */
+class igmPredictor
 {
     public:
+        igmPredictor();
+
+        void reset ();
+        void restart ();
+        void add (const double, const double *);
+        void predict (const double, double *) const;
+
+
+        /// Order of extrapolation in time: 0 -- previous solution,
+        /// 1 -- linear, 2 -- quadratic.
+        int order;
+
+
+    private:
+        /// The number of stored solutions.
+        int num;
+        /// Time instants of the stored solutions, the newest first.
+        double time[3];
+        /// Stored solutions, the newest first.
+        double q[3][LOWER_JOINTS_NUM];
+};
+
+
+
+/**
+ * @brief Estimate of a duration (e.g., of an iteration of the solver) from
+ * the recent observations, see nao_igm::igmDeadline().
+ */
+class igmTimeEstimate
+{
+    public:
+        igmTimeEstimate();
+
+        void reset ();
+        void add (const double);
+        void forget ();
+        double get () const;
+        double getMin () const;
+
+
+    private:
+        /// Ring buffer of recent durations.
+        double durations[IGM_TIME_ESTIMATE_WINDOW];
+        /// The number of stored durations.
+        int num;
+        /// Index of the next duration.
+        int index;
+};
+
+
+
+/**
+ * @brief Description of the IGM problem: postures of the feet, position of
+ * the CoM and options of the solver.
+ *
+ * @note Const methods are reentrant: several threads may share a model as
+ * long as each of them uses its own jointState, which contains the cached
+ * sine and cosine of joint angles. The states should be owned by the threads
+ * (e.g., allocated on their stacks) to avoid false sharing.
+ *
+ * @note Forward kinematics and the solver do not allocate memory in any mode
+ * (see igmOptions), all temporary matrices have fixed sizes. This is
+ * checked by test_no_alloc.
+ */
+class igmModel
+{
+    public:
+        igmModel();
+
+        void setCoM (const double, const double, const double);
+
+        void getCoM (jointState&, double *) const;
+        void getSwingFootPosture (jointState&, double *) const;
+        void getSwingFootPostureCoM (jointState&, double *, double *) const;
+
+        int solve (jointState&, const double*, const double, const double, const int, igmTrace * = NULL) const;
+
+
+        igmOptions options;
+
+        igmSupportFoot support_foot;
+
+        Transform<double,3> left_foot_posture;
+        Transform<double,3> right_foot_posture;
+
+        double CoM_position[POSITION_VECTOR_SIZE];
+};
+
+
+/**
+ * @brief The IGM problem with the state of the robot.
+ *
+ * @note Memory is not allocated after construction: init(), igm() and its
+ * variants, getFeetPositions(), readSensors() and switchSupportFoot() are
+ * safe to call from a real-time loop. Memory may be allocated only by
+ * startSpeculation() and stopSpeculation(), which start and stop a thread.
+ */
+class nao_igm : public igmModel
+{
+    public:
+        nao_igm();
+        ~nao_igm();
+
         void init (
                 const igmSupportFoot,
                 const double, const double, const double,
                 const double, const double, const double);
 
         void switchSupportFoot ();
-        void setCoM (const double, const double, const double);
+        bool readSensors ();
 
         void getFeetPositions (double *, double *, double *, double *);
 
         void getCoM (jointState&, double *);
         void getSwingFootPosture (jointState&, double *);
+        void getSwingFootPostureCoM (jointState&, double *, double *);
 
         int igm (const double*, const double, const double, const int);
+        int igmTrack (const double, const double*, const double, const double, const int);
+        igmStatus igmDeadline (const double*, const double, const double, const double, int &);
+        int igmSpeculative (const double*, const double, const double, const int);
 
+        int startSpeculation ();
+        void stopSpeculation ();
 
 
-        igmSupportFoot support_foot;
+
+        igmPredictor predictor;
+
+        /// Estimated durations of an iteration of the solver and of
+        /// evaluation of the residuals, see igmDeadline(). Reset by init().
+        igmTimeEstimate iteration_time;
+        igmTimeEstimate residual_time;
+
+        /// The smallest difference between the time budget and the
+        /// estimated end of an iteration in the last call of igmDeadline(),
+        /// negative if an iteration is started, which may not be completed
+        /// within the budget.
+        double deadline_slack;
 
         jointState state_model;
         jointState state_sensor;
 
-        Transform<double,3> left_foot_posture;
-        Transform<double,3> right_foot_posture;
+        /// Joint angles written by the thread receiving sensor data, see
+        /// readSensors().
+        jointStateMailbox sensor_mailbox;
 
-        double CoM_position[POSITION_VECTOR_SIZE];
+        /// Iterations of igm() and igmTrack(), see igmTrace.
+        igmTrace trace;
+
+        /// Cached results of getCoM() and getSwingFootPosture().
+        igmFKCache CoM_cache;
+        igmFKCache swing_foot_cache;
+
+        /// Solution for the other support foot, see igmSpeculative().
+        jointState state_speculative;
+        /// The number of iterations performed to obtain state_speculative,
+        /// negative if it is not available. Reset by init() and
+        /// switchSupportFoot().
+        int speculative_iter;
+
+
+    private:
+        // the worker thread cannot be shared
+        nao_igm (const nao_igm &);
+        nao_igm& operator= (const nao_igm &);
+
+        /// Worker thread solving the problem for the other support foot,
+        /// NULL if speculation is not started.
+        igmSpeculation *speculation;
+};
+
+
+
+/**
+ * @brief A set of independent IGM problems stored in structure-of-arrays
+ * buffers. The buffers are owned by the caller.
+ */
+class igmBatch
+{
+    public:
+        igmBatch();
+
+        int solve (const double, const double, const int);
+
+
+        /// The number of problems.
+        int size;
+
+        igmOptions options;
+
+        /// Solve several problems simultaneously using SIMD versions of the
+        /// generated functions (if available), the results may differ from
+        /// the results of nao_igm::igm() in the last bits. SIMD versions
+        /// compute sine and cosine on their own, igmOptions::incremental_trig,
+        /// igmOptions::jacobian_update and igmOptions::residual_tol are
+        /// ignored. SIMD versions iterate in double precision only, hence
+        /// vectorize is ignored if igmOptions::precision is not
+        /// IGM_PRECISION_DOUBLE.
+        bool vectorize;
+
+        /// Solve the problems one after another, the solution of a problem
+        /// (the angles of the lower part of the body) is the initial guess
+        /// for the next problem. vectorize is ignored in this case.
+        bool warm_start;
+
+        /// size support feet.
+        const igmSupportFoot *support_foot;
+        /// size 4x4 homogeneous matrices of the support feet.
+        const double *support_foot_posture;
+        /// size 4x4 homogeneous matrices of the swing feet.
+        const double *swing_foot_posture;
+        /// size 3x1 positions of the CoM.
+        const double *CoM_position;
+        /// size LOWER_JOINTS_NUM vectors of reference angles.
+        const double *ref_angles;
+
+        /// size JOINTS_NUM vectors of joint angles: initial guesses on input,
+        /// solutions on output.
+        double *q;
+        /// size iteration counters, see nao_igm::igm().
+        int *iter;
+
+
+    private:
+        int solveGroup (const int, const int, const double, const double, const int);
+};
+
+
+
+class igmPoolState;
+
+/**
+ * @brief A pool of threads solving independent batches (jobs), the jobs
+ * are distributed over the threads by work stealing.
+ *
+ * @note Memory is allocated only by start() and stop(), solve() does not
+ * allocate.
+ */
+class igmPool
+{
+    public:
+        igmPool();
+        ~igmPool();
+
+        int start (const int);
+        void stop ();
+
+        int solve (igmBatch *, const int, const double, const double, const int);
+
+
+        /// The number of jobs stolen by threads in the last call of solve().
+        int num_steals;
+
+
+    private:
+        igmPool (const igmPool &);
+        igmPool& operator= (const igmPool &);
+
+        /// Threads and queues of jobs, NULL if the pool is not started.
+        igmPoolState *state;
+};
+
+
+
+/**
+ * @brief Synthetic walking gait: postures of the swing foot and positions
+ * of the CoM on each control tick. Each step consists of single support,
+ * when the swing foot is moved, and optional double support; the support
+ * foot is switched at the beginning of the next step. The CoM moves
+ * forward with constant velocity and sways towards the support foot in
+ * single support.
+ *
+ * @note This is the standard workload of tests and benchmarks; changing
+ * the default parameters invalidates the previous results.
+ */
+class igmGait
+{
+    public:
+        igmGait();
+
+        void init (nao_igm &);
+        bool next (nao_igm &);
+
+        bool isDoubleSupport () const;
+        int getStep () const;
+        int getTick () const;
+
+
+        /// Length of a step along X axis (the swing foot moves twice as
+        /// far, except for the first step).
+        double step_length;
+        /// Distance between the feet along Y axis.
+        double step_width;
+        /// Maximal height of the swing foot.
+        double step_height;
+        /// Amplitude of the lateral motion of the CoM.
+        double CoM_sway;
+
+        /// The number of control ticks in single support.
+        int ss_ticks;
+        /// The number of control ticks in double support.
+        int ds_ticks;
+        /// The number of steps, 0 -- walk indefinitely.
+        int num_steps;
+
+        /// Copy state_model to state_sensor before switching of the support
+        /// foot (ideal sensors). Disable if state_sensor is updated
+        /// otherwise.
+        bool copy_sensors;
+
+
+    private:
+        /// The current step, starting from 0.
+        int step;
+        /// The current tick of the step, starting from 1, 0 before the
+        /// first call of next().
+        int tick;
+
+        /// The initial position of the CoM.
+        double CoM_initial[POSITION_VECTOR_SIZE];
+        /// The initial position of the swing foot in the current step.
+        double swing_foot_start[POSITION_VECTOR_SIZE];
 };
 
 #endif // NAO_IGM_H
@@ -0,0 +1,942 @@
+/* Generated using codegen (2012-02-13, 17:03:54) */ 
+/*
+ * Body of LLeg2CoM(), the IGM_* macros are described in maple_double.h.
+ */
+  IGM_REAL t100;
+  IGM_REAL t101;
+  IGM_REAL t102;
+  IGM_REAL t103;
+  IGM_REAL t104;
+  IGM_REAL t106;
+  IGM_REAL t107;
+  IGM_REAL t108;
+  IGM_REAL t109;
+  IGM_REAL t11;
+  IGM_REAL t110;
+  IGM_REAL t111;
+  IGM_REAL t112;
+  IGM_REAL t113;
+  IGM_REAL t114;
+  IGM_REAL t115;
+  IGM_REAL t117;
+  IGM_REAL t12;
+  IGM_REAL t120;
+  IGM_REAL t122;
+  IGM_REAL t124;
+  IGM_REAL t126;
+  IGM_REAL t127;
+  IGM_REAL t129;
+  IGM_REAL t13;
+  IGM_REAL t130;
+  IGM_REAL t132;
+  IGM_REAL t133;
+  IGM_REAL t134;
+  IGM_REAL t135;
+  IGM_REAL t136;
+  IGM_REAL t137;
+  IGM_REAL t139;
+  IGM_REAL t14;
+  IGM_REAL t140;
+  IGM_REAL t141;
+  IGM_REAL t143;
+  IGM_REAL t145;
+  IGM_REAL t147;
+  IGM_REAL t148;
+  IGM_REAL t15;
+  IGM_REAL t150;
+  IGM_REAL t151;
+  IGM_REAL t152;
+  IGM_REAL t153;
+  IGM_REAL t154;
+  IGM_REAL t156;
+  IGM_REAL t157;
+  IGM_REAL t158;
+  IGM_REAL t16;
+  IGM_REAL t160;
+  IGM_REAL t161;
+  IGM_REAL t163;
+  IGM_REAL t164;
+  IGM_REAL t165;
+  IGM_REAL t166;
+  IGM_REAL t173;
+  IGM_REAL t174;
+  IGM_REAL t176;
+  IGM_REAL t18;
+  IGM_REAL t181;
+  IGM_REAL t182;
+  IGM_REAL t184;
+  IGM_REAL t185;
+  IGM_REAL t187;
+  IGM_REAL t188;
+  IGM_REAL t19;
+  IGM_REAL t190;
+  IGM_REAL t193;
+  IGM_REAL t194;
+  IGM_REAL t195;
+  IGM_REAL t2;
+  IGM_REAL t20;
+  IGM_REAL t206;
+  IGM_REAL t209;
+  IGM_REAL t21;
+  IGM_REAL t211;
+  IGM_REAL t215;
+  IGM_REAL t216;
+  IGM_REAL t22;
+  IGM_REAL t23;
+  IGM_REAL t230;
+  IGM_REAL t24;
+  IGM_REAL t242;
+  IGM_REAL t243;
+  IGM_REAL t245;
+  IGM_REAL t246;
+  IGM_REAL t248;
+  IGM_REAL t25;
+  IGM_REAL t250;
+  IGM_REAL t252;
+  IGM_REAL t254;
+  IGM_REAL t255;
+  IGM_REAL t257;
+  IGM_REAL t260;
+  IGM_REAL t262;
+  IGM_REAL t263;
+  IGM_REAL t264;
+  IGM_REAL t265;
+  IGM_REAL t266;
+  IGM_REAL t267;
+  IGM_REAL t268;
+  IGM_REAL t27;
+  IGM_REAL t270;
+  IGM_REAL t272;
+  IGM_REAL t275;
+  IGM_REAL t277;
+  IGM_REAL t28;
+  IGM_REAL t284;
+  IGM_REAL t286;
+  IGM_REAL t287;
+  IGM_REAL t289;
+  IGM_REAL t29;
+  IGM_REAL t290;
+  IGM_REAL t291;
+  IGM_REAL t292;
+  IGM_REAL t293;
+  IGM_REAL t297;
+  IGM_REAL t298;
+  IGM_REAL t299;
+  IGM_REAL t30;
+  IGM_REAL t31;
+  IGM_REAL t32;
+  IGM_REAL t321;
+  IGM_REAL t33;
+  IGM_REAL t337;
+  IGM_REAL t34;
+  IGM_REAL t351;
+  IGM_REAL t354;
+  IGM_REAL t355;
+  IGM_REAL t356;
+  IGM_REAL t357;
+  IGM_REAL t358;
+  IGM_REAL t359;
+  IGM_REAL t36;
+  IGM_REAL t360;
+  IGM_REAL t361;
+  IGM_REAL t362;
+  IGM_REAL t363;
+  IGM_REAL t364;
+  IGM_REAL t365;
+  IGM_REAL t366;
+  IGM_REAL t367;
+  IGM_REAL t368;
+  IGM_REAL t369;
+  IGM_REAL t37;
+  IGM_REAL t370;
+  IGM_REAL t371;
+  IGM_REAL t372;
+  IGM_REAL t373;
+  IGM_REAL t374;
+  IGM_REAL t375;
+  IGM_REAL t379;
+  IGM_REAL t380;
+  IGM_REAL t381;
+  IGM_REAL t383;
+  IGM_REAL t385;
+  IGM_REAL t386;
+  IGM_REAL t388;
+  IGM_REAL t389;
+  IGM_REAL t390;
+  IGM_REAL t391;
+  IGM_REAL t392;
+  IGM_REAL t393;
+  IGM_REAL t397;
+  IGM_REAL t398;
+  IGM_REAL t399;
+  IGM_REAL t4;
+  IGM_REAL t401;
+  IGM_REAL t403;
+  IGM_REAL t404;
+  IGM_REAL t406;
+  IGM_REAL t407;
+  IGM_REAL t409;
+  IGM_REAL t41;
+  IGM_REAL t410;
+  IGM_REAL t411;
+  IGM_REAL t412;
+  IGM_REAL t419;
+  IGM_REAL t42;
+  IGM_REAL t420;
+  IGM_REAL t421;
+  IGM_REAL t422;
+  IGM_REAL t423;
+  IGM_REAL t424;
+  IGM_REAL t426;
+  IGM_REAL t43;
+  IGM_REAL t430;
+  IGM_REAL t432;
+  IGM_REAL t434;
+  IGM_REAL t436;
+  IGM_REAL t437;
+  IGM_REAL t438;
+  IGM_REAL t439;
+  IGM_REAL t44;
+  IGM_REAL t440;
+  IGM_REAL t441;
+  IGM_REAL t442;
+  IGM_REAL t443;
+  IGM_REAL t444;
+  IGM_REAL t445;
+  IGM_REAL t448;
+  IGM_REAL t449;
+  IGM_REAL t450;
+  IGM_REAL t451;
+  IGM_REAL t452;
+  IGM_REAL t453;
+  IGM_REAL t454;
+  IGM_REAL t459;
+  IGM_REAL t46;
+  IGM_REAL t460;
+  IGM_REAL t462;
+  IGM_REAL t463;
+  IGM_REAL t464;
+  IGM_REAL t465;
+  IGM_REAL t466;
+  IGM_REAL t467;
+  IGM_REAL t468;
+  IGM_REAL t469;
+  IGM_REAL t470;
+  IGM_REAL t471;
+  IGM_REAL t475;
+  IGM_REAL t476;
+  IGM_REAL t477;
+  IGM_REAL t478;
+  IGM_REAL t479;
+  IGM_REAL t48;
+  IGM_REAL t480;
+  IGM_REAL t481;
+  IGM_REAL t482;
+  IGM_REAL t483;
+  IGM_REAL t484;
+  IGM_REAL t485;
+  IGM_REAL t486;
+  IGM_REAL t487;
+  IGM_REAL t488;
+  IGM_REAL t489;
+  IGM_REAL t490;
+  IGM_REAL t491;
+  IGM_REAL t492;
+  IGM_REAL t5;
+  IGM_REAL t50;
+  IGM_REAL t504;
+  IGM_REAL t506;
+  IGM_REAL t507;
+  IGM_REAL t51;
+  IGM_REAL t512;
+  IGM_REAL t518;
+  IGM_REAL t529;
+  IGM_REAL t53;
+  IGM_REAL t530;
+  IGM_REAL t531;
+  IGM_REAL t535;
+  IGM_REAL t539;
+  IGM_REAL t54;
+  IGM_REAL t540;
+  IGM_REAL t55;
+  IGM_REAL t552;
+  IGM_REAL t556;
+  IGM_REAL t56;
+  IGM_REAL t560;
+  IGM_REAL t561;
+  IGM_REAL t565;
+  IGM_REAL t566;
+  IGM_REAL t569;
+  IGM_REAL t57;
+  IGM_REAL t570;
+  IGM_REAL t58;
+  IGM_REAL t582;
+  IGM_REAL t59;
+  IGM_REAL t596;
+  IGM_REAL t6;
+  IGM_REAL t61;
+  IGM_REAL t613;
+  IGM_REAL t62;
+  IGM_REAL t630;
+  IGM_REAL t633;
+  IGM_REAL t634;
+  IGM_REAL t635;
+  IGM_REAL t636;
+  IGM_REAL t637;
+  IGM_REAL t638;
+  IGM_REAL t639;
+  IGM_REAL t640;
+  IGM_REAL t641;
+  IGM_REAL t642;
+  IGM_REAL t643;
+  IGM_REAL t644;
+  IGM_REAL t645;
+  IGM_REAL t646;
+  IGM_REAL t647;
+  IGM_REAL t648;
+  IGM_REAL t649;
+  IGM_REAL t650;
+  IGM_REAL t651;
+  IGM_REAL t652;
+  IGM_REAL t653;
+  IGM_REAL t658;
+  IGM_REAL t659;
+  IGM_REAL t66;
+  IGM_REAL t660;
+  IGM_REAL t662;
+  IGM_REAL t664;
+  IGM_REAL t665;
+  IGM_REAL t667;
+  IGM_REAL t668;
+  IGM_REAL t669;
+  IGM_REAL t67;
+  IGM_REAL t672;
+  IGM_REAL t673;
+  IGM_REAL t674;
+  IGM_REAL t676;
+  IGM_REAL t678;
+  IGM_REAL t68;
+  IGM_REAL t681;
+  IGM_REAL t682;
+  IGM_REAL t683;
+  IGM_REAL t684;
+  IGM_REAL t687;
+  IGM_REAL t688;
+  IGM_REAL t690;
+  IGM_REAL t693;
+  IGM_REAL t694;
+  IGM_REAL t695;
+  IGM_REAL t696;
+  IGM_REAL t698;
+  IGM_REAL t699;
+  IGM_REAL t7;
+  IGM_REAL t70;
+  IGM_REAL t700;
+  IGM_REAL t701;
+  IGM_REAL t702;
+  IGM_REAL t703;
+  IGM_REAL t704;
+  IGM_REAL t705;
+  IGM_REAL t706;
+  IGM_REAL t707;
+  IGM_REAL t708;
+  IGM_REAL t709;
+  IGM_REAL t710;
+  IGM_REAL t711;
+  IGM_REAL t716;
+  IGM_REAL t717;
+  IGM_REAL t718;
+  IGM_REAL t719;
+  IGM_REAL t72;
+  IGM_REAL t720;
+  IGM_REAL t721;
+  IGM_REAL t722;
+  IGM_REAL t723;
+  IGM_REAL t724;
+  IGM_REAL t725;
+  IGM_REAL t726;
+  IGM_REAL t727;
+  IGM_REAL t73;
+  IGM_REAL t730;
+  IGM_REAL t731;
+  IGM_REAL t733;
+  IGM_REAL t735;
+  IGM_REAL t736;
+  IGM_REAL t737;
+  IGM_REAL t738;
+  IGM_REAL t74;
+  IGM_REAL t740;
+  IGM_REAL t742;
+  IGM_REAL t744;
+  IGM_REAL t747;
+  IGM_REAL t749;
+  IGM_REAL t75;
+  IGM_REAL t750;
+  IGM_REAL t752;
+  IGM_REAL t755;
+  IGM_REAL t757;
+  IGM_REAL t759;
+  IGM_REAL t760;
+  IGM_REAL t761;
+  IGM_REAL t763;
+  IGM_REAL t765;
+  IGM_REAL t77;
+  IGM_REAL t770;
+  IGM_REAL t772;
+  IGM_REAL t774;
+  IGM_REAL t775;
+  IGM_REAL t777;
+  IGM_REAL t779;
+  IGM_REAL t78;
+  IGM_REAL t780;
+  IGM_REAL t783;
+  IGM_REAL t797;
+  IGM_REAL t798;
+  IGM_REAL t8;
+  IGM_REAL t80;
+  IGM_REAL t802;
+  IGM_REAL t806;
+  IGM_REAL t81;
+  IGM_REAL t810;
+  IGM_REAL t811;
+  IGM_REAL t817;
+  IGM_REAL t82;
+  IGM_REAL t822;
+  IGM_REAL t826;
+  IGM_REAL t83;
+  IGM_REAL t831;
+  IGM_REAL t832;
+  IGM_REAL t834;
+  IGM_REAL t835;
+  IGM_REAL t840;
+  IGM_REAL t846;
+  IGM_REAL t849;
+  IGM_REAL t85;
+  IGM_REAL t850;
+  IGM_REAL t854;
+  IGM_REAL t857;
+  IGM_REAL t871;
+  IGM_REAL t885;
+  IGM_REAL t889;
+  IGM_REAL t89;
+  IGM_REAL t899;
+  IGM_REAL t9;
+  IGM_REAL t909;
+  IGM_REAL t93;
+  IGM_REAL t94;
+  IGM_REAL t95;
+  IGM_REAL t96;
+  IGM_REAL t97;
+  {
+    t2 = LL[8];
+    t4 = IGM_COS_Q(5);
+    t5 = t2*t4;
+    t6 = LL[4];
+    t7 = IGM_SIN_Q(5);
+    t8 = t6*t7;
+    t9 = t5+t8;
+    t11 = IGM_COS_Q(4);
+    t12 = t9*t11;
+    t13 = LL[0];
+    t14 = IGM_SIN_Q(4);
+    t15 = t13*t14;
+    t16 = t12-t15;
+    t18 = IGM_COS_Q(3);
+    t19 = t16*t18;
+    t20 = t9*t14;
+    t21 = t13*t11;
+    t22 = t20+t21;
+    t23 = IGM_SIN_Q(3);
+    t24 = t22*t23;
+    t25 = t19-t24;
+    t27 = IGM_SIN_Q(2);
+    t28 = t25*t27;
+    t29 = t16*t23;
+    t30 = t22*t18;
+    t31 = t29+t30;
+    t32 = IGM_COS_Q(2);
+    t33 = t31*t32;
+    t34 = t28+t33;
+    t36 = IGM_COS_Q(0);
+    t37 = t34*t36;
+    t41 = IGM_CONST(sqrt(2.0));
+    t42 = (t25*t32-t31*t27)*t41;
+    t43 = t2*t7;
+    t44 = t6*t4;
+    t46 = (-t43+t44)*t41;
+    t48 = t42/2.0-t46/2.0;
+    t50 = IGM_SIN_Q(1);
+    t51 = t48*t50;
+    t53 = -t42/2.0-t46/2.0;
+    t54 = IGM_COS_Q(1);
+    t55 = t53*t54;
+    t56 = t51+t55;
+    t57 = IGM_SIN_Q(0);
+    t58 = t56*t57;
+    t59 = t37-t58;
+    t61 = IGM_COS_Q(17);
+    t62 = t59*t61;
+    t66 = (t34*t57+t56*t36)*t41;
+    t67 = t48*t54;
+    t68 = t53*t50;
+    t70 = (-t67+t68)*t41;
+    t72 = t66/2.0+t70/2.0;
+    t73 = IGM_SIN_Q(17);
+    t74 = t72*t73;
+    t75 = t62+t74;
+    t77 = IGM_COS_Q(18);
+    t78 = t75*t77;
+    t80 = -t66/2.0+t70/2.0;
+    t81 = IGM_SIN_Q(18);
+    t82 = t80*t81;
+    t83 = t78+t82;
+    t85 = IGM_COS_Q(20);
+    t89 = IGM_SIN_Q(23);
+    t93 = IGM_COS_Q(22);
+    t94 = t59*t93;
+    t95 = IGM_SIN_Q(22);
+    t96 = t80*t95;
+    t97 = t94+t96;
+    t100 = IGM_SIN_Q(20);
+    t101 = t83*t100;
+    t102 = t59*t73;
+    t103 = t72*t61;
+    t104 = -t102+t103;
+    t106 = IGM_SIN_Q(19);
+    t107 = t104*t106;
+    t108 = t75*t81;
+    t109 = t80*t77;
+    t110 = -t108+t109;
+    t111 = IGM_COS_Q(19);
+    t112 = t110*t111;
+    t113 = -t107+t112;
+    t114 = t113*t85;
+    t115 = -t101+t114;
+    t117 = IGM_SIN_Q(21);
+    t120 = t80*t41;
+    t122 = -t72*t41;
+    t124 = -t120/2.0-t122/2.0;
+    t126 = IGM_COS_Q(7);
+    t127 = t124*t126;
+    t129 = IGM_SIN_Q(6);
+    t130 = t59*t129;
+    t132 = t120/2.0-t122/2.0;
+    t133 = IGM_COS_Q(6);
+    t134 = t132*t133;
+    t135 = -t130+t134;
+    t136 = IGM_SIN_Q(7);
+    t137 = t135*t136;
+    t139 = (t127+t137)*t41;
+    t140 = t124*t136;
+    t141 = t135*t126;
+    t143 = (-t140+t141)*t41;
+    t145 = t139/2.0+t143/2.0;
+    t147 = IGM_COS_Q(8);
+    t148 = t145*t147;
+    t150 = t59*t133;
+    t151 = t132*t129;
+    t152 = -t150-t151;
+    t153 = IGM_SIN_Q(8);
+    t154 = t152*t153;
+    t156 = t145*t153;
+    t157 = t152*t147;
+    t158 = -t156+t157;
+    t160 = IGM_SIN_Q(9);
+    t161 = t158*t160;
+    t163 = t104*t111;
+    t164 = t110*t106;
+    t165 = t163+t164;
+    t166 = IGM_COS_Q(21);
+    t173 = IGM_COS_Q(9);
+    t174 = t158*t173;
+    t176 = 0.2606799616E-2*t83*t85+0.3775495252E-3*t72*t89+0.5082624939E-2*t97*
+t89+0.8051018213E-4*t115*t117+0.1681938551E-1*t148+0.1681938551E-1*t154+
+0.9419629563E-2*t161+0.8051018213E-4*t165*t166-0.5687628827E-3*t151
+-0.1607889161E-3*t134+0.1607889161E-3*t130-0.1512290733E-3*t143-0.2893250095E-3
+*t174;
+    t181 = t148+t154;
+    t182 = t181*t160;
+    t184 = t181*t173;
+    t185 = t184+t161;
+    t187 = IGM_COS_Q(10);
+    t188 = t185*t187;
+    t190 = IGM_COS_Q(23);
+    t193 = -t182+t174;
+    t194 = IGM_SIN_Q(10);
+    t195 = t193*t194;
+    t206 = 0.7932620886E-4*t165*t117-0.2369931678E-4*t114+0.2369931678E-4*t101+
+0.2893250095E-3*t182-0.1832763156E-3*t188-0.5082624939E-2*t72*t190
+-0.1832763156E-3*t195-0.1078086072E-3*t157+0.9970896939E-4*t137+0.2606799616E-2
+*t113*t100-0.8799425961E-3*t193*t187+0.8799425961E-3*t185*t194+0.8823452451E-4*
+t141;
+    t209 = t188+t195;
+    t211 = IGM_COS_Q(11);
+    t215 = -t139/2.0+t143/2.0;
+    t216 = IGM_SIN_Q(11);
+    t230 = -0.8823452451E-4*t140+0.1081557015E-2*t209*t211+0.1081557015E-2*t215
+*t216+0.9419629563E-2*t184-0.1112574236E-3*t215*t211+0.9970896939E-4*t127+
+0.1832763156E-3*t8+0.9332037043E-1*t12+0.1832763156E-3*t5-0.9332037043E-1*t15+
+0.1078086072E-3*t29-0.3024581465E-3*t43+0.3024581465E-3*t44;
+    t242 = IGM_COS_Q(12);
+    t243 = t59*t242;
+    t245 = IGM_SIN_Q(12);
+    t246 = t72*t245;
+    t248 = t72*t242;
+    t250 = t59*t245;
+    t252 = -t250+t248;
+    t254 = IGM_COS_Q(14);
+    t255 = t252*t254;
+    t257 = 0.2893250095E-3*t20+0.2893250095E-3*t21+0.8318061448E-1*t19+
+0.1112574236E-3*t6+0.4402844298E-1*t2+0.8799425961E-3*t13+0.9999999999*LL[12]+
+0.1112574236E-3*t209*t216-0.2570662873E-4*t243-0.2570662873E-4*t246
+-0.9381437244E-4*t248+0.9381437244E-4*t250-0.1702509553E-4*t255;
+    t260 = t243+t246;
+    t262 = IGM_SIN_Q(13);
+    t263 = t260*t262;
+    t264 = IGM_COS_Q(13);
+    t265 = t80*t264;
+    t266 = -t263+t265;
+    t267 = IGM_SIN_Q(14);
+    t268 = t266*t267;
+    t270 = t255+t268;
+    t272 = IGM_COS_Q(16);
+    t275 = t260*t264;
+    t277 = t80*t262;
+    t284 = t275+t277;
+    t286 = IGM_SIN_Q(15);
+    t287 = t284*t286;
+    t289 = t252*t267;
+    t290 = t266*t254;
+    t291 = -t289+t290;
+    t292 = IGM_COS_Q(15);
+    t293 = t291*t292;
+    t297 = -0.1702509553E-4*t268+0.8051018213E-4*t270*t272+0.4677530128E-2*t275
++0.4677530128E-2*t277+0.2061233404E-3*t120+0.2061233404E-3*t122-0.5687628827E-3
+*t150-0.9761137487E-4*t263+0.9761137487E-4*t265-0.2369931678E-4*t287+
+0.2369931678E-4*t293+0.1232237092E-6*t289-0.1232237092E-6*t290;
+    t298 = -t287+t293;
+    t299 = IGM_SIN_Q(16);
+    t321 = 0.8051018213E-4*t298*t299-0.7932620886E-4*t115*t166+0.8945848979E-4*
+t59*t95-0.8945848979E-4*t80*t93+0.2606799616E-2*t284*t292+0.2606799616E-2*t291*
+t286+0.1078086072E-3*t156+0.7932620886E-4*t298*t272-0.7932620886E-4*t270*t299
+-0.2570662873E-4*t62-0.2570662873E-4*t74-0.9381437244E-4*t103+0.9381437244E-4*
+t102;
+    t337 = 0.4677530128E-2*t78+0.4677530128E-2*t82-0.8503258945E-4*t109+
+0.8503258945E-4*t108-0.1702509553E-4*t163-0.1702509553E-4*t164+0.1232237092E-6*
+t112-0.1232237092E-6*t107-0.3696711277E-6*t94-0.3696711277E-6*t96+
+0.3775495252E-3*t97*t190-0.8318061448E-1*t24+0.1078086072E-3*t30;
+    t351 = -0.5687628827E-3*t28-0.5687628827E-3*t33-0.9397174694E-4*t42+
+0.5737222431E-5*t46+0.4122466806E-3*t67-0.4122466806E-3*t68-0.1607889161E-3*t51
+-0.1607889161E-3*t55-0.101865705E-2*t37+0.101865705E-2*t58-0.1660372087E-1*t66
+-0.6659098766E-1*t70+0.1512290733E-3*t139;
+    A[0] = t176+t206+t230+t257+t297+t321+t337+t351;
+    t354 = LL[9];
+    t355 = t354*t4;
+    t356 = LL[5];
+    t357 = t356*t7;
+    t358 = t355+t357;
+    t359 = t358*t11;
+    t360 = LL[1];
+    t361 = t360*t14;
+    t362 = t359-t361;
+    t363 = t362*t18;
+    t364 = t358*t14;
+    t365 = t360*t11;
+    t366 = t364+t365;
+    t367 = t366*t23;
+    t368 = t363-t367;
+    t369 = t368*t27;
+    t370 = t362*t23;
+    t371 = t366*t18;
+    t372 = t370+t371;
+    t373 = t372*t32;
+    t374 = t369+t373;
+    t375 = t374*t36;
+    t379 = (t368*t32-t372*t27)*t41;
+    t380 = t354*t7;
+    t381 = t356*t4;
+    t383 = (-t380+t381)*t41;
+    t385 = t379/2.0-t383/2.0;
+    t386 = t385*t50;
+    t388 = -t379/2.0-t383/2.0;
+    t389 = t388*t54;
+    t390 = t386+t389;
+    t391 = t390*t57;
+    t392 = t375-t391;
+    t393 = t392*t133;
+    t397 = (t374*t57+t390*t36)*t41;
+    t398 = t385*t54;
+    t399 = t388*t50;
+    t401 = (-t398+t399)*t41;
+    t403 = -t397/2.0+t401/2.0;
+    t404 = t403*t41;
+    t406 = -t397/2.0-t401/2.0;
+    t407 = t406*t41;
+    t409 = t404/2.0-t407/2.0;
+    t410 = t409*t129;
+    t411 = -t393-t410;
+    t412 = t411*t153;
+    t419 = -t404/2.0-t407/2.0;
+    t420 = t419*t136;
+    t421 = t392*t129;
+    t422 = t409*t133;
+    t423 = -t421+t422;
+    t424 = t423*t126;
+    t426 = (-t420+t424)*t41;
+    t430 = t419*t126;
+    t432 = t423*t136;
+    t434 = (t430+t432)*t41;
+    t436 = t434/2.0+t426/2.0;
+    t437 = t436*t147;
+    t438 = t437+t412;
+    t439 = t438*t160;
+    t440 = t436*t153;
+    t441 = t411*t147;
+    t442 = -t440+t441;
+    t443 = t442*t173;
+    t444 = -t439+t443;
+    t445 = t444*t194;
+    t448 = t392*t61;
+    t449 = -t406;
+    t450 = t449*t73;
+    t451 = t448+t450;
+    t452 = t451*t77;
+    t453 = t403*t81;
+    t454 = t452+t453;
+    t459 = 0.1681938551E-1*t412-0.5687628827E-3*t410+0.1112574236E-3*t356+
+0.4402844298E-1*t354+0.8799425961E-3*t360-0.1512290733E-3*t426-0.5687628827E-3*
+t393-0.8823452451E-4*t420+0.9970896939E-4*t430-0.1832763156E-3*t445+
+0.9970896939E-4*t432+0.2606799616E-2*t454*t85-0.8799425961E-3*t444*t187;
+    t460 = t438*t173;
+    t462 = t392*t73;
+    t463 = t449*t61;
+    t464 = -t462+t463;
+    t465 = t464*t106;
+    t466 = t451*t81;
+    t467 = t403*t77;
+    t468 = -t466+t467;
+    t469 = t468*t111;
+    t470 = -t465+t469;
+    t471 = t470*t85;
+    t475 = t392*t242;
+    t476 = t449*t245;
+    t477 = t475+t476;
+    t478 = t477*t264;
+    t479 = t403*t262;
+    t480 = t478+t479;
+    t481 = t480*t286;
+    t482 = t392*t245;
+    t483 = t449*t242;
+    t484 = -t482+t483;
+    t485 = t484*t267;
+    t486 = t477*t262;
+    t487 = t403*t264;
+    t488 = -t486+t487;
+    t489 = t488*t254;
+    t490 = -t485+t489;
+    t491 = t490*t292;
+    t492 = -t481+t491;
+    t504 = 0.9419629563E-2*t460-0.2369931678E-4*t471+0.9999999999*LL[13]+
+0.7932620886E-4*t492*t272+0.2061233404E-3*t407+0.2061233404E-3*t404+
+0.4122466806E-3*t398-0.101865705E-2*t375-0.9381437244E-4*t483+0.9381437244E-4*
+t482+0.8823452451E-4*t424-0.1232237092E-6*t489+0.1232237092E-6*t485;
+    t506 = t454*t100;
+    t507 = -t506+t471;
+    t512 = t464*t111;
+    t518 = t392*t93;
+    t529 = 0.8051018213E-4*t507*t117-0.8945848979E-4*t403*t93-0.1702509553E-4*
+t512+0.3775495252E-3*t449*t89-0.5082624939E-2*t449*t190-0.3696711277E-6*t518+
+0.1607889161E-3*t421+0.8051018213E-4*t492*t299-0.1607889161E-3*t422
+-0.2369931678E-4*t481-0.7932620886E-4*t507*t166+0.8503258945E-4*t466+
+0.2369931678E-4*t506;
+    t530 = t442*t160;
+    t531 = t460+t530;
+    t535 = t484*t254;
+    t539 = t531*t187;
+    t540 = t539+t445;
+    t552 = -t434/2.0+t426/2.0;
+    t556 = 0.8799425961E-3*t531*t194+0.1512290733E-3*t434-0.1702509553E-4*t535+
+0.2606799616E-2*t480*t292+0.1081557015E-2*t540*t211-0.2570662873E-4*t475+
+0.2606799616E-2*t490*t286-0.1660372087E-1*t397-0.6659098766E-1*t401+
+0.1112574236E-3*t540*t216-0.2570662873E-4*t476-0.1112574236E-3*t552*t211
+-0.1832763156E-3*t539;
+    t560 = t468*t106;
+    t561 = t512+t560;
+    t565 = t403*t95;
+    t566 = t518+t565;
+    t569 = t488*t267;
+    t570 = t535+t569;
+    t582 = -0.1232237092E-6*t465+0.8051018213E-4*t561*t166-0.1702509553E-4*t560
++0.3775495252E-3*t566*t190-0.7932620886E-4*t570*t299-0.2570662873E-4*t450
+-0.9381437244E-4*t463+0.9381437244E-4*t462+0.2606799616E-2*t470*t100+
+0.4677530128E-2*t479+0.9761137487E-4*t487-0.9761137487E-4*t486+0.1681938551E-1*
+t437;
+    t596 = 0.101865705E-2*t391-0.1607889161E-3*t386-0.1607889161E-3*t389
+-0.3024581465E-3*t380+0.3024581465E-3*t381+0.2893250095E-3*t364+0.2893250095E-3
+*t365-0.8318061448E-1*t367+0.1078086072E-3*t371-0.5687628827E-3*t369
+-0.5687628827E-3*t373-0.9397174694E-4*t379+0.5737222431E-5*t383;
+    t613 = -0.4122466806E-3*t399+0.1832763156E-3*t357+0.9332037043E-1*t359+
+0.1832763156E-3*t355-0.9332037043E-1*t361+0.1078086072E-3*t370+0.8318061448E-1*
+t363+0.2369931678E-4*t491+0.4677530128E-2*t478+0.7932620886E-4*t561*t117+
+0.1078086072E-3*t440+0.1232237092E-6*t469+0.1081557015E-2*t552*t216;
+    t630 = -0.2893250095E-3*t443-0.3696711277E-6*t565+0.5082624939E-2*t566*t89+
+0.8051018213E-4*t570*t272+0.4677530128E-2*t452-0.1078086072E-3*t441+
+0.4677530128E-2*t453-0.8503258945E-4*t467-0.2570662873E-4*t448+0.2893250095E-3*
+t439-0.1702509553E-4*t569+0.9419629563E-2*t530+0.8945848979E-4*t392*t95;
+    A[1] = t459+t504+t529+t556+t582+t596+t613+t630;
+    t633 = LL[10];
+    t634 = t633*t4;
+    t635 = LL[6];
+    t636 = t635*t7;
+    t637 = t634+t636;
+    t638 = t637*t11;
+    t639 = LL[2];
+    t640 = t639*t14;
+    t641 = t638-t640;
+    t642 = t641*t18;
+    t643 = t637*t14;
+    t644 = t639*t11;
+    t645 = t643+t644;
+    t646 = t645*t23;
+    t647 = t642-t646;
+    t648 = t647*t27;
+    t649 = t641*t23;
+    t650 = t645*t18;
+    t651 = t649+t650;
+    t652 = t651*t32;
+    t653 = t648+t652;
+    t658 = (t647*t32-t651*t27)*t41;
+    t659 = t633*t7;
+    t660 = t635*t4;
+    t662 = (-t659+t660)*t41;
+    t664 = t658/2.0-t662/2.0;
+    t665 = t664*t50;
+    t667 = -t658/2.0-t662/2.0;
+    t668 = t667*t54;
+    t669 = t665+t668;
+    t672 = (t653*t57+t669*t36)*t41;
+    t673 = t664*t54;
+    t674 = t667*t50;
+    t676 = (-t673+t674)*t41;
+    t678 = t672/2.0+t676/2.0;
+    t681 = t653*t36;
+    t682 = t669*t57;
+    t683 = t681-t682;
+    t684 = t683*t93;
+    t687 = -t672/2.0+t676/2.0;
+    t688 = t687*t95;
+    t690 = t684+t688;
+    t693 = t683*t242;
+    t694 = t678*t245;
+    t695 = t693+t694;
+    t696 = t695*t262;
+    t698 = t695*t264;
+    t699 = t687*t262;
+    t700 = t698+t699;
+    t701 = t700*t286;
+    t702 = t683*t245;
+    t703 = t678*t242;
+    t704 = -t702+t703;
+    t705 = t704*t267;
+    t706 = t687*t264;
+    t707 = -t696+t706;
+    t708 = t707*t254;
+    t709 = -t705+t708;
+    t710 = t709*t292;
+    t711 = -t701+t710;
+    t716 = t683*t73;
+    t717 = t678*t61;
+    t718 = -t716+t717;
+    t719 = t718*t106;
+    t720 = t683*t61;
+    t721 = t678*t73;
+    t722 = t720+t721;
+    t723 = t722*t81;
+    t724 = t687*t77;
+    t725 = -t723+t724;
+    t726 = t725*t111;
+    t727 = -t719+t726;
+    t730 = t683*t129;
+    t731 = t687*t41;
+    t733 = -t678*t41;
+    t735 = t731/2.0-t733/2.0;
+    t736 = t735*t133;
+    t737 = -t730+t736;
+    t738 = t737*t126;
+    t740 = t722*t77;
+    t742 = t718*t111;
+    t744 = t727*t85;
+    t747 = -0.5082624939E-2*t678*t190-0.3696711277E-6*t684-0.3696711277E-6*t688
++0.5082624939E-2*t690*t89-0.9761137487E-4*t696+0.7932620886E-4*t711*t272+
+0.3775495252E-3*t678*t89+0.2606799616E-2*t727*t100+0.8823452451E-4*t738+
+0.4677530128E-2*t740-0.1702509553E-4*t742-0.2369931678E-4*t744-0.2369931678E-4*
+t701;
+    t749 = -t731/2.0-t733/2.0;
+    t750 = t749*t136;
+    t752 = t749*t126;
+    t755 = t737*t136;
+    t757 = (t752+t755)*t41;
+    t759 = t687*t81;
+    t760 = t740+t759;
+    t761 = t760*t100;
+    t763 = t735*t129;
+    t765 = -t761+t744;
+    t770 = (-t750+t738)*t41;
+    t772 = t683*t133;
+    t774 = -t772-t763;
+    t775 = t774*t153;
+    t777 = t774*t147;
+    t779 = t725*t106;
+    t780 = t742+t779;
+    t783 = -0.8823452451E-4*t750+0.9970896939E-4*t752+0.1232237092E-6*t726+
+0.1512290733E-3*t757+0.2369931678E-4*t761-0.5687628827E-3*t763-0.7932620886E-4*
+t765*t166+0.1232237092E-6*t705-0.1512290733E-3*t770-0.5687628827E-3*t772+
+0.1681938551E-1*t775-0.1078086072E-3*t777+0.7932620886E-4*t780*t117;
+    t797 = t757/2.0+t770/2.0;
+    t798 = t797*t153;
+    t802 = t797*t147;
+    t806 = -0.8945848979E-4*t687*t93+0.8945848979E-4*t683*t95+0.4677530128E-2*
+t759-0.8503258945E-4*t724-0.2570662873E-4*t720-0.9381437244E-4*t717+
+0.9381437244E-4*t716+0.2606799616E-2*t760*t85+0.1078086072E-3*t798+
+0.8051018213E-4*t711*t299+0.1681938551E-1*t802+0.1112574236E-3*t635+
+0.4402844298E-1*t633;
+    t810 = -t798+t777;
+    t811 = t810*t160;
+    t817 = t810*t173;
+    t822 = t704*t254;
+    t826 = 0.8799425961E-3*t639+0.9999999999*LL[14]+0.9419629563E-2*t811
+-0.1660372087E-1*t672-0.6659098766E-1*t676+0.2061233404E-3*t731+0.2061233404E-3
+*t733-0.2893250095E-3*t817-0.2570662873E-4*t721+0.8051018213E-4*t765*t117
+-0.1702509553E-4*t822+0.2369931678E-4*t710+0.4677530128E-2*t698;
+    t831 = t802+t775;
+    t832 = t831*t160;
+    t834 = -t832+t817;
+    t835 = t834*t194;
+    t840 = t831*t173;
+    t846 = t840+t811;
+    t849 = t707*t267;
+    t850 = t822+t849;
+    t854 = -t757/2.0+t770/2.0;
+    t857 = 0.2606799616E-2*t700*t292+0.2893250095E-3*t832-0.1832763156E-3*t835
+-0.1232237092E-6*t708-0.8799425961E-3*t834*t187+0.9419629563E-2*t840
+-0.1607889161E-3*t736+0.1607889161E-3*t730-0.1702509553E-4*t779+0.9970896939E-4
+*t755+0.8799425961E-3*t846*t194-0.7932620886E-4*t850*t299+0.1081557015E-2*t854*
+t216;
+    t871 = 0.1832763156E-3*t636+0.9332037043E-1*t638+0.1832763156E-3*t634
+-0.9332037043E-1*t640+0.1078086072E-3*t649+0.8318061448E-1*t642-0.3024581465E-3
+*t659+0.3024581465E-3*t660+0.2893250095E-3*t643+0.2893250095E-3*t644
+-0.8318061448E-1*t646+0.1078086072E-3*t650-0.5687628827E-3*t648;
+    t885 = t846*t187;
+    t889 = -0.5687628827E-3*t652-0.9397174694E-4*t658+0.5737222431E-5*t662
+-0.4122466806E-3*t674-0.1607889161E-3*t665-0.1607889161E-3*t668+0.101865705E-2*
+t682+0.4122466806E-3*t673-0.101865705E-2*t681+0.8503258945E-4*t723
+-0.1112574236E-3*t854*t211-0.1832763156E-3*t885+0.8051018213E-4*t850*t272;
+    t899 = t885+t835;
+    t909 = -0.1232237092E-6*t719+0.9761137487E-4*t706-0.1702509553E-4*t849+
+0.3775495252E-3*t690*t190+0.8051018213E-4*t780*t166-0.2570662873E-4*t693+
+0.4677530128E-2*t699+0.1112574236E-3*t899*t216-0.2570662873E-4*t694
+-0.9381437244E-4*t703+0.9381437244E-4*t702+0.2606799616E-2*t709*t286+
+0.1081557015E-2*t899*t211;
+    A[2] = t747+t783+t806+t826+t857+t871+t889+t909;
+    return;
+  }
@@ -0,0 +1,1849 @@
+/* Generated using codegen (2012-02-13, 17:09:16) */ 
+/*
+ * Body of LLeg2Joints_select(), the IGM_* macros are described in maple_double.h.
+ * The statements are executed only if they are needed for the frames
+ * selected by the bit mask 'frames', which must be an argument of the
+ * instantiating function.
+ */
+  IGM_REAL t101;
+  IGM_REAL t102;
+  IGM_REAL t104;
+  IGM_REAL t105;
+  IGM_REAL t109;
+  IGM_REAL t11;
+  IGM_REAL t110;
+  IGM_REAL t111;
+  IGM_REAL t112;
+  IGM_REAL t113;
+  IGM_REAL t115;
+  IGM_REAL t116;
+  IGM_REAL t118;
+  IGM_REAL t119;
+  IGM_REAL t12;
+  IGM_REAL t120;
+  IGM_REAL t121;
+  IGM_REAL t122;
+  IGM_REAL t123;
+  IGM_REAL t124;
+  IGM_REAL t125;
+  IGM_REAL t126;
+  IGM_REAL t127;
+  IGM_REAL t128;
+  IGM_REAL t129;
+  IGM_REAL t13;
+  IGM_REAL t130;
+  IGM_REAL t131;
+  IGM_REAL t132;
+  IGM_REAL t133;
+  IGM_REAL t134;
+  IGM_REAL t135;
+  IGM_REAL t136;
+  IGM_REAL t137;
+  IGM_REAL t138;
+  IGM_REAL t139;
+  IGM_REAL t14;
+  IGM_REAL t140;
+  IGM_REAL t141;
+  IGM_REAL t142;
+  IGM_REAL t143;
+  IGM_REAL t145;
+  IGM_REAL t146;
+  IGM_REAL t147;
+  IGM_REAL t148;
+  IGM_REAL t149;
+  IGM_REAL t15;
+  IGM_REAL t151;
+  IGM_REAL t152;
+  IGM_REAL t156;
+  IGM_REAL t157;
+  IGM_REAL t159;
+  IGM_REAL t16;
+  IGM_REAL t160;
+  IGM_REAL t162;
+  IGM_REAL t163;
+  IGM_REAL t165;
+  IGM_REAL t166;
+  IGM_REAL t167;
+  IGM_REAL t168;
+  IGM_REAL t169;
+  IGM_REAL t170;
+  IGM_REAL t171;
+  IGM_REAL t175;
+  IGM_REAL t176;
+  IGM_REAL t178;
+  IGM_REAL t179;
+  IGM_REAL t18;
+  IGM_REAL t181;
+  IGM_REAL t182;
+  IGM_REAL t184;
+  IGM_REAL t185;
+  IGM_REAL t186;
+  IGM_REAL t187;
+  IGM_REAL t188;
+  IGM_REAL t189;
+  IGM_REAL t19;
+  IGM_REAL t193;
+  IGM_REAL t194;
+  IGM_REAL t196;
+  IGM_REAL t197;
+  IGM_REAL t199;
+  IGM_REAL t2;
+  IGM_REAL t20;
+  IGM_REAL t200;
+  IGM_REAL t202;
+  IGM_REAL t203;
+  IGM_REAL t204;
+  IGM_REAL t205;
+  IGM_REAL t206;
+  IGM_REAL t207;
+  IGM_REAL t208;
+  IGM_REAL t209;
+  IGM_REAL t21;
+  IGM_REAL t213;
+  IGM_REAL t214;
+  IGM_REAL t215;
+  IGM_REAL t216;
+  IGM_REAL t217;
+  IGM_REAL t218;
+  IGM_REAL t219;
+  IGM_REAL t22;
+  IGM_REAL t221;
+  IGM_REAL t222;
+  IGM_REAL t223;
+  IGM_REAL t224;
+  IGM_REAL t225;
+  IGM_REAL t226;
+  IGM_REAL t227;
+  IGM_REAL t228;
+  IGM_REAL t229;
+  IGM_REAL t23;
+  IGM_REAL t230;
+  IGM_REAL t231;
+  IGM_REAL t232;
+  IGM_REAL t233;
+  IGM_REAL t234;
+  IGM_REAL t235;
+  IGM_REAL t236;
+  IGM_REAL t237;
+  IGM_REAL t238;
+  IGM_REAL t24;
+  IGM_REAL t240;
+  IGM_REAL t242;
+  IGM_REAL t243;
+  IGM_REAL t244;
+  IGM_REAL t245;
+  IGM_REAL t246;
+  IGM_REAL t247;
+  IGM_REAL t248;
+  IGM_REAL t25;
+  IGM_REAL t250;
+  IGM_REAL t251;
+  IGM_REAL t252;
+  IGM_REAL t253;
+  IGM_REAL t254;
+  IGM_REAL t255;
+  IGM_REAL t257;
+  IGM_REAL t258;
+  IGM_REAL t259;
+  IGM_REAL t260;
+  IGM_REAL t261;
+  IGM_REAL t262;
+  IGM_REAL t263;
+  IGM_REAL t264;
+  IGM_REAL t265;
+  IGM_REAL t266;
+  IGM_REAL t27;
+  IGM_REAL t271;
+  IGM_REAL t272;
+  IGM_REAL t273;
+  IGM_REAL t274;
+  IGM_REAL t275;
+  IGM_REAL t276;
+  IGM_REAL t277;
+  IGM_REAL t278;
+  IGM_REAL t279;
+  IGM_REAL t28;
+  IGM_REAL t280;
+  IGM_REAL t281;
+  IGM_REAL t282;
+  IGM_REAL t283;
+  IGM_REAL t284;
+  IGM_REAL t285;
+  IGM_REAL t286;
+  IGM_REAL t287;
+  IGM_REAL t288;
+  IGM_REAL t289;
+  IGM_REAL t29;
+  IGM_REAL t290;
+  IGM_REAL t292;
+  IGM_REAL t293;
+  IGM_REAL t294;
+  IGM_REAL t295;
+  IGM_REAL t296;
+  IGM_REAL t297;
+  IGM_REAL t298;
+  IGM_REAL t299;
+  IGM_REAL t30;
+  IGM_REAL t300;
+  IGM_REAL t301;
+  IGM_REAL t302;
+  IGM_REAL t303;
+  IGM_REAL t304;
+  IGM_REAL t305;
+  IGM_REAL t306;
+  IGM_REAL t307;
+  IGM_REAL t308;
+  IGM_REAL t309;
+  IGM_REAL t31;
+  IGM_REAL t310;
+  IGM_REAL t311;
+  IGM_REAL t313;
+  IGM_REAL t314;
+  IGM_REAL t315;
+  IGM_REAL t316;
+  IGM_REAL t317;
+  IGM_REAL t318;
+  IGM_REAL t319;
+  IGM_REAL t32;
+  IGM_REAL t320;
+  IGM_REAL t321;
+  IGM_REAL t322;
+  IGM_REAL t323;
+  IGM_REAL t324;
+  IGM_REAL t325;
+  IGM_REAL t326;
+  IGM_REAL t328;
+  IGM_REAL t329;
+  IGM_REAL t33;
+  IGM_REAL t330;
+  IGM_REAL t331;
+  IGM_REAL t332;
+  IGM_REAL t333;
+  IGM_REAL t334;
+  IGM_REAL t335;
+  IGM_REAL t336;
+  IGM_REAL t337;
+  IGM_REAL t338;
+  IGM_REAL t339;
+  IGM_REAL t34;
+  IGM_REAL t340;
+  IGM_REAL t341;
+  IGM_REAL t342;
+  IGM_REAL t343;
+  IGM_REAL t344;
+  IGM_REAL t345;
+  IGM_REAL t346;
+  IGM_REAL t347;
+  IGM_REAL t348;
+  IGM_REAL t349;
+  IGM_REAL t35;
+  IGM_REAL t350;
+  IGM_REAL t352;
+  IGM_REAL t353;
+  IGM_REAL t354;
+  IGM_REAL t355;
+  IGM_REAL t356;
+  IGM_REAL t357;
+  IGM_REAL t358;
+  IGM_REAL t359;
+  IGM_REAL t36;
+  IGM_REAL t360;
+  IGM_REAL t361;
+  IGM_REAL t362;
+  IGM_REAL t363;
+  IGM_REAL t364;
+  IGM_REAL t365;
+  IGM_REAL t367;
+  IGM_REAL t368;
+  IGM_REAL t369;
+  IGM_REAL t37;
+  IGM_REAL t370;
+  IGM_REAL t371;
+  IGM_REAL t372;
+  IGM_REAL t373;
+  IGM_REAL t374;
+  IGM_REAL t375;
+  IGM_REAL t376;
+  IGM_REAL t377;
+  IGM_REAL t378;
+  IGM_REAL t379;
+  IGM_REAL t38;
+  IGM_REAL t380;
+  IGM_REAL t381;
+  IGM_REAL t382;
+  IGM_REAL t383;
+  IGM_REAL t384;
+  IGM_REAL t385;
+  IGM_REAL t386;
+  IGM_REAL t388;
+  IGM_REAL t389;
+  IGM_REAL t39;
+  IGM_REAL t390;
+  IGM_REAL t391;
+  IGM_REAL t392;
+  IGM_REAL t393;
+  IGM_REAL t394;
+  IGM_REAL t395;
+  IGM_REAL t396;
+  IGM_REAL t397;
+  IGM_REAL t398;
+  IGM_REAL t399;
+  IGM_REAL t4;
+  IGM_REAL t40;
+  IGM_REAL t400;
+  IGM_REAL t401;
+  IGM_REAL t403;
+  IGM_REAL t404;
+  IGM_REAL t405;
+  IGM_REAL t406;
+  IGM_REAL t407;
+  IGM_REAL t408;
+  IGM_REAL t409;
+  IGM_REAL t41;
+  IGM_REAL t410;
+  IGM_REAL t411;
+  IGM_REAL t412;
+  IGM_REAL t413;
+  IGM_REAL t414;
+  IGM_REAL t415;
+  IGM_REAL t416;
+  IGM_REAL t42;
+  IGM_REAL t424;
+  IGM_REAL t425;
+  IGM_REAL t426;
+  IGM_REAL t427;
+  IGM_REAL t428;
+  IGM_REAL t429;
+  IGM_REAL t43;
+  IGM_REAL t430;
+  IGM_REAL t431;
+  IGM_REAL t432;
+  IGM_REAL t433;
+  IGM_REAL t434;
+  IGM_REAL t435;
+  IGM_REAL t436;
+  IGM_REAL t437;
+  IGM_REAL t438;
+  IGM_REAL t439;
+  IGM_REAL t44;
+  IGM_REAL t440;
+  IGM_REAL t441;
+  IGM_REAL t442;
+  IGM_REAL t443;
+  IGM_REAL t445;
+  IGM_REAL t446;
+  IGM_REAL t447;
+  IGM_REAL t448;
+  IGM_REAL t449;
+  IGM_REAL t45;
+  IGM_REAL t450;
+  IGM_REAL t451;
+  IGM_REAL t452;
+  IGM_REAL t453;
+  IGM_REAL t454;
+  IGM_REAL t455;
+  IGM_REAL t456;
+  IGM_REAL t457;
+  IGM_REAL t458;
+  IGM_REAL t46;
+  IGM_REAL t460;
+  IGM_REAL t461;
+  IGM_REAL t462;
+  IGM_REAL t463;
+  IGM_REAL t464;
+  IGM_REAL t465;
+  IGM_REAL t466;
+  IGM_REAL t467;
+  IGM_REAL t468;
+  IGM_REAL t469;
+  IGM_REAL t47;
+  IGM_REAL t470;
+  IGM_REAL t471;
+  IGM_REAL t472;
+  IGM_REAL t473;
+  IGM_REAL t474;
+  IGM_REAL t475;
+  IGM_REAL t476;
+  IGM_REAL t477;
+  IGM_REAL t478;
+  IGM_REAL t479;
+  IGM_REAL t48;
+  IGM_REAL t481;
+  IGM_REAL t482;
+  IGM_REAL t483;
+  IGM_REAL t484;
+  IGM_REAL t485;
+  IGM_REAL t486;
+  IGM_REAL t487;
+  IGM_REAL t488;
+  IGM_REAL t489;
+  IGM_REAL t49;
+  IGM_REAL t490;
+  IGM_REAL t491;
+  IGM_REAL t492;
+  IGM_REAL t493;
+  IGM_REAL t494;
+  IGM_REAL t496;
+  IGM_REAL t497;
+  IGM_REAL t498;
+  IGM_REAL t499;
+  IGM_REAL t5;
+  IGM_REAL t50;
+  IGM_REAL t500;
+  IGM_REAL t501;
+  IGM_REAL t502;
+  IGM_REAL t503;
+  IGM_REAL t504;
+  IGM_REAL t505;
+  IGM_REAL t506;
+  IGM_REAL t507;
+  IGM_REAL t508;
+  IGM_REAL t509;
+  IGM_REAL t51;
+  IGM_REAL t517;
+  IGM_REAL t518;
+  IGM_REAL t519;
+  IGM_REAL t52;
+  IGM_REAL t520;
+  IGM_REAL t521;
+  IGM_REAL t522;
+  IGM_REAL t523;
+  IGM_REAL t524;
+  IGM_REAL t525;
+  IGM_REAL t526;
+  IGM_REAL t527;
+  IGM_REAL t528;
+  IGM_REAL t529;
+  IGM_REAL t53;
+  IGM_REAL t530;
+  IGM_REAL t538;
+  IGM_REAL t539;
+  IGM_REAL t54;
+  IGM_REAL t540;
+  IGM_REAL t541;
+  IGM_REAL t542;
+  IGM_REAL t543;
+  IGM_REAL t544;
+  IGM_REAL t545;
+  IGM_REAL t546;
+  IGM_REAL t547;
+  IGM_REAL t548;
+  IGM_REAL t549;
+  IGM_REAL t55;
+  IGM_REAL t550;
+  IGM_REAL t551;
+  IGM_REAL t56;
+  IGM_REAL t57;
+  IGM_REAL t58;
+  IGM_REAL t59;
+  IGM_REAL t6;
+  IGM_REAL t60;
+  IGM_REAL t601;
+  IGM_REAL t61;
+  IGM_REAL t615;
+  IGM_REAL t62;
+  IGM_REAL t63;
+  IGM_REAL t630;
+  IGM_REAL t64;
+  IGM_REAL t644;
+  IGM_REAL t65;
+  IGM_REAL t66;
+  IGM_REAL t660;
+  IGM_REAL t67;
+  IGM_REAL t674;
+  IGM_REAL t68;
+  IGM_REAL t689;
+  IGM_REAL t69;
+  IGM_REAL t7;
+  IGM_REAL t70;
+  IGM_REAL t703;
+  IGM_REAL t71;
+  IGM_REAL t719;
+  IGM_REAL t72;
+  IGM_REAL t73;
+  IGM_REAL t733;
+  IGM_REAL t748;
+  IGM_REAL t762;
+  IGM_REAL t77;
+  IGM_REAL t778;
+  IGM_REAL t78;
+  IGM_REAL t79;
+  IGM_REAL t792;
+  IGM_REAL t8;
+  IGM_REAL t80;
+  IGM_REAL t807;
+  IGM_REAL t81;
+  IGM_REAL t82;
+  IGM_REAL t821;
+  IGM_REAL t837;
+  IGM_REAL t84;
+  IGM_REAL t851;
+  IGM_REAL t86;
+  IGM_REAL t866;
+  IGM_REAL t87;
+  IGM_REAL t880;
+  IGM_REAL t89;
+  IGM_REAL t896;
+  IGM_REAL t9;
+  IGM_REAL t90;
+  IGM_REAL t91;
+  IGM_REAL t910;
+  IGM_REAL t925;
+  IGM_REAL t939;
+  IGM_REAL t95;
+  IGM_REAL t96;
+  IGM_REAL t97;
+  IGM_REAL t98;
+  IGM_REAL t99;
+  {
+    if ((frames & 0x7fffffffu) != 0)
+    {
+        t2 = LL[8];
+        t6 = LL[4];
+        t13 = LL[0];
+        t34 = LL[9];
+        t36 = LL[5];
+        t40 = LL[1];
+        t54 = LL[10];
+        t56 = LL[6];
+        t60 = LL[2];
+        t131 = LL[12];
+        t137 = LL[13];
+        t143 = LL[14];
+    }
+    if ((frames & 0x7dffffdfu) != 0)
+    {
+        t4 = IGM_COS_Q(5);
+        t5 = t2*t4;
+        t7 = IGM_SIN_Q(5);
+        t8 = t6*t7;
+        t9 = t5+t8;
+        t35 = t34*t4;
+        t37 = t36*t7;
+        t38 = t35+t37;
+        t55 = t54*t4;
+        t57 = t56*t7;
+        t58 = t55+t57;
+        t79 = t2*t7;
+        t80 = t6*t4;
+        t81 = -t79+t80;
+        t96 = t34*t7;
+        t97 = t36*t4;
+        t98 = -t96+t97;
+        t110 = t54*t7;
+        t111 = t56*t4;
+        t112 = -t110+t111;
+    }
+    if ((frames & 0x7dffffcfu) != 0)
+    {
+        t11 = IGM_COS_Q(4);
+        t12 = t9*t11;
+        t14 = IGM_SIN_Q(4);
+        t15 = t13*t14;
+        t16 = t12-t15;
+        t20 = t9*t14;
+        t21 = t13*t11;
+        t22 = t20+t21;
+        t39 = t38*t11;
+        t41 = t40*t14;
+        t42 = t39-t41;
+        t44 = t38*t14;
+        t45 = t40*t11;
+        t46 = t44+t45;
+        t59 = t58*t11;
+        t61 = t60*t14;
+        t62 = t59-t61;
+        t64 = t58*t14;
+        t65 = t60*t11;
+        t66 = t64+t65;
+    }
+    if ((frames & 0x7dffffc7u) != 0)
+    {
+        t18 = IGM_COS_Q(3);
+        t19 = t16*t18;
+        t23 = IGM_SIN_Q(3);
+        t24 = t22*t23;
+        t25 = t19-t24;
+        t29 = t16*t23;
+        t30 = t22*t18;
+        t31 = t29+t30;
+        t43 = t42*t18;
+        t47 = t46*t23;
+        t48 = t43-t47;
+        t50 = t42*t23;
+        t51 = t46*t18;
+        t52 = t50+t51;
+        t63 = t62*t18;
+        t67 = t66*t23;
+        t68 = t63-t67;
+        t70 = t62*t23;
+        t71 = t66*t18;
+        t72 = t70+t71;
+    }
+    if ((frames & 0x7dffffc3u) != 0)
+    {
+        t27 = IGM_SIN_Q(2);
+        t28 = t25*t27;
+        t32 = IGM_COS_Q(2);
+        t33 = t31*t32;
+        A[0] = t28+t33;
+        t49 = t48*t27;
+        t53 = t52*t32;
+        A[1] = t49+t53;
+        t69 = t68*t27;
+        t73 = t72*t32;
+        A[2] = t69+t73;
+        t77 = IGM_CONST(sqrt(2.0));
+        t78 = (t25*t32-t31*t27)*t77;
+        t82 = t81*t77;
+        t84 = t78/2.0-t82/2.0;
+        t89 = -t78/2.0-t82/2.0;
+        t95 = (t48*t32-t52*t27)*t77;
+        t99 = t98*t77;
+        t101 = t95/2.0-t99/2.0;
+        t104 = -t95/2.0-t99/2.0;
+        t109 = (t68*t32-t72*t27)*t77;
+        t113 = t112*t77;
+        t115 = t109/2.0-t113/2.0;
+        t118 = -t109/2.0-t113/2.0;
+    }
+    if ((frames & 0x00000001u) != 0)
+    {
+        A[3] = IGM_CONST(0.0);
+        A[7] = IGM_CONST(0.0);
+        A[11] = IGM_CONST(0.0);
+        A[15] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x7dffffc1u) != 0)
+    {
+        t86 = IGM_SIN_Q(1);
+        t87 = t84*t86;
+        t90 = IGM_COS_Q(1);
+        t91 = t89*t90;
+        A[4] = t87+t91;
+        t102 = t101*t86;
+        t105 = t104*t90;
+        A[5] = t102+t105;
+        t116 = t115*t86;
+        t119 = t118*t90;
+        A[6] = t116+t119;
+        t120 = t84*t90;
+        t121 = t89*t86;
+        A[8] = -t120+t121;
+        t122 = t101*t90;
+        t123 = t104*t86;
+        A[9] = -t122+t123;
+        t124 = t115*t90;
+        t125 = t118*t86;
+        A[10] = -t124+t125;
+    }
+    if ((frames & 0x3dffffc7u) != 0)
+    {
+        t126 = 0.1*t19;
+        t127 = 0.1*t24;
+        t132 = 0.1*t43;
+        t133 = 0.1*t47;
+        t138 = 0.1*t63;
+        t139 = 0.1*t67;
+    }
+    if ((frames & 0x3dffffcfu) != 0)
+    {
+        t128 = 0.10274*t12;
+        t129 = 0.10274*t15;
+        t134 = 0.10274*t39;
+        t135 = 0.10274*t41;
+        t140 = 0.10274*t59;
+        t141 = 0.10274*t61;
+    }
+    if ((frames & 0x3dffffffu) != 0)
+    {
+        t130 = 0.4511E-1*t2;
+        t136 = 0.4511E-1*t34;
+        t142 = 0.4511E-1*t54;
+    }
+    if ((frames & 0x00000007u) != 0)
+    {
+        A[12] = t126-t127+t128-t129+t130+t131;
+        A[13] = t132-t133+t134-t135+t136+t137;
+        A[14] = t138-t139+t140-t141+t142+t143;
+    }
+    if ((frames & 0x00000002u) != 0)
+    {
+        A[16] = t84;
+        A[17] = t101;
+        A[18] = t115;
+        A[19] = IGM_CONST(0.0);
+        A[20] = t89;
+        A[21] = t104;
+        A[22] = t118;
+        A[23] = IGM_CONST(0.0);
+        A[27] = IGM_CONST(0.0);
+        A[31] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x7dffffc2u) != 0)
+    {
+        A[24] = A[0];
+        A[25] = A[1];
+        A[26] = A[2];
+    }
+    if ((frames & 0x00000006u) != 0)
+    {
+        A[28] = A[12];
+        A[29] = A[13];
+        A[30] = A[14];
+    }
+    if ((frames & 0x00000004u) != 0)
+    {
+        A[32] = t25;
+        A[33] = t48;
+        A[34] = t68;
+        A[35] = IGM_CONST(0.0);
+        A[36] = t31;
+        A[37] = t52;
+        A[38] = t72;
+        A[39] = IGM_CONST(0.0);
+        A[43] = IGM_CONST(0.0);
+        A[44] = A[28];
+        A[45] = A[29];
+        A[46] = A[30];
+        A[47] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x0000001cu) != 0)
+    {
+        A[40] = t81;
+        A[41] = t98;
+        A[42] = t112;
+    }
+    if ((frames & 0x00000008u) != 0)
+    {
+        A[48] = t16;
+        A[49] = t42;
+        A[50] = t62;
+        A[51] = IGM_CONST(0.0);
+        A[52] = t22;
+        A[53] = t46;
+        A[54] = t66;
+        A[55] = IGM_CONST(0.0);
+        A[59] = IGM_CONST(0.0);
+        A[60] = t128-t129+t130+t131;
+        A[61] = t134-t135+t136+t137;
+        A[62] = t140-t141+t142+t143;
+        A[63] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x00000018u) != 0)
+    {
+        A[56] = A[40];
+        A[57] = A[41];
+        A[58] = A[42];
+    }
+    if ((frames & 0x00000010u) != 0)
+    {
+        A[64] = t9;
+        A[65] = t38;
+        A[66] = t58;
+        A[67] = IGM_CONST(0.0);
+        A[71] = IGM_CONST(0.0);
+        A[72] = A[56];
+        A[73] = A[57];
+        A[74] = A[58];
+        A[75] = IGM_CONST(0.0);
+        A[79] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x42000030u) != 0)
+    {
+        A[68] = t13;
+        A[69] = t40;
+        A[70] = t60;
+    }
+    if ((frames & 0x00000030u) != 0)
+    {
+        A[76] = t130+t131;
+        A[77] = t136+t137;
+        A[78] = t142+t143;
+    }
+    if ((frames & 0x42000020u) != 0)
+    {
+        A[80] = t2;
+        A[81] = t34;
+        A[82] = t54;
+        A[88] = A[68];
+        A[89] = A[69];
+        A[90] = A[70];
+    }
+    if ((frames & 0x00000020u) != 0)
+    {
+        A[83] = IGM_CONST(0.0);
+        A[84] = -t6;
+        A[85] = -t36;
+        A[86] = -t56;
+        A[87] = IGM_CONST(0.0);
+        A[91] = IGM_CONST(0.0);
+        A[92] = A[76];
+        A[93] = A[77];
+        A[94] = A[78];
+        A[95] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x7dffffc0u) != 0)
+    {
+        t145 = IGM_COS_Q(0);
+        t146 = A[24]*t145;
+        t147 = IGM_SIN_Q(0);
+        t148 = A[4]*t147;
+        t149 = t146-t148;
+        t156 = (A[24]*t147+A[4]*t145)*t77;
+        t157 = A[8]*t77;
+        t159 = -t156/2.0+t157/2.0;
+        t162 = -t156/2.0-t157/2.0;
+        t168 = A[25]*t145;
+        t169 = A[5]*t147;
+        t170 = t168-t169;
+        t175 = (A[25]*t147+A[5]*t145)*t77;
+        t176 = A[9]*t77;
+        t178 = -t175/2.0+t176/2.0;
+        t181 = -t175/2.0-t176/2.0;
+        t186 = A[26]*t145;
+        t187 = A[6]*t147;
+        t188 = t186-t187;
+        t193 = (A[26]*t147+A[6]*t145)*t77;
+        t194 = A[10]*t77;
+        t196 = -t193/2.0+t194/2.0;
+        t199 = -t193/2.0-t194/2.0;
+    }
+    if ((frames & 0x44000fc0u) != 0)
+    {
+        t151 = IGM_COS_Q(6);
+        t152 = t149*t151;
+        t160 = t159*t77;
+        t163 = t162*t77;
+        t165 = t160/2.0-t163/2.0;
+        t166 = IGM_SIN_Q(6);
+        t167 = t165*t166;
+        A[96] = t152+t167;
+        t171 = t170*t151;
+        t179 = t178*t77;
+        t182 = t181*t77;
+        t184 = t179/2.0-t182/2.0;
+        t185 = t184*t166;
+        A[97] = t171+t185;
+        t189 = t188*t151;
+        t197 = t196*t77;
+        t200 = t199*t77;
+        t202 = t197/2.0-t200/2.0;
+        t203 = t202*t166;
+        A[98] = t189+t203;
+        t204 = t149*t166;
+        t205 = t165*t151;
+        A[100] = -t204+t205;
+        t206 = t170*t166;
+        t207 = t184*t151;
+        A[101] = -t206+t207;
+        t208 = t188*t166;
+        t209 = t202*t151;
+        A[102] = -t208+t209;
+        A[104] = t160/2.0+t163/2.0;
+        A[105] = t179/2.0+t182/2.0;
+        A[106] = t197/2.0+t200/2.0;
+    }
+    if ((frames & 0x00000040u) != 0)
+    {
+        A[99] = IGM_CONST(0.0);
+        A[103] = IGM_CONST(0.0);
+        A[107] = IGM_CONST(0.0);
+        A[111] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x04000fc0u) != 0)
+    {
+        t213 = 0.5E-1*t156;
+        t214 = 0.5E-1*t157;
+        t215 = 0.5E-1*t175;
+        t216 = 0.5E-1*t176;
+        t217 = 0.5E-1*t193;
+        t218 = 0.5E-1*t194;
+    }
+    if ((frames & 0x000001c0u) != 0)
+    {
+        A[108] = t213-t214+t126-t127+t128-t129+t130+t131;
+        A[109] = t215-t216+t132-t133+t134-t135+t136+t137;
+        A[110] = t217-t218+t138-t139+t140-t141+t142+t143;
+    }
+    if ((frames & 0x44000f80u) != 0)
+    {
+        t219 = -A[104];
+        t221 = IGM_COS_Q(7);
+        t222 = t219*t221;
+        t223 = IGM_SIN_Q(7);
+        t224 = A[100]*t223;
+        A[112] = t222+t224;
+        t225 = -A[105];
+        t226 = t225*t221;
+        t227 = A[101]*t223;
+        A[113] = t226+t227;
+        t228 = -A[106];
+        t229 = t228*t221;
+        t230 = A[102]*t223;
+        A[114] = t229+t230;
+        t231 = t219*t223;
+        t232 = A[100]*t221;
+        A[116] = -t231+t232;
+        t233 = t225*t223;
+        t234 = A[101]*t221;
+        A[117] = -t233+t234;
+        t235 = t228*t223;
+        t236 = A[102]*t221;
+        A[118] = -t235+t236;
+        A[120] = A[96];
+        A[121] = A[97];
+        A[122] = A[98];
+    }
+    if ((frames & 0x00000080u) != 0)
+    {
+        A[115] = IGM_CONST(0.0);
+        A[119] = IGM_CONST(0.0);
+        A[123] = IGM_CONST(0.0);
+        A[127] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x00000180u) != 0)
+    {
+        A[124] = A[108];
+        A[125] = A[109];
+        A[126] = A[110];
+    }
+    if ((frames & 0x44000f00u) != 0)
+    {
+        t237 = A[112]*t77;
+        t238 = A[116]*t77;
+        t240 = t237/2.0+t238/2.0;
+        t242 = IGM_COS_Q(8);
+        t243 = t240*t242;
+        t244 = -A[120];
+        t245 = IGM_SIN_Q(8);
+        t246 = t244*t245;
+        A[128] = t243+t246;
+        t247 = A[113]*t77;
+        t248 = A[117]*t77;
+        t250 = t247/2.0+t248/2.0;
+        t251 = t250*t242;
+        t252 = -A[121];
+        t253 = t252*t245;
+        A[129] = t251+t253;
+        t254 = A[114]*t77;
+        t255 = A[118]*t77;
+        t257 = t254/2.0+t255/2.0;
+        t258 = t257*t242;
+        t259 = -A[122];
+        t260 = t259*t245;
+        A[130] = t258+t260;
+        t261 = t240*t245;
+        t262 = t244*t242;
+        A[132] = -t261+t262;
+        t263 = t250*t245;
+        t264 = t252*t242;
+        A[133] = -t263+t264;
+        t265 = t257*t245;
+        t266 = t259*t242;
+        A[134] = -t265+t266;
+        A[136] = -t237/2.0+t238/2.0;
+        A[137] = -t247/2.0+t248/2.0;
+        A[138] = -t254/2.0+t255/2.0;
+    }
+    if ((frames & 0x00000100u) != 0)
+    {
+        A[131] = IGM_CONST(0.0);
+        A[135] = IGM_CONST(0.0);
+        A[139] = IGM_CONST(0.0);
+        A[140] = A[124];
+        A[141] = A[125];
+        A[142] = A[126];
+        A[143] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x44000e00u) != 0)
+    {
+        t271 = IGM_COS_Q(9);
+        t272 = A[128]*t271;
+        t273 = IGM_SIN_Q(9);
+        t274 = A[132]*t273;
+        A[144] = t272+t274;
+        t275 = A[129]*t271;
+        t276 = A[133]*t273;
+        A[145] = t275+t276;
+        t277 = A[130]*t271;
+        t278 = A[134]*t273;
+        A[146] = t277+t278;
+        t279 = A[128]*t273;
+        t280 = A[132]*t271;
+        A[148] = -t279+t280;
+        t281 = A[129]*t273;
+        t282 = A[133]*t271;
+        A[149] = -t281+t282;
+        t283 = A[130]*t273;
+        t284 = A[134]*t271;
+        A[150] = -t283+t284;
+        A[152] = A[136];
+        A[153] = A[137];
+        A[154] = A[138];
+    }
+    if ((frames & 0x00000200u) != 0)
+    {
+        A[147] = IGM_CONST(0.0);
+        A[151] = IGM_CONST(0.0);
+        A[155] = IGM_CONST(0.0);
+        A[159] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x04000e00u) != 0)
+    {
+        t285 = 0.1*t243;
+        t286 = 0.1*t246;
+        t287 = 0.1*t251;
+        t288 = 0.1*t253;
+        t289 = 0.1*t258;
+        t290 = 0.1*t260;
+    }
+    if ((frames & 0x00000200u) != 0)
+    {
+        A[156] = t285+t286+t213-t214+t126-t127+t128-t129+t130+t131;
+        A[157] = t287+t288+t215-t216+t132-t133+t134-t135+t136+t137;
+        A[158] = t289+t290+t217-t218+t138-t139+t140-t141+t142+t143;
+    }
+    if ((frames & 0x44000c00u) != 0)
+    {
+        t292 = IGM_COS_Q(10);
+        t293 = A[144]*t292;
+        t294 = IGM_SIN_Q(10);
+        t295 = A[148]*t294;
+        A[160] = t293+t295;
+        t296 = A[145]*t292;
+        t297 = A[149]*t294;
+        A[161] = t296+t297;
+        t298 = A[146]*t292;
+        t299 = A[150]*t294;
+        A[162] = t298+t299;
+        t300 = A[144]*t294;
+        t301 = A[148]*t292;
+        t302 = A[145]*t294;
+        t303 = A[149]*t292;
+        t304 = A[146]*t294;
+        t305 = A[150]*t292;
+        A[168] = A[152];
+        A[169] = A[153];
+        A[170] = A[154];
+    }
+    if ((frames & 0x00000400u) != 0)
+    {
+        A[163] = IGM_CONST(0.0);
+        A[167] = IGM_CONST(0.0);
+        A[171] = IGM_CONST(0.0);
+        A[175] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x04000c00u) != 0)
+    {
+        A[164] = -t300+t301;
+        A[165] = -t302+t303;
+        A[166] = -t304+t305;
+        t306 = 0.10274*t272;
+        t307 = 0.10274*t274;
+        t308 = 0.10274*t275;
+        t309 = 0.10274*t276;
+        t310 = 0.10274*t277;
+        t311 = 0.10274*t278;
+    }
+    if ((frames & 0x00000c00u) != 0)
+    {
+        A[172] = t306+t307+t285+t286+t213-t214+t126-t127+t128-t129+t130+t131;
+        A[173] = t308+t309+t287+t288+t215-t216+t132-t133+t134-t135+t136+t137;
+        A[174] = t310+t311+t289+t290+t217-t218+t138-t139+t140-t141+t142+t143;
+    }
+    if ((frames & 0x44000800u) != 0)
+    {
+        t313 = IGM_COS_Q(11);
+        t314 = A[160]*t313;
+        t315 = IGM_SIN_Q(11);
+        t316 = A[168]*t315;
+        t317 = A[161]*t313;
+        t318 = A[169]*t315;
+        t319 = A[162]*t313;
+        t320 = A[170]*t315;
+        t321 = A[160]*t315;
+        t322 = A[168]*t313;
+        t323 = A[161]*t315;
+        t324 = A[169]*t313;
+        t325 = A[162]*t315;
+        t326 = A[170]*t313;
+    }
+    if ((frames & 0x04000800u) != 0)
+    {
+        A[176] = t314+t316;
+        A[177] = t317+t318;
+        A[178] = t319+t320;
+        A[180] = -t321+t322;
+        A[181] = -t323+t324;
+        A[182] = -t325+t326;
+        A[184] = -A[164];
+        A[185] = -A[165];
+        A[186] = -A[166];
+    }
+    if ((frames & 0x00000800u) != 0)
+    {
+        A[179] = IGM_CONST(0.0);
+        A[183] = IGM_CONST(0.0);
+        A[187] = IGM_CONST(0.0);
+        A[188] = A[172];
+        A[189] = A[173];
+        A[190] = A[174];
+        A[191] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x4801f000u) != 0)
+    {
+        t328 = IGM_COS_Q(12);
+        t329 = t149*t328;
+        t331 = IGM_SIN_Q(12);
+        t333 = t170*t328;
+        t336 = t188*t328;
+        t339 = t149*t331;
+        t341 = t170*t331;
+        t343 = t188*t331;
+    }
+    if ((frames & 0x78bff000u) != 0)
+    {
+        t330 = -t162;
+        t334 = -t181;
+        t337 = -t199;
+    }
+    if ((frames & 0x4801f000u) != 0)
+    {
+        t332 = t330*t331;
+        A[192] = t329+t332;
+        t335 = t334*t331;
+        A[193] = t333+t335;
+        t338 = t337*t331;
+        A[194] = t336+t338;
+        t340 = t330*t328;
+        A[196] = -t339+t340;
+        t342 = t334*t328;
+        A[197] = -t341+t342;
+        t344 = t337*t328;
+        A[198] = -t343+t344;
+    }
+    if ((frames & 0x00001000u) != 0)
+    {
+        A[195] = IGM_CONST(0.0);
+        A[199] = IGM_CONST(0.0);
+        A[203] = IGM_CONST(0.0);
+        A[207] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x79fff000u) != 0)
+    {
+        A[200] = t159;
+        A[201] = t178;
+        A[202] = t196;
+    }
+    if ((frames & 0x0801f000u) != 0)
+    {
+        t345 = 0.1165*t156;
+        t346 = 0.685E-1*t157;
+        t347 = 0.1165*t175;
+        t348 = 0.685E-1*t176;
+        t349 = 0.1165*t193;
+        t350 = 0.685E-1*t194;
+    }
+    if ((frames & 0x00003000u) != 0)
+    {
+        A[204] = -t345-t346+t126-t127+t128-t129+t130+t131;
+        A[205] = -t347-t348+t132-t133+t134-t135+t136+t137;
+        A[206] = -t349-t350+t138-t139+t140-t141+t142+t143;
+    }
+    if ((frames & 0x4801e000u) != 0)
+    {
+        t352 = IGM_COS_Q(13);
+        t353 = A[192]*t352;
+        t354 = IGM_SIN_Q(13);
+        t355 = A[200]*t354;
+        A[208] = t353+t355;
+        t356 = A[193]*t352;
+        t357 = A[201]*t354;
+        A[209] = t356+t357;
+        t358 = A[194]*t352;
+        t359 = A[202]*t354;
+        A[210] = t358+t359;
+        t360 = A[192]*t354;
+        t361 = A[200]*t352;
+        A[212] = -t360+t361;
+        t362 = A[193]*t354;
+        t363 = A[201]*t352;
+        A[213] = -t362+t363;
+        t364 = A[194]*t354;
+        t365 = A[202]*t352;
+        A[214] = -t364+t365;
+    }
+    if ((frames & 0x00002000u) != 0)
+    {
+        A[211] = IGM_CONST(0.0);
+        A[215] = IGM_CONST(0.0);
+        A[216] = -A[196];
+        A[217] = -A[197];
+        A[218] = -A[198];
+        A[219] = IGM_CONST(0.0);
+        A[220] = A[204];
+        A[221] = A[205];
+        A[222] = A[206];
+        A[223] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x4801c000u) != 0)
+    {
+        t367 = IGM_COS_Q(14);
+        t368 = A[196]*t367;
+        t369 = IGM_SIN_Q(14);
+        t370 = A[212]*t369;
+        A[224] = t368+t370;
+        t371 = A[197]*t367;
+        t372 = A[213]*t369;
+        A[225] = t371+t372;
+        t373 = A[198]*t367;
+        t374 = A[214]*t369;
+        A[226] = t373+t374;
+        t375 = A[196]*t369;
+        t376 = A[212]*t367;
+        A[228] = -t375+t376;
+        t377 = A[197]*t369;
+        t378 = A[213]*t367;
+        A[229] = -t377+t378;
+        t379 = A[198]*t369;
+        t380 = A[214]*t367;
+        A[230] = -t379+t380;
+        A[232] = A[208];
+        A[233] = A[209];
+        A[234] = A[210];
+    }
+    if ((frames & 0x00004000u) != 0)
+    {
+        A[227] = IGM_CONST(0.0);
+        A[231] = IGM_CONST(0.0);
+        A[235] = IGM_CONST(0.0);
+        A[239] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x0801c000u) != 0)
+    {
+        t381 = 0.9E-1*t353;
+        t382 = 0.9E-1*t355;
+        t383 = 0.9E-1*t356;
+        t384 = 0.9E-1*t357;
+        t385 = 0.9E-1*t358;
+        t386 = 0.9E-1*t359;
+    }
+    if ((frames & 0x0000c000u) != 0)
+    {
+        A[236] = t381+t382-t345-t346+t126-t127+t128-t129+t130+t131;
+        A[237] = t383+t384-t347-t348+t132-t133+t134-t135+t136+t137;
+        A[238] = t385+t386-t349-t350+t138-t139+t140-t141+t142+t143;
+    }
+    if ((frames & 0x48018000u) != 0)
+    {
+        t388 = IGM_COS_Q(15);
+        t389 = A[232]*t388;
+        t390 = IGM_SIN_Q(15);
+        t391 = A[228]*t390;
+        t392 = A[233]*t388;
+        t393 = A[229]*t390;
+        t394 = A[234]*t388;
+        t395 = A[230]*t390;
+        t396 = A[232]*t390;
+        t397 = A[228]*t388;
+        A[244] = -t396+t397;
+        t398 = A[233]*t390;
+        t399 = A[229]*t388;
+        A[245] = -t398+t399;
+        t400 = A[234]*t390;
+        t401 = A[230]*t388;
+        A[246] = -t400+t401;
+    }
+    if ((frames & 0x08018000u) != 0)
+    {
+        A[240] = t389+t391;
+        A[241] = t392+t393;
+        A[242] = t394+t395;
+    }
+    if ((frames & 0x00008000u) != 0)
+    {
+        A[243] = IGM_CONST(0.0);
+        A[247] = IGM_CONST(0.0);
+        A[248] = -A[224];
+        A[249] = -A[225];
+        A[250] = -A[226];
+        A[251] = IGM_CONST(0.0);
+        A[252] = A[236];
+        A[253] = A[237];
+        A[254] = A[238];
+        A[255] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x48010000u) != 0)
+    {
+        t403 = IGM_COS_Q(16);
+        t404 = A[224]*t403;
+        t405 = IGM_SIN_Q(16);
+        t406 = A[244]*t405;
+        t407 = A[225]*t403;
+        t408 = A[245]*t405;
+        t409 = A[226]*t403;
+        t410 = A[246]*t405;
+        t411 = A[224]*t405;
+        t412 = A[244]*t403;
+        t413 = A[225]*t405;
+        t414 = A[245]*t403;
+        t415 = A[226]*t405;
+        t416 = A[246]*t403;
+    }
+    if ((frames & 0x08010000u) != 0)
+    {
+        A[256] = t404+t406;
+        A[257] = t407+t408;
+        A[258] = t409+t410;
+        A[260] = -t411+t412;
+        A[261] = -t413+t414;
+        A[262] = -t415+t416;
+        A[264] = A[240];
+        A[265] = A[241];
+        A[266] = A[242];
+    }
+    if ((frames & 0x00010000u) != 0)
+    {
+        A[259] = IGM_CONST(0.0);
+        A[263] = IGM_CONST(0.0);
+        A[267] = IGM_CONST(0.0);
+        A[268] = 0.5055E-1*t389+0.5055E-1*t391+t381+t382-t345-t346+t126-t127+t128-
+t129+t130+t131;
+        A[269] = 0.5055E-1*t392+0.5055E-1*t393+t383+t384-t347-t348+t132-t133+t134-
+t135+t136+t137;
+        A[270] = 0.5055E-1*t394+0.5055E-1*t395+t385+t386-t349-t350+t138-t139+t140-
+t141+t142+t143;
+        A[271] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x503e0000u) != 0)
+    {
+        t424 = IGM_COS_Q(17);
+        t425 = t149*t424;
+        t426 = IGM_SIN_Q(17);
+        t427 = t330*t426;
+        A[272] = t425+t427;
+        t428 = t170*t424;
+        t429 = t334*t426;
+        A[273] = t428+t429;
+        t430 = t188*t424;
+        t431 = t337*t426;
+        A[274] = t430+t431;
+        t432 = t149*t426;
+        t433 = t330*t424;
+        A[276] = -t432+t433;
+        t434 = t170*t426;
+        t435 = t334*t424;
+        A[277] = -t434+t435;
+        t436 = t188*t426;
+        t437 = t337*t424;
+        A[278] = -t436+t437;
+    }
+    if ((frames & 0x00020000u) != 0)
+    {
+        A[275] = IGM_CONST(0.0);
+        A[279] = IGM_CONST(0.0);
+        A[283] = IGM_CONST(0.0);
+        A[287] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x71fe0000u) != 0)
+    {
+        A[280] = A[200];
+        A[281] = A[201];
+        A[282] = A[202];
+    }
+    if ((frames & 0x103e0000u) != 0)
+    {
+        t438 = 0.185E-1*t156;
+        t439 = 0.1665*t157;
+        t440 = 0.185E-1*t175;
+        t441 = 0.1665*t176;
+        t442 = 0.185E-1*t193;
+        t443 = 0.1665*t194;
+    }
+    if ((frames & 0x00060000u) != 0)
+    {
+        A[284] = -t438-t439+t126-t127+t128-t129+t130+t131;
+        A[285] = -t440-t441+t132-t133+t134-t135+t136+t137;
+        A[286] = -t442-t443+t138-t139+t140-t141+t142+t143;
+    }
+    if ((frames & 0x503c0000u) != 0)
+    {
+        t445 = IGM_COS_Q(18);
+        t446 = A[272]*t445;
+        t447 = IGM_SIN_Q(18);
+        t448 = A[280]*t447;
+        A[288] = t446+t448;
+        t449 = A[273]*t445;
+        t450 = A[281]*t447;
+        A[289] = t449+t450;
+        t451 = A[274]*t445;
+        t452 = A[282]*t447;
+        A[290] = t451+t452;
+        t453 = A[272]*t447;
+        t454 = A[280]*t445;
+        A[292] = -t453+t454;
+        t455 = A[273]*t447;
+        t456 = A[281]*t445;
+        A[293] = -t455+t456;
+        t457 = A[274]*t447;
+        t458 = A[282]*t445;
+        A[294] = -t457+t458;
+    }
+    if ((frames & 0x00040000u) != 0)
+    {
+        A[291] = IGM_CONST(0.0);
+        A[295] = IGM_CONST(0.0);
+        A[296] = -A[276];
+        A[297] = -A[277];
+        A[298] = -A[278];
+        A[299] = IGM_CONST(0.0);
+        A[300] = A[284];
+        A[301] = A[285];
+        A[302] = A[286];
+        A[303] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x50380000u) != 0)
+    {
+        t460 = IGM_COS_Q(19);
+        t461 = A[276]*t460;
+        t462 = IGM_SIN_Q(19);
+        t463 = A[292]*t462;
+        A[304] = t461+t463;
+        t464 = A[277]*t460;
+        t465 = A[293]*t462;
+        A[305] = t464+t465;
+        t466 = A[278]*t460;
+        t467 = A[294]*t462;
+        A[306] = t466+t467;
+        t468 = A[276]*t462;
+        t469 = A[292]*t460;
+        A[308] = -t468+t469;
+        t470 = A[277]*t462;
+        t471 = A[293]*t460;
+        A[309] = -t470+t471;
+        t472 = A[278]*t462;
+        t473 = A[294]*t460;
+        A[310] = -t472+t473;
+        A[312] = A[288];
+        A[313] = A[289];
+        A[314] = A[290];
+    }
+    if ((frames & 0x00080000u) != 0)
+    {
+        A[307] = IGM_CONST(0.0);
+        A[311] = IGM_CONST(0.0);
+        A[315] = IGM_CONST(0.0);
+        A[319] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x10380000u) != 0)
+    {
+        t474 = 0.9E-1*t446;
+        t475 = 0.9E-1*t448;
+        t476 = 0.9E-1*t449;
+        t477 = 0.9E-1*t450;
+        t478 = 0.9E-1*t451;
+        t479 = 0.9E-1*t452;
+    }
+    if ((frames & 0x00180000u) != 0)
+    {
+        A[316] = t474+t475-t438-t439+t126-t127+t128-t129+t130+t131;
+        A[317] = t476+t477-t440-t441+t132-t133+t134-t135+t136+t137;
+        A[318] = t478+t479-t442-t443+t138-t139+t140-t141+t142+t143;
+    }
+    if ((frames & 0x50300000u) != 0)
+    {
+        t481 = IGM_COS_Q(20);
+        t482 = A[312]*t481;
+        t483 = IGM_SIN_Q(20);
+        t484 = A[308]*t483;
+        t485 = A[313]*t481;
+        t486 = A[309]*t483;
+        t487 = A[314]*t481;
+        t488 = A[310]*t483;
+        t489 = A[312]*t483;
+        t490 = A[308]*t481;
+        A[324] = -t489+t490;
+        t491 = A[313]*t483;
+        t492 = A[309]*t481;
+        A[325] = -t491+t492;
+        t493 = A[314]*t483;
+        t494 = A[310]*t481;
+        A[326] = -t493+t494;
+    }
+    if ((frames & 0x10300000u) != 0)
+    {
+        A[320] = t482+t484;
+        A[321] = t485+t486;
+        A[322] = t487+t488;
+    }
+    if ((frames & 0x00100000u) != 0)
+    {
+        A[323] = IGM_CONST(0.0);
+        A[327] = IGM_CONST(0.0);
+        A[328] = -A[304];
+        A[329] = -A[305];
+        A[330] = -A[306];
+        A[331] = IGM_CONST(0.0);
+        A[332] = A[316];
+        A[333] = A[317];
+        A[334] = A[318];
+        A[335] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x50200000u) != 0)
+    {
+        t496 = IGM_COS_Q(21);
+        t497 = A[304]*t496;
+        t498 = IGM_SIN_Q(21);
+        t499 = A[324]*t498;
+        t500 = A[305]*t496;
+        t501 = A[325]*t498;
+        t502 = A[306]*t496;
+        t503 = A[326]*t498;
+        t504 = A[304]*t498;
+        t505 = A[324]*t496;
+        t506 = A[305]*t498;
+        t507 = A[325]*t496;
+        t508 = A[306]*t498;
+        t509 = A[326]*t496;
+    }
+    if ((frames & 0x10200000u) != 0)
+    {
+        A[336] = t497+t499;
+        A[337] = t500+t501;
+        A[338] = t502+t503;
+        A[340] = -t504+t505;
+        A[341] = -t506+t507;
+        A[342] = -t508+t509;
+        A[344] = A[320];
+        A[345] = A[321];
+        A[346] = A[322];
+    }
+    if ((frames & 0x00200000u) != 0)
+    {
+        A[339] = IGM_CONST(0.0);
+        A[343] = IGM_CONST(0.0);
+        A[347] = IGM_CONST(0.0);
+        A[348] = 0.5055E-1*t482+0.5055E-1*t484+t474+t475-t438-t439+t126-t127+t128-
+t129+t130+t131;
+        A[349] = 0.5055E-1*t485+0.5055E-1*t486+t476+t477-t440-t441+t132-t133+t134-
+t135+t136+t137;
+        A[350] = 0.5055E-1*t487+0.5055E-1*t488+t478+t479-t442-t443+t138-t139+t140-
+t141+t142+t143;
+        A[351] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x60c00000u) != 0)
+    {
+        t517 = IGM_COS_Q(22);
+        t518 = t149*t517;
+        t519 = IGM_SIN_Q(22);
+        t520 = A[280]*t519;
+        A[352] = t518+t520;
+        t521 = t170*t517;
+        t522 = A[281]*t519;
+        A[353] = t521+t522;
+        t523 = t188*t517;
+        t524 = A[282]*t519;
+        A[354] = t523+t524;
+        t525 = t149*t519;
+        t526 = A[280]*t517;
+        t527 = t170*t519;
+        t528 = A[281]*t517;
+        t529 = t188*t519;
+        t530 = A[282]*t517;
+    }
+    if ((frames & 0x00400000u) != 0)
+    {
+        A[355] = IGM_CONST(0.0);
+        A[359] = IGM_CONST(0.0);
+        A[363] = IGM_CONST(0.0);
+        A[367] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x20c00000u) != 0)
+    {
+        A[356] = -t525+t526;
+        A[357] = -t527+t528;
+        A[358] = -t529+t530;
+        A[364] = -0.8075E-1*t156-0.13075*t157+t126-t127+t128-t129+t130+t131;
+        A[365] = -0.8075E-1*t175-0.13075*t176+t132-t133+t134-t135+t136+t137;
+        A[366] = -0.8075E-1*t193-0.13075*t194+t138-t139+t140-t141+t142+t143;
+    }
+    if ((frames & 0x01400000u) != 0)
+    {
+        A[360] = t162;
+        A[361] = t181;
+        A[362] = t199;
+    }
+    if ((frames & 0x60800000u) != 0)
+    {
+        t538 = IGM_COS_Q(23);
+        t539 = A[352]*t538;
+        t540 = IGM_SIN_Q(23);
+        t541 = t330*t540;
+        t542 = A[353]*t538;
+        t543 = t334*t540;
+        t544 = A[354]*t538;
+        t545 = t337*t540;
+        t546 = A[352]*t540;
+        t547 = t330*t538;
+        t548 = A[353]*t540;
+        t549 = t334*t538;
+        t550 = A[354]*t540;
+        t551 = t337*t538;
+    }
+    if ((frames & 0x20800000u) != 0)
+    {
+        A[368] = t539+t541;
+        A[369] = t542+t543;
+        A[370] = t544+t545;
+        A[372] = -t546+t547;
+        A[373] = -t548+t549;
+        A[374] = -t550+t551;
+        A[376] = A[356];
+        A[377] = A[357];
+        A[378] = A[358];
+        A[380] = A[364];
+        A[381] = A[365];
+        A[382] = A[366];
+    }
+    if ((frames & 0x00800000u) != 0)
+    {
+        A[371] = IGM_CONST(0.0);
+        A[375] = IGM_CONST(0.0);
+        A[379] = IGM_CONST(0.0);
+        A[383] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x01000000u) != 0)
+    {
+        A[384] = t149;
+        A[385] = t170;
+        A[386] = t188;
+        A[387] = IGM_CONST(0.0);
+        A[388] = A[280];
+        A[389] = A[281];
+        A[390] = A[282];
+        A[391] = IGM_CONST(0.0);
+        A[392] = A[360];
+        A[393] = A[361];
+        A[394] = A[362];
+        A[395] = IGM_CONST(0.0);
+        A[396] = -0.175E-1*t156-0.675E-1*t157+t126-t127+t128-t129+t130+t131;
+        A[397] = -0.175E-1*t175-0.675E-1*t176+t132-t133+t134-t135+t136+t137;
+        A[398] = -0.175E-1*t193-0.675E-1*t194+t138-t139+t140-t141+t142+t143;
+        A[399] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x42000000u) != 0)
+    {
+        A[400] = A[88];
+        A[401] = A[89];
+        A[402] = A[90];
+        A[404] = t6;
+        A[405] = t36;
+        A[406] = t56;
+        A[408] = A[80];
+        A[409] = A[81];
+        A[410] = A[82];
+    }
+    if ((frames & 0x02000000u) != 0)
+    {
+        A[403] = IGM_CONST(0.0);
+        A[407] = IGM_CONST(0.0);
+        A[411] = IGM_CONST(0.0);
+        A[415] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x5e000000u) != 0)
+    {
+        A[412] = t131;
+        A[413] = t137;
+        A[414] = t143;
+    }
+    if ((frames & 0x04000000u) != 0)
+    {
+        A[416] = A[184];
+        A[417] = A[185];
+        A[418] = A[186];
+        A[419] = IGM_CONST(0.0);
+        A[420] = A[180];
+        A[421] = A[181];
+        A[422] = A[182];
+        A[423] = IGM_CONST(0.0);
+        A[424] = -A[176];
+        A[425] = -A[177];
+        A[426] = -A[178];
+        A[427] = IGM_CONST(0.0);
+        A[428] = 0.4511E-1*t314+0.4511E-1*t316+t306+t307+t285+t286+t213-t214+t126-
+t127+t128-t129+t130+A[412];
+        A[429] = 0.4511E-1*t317+0.4511E-1*t318+t308+t309+t287+t288+t215-t216+t132-
+t133+t134-t135+t136+A[413];
+        A[430] = 0.4511E-1*t319+0.4511E-1*t320+t310+t311+t289+t290+t217-t218+t138-
+t139+t140-t141+t142+A[414];
+        A[431] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x08000000u) != 0)
+    {
+        A[432] = A[264];
+        A[433] = A[265];
+        A[434] = A[266];
+        A[435] = IGM_CONST(0.0);
+        A[436] = A[260];
+        A[437] = A[261];
+        A[438] = A[262];
+        A[439] = IGM_CONST(0.0);
+        A[440] = -A[256];
+        A[441] = -A[257];
+        A[442] = -A[258];
+        A[443] = IGM_CONST(0.0);
+        A[444] = 0.159E-1*t404+0.159E-1*t406+0.10855*t389+0.10855*t391+t381+t382-
+t345-t346+t126-t127+t128-t129+t130+A[412];
+        A[445] = 0.159E-1*t407+0.159E-1*t408+0.10855*t392+0.10855*t393+t383+t384-
+t347-t348+t132-t133+t134-t135+t136+A[413];
+        A[446] = 0.159E-1*t409+0.159E-1*t410+0.10855*t394+0.10855*t395+t385+t386-
+t349-t350+t138-t139+t140-t141+t142+A[414];
+        A[447] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x10000000u) != 0)
+    {
+        A[448] = A[344];
+        A[449] = A[345];
+        A[450] = A[346];
+        A[451] = IGM_CONST(0.0);
+        A[452] = A[340];
+        A[453] = A[341];
+        A[454] = A[342];
+        A[455] = IGM_CONST(0.0);
+        A[456] = -A[336];
+        A[457] = -A[337];
+        A[458] = -A[338];
+        A[459] = IGM_CONST(0.0);
+        A[460] = 0.159E-1*t497+0.159E-1*t499+0.10855*t482+0.10855*t484+t474+t475-
+t438-t439+t126-t127+t128-t129+t130+A[412];
+        A[461] = 0.159E-1*t500+0.159E-1*t501+0.10855*t485+0.10855*t486+t476+t477-
+t440-t441+t132-t133+t134-t135+t136+A[413];
+        A[462] = 0.159E-1*t502+0.159E-1*t503+0.10855*t487+0.10855*t488+t478+t479-
+t442-t443+t138-t139+t140-t141+t142+A[414];
+        A[463] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x20000000u) != 0)
+    {
+        A[464] = A[368];
+        A[465] = A[369];
+        A[466] = A[370];
+        A[467] = IGM_CONST(0.0);
+        A[468] = A[376];
+        A[469] = A[377];
+        A[470] = A[378];
+        A[471] = IGM_CONST(0.0);
+        A[472] = -A[372];
+        A[473] = -A[373];
+        A[474] = -A[374];
+        A[475] = IGM_CONST(0.0);
+        A[476] = A[380];
+        A[477] = A[381];
+        A[478] = A[382];
+        A[479] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x40000000u) != 0)
+    {
+        t601 = 0.9999999999*A[412]-0.5687628827E-3*t28+0.8318061448E-1*t19+
+0.9332037043E-1*t12+0.1832763156E-3*t5+0.1832763156E-3*t8-0.9332037043E-1*t15+
+0.2893250095E-3*t20+0.2893250095E-3*t21-0.8318061448E-1*t24-0.5687628827E-3*t33
++0.1078086072E-3*t29+0.1078086072E-3*t30;
+        t615 = 0.9419629563E-2*t272-0.9761137487E-4*t360+0.9761137487E-4*t361
+-0.8823452451E-4*t231+0.8823452451E-4*t232+0.9970896939E-4*t222-0.1832763156E-3
+*t295+0.1078086072E-3*t261-0.1078086072E-3*t262-0.1702509553E-4*t461
+-0.1702509553E-4*t463+0.3775495252E-3*t541+0.2606799616E-2*t482;
+        t630 = 0.2606799616E-2*t484+0.1081557015E-2*t316+0.2369931678E-4*t489
+-0.2369931678E-4*t490-0.7932620886E-4*t411+0.7932620886E-4*t412+0.9381437244E-4
+*t339-0.9381437244E-4*t340+0.1232237092E-6*t375-0.1232237092E-6*t376+
+0.8051018213E-4*t406+0.8945848979E-4*t525-0.8945848979E-4*t526;
+        t644 = -0.1832763156E-3*t293+0.9381437244E-4*t432-0.9381437244E-4*t433+
+0.2893250095E-3*t279-0.2893250095E-3*t280+0.8503258945E-4*t453-0.8503258945E-4*
+t454-0.2570662873E-4*t425-0.2570662873E-4*t427+0.8051018213E-4*t497+
+0.8051018213E-4*t499+0.2606799616E-2*t389-0.2570662873E-4*t329;
+        t660 = -0.2570662873E-4*t332+0.7932620886E-4*t504-0.7932620886E-4*t505+
+0.101865705E-2*t148-0.5687628827E-3*t167-0.1607889161E-3*t87-0.9397174694E-4*
+t78-0.3024581465E-3*t79+0.3024581465E-3*t80+0.5737222431E-5*t82-0.1607889161E-3
+*t91+0.4122466806E-3*t120-0.4122466806E-3*t121;
+        t674 = 0.1681938551E-1*t243-0.1702509553E-4*t368-0.1702509553E-4*t370
+-0.3696711277E-6*t520+0.1512290733E-3*t237+0.1607889161E-3*t204-0.1607889161E-3
+*t205+0.3775495252E-3*t539-0.2369931678E-4*t396+0.2369931678E-4*t397
+-0.1660372087E-1*t156-0.6659098766E-1*t157+0.2061233404E-3*t160;
+        t689 = 0.2061233404E-3*t163+0.4677530128E-2*t446+0.4677530128E-2*t448+
+0.1081557015E-2*t314+0.9970896939E-4*t224+0.1112574236E-3*t321-0.1112574236E-3*
+t322+0.8799425961E-3*t300-0.8799425961E-3*t301+0.4677530128E-2*t353+
+0.4677530128E-2*t355-0.5687628827E-3*t152-0.101865705E-2*t146;
+        t703 = -0.3696711277E-6*t518+0.5082624939E-2*t546-0.5082624939E-2*t547+
+0.2606799616E-2*t391+0.4402844298E-1*A[408]+0.1112574236E-3*A[404]+
+0.8799425961E-3*A[400]-0.1512290733E-3*t238+0.1681938551E-1*t246+
+0.8051018213E-4*t404-0.1232237092E-6*t468+0.1232237092E-6*t469+0.9419629563E-2*
+t274;
+        A[480] = t601+t615+t630+t644+t660+t674+t689+t703;
+        t719 = 0.9419629563E-2*t275+0.9999999999*A[413]-0.5687628827E-3*t49+
+0.8318061448E-1*t43+0.9332037043E-1*t39+0.1832763156E-3*t35+0.1832763156E-3*t37
+-0.9332037043E-1*t41+0.2893250095E-3*t44+0.2893250095E-3*t45-0.8318061448E-1*
+t47-0.5687628827E-3*t53+0.1078086072E-3*t50;
+        t733 = 0.1078086072E-3*t51+0.9970896939E-4*t226+0.1512290733E-3*t247+
+0.4677530128E-2*t357+0.3775495252E-3*t543+0.9381437244E-4*t434-0.9381437244E-4*
+t435-0.2570662873E-4*t335-0.9761137487E-4*t362+0.9761137487E-4*t363+
+0.3775495252E-3*t542-0.1232237092E-6*t470+0.1232237092E-6*t471;
+        t748 = 0.1681938551E-1*t251+0.2606799616E-2*t485+0.2606799616E-2*t486+
+0.9381437244E-4*t341-0.9381437244E-4*t342-0.2369931678E-4*t398+0.2369931678E-4*
+t399-0.1832763156E-3*t296+0.2369931678E-4*t491-0.2369931678E-4*t492+
+0.1081557015E-2*t317+0.1112574236E-3*t323-0.1112574236E-3*t324;
+        t762 = 0.1081557015E-2*t318+0.4677530128E-2*t450-0.1512290733E-3*t248+
+0.1681938551E-1*t253+0.9970896939E-4*t227-0.2570662873E-4*t428-0.2570662873E-4*
+t429-0.2570662873E-4*t333-0.1702509553E-4*t465+0.1232237092E-6*t377
+-0.1232237092E-6*t378+0.8051018213E-4*t500+0.8051018213E-4*t501;
+        t778 = 0.8051018213E-4*t408+0.1607889161E-3*t206-0.1607889161E-3*t207
+-0.1607889161E-3*t102-0.9397174694E-4*t95-0.3024581465E-3*t96+0.3024581465E-3*
+t97+0.5737222431E-5*t99-0.1607889161E-3*t105+0.4122466806E-3*t122
+-0.4122466806E-3*t123+0.5082624939E-2*t548-0.5082624939E-2*t549;
+        t792 = 0.2606799616E-2*t392+0.8051018213E-4*t407+0.8503258945E-4*t455
+-0.8503258945E-4*t456+0.1078086072E-3*t263-0.1078086072E-3*t264-0.3696711277E-6
+*t521+0.8799425961E-3*t302-0.8799425961E-3*t303-0.1702509553E-4*t371
+-0.1702509553E-4*t372-0.1702509553E-4*t464+0.8945848979E-4*t527;
+        t807 = -0.8945848979E-4*t528+0.7932620886E-4*t506-0.7932620886E-4*t507
+-0.5687628827E-3*t171-0.101865705E-2*t168+0.101865705E-2*t169-0.5687628827E-3*
+t185-0.1660372087E-1*t175+0.4677530128E-2*t449+0.4677530128E-2*t356
+-0.7932620886E-4*t413+0.7932620886E-4*t414-0.8823452451E-4*t233;
+        t821 = 0.8823452451E-4*t234-0.1832763156E-3*t297-0.3696711277E-6*t522+
+0.4402844298E-1*A[409]+0.1112574236E-3*A[405]+0.8799425961E-3*A[401]
+-0.6659098766E-1*t176+0.2061233404E-3*t179+0.2061233404E-3*t182+0.2893250095E-3
+*t281-0.2893250095E-3*t282+0.9419629563E-2*t276+0.2606799616E-2*t393;
+        A[481] = t719+t733+t748+t762+t778+t792+t807+t821;
+        t837 = 0.9419629563E-2*t278+0.5082624939E-2*t550-0.5082624939E-2*t551+
+0.9999999999*A[414]-0.2369931678E-4*t400+0.2369931678E-4*t401+0.9381437244E-4*
+t343-0.9381437244E-4*t344+0.8051018213E-4*t502-0.1702509553E-4*t466
+-0.1702509553E-4*t467+0.1681938551E-1*t258+0.9381437244E-4*t436;
+        t851 = -0.9381437244E-4*t437+0.1232237092E-6*t379-0.1232237092E-6*t380
+-0.2570662873E-4*t336-0.2570662873E-4*t338-0.8823452451E-4*t235+0.8823452451E-4
+*t236+0.9419629563E-2*t277+0.1607889161E-3*t208-0.1607889161E-3*t209+
+0.2893250095E-3*t283-0.2893250095E-3*t284+0.7932620886E-4*t508;
+        t866 = -0.7932620886E-4*t509+0.8051018213E-4*t409-0.9761137487E-4*t364+
+0.9761137487E-4*t365-0.7932620886E-4*t415+0.7932620886E-4*t416-0.1232237092E-6*
+t472+0.1232237092E-6*t473+0.2606799616E-2*t487+0.2606799616E-2*t488+
+0.8051018213E-4*t410+0.2369931678E-4*t493-0.2369931678E-4*t494;
+        t880 = -0.1702509553E-4*t374+0.4677530128E-2*t451-0.2570662873E-4*t431+
+0.1081557015E-2*t320+0.4677530128E-2*t358+0.4677530128E-2*t452+0.9970896939E-4*
+t229+0.8945848979E-4*t529-0.8945848979E-4*t530+0.1112574236E-3*t325
+-0.1112574236E-3*t326-0.1832763156E-3*t298-0.1702509553E-4*t373;
+        t896 = -0.5687628827E-3*t69+0.8318061448E-1*t63+0.9332037043E-1*t59+
+0.1832763156E-3*t55+0.1832763156E-3*t57-0.9332037043E-1*t61+0.2893250095E-3*t64
++0.2893250095E-3*t65-0.8318061448E-1*t67-0.5687628827E-3*t73+0.1078086072E-3*
+t70+0.1078086072E-3*t71-0.1607889161E-3*t116;
+        t910 = -0.9397174694E-4*t109-0.3024581465E-3*t110+0.3024581465E-3*t111+
+0.5737222431E-5*t113-0.1607889161E-3*t119+0.4122466806E-3*t124-0.4122466806E-3*
+t125+0.1078086072E-3*t265-0.1078086072E-3*t266+0.8051018213E-4*t503+
+0.3775495252E-3*t545+0.9970896939E-4*t230-0.1512290733E-3*t255;
+        t925 = 0.1681938551E-1*t260+0.3775495252E-3*t544-0.3696711277E-6*t524+
+0.2061233404E-3*t200+0.4677530128E-2*t359+0.2606799616E-2*t395+0.1512290733E-3*
+t254+0.8503258945E-4*t457-0.8503258945E-4*t458+0.8799425961E-3*t304
+-0.8799425961E-3*t305-0.1832763156E-3*t299-0.2570662873E-4*t430;
+        t939 = -0.3696711277E-6*t523+0.2606799616E-2*t394+0.1081557015E-2*t319+
+0.4402844298E-1*A[410]+0.1112574236E-3*A[406]+0.8799425961E-3*A[402]
+-0.5687628827E-3*t189-0.101865705E-2*t186+0.101865705E-2*t187-0.5687628827E-3*
+t203-0.1660372087E-1*t193-0.6659098766E-1*t194+0.2061233404E-3*t197;
+        A[482] = t837+t851+t866+t880+t896+t910+t925+t939;
+    }
+    return;
+  }
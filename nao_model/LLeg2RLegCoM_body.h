@@ -0,0 +1,1122 @@
+/* Generated using codegen (2012-02-13, 17:03:54) */
+/*
+ * Body of LLeg2RLegCoM(), the IGM_* macros are described in maple_double.h.
+ * The statements of LLeg2RLeg_body.h and LLeg2CoM_body.h are merged,
+ * identical operations are computed once.
+ */
+  IGM_REAL t1;
+  IGM_REAL t10;
+  IGM_REAL t100;
+  IGM_REAL t101;
+  IGM_REAL t102;
+  IGM_REAL t103;
+  IGM_REAL t104;
+  IGM_REAL t105;
+  IGM_REAL t106;
+  IGM_REAL t107;
+  IGM_REAL t108;
+  IGM_REAL t109;
+  IGM_REAL t11;
+  IGM_REAL t110;
+  IGM_REAL t111;
+  IGM_REAL t112;
+  IGM_REAL t113;
+  IGM_REAL t114;
+  IGM_REAL t115;
+  IGM_REAL t116;
+  IGM_REAL t117;
+  IGM_REAL t118;
+  IGM_REAL t119;
+  IGM_REAL t12;
+  IGM_REAL t120;
+  IGM_REAL t121;
+  IGM_REAL t122;
+  IGM_REAL t123;
+  IGM_REAL t124;
+  IGM_REAL t125;
+  IGM_REAL t126;
+  IGM_REAL t127;
+  IGM_REAL t128;
+  IGM_REAL t129;
+  IGM_REAL t13;
+  IGM_REAL t130;
+  IGM_REAL t131;
+  IGM_REAL t132;
+  IGM_REAL t133;
+  IGM_REAL t134;
+  IGM_REAL t135;
+  IGM_REAL t136;
+  IGM_REAL t137;
+  IGM_REAL t138;
+  IGM_REAL t139;
+  IGM_REAL t14;
+  IGM_REAL t140;
+  IGM_REAL t141;
+  IGM_REAL t142;
+  IGM_REAL t143;
+  IGM_REAL t144;
+  IGM_REAL t145;
+  IGM_REAL t146;
+  IGM_REAL t147;
+  IGM_REAL t148;
+  IGM_REAL t149;
+  IGM_REAL t15;
+  IGM_REAL t150;
+  IGM_REAL t151;
+  IGM_REAL t152;
+  IGM_REAL t153;
+  IGM_REAL t154;
+  IGM_REAL t155;
+  IGM_REAL t156;
+  IGM_REAL t157;
+  IGM_REAL t158;
+  IGM_REAL t159;
+  IGM_REAL t16;
+  IGM_REAL t160;
+  IGM_REAL t161;
+  IGM_REAL t162;
+  IGM_REAL t163;
+  IGM_REAL t164;
+  IGM_REAL t165;
+  IGM_REAL t166;
+  IGM_REAL t167;
+  IGM_REAL t168;
+  IGM_REAL t169;
+  IGM_REAL t17;
+  IGM_REAL t170;
+  IGM_REAL t171;
+  IGM_REAL t172;
+  IGM_REAL t173;
+  IGM_REAL t174;
+  IGM_REAL t175;
+  IGM_REAL t176;
+  IGM_REAL t177;
+  IGM_REAL t178;
+  IGM_REAL t179;
+  IGM_REAL t18;
+  IGM_REAL t180;
+  IGM_REAL t181;
+  IGM_REAL t182;
+  IGM_REAL t183;
+  IGM_REAL t184;
+  IGM_REAL t185;
+  IGM_REAL t186;
+  IGM_REAL t187;
+  IGM_REAL t188;
+  IGM_REAL t189;
+  IGM_REAL t19;
+  IGM_REAL t190;
+  IGM_REAL t191;
+  IGM_REAL t192;
+  IGM_REAL t193;
+  IGM_REAL t194;
+  IGM_REAL t195;
+  IGM_REAL t196;
+  IGM_REAL t197;
+  IGM_REAL t198;
+  IGM_REAL t199;
+  IGM_REAL t2;
+  IGM_REAL t20;
+  IGM_REAL t200;
+  IGM_REAL t201;
+  IGM_REAL t202;
+  IGM_REAL t203;
+  IGM_REAL t204;
+  IGM_REAL t205;
+  IGM_REAL t206;
+  IGM_REAL t207;
+  IGM_REAL t208;
+  IGM_REAL t209;
+  IGM_REAL t21;
+  IGM_REAL t210;
+  IGM_REAL t211;
+  IGM_REAL t212;
+  IGM_REAL t213;
+  IGM_REAL t214;
+  IGM_REAL t215;
+  IGM_REAL t216;
+  IGM_REAL t217;
+  IGM_REAL t218;
+  IGM_REAL t219;
+  IGM_REAL t22;
+  IGM_REAL t220;
+  IGM_REAL t221;
+  IGM_REAL t222;
+  IGM_REAL t223;
+  IGM_REAL t224;
+  IGM_REAL t225;
+  IGM_REAL t226;
+  IGM_REAL t227;
+  IGM_REAL t228;
+  IGM_REAL t229;
+  IGM_REAL t23;
+  IGM_REAL t230;
+  IGM_REAL t231;
+  IGM_REAL t232;
+  IGM_REAL t233;
+  IGM_REAL t234;
+  IGM_REAL t235;
+  IGM_REAL t236;
+  IGM_REAL t237;
+  IGM_REAL t238;
+  IGM_REAL t239;
+  IGM_REAL t24;
+  IGM_REAL t240;
+  IGM_REAL t241;
+  IGM_REAL t242;
+  IGM_REAL t243;
+  IGM_REAL t244;
+  IGM_REAL t245;
+  IGM_REAL t246;
+  IGM_REAL t247;
+  IGM_REAL t248;
+  IGM_REAL t249;
+  IGM_REAL t25;
+  IGM_REAL t250;
+  IGM_REAL t251;
+  IGM_REAL t252;
+  IGM_REAL t253;
+  IGM_REAL t254;
+  IGM_REAL t255;
+  IGM_REAL t256;
+  IGM_REAL t257;
+  IGM_REAL t258;
+  IGM_REAL t259;
+  IGM_REAL t26;
+  IGM_REAL t260;
+  IGM_REAL t261;
+  IGM_REAL t262;
+  IGM_REAL t263;
+  IGM_REAL t264;
+  IGM_REAL t265;
+  IGM_REAL t266;
+  IGM_REAL t267;
+  IGM_REAL t268;
+  IGM_REAL t269;
+  IGM_REAL t27;
+  IGM_REAL t270;
+  IGM_REAL t271;
+  IGM_REAL t272;
+  IGM_REAL t273;
+  IGM_REAL t274;
+  IGM_REAL t275;
+  IGM_REAL t276;
+  IGM_REAL t277;
+  IGM_REAL t278;
+  IGM_REAL t279;
+  IGM_REAL t28;
+  IGM_REAL t280;
+  IGM_REAL t281;
+  IGM_REAL t282;
+  IGM_REAL t283;
+  IGM_REAL t284;
+  IGM_REAL t285;
+  IGM_REAL t286;
+  IGM_REAL t287;
+  IGM_REAL t288;
+  IGM_REAL t289;
+  IGM_REAL t29;
+  IGM_REAL t290;
+  IGM_REAL t291;
+  IGM_REAL t292;
+  IGM_REAL t293;
+  IGM_REAL t294;
+  IGM_REAL t295;
+  IGM_REAL t296;
+  IGM_REAL t297;
+  IGM_REAL t298;
+  IGM_REAL t299;
+  IGM_REAL t3;
+  IGM_REAL t30;
+  IGM_REAL t300;
+  IGM_REAL t301;
+  IGM_REAL t302;
+  IGM_REAL t303;
+  IGM_REAL t304;
+  IGM_REAL t305;
+  IGM_REAL t306;
+  IGM_REAL t307;
+  IGM_REAL t308;
+  IGM_REAL t309;
+  IGM_REAL t31;
+  IGM_REAL t310;
+  IGM_REAL t311;
+  IGM_REAL t312;
+  IGM_REAL t313;
+  IGM_REAL t314;
+  IGM_REAL t315;
+  IGM_REAL t316;
+  IGM_REAL t317;
+  IGM_REAL t318;
+  IGM_REAL t319;
+  IGM_REAL t32;
+  IGM_REAL t320;
+  IGM_REAL t321;
+  IGM_REAL t322;
+  IGM_REAL t323;
+  IGM_REAL t324;
+  IGM_REAL t325;
+  IGM_REAL t326;
+  IGM_REAL t327;
+  IGM_REAL t328;
+  IGM_REAL t329;
+  IGM_REAL t33;
+  IGM_REAL t330;
+  IGM_REAL t331;
+  IGM_REAL t332;
+  IGM_REAL t333;
+  IGM_REAL t334;
+  IGM_REAL t335;
+  IGM_REAL t336;
+  IGM_REAL t337;
+  IGM_REAL t338;
+  IGM_REAL t339;
+  IGM_REAL t34;
+  IGM_REAL t340;
+  IGM_REAL t341;
+  IGM_REAL t342;
+  IGM_REAL t343;
+  IGM_REAL t344;
+  IGM_REAL t345;
+  IGM_REAL t346;
+  IGM_REAL t347;
+  IGM_REAL t348;
+  IGM_REAL t349;
+  IGM_REAL t35;
+  IGM_REAL t350;
+  IGM_REAL t351;
+  IGM_REAL t352;
+  IGM_REAL t353;
+  IGM_REAL t354;
+  IGM_REAL t355;
+  IGM_REAL t356;
+  IGM_REAL t357;
+  IGM_REAL t358;
+  IGM_REAL t359;
+  IGM_REAL t36;
+  IGM_REAL t360;
+  IGM_REAL t361;
+  IGM_REAL t362;
+  IGM_REAL t363;
+  IGM_REAL t364;
+  IGM_REAL t365;
+  IGM_REAL t366;
+  IGM_REAL t367;
+  IGM_REAL t368;
+  IGM_REAL t369;
+  IGM_REAL t37;
+  IGM_REAL t370;
+  IGM_REAL t371;
+  IGM_REAL t372;
+  IGM_REAL t373;
+  IGM_REAL t374;
+  IGM_REAL t375;
+  IGM_REAL t376;
+  IGM_REAL t377;
+  IGM_REAL t378;
+  IGM_REAL t379;
+  IGM_REAL t38;
+  IGM_REAL t380;
+  IGM_REAL t381;
+  IGM_REAL t382;
+  IGM_REAL t383;
+  IGM_REAL t384;
+  IGM_REAL t385;
+  IGM_REAL t386;
+  IGM_REAL t387;
+  IGM_REAL t388;
+  IGM_REAL t389;
+  IGM_REAL t39;
+  IGM_REAL t390;
+  IGM_REAL t391;
+  IGM_REAL t392;
+  IGM_REAL t393;
+  IGM_REAL t394;
+  IGM_REAL t395;
+  IGM_REAL t396;
+  IGM_REAL t397;
+  IGM_REAL t398;
+  IGM_REAL t399;
+  IGM_REAL t4;
+  IGM_REAL t40;
+  IGM_REAL t400;
+  IGM_REAL t401;
+  IGM_REAL t402;
+  IGM_REAL t403;
+  IGM_REAL t404;
+  IGM_REAL t405;
+  IGM_REAL t406;
+  IGM_REAL t407;
+  IGM_REAL t408;
+  IGM_REAL t409;
+  IGM_REAL t41;
+  IGM_REAL t410;
+  IGM_REAL t411;
+  IGM_REAL t412;
+  IGM_REAL t413;
+  IGM_REAL t414;
+  IGM_REAL t415;
+  IGM_REAL t416;
+  IGM_REAL t417;
+  IGM_REAL t418;
+  IGM_REAL t419;
+  IGM_REAL t42;
+  IGM_REAL t420;
+  IGM_REAL t421;
+  IGM_REAL t422;
+  IGM_REAL t423;
+  IGM_REAL t424;
+  IGM_REAL t425;
+  IGM_REAL t426;
+  IGM_REAL t427;
+  IGM_REAL t428;
+  IGM_REAL t429;
+  IGM_REAL t43;
+  IGM_REAL t430;
+  IGM_REAL t431;
+  IGM_REAL t432;
+  IGM_REAL t433;
+  IGM_REAL t434;
+  IGM_REAL t435;
+  IGM_REAL t436;
+  IGM_REAL t437;
+  IGM_REAL t438;
+  IGM_REAL t439;
+  IGM_REAL t44;
+  IGM_REAL t440;
+  IGM_REAL t441;
+  IGM_REAL t442;
+  IGM_REAL t443;
+  IGM_REAL t444;
+  IGM_REAL t445;
+  IGM_REAL t446;
+  IGM_REAL t447;
+  IGM_REAL t448;
+  IGM_REAL t449;
+  IGM_REAL t45;
+  IGM_REAL t450;
+  IGM_REAL t451;
+  IGM_REAL t452;
+  IGM_REAL t453;
+  IGM_REAL t454;
+  IGM_REAL t455;
+  IGM_REAL t456;
+  IGM_REAL t457;
+  IGM_REAL t458;
+  IGM_REAL t459;
+  IGM_REAL t46;
+  IGM_REAL t460;
+  IGM_REAL t461;
+  IGM_REAL t462;
+  IGM_REAL t463;
+  IGM_REAL t464;
+  IGM_REAL t465;
+  IGM_REAL t466;
+  IGM_REAL t467;
+  IGM_REAL t468;
+  IGM_REAL t469;
+  IGM_REAL t47;
+  IGM_REAL t470;
+  IGM_REAL t471;
+  IGM_REAL t472;
+  IGM_REAL t473;
+  IGM_REAL t474;
+  IGM_REAL t475;
+  IGM_REAL t476;
+  IGM_REAL t477;
+  IGM_REAL t478;
+  IGM_REAL t479;
+  IGM_REAL t48;
+  IGM_REAL t480;
+  IGM_REAL t481;
+  IGM_REAL t482;
+  IGM_REAL t483;
+  IGM_REAL t484;
+  IGM_REAL t485;
+  IGM_REAL t486;
+  IGM_REAL t487;
+  IGM_REAL t488;
+  IGM_REAL t489;
+  IGM_REAL t49;
+  IGM_REAL t490;
+  IGM_REAL t491;
+  IGM_REAL t492;
+  IGM_REAL t493;
+  IGM_REAL t494;
+  IGM_REAL t495;
+  IGM_REAL t496;
+  IGM_REAL t497;
+  IGM_REAL t498;
+  IGM_REAL t499;
+  IGM_REAL t5;
+  IGM_REAL t50;
+  IGM_REAL t500;
+  IGM_REAL t501;
+  IGM_REAL t502;
+  IGM_REAL t503;
+  IGM_REAL t51;
+  IGM_REAL t52;
+  IGM_REAL t53;
+  IGM_REAL t54;
+  IGM_REAL t55;
+  IGM_REAL t56;
+  IGM_REAL t57;
+  IGM_REAL t58;
+  IGM_REAL t59;
+  IGM_REAL t6;
+  IGM_REAL t60;
+  IGM_REAL t61;
+  IGM_REAL t62;
+  IGM_REAL t63;
+  IGM_REAL t64;
+  IGM_REAL t65;
+  IGM_REAL t66;
+  IGM_REAL t67;
+  IGM_REAL t68;
+  IGM_REAL t69;
+  IGM_REAL t7;
+  IGM_REAL t70;
+  IGM_REAL t71;
+  IGM_REAL t72;
+  IGM_REAL t73;
+  IGM_REAL t74;
+  IGM_REAL t75;
+  IGM_REAL t76;
+  IGM_REAL t77;
+  IGM_REAL t78;
+  IGM_REAL t79;
+  IGM_REAL t8;
+  IGM_REAL t80;
+  IGM_REAL t81;
+  IGM_REAL t82;
+  IGM_REAL t83;
+  IGM_REAL t84;
+  IGM_REAL t85;
+  IGM_REAL t86;
+  IGM_REAL t87;
+  IGM_REAL t88;
+  IGM_REAL t89;
+  IGM_REAL t9;
+  IGM_REAL t90;
+  IGM_REAL t91;
+  IGM_REAL t92;
+  IGM_REAL t93;
+  IGM_REAL t94;
+  IGM_REAL t95;
+  IGM_REAL t96;
+  IGM_REAL t97;
+  IGM_REAL t98;
+  IGM_REAL t99;
+  {
+    t1 = LL[8];
+    t2 = IGM_COS_Q(5);
+    t3 = LL[4];
+    t4 = IGM_SIN_Q(5);
+    t5 = t1*t2;
+    t6 = t3*t4;
+    t7 = t5+t6;
+    t8 = IGM_COS_Q(4);
+    t9 = t7*t8;
+    t10 = LL[0];
+    t11 = IGM_SIN_Q(4);
+    t12 = t10*t11;
+    t13 = t9-t12;
+    t14 = IGM_COS_Q(3);
+    t15 = t13*t14;
+    t16 = t7*t11;
+    t17 = t10*t8;
+    t18 = t16+t17;
+    t19 = IGM_SIN_Q(3);
+    t20 = t18*t19;
+    t21 = t15-t20;
+    t22 = IGM_SIN_Q(2);
+    t23 = t13*t19;
+    t24 = t18*t14;
+    t25 = t23+t24;
+    t26 = IGM_COS_Q(2);
+    t27 = t21*t22;
+    t28 = t25*t26;
+    t29 = t27+t28;
+    t30 = IGM_SIN_Q(0);
+    t31 = IGM_CONST(sqrt(2.0));
+    t32 = (t21*t26-t25*t22)*t31;
+    t33 = t1*t4;
+    t34 = t3*t2;
+    t35 = (t34-t33)*t31;
+    t36 = t32/2.0;
+    t37 = t35/2.0;
+    t38 = t36-t37;
+    t39 = IGM_SIN_Q(1);
+    t40 = -t36-t37;
+    t41 = IGM_COS_Q(1);
+    t42 = t38*t39;
+    t43 = t40*t41;
+    t44 = t42+t43;
+    t45 = IGM_COS_Q(0);
+    t46 = (t29*t30+t44*t45)*t31;
+    t47 = t38*t41;
+    t48 = t40*t39;
+    t49 = (t48-t47)*t31;
+    t50 = t46/2.0;
+    t51 = t49/2.0;
+    t52 = t51-t50;
+    t53 = t52*t31;
+    t54 = (-t50-t51)*t31;
+    t55 = t53/2.0;
+    t56 = t54/2.0;
+    t57 = -t55-t56;
+    t58 = IGM_COS_Q(7);
+    t59 = t29*t45;
+    t60 = t44*t30;
+    t61 = t59-t60;
+    t62 = IGM_SIN_Q(6);
+    t63 = t55-t56;
+    t64 = IGM_COS_Q(6);
+    t65 = t61*t62;
+    t66 = t63*t64-t65;
+    t67 = IGM_SIN_Q(7);
+    t68 = (t57*t58+t66*t67)*t31;
+    t69 = (t66*t58-t57*t67)*t31;
+    t70 = t68/2.0;
+    t71 = t69/2.0;
+    t72 = t70+t71;
+    t73 = IGM_COS_Q(8);
+    t74 = t72*t73;
+    t75 = t61*t64;
+    t76 = -t75;
+    t77 = t76-t63*t62;
+    t78 = IGM_SIN_Q(8);
+    t79 = t77*t78;
+    t80 = t74+t79;
+    t81 = IGM_COS_Q(9);
+    t82 = t80*t81;
+    t83 = t77*t73-t72*t78;
+    t84 = IGM_SIN_Q(9);
+    t85 = t83*t84;
+    t86 = t82+t85;
+    t87 = IGM_SIN_Q(10);
+    t88 = t83*t81-t80*t84;
+    t89 = IGM_COS_Q(10);
+    t90 = LL[9];
+    t91 = LL[5];
+    t92 = t90*t2;
+    t93 = t91*t4;
+    t94 = t92+t93;
+    t95 = t94*t8;
+    t96 = LL[1];
+    t97 = t96*t11;
+    t98 = t95-t97;
+    t99 = t98*t14;
+    t100 = t94*t11;
+    t101 = t96*t8;
+    t102 = t100+t101;
+    t103 = t102*t19;
+    t104 = t99-t103;
+    t105 = t98*t19;
+    t106 = t102*t14;
+    t107 = t105+t106;
+    t108 = t104*t22;
+    t109 = t107*t26;
+    t110 = t108+t109;
+    t111 = (t104*t26-t107*t22)*t31;
+    t112 = t90*t4;
+    t113 = t91*t2;
+    t114 = (t113-t112)*t31;
+    t115 = t111/2.0;
+    t116 = t114/2.0;
+    t117 = t115-t116;
+    t118 = -t115-t116;
+    t119 = t117*t39;
+    t120 = t118*t41;
+    t121 = t119+t120;
+    t122 = (t110*t30+t121*t45)*t31;
+    t123 = t117*t41;
+    t124 = t118*t39;
+    t125 = (t124-t123)*t31;
+    t126 = t122/2.0;
+    t127 = t125/2.0;
+    t128 = t127-t126;
+    t129 = t128*t31;
+    t130 = -t126-t127;
+    t131 = t130*t31;
+    t132 = t129/2.0;
+    t133 = t131/2.0;
+    t134 = -t132-t133;
+    t135 = t110*t45;
+    t136 = t121*t30;
+    t137 = t135-t136;
+    t138 = t132-t133;
+    t139 = t137*t62;
+    t140 = t138*t64;
+    t141 = t140-t139;
+    t142 = t134*t58;
+    t143 = t141*t67;
+    t144 = (t142+t143)*t31;
+    t145 = t134*t67;
+    t146 = t141*t58;
+    t147 = (t146-t145)*t31;
+    t148 = t144/2.0;
+    t149 = t147/2.0;
+    t150 = t148+t149;
+    t151 = t150*t73;
+    t152 = t137*t64;
+    t153 = t138*t62;
+    t154 = -t152-t153;
+    t155 = t154*t78;
+    t156 = t151+t155;
+    t157 = t156*t81;
+    t158 = t150*t78;
+    t159 = t154*t73;
+    t160 = t159-t158;
+    t161 = t160*t84;
+    t162 = t157+t161;
+    t163 = t156*t84;
+    t164 = t160*t81;
+    t165 = t164-t163;
+    t166 = LL[10];
+    t167 = LL[6];
+    t168 = t166*t2;
+    t169 = t167*t4;
+    t170 = t168+t169;
+    t171 = t170*t8;
+    t172 = LL[2];
+    t173 = t172*t11;
+    t174 = t171-t173;
+    t175 = t174*t14;
+    t176 = t170*t11;
+    t177 = t172*t8;
+    t178 = t176+t177;
+    t179 = t178*t19;
+    t180 = t175-t179;
+    t181 = t174*t19;
+    t182 = t178*t14;
+    t183 = t181+t182;
+    t184 = t180*t22;
+    t185 = t183*t26;
+    t186 = t184+t185;
+    t187 = (t180*t26-t183*t22)*t31;
+    t188 = t166*t4;
+    t189 = t167*t2;
+    t190 = (t189-t188)*t31;
+    t191 = t187/2.0;
+    t192 = t190/2.0;
+    t193 = t191-t192;
+    t194 = -t191-t192;
+    t195 = t193*t39;
+    t196 = t194*t41;
+    t197 = t195+t196;
+    t198 = (t186*t30+t197*t45)*t31;
+    t199 = t193*t41;
+    t200 = t194*t39;
+    t201 = (t200-t199)*t31;
+    t202 = t198/2.0;
+    t203 = t201/2.0;
+    t204 = t203-t202;
+    t205 = t204*t31;
+    t206 = (-t202-t203)*t31;
+    t207 = t205/2.0;
+    t208 = t206/2.0;
+    t209 = -t207-t208;
+    t210 = t186*t45;
+    t211 = t197*t30;
+    t212 = t210-t211;
+    t213 = t207-t208;
+    t214 = t212*t62;
+    t215 = t213*t64-t214;
+    t216 = (t209*t58+t215*t67)*t31;
+    t217 = (t215*t58-t209*t67)*t31;
+    t218 = t216/2.0;
+    t219 = t217/2.0;
+    t220 = t218+t219;
+    t221 = t220*t73;
+    t222 = t212*t64;
+    t223 = -t222;
+    t224 = t223-t213*t62;
+    t225 = t224*t78;
+    t226 = t221+t225;
+    t227 = t226*t81;
+    t228 = t224*t73-t220*t78;
+    t229 = t228*t84;
+    t230 = t227+t229;
+    t231 = t228*t81-t226*t84;
+    t232 = t86*t89+t88*t87;
+    t233 = IGM_SIN_Q(11);
+    t234 = t71-t70;
+    t235 = IGM_COS_Q(11);
+    t236 = t162*t89;
+    t237 = t165*t87;
+    t238 = t236+t237;
+    t239 = t149-t148;
+    t240 = t230*t89+t231*t87;
+    t241 = t219-t218;
+    t242 = t232*t235;
+    t243 = t234*t233;
+    t244 = t238*t235;
+    t245 = t239*t233;
+    t246 = t240*t235;
+    t247 = t241*t233;
+    t248 = LL[12];
+    t249 = LL[13];
+    t250 = LL[14];
+    t251 = IGM_COS_Q(17);
+    t252 = t61*t251;
+    t253 = t50+t51;
+    t254 = IGM_SIN_Q(17);
+    t255 = t253*t254;
+    t256 = t252+t255;
+    t257 = IGM_COS_Q(18);
+    t258 = t256*t257;
+    t259 = IGM_SIN_Q(18);
+    t260 = t52*t259;
+    t261 = t258+t260;
+    t262 = IGM_COS_Q(20);
+    t263 = IGM_SIN_Q(23);
+    t264 = IGM_COS_Q(22);
+    t265 = t61*t264;
+    t266 = IGM_SIN_Q(22);
+    t267 = t52*t266;
+    t268 = t265+t267;
+    t269 = IGM_SIN_Q(20);
+    t270 = t261*t269;
+    t271 = t61*t254;
+    t272 = t253*t251;
+    t273 = t272-t271;
+    t274 = IGM_SIN_Q(19);
+    t275 = t273*t274;
+    t276 = t256*t259;
+    t277 = t52*t257;
+    t278 = t277-t276;
+    t279 = IGM_COS_Q(19);
+    t280 = t278*t279;
+    t281 = t280-t275;
+    t282 = t281*t262;
+    t283 = t282-t270;
+    t284 = IGM_SIN_Q(21);
+    t285 = t253*t31;
+    t286 = t285/2.0;
+    t287 = t286-t55;
+    t288 = t287*t58;
+    t289 = t55+t286;
+    t290 = t289*t64;
+    t291 = t290-t65;
+    t292 = t291*t67;
+    t293 = (t288+t292)*t31;
+    t294 = t287*t67;
+    t295 = t291*t58;
+    t296 = (t295-t294)*t31;
+    t297 = t293/2.0;
+    t298 = t296/2.0;
+    t299 = t297+t298;
+    t300 = t299*t73;
+    t301 = t289*t62;
+    t302 = t76-t301;
+    t303 = t302*t78;
+    t304 = t299*t78;
+    t305 = t302*t73;
+    t306 = t305-t304;
+    t307 = t306*t84;
+    t308 = t273*t279;
+    t309 = t278*t274;
+    t310 = t308+t309;
+    t311 = IGM_COS_Q(21);
+    t312 = t306*t81;
+    t313 = 0.2606799616E-2*t261*t262+0.3775495252E-3*t253*t263+0.5082624939E-2
+*t268*t263+0.8051018213E-4*t283*t284+0.1681938551E-1*t300+0.1681938551E-1*t303
++0.9419629563E-2*t307+0.8051018213E-4*t310*t311-0.5687628827E-3*t301
+-0.1607889161E-3*t290+0.1607889161E-3*t65-0.1512290733E-3*t296-0.2893250095E-3
+*t312;
+    t314 = t300+t303;
+    t315 = t314*t84;
+    t316 = t314*t81;
+    t317 = t316+t307;
+    t318 = t317*t89;
+    t319 = IGM_COS_Q(23);
+    t320 = t312-t315;
+    t321 = t320*t87;
+    t322 = 0.7932620886E-4*t310*t284-0.2369931678E-4*t282+0.2369931678E-4*t270
++0.2893250095E-3*t315-0.1832763156E-3*t318-0.5082624939E-2*t253*t319
+-0.1832763156E-3*t321-0.1078086072E-3*t305+0.9970896939E-4*t292+0.2606799616E-2
+*t281*t269-0.8799425961E-3*t320*t89+0.8799425961E-3*t317*t87+0.8823452451E-4
+*t295;
+    t323 = t318+t321;
+    t324 = t298-t297;
+    t325 = 0.1081557015E-2*t323*t235-0.8823452451E-4*t294+0.1081557015E-2*t324
+*t233+0.9419629563E-2*t316-0.1112574236E-3*t324*t235+0.9970896939E-4*t288
++0.1832763156E-3*t6+0.9332037043E-1*t9+0.1832763156E-3*t5-0.9332037043E-1*t12
++0.1078086072E-3*t23-0.3024581465E-3*t33+0.3024581465E-3*t34;
+    t326 = IGM_COS_Q(12);
+    t327 = t61*t326;
+    t328 = IGM_SIN_Q(12);
+    t329 = t253*t328;
+    t330 = t253*t326;
+    t331 = t61*t328;
+    t332 = t330-t331;
+    t333 = IGM_COS_Q(14);
+    t334 = t332*t333;
+    t335 = 0.2893250095E-3*t16+0.2893250095E-3*t17+0.8318061448E-1*t15
++0.1112574236E-3*t3+0.4402844298E-1*t1+0.8799425961E-3*t10+0.9999999999*t248
++0.1112574236E-3*t323*t233-0.2570662873E-4*t327-0.2570662873E-4*t329
+-0.9381437244E-4*t330+0.9381437244E-4*t331-0.1702509553E-4*t334;
+    t336 = t327+t329;
+    t337 = IGM_SIN_Q(13);
+    t338 = t336*t337;
+    t339 = IGM_COS_Q(13);
+    t340 = t52*t339;
+    t341 = t340-t338;
+    t342 = IGM_SIN_Q(14);
+    t343 = t341*t342;
+    t344 = t334+t343;
+    t345 = IGM_COS_Q(16);
+    t346 = t336*t339;
+    t347 = t52*t337;
+    t348 = t346+t347;
+    t349 = IGM_SIN_Q(15);
+    t350 = t348*t349;
+    t351 = t332*t342;
+    t352 = t341*t333;
+    t353 = t352-t351;
+    t354 = IGM_COS_Q(15);
+    t355 = t353*t354;
+    t356 = 0.8051018213E-4*t344*t345-0.1702509553E-4*t343+0.4677530128E-2*t346
++0.4677530128E-2*t347+0.2061233404E-3*t53-0.2061233404E-3*t285-0.5687628827E-3
+*t75-0.9761137487E-4*t338+0.9761137487E-4*t340-0.2369931678E-4*t350
++0.2369931678E-4*t355+0.1232237092E-6*t351-0.1232237092E-6*t352;
+    t357 = t355-t350;
+    t358 = IGM_SIN_Q(16);
+    t359 = 0.8051018213E-4*t357*t358-0.7932620886E-4*t283*t311+0.8945848979E-4
+*t61*t266-0.8945848979E-4*t52*t264+0.2606799616E-2*t348*t354+0.2606799616E-2
+*t353*t349+0.1078086072E-3*t304+0.7932620886E-4*t357*t345-0.7932620886E-4*t344
+*t358-0.2570662873E-4*t252-0.2570662873E-4*t255-0.9381437244E-4*t272
++0.9381437244E-4*t271;
+    t360 = 0.4677530128E-2*t258+0.4677530128E-2*t260-0.8503258945E-4*t277
++0.8503258945E-4*t276-0.1702509553E-4*t308-0.1702509553E-4*t309+0.1232237092E-6
+*t280-0.1232237092E-6*t275-0.3696711277E-6*t265-0.3696711277E-6*t267
++0.3775495252E-3*t268*t319-0.8318061448E-1*t20+0.1078086072E-3*t24;
+    t361 = -(0.5687628827E-3*t27)-0.5687628827E-3*t28-0.9397174694E-4*t32
++0.5737222431E-5*t35+0.4122466806E-3*t47-0.4122466806E-3*t48-0.1607889161E-3
+*t42-0.1607889161E-3*t43-0.101865705E-2*t59+0.101865705E-2*t60-0.1660372087E-1
+*t46-0.6659098766E-1*t49+0.1512290733E-3*t293;
+    t362 = t137*t251;
+    t363 = t130*t254;
+    t364 = t362-t363;
+    t365 = t364*t257;
+    t366 = t128*t259;
+    t367 = t365+t366;
+    t368 = 0.1681938551E-1*t155-0.5687628827E-3*t153+0.1112574236E-3*t91
++0.4402844298E-1*t90+0.8799425961E-3*t96-0.1512290733E-3*t147-0.5687628827E-3
+*t152-0.8823452451E-4*t145+0.9970896939E-4*t142-0.1832763156E-3*t237
++0.9970896939E-4*t143+0.2606799616E-2*t367*t262-0.8799425961E-3*t165*t89;
+    t369 = t137*t254;
+    t370 = t130*t251;
+    t371 = -t370;
+    t372 = -t369+t371;
+    t373 = t372*t274;
+    t374 = t364*t259;
+    t375 = t128*t257;
+    t376 = t375-t374;
+    t377 = t376*t279;
+    t378 = t377-t373;
+    t379 = t378*t262;
+    t380 = t137*t326;
+    t381 = t130*t328;
+    t382 = t380-t381;
+    t383 = t382*t339;
+    t384 = t128*t337;
+    t385 = t383+t384;
+    t386 = t385*t349;
+    t387 = t137*t328;
+    t388 = t130*t326;
+    t389 = -t388;
+    t390 = -t387+t389;
+    t391 = t390*t342;
+    t392 = t382*t337;
+    t393 = t128*t339;
+    t394 = t393-t392;
+    t395 = t394*t333;
+    t396 = t395-t391;
+    t397 = t396*t354;
+    t398 = t397-t386;
+    t399 = 0.9419629563E-2*t157-0.2369931678E-4*t379+0.9999999999*t249
++0.7932620886E-4*t398*t345+0.2061233404E-3*t131+0.2061233404E-3*t129
++0.4122466806E-3*t123-0.101865705E-2*t135+0.9381437244E-4*t388+0.9381437244E-4
+*t387+0.8823452451E-4*t146-0.1232237092E-6*t395+0.1232237092E-6*t391;
+    t400 = t367*t269;
+    t401 = t379-t400;
+    t402 = t372*t279;
+    t403 = t137*t264;
+    t404 = 0.8051018213E-4*t401*t284-0.8945848979E-4*t128*t264-0.1702509553E-4
+*t402-0.3775495252E-3*t130*t263+0.5082624939E-2*t130*t319-0.3696711277E-6*t403
++0.1607889161E-3*t139+0.8051018213E-4*t398*t358-0.1607889161E-3*t140
+-0.2369931678E-4*t386-0.7932620886E-4*t401*t311+0.8503258945E-4*t374
++0.2369931678E-4*t400;
+    t405 = t390*t333;
+    t406 = 0.8799425961E-3*t162*t87+0.1512290733E-3*t144-0.1702509553E-4*t405
++0.2606799616E-2*t385*t354+0.1081557015E-2*t238*t235-0.2570662873E-4*t380
++0.2606799616E-2*t396*t349-0.1660372087E-1*t122-0.6659098766E-1*t125
++0.1112574236E-3*t238*t233+0.2570662873E-4*t381-0.1112574236E-3*t239*t235
+-0.1832763156E-3*t236;
+    t407 = t376*t274;
+    t408 = t402+t407;
+    t409 = t128*t266;
+    t410 = t403+t409;
+    t411 = t394*t342;
+    t412 = t405+t411;
+    t413 = 0.8051018213E-4*t408*t311-0.1232237092E-6*t373-0.1702509553E-4*t407
++0.3775495252E-3*t410*t319-0.7932620886E-4*t412*t358+0.2570662873E-4*t363
++0.9381437244E-4*t370+0.9381437244E-4*t369+0.2606799616E-2*t378*t269
++0.4677530128E-2*t384+0.9761137487E-4*t393-0.9761137487E-4*t392+0.1681938551E-1
+*t151;
+    t414 = 0.101865705E-2*t136-0.1607889161E-3*t119-0.1607889161E-3*t120
+-0.3024581465E-3*t112+0.3024581465E-3*t113+0.2893250095E-3*t100+0.2893250095E-3
+*t101-0.8318061448E-1*t103+0.1078086072E-3*t106-0.5687628827E-3*t108
+-0.5687628827E-3*t109-0.9397174694E-4*t111+0.5737222431E-5*t114;
+    t415 = 0.1832763156E-3*t93-0.4122466806E-3*t124+0.9332037043E-1*t95
++0.1832763156E-3*t92-0.9332037043E-1*t97+0.1078086072E-3*t105+0.8318061448E-1
+*t99+0.2369931678E-4*t397+0.4677530128E-2*t383+0.7932620886E-4*t408*t284
++0.1078086072E-3*t158+0.1232237092E-6*t377+0.1081557015E-2*t239*t233;
+    t416 = -(0.2893250095E-3*t164)-0.3696711277E-6*t409+0.5082624939E-2*t410
+*t263+0.8051018213E-4*t412*t345+0.4677530128E-2*t365-0.1078086072E-3*t159
++0.4677530128E-2*t366-0.8503258945E-4*t375-0.2570662873E-4*t362+0.2893250095E-3
+*t163-0.1702509553E-4*t411+0.9419629563E-2*t161+0.8945848979E-4*t137*t266;
+    t417 = t202+t203;
+    t418 = t212*t264;
+    t419 = t204*t266;
+    t420 = t418+t419;
+    t421 = t212*t326;
+    t422 = t417*t328;
+    t423 = t421+t422;
+    t424 = t423*t337;
+    t425 = t423*t339;
+    t426 = t204*t337;
+    t427 = t425+t426;
+    t428 = t427*t349;
+    t429 = t212*t328;
+    t430 = t417*t326;
+    t431 = t430-t429;
+    t432 = t431*t342;
+    t433 = t204*t339;
+    t434 = t433-t424;
+    t435 = t434*t333;
+    t436 = t435-t432;
+    t437 = t436*t354;
+    t438 = t437-t428;
+    t439 = t212*t254;
+    t440 = t417*t251;
+    t441 = t440-t439;
+    t442 = t441*t274;
+    t443 = t212*t251;
+    t444 = t417*t254;
+    t445 = t443+t444;
+    t446 = t445*t259;
+    t447 = t204*t257;
+    t448 = t447-t446;
+    t449 = t448*t279;
+    t450 = t449-t442;
+    t451 = t417*t31;
+    t452 = t451/2.0;
+    t453 = t207+t452;
+    t454 = t453*t64;
+    t455 = t454-t214;
+    t456 = t455*t58;
+    t457 = t445*t257;
+    t458 = t441*t279;
+    t459 = t450*t262;
+    t460 = -(0.5082624939E-2*t417*t319)-0.3696711277E-6*t418-0.3696711277E-6
+*t419+0.5082624939E-2*t420*t263-0.9761137487E-4*t424+0.7932620886E-4*t438*t345
++0.3775495252E-3*t417*t263+0.2606799616E-2*t450*t269+0.8823452451E-4*t456
++0.4677530128E-2*t457-0.1702509553E-4*t458-0.2369931678E-4*t459-0.2369931678E-4
+*t428;
+    t461 = t452-t207;
+    t462 = t461*t67;
+    t463 = t461*t58;
+    t464 = t455*t67;
+    t465 = (t463+t464)*t31;
+    t466 = t204*t259;
+    t467 = t457+t466;
+    t468 = t467*t269;
+    t469 = t453*t62;
+    t470 = t459-t468;
+    t471 = (t456-t462)*t31;
+    t472 = t223-t469;
+    t473 = t472*t78;
+    t474 = t472*t73;
+    t475 = t448*t274;
+    t476 = t458+t475;
+    t477 = 0.9970896939E-4*t463-0.8823452451E-4*t462+0.1232237092E-6*t449
++0.1512290733E-3*t465+0.2369931678E-4*t468-0.5687628827E-3*t469-0.7932620886E-4
+*t470*t311+0.1232237092E-6*t432-0.1512290733E-3*t471-0.5687628827E-3*t222
++0.1681938551E-1*t473-0.1078086072E-3*t474+0.7932620886E-4*t476*t284;
+    t478 = t465/2.0;
+    t479 = t471/2.0;
+    t480 = t478+t479;
+    t481 = t480*t78;
+    t482 = t480*t73;
+    t483 = 0.8945848979E-4*t212*t266-0.8945848979E-4*t204*t264+0.4677530128E-2
+*t466-0.8503258945E-4*t447-0.2570662873E-4*t443-0.9381437244E-4*t440
++0.9381437244E-4*t439+0.2606799616E-2*t467*t262+0.1078086072E-3*t481
++0.8051018213E-4*t438*t358+0.1681938551E-1*t482+0.1112574236E-3*t167
++0.4402844298E-1*t166;
+    t484 = t474-t481;
+    t485 = t484*t84;
+    t486 = t484*t81;
+    t487 = t431*t333;
+    t488 = 0.8799425961E-3*t172+0.9999999999*t250+0.9419629563E-2*t485
+-0.1660372087E-1*t198-0.6659098766E-1*t201+0.2061233404E-3*t205-0.2061233404E-3
+*t451-0.2893250095E-3*t486-0.2570662873E-4*t444+0.8051018213E-4*t470*t284
+-0.1702509553E-4*t487+0.2369931678E-4*t437+0.4677530128E-2*t425;
+    t489 = t482+t473;
+    t490 = t489*t84;
+    t491 = t486-t490;
+    t492 = t491*t87;
+    t493 = t489*t81;
+    t494 = t493+t485;
+    t495 = t434*t342;
+    t496 = t487+t495;
+    t497 = t479-t478;
+    t498 = 0.2606799616E-2*t427*t354+0.2893250095E-3*t490-0.1832763156E-3*t492
+-0.1232237092E-6*t435-0.8799425961E-3*t491*t89+0.9419629563E-2*t493
+-0.1607889161E-3*t454+0.1607889161E-3*t214-0.1702509553E-4*t475+0.9970896939E-4
+*t464+0.8799425961E-3*t494*t87-0.7932620886E-4*t496*t358+0.1081557015E-2*t497
+*t233;
+    t499 = 0.1832763156E-3*t169+0.9332037043E-1*t171+0.1832763156E-3*t168
+-0.9332037043E-1*t173+0.1078086072E-3*t181+0.8318061448E-1*t175-0.3024581465E-3
+*t188+0.3024581465E-3*t189+0.2893250095E-3*t176+0.2893250095E-3*t177
+-0.8318061448E-1*t179+0.1078086072E-3*t182-0.5687628827E-3*t184;
+    t500 = t494*t89;
+    t501 = -(0.5687628827E-3*t185)-0.9397174694E-4*t187+0.5737222431E-5*t190
+-0.4122466806E-3*t200-0.1607889161E-3*t195-0.1607889161E-3*t196+0.101865705E-2
+*t211+0.4122466806E-3*t199-0.101865705E-2*t210+0.8503258945E-4*t446
+-0.1112574236E-3*t497*t235-0.1832763156E-3*t500+0.8051018213E-4*t496*t345;
+    t502 = t500+t492;
+    t503 = 0.9761137487E-4*t433-0.1232237092E-6*t442-0.1702509553E-4*t495
++0.3775495252E-3*t420*t319+0.8051018213E-4*t476*t311-0.2570662873E-4*t421
++0.4677530128E-2*t426+0.1112574236E-3*t502*t233-0.2570662873E-4*t422
+-0.9381437244E-4*t430+0.9381437244E-4*t429+0.2606799616E-2*t436*t349
++0.1081557015E-2*t502*t235;
+    T[0] = t86*t87-t88*t89;
+    T[1] = t162*t87-t165*t89;
+    T[2] = t230*t87-t231*t89;
+    T[3] = IGM_CONST(0.0);
+    T[4] = t234*t235-t232*t233;
+    T[5] = t239*t235-t238*t233;
+    T[6] = t241*t235-t240*t233;
+    T[7] = IGM_CONST(0.0);
+    T[8] = -t242-t243;
+    T[9] = -t244-t245;
+    T[10] = -t246-t247;
+    T[11] = IGM_CONST(0.0);
+    T[12] = 0.4511E-1*t242+0.4511E-1*t243+0.10274*t82+0.10274*t85+0.1*t74+0.1
+*t79+0.5E-1*t46-0.5E-1*t49+0.1*t15-0.1*t20+0.10274*t9-0.10274*t12+0.4511E-1*t1
++t248;
+    T[13] = 0.4511E-1*t244+0.4511E-1*t245+0.10274*t157+0.10274*t161+0.1*t151
++0.1*t155+0.5E-1*t122-0.5E-1*t125+0.1*t99-0.1*t103+0.10274*t95-0.10274*t97
++0.4511E-1*t90+t249;
+    T[14] = 0.4511E-1*t246+0.4511E-1*t247+0.10274*t227+0.10274*t229+0.1*t221
++0.1*t225+0.5E-1*t198-0.5E-1*t201+0.1*t175-0.1*t179+0.10274*t171-0.10274*t173
++0.4511E-1*t166+t250;
+    T[15] = IGM_CONST(1.0);
+    A[0] = t313+t322+t325+t335+t356+t359+t360+t361;
+    A[1] = t368+t399+t404+t406+t413+t414+t415+t416;
+    A[2] = t460+t477+t483+t488+t498+t499+t501+t503;
+    return;
+  }
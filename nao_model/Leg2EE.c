@@ -1,2709 +1,52 @@
 /* Generated using codegen (2012-02-13, 17:03:54) */ 
 #include <math.h>
+#include "maple_double.h"
 void LLeg2RLeg(q,LL,T)
 double q[24];
 double LL[16];
 double T[16];
 {
-  double t1;
-  double t10;
-  double t101;
-  double t102;
-  double t103;
-  double t104;
-  double t105;
-  double t106;
-  double t107;
-  double t11;
-  double t110;
-  double t111;
-  double t112;
-  double t113;
-  double t114;
-  double t115;
-  double t119;
-  double t12;
-  double t120;
-  double t122;
-  double t124;
-  double t126;
-  double t127;
-  double t128;
-  double t129;
-  double t13;
-  double t130;
-  double t131;
-  double t134;
-  double t135;
-  double t136;
-  double t14;
-  double t140;
-  double t142;
-  double t147;
-  double t15;
-  double t151;
-  double t153;
-  double t156;
-  double t158;
-  double t16;
-  double t161;
-  double t165;
-  double t168;
-  double t17;
-  double t171;
-  double t173;
-  double t177;
-  double t18;
-  double t180;
-  double t182;
-  double t185;
-  double t189;
-  double t191;
-  double t192;
-  double t195;
-  double t196;
-  double t197;
-  double t198;
-  double t2;
-  double t201;
-  double t202;
-  double t203;
-  double t207;
-  double t209;
-  double t21;
-  double t211;
-  double t213;
-  double t214;
-  double t215;
-  double t216;
-  double t217;
-  double t218;
-  double t22;
-  double t221;
-  double t222;
-  double t223;
-  double t227;
-  double t229;
-  double t23;
-  double t234;
-  double t238;
-  double t24;
-  double t240;
-  double t243;
-  double t245;
-  double t248;
-  double t25;
-  double t252;
-  double t255;
-  double t258;
-  double t26;
-  double t260;
-  double t264;
-  double t267;
-  double t269;
-  double t272;
-  double t276;
-  double t278;
-  double t279;
-  double t282;
-  double t283;
-  double t284;
-  double t285;
-  double t288;
-  double t289;
-  double t290;
-  double t294;
-  double t298;
-  double t299;
-  double t3;
-  double t30;
-  double t300;
-  double t303;
-  double t304;
-  double t308;
-  double t31;
-  double t311;
-  double t315;
-  double t318;
-  double t320;
-  double t321;
-  double t322;
-  double t323;
-  double t324;
-  double t325;
-  double t33;
-  double t34;
-  double t35;
-  double t40;
-  double t41;
-  double t45;
-  double t47;
-  double t48;
-  double t49;
-  double t5;
-  double t52;
-  double t53;
-  double t55;
-  double t56;
-  double t59;
-  double t6;
-  double t63;
-  double t66;
-  double t69;
-  double t71;
-  double t72;
-  double t73;
-  double t77;
-  double t78;
-  double t79;
-  double t8;
-  double t82;
-  double t83;
-  double t85;
-  double t86;
-  double t89;
-  double t9;
-  double t93;
-  double t95;
-  double t96;
-  double t97;
-  double t98;
-  {
-    t1 = LL[8];
-    t2 = q[5];
-    t3 = cos(t2);
-    t5 = LL[4];
-    t6 = sin(t2);
-    t8 = t1*t3+t5*t6;
-    t9 = q[4];
-    t10 = cos(t9);
-    t11 = t8*t10;
-    t12 = LL[0];
-    t13 = sin(t9);
-    t14 = t12*t13;
-    t15 = t11-t14;
-    t16 = q[3];
-    t17 = cos(t16);
-    t18 = t15*t17;
-    t21 = t8*t13+t12*t10;
-    t22 = sin(t16);
-    t23 = t21*t22;
-    t24 = t18-t23;
-    t25 = q[2];
-    t26 = sin(t25);
-    t30 = t15*t22+t21*t17;
-    t31 = cos(t25);
-    t33 = t24*t26+t30*t31;
-    t34 = q[0];
-    t35 = sin(t34);
-    t40 = sqrt(2.0);
-    t41 = (t24*t31-t30*t26)*t40;
-    t45 = (-t1*t6+t5*t3)*t40;
-    t47 = t41/2.0-t45/2.0;
-    t48 = q[1];
-    t49 = sin(t48);
-    t52 = -t41/2.0-t45/2.0;
-    t53 = cos(t48);
-    t55 = t47*t49+t52*t53;
-    t56 = cos(t34);
-    t59 = (t33*t35+t55*t56)*t40;
-    t63 = (-t47*t53+t52*t49)*t40;
-    t66 = (-t59/2.0+t63/2.0)*t40;
-    t69 = (-t59/2.0-t63/2.0)*t40;
-    t71 = -t66/2.0-t69/2.0;
-    t72 = q[7];
-    t73 = cos(t72);
-    t77 = t33*t56-t55*t35;
-    t78 = q[6];
-    t79 = sin(t78);
-    t82 = t66/2.0-t69/2.0;
-    t83 = cos(t78);
-    t85 = -t77*t79+t82*t83;
-    t86 = sin(t72);
-    t89 = (t71*t73+t85*t86)*t40;
-    t93 = (-t71*t86+t85*t73)*t40;
-    t95 = t89/2.0+t93/2.0;
-    t96 = q[8];
-    t97 = cos(t96);
-    t98 = t95*t97;
-    t101 = -t77*t83-t82*t79;
-    t102 = sin(t96);
-    t103 = t101*t102;
-    t104 = t98+t103;
-    t105 = q[9];
-    t106 = cos(t105);
-    t107 = t104*t106;
-    t110 = -t95*t102+t101*t97;
-    t111 = sin(t105);
-    t112 = t110*t111;
-    t113 = t107+t112;
-    t114 = q[10];
-    t115 = sin(t114);
-    t119 = -t104*t111+t110*t106;
-    t120 = cos(t114);
-    T[0] = t113*t115-t119*t120;
-    t122 = LL[9];
-    t124 = LL[5];
-    t126 = t122*t3+t124*t6;
-    t127 = t126*t10;
-    t128 = LL[1];
-    t129 = t128*t13;
-    t130 = t127-t129;
-    t131 = t130*t17;
-    t134 = t126*t13+t128*t10;
-    t135 = t134*t22;
-    t136 = t131-t135;
-    t140 = t130*t22+t134*t17;
-    t142 = t136*t26+t140*t31;
-    t147 = (t136*t31-t140*t26)*t40;
-    t151 = (-t122*t6+t124*t3)*t40;
-    t153 = t147/2.0-t151/2.0;
-    t156 = -t147/2.0-t151/2.0;
-    t158 = t153*t49+t156*t53;
-    t161 = (t142*t35+t158*t56)*t40;
-    t165 = (-t153*t53+t156*t49)*t40;
-    t168 = (-t161/2.0+t165/2.0)*t40;
-    t171 = (-t161/2.0-t165/2.0)*t40;
-    t173 = -t168/2.0-t171/2.0;
-    t177 = t142*t56-t158*t35;
-    t180 = t168/2.0-t171/2.0;
-    t182 = -t177*t79+t180*t83;
-    t185 = (t173*t73+t182*t86)*t40;
-    t189 = (-t173*t86+t182*t73)*t40;
-    t191 = t185/2.0+t189/2.0;
-    t192 = t191*t97;
-    t195 = -t177*t83-t180*t79;
-    t196 = t195*t102;
-    t197 = t192+t196;
-    t198 = t197*t106;
-    t201 = -t191*t102+t195*t97;
-    t202 = t201*t111;
-    t203 = t198+t202;
-    t207 = -t197*t111+t201*t106;
-    T[1] = t203*t115-t207*t120;
-    t209 = LL[10];
-    t211 = LL[6];
-    t213 = t209*t3+t211*t6;
-    t214 = t213*t10;
-    t215 = LL[2];
-    t216 = t215*t13;
-    t217 = t214-t216;
-    t218 = t217*t17;
-    t221 = t213*t13+t215*t10;
-    t222 = t221*t22;
-    t223 = t218-t222;
-    t227 = t217*t22+t221*t17;
-    t229 = t223*t26+t227*t31;
-    t234 = (t223*t31-t227*t26)*t40;
-    t238 = (-t209*t6+t211*t3)*t40;
-    t240 = t234/2.0-t238/2.0;
-    t243 = -t234/2.0-t238/2.0;
-    t245 = t240*t49+t243*t53;
-    t248 = (t229*t35+t245*t56)*t40;
-    t252 = (-t240*t53+t243*t49)*t40;
-    t255 = (-t248/2.0+t252/2.0)*t40;
-    t258 = (-t248/2.0-t252/2.0)*t40;
-    t260 = -t255/2.0-t258/2.0;
-    t264 = t229*t56-t245*t35;
-    t267 = t255/2.0-t258/2.0;
-    t269 = -t264*t79+t267*t83;
-    t272 = (t260*t73+t269*t86)*t40;
-    t276 = (-t260*t86+t269*t73)*t40;
-    t278 = t272/2.0+t276/2.0;
-    t279 = t278*t97;
-    t282 = -t264*t83-t267*t79;
-    t283 = t282*t102;
-    t284 = t279+t283;
-    t285 = t284*t106;
-    t288 = -t278*t102+t282*t97;
-    t289 = t288*t111;
-    t290 = t285+t289;
-    t294 = -t284*t111+t288*t106;
-    T[2] = t290*t115-t294*t120;
-    T[3] = 0.0;
-    t298 = t113*t120+t119*t115;
-    t299 = q[11];
-    t300 = sin(t299);
-    t303 = -t89/2.0+t93/2.0;
-    t304 = cos(t299);
-    T[4] = -t298*t300+t303*t304;
-    t308 = t203*t120+t207*t115;
-    t311 = -t185/2.0+t189/2.0;
-    T[5] = -t308*t300+t311*t304;
-    t315 = t290*t120+t294*t115;
-    t318 = -t272/2.0+t276/2.0;
-    T[6] = -t315*t300+t318*t304;
-    T[7] = 0.0;
-    t320 = t298*t304;
-    t321 = t303*t300;
-    T[8] = -t320-t321;
-    t322 = t308*t304;
-    t323 = t311*t300;
-    T[9] = -t322-t323;
-    t324 = t315*t304;
-    t325 = t318*t300;
-    T[10] = -t324-t325;
-    T[11] = 0.0;
-    T[12] = 0.4511E-1*t320+0.4511E-1*t321+0.10274*t107+0.10274*t112+0.1*t98+0.1
-*t103+0.5E-1*t59-0.5E-1*t63+0.1*t18-0.1*t23+0.10274*t11-0.10274*t14+0.4511E-1*
-t1+LL[12];
-    T[13] = 0.4511E-1*t322+0.4511E-1*t323+0.10274*t198+0.10274*t202+0.1*t192+
-0.1*t196+0.5E-1*t161-0.5E-1*t165+0.1*t131-0.1*t135+0.10274*t127-0.10274*t129+
-0.4511E-1*t122+LL[13];
-    T[14] = 0.4511E-1*t324+0.4511E-1*t325+0.10274*t285+0.10274*t289+0.1*t279+
-0.1*t283+0.5E-1*t248-0.5E-1*t252+0.1*t218-0.1*t222+0.10274*t214-0.10274*t216+
-0.4511E-1*t209+LL[14];
-    T[15] = 1.0;
-    return;
-  }
+#include "LLeg2RLeg_body.h"
 }
 
-
-#include <math.h>
 void LLeg2CoM(q,LL,A)
 double q[24];
 double LL[16];
 double A[3];
 {
-  double t10;
-  double t100;
-  double t101;
-  double t102;
-  double t103;
-  double t104;
-  double t105;
-  double t106;
-  double t107;
-  double t108;
-  double t109;
-  double t11;
-  double t110;
-  double t111;
-  double t112;
-  double t113;
-  double t114;
-  double t115;
-  double t116;
-  double t117;
-  double t12;
-  double t120;
-  double t122;
-  double t124;
-  double t125;
-  double t126;
-  double t127;
-  double t128;
-  double t129;
-  double t13;
-  double t130;
-  double t132;
-  double t133;
-  double t134;
-  double t135;
-  double t136;
-  double t137;
-  double t139;
-  double t14;
-  double t140;
-  double t141;
-  double t143;
-  double t145;
-  double t146;
-  double t147;
-  double t148;
-  double t15;
-  double t150;
-  double t151;
-  double t152;
-  double t153;
-  double t154;
-  double t156;
-  double t157;
-  double t158;
-  double t159;
-  double t16;
-  double t160;
-  double t161;
-  double t163;
-  double t164;
-  double t165;
-  double t166;
-  double t17;
-  double t173;
-  double t174;
-  double t176;
-  double t18;
-  double t181;
-  double t182;
-  double t184;
-  double t185;
-  double t186;
-  double t187;
-  double t188;
-  double t19;
-  double t190;
-  double t193;
-  double t194;
-  double t195;
-  double t2;
-  double t20;
-  double t206;
-  double t209;
-  double t21;
-  double t210;
-  double t211;
-  double t215;
-  double t216;
-  double t22;
-  double t23;
-  double t230;
-  double t24;
-  double t241;
-  double t242;
-  double t243;
-  double t245;
-  double t246;
-  double t248;
-  double t25;
-  double t250;
-  double t252;
-  double t253;
-  double t254;
-  double t255;
-  double t257;
-  double t26;
-  double t260;
-  double t261;
-  double t262;
-  double t263;
-  double t264;
-  double t265;
-  double t266;
-  double t267;
-  double t268;
-  double t27;
-  double t270;
-  double t271;
-  double t272;
-  double t275;
-  double t277;
-  double t28;
-  double t284;
-  double t285;
-  double t286;
-  double t287;
-  double t289;
-  double t29;
-  double t290;
-  double t291;
-  double t292;
-  double t293;
-  double t297;
-  double t298;
-  double t299;
-  double t3;
-  double t30;
-  double t31;
-  double t32;
-  double t321;
-  double t33;
-  double t337;
-  double t34;
-  double t35;
-  double t351;
-  double t354;
-  double t355;
-  double t356;
-  double t357;
-  double t358;
-  double t359;
-  double t36;
-  double t360;
-  double t361;
-  double t362;
-  double t363;
-  double t364;
-  double t365;
-  double t366;
-  double t367;
-  double t368;
-  double t369;
-  double t37;
-  double t370;
-  double t371;
-  double t372;
-  double t373;
-  double t374;
-  double t375;
-  double t379;
-  double t380;
-  double t381;
-  double t383;
-  double t385;
-  double t386;
-  double t388;
-  double t389;
-  double t390;
-  double t391;
-  double t392;
-  double t393;
-  double t397;
-  double t398;
-  double t399;
-  double t4;
-  double t401;
-  double t403;
-  double t404;
-  double t406;
-  double t407;
-  double t409;
-  double t41;
-  double t410;
-  double t411;
-  double t412;
-  double t419;
-  double t42;
-  double t420;
-  double t421;
-  double t422;
-  double t423;
-  double t424;
-  double t426;
-  double t43;
-  double t430;
-  double t432;
-  double t434;
-  double t436;
-  double t437;
-  double t438;
-  double t439;
-  double t44;
-  double t440;
-  double t441;
-  double t442;
-  double t443;
-  double t444;
-  double t445;
-  double t448;
-  double t449;
-  double t450;
-  double t451;
-  double t452;
-  double t453;
-  double t454;
-  double t459;
-  double t46;
-  double t460;
-  double t462;
-  double t463;
-  double t464;
-  double t465;
-  double t466;
-  double t467;
-  double t468;
-  double t469;
-  double t470;
-  double t471;
-  double t475;
-  double t476;
-  double t477;
-  double t478;
-  double t479;
-  double t48;
-  double t480;
-  double t481;
-  double t482;
-  double t483;
-  double t484;
-  double t485;
-  double t486;
-  double t487;
-  double t488;
-  double t489;
-  double t49;
-  double t490;
-  double t491;
-  double t492;
-  double t5;
-  double t50;
-  double t504;
-  double t506;
-  double t507;
-  double t51;
-  double t512;
-  double t518;
-  double t529;
-  double t53;
-  double t530;
-  double t531;
-  double t535;
-  double t539;
-  double t54;
-  double t540;
-  double t55;
-  double t552;
-  double t556;
-  double t56;
-  double t560;
-  double t561;
-  double t565;
-  double t566;
-  double t569;
-  double t57;
-  double t570;
-  double t58;
-  double t582;
-  double t59;
-  double t596;
-  double t6;
-  double t60;
-  double t61;
-  double t613;
-  double t62;
-  double t630;
-  double t633;
-  double t634;
-  double t635;
-  double t636;
-  double t637;
-  double t638;
-  double t639;
-  double t640;
-  double t641;
-  double t642;
-  double t643;
-  double t644;
-  double t645;
-  double t646;
-  double t647;
-  double t648;
-  double t649;
-  double t650;
-  double t651;
-  double t652;
-  double t653;
-  double t658;
-  double t659;
-  double t66;
-  double t660;
-  double t662;
-  double t664;
-  double t665;
-  double t667;
-  double t668;
-  double t669;
-  double t67;
-  double t672;
-  double t673;
-  double t674;
-  double t676;
-  double t678;
-  double t68;
-  double t681;
-  double t682;
-  double t683;
-  double t684;
-  double t687;
-  double t688;
-  double t690;
-  double t693;
-  double t694;
-  double t695;
-  double t696;
-  double t698;
-  double t699;
-  double t7;
-  double t70;
-  double t700;
-  double t701;
-  double t702;
-  double t703;
-  double t704;
-  double t705;
-  double t706;
-  double t707;
-  double t708;
-  double t709;
-  double t710;
-  double t711;
-  double t716;
-  double t717;
-  double t718;
-  double t719;
-  double t72;
-  double t720;
-  double t721;
-  double t722;
-  double t723;
-  double t724;
-  double t725;
-  double t726;
-  double t727;
-  double t73;
-  double t730;
-  double t731;
-  double t733;
-  double t735;
-  double t736;
-  double t737;
-  double t738;
-  double t74;
-  double t740;
-  double t742;
-  double t744;
-  double t747;
-  double t749;
-  double t75;
-  double t750;
-  double t752;
-  double t755;
-  double t757;
-  double t759;
-  double t76;
-  double t760;
-  double t761;
-  double t763;
-  double t765;
-  double t77;
-  double t770;
-  double t772;
-  double t774;
-  double t775;
-  double t777;
-  double t779;
-  double t78;
-  double t780;
-  double t783;
-  double t797;
-  double t798;
-  double t8;
-  double t80;
-  double t802;
-  double t806;
-  double t81;
-  double t810;
-  double t811;
-  double t817;
-  double t82;
-  double t822;
-  double t826;
-  double t83;
-  double t831;
-  double t832;
-  double t834;
-  double t835;
-  double t84;
-  double t840;
-  double t846;
-  double t849;
-  double t85;
-  double t850;
-  double t854;
-  double t857;
-  double t871;
-  double t88;
-  double t885;
-  double t889;
-  double t89;
-  double t899;
-  double t9;
-  double t909;
-  double t92;
-  double t93;
-  double t94;
-  double t95;
-  double t96;
-  double t97;
-  {
-    t2 = LL[8];
-    t3 = q[5];
-    t4 = cos(t3);
-    t5 = t2*t4;
-    t6 = LL[4];
-    t7 = sin(t3);
-    t8 = t6*t7;
-    t9 = t5+t8;
-    t10 = q[4];
-    t11 = cos(t10);
-    t12 = t9*t11;
-    t13 = LL[0];
-    t14 = sin(t10);
-    t15 = t13*t14;
-    t16 = t12-t15;
-    t17 = q[3];
-    t18 = cos(t17);
-    t19 = t16*t18;
-    t20 = t9*t14;
-    t21 = t13*t11;
-    t22 = t20+t21;
-    t23 = sin(t17);
-    t24 = t22*t23;
-    t25 = t19-t24;
-    t26 = q[2];
-    t27 = sin(t26);
-    t28 = t25*t27;
-    t29 = t16*t23;
-    t30 = t22*t18;
-    t31 = t29+t30;
-    t32 = cos(t26);
-    t33 = t31*t32;
-    t34 = t28+t33;
-    t35 = q[0];
-    t36 = cos(t35);
-    t37 = t34*t36;
-    t41 = sqrt(2.0);
-    t42 = (t25*t32-t31*t27)*t41;
-    t43 = t2*t7;
-    t44 = t6*t4;
-    t46 = (-t43+t44)*t41;
-    t48 = t42/2.0-t46/2.0;
-    t49 = q[1];
-    t50 = sin(t49);
-    t51 = t48*t50;
-    t53 = -t42/2.0-t46/2.0;
-    t54 = cos(t49);
-    t55 = t53*t54;
-    t56 = t51+t55;
-    t57 = sin(t35);
-    t58 = t56*t57;
-    t59 = t37-t58;
-    t60 = q[17];
-    t61 = cos(t60);
-    t62 = t59*t61;
-    t66 = (t34*t57+t56*t36)*t41;
-    t67 = t48*t54;
-    t68 = t53*t50;
-    t70 = (-t67+t68)*t41;
-    t72 = t66/2.0+t70/2.0;
-    t73 = sin(t60);
-    t74 = t72*t73;
-    t75 = t62+t74;
-    t76 = q[18];
-    t77 = cos(t76);
-    t78 = t75*t77;
-    t80 = -t66/2.0+t70/2.0;
-    t81 = sin(t76);
-    t82 = t80*t81;
-    t83 = t78+t82;
-    t84 = q[20];
-    t85 = cos(t84);
-    t88 = q[23];
-    t89 = sin(t88);
-    t92 = q[22];
-    t93 = cos(t92);
-    t94 = t59*t93;
-    t95 = sin(t92);
-    t96 = t80*t95;
-    t97 = t94+t96;
-    t100 = sin(t84);
-    t101 = t83*t100;
-    t102 = t59*t73;
-    t103 = t72*t61;
-    t104 = -t102+t103;
-    t105 = q[19];
-    t106 = sin(t105);
-    t107 = t104*t106;
-    t108 = t75*t81;
-    t109 = t80*t77;
-    t110 = -t108+t109;
-    t111 = cos(t105);
-    t112 = t110*t111;
-    t113 = -t107+t112;
-    t114 = t113*t85;
-    t115 = -t101+t114;
-    t116 = q[21];
-    t117 = sin(t116);
-    t120 = t80*t41;
-    t122 = -t72*t41;
-    t124 = -t120/2.0-t122/2.0;
-    t125 = q[7];
-    t126 = cos(t125);
-    t127 = t124*t126;
-    t128 = q[6];
-    t129 = sin(t128);
-    t130 = t59*t129;
-    t132 = t120/2.0-t122/2.0;
-    t133 = cos(t128);
-    t134 = t132*t133;
-    t135 = -t130+t134;
-    t136 = sin(t125);
-    t137 = t135*t136;
-    t139 = (t127+t137)*t41;
-    t140 = t124*t136;
-    t141 = t135*t126;
-    t143 = (-t140+t141)*t41;
-    t145 = t139/2.0+t143/2.0;
-    t146 = q[8];
-    t147 = cos(t146);
-    t148 = t145*t147;
-    t150 = t59*t133;
-    t151 = t132*t129;
-    t152 = -t150-t151;
-    t153 = sin(t146);
-    t154 = t152*t153;
-    t156 = t145*t153;
-    t157 = t152*t147;
-    t158 = -t156+t157;
-    t159 = q[9];
-    t160 = sin(t159);
-    t161 = t158*t160;
-    t163 = t104*t111;
-    t164 = t110*t106;
-    t165 = t163+t164;
-    t166 = cos(t116);
-    t173 = cos(t159);
-    t174 = t158*t173;
-    t176 = 0.2606799616E-2*t83*t85+0.3775495252E-3*t72*t89+0.5082624939E-2*t97*
-t89+0.8051018213E-4*t115*t117+0.1681938551E-1*t148+0.1681938551E-1*t154+
-0.9419629563E-2*t161+0.8051018213E-4*t165*t166-0.5687628827E-3*t151
--0.1607889161E-3*t134+0.1607889161E-3*t130-0.1512290733E-3*t143-0.2893250095E-3
-*t174;
-    t181 = t148+t154;
-    t182 = t181*t160;
-    t184 = t181*t173;
-    t185 = t184+t161;
-    t186 = q[10];
-    t187 = cos(t186);
-    t188 = t185*t187;
-    t190 = cos(t88);
-    t193 = -t182+t174;
-    t194 = sin(t186);
-    t195 = t193*t194;
-    t206 = 0.7932620886E-4*t165*t117-0.2369931678E-4*t114+0.2369931678E-4*t101+
-0.2893250095E-3*t182-0.1832763156E-3*t188-0.5082624939E-2*t72*t190
--0.1832763156E-3*t195-0.1078086072E-3*t157+0.9970896939E-4*t137+0.2606799616E-2
-*t113*t100-0.8799425961E-3*t193*t187+0.8799425961E-3*t185*t194+0.8823452451E-4*
-t141;
-    t209 = t188+t195;
-    t210 = q[11];
-    t211 = cos(t210);
-    t215 = -t139/2.0+t143/2.0;
-    t216 = sin(t210);
-    t230 = -0.8823452451E-4*t140+0.1081557015E-2*t209*t211+0.1081557015E-2*t215
-*t216+0.9419629563E-2*t184-0.1112574236E-3*t215*t211+0.9970896939E-4*t127+
-0.1832763156E-3*t8+0.9332037043E-1*t12+0.1832763156E-3*t5-0.9332037043E-1*t15+
-0.1078086072E-3*t29-0.3024581465E-3*t43+0.3024581465E-3*t44;
-    t241 = q[12];
-    t242 = cos(t241);
-    t243 = t59*t242;
-    t245 = sin(t241);
-    t246 = t72*t245;
-    t248 = t72*t242;
-    t250 = t59*t245;
-    t252 = -t250+t248;
-    t253 = q[14];
-    t254 = cos(t253);
-    t255 = t252*t254;
-    t257 = 0.2893250095E-3*t20+0.2893250095E-3*t21+0.8318061448E-1*t19+
-0.1112574236E-3*t6+0.4402844298E-1*t2+0.8799425961E-3*t13+0.9999999999*LL[12]+
-0.1112574236E-3*t209*t216-0.2570662873E-4*t243-0.2570662873E-4*t246
--0.9381437244E-4*t248+0.9381437244E-4*t250-0.1702509553E-4*t255;
-    t260 = t243+t246;
-    t261 = q[13];
-    t262 = sin(t261);
-    t263 = t260*t262;
-    t264 = cos(t261);
-    t265 = t80*t264;
-    t266 = -t263+t265;
-    t267 = sin(t253);
-    t268 = t266*t267;
-    t270 = t255+t268;
-    t271 = q[16];
-    t272 = cos(t271);
-    t275 = t260*t264;
-    t277 = t80*t262;
-    t284 = t275+t277;
-    t285 = q[15];
-    t286 = sin(t285);
-    t287 = t284*t286;
-    t289 = t252*t267;
-    t290 = t266*t254;
-    t291 = -t289+t290;
-    t292 = cos(t285);
-    t293 = t291*t292;
-    t297 = -0.1702509553E-4*t268+0.8051018213E-4*t270*t272+0.4677530128E-2*t275
-+0.4677530128E-2*t277+0.2061233404E-3*t120+0.2061233404E-3*t122-0.5687628827E-3
-*t150-0.9761137487E-4*t263+0.9761137487E-4*t265-0.2369931678E-4*t287+
-0.2369931678E-4*t293+0.1232237092E-6*t289-0.1232237092E-6*t290;
-    t298 = -t287+t293;
-    t299 = sin(t271);
-    t321 = 0.8051018213E-4*t298*t299-0.7932620886E-4*t115*t166+0.8945848979E-4*
-t59*t95-0.8945848979E-4*t80*t93+0.2606799616E-2*t284*t292+0.2606799616E-2*t291*
-t286+0.1078086072E-3*t156+0.7932620886E-4*t298*t272-0.7932620886E-4*t270*t299
--0.2570662873E-4*t62-0.2570662873E-4*t74-0.9381437244E-4*t103+0.9381437244E-4*
-t102;
-    t337 = 0.4677530128E-2*t78+0.4677530128E-2*t82-0.8503258945E-4*t109+
-0.8503258945E-4*t108-0.1702509553E-4*t163-0.1702509553E-4*t164+0.1232237092E-6*
-t112-0.1232237092E-6*t107-0.3696711277E-6*t94-0.3696711277E-6*t96+
-0.3775495252E-3*t97*t190-0.8318061448E-1*t24+0.1078086072E-3*t30;
-    t351 = -0.5687628827E-3*t28-0.5687628827E-3*t33-0.9397174694E-4*t42+
-0.5737222431E-5*t46+0.4122466806E-3*t67-0.4122466806E-3*t68-0.1607889161E-3*t51
--0.1607889161E-3*t55-0.101865705E-2*t37+0.101865705E-2*t58-0.1660372087E-1*t66
--0.6659098766E-1*t70+0.1512290733E-3*t139;
-    A[0] = t176+t206+t230+t257+t297+t321+t337+t351;
-    t354 = LL[9];
-    t355 = t354*t4;
-    t356 = LL[5];
-    t357 = t356*t7;
-    t358 = t355+t357;
-    t359 = t358*t11;
-    t360 = LL[1];
-    t361 = t360*t14;
-    t362 = t359-t361;
-    t363 = t362*t18;
-    t364 = t358*t14;
-    t365 = t360*t11;
-    t366 = t364+t365;
-    t367 = t366*t23;
-    t368 = t363-t367;
-    t369 = t368*t27;
-    t370 = t362*t23;
-    t371 = t366*t18;
-    t372 = t370+t371;
-    t373 = t372*t32;
-    t374 = t369+t373;
-    t375 = t374*t36;
-    t379 = (t368*t32-t372*t27)*t41;
-    t380 = t354*t7;
-    t381 = t356*t4;
-    t383 = (-t380+t381)*t41;
-    t385 = t379/2.0-t383/2.0;
-    t386 = t385*t50;
-    t388 = -t379/2.0-t383/2.0;
-    t389 = t388*t54;
-    t390 = t386+t389;
-    t391 = t390*t57;
-    t392 = t375-t391;
-    t393 = t392*t133;
-    t397 = (t374*t57+t390*t36)*t41;
-    t398 = t385*t54;
-    t399 = t388*t50;
-    t401 = (-t398+t399)*t41;
-    t403 = -t397/2.0+t401/2.0;
-    t404 = t403*t41;
-    t406 = -t397/2.0-t401/2.0;
-    t407 = t406*t41;
-    t409 = t404/2.0-t407/2.0;
-    t410 = t409*t129;
-    t411 = -t393-t410;
-    t412 = t411*t153;
-    t419 = -t404/2.0-t407/2.0;
-    t420 = t419*t136;
-    t421 = t392*t129;
-    t422 = t409*t133;
-    t423 = -t421+t422;
-    t424 = t423*t126;
-    t426 = (-t420+t424)*t41;
-    t430 = t419*t126;
-    t432 = t423*t136;
-    t434 = (t430+t432)*t41;
-    t436 = t434/2.0+t426/2.0;
-    t437 = t436*t147;
-    t438 = t437+t412;
-    t439 = t438*t160;
-    t440 = t436*t153;
-    t441 = t411*t147;
-    t442 = -t440+t441;
-    t443 = t442*t173;
-    t444 = -t439+t443;
-    t445 = t444*t194;
-    t448 = t392*t61;
-    t449 = -t406;
-    t450 = t449*t73;
-    t451 = t448+t450;
-    t452 = t451*t77;
-    t453 = t403*t81;
-    t454 = t452+t453;
-    t459 = 0.1681938551E-1*t412-0.5687628827E-3*t410+0.1112574236E-3*t356+
-0.4402844298E-1*t354+0.8799425961E-3*t360-0.1512290733E-3*t426-0.5687628827E-3*
-t393-0.8823452451E-4*t420+0.9970896939E-4*t430-0.1832763156E-3*t445+
-0.9970896939E-4*t432+0.2606799616E-2*t454*t85-0.8799425961E-3*t444*t187;
-    t460 = t438*t173;
-    t462 = t392*t73;
-    t463 = t449*t61;
-    t464 = -t462+t463;
-    t465 = t464*t106;
-    t466 = t451*t81;
-    t467 = t403*t77;
-    t468 = -t466+t467;
-    t469 = t468*t111;
-    t470 = -t465+t469;
-    t471 = t470*t85;
-    t475 = t392*t242;
-    t476 = t449*t245;
-    t477 = t475+t476;
-    t478 = t477*t264;
-    t479 = t403*t262;
-    t480 = t478+t479;
-    t481 = t480*t286;
-    t482 = t392*t245;
-    t483 = t449*t242;
-    t484 = -t482+t483;
-    t485 = t484*t267;
-    t486 = t477*t262;
-    t487 = t403*t264;
-    t488 = -t486+t487;
-    t489 = t488*t254;
-    t490 = -t485+t489;
-    t491 = t490*t292;
-    t492 = -t481+t491;
-    t504 = 0.9419629563E-2*t460-0.2369931678E-4*t471+0.9999999999*LL[13]+
-0.7932620886E-4*t492*t272+0.2061233404E-3*t407+0.2061233404E-3*t404+
-0.4122466806E-3*t398-0.101865705E-2*t375-0.9381437244E-4*t483+0.9381437244E-4*
-t482+0.8823452451E-4*t424-0.1232237092E-6*t489+0.1232237092E-6*t485;
-    t506 = t454*t100;
-    t507 = -t506+t471;
-    t512 = t464*t111;
-    t518 = t392*t93;
-    t529 = 0.8051018213E-4*t507*t117-0.8945848979E-4*t403*t93-0.1702509553E-4*
-t512+0.3775495252E-3*t449*t89-0.5082624939E-2*t449*t190-0.3696711277E-6*t518+
-0.1607889161E-3*t421+0.8051018213E-4*t492*t299-0.1607889161E-3*t422
--0.2369931678E-4*t481-0.7932620886E-4*t507*t166+0.8503258945E-4*t466+
-0.2369931678E-4*t506;
-    t530 = t442*t160;
-    t531 = t460+t530;
-    t535 = t484*t254;
-    t539 = t531*t187;
-    t540 = t539+t445;
-    t552 = -t434/2.0+t426/2.0;
-    t556 = 0.8799425961E-3*t531*t194+0.1512290733E-3*t434-0.1702509553E-4*t535+
-0.2606799616E-2*t480*t292+0.1081557015E-2*t540*t211-0.2570662873E-4*t475+
-0.2606799616E-2*t490*t286-0.1660372087E-1*t397-0.6659098766E-1*t401+
-0.1112574236E-3*t540*t216-0.2570662873E-4*t476-0.1112574236E-3*t552*t211
--0.1832763156E-3*t539;
-    t560 = t468*t106;
-    t561 = t512+t560;
-    t565 = t403*t95;
-    t566 = t518+t565;
-    t569 = t488*t267;
-    t570 = t535+t569;
-    t582 = -0.1232237092E-6*t465+0.8051018213E-4*t561*t166-0.1702509553E-4*t560
-+0.3775495252E-3*t566*t190-0.7932620886E-4*t570*t299-0.2570662873E-4*t450
--0.9381437244E-4*t463+0.9381437244E-4*t462+0.2606799616E-2*t470*t100+
-0.4677530128E-2*t479+0.9761137487E-4*t487-0.9761137487E-4*t486+0.1681938551E-1*
-t437;
-    t596 = 0.101865705E-2*t391-0.1607889161E-3*t386-0.1607889161E-3*t389
--0.3024581465E-3*t380+0.3024581465E-3*t381+0.2893250095E-3*t364+0.2893250095E-3
-*t365-0.8318061448E-1*t367+0.1078086072E-3*t371-0.5687628827E-3*t369
--0.5687628827E-3*t373-0.9397174694E-4*t379+0.5737222431E-5*t383;
-    t613 = -0.4122466806E-3*t399+0.1832763156E-3*t357+0.9332037043E-1*t359+
-0.1832763156E-3*t355-0.9332037043E-1*t361+0.1078086072E-3*t370+0.8318061448E-1*
-t363+0.2369931678E-4*t491+0.4677530128E-2*t478+0.7932620886E-4*t561*t117+
-0.1078086072E-3*t440+0.1232237092E-6*t469+0.1081557015E-2*t552*t216;
-    t630 = -0.2893250095E-3*t443-0.3696711277E-6*t565+0.5082624939E-2*t566*t89+
-0.8051018213E-4*t570*t272+0.4677530128E-2*t452-0.1078086072E-3*t441+
-0.4677530128E-2*t453-0.8503258945E-4*t467-0.2570662873E-4*t448+0.2893250095E-3*
-t439-0.1702509553E-4*t569+0.9419629563E-2*t530+0.8945848979E-4*t392*t95;
-    A[1] = t459+t504+t529+t556+t582+t596+t613+t630;
-    t633 = LL[10];
-    t634 = t633*t4;
-    t635 = LL[6];
-    t636 = t635*t7;
-    t637 = t634+t636;
-    t638 = t637*t11;
-    t639 = LL[2];
-    t640 = t639*t14;
-    t641 = t638-t640;
-    t642 = t641*t18;
-    t643 = t637*t14;
-    t644 = t639*t11;
-    t645 = t643+t644;
-    t646 = t645*t23;
-    t647 = t642-t646;
-    t648 = t647*t27;
-    t649 = t641*t23;
-    t650 = t645*t18;
-    t651 = t649+t650;
-    t652 = t651*t32;
-    t653 = t648+t652;
-    t658 = (t647*t32-t651*t27)*t41;
-    t659 = t633*t7;
-    t660 = t635*t4;
-    t662 = (-t659+t660)*t41;
-    t664 = t658/2.0-t662/2.0;
-    t665 = t664*t50;
-    t667 = -t658/2.0-t662/2.0;
-    t668 = t667*t54;
-    t669 = t665+t668;
-    t672 = (t653*t57+t669*t36)*t41;
-    t673 = t664*t54;
-    t674 = t667*t50;
-    t676 = (-t673+t674)*t41;
-    t678 = t672/2.0+t676/2.0;
-    t681 = t653*t36;
-    t682 = t669*t57;
-    t683 = t681-t682;
-    t684 = t683*t93;
-    t687 = -t672/2.0+t676/2.0;
-    t688 = t687*t95;
-    t690 = t684+t688;
-    t693 = t683*t242;
-    t694 = t678*t245;
-    t695 = t693+t694;
-    t696 = t695*t262;
-    t698 = t695*t264;
-    t699 = t687*t262;
-    t700 = t698+t699;
-    t701 = t700*t286;
-    t702 = t683*t245;
-    t703 = t678*t242;
-    t704 = -t702+t703;
-    t705 = t704*t267;
-    t706 = t687*t264;
-    t707 = -t696+t706;
-    t708 = t707*t254;
-    t709 = -t705+t708;
-    t710 = t709*t292;
-    t711 = -t701+t710;
-    t716 = t683*t73;
-    t717 = t678*t61;
-    t718 = -t716+t717;
-    t719 = t718*t106;
-    t720 = t683*t61;
-    t721 = t678*t73;
-    t722 = t720+t721;
-    t723 = t722*t81;
-    t724 = t687*t77;
-    t725 = -t723+t724;
-    t726 = t725*t111;
-    t727 = -t719+t726;
-    t730 = t683*t129;
-    t731 = t687*t41;
-    t733 = -t678*t41;
-    t735 = t731/2.0-t733/2.0;
-    t736 = t735*t133;
-    t737 = -t730+t736;
-    t738 = t737*t126;
-    t740 = t722*t77;
-    t742 = t718*t111;
-    t744 = t727*t85;
-    t747 = -0.5082624939E-2*t678*t190-0.3696711277E-6*t684-0.3696711277E-6*t688
-+0.5082624939E-2*t690*t89-0.9761137487E-4*t696+0.7932620886E-4*t711*t272+
-0.3775495252E-3*t678*t89+0.2606799616E-2*t727*t100+0.8823452451E-4*t738+
-0.4677530128E-2*t740-0.1702509553E-4*t742-0.2369931678E-4*t744-0.2369931678E-4*
-t701;
-    t749 = -t731/2.0-t733/2.0;
-    t750 = t749*t136;
-    t752 = t749*t126;
-    t755 = t737*t136;
-    t757 = (t752+t755)*t41;
-    t759 = t687*t81;
-    t760 = t740+t759;
-    t761 = t760*t100;
-    t763 = t735*t129;
-    t765 = -t761+t744;
-    t770 = (-t750+t738)*t41;
-    t772 = t683*t133;
-    t774 = -t772-t763;
-    t775 = t774*t153;
-    t777 = t774*t147;
-    t779 = t725*t106;
-    t780 = t742+t779;
-    t783 = -0.8823452451E-4*t750+0.9970896939E-4*t752+0.1232237092E-6*t726+
-0.1512290733E-3*t757+0.2369931678E-4*t761-0.5687628827E-3*t763-0.7932620886E-4*
-t765*t166+0.1232237092E-6*t705-0.1512290733E-3*t770-0.5687628827E-3*t772+
-0.1681938551E-1*t775-0.1078086072E-3*t777+0.7932620886E-4*t780*t117;
-    t797 = t757/2.0+t770/2.0;
-    t798 = t797*t153;
-    t802 = t797*t147;
-    t806 = -0.8945848979E-4*t687*t93+0.8945848979E-4*t683*t95+0.4677530128E-2*
-t759-0.8503258945E-4*t724-0.2570662873E-4*t720-0.9381437244E-4*t717+
-0.9381437244E-4*t716+0.2606799616E-2*t760*t85+0.1078086072E-3*t798+
-0.8051018213E-4*t711*t299+0.1681938551E-1*t802+0.1112574236E-3*t635+
-0.4402844298E-1*t633;
-    t810 = -t798+t777;
-    t811 = t810*t160;
-    t817 = t810*t173;
-    t822 = t704*t254;
-    t826 = 0.8799425961E-3*t639+0.9999999999*LL[14]+0.9419629563E-2*t811
--0.1660372087E-1*t672-0.6659098766E-1*t676+0.2061233404E-3*t731+0.2061233404E-3
-*t733-0.2893250095E-3*t817-0.2570662873E-4*t721+0.8051018213E-4*t765*t117
--0.1702509553E-4*t822+0.2369931678E-4*t710+0.4677530128E-2*t698;
-    t831 = t802+t775;
-    t832 = t831*t160;
-    t834 = -t832+t817;
-    t835 = t834*t194;
-    t840 = t831*t173;
-    t846 = t840+t811;
-    t849 = t707*t267;
-    t850 = t822+t849;
-    t854 = -t757/2.0+t770/2.0;
-    t857 = 0.2606799616E-2*t700*t292+0.2893250095E-3*t832-0.1832763156E-3*t835
--0.1232237092E-6*t708-0.8799425961E-3*t834*t187+0.9419629563E-2*t840
--0.1607889161E-3*t736+0.1607889161E-3*t730-0.1702509553E-4*t779+0.9970896939E-4
-*t755+0.8799425961E-3*t846*t194-0.7932620886E-4*t850*t299+0.1081557015E-2*t854*
-t216;
-    t871 = 0.1832763156E-3*t636+0.9332037043E-1*t638+0.1832763156E-3*t634
--0.9332037043E-1*t640+0.1078086072E-3*t649+0.8318061448E-1*t642-0.3024581465E-3
-*t659+0.3024581465E-3*t660+0.2893250095E-3*t643+0.2893250095E-3*t644
--0.8318061448E-1*t646+0.1078086072E-3*t650-0.5687628827E-3*t648;
-    t885 = t846*t187;
-    t889 = -0.5687628827E-3*t652-0.9397174694E-4*t658+0.5737222431E-5*t662
--0.4122466806E-3*t674-0.1607889161E-3*t665-0.1607889161E-3*t668+0.101865705E-2*
-t682+0.4122466806E-3*t673-0.101865705E-2*t681+0.8503258945E-4*t723
--0.1112574236E-3*t854*t211-0.1832763156E-3*t885+0.8051018213E-4*t850*t272;
-    t899 = t885+t835;
-    t909 = -0.1232237092E-6*t719+0.9761137487E-4*t706-0.1702509553E-4*t849+
-0.3775495252E-3*t690*t190+0.8051018213E-4*t780*t166-0.2570662873E-4*t693+
-0.4677530128E-2*t699+0.1112574236E-3*t899*t216-0.2570662873E-4*t694
--0.9381437244E-4*t703+0.9381437244E-4*t702+0.2606799616E-2*t709*t286+
-0.1081557015E-2*t899*t211;
-    A[2] = t747+t783+t806+t826+t857+t871+t889+t909;
-    return;
-  }
+#include "LLeg2CoM_body.h"
 }
 
-#include <math.h>
 void RLeg2LLeg(q,RL,T)
 double q[24];
 double RL[16];
 double T[16];
 {
-  double t1;
-  double t10;
-  double t101;
-  double t102;
-  double t103;
-  double t104;
-  double t105;
-  double t106;
-  double t107;
-  double t11;
-  double t110;
-  double t111;
-  double t112;
-  double t113;
-  double t114;
-  double t115;
-  double t119;
-  double t12;
-  double t120;
-  double t122;
-  double t124;
-  double t126;
-  double t127;
-  double t128;
-  double t129;
-  double t13;
-  double t130;
-  double t131;
-  double t134;
-  double t135;
-  double t136;
-  double t14;
-  double t140;
-  double t142;
-  double t147;
-  double t15;
-  double t151;
-  double t153;
-  double t156;
-  double t158;
-  double t16;
-  double t161;
-  double t165;
-  double t168;
-  double t17;
-  double t171;
-  double t173;
-  double t177;
-  double t18;
-  double t180;
-  double t182;
-  double t185;
-  double t189;
-  double t191;
-  double t192;
-  double t195;
-  double t196;
-  double t197;
-  double t198;
-  double t2;
-  double t201;
-  double t202;
-  double t203;
-  double t207;
-  double t209;
-  double t21;
-  double t211;
-  double t213;
-  double t214;
-  double t215;
-  double t216;
-  double t217;
-  double t218;
-  double t22;
-  double t221;
-  double t222;
-  double t223;
-  double t227;
-  double t229;
-  double t23;
-  double t234;
-  double t238;
-  double t24;
-  double t240;
-  double t243;
-  double t245;
-  double t248;
-  double t25;
-  double t252;
-  double t255;
-  double t258;
-  double t26;
-  double t260;
-  double t264;
-  double t267;
-  double t269;
-  double t272;
-  double t276;
-  double t278;
-  double t279;
-  double t282;
-  double t283;
-  double t284;
-  double t285;
-  double t288;
-  double t289;
-  double t290;
-  double t294;
-  double t298;
-  double t299;
-  double t3;
-  double t30;
-  double t300;
-  double t303;
-  double t304;
-  double t308;
-  double t31;
-  double t311;
-  double t315;
-  double t318;
-  double t320;
-  double t321;
-  double t322;
-  double t323;
-  double t324;
-  double t325;
-  double t33;
-  double t34;
-  double t35;
-  double t40;
-  double t41;
-  double t45;
-  double t47;
-  double t48;
-  double t49;
-  double t5;
-  double t52;
-  double t53;
-  double t55;
-  double t56;
-  double t59;
-  double t6;
-  double t63;
-  double t66;
-  double t69;
-  double t71;
-  double t72;
-  double t73;
-  double t77;
-  double t78;
-  double t79;
-  double t8;
-  double t82;
-  double t83;
-  double t85;
-  double t86;
-  double t89;
-  double t9;
-  double t93;
-  double t95;
-  double t96;
-  double t97;
-  double t98;
-  {
-    t1 = RL[8];
-    t2 = q[11];
-    t3 = cos(t2);
-    t5 = RL[4];
-    t6 = sin(t2);
-    t8 = -t1*t3-t5*t6;
-    t9 = q[10];
-    t10 = cos(t9);
-    t11 = t8*t10;
-    t12 = RL[0];
-    t13 = sin(t9);
-    t14 = t12*t13;
-    t15 = t11+t14;
-    t16 = q[9];
-    t17 = cos(t16);
-    t18 = t15*t17;
-    t21 = t8*t13-t12*t10;
-    t22 = sin(t16);
-    t23 = t21*t22;
-    t24 = t18-t23;
-    t25 = q[8];
-    t26 = sin(t25);
-    t30 = t15*t22+t21*t17;
-    t31 = cos(t25);
-    t33 = -t24*t26-t30*t31;
-    t34 = q[6];
-    t35 = sin(t34);
-    t40 = sqrt(2.0);
-    t41 = (t24*t31-t30*t26)*t40;
-    t45 = (-t1*t6+t5*t3)*t40;
-    t47 = t41/2.0-t45/2.0;
-    t48 = q[7];
-    t49 = sin(t48);
-    t52 = t41/2.0+t45/2.0;
-    t53 = cos(t48);
-    t55 = t47*t49+t52*t53;
-    t56 = cos(t34);
-    t59 = (t33*t35+t55*t56)*t40;
-    t63 = (-t47*t53+t52*t49)*t40;
-    t66 = (t59/2.0+t63/2.0)*t40;
-    t69 = (-t59/2.0+t63/2.0)*t40;
-    t71 = -t66/2.0+t69/2.0;
-    t72 = q[1];
-    t73 = cos(t72);
-    t77 = t33*t56-t55*t35;
-    t78 = q[0];
-    t79 = sin(t78);
-    t82 = -t66/2.0-t69/2.0;
-    t83 = cos(t78);
-    t85 = -t77*t79+t82*t83;
-    t86 = sin(t72);
-    t89 = (t71*t73+t85*t86)*t40;
-    t93 = (-t71*t86+t85*t73)*t40;
-    t95 = t89/2.0-t93/2.0;
-    t96 = q[2];
-    t97 = cos(t96);
-    t98 = t95*t97;
-    t101 = t77*t83+t82*t79;
-    t102 = sin(t96);
-    t103 = t101*t102;
-    t104 = t98+t103;
-    t105 = q[3];
-    t106 = cos(t105);
-    t107 = t104*t106;
-    t110 = -t95*t102+t101*t97;
-    t111 = sin(t105);
-    t112 = t110*t111;
-    t113 = t107+t112;
-    t114 = q[4];
-    t115 = sin(t114);
-    t119 = -t104*t111+t110*t106;
-    t120 = cos(t114);
-    T[0] = -t113*t115+t119*t120;
-    t122 = RL[9];
-    t124 = RL[5];
-    t126 = -t122*t3-t124*t6;
-    t127 = t126*t10;
-    t128 = RL[1];
-    t129 = t128*t13;
-    t130 = t127+t129;
-    t131 = t130*t17;
-    t134 = t126*t13-t128*t10;
-    t135 = t134*t22;
-    t136 = t131-t135;
-    t140 = t130*t22+t134*t17;
-    t142 = -t136*t26-t140*t31;
-    t147 = (t136*t31-t140*t26)*t40;
-    t151 = (-t122*t6+t124*t3)*t40;
-    t153 = t147/2.0-t151/2.0;
-    t156 = t147/2.0+t151/2.0;
-    t158 = t153*t49+t156*t53;
-    t161 = (t142*t35+t158*t56)*t40;
-    t165 = (-t153*t53+t156*t49)*t40;
-    t168 = (t161/2.0+t165/2.0)*t40;
-    t171 = (-t161/2.0+t165/2.0)*t40;
-    t173 = -t168/2.0+t171/2.0;
-    t177 = t142*t56-t158*t35;
-    t180 = -t168/2.0-t171/2.0;
-    t182 = -t177*t79+t180*t83;
-    t185 = (t173*t73+t182*t86)*t40;
-    t189 = (-t173*t86+t182*t73)*t40;
-    t191 = t185/2.0-t189/2.0;
-    t192 = t191*t97;
-    t195 = t177*t83+t180*t79;
-    t196 = t195*t102;
-    t197 = t192+t196;
-    t198 = t197*t106;
-    t201 = -t191*t102+t195*t97;
-    t202 = t201*t111;
-    t203 = t198+t202;
-    t207 = -t197*t111+t201*t106;
-    T[1] = -t203*t115+t207*t120;
-    t209 = RL[10];
-    t211 = RL[6];
-    t213 = -t209*t3-t211*t6;
-    t214 = t213*t10;
-    t215 = RL[2];
-    t216 = t215*t13;
-    t217 = t214+t216;
-    t218 = t217*t17;
-    t221 = t213*t13-t215*t10;
-    t222 = t221*t22;
-    t223 = t218-t222;
-    t227 = t217*t22+t221*t17;
-    t229 = -t223*t26-t227*t31;
-    t234 = (t223*t31-t227*t26)*t40;
-    t238 = (-t209*t6+t211*t3)*t40;
-    t240 = t234/2.0-t238/2.0;
-    t243 = t234/2.0+t238/2.0;
-    t245 = t240*t49+t243*t53;
-    t248 = (t229*t35+t245*t56)*t40;
-    t252 = (-t240*t53+t243*t49)*t40;
-    t255 = (t248/2.0+t252/2.0)*t40;
-    t258 = (-t248/2.0+t252/2.0)*t40;
-    t260 = -t255/2.0+t258/2.0;
-    t264 = t229*t56-t245*t35;
-    t267 = -t255/2.0-t258/2.0;
-    t269 = -t264*t79+t267*t83;
-    t272 = (t260*t73+t269*t86)*t40;
-    t276 = (-t260*t86+t269*t73)*t40;
-    t278 = t272/2.0-t276/2.0;
-    t279 = t278*t97;
-    t282 = t264*t83+t267*t79;
-    t283 = t282*t102;
-    t284 = t279+t283;
-    t285 = t284*t106;
-    t288 = -t278*t102+t282*t97;
-    t289 = t288*t111;
-    t290 = t285+t289;
-    t294 = -t284*t111+t288*t106;
-    T[2] = -t290*t115+t294*t120;
-    T[3] = 0.0;
-    t298 = t113*t120+t119*t115;
-    t299 = q[5];
-    t300 = sin(t299);
-    t303 = t89/2.0+t93/2.0;
-    t304 = cos(t299);
-    T[4] = t298*t300-t303*t304;
-    t308 = t203*t120+t207*t115;
-    t311 = t185/2.0+t189/2.0;
-    T[5] = t308*t300-t311*t304;
-    t315 = t290*t120+t294*t115;
-    t318 = t272/2.0+t276/2.0;
-    T[6] = t315*t300-t318*t304;
-    T[7] = 0.0;
-    t320 = t298*t304;
-    t321 = t303*t300;
-    T[8] = t320+t321;
-    t322 = t308*t304;
-    t323 = t311*t300;
-    T[9] = t322+t323;
-    t324 = t315*t304;
-    t325 = t318*t300;
-    T[10] = t324+t325;
-    T[11] = 0.0;
-    T[12] = -0.4511E-1*t320-0.4511E-1*t321-0.10274*t107-0.10274*t112-0.1*t98
--0.1*t103+0.5E-1*t59+0.5E-1*t63-0.1*t18+0.1*t23-0.10274*t11-0.10274*t14+
-0.4511E-1*t1+RL[12];
-    T[13] = -0.4511E-1*t322-0.4511E-1*t323-0.10274*t198-0.10274*t202-0.1*t192
--0.1*t196+0.5E-1*t161+0.5E-1*t165-0.1*t131+0.1*t135-0.10274*t127-0.10274*t129+
-0.4511E-1*t122+RL[13];
-    T[14] = -0.4511E-1*t324-0.4511E-1*t325-0.10274*t285-0.10274*t289-0.1*t279
--0.1*t283+0.5E-1*t248+0.5E-1*t252-0.1*t218+0.1*t222-0.10274*t214-0.10274*t216+
-0.4511E-1*t209+RL[14];
-    T[15] = 1.0;
-    return;
-  }
+#include "RLeg2LLeg_body.h"
 }
 
-
-#include <math.h>
 void RLeg2CoM(q,RL,A)
 double q[24];
 double RL[16];
 double A[3];
 {
-  double t10;
-  double t100;
-  double t102;
-  double t104;
-  double t105;
-  double t106;
-  double t107;
-  double t108;
-  double t109;
-  double t11;
-  double t110;
-  double t111;
-  double t113;
-  double t114;
-  double t115;
-  double t116;
-  double t117;
-  double t118;
-  double t119;
-  double t12;
-  double t120;
-  double t122;
-  double t123;
-  double t124;
-  double t126;
-  double t127;
-  double t128;
-  double t129;
-  double t13;
-  double t130;
-  double t131;
-  double t132;
-  double t133;
-  double t134;
-  double t135;
-  double t136;
-  double t137;
-  double t14;
-  double t140;
-  double t142;
-  double t145;
-  double t146;
-  double t147;
-  double t148;
-  double t149;
-  double t15;
-  double t150;
-  double t151;
-  double t152;
-  double t153;
-  double t154;
-  double t155;
-  double t156;
-  double t157;
-  double t158;
-  double t159;
-  double t16;
-  double t160;
-  double t163;
-  double t165;
-  double t166;
-  double t167;
-  double t17;
-  double t170;
-  double t171;
-  double t172;
-  double t173;
-  double t174;
-  double t175;
-  double t176;
-  double t177;
-  double t178;
-  double t179;
-  double t18;
-  double t180;
-  double t181;
-  double t182;
-  double t183;
-  double t184;
-  double t185;
-  double t186;
-  double t187;
-  double t188;
-  double t189;
-  double t19;
-  double t190;
-  double t191;
-  double t192;
-  double t195;
-  double t196;
-  double t197;
-  double t198;
-  double t2;
-  double t20;
-  double t200;
-  double t201;
-  double t203;
-  double t207;
-  double t208;
-  double t21;
-  double t211;
-  double t212;
-  double t215;
-  double t216;
-  double t217;
-  double t218;
-  double t219;
-  double t22;
-  double t220;
-  double t221;
-  double t222;
-  double t223;
-  double t224;
-  double t225;
-  double t226;
-  double t23;
-  double t232;
-  double t233;
-  double t238;
-  double t24;
-  double t248;
-  double t25;
-  double t251;
-  double t252;
-  double t253;
-  double t254;
-  double t26;
-  double t260;
-  double t264;
-  double t27;
-  double t270;
-  double t279;
-  double t28;
-  double t285;
-  double t29;
-  double t3;
-  double t30;
-  double t302;
-  double t31;
-  double t316;
-  double t32;
-  double t33;
-  double t332;
-  double t34;
-  double t35;
-  double t351;
-  double t354;
-  double t355;
-  double t356;
-  double t357;
-  double t358;
-  double t359;
-  double t36;
-  double t360;
-  double t361;
-  double t362;
-  double t363;
-  double t364;
-  double t365;
-  double t366;
-  double t367;
-  double t368;
-  double t369;
-  double t37;
-  double t370;
-  double t371;
-  double t372;
-  double t373;
-  double t374;
-  double t375;
-  double t379;
-  double t380;
-  double t381;
-  double t383;
-  double t385;
-  double t386;
-  double t388;
-  double t389;
-  double t390;
-  double t391;
-  double t392;
-  double t393;
-  double t397;
-  double t398;
-  double t399;
-  double t4;
-  double t401;
-  double t403;
-  double t404;
-  double t405;
-  double t408;
-  double t41;
-  double t410;
-  double t411;
-  double t412;
-  double t413;
-  double t414;
-  double t415;
-  double t416;
-  double t417;
-  double t418;
-  double t419;
-  double t42;
-  double t420;
-  double t421;
-  double t422;
-  double t423;
-  double t424;
-  double t425;
-  double t426;
-  double t427;
-  double t43;
-  double t432;
-  double t434;
-  double t436;
-  double t437;
-  double t438;
-  double t44;
-  double t440;
-  double t441;
-  double t442;
-  double t443;
-  double t445;
-  double t446;
-  double t447;
-  double t449;
-  double t451;
-  double t452;
-  double t453;
-  double t454;
-  double t455;
-  double t456;
-  double t457;
-  double t458;
-  double t46;
-  double t460;
-  double t462;
-  double t463;
-  double t464;
-  double t465;
-  double t466;
-  double t467;
-  double t468;
-  double t469;
-  double t470;
-  double t471;
-  double t476;
-  double t477;
-  double t478;
-  double t479;
-  double t48;
-  double t480;
-  double t481;
-  double t482;
-  double t483;
-  double t484;
-  double t485;
-  double t486;
-  double t487;
-  double t49;
-  double t495;
-  double t496;
-  double t5;
-  double t50;
-  double t51;
-  double t510;
-  double t521;
-  double t529;
-  double t53;
-  double t530;
-  double t533;
-  double t54;
-  double t548;
-  double t55;
-  double t56;
-  double t567;
-  double t568;
-  double t57;
-  double t574;
-  double t576;
-  double t58;
-  double t580;
-  double t582;
-  double t584;
-  double t586;
-  double t587;
-  double t59;
-  double t590;
-  double t593;
-  double t6;
-  double t60;
-  double t61;
-  double t611;
-  double t62;
-  double t630;
-  double t633;
-  double t634;
-  double t635;
-  double t636;
-  double t637;
-  double t638;
-  double t639;
-  double t640;
-  double t641;
-  double t642;
-  double t643;
-  double t644;
-  double t645;
-  double t646;
-  double t647;
-  double t648;
-  double t649;
-  double t650;
-  double t651;
-  double t652;
-  double t653;
-  double t654;
-  double t658;
-  double t659;
-  double t66;
-  double t660;
-  double t662;
-  double t664;
-  double t665;
-  double t667;
-  double t668;
-  double t669;
-  double t67;
-  double t670;
-  double t671;
-  double t672;
-  double t676;
-  double t677;
-  double t678;
-  double t68;
-  double t680;
-  double t682;
-  double t683;
-  double t684;
-  double t685;
-  double t686;
-  double t687;
-  double t688;
-  double t689;
-  double t691;
-  double t692;
-  double t693;
-  double t694;
-  double t695;
-  double t698;
-  double t699;
-  double t7;
-  double t70;
-  double t700;
-  double t701;
-  double t702;
-  double t703;
-  double t706;
-  double t708;
-  double t710;
-  double t711;
-  double t712;
-  double t714;
-  double t715;
-  double t716;
-  double t717;
-  double t719;
-  double t72;
-  double t720;
-  double t721;
-  double t723;
-  double t725;
-  double t726;
-  double t727;
-  double t728;
-  double t729;
-  double t73;
-  double t730;
-  double t731;
-  double t732;
-  double t734;
-  double t735;
-  double t736;
-  double t739;
-  double t740;
-  double t741;
-  double t742;
-  double t743;
-  double t744;
-  double t745;
-  double t746;
-  double t747;
-  double t748;
-  double t749;
-  double t75;
-  double t750;
-  double t757;
-  double t76;
-  double t762;
-  double t776;
-  double t779;
-  double t78;
-  double t79;
-  double t790;
-  double t791;
-  double t792;
-  double t795;
-  double t796;
-  double t797;
-  double t798;
-  double t8;
-  double t80;
-  double t801;
-  double t803;
-  double t805;
-  double t81;
-  double t815;
-  double t82;
-  double t822;
-  double t83;
-  double t832;
-  double t833;
-  double t834;
-  double t835;
-  double t836;
-  double t837;
-  double t838;
-  double t839;
-  double t84;
-  double t840;
-  double t851;
-  double t854;
-  double t857;
-  double t87;
-  double t875;
-  double t88;
-  double t882;
-  double t89;
-  double t894;
-  double t9;
-  double t90;
-  double t909;
-  double t91;
-  double t92;
-  double t93;
-  double t94;
-  double t95;
-  double t97;
-  double t99;
-  {
-    t2 = RL[8];
-    t3 = q[11];
-    t4 = cos(t3);
-    t5 = t2*t4;
-    t6 = RL[4];
-    t7 = sin(t3);
-    t8 = t6*t7;
-    t9 = -t5-t8;
-    t10 = q[10];
-    t11 = cos(t10);
-    t12 = t9*t11;
-    t13 = RL[0];
-    t14 = sin(t10);
-    t15 = t13*t14;
-    t16 = t12+t15;
-    t17 = q[9];
-    t18 = cos(t17);
-    t19 = t16*t18;
-    t20 = t9*t14;
-    t21 = t13*t11;
-    t22 = t20-t21;
-    t23 = sin(t17);
-    t24 = t22*t23;
-    t25 = t19-t24;
-    t26 = q[8];
-    t27 = sin(t26);
-    t28 = t25*t27;
-    t29 = t16*t23;
-    t30 = t22*t18;
-    t31 = t29+t30;
-    t32 = cos(t26);
-    t33 = t31*t32;
-    t34 = -t28-t33;
-    t35 = q[6];
-    t36 = cos(t35);
-    t37 = t34*t36;
-    t41 = sqrt(2.0);
-    t42 = (t25*t32-t31*t27)*t41;
-    t43 = t2*t7;
-    t44 = t6*t4;
-    t46 = (-t43+t44)*t41;
-    t48 = t42/2.0-t46/2.0;
-    t49 = q[7];
-    t50 = sin(t49);
-    t51 = t48*t50;
-    t53 = t42/2.0+t46/2.0;
-    t54 = cos(t49);
-    t55 = t53*t54;
-    t56 = t51+t55;
-    t57 = sin(t35);
-    t58 = t56*t57;
-    t59 = t37-t58;
-    t60 = q[0];
-    t61 = cos(t60);
-    t62 = t59*t61;
-    t66 = (t34*t57+t56*t36)*t41;
-    t67 = t48*t54;
-    t68 = t53*t50;
-    t70 = (-t67+t68)*t41;
-    t72 = t66/2.0+t70/2.0;
-    t73 = t72*t41;
-    t75 = -t66/2.0+t70/2.0;
-    t76 = t75*t41;
-    t78 = -t73/2.0-t76/2.0;
-    t79 = sin(t60);
-    t80 = t78*t79;
-    t81 = t62+t80;
-    t82 = q[2];
-    t83 = cos(t82);
-    t84 = t81*t83;
-    t87 = -t73/2.0+t76/2.0;
-    t88 = q[1];
-    t89 = sin(t88);
-    t90 = t87*t89;
-    t91 = t59*t79;
-    t92 = t78*t61;
-    t93 = -t91+t92;
-    t94 = cos(t88);
-    t95 = t93*t94;
-    t97 = (-t90+t95)*t41;
-    t99 = t87*t94;
-    t100 = t93*t89;
-    t102 = (t99+t100)*t41;
-    t104 = t102/2.0-t97/2.0;
-    t105 = t104*t83;
-    t106 = sin(t82);
-    t107 = t81*t106;
-    t108 = t105+t107;
-    t109 = q[3];
-    t110 = sin(t109);
-    t111 = t108*t110;
-    t113 = t104*t106;
-    t114 = -t113+t84;
-    t115 = cos(t109);
-    t116 = t114*t115;
-    t117 = -t111+t116;
-    t118 = q[4];
-    t119 = sin(t118);
-    t120 = t117*t119;
-    t122 = q[13];
-    t123 = sin(t122);
-    t124 = t72*t123;
-    t126 = q[12];
-    t127 = cos(t126);
-    t128 = t59*t127;
-    t129 = -t75;
-    t130 = sin(t126);
-    t131 = t129*t130;
-    t132 = t128+t131;
-    t133 = cos(t122);
-    t134 = t132*t133;
-    t135 = t134+t124;
-    t136 = q[15];
-    t137 = cos(t136);
-    t140 = t59*t130;
-    t142 = t129*t127;
-    t145 = sin(t136);
-    t146 = t135*t145;
-    t147 = -t140+t142;
-    t148 = q[14];
-    t149 = sin(t148);
-    t150 = t147*t149;
-    t151 = t132*t123;
-    t152 = t72*t133;
-    t153 = -t151+t152;
-    t154 = cos(t148);
-    t155 = t153*t154;
-    t156 = -t150+t155;
-    t157 = t156*t137;
-    t158 = -t146+t157;
-    t159 = q[16];
-    t160 = sin(t159);
-    t163 = t153*t149;
-    t165 = t108*t115;
-    t166 = t114*t110;
-    t167 = t165+t166;
-    t170 = q[17];
-    t171 = sin(t170);
-    t172 = t59*t171;
-    t173 = cos(t170);
-    t174 = t129*t173;
-    t175 = -t172+t174;
-    t176 = q[19];
-    t177 = cos(t176);
-    t178 = t175*t177;
-    t179 = t59*t173;
-    t180 = t129*t171;
-    t181 = t179+t180;
-    t182 = q[18];
-    t183 = sin(t182);
-    t184 = t181*t183;
-    t185 = cos(t182);
-    t186 = t72*t185;
-    t187 = -t184+t186;
-    t188 = sin(t176);
-    t189 = t187*t188;
-    t190 = t178+t189;
-    t191 = q[21];
-    t192 = cos(t191);
-    t195 = 0.1078086072E-3*t84-0.1512290733E-3*t97-0.2893250095E-3*t111+
-0.1832763156E-3*t120+0.4677530128E-2*t124+0.2606799616E-2*t135*t137+
-0.9381437244E-4*t140-0.9381437244E-4*t142-0.1078086072E-3*t113+0.8051018213E-4*
-t158*t160-0.1702509553E-4*t163-0.8799425961E-3*t167*t119+0.8051018213E-4*t190*
-t192;
-    t196 = q[22];
-    t197 = cos(t196);
-    t198 = t59*t197;
-    t200 = sin(t196);
-    t201 = t72*t200;
-    t203 = cos(t159);
-    t207 = q[23];
-    t208 = cos(t207);
-    t211 = t198+t201;
-    t212 = sin(t207);
-    t215 = t181*t185;
-    t216 = t72*t183;
-    t217 = t215+t216;
-    t218 = q[20];
-    t219 = sin(t218);
-    t220 = t217*t219;
-    t221 = t175*t188;
-    t222 = t187*t177;
-    t223 = -t221+t222;
-    t224 = cos(t218);
-    t225 = t223*t224;
-    t226 = -t220+t225;
-    t232 = t147*t154;
-    t233 = t232+t163;
-    t238 = -0.3696711277E-6*t198-0.3696711277E-6*t201+0.7932620886E-4*t158*t203
--0.5687628827E-3*t80-0.5082624939E-2*t129*t208+0.5082624939E-2*t211*t212
--0.7932620886E-4*t226*t192+0.2893250095E-3*t116-0.1681938551E-1*t105
--0.5687628827E-3*t62-0.7932620886E-4*t233*t160-0.1702509553E-4*t178
--0.2570662873E-4*t179;
-    t248 = cos(t118);
-    t251 = t167*t248;
-    t252 = t251+t120;
-    t253 = q[5];
-    t254 = cos(t253);
-    t260 = t102/2.0+t97/2.0;
-    t264 = -0.2570662873E-4*t180+0.8503258945E-4*t184-0.8503258945E-4*t186
--0.1702509553E-4*t189-0.1232237092E-6*t221+0.4677530128E-2*t215-0.1681938551E-1
-*t107+0.2369931678E-4*t157+0.8799425961E-3*t117*t248-0.1081557015E-2*t252*t254+
-0.2606799616E-2*t156*t145-0.1112574236E-3*t260*t254-0.9419629563E-2*t166;
-    t270 = sin(t191);
-    t279 = sin(t253);
-    t285 = 0.1232237092E-6*t150-0.1232237092E-6*t155-0.9761137487E-4*t151+
-0.9761137487E-4*t152-0.9419629563E-2*t165+0.8051018213E-4*t226*t270+
-0.2606799616E-2*t223*t219+0.3775495252E-3*t211*t208+0.3775495252E-3*t129*t212
--0.1081557015E-2*t260*t279+0.1232237092E-6*t222-0.2369931678E-4*t225+
-0.1832763156E-3*t251;
-    t302 = 0.4677530128E-2*t216+0.2606799616E-2*t217*t224-0.8318061448E-1*t19
--0.9332037043E-1*t12+0.1832763156E-3*t5+0.1832763156E-3*t8-0.9332037043E-1*t15
--0.2893250095E-3*t20+0.2893250095E-3*t21+0.8318061448E-1*t24+0.5687628827E-3*
-t28-0.1078086072E-3*t29-0.1078086072E-3*t30;
-    t316 = 0.5687628827E-3*t33-0.1607889161E-3*t51+0.9397174694E-4*t42+
-0.3024581465E-3*t43-0.3024581465E-3*t44-0.5737222431E-5*t46-0.1607889161E-3*t55
--0.1659098766E-1*t66-0.4122466806E-3*t67+0.4122466806E-3*t68+0.6660372088E-1*
-t70-0.2061233404E-3*t73+0.2061233404E-3*t76;
-    t332 = -0.9970896939E-4*t99-0.101865705E-2*t37+0.8799425961E-3*t13
--0.1112574236E-3*t6+0.4402844298E-1*t2+0.9999999999*RL[12]+0.101865705E-2*t58+
-0.1607889161E-3*t91-0.1607889161E-3*t92-0.9970896939E-4*t100+0.8823452451E-4*
-t95-0.8823452451E-4*t90+0.9381437244E-4*t172;
-    t351 = -0.9381437244E-4*t174+0.8051018213E-4*t233*t203-0.2369931678E-4*t146
--0.1702509553E-4*t232+0.7932620886E-4*t190*t270+0.4677530128E-2*t134
--0.2570662873E-4*t128-0.2570662873E-4*t131+0.2369931678E-4*t220-0.1512290733E-3
-*t102-0.8945848979E-4*t72*t197+0.8945848979E-4*t59*t200+0.1112574236E-3*t252*
-t279;
-    A[0] = t195+t238+t264+t285+t302+t316+t332+t351;
-    t354 = RL[9];
-    t355 = t354*t4;
-    t356 = RL[5];
-    t357 = t356*t7;
-    t358 = -t355-t357;
-    t359 = t358*t11;
-    t360 = RL[1];
-    t361 = t360*t14;
-    t362 = t359+t361;
-    t363 = t362*t18;
-    t364 = t358*t14;
-    t365 = t360*t11;
-    t366 = t364-t365;
-    t367 = t366*t23;
-    t368 = t363-t367;
-    t369 = t368*t27;
-    t370 = t362*t23;
-    t371 = t366*t18;
-    t372 = t370+t371;
-    t373 = t372*t32;
-    t374 = -t369-t373;
-    t375 = t374*t36;
-    t379 = (t368*t32-t372*t27)*t41;
-    t380 = t354*t7;
-    t381 = t356*t4;
-    t383 = (-t380+t381)*t41;
-    t385 = t379/2.0-t383/2.0;
-    t386 = t385*t50;
-    t388 = t379/2.0+t383/2.0;
-    t389 = t388*t54;
-    t390 = t386+t389;
-    t391 = t390*t57;
-    t392 = t375-t391;
-    t393 = t392*t197;
-    t397 = (t374*t57+t390*t36)*t41;
-    t398 = t385*t54;
-    t399 = t388*t50;
-    t401 = (-t398+t399)*t41;
-    t403 = t397/2.0+t401/2.0;
-    t404 = t403*t200;
-    t405 = t393+t404;
-    t408 = t392*t127;
-    t410 = t397/2.0-t401/2.0;
-    t411 = t410*t130;
-    t412 = t408+t411;
-    t413 = t412*t133;
-    t414 = t403*t123;
-    t415 = t413+t414;
-    t416 = t415*t145;
-    t417 = t392*t130;
-    t418 = t410*t127;
-    t419 = -t417+t418;
-    t420 = t419*t149;
-    t421 = t412*t123;
-    t422 = t403*t133;
-    t423 = -t421+t422;
-    t424 = t423*t154;
-    t425 = -t420+t424;
-    t426 = t425*t137;
-    t427 = -t416+t426;
-    t432 = t403*t41;
-    t434 = -t410*t41;
-    t436 = -t432/2.0+t434/2.0;
-    t437 = t436*t94;
-    t438 = t392*t79;
-    t440 = -t432/2.0-t434/2.0;
-    t441 = t440*t61;
-    t442 = -t438+t441;
-    t443 = t442*t89;
-    t445 = (t437+t443)*t41;
-    t446 = t436*t89;
-    t447 = t442*t94;
-    t449 = (-t446+t447)*t41;
-    t451 = t445/2.0-t449/2.0;
-    t452 = t451*t106;
-    t453 = t392*t61;
-    t454 = t440*t79;
-    t455 = t453+t454;
-    t456 = t455*t83;
-    t457 = -t452+t456;
-    t458 = t457*t115;
-    t460 = t451*t83;
-    t462 = t455*t106;
-    t463 = t460+t462;
-    t464 = t463*t115;
-    t465 = t457*t110;
-    t466 = t464+t465;
-    t467 = t466*t248;
-    t468 = t463*t110;
-    t469 = -t468+t458;
-    t470 = t469*t119;
-    t471 = t467+t470;
-    t476 = t392*t171;
-    t477 = t410*t173;
-    t478 = -t476+t477;
-    t479 = t478*t177;
-    t480 = t392*t173;
-    t481 = t410*t171;
-    t482 = t480+t481;
-    t483 = t482*t183;
-    t484 = t403*t185;
-    t485 = -t483+t484;
-    t486 = t485*t188;
-    t487 = t479+t486;
-    t495 = 0.5082624939E-2*t405*t212+0.8051018213E-4*t427*t160+0.3775495252E-3*
-t410*t212+0.2893250095E-3*t458-0.1681938551E-1*t460-0.1081557015E-2*t471*t254+
-0.1112574236E-3*t471*t279+0.8051018213E-4*t487*t192-0.2893250095E-3*t468+
-0.1607889161E-3*t438-0.1607889161E-3*t441-0.9970896939E-4*t443-0.1512290733E-3*
-t445;
-    t496 = t423*t149;
-    t510 = -0.1702509553E-4*t496+0.1832763156E-3*t355+0.1832763156E-3*t357
--0.9332037043E-1*t359-0.3696711277E-6*t393-0.101865705E-2*t375-0.8318061448E-1*
-t363-0.9332037043E-1*t361-0.2893250095E-3*t364+0.2893250095E-3*t365+
-0.8318061448E-1*t367+0.5687628827E-3*t369-0.1078086072E-3*t370;
-    t521 = t445/2.0+t449/2.0;
-    t529 = t419*t154;
-    t530 = t529+t496;
-    t533 = -0.1078086072E-3*t371+0.5687628827E-3*t373-0.1607889161E-3*t386+
-0.9397174694E-4*t379+0.3024581465E-3*t380-0.3024581465E-3*t381-0.5737222431E-5*
-t383-0.1607889161E-3*t389-0.1112574236E-3*t521*t254-0.8945848979E-4*t403*t197+
-0.8945848979E-4*t392*t200+0.1832763156E-3*t470+0.8051018213E-4*t530*t203;
-    t548 = -0.1078086072E-3*t452+0.1078086072E-3*t456+0.4402844298E-1*t354
--0.1112574236E-3*t356+0.8799425961E-3*t360+0.101865705E-2*t391-0.3696711277E-6*
-t404-0.1659098766E-1*t397-0.4122466806E-3*t398+0.4122466806E-3*t399+
-0.6660372088E-1*t401+0.3775495252E-3*t405*t208-0.2061233404E-3*t432;
-    t567 = 0.2061233404E-3*t434-0.9970896939E-4*t437+0.9999999999*RL[13]+
-0.8799425961E-3*t469*t248-0.9419629563E-2*t464-0.9419629563E-2*t465
--0.8799425961E-3*t466*t119-0.2570662873E-4*t408-0.2570662873E-4*t480
--0.2570662873E-4*t481+0.8503258945E-4*t483-0.8503258945E-4*t484-0.1702509553E-4
-*t486;
-    t568 = t485*t177;
-    t574 = t478*t188;
-    t576 = -t574+t568;
-    t580 = t576*t224;
-    t582 = t482*t185;
-    t584 = t403*t183;
-    t586 = t582+t584;
-    t587 = t586*t219;
-    t590 = -t587+t580;
-    t593 = 0.1232237092E-6*t568+0.9381437244E-4*t476-0.9381437244E-4*t477
--0.5082624939E-2*t410*t208-0.1232237092E-6*t574+0.2606799616E-2*t576*t219+
-0.8823452451E-4*t447-0.2369931678E-4*t580+0.4677530128E-2*t582+0.4677530128E-2*
-t584+0.2369931678E-4*t587+0.1832763156E-3*t467+0.8051018213E-4*t590*t270;
-    t611 = -0.7932620886E-4*t590*t192-0.1702509553E-4*t479-0.1512290733E-3*t449
--0.5687628827E-3*t453-0.5687628827E-3*t454+0.7932620886E-4*t487*t270+
-0.2606799616E-2*t586*t224-0.2570662873E-4*t411-0.9761137487E-4*t421+
-0.9761137487E-4*t422-0.1232237092E-6*t424+0.9381437244E-4*t417-0.9381437244E-4*
-t418;
-    t630 = 0.1232237092E-6*t420-0.1081557015E-2*t521*t279+0.2606799616E-2*t425*
-t145+0.2369931678E-4*t426+0.4677530128E-2*t413+0.4677530128E-2*t414
--0.2369931678E-4*t416+0.2606799616E-2*t415*t137-0.1702509553E-4*t529
--0.8823452451E-4*t446+0.7932620886E-4*t427*t203-0.7932620886E-4*t530*t160
--0.1681938551E-1*t462;
-    A[1] = t495+t510+t533+t548+t567+t593+t611+t630;
-    t633 = RL[10];
-    t634 = t633*t4;
-    t635 = RL[6];
-    t636 = t635*t7;
-    t637 = -t634-t636;
-    t638 = t637*t11;
-    t639 = RL[2];
-    t640 = t639*t14;
-    t641 = t638+t640;
-    t642 = t641*t18;
-    t643 = t637*t14;
-    t644 = t639*t11;
-    t645 = t643-t644;
-    t646 = t645*t23;
-    t647 = t642-t646;
-    t648 = t647*t27;
-    t649 = t641*t23;
-    t650 = t645*t18;
-    t651 = t649+t650;
-    t652 = t651*t32;
-    t653 = -t648-t652;
-    t654 = t653*t36;
-    t658 = (t647*t32-t651*t27)*t41;
-    t659 = t633*t7;
-    t660 = t635*t4;
-    t662 = (-t659+t660)*t41;
-    t664 = t658/2.0-t662/2.0;
-    t665 = t664*t50;
-    t667 = t658/2.0+t662/2.0;
-    t668 = t667*t54;
-    t669 = t665+t668;
-    t670 = t669*t57;
-    t671 = t654-t670;
-    t672 = t671*t171;
-    t676 = (t653*t57+t669*t36)*t41;
-    t677 = t664*t54;
-    t678 = t667*t50;
-    t680 = (-t677+t678)*t41;
-    t682 = t676/2.0-t680/2.0;
-    t683 = t682*t173;
-    t684 = -t672+t683;
-    t685 = t684*t188;
-    t686 = t671*t173;
-    t687 = t682*t171;
-    t688 = t686+t687;
-    t689 = t688*t183;
-    t691 = t676/2.0+t680/2.0;
-    t692 = t691*t185;
-    t693 = -t689+t692;
-    t694 = t693*t177;
-    t695 = -t685+t694;
-    t698 = t688*t185;
-    t699 = t691*t183;
-    t700 = t698+t699;
-    t701 = t700*t219;
-    t702 = t695*t224;
-    t703 = -t701+t702;
-    t706 = t691*t41;
-    t708 = -t682*t41;
-    t710 = -t706/2.0+t708/2.0;
-    t711 = t710*t94;
-    t712 = t671*t79;
-    t714 = -t706/2.0-t708/2.0;
-    t715 = t714*t61;
-    t716 = -t712+t715;
-    t717 = t716*t89;
-    t719 = (t711+t717)*t41;
-    t720 = t710*t89;
-    t721 = t716*t94;
-    t723 = (-t720+t721)*t41;
-    t725 = t719/2.0-t723/2.0;
-    t726 = t725*t106;
-    t727 = t671*t61;
-    t728 = t714*t79;
-    t729 = t727+t728;
-    t730 = t729*t83;
-    t731 = -t726+t730;
-    t732 = t731*t110;
-    t734 = t684*t177;
-    t735 = t693*t188;
-    t736 = t734+t735;
-    t739 = t671*t130;
-    t740 = t682*t127;
-    t741 = -t739+t740;
-    t742 = t741*t149;
-    t743 = t671*t127;
-    t744 = t682*t130;
-    t745 = t743+t744;
-    t746 = t745*t123;
-    t747 = t691*t133;
-    t748 = -t746+t747;
-    t749 = t748*t154;
-    t750 = -t742+t749;
-    t757 = t671*t197;
-    t762 = 0.2606799616E-2*t695*t219+0.8051018213E-4*t703*t270-0.9419629563E-2*
-t732+0.8051018213E-4*t736*t192+0.2606799616E-2*t750*t145-0.8823452451E-4*t720+
-0.1832763156E-3*t634+0.1832763156E-3*t636-0.9332037043E-1*t638-0.3696711277E-6*
-t757-0.101865705E-2*t654-0.8318061448E-1*t642-0.9332037043E-1*t640;
-    t776 = -0.2893250095E-3*t643+0.2893250095E-3*t644+0.8318061448E-1*t646+
-0.5687628827E-3*t648-0.1078086072E-3*t649-0.1078086072E-3*t650+0.5687628827E-3*
-t652-0.1607889161E-3*t665+0.9397174694E-4*t658+0.3024581465E-3*t659
--0.3024581465E-3*t660-0.5737222431E-5*t662-0.1607889161E-3*t668;
-    t779 = t691*t200;
-    t790 = t741*t154;
-    t791 = t748*t149;
-    t792 = t790+t791;
-    t795 = t745*t133;
-    t796 = t691*t123;
-    t797 = t795+t796;
-    t798 = t797*t145;
-    t801 = t731*t115;
-    t803 = t725*t83;
-    t805 = 0.101865705E-2*t670-0.3696711277E-6*t779-0.1659098766E-1*t676
--0.4122466806E-3*t677+0.4122466806E-3*t678-0.8945848979E-4*t691*t197+
-0.8945848979E-4*t671*t200+0.3775495252E-3*t682*t212-0.7932620886E-4*t792*t160
--0.2369931678E-4*t798-0.1702509553E-4*t790+0.2893250095E-3*t801-0.1681938551E-1
-*t803;
-    t815 = t719/2.0+t723/2.0;
-    t822 = -0.1512290733E-3*t719-0.2061233404E-3*t706+0.2061233404E-3*t708
--0.9970896939E-4*t711+0.1607889161E-3*t712-0.1607889161E-3*t715+0.4677530128E-2
-*t699+0.2369931678E-4*t701-0.1081557015E-2*t815*t279-0.2570662873E-4*t744
--0.9761137487E-4*t746+0.9761137487E-4*t747-0.1702509553E-4*t791;
-    t832 = t729*t106;
-    t833 = t803+t832;
-    t834 = t833*t115;
-    t835 = t834+t732;
-    t836 = t835*t248;
-    t837 = t833*t110;
-    t838 = -t837+t801;
-    t839 = t838*t119;
-    t840 = t836+t839;
-    t851 = t757+t779;
-    t854 = t750*t137;
-    t857 = -0.9970896939E-4*t717+0.8823452451E-4*t721-0.1702509553E-4*t735+
-0.2606799616E-2*t797*t137+0.9999999999*RL[14]-0.1081557015E-2*t840*t254
--0.1112574236E-3*t815*t254+0.8051018213E-4*t792*t203+0.1112574236E-3*t840*t279
--0.5082624939E-2*t682*t208+0.5082624939E-2*t851*t212+0.2369931678E-4*t854+
-0.4677530128E-2*t795;
-    t875 = 0.4677530128E-2*t796+0.1078086072E-3*t730+0.6660372088E-1*t680+
-0.3775495252E-3*t851*t208-0.8799425961E-3*t835*t119-0.2570662873E-4*t743+
-0.1832763156E-3*t839+0.7932620886E-4*t736*t270+0.2606799616E-2*t700*t224
--0.2369931678E-4*t702+0.4677530128E-2*t698+0.1232237092E-6*t694+0.9381437244E-4
-*t672;
-    t882 = -t798+t854;
-    t894 = -0.9381437244E-4*t683-0.1232237092E-6*t685+0.8799425961E-3*t838*t248
--0.9419629563E-2*t834+0.8051018213E-4*t882*t160+0.7932620886E-4*t882*t203
--0.1232237092E-6*t749+0.9381437244E-4*t739-0.9381437244E-4*t740+0.1232237092E-6
-*t742-0.2570662873E-4*t686-0.2570662873E-4*t687+0.8503258945E-4*t689;
-    t909 = -0.8503258945E-4*t692-0.1512290733E-3*t723-0.5687628827E-3*t727
--0.5687628827E-3*t728-0.1681938551E-1*t832-0.2893250095E-3*t837-0.7932620886E-4
-*t703*t192-0.1702509553E-4*t734-0.1078086072E-3*t726+0.1832763156E-3*t836+
-0.4402844298E-1*t633-0.1112574236E-3*t635+0.8799425961E-3*t639;
-    A[2] = t762+t776+t805+t822+t857+t875+t894+t909;
-    return;
-  }
+#include "RLeg2CoM_body.h"
+}
+
+void LLeg2RLegCoM(q,LL,T,A)
+double q[24];
+double LL[16];
+double T[16];
+double A[3];
+{
+#include "LLeg2RLegCoM_body.h"
+}
+
+void RLeg2LLegCoM(q,RL,T,A)
+double q[24];
+double RL[16];
+double T[16];
+double A[3];
+{
+#include "RLeg2LLegCoM_body.h"
 }
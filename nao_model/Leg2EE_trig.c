@@ -0,0 +1,44 @@
+/**
+ * @file
+ * @brief Versions of the functions in Leg2EE.c, which use precomputed sine
+ * and cosine of joint angles.
+ */
+
+#include <math.h>
+#include "maple_trig.h"
+
+
+void LLeg2RLeg_trig (const double *sin_q, const double *cos_q, const double *LL, double *T)
+{
+#include "LLeg2RLeg_body.h"
+}
+
+
+void LLeg2CoM_trig (const double *sin_q, const double *cos_q, const double *LL, double *A)
+{
+#include "LLeg2CoM_body.h"
+}
+
+
+void RLeg2LLeg_trig (const double *sin_q, const double *cos_q, const double *RL, double *T)
+{
+#include "RLeg2LLeg_body.h"
+}
+
+
+void RLeg2CoM_trig (const double *sin_q, const double *cos_q, const double *RL, double *A)
+{
+#include "RLeg2CoM_body.h"
+}
+
+
+void LLeg2RLegCoM_trig (const double *sin_q, const double *cos_q, const double *LL, double *T, double *A)
+{
+#include "LLeg2RLegCoM_body.h"
+}
+
+
+void RLeg2LLegCoM_trig (const double *sin_q, const double *cos_q, const double *RL, double *T, double *A)
+{
+#include "RLeg2LLegCoM_body.h"
+}
@@ -0,0 +1,39 @@
+/**
+ * @file
+ * @brief Versions of LLeg2Joints(), RLeg2Joints() and their _select
+ * variants, which use precomputed sine and cosine of joint angles.
+ */
+
+#include <math.h>
+#include "maple_trig.h"
+
+
+void LLeg2Joints_trig (const double *sin_q, const double *cos_q, const double *LL, double *A)
+{
+#include "LLeg2Joints_body.h"
+}
+
+
+void RLeg2Joints_trig (const double *sin_q, const double *cos_q, const double *RL, double *A)
+{
+#include "RLeg2Joints_body.h"
+}
+
+
+/* The guard of a statement implies the guards of the statements, which
+ * initialize its variables, but the compiler does not see it. */
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+void LLeg2Joints_select_trig (const double *sin_q, const double *cos_q, const double *LL, const unsigned int frames, double *A)
+{
+#include "LLeg2Joints_select_body.h"
+}
+
+
+void RLeg2Joints_select_trig (const double *sin_q, const double *cos_q, const double *RL, const unsigned int frames, double *A)
+{
+#include "RLeg2Joints_select_body.h"
+}
@@ -0,0 +1,943 @@
+/* Generated using codegen (2012-02-13, 17:03:54) */ 
+/*
+ * Body of RLeg2CoM(), the IGM_* macros are described in maple_double.h.
+ */
+  IGM_REAL t100;
+  IGM_REAL t102;
+  IGM_REAL t104;
+  IGM_REAL t105;
+  IGM_REAL t106;
+  IGM_REAL t107;
+  IGM_REAL t108;
+  IGM_REAL t11;
+  IGM_REAL t110;
+  IGM_REAL t111;
+  IGM_REAL t113;
+  IGM_REAL t114;
+  IGM_REAL t115;
+  IGM_REAL t116;
+  IGM_REAL t117;
+  IGM_REAL t119;
+  IGM_REAL t12;
+  IGM_REAL t120;
+  IGM_REAL t123;
+  IGM_REAL t124;
+  IGM_REAL t127;
+  IGM_REAL t128;
+  IGM_REAL t129;
+  IGM_REAL t13;
+  IGM_REAL t130;
+  IGM_REAL t131;
+  IGM_REAL t132;
+  IGM_REAL t133;
+  IGM_REAL t134;
+  IGM_REAL t135;
+  IGM_REAL t137;
+  IGM_REAL t14;
+  IGM_REAL t140;
+  IGM_REAL t142;
+  IGM_REAL t145;
+  IGM_REAL t146;
+  IGM_REAL t147;
+  IGM_REAL t149;
+  IGM_REAL t15;
+  IGM_REAL t150;
+  IGM_REAL t151;
+  IGM_REAL t152;
+  IGM_REAL t153;
+  IGM_REAL t154;
+  IGM_REAL t155;
+  IGM_REAL t156;
+  IGM_REAL t157;
+  IGM_REAL t158;
+  IGM_REAL t16;
+  IGM_REAL t160;
+  IGM_REAL t163;
+  IGM_REAL t165;
+  IGM_REAL t166;
+  IGM_REAL t167;
+  IGM_REAL t171;
+  IGM_REAL t172;
+  IGM_REAL t173;
+  IGM_REAL t174;
+  IGM_REAL t175;
+  IGM_REAL t177;
+  IGM_REAL t178;
+  IGM_REAL t179;
+  IGM_REAL t18;
+  IGM_REAL t180;
+  IGM_REAL t181;
+  IGM_REAL t183;
+  IGM_REAL t184;
+  IGM_REAL t185;
+  IGM_REAL t186;
+  IGM_REAL t187;
+  IGM_REAL t188;
+  IGM_REAL t189;
+  IGM_REAL t19;
+  IGM_REAL t190;
+  IGM_REAL t192;
+  IGM_REAL t195;
+  IGM_REAL t197;
+  IGM_REAL t198;
+  IGM_REAL t2;
+  IGM_REAL t20;
+  IGM_REAL t200;
+  IGM_REAL t201;
+  IGM_REAL t203;
+  IGM_REAL t208;
+  IGM_REAL t21;
+  IGM_REAL t211;
+  IGM_REAL t212;
+  IGM_REAL t215;
+  IGM_REAL t216;
+  IGM_REAL t217;
+  IGM_REAL t219;
+  IGM_REAL t22;
+  IGM_REAL t220;
+  IGM_REAL t221;
+  IGM_REAL t222;
+  IGM_REAL t223;
+  IGM_REAL t224;
+  IGM_REAL t225;
+  IGM_REAL t226;
+  IGM_REAL t23;
+  IGM_REAL t232;
+  IGM_REAL t233;
+  IGM_REAL t238;
+  IGM_REAL t24;
+  IGM_REAL t248;
+  IGM_REAL t25;
+  IGM_REAL t251;
+  IGM_REAL t252;
+  IGM_REAL t254;
+  IGM_REAL t260;
+  IGM_REAL t264;
+  IGM_REAL t27;
+  IGM_REAL t270;
+  IGM_REAL t279;
+  IGM_REAL t28;
+  IGM_REAL t285;
+  IGM_REAL t29;
+  IGM_REAL t30;
+  IGM_REAL t302;
+  IGM_REAL t31;
+  IGM_REAL t316;
+  IGM_REAL t32;
+  IGM_REAL t33;
+  IGM_REAL t332;
+  IGM_REAL t34;
+  IGM_REAL t351;
+  IGM_REAL t354;
+  IGM_REAL t355;
+  IGM_REAL t356;
+  IGM_REAL t357;
+  IGM_REAL t358;
+  IGM_REAL t359;
+  IGM_REAL t36;
+  IGM_REAL t360;
+  IGM_REAL t361;
+  IGM_REAL t362;
+  IGM_REAL t363;
+  IGM_REAL t364;
+  IGM_REAL t365;
+  IGM_REAL t366;
+  IGM_REAL t367;
+  IGM_REAL t368;
+  IGM_REAL t369;
+  IGM_REAL t37;
+  IGM_REAL t370;
+  IGM_REAL t371;
+  IGM_REAL t372;
+  IGM_REAL t373;
+  IGM_REAL t374;
+  IGM_REAL t375;
+  IGM_REAL t379;
+  IGM_REAL t380;
+  IGM_REAL t381;
+  IGM_REAL t383;
+  IGM_REAL t385;
+  IGM_REAL t386;
+  IGM_REAL t388;
+  IGM_REAL t389;
+  IGM_REAL t390;
+  IGM_REAL t391;
+  IGM_REAL t392;
+  IGM_REAL t393;
+  IGM_REAL t397;
+  IGM_REAL t398;
+  IGM_REAL t399;
+  IGM_REAL t4;
+  IGM_REAL t401;
+  IGM_REAL t403;
+  IGM_REAL t404;
+  IGM_REAL t405;
+  IGM_REAL t408;
+  IGM_REAL t41;
+  IGM_REAL t410;
+  IGM_REAL t411;
+  IGM_REAL t412;
+  IGM_REAL t413;
+  IGM_REAL t414;
+  IGM_REAL t415;
+  IGM_REAL t416;
+  IGM_REAL t417;
+  IGM_REAL t418;
+  IGM_REAL t419;
+  IGM_REAL t42;
+  IGM_REAL t420;
+  IGM_REAL t421;
+  IGM_REAL t422;
+  IGM_REAL t423;
+  IGM_REAL t424;
+  IGM_REAL t425;
+  IGM_REAL t426;
+  IGM_REAL t427;
+  IGM_REAL t43;
+  IGM_REAL t432;
+  IGM_REAL t434;
+  IGM_REAL t436;
+  IGM_REAL t437;
+  IGM_REAL t438;
+  IGM_REAL t44;
+  IGM_REAL t440;
+  IGM_REAL t441;
+  IGM_REAL t442;
+  IGM_REAL t443;
+  IGM_REAL t445;
+  IGM_REAL t446;
+  IGM_REAL t447;
+  IGM_REAL t449;
+  IGM_REAL t451;
+  IGM_REAL t452;
+  IGM_REAL t453;
+  IGM_REAL t454;
+  IGM_REAL t455;
+  IGM_REAL t456;
+  IGM_REAL t457;
+  IGM_REAL t458;
+  IGM_REAL t46;
+  IGM_REAL t460;
+  IGM_REAL t462;
+  IGM_REAL t463;
+  IGM_REAL t464;
+  IGM_REAL t465;
+  IGM_REAL t466;
+  IGM_REAL t467;
+  IGM_REAL t468;
+  IGM_REAL t469;
+  IGM_REAL t470;
+  IGM_REAL t471;
+  IGM_REAL t476;
+  IGM_REAL t477;
+  IGM_REAL t478;
+  IGM_REAL t479;
+  IGM_REAL t48;
+  IGM_REAL t480;
+  IGM_REAL t481;
+  IGM_REAL t482;
+  IGM_REAL t483;
+  IGM_REAL t484;
+  IGM_REAL t485;
+  IGM_REAL t486;
+  IGM_REAL t487;
+  IGM_REAL t495;
+  IGM_REAL t496;
+  IGM_REAL t5;
+  IGM_REAL t50;
+  IGM_REAL t51;
+  IGM_REAL t510;
+  IGM_REAL t521;
+  IGM_REAL t529;
+  IGM_REAL t53;
+  IGM_REAL t530;
+  IGM_REAL t533;
+  IGM_REAL t54;
+  IGM_REAL t548;
+  IGM_REAL t55;
+  IGM_REAL t56;
+  IGM_REAL t567;
+  IGM_REAL t568;
+  IGM_REAL t57;
+  IGM_REAL t574;
+  IGM_REAL t576;
+  IGM_REAL t58;
+  IGM_REAL t580;
+  IGM_REAL t582;
+  IGM_REAL t584;
+  IGM_REAL t586;
+  IGM_REAL t587;
+  IGM_REAL t59;
+  IGM_REAL t590;
+  IGM_REAL t593;
+  IGM_REAL t6;
+  IGM_REAL t61;
+  IGM_REAL t611;
+  IGM_REAL t62;
+  IGM_REAL t630;
+  IGM_REAL t633;
+  IGM_REAL t634;
+  IGM_REAL t635;
+  IGM_REAL t636;
+  IGM_REAL t637;
+  IGM_REAL t638;
+  IGM_REAL t639;
+  IGM_REAL t640;
+  IGM_REAL t641;
+  IGM_REAL t642;
+  IGM_REAL t643;
+  IGM_REAL t644;
+  IGM_REAL t645;
+  IGM_REAL t646;
+  IGM_REAL t647;
+  IGM_REAL t648;
+  IGM_REAL t649;
+  IGM_REAL t650;
+  IGM_REAL t651;
+  IGM_REAL t652;
+  IGM_REAL t653;
+  IGM_REAL t654;
+  IGM_REAL t658;
+  IGM_REAL t659;
+  IGM_REAL t66;
+  IGM_REAL t660;
+  IGM_REAL t662;
+  IGM_REAL t664;
+  IGM_REAL t665;
+  IGM_REAL t667;
+  IGM_REAL t668;
+  IGM_REAL t669;
+  IGM_REAL t67;
+  IGM_REAL t670;
+  IGM_REAL t671;
+  IGM_REAL t672;
+  IGM_REAL t676;
+  IGM_REAL t677;
+  IGM_REAL t678;
+  IGM_REAL t68;
+  IGM_REAL t680;
+  IGM_REAL t682;
+  IGM_REAL t683;
+  IGM_REAL t684;
+  IGM_REAL t685;
+  IGM_REAL t686;
+  IGM_REAL t687;
+  IGM_REAL t688;
+  IGM_REAL t689;
+  IGM_REAL t691;
+  IGM_REAL t692;
+  IGM_REAL t693;
+  IGM_REAL t694;
+  IGM_REAL t695;
+  IGM_REAL t698;
+  IGM_REAL t699;
+  IGM_REAL t7;
+  IGM_REAL t70;
+  IGM_REAL t700;
+  IGM_REAL t701;
+  IGM_REAL t702;
+  IGM_REAL t703;
+  IGM_REAL t706;
+  IGM_REAL t708;
+  IGM_REAL t710;
+  IGM_REAL t711;
+  IGM_REAL t712;
+  IGM_REAL t714;
+  IGM_REAL t715;
+  IGM_REAL t716;
+  IGM_REAL t717;
+  IGM_REAL t719;
+  IGM_REAL t72;
+  IGM_REAL t720;
+  IGM_REAL t721;
+  IGM_REAL t723;
+  IGM_REAL t725;
+  IGM_REAL t726;
+  IGM_REAL t727;
+  IGM_REAL t728;
+  IGM_REAL t729;
+  IGM_REAL t73;
+  IGM_REAL t730;
+  IGM_REAL t731;
+  IGM_REAL t732;
+  IGM_REAL t734;
+  IGM_REAL t735;
+  IGM_REAL t736;
+  IGM_REAL t739;
+  IGM_REAL t740;
+  IGM_REAL t741;
+  IGM_REAL t742;
+  IGM_REAL t743;
+  IGM_REAL t744;
+  IGM_REAL t745;
+  IGM_REAL t746;
+  IGM_REAL t747;
+  IGM_REAL t748;
+  IGM_REAL t749;
+  IGM_REAL t75;
+  IGM_REAL t750;
+  IGM_REAL t757;
+  IGM_REAL t76;
+  IGM_REAL t762;
+  IGM_REAL t776;
+  IGM_REAL t779;
+  IGM_REAL t78;
+  IGM_REAL t79;
+  IGM_REAL t790;
+  IGM_REAL t791;
+  IGM_REAL t792;
+  IGM_REAL t795;
+  IGM_REAL t796;
+  IGM_REAL t797;
+  IGM_REAL t798;
+  IGM_REAL t8;
+  IGM_REAL t80;
+  IGM_REAL t801;
+  IGM_REAL t803;
+  IGM_REAL t805;
+  IGM_REAL t81;
+  IGM_REAL t815;
+  IGM_REAL t822;
+  IGM_REAL t83;
+  IGM_REAL t832;
+  IGM_REAL t833;
+  IGM_REAL t834;
+  IGM_REAL t835;
+  IGM_REAL t836;
+  IGM_REAL t837;
+  IGM_REAL t838;
+  IGM_REAL t839;
+  IGM_REAL t84;
+  IGM_REAL t840;
+  IGM_REAL t851;
+  IGM_REAL t854;
+  IGM_REAL t857;
+  IGM_REAL t87;
+  IGM_REAL t875;
+  IGM_REAL t882;
+  IGM_REAL t89;
+  IGM_REAL t894;
+  IGM_REAL t9;
+  IGM_REAL t90;
+  IGM_REAL t909;
+  IGM_REAL t91;
+  IGM_REAL t92;
+  IGM_REAL t93;
+  IGM_REAL t94;
+  IGM_REAL t95;
+  IGM_REAL t97;
+  IGM_REAL t99;
+  {
+    t2 = RL[8];
+    t4 = IGM_COS_Q(11);
+    t5 = t2*t4;
+    t6 = RL[4];
+    t7 = IGM_SIN_Q(11);
+    t8 = t6*t7;
+    t9 = -t5-t8;
+    t11 = IGM_COS_Q(10);
+    t12 = t9*t11;
+    t13 = RL[0];
+    t14 = IGM_SIN_Q(10);
+    t15 = t13*t14;
+    t16 = t12+t15;
+    t18 = IGM_COS_Q(9);
+    t19 = t16*t18;
+    t20 = t9*t14;
+    t21 = t13*t11;
+    t22 = t20-t21;
+    t23 = IGM_SIN_Q(9);
+    t24 = t22*t23;
+    t25 = t19-t24;
+    t27 = IGM_SIN_Q(8);
+    t28 = t25*t27;
+    t29 = t16*t23;
+    t30 = t22*t18;
+    t31 = t29+t30;
+    t32 = IGM_COS_Q(8);
+    t33 = t31*t32;
+    t34 = -t28-t33;
+    t36 = IGM_COS_Q(6);
+    t37 = t34*t36;
+    t41 = IGM_CONST(sqrt(2.0));
+    t42 = (t25*t32-t31*t27)*t41;
+    t43 = t2*t7;
+    t44 = t6*t4;
+    t46 = (-t43+t44)*t41;
+    t48 = t42/2.0-t46/2.0;
+    t50 = IGM_SIN_Q(7);
+    t51 = t48*t50;
+    t53 = t42/2.0+t46/2.0;
+    t54 = IGM_COS_Q(7);
+    t55 = t53*t54;
+    t56 = t51+t55;
+    t57 = IGM_SIN_Q(6);
+    t58 = t56*t57;
+    t59 = t37-t58;
+    t61 = IGM_COS_Q(0);
+    t62 = t59*t61;
+    t66 = (t34*t57+t56*t36)*t41;
+    t67 = t48*t54;
+    t68 = t53*t50;
+    t70 = (-t67+t68)*t41;
+    t72 = t66/2.0+t70/2.0;
+    t73 = t72*t41;
+    t75 = -t66/2.0+t70/2.0;
+    t76 = t75*t41;
+    t78 = -t73/2.0-t76/2.0;
+    t79 = IGM_SIN_Q(0);
+    t80 = t78*t79;
+    t81 = t62+t80;
+    t83 = IGM_COS_Q(2);
+    t84 = t81*t83;
+    t87 = -t73/2.0+t76/2.0;
+    t89 = IGM_SIN_Q(1);
+    t90 = t87*t89;
+    t91 = t59*t79;
+    t92 = t78*t61;
+    t93 = -t91+t92;
+    t94 = IGM_COS_Q(1);
+    t95 = t93*t94;
+    t97 = (-t90+t95)*t41;
+    t99 = t87*t94;
+    t100 = t93*t89;
+    t102 = (t99+t100)*t41;
+    t104 = t102/2.0-t97/2.0;
+    t105 = t104*t83;
+    t106 = IGM_SIN_Q(2);
+    t107 = t81*t106;
+    t108 = t105+t107;
+    t110 = IGM_SIN_Q(3);
+    t111 = t108*t110;
+    t113 = t104*t106;
+    t114 = -t113+t84;
+    t115 = IGM_COS_Q(3);
+    t116 = t114*t115;
+    t117 = -t111+t116;
+    t119 = IGM_SIN_Q(4);
+    t120 = t117*t119;
+    t123 = IGM_SIN_Q(13);
+    t124 = t72*t123;
+    t127 = IGM_COS_Q(12);
+    t128 = t59*t127;
+    t129 = -t75;
+    t130 = IGM_SIN_Q(12);
+    t131 = t129*t130;
+    t132 = t128+t131;
+    t133 = IGM_COS_Q(13);
+    t134 = t132*t133;
+    t135 = t134+t124;
+    t137 = IGM_COS_Q(15);
+    t140 = t59*t130;
+    t142 = t129*t127;
+    t145 = IGM_SIN_Q(15);
+    t146 = t135*t145;
+    t147 = -t140+t142;
+    t149 = IGM_SIN_Q(14);
+    t150 = t147*t149;
+    t151 = t132*t123;
+    t152 = t72*t133;
+    t153 = -t151+t152;
+    t154 = IGM_COS_Q(14);
+    t155 = t153*t154;
+    t156 = -t150+t155;
+    t157 = t156*t137;
+    t158 = -t146+t157;
+    t160 = IGM_SIN_Q(16);
+    t163 = t153*t149;
+    t165 = t108*t115;
+    t166 = t114*t110;
+    t167 = t165+t166;
+    t171 = IGM_SIN_Q(17);
+    t172 = t59*t171;
+    t173 = IGM_COS_Q(17);
+    t174 = t129*t173;
+    t175 = -t172+t174;
+    t177 = IGM_COS_Q(19);
+    t178 = t175*t177;
+    t179 = t59*t173;
+    t180 = t129*t171;
+    t181 = t179+t180;
+    t183 = IGM_SIN_Q(18);
+    t184 = t181*t183;
+    t185 = IGM_COS_Q(18);
+    t186 = t72*t185;
+    t187 = -t184+t186;
+    t188 = IGM_SIN_Q(19);
+    t189 = t187*t188;
+    t190 = t178+t189;
+    t192 = IGM_COS_Q(21);
+    t195 = 0.1078086072E-3*t84-0.1512290733E-3*t97-0.2893250095E-3*t111+
+0.1832763156E-3*t120+0.4677530128E-2*t124+0.2606799616E-2*t135*t137+
+0.9381437244E-4*t140-0.9381437244E-4*t142-0.1078086072E-3*t113+0.8051018213E-4*
+t158*t160-0.1702509553E-4*t163-0.8799425961E-3*t167*t119+0.8051018213E-4*t190*
+t192;
+    t197 = IGM_COS_Q(22);
+    t198 = t59*t197;
+    t200 = IGM_SIN_Q(22);
+    t201 = t72*t200;
+    t203 = IGM_COS_Q(16);
+    t208 = IGM_COS_Q(23);
+    t211 = t198+t201;
+    t212 = IGM_SIN_Q(23);
+    t215 = t181*t185;
+    t216 = t72*t183;
+    t217 = t215+t216;
+    t219 = IGM_SIN_Q(20);
+    t220 = t217*t219;
+    t221 = t175*t188;
+    t222 = t187*t177;
+    t223 = -t221+t222;
+    t224 = IGM_COS_Q(20);
+    t225 = t223*t224;
+    t226 = -t220+t225;
+    t232 = t147*t154;
+    t233 = t232+t163;
+    t238 = -0.3696711277E-6*t198-0.3696711277E-6*t201+0.7932620886E-4*t158*t203
+-0.5687628827E-3*t80-0.5082624939E-2*t129*t208+0.5082624939E-2*t211*t212
+-0.7932620886E-4*t226*t192+0.2893250095E-3*t116-0.1681938551E-1*t105
+-0.5687628827E-3*t62-0.7932620886E-4*t233*t160-0.1702509553E-4*t178
+-0.2570662873E-4*t179;
+    t248 = IGM_COS_Q(4);
+    t251 = t167*t248;
+    t252 = t251+t120;
+    t254 = IGM_COS_Q(5);
+    t260 = t102/2.0+t97/2.0;
+    t264 = -0.2570662873E-4*t180+0.8503258945E-4*t184-0.8503258945E-4*t186
+-0.1702509553E-4*t189-0.1232237092E-6*t221+0.4677530128E-2*t215-0.1681938551E-1
+*t107+0.2369931678E-4*t157+0.8799425961E-3*t117*t248-0.1081557015E-2*t252*t254+
+0.2606799616E-2*t156*t145-0.1112574236E-3*t260*t254-0.9419629563E-2*t166;
+    t270 = IGM_SIN_Q(21);
+    t279 = IGM_SIN_Q(5);
+    t285 = 0.1232237092E-6*t150-0.1232237092E-6*t155-0.9761137487E-4*t151+
+0.9761137487E-4*t152-0.9419629563E-2*t165+0.8051018213E-4*t226*t270+
+0.2606799616E-2*t223*t219+0.3775495252E-3*t211*t208+0.3775495252E-3*t129*t212
+-0.1081557015E-2*t260*t279+0.1232237092E-6*t222-0.2369931678E-4*t225+
+0.1832763156E-3*t251;
+    t302 = 0.4677530128E-2*t216+0.2606799616E-2*t217*t224-0.8318061448E-1*t19
+-0.9332037043E-1*t12+0.1832763156E-3*t5+0.1832763156E-3*t8-0.9332037043E-1*t15
+-0.2893250095E-3*t20+0.2893250095E-3*t21+0.8318061448E-1*t24+0.5687628827E-3*
+t28-0.1078086072E-3*t29-0.1078086072E-3*t30;
+    t316 = 0.5687628827E-3*t33-0.1607889161E-3*t51+0.9397174694E-4*t42+
+0.3024581465E-3*t43-0.3024581465E-3*t44-0.5737222431E-5*t46-0.1607889161E-3*t55
+-0.1659098766E-1*t66-0.4122466806E-3*t67+0.4122466806E-3*t68+0.6660372088E-1*
+t70-0.2061233404E-3*t73+0.2061233404E-3*t76;
+    t332 = -0.9970896939E-4*t99-0.101865705E-2*t37+0.8799425961E-3*t13
+-0.1112574236E-3*t6+0.4402844298E-1*t2+0.9999999999*RL[12]+0.101865705E-2*t58+
+0.1607889161E-3*t91-0.1607889161E-3*t92-0.9970896939E-4*t100+0.8823452451E-4*
+t95-0.8823452451E-4*t90+0.9381437244E-4*t172;
+    t351 = -0.9381437244E-4*t174+0.8051018213E-4*t233*t203-0.2369931678E-4*t146
+-0.1702509553E-4*t232+0.7932620886E-4*t190*t270+0.4677530128E-2*t134
+-0.2570662873E-4*t128-0.2570662873E-4*t131+0.2369931678E-4*t220-0.1512290733E-3
+*t102-0.8945848979E-4*t72*t197+0.8945848979E-4*t59*t200+0.1112574236E-3*t252*
+t279;
+    A[0] = t195+t238+t264+t285+t302+t316+t332+t351;
+    t354 = RL[9];
+    t355 = t354*t4;
+    t356 = RL[5];
+    t357 = t356*t7;
+    t358 = -t355-t357;
+    t359 = t358*t11;
+    t360 = RL[1];
+    t361 = t360*t14;
+    t362 = t359+t361;
+    t363 = t362*t18;
+    t364 = t358*t14;
+    t365 = t360*t11;
+    t366 = t364-t365;
+    t367 = t366*t23;
+    t368 = t363-t367;
+    t369 = t368*t27;
+    t370 = t362*t23;
+    t371 = t366*t18;
+    t372 = t370+t371;
+    t373 = t372*t32;
+    t374 = -t369-t373;
+    t375 = t374*t36;
+    t379 = (t368*t32-t372*t27)*t41;
+    t380 = t354*t7;
+    t381 = t356*t4;
+    t383 = (-t380+t381)*t41;
+    t385 = t379/2.0-t383/2.0;
+    t386 = t385*t50;
+    t388 = t379/2.0+t383/2.0;
+    t389 = t388*t54;
+    t390 = t386+t389;
+    t391 = t390*t57;
+    t392 = t375-t391;
+    t393 = t392*t197;
+    t397 = (t374*t57+t390*t36)*t41;
+    t398 = t385*t54;
+    t399 = t388*t50;
+    t401 = (-t398+t399)*t41;
+    t403 = t397/2.0+t401/2.0;
+    t404 = t403*t200;
+    t405 = t393+t404;
+    t408 = t392*t127;
+    t410 = t397/2.0-t401/2.0;
+    t411 = t410*t130;
+    t412 = t408+t411;
+    t413 = t412*t133;
+    t414 = t403*t123;
+    t415 = t413+t414;
+    t416 = t415*t145;
+    t417 = t392*t130;
+    t418 = t410*t127;
+    t419 = -t417+t418;
+    t420 = t419*t149;
+    t421 = t412*t123;
+    t422 = t403*t133;
+    t423 = -t421+t422;
+    t424 = t423*t154;
+    t425 = -t420+t424;
+    t426 = t425*t137;
+    t427 = -t416+t426;
+    t432 = t403*t41;
+    t434 = -t410*t41;
+    t436 = -t432/2.0+t434/2.0;
+    t437 = t436*t94;
+    t438 = t392*t79;
+    t440 = -t432/2.0-t434/2.0;
+    t441 = t440*t61;
+    t442 = -t438+t441;
+    t443 = t442*t89;
+    t445 = (t437+t443)*t41;
+    t446 = t436*t89;
+    t447 = t442*t94;
+    t449 = (-t446+t447)*t41;
+    t451 = t445/2.0-t449/2.0;
+    t452 = t451*t106;
+    t453 = t392*t61;
+    t454 = t440*t79;
+    t455 = t453+t454;
+    t456 = t455*t83;
+    t457 = -t452+t456;
+    t458 = t457*t115;
+    t460 = t451*t83;
+    t462 = t455*t106;
+    t463 = t460+t462;
+    t464 = t463*t115;
+    t465 = t457*t110;
+    t466 = t464+t465;
+    t467 = t466*t248;
+    t468 = t463*t110;
+    t469 = -t468+t458;
+    t470 = t469*t119;
+    t471 = t467+t470;
+    t476 = t392*t171;
+    t477 = t410*t173;
+    t478 = -t476+t477;
+    t479 = t478*t177;
+    t480 = t392*t173;
+    t481 = t410*t171;
+    t482 = t480+t481;
+    t483 = t482*t183;
+    t484 = t403*t185;
+    t485 = -t483+t484;
+    t486 = t485*t188;
+    t487 = t479+t486;
+    t495 = 0.5082624939E-2*t405*t212+0.8051018213E-4*t427*t160+0.3775495252E-3*
+t410*t212+0.2893250095E-3*t458-0.1681938551E-1*t460-0.1081557015E-2*t471*t254+
+0.1112574236E-3*t471*t279+0.8051018213E-4*t487*t192-0.2893250095E-3*t468+
+0.1607889161E-3*t438-0.1607889161E-3*t441-0.9970896939E-4*t443-0.1512290733E-3*
+t445;
+    t496 = t423*t149;
+    t510 = -0.1702509553E-4*t496+0.1832763156E-3*t355+0.1832763156E-3*t357
+-0.9332037043E-1*t359-0.3696711277E-6*t393-0.101865705E-2*t375-0.8318061448E-1*
+t363-0.9332037043E-1*t361-0.2893250095E-3*t364+0.2893250095E-3*t365+
+0.8318061448E-1*t367+0.5687628827E-3*t369-0.1078086072E-3*t370;
+    t521 = t445/2.0+t449/2.0;
+    t529 = t419*t154;
+    t530 = t529+t496;
+    t533 = -0.1078086072E-3*t371+0.5687628827E-3*t373-0.1607889161E-3*t386+
+0.9397174694E-4*t379+0.3024581465E-3*t380-0.3024581465E-3*t381-0.5737222431E-5*
+t383-0.1607889161E-3*t389-0.1112574236E-3*t521*t254-0.8945848979E-4*t403*t197+
+0.8945848979E-4*t392*t200+0.1832763156E-3*t470+0.8051018213E-4*t530*t203;
+    t548 = -0.1078086072E-3*t452+0.1078086072E-3*t456+0.4402844298E-1*t354
+-0.1112574236E-3*t356+0.8799425961E-3*t360+0.101865705E-2*t391-0.3696711277E-6*
+t404-0.1659098766E-1*t397-0.4122466806E-3*t398+0.4122466806E-3*t399+
+0.6660372088E-1*t401+0.3775495252E-3*t405*t208-0.2061233404E-3*t432;
+    t567 = 0.2061233404E-3*t434-0.9970896939E-4*t437+0.9999999999*RL[13]+
+0.8799425961E-3*t469*t248-0.9419629563E-2*t464-0.9419629563E-2*t465
+-0.8799425961E-3*t466*t119-0.2570662873E-4*t408-0.2570662873E-4*t480
+-0.2570662873E-4*t481+0.8503258945E-4*t483-0.8503258945E-4*t484-0.1702509553E-4
+*t486;
+    t568 = t485*t177;
+    t574 = t478*t188;
+    t576 = -t574+t568;
+    t580 = t576*t224;
+    t582 = t482*t185;
+    t584 = t403*t183;
+    t586 = t582+t584;
+    t587 = t586*t219;
+    t590 = -t587+t580;
+    t593 = 0.1232237092E-6*t568+0.9381437244E-4*t476-0.9381437244E-4*t477
+-0.5082624939E-2*t410*t208-0.1232237092E-6*t574+0.2606799616E-2*t576*t219+
+0.8823452451E-4*t447-0.2369931678E-4*t580+0.4677530128E-2*t582+0.4677530128E-2*
+t584+0.2369931678E-4*t587+0.1832763156E-3*t467+0.8051018213E-4*t590*t270;
+    t611 = -0.7932620886E-4*t590*t192-0.1702509553E-4*t479-0.1512290733E-3*t449
+-0.5687628827E-3*t453-0.5687628827E-3*t454+0.7932620886E-4*t487*t270+
+0.2606799616E-2*t586*t224-0.2570662873E-4*t411-0.9761137487E-4*t421+
+0.9761137487E-4*t422-0.1232237092E-6*t424+0.9381437244E-4*t417-0.9381437244E-4*
+t418;
+    t630 = 0.1232237092E-6*t420-0.1081557015E-2*t521*t279+0.2606799616E-2*t425*
+t145+0.2369931678E-4*t426+0.4677530128E-2*t413+0.4677530128E-2*t414
+-0.2369931678E-4*t416+0.2606799616E-2*t415*t137-0.1702509553E-4*t529
+-0.8823452451E-4*t446+0.7932620886E-4*t427*t203-0.7932620886E-4*t530*t160
+-0.1681938551E-1*t462;
+    A[1] = t495+t510+t533+t548+t567+t593+t611+t630;
+    t633 = RL[10];
+    t634 = t633*t4;
+    t635 = RL[6];
+    t636 = t635*t7;
+    t637 = -t634-t636;
+    t638 = t637*t11;
+    t639 = RL[2];
+    t640 = t639*t14;
+    t641 = t638+t640;
+    t642 = t641*t18;
+    t643 = t637*t14;
+    t644 = t639*t11;
+    t645 = t643-t644;
+    t646 = t645*t23;
+    t647 = t642-t646;
+    t648 = t647*t27;
+    t649 = t641*t23;
+    t650 = t645*t18;
+    t651 = t649+t650;
+    t652 = t651*t32;
+    t653 = -t648-t652;
+    t654 = t653*t36;
+    t658 = (t647*t32-t651*t27)*t41;
+    t659 = t633*t7;
+    t660 = t635*t4;
+    t662 = (-t659+t660)*t41;
+    t664 = t658/2.0-t662/2.0;
+    t665 = t664*t50;
+    t667 = t658/2.0+t662/2.0;
+    t668 = t667*t54;
+    t669 = t665+t668;
+    t670 = t669*t57;
+    t671 = t654-t670;
+    t672 = t671*t171;
+    t676 = (t653*t57+t669*t36)*t41;
+    t677 = t664*t54;
+    t678 = t667*t50;
+    t680 = (-t677+t678)*t41;
+    t682 = t676/2.0-t680/2.0;
+    t683 = t682*t173;
+    t684 = -t672+t683;
+    t685 = t684*t188;
+    t686 = t671*t173;
+    t687 = t682*t171;
+    t688 = t686+t687;
+    t689 = t688*t183;
+    t691 = t676/2.0+t680/2.0;
+    t692 = t691*t185;
+    t693 = -t689+t692;
+    t694 = t693*t177;
+    t695 = -t685+t694;
+    t698 = t688*t185;
+    t699 = t691*t183;
+    t700 = t698+t699;
+    t701 = t700*t219;
+    t702 = t695*t224;
+    t703 = -t701+t702;
+    t706 = t691*t41;
+    t708 = -t682*t41;
+    t710 = -t706/2.0+t708/2.0;
+    t711 = t710*t94;
+    t712 = t671*t79;
+    t714 = -t706/2.0-t708/2.0;
+    t715 = t714*t61;
+    t716 = -t712+t715;
+    t717 = t716*t89;
+    t719 = (t711+t717)*t41;
+    t720 = t710*t89;
+    t721 = t716*t94;
+    t723 = (-t720+t721)*t41;
+    t725 = t719/2.0-t723/2.0;
+    t726 = t725*t106;
+    t727 = t671*t61;
+    t728 = t714*t79;
+    t729 = t727+t728;
+    t730 = t729*t83;
+    t731 = -t726+t730;
+    t732 = t731*t110;
+    t734 = t684*t177;
+    t735 = t693*t188;
+    t736 = t734+t735;
+    t739 = t671*t130;
+    t740 = t682*t127;
+    t741 = -t739+t740;
+    t742 = t741*t149;
+    t743 = t671*t127;
+    t744 = t682*t130;
+    t745 = t743+t744;
+    t746 = t745*t123;
+    t747 = t691*t133;
+    t748 = -t746+t747;
+    t749 = t748*t154;
+    t750 = -t742+t749;
+    t757 = t671*t197;
+    t762 = 0.2606799616E-2*t695*t219+0.8051018213E-4*t703*t270-0.9419629563E-2*
+t732+0.8051018213E-4*t736*t192+0.2606799616E-2*t750*t145-0.8823452451E-4*t720+
+0.1832763156E-3*t634+0.1832763156E-3*t636-0.9332037043E-1*t638-0.3696711277E-6*
+t757-0.101865705E-2*t654-0.8318061448E-1*t642-0.9332037043E-1*t640;
+    t776 = -0.2893250095E-3*t643+0.2893250095E-3*t644+0.8318061448E-1*t646+
+0.5687628827E-3*t648-0.1078086072E-3*t649-0.1078086072E-3*t650+0.5687628827E-3*
+t652-0.1607889161E-3*t665+0.9397174694E-4*t658+0.3024581465E-3*t659
+-0.3024581465E-3*t660-0.5737222431E-5*t662-0.1607889161E-3*t668;
+    t779 = t691*t200;
+    t790 = t741*t154;
+    t791 = t748*t149;
+    t792 = t790+t791;
+    t795 = t745*t133;
+    t796 = t691*t123;
+    t797 = t795+t796;
+    t798 = t797*t145;
+    t801 = t731*t115;
+    t803 = t725*t83;
+    t805 = 0.101865705E-2*t670-0.3696711277E-6*t779-0.1659098766E-1*t676
+-0.4122466806E-3*t677+0.4122466806E-3*t678-0.8945848979E-4*t691*t197+
+0.8945848979E-4*t671*t200+0.3775495252E-3*t682*t212-0.7932620886E-4*t792*t160
+-0.2369931678E-4*t798-0.1702509553E-4*t790+0.2893250095E-3*t801-0.1681938551E-1
+*t803;
+    t815 = t719/2.0+t723/2.0;
+    t822 = -0.1512290733E-3*t719-0.2061233404E-3*t706+0.2061233404E-3*t708
+-0.9970896939E-4*t711+0.1607889161E-3*t712-0.1607889161E-3*t715+0.4677530128E-2
+*t699+0.2369931678E-4*t701-0.1081557015E-2*t815*t279-0.2570662873E-4*t744
+-0.9761137487E-4*t746+0.9761137487E-4*t747-0.1702509553E-4*t791;
+    t832 = t729*t106;
+    t833 = t803+t832;
+    t834 = t833*t115;
+    t835 = t834+t732;
+    t836 = t835*t248;
+    t837 = t833*t110;
+    t838 = -t837+t801;
+    t839 = t838*t119;
+    t840 = t836+t839;
+    t851 = t757+t779;
+    t854 = t750*t137;
+    t857 = -0.9970896939E-4*t717+0.8823452451E-4*t721-0.1702509553E-4*t735+
+0.2606799616E-2*t797*t137+0.9999999999*RL[14]-0.1081557015E-2*t840*t254
+-0.1112574236E-3*t815*t254+0.8051018213E-4*t792*t203+0.1112574236E-3*t840*t279
+-0.5082624939E-2*t682*t208+0.5082624939E-2*t851*t212+0.2369931678E-4*t854+
+0.4677530128E-2*t795;
+    t875 = 0.4677530128E-2*t796+0.1078086072E-3*t730+0.6660372088E-1*t680+
+0.3775495252E-3*t851*t208-0.8799425961E-3*t835*t119-0.2570662873E-4*t743+
+0.1832763156E-3*t839+0.7932620886E-4*t736*t270+0.2606799616E-2*t700*t224
+-0.2369931678E-4*t702+0.4677530128E-2*t698+0.1232237092E-6*t694+0.9381437244E-4
+*t672;
+    t882 = -t798+t854;
+    t894 = -0.9381437244E-4*t683-0.1232237092E-6*t685+0.8799425961E-3*t838*t248
+-0.9419629563E-2*t834+0.8051018213E-4*t882*t160+0.7932620886E-4*t882*t203
+-0.1232237092E-6*t749+0.9381437244E-4*t739-0.9381437244E-4*t740+0.1232237092E-6
+*t742-0.2570662873E-4*t686-0.2570662873E-4*t687+0.8503258945E-4*t689;
+    t909 = -0.8503258945E-4*t692-0.1512290733E-3*t723-0.5687628827E-3*t727
+-0.5687628827E-3*t728-0.1681938551E-1*t832-0.2893250095E-3*t837-0.7932620886E-4
+*t703*t192-0.1702509553E-4*t734-0.1078086072E-3*t726+0.1832763156E-3*t836+
+0.4402844298E-1*t633-0.1112574236E-3*t635+0.8799425961E-3*t639;
+    A[2] = t762+t776+t805+t822+t857+t875+t894+t909;
+    return;
+  }
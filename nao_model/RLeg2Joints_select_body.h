@@ -0,0 +1,1866 @@
+/* Generated using codegen (2012-02-13, 17:09:38) */ 
+/*
+ * Body of RLeg2Joints_select(), the IGM_* macros are described in maple_double.h.
+ * The statements are executed only if they are needed for the frames
+ * selected by the bit mask 'frames', which must be an argument of the
+ * instantiating function.
+ */
+  IGM_REAL t100;
+  IGM_REAL t101;
+  IGM_REAL t102;
+  IGM_REAL t106;
+  IGM_REAL t107;
+  IGM_REAL t108;
+  IGM_REAL t109;
+  IGM_REAL t11;
+  IGM_REAL t110;
+  IGM_REAL t112;
+  IGM_REAL t113;
+  IGM_REAL t115;
+  IGM_REAL t116;
+  IGM_REAL t117;
+  IGM_REAL t118;
+  IGM_REAL t119;
+  IGM_REAL t12;
+  IGM_REAL t120;
+  IGM_REAL t124;
+  IGM_REAL t125;
+  IGM_REAL t126;
+  IGM_REAL t127;
+  IGM_REAL t128;
+  IGM_REAL t13;
+  IGM_REAL t130;
+  IGM_REAL t131;
+  IGM_REAL t133;
+  IGM_REAL t134;
+  IGM_REAL t136;
+  IGM_REAL t137;
+  IGM_REAL t138;
+  IGM_REAL t139;
+  IGM_REAL t14;
+  IGM_REAL t140;
+  IGM_REAL t141;
+  IGM_REAL t142;
+  IGM_REAL t143;
+  IGM_REAL t144;
+  IGM_REAL t145;
+  IGM_REAL t146;
+  IGM_REAL t147;
+  IGM_REAL t148;
+  IGM_REAL t149;
+  IGM_REAL t15;
+  IGM_REAL t150;
+  IGM_REAL t151;
+  IGM_REAL t152;
+  IGM_REAL t153;
+  IGM_REAL t154;
+  IGM_REAL t155;
+  IGM_REAL t156;
+  IGM_REAL t157;
+  IGM_REAL t158;
+  IGM_REAL t159;
+  IGM_REAL t16;
+  IGM_REAL t163;
+  IGM_REAL t164;
+  IGM_REAL t165;
+  IGM_REAL t166;
+  IGM_REAL t167;
+  IGM_REAL t169;
+  IGM_REAL t170;
+  IGM_REAL t172;
+  IGM_REAL t173;
+  IGM_REAL t174;
+  IGM_REAL t175;
+  IGM_REAL t176;
+  IGM_REAL t177;
+  IGM_REAL t18;
+  IGM_REAL t181;
+  IGM_REAL t182;
+  IGM_REAL t183;
+  IGM_REAL t184;
+  IGM_REAL t185;
+  IGM_REAL t187;
+  IGM_REAL t188;
+  IGM_REAL t19;
+  IGM_REAL t190;
+  IGM_REAL t191;
+  IGM_REAL t193;
+  IGM_REAL t194;
+  IGM_REAL t195;
+  IGM_REAL t196;
+  IGM_REAL t197;
+  IGM_REAL t198;
+  IGM_REAL t199;
+  IGM_REAL t2;
+  IGM_REAL t20;
+  IGM_REAL t200;
+  IGM_REAL t204;
+  IGM_REAL t205;
+  IGM_REAL t206;
+  IGM_REAL t207;
+  IGM_REAL t208;
+  IGM_REAL t209;
+  IGM_REAL t21;
+  IGM_REAL t210;
+  IGM_REAL t211;
+  IGM_REAL t212;
+  IGM_REAL t213;
+  IGM_REAL t214;
+  IGM_REAL t215;
+  IGM_REAL t216;
+  IGM_REAL t217;
+  IGM_REAL t218;
+  IGM_REAL t219;
+  IGM_REAL t22;
+  IGM_REAL t220;
+  IGM_REAL t221;
+  IGM_REAL t222;
+  IGM_REAL t223;
+  IGM_REAL t224;
+  IGM_REAL t225;
+  IGM_REAL t226;
+  IGM_REAL t227;
+  IGM_REAL t228;
+  IGM_REAL t23;
+  IGM_REAL t230;
+  IGM_REAL t231;
+  IGM_REAL t232;
+  IGM_REAL t233;
+  IGM_REAL t234;
+  IGM_REAL t235;
+  IGM_REAL t236;
+  IGM_REAL t237;
+  IGM_REAL t238;
+  IGM_REAL t239;
+  IGM_REAL t24;
+  IGM_REAL t240;
+  IGM_REAL t241;
+  IGM_REAL t242;
+  IGM_REAL t243;
+  IGM_REAL t244;
+  IGM_REAL t245;
+  IGM_REAL t246;
+  IGM_REAL t247;
+  IGM_REAL t249;
+  IGM_REAL t25;
+  IGM_REAL t251;
+  IGM_REAL t252;
+  IGM_REAL t253;
+  IGM_REAL t254;
+  IGM_REAL t255;
+  IGM_REAL t256;
+  IGM_REAL t258;
+  IGM_REAL t259;
+  IGM_REAL t260;
+  IGM_REAL t261;
+  IGM_REAL t262;
+  IGM_REAL t264;
+  IGM_REAL t265;
+  IGM_REAL t266;
+  IGM_REAL t267;
+  IGM_REAL t268;
+  IGM_REAL t269;
+  IGM_REAL t27;
+  IGM_REAL t270;
+  IGM_REAL t271;
+  IGM_REAL t272;
+  IGM_REAL t277;
+  IGM_REAL t278;
+  IGM_REAL t279;
+  IGM_REAL t28;
+  IGM_REAL t280;
+  IGM_REAL t281;
+  IGM_REAL t282;
+  IGM_REAL t283;
+  IGM_REAL t284;
+  IGM_REAL t285;
+  IGM_REAL t286;
+  IGM_REAL t287;
+  IGM_REAL t288;
+  IGM_REAL t289;
+  IGM_REAL t29;
+  IGM_REAL t290;
+  IGM_REAL t291;
+  IGM_REAL t292;
+  IGM_REAL t293;
+  IGM_REAL t294;
+  IGM_REAL t295;
+  IGM_REAL t296;
+  IGM_REAL t298;
+  IGM_REAL t299;
+  IGM_REAL t30;
+  IGM_REAL t300;
+  IGM_REAL t301;
+  IGM_REAL t302;
+  IGM_REAL t303;
+  IGM_REAL t304;
+  IGM_REAL t305;
+  IGM_REAL t306;
+  IGM_REAL t307;
+  IGM_REAL t308;
+  IGM_REAL t309;
+  IGM_REAL t31;
+  IGM_REAL t310;
+  IGM_REAL t311;
+  IGM_REAL t312;
+  IGM_REAL t313;
+  IGM_REAL t314;
+  IGM_REAL t315;
+  IGM_REAL t316;
+  IGM_REAL t317;
+  IGM_REAL t319;
+  IGM_REAL t32;
+  IGM_REAL t320;
+  IGM_REAL t321;
+  IGM_REAL t322;
+  IGM_REAL t323;
+  IGM_REAL t324;
+  IGM_REAL t325;
+  IGM_REAL t326;
+  IGM_REAL t327;
+  IGM_REAL t328;
+  IGM_REAL t329;
+  IGM_REAL t33;
+  IGM_REAL t330;
+  IGM_REAL t331;
+  IGM_REAL t332;
+  IGM_REAL t333;
+  IGM_REAL t334;
+  IGM_REAL t335;
+  IGM_REAL t337;
+  IGM_REAL t338;
+  IGM_REAL t339;
+  IGM_REAL t34;
+  IGM_REAL t340;
+  IGM_REAL t341;
+  IGM_REAL t342;
+  IGM_REAL t343;
+  IGM_REAL t344;
+  IGM_REAL t345;
+  IGM_REAL t346;
+  IGM_REAL t347;
+  IGM_REAL t348;
+  IGM_REAL t349;
+  IGM_REAL t350;
+  IGM_REAL t351;
+  IGM_REAL t352;
+  IGM_REAL t353;
+  IGM_REAL t354;
+  IGM_REAL t355;
+  IGM_REAL t356;
+  IGM_REAL t357;
+  IGM_REAL t358;
+  IGM_REAL t359;
+  IGM_REAL t36;
+  IGM_REAL t361;
+  IGM_REAL t362;
+  IGM_REAL t363;
+  IGM_REAL t364;
+  IGM_REAL t365;
+  IGM_REAL t366;
+  IGM_REAL t367;
+  IGM_REAL t368;
+  IGM_REAL t369;
+  IGM_REAL t37;
+  IGM_REAL t370;
+  IGM_REAL t371;
+  IGM_REAL t372;
+  IGM_REAL t373;
+  IGM_REAL t374;
+  IGM_REAL t376;
+  IGM_REAL t377;
+  IGM_REAL t378;
+  IGM_REAL t379;
+  IGM_REAL t380;
+  IGM_REAL t381;
+  IGM_REAL t382;
+  IGM_REAL t383;
+  IGM_REAL t384;
+  IGM_REAL t385;
+  IGM_REAL t386;
+  IGM_REAL t387;
+  IGM_REAL t388;
+  IGM_REAL t389;
+  IGM_REAL t390;
+  IGM_REAL t391;
+  IGM_REAL t392;
+  IGM_REAL t393;
+  IGM_REAL t394;
+  IGM_REAL t395;
+  IGM_REAL t397;
+  IGM_REAL t398;
+  IGM_REAL t399;
+  IGM_REAL t4;
+  IGM_REAL t400;
+  IGM_REAL t401;
+  IGM_REAL t402;
+  IGM_REAL t403;
+  IGM_REAL t404;
+  IGM_REAL t405;
+  IGM_REAL t406;
+  IGM_REAL t407;
+  IGM_REAL t408;
+  IGM_REAL t409;
+  IGM_REAL t41;
+  IGM_REAL t410;
+  IGM_REAL t412;
+  IGM_REAL t413;
+  IGM_REAL t414;
+  IGM_REAL t415;
+  IGM_REAL t416;
+  IGM_REAL t417;
+  IGM_REAL t418;
+  IGM_REAL t419;
+  IGM_REAL t42;
+  IGM_REAL t420;
+  IGM_REAL t421;
+  IGM_REAL t422;
+  IGM_REAL t423;
+  IGM_REAL t424;
+  IGM_REAL t425;
+  IGM_REAL t43;
+  IGM_REAL t433;
+  IGM_REAL t434;
+  IGM_REAL t435;
+  IGM_REAL t436;
+  IGM_REAL t437;
+  IGM_REAL t438;
+  IGM_REAL t439;
+  IGM_REAL t44;
+  IGM_REAL t440;
+  IGM_REAL t441;
+  IGM_REAL t442;
+  IGM_REAL t443;
+  IGM_REAL t444;
+  IGM_REAL t445;
+  IGM_REAL t446;
+  IGM_REAL t447;
+  IGM_REAL t448;
+  IGM_REAL t449;
+  IGM_REAL t45;
+  IGM_REAL t450;
+  IGM_REAL t451;
+  IGM_REAL t452;
+  IGM_REAL t454;
+  IGM_REAL t455;
+  IGM_REAL t456;
+  IGM_REAL t457;
+  IGM_REAL t458;
+  IGM_REAL t459;
+  IGM_REAL t46;
+  IGM_REAL t460;
+  IGM_REAL t461;
+  IGM_REAL t462;
+  IGM_REAL t463;
+  IGM_REAL t464;
+  IGM_REAL t465;
+  IGM_REAL t466;
+  IGM_REAL t467;
+  IGM_REAL t469;
+  IGM_REAL t470;
+  IGM_REAL t471;
+  IGM_REAL t472;
+  IGM_REAL t473;
+  IGM_REAL t474;
+  IGM_REAL t475;
+  IGM_REAL t476;
+  IGM_REAL t477;
+  IGM_REAL t478;
+  IGM_REAL t479;
+  IGM_REAL t48;
+  IGM_REAL t480;
+  IGM_REAL t481;
+  IGM_REAL t482;
+  IGM_REAL t483;
+  IGM_REAL t484;
+  IGM_REAL t485;
+  IGM_REAL t486;
+  IGM_REAL t487;
+  IGM_REAL t488;
+  IGM_REAL t490;
+  IGM_REAL t491;
+  IGM_REAL t492;
+  IGM_REAL t493;
+  IGM_REAL t494;
+  IGM_REAL t495;
+  IGM_REAL t496;
+  IGM_REAL t497;
+  IGM_REAL t498;
+  IGM_REAL t499;
+  IGM_REAL t5;
+  IGM_REAL t50;
+  IGM_REAL t500;
+  IGM_REAL t501;
+  IGM_REAL t502;
+  IGM_REAL t503;
+  IGM_REAL t505;
+  IGM_REAL t506;
+  IGM_REAL t507;
+  IGM_REAL t508;
+  IGM_REAL t509;
+  IGM_REAL t51;
+  IGM_REAL t510;
+  IGM_REAL t511;
+  IGM_REAL t512;
+  IGM_REAL t513;
+  IGM_REAL t514;
+  IGM_REAL t515;
+  IGM_REAL t516;
+  IGM_REAL t517;
+  IGM_REAL t518;
+  IGM_REAL t526;
+  IGM_REAL t527;
+  IGM_REAL t528;
+  IGM_REAL t529;
+  IGM_REAL t53;
+  IGM_REAL t530;
+  IGM_REAL t531;
+  IGM_REAL t532;
+  IGM_REAL t533;
+  IGM_REAL t534;
+  IGM_REAL t535;
+  IGM_REAL t536;
+  IGM_REAL t537;
+  IGM_REAL t538;
+  IGM_REAL t539;
+  IGM_REAL t54;
+  IGM_REAL t547;
+  IGM_REAL t548;
+  IGM_REAL t549;
+  IGM_REAL t55;
+  IGM_REAL t550;
+  IGM_REAL t551;
+  IGM_REAL t552;
+  IGM_REAL t553;
+  IGM_REAL t554;
+  IGM_REAL t555;
+  IGM_REAL t556;
+  IGM_REAL t557;
+  IGM_REAL t558;
+  IGM_REAL t559;
+  IGM_REAL t56;
+  IGM_REAL t560;
+  IGM_REAL t57;
+  IGM_REAL t58;
+  IGM_REAL t59;
+  IGM_REAL t6;
+  IGM_REAL t61;
+  IGM_REAL t610;
+  IGM_REAL t62;
+  IGM_REAL t624;
+  IGM_REAL t639;
+  IGM_REAL t653;
+  IGM_REAL t66;
+  IGM_REAL t669;
+  IGM_REAL t67;
+  IGM_REAL t68;
+  IGM_REAL t683;
+  IGM_REAL t69;
+  IGM_REAL t698;
+  IGM_REAL t7;
+  IGM_REAL t70;
+  IGM_REAL t712;
+  IGM_REAL t72;
+  IGM_REAL t728;
+  IGM_REAL t73;
+  IGM_REAL t742;
+  IGM_REAL t75;
+  IGM_REAL t757;
+  IGM_REAL t76;
+  IGM_REAL t771;
+  IGM_REAL t78;
+  IGM_REAL t787;
+  IGM_REAL t79;
+  IGM_REAL t8;
+  IGM_REAL t80;
+  IGM_REAL t801;
+  IGM_REAL t81;
+  IGM_REAL t816;
+  IGM_REAL t82;
+  IGM_REAL t83;
+  IGM_REAL t830;
+  IGM_REAL t84;
+  IGM_REAL t846;
+  IGM_REAL t85;
+  IGM_REAL t86;
+  IGM_REAL t860;
+  IGM_REAL t87;
+  IGM_REAL t875;
+  IGM_REAL t88;
+  IGM_REAL t889;
+  IGM_REAL t89;
+  IGM_REAL t9;
+  IGM_REAL t90;
+  IGM_REAL t905;
+  IGM_REAL t91;
+  IGM_REAL t919;
+  IGM_REAL t92;
+  IGM_REAL t93;
+  IGM_REAL t934;
+  IGM_REAL t94;
+  IGM_REAL t948;
+  IGM_REAL t95;
+  IGM_REAL t96;
+  IGM_REAL t97;
+  IGM_REAL t98;
+  IGM_REAL t99;
+  {
+    if ((frames & 0x7fffffffu) != 0)
+    {
+        t2 = RL[8];
+        t6 = RL[4];
+        t13 = RL[0];
+        t81 = RL[9];
+        t83 = RL[5];
+        t87 = RL[1];
+        t138 = RL[10];
+        t140 = RL[6];
+        t144 = RL[2];
+        t211 = RL[12];
+        t219 = RL[13];
+        t227 = RL[14];
+    }
+    if ((frames & 0x7bfff7ffu) != 0)
+    {
+        t4 = IGM_COS_Q(11);
+        t5 = t2*t4;
+        t7 = IGM_SIN_Q(11);
+        t8 = t6*t7;
+        t9 = -t5-t8;
+        t43 = t2*t7;
+        t44 = t6*t4;
+        t45 = -t43+t44;
+        t82 = t81*t4;
+        t84 = t83*t7;
+        t85 = -t82-t84;
+        t107 = t81*t7;
+        t108 = t83*t4;
+        t109 = -t107+t108;
+        t139 = t138*t4;
+        t141 = t140*t7;
+        t142 = -t139-t141;
+        t164 = t138*t7;
+        t165 = t140*t4;
+        t166 = -t164+t165;
+    }
+    if ((frames & 0x7bfff3ffu) != 0)
+    {
+        t11 = IGM_COS_Q(10);
+        t12 = t9*t11;
+        t14 = IGM_SIN_Q(10);
+        t15 = t13*t14;
+        t16 = t12+t15;
+        t20 = t9*t14;
+        t21 = t13*t11;
+        t22 = t20-t21;
+        t86 = t85*t11;
+        t88 = t87*t14;
+        t89 = t86+t88;
+        t91 = t85*t14;
+        t92 = t87*t11;
+        t93 = t91-t92;
+        t143 = t142*t11;
+        t145 = t144*t14;
+        t146 = t143+t145;
+        t148 = t142*t14;
+        t149 = t144*t11;
+        t150 = t148-t149;
+    }
+    if ((frames & 0x7bfff1ffu) != 0)
+    {
+        t18 = IGM_COS_Q(9);
+        t19 = t16*t18;
+        t23 = IGM_SIN_Q(9);
+        t24 = t22*t23;
+        t25 = t19-t24;
+        t29 = t16*t23;
+        t30 = t22*t18;
+        t31 = t29+t30;
+        t90 = t89*t18;
+        t94 = t93*t23;
+        t95 = t90-t94;
+        t97 = t89*t23;
+        t98 = t93*t18;
+        t99 = t97+t98;
+        t147 = t146*t18;
+        t151 = t150*t23;
+        t152 = t147-t151;
+        t154 = t146*t23;
+        t155 = t150*t18;
+        t156 = t154+t155;
+    }
+    if ((frames & 0x7bfff0ffu) != 0)
+    {
+        t27 = IGM_SIN_Q(8);
+        t28 = t25*t27;
+        t32 = IGM_COS_Q(8);
+        t33 = t31*t32;
+        t34 = -t28-t33;
+        t41 = IGM_CONST(sqrt(2.0));
+        t42 = (t25*t32-t31*t27)*t41;
+        t46 = t45*t41;
+        t48 = t42/2.0-t46/2.0;
+        t53 = t42/2.0+t46/2.0;
+        t96 = t95*t27;
+        t100 = t99*t32;
+        t101 = -t96-t100;
+        t106 = (t95*t32-t99*t27)*t41;
+        t110 = t109*t41;
+        t112 = t106/2.0-t110/2.0;
+        t115 = t106/2.0+t110/2.0;
+        t153 = t152*t27;
+        t157 = t156*t32;
+        t158 = -t153-t157;
+        t163 = (t152*t32-t156*t27)*t41;
+        t167 = t166*t41;
+        t169 = t163/2.0-t167/2.0;
+        t172 = t163/2.0+t167/2.0;
+    }
+    if ((frames & 0x7bfff03fu) != 0)
+    {
+        t36 = IGM_COS_Q(6);
+        t37 = t34*t36;
+        t57 = IGM_SIN_Q(6);
+        t102 = t101*t36;
+        t159 = t158*t36;
+    }
+    if ((frames & 0x7bfff07fu) != 0)
+    {
+        t50 = IGM_SIN_Q(7);
+        t51 = t48*t50;
+        t54 = IGM_COS_Q(7);
+        t55 = t53*t54;
+        t56 = t51+t55;
+        t67 = t48*t54;
+        t68 = t53*t50;
+        t69 = -t67+t68;
+        t113 = t112*t50;
+        t116 = t115*t54;
+        t117 = t113+t116;
+        t125 = t112*t54;
+        t126 = t115*t50;
+        t127 = -t125+t126;
+        t170 = t169*t50;
+        t173 = t172*t54;
+        t174 = t170+t173;
+        t182 = t169*t54;
+        t183 = t172*t50;
+        t184 = -t182+t183;
+    }
+    if ((frames & 0x7bfff03fu) != 0)
+    {
+        t58 = t56*t57;
+        t59 = t37-t58;
+        t66 = (t34*t57+t56*t36)*t41;
+        t70 = t69*t41;
+        t72 = t66/2.0+t70/2.0;
+        t75 = -t66/2.0+t70/2.0;
+        t118 = t117*t57;
+        t119 = t102-t118;
+        t124 = (t101*t57+t117*t36)*t41;
+        t128 = t127*t41;
+        t130 = t124/2.0+t128/2.0;
+        t133 = -t124/2.0+t128/2.0;
+        t175 = t174*t57;
+        t176 = t159-t175;
+        t181 = (t158*t57+t174*t36)*t41;
+        t185 = t184*t41;
+        t187 = t181/2.0+t185/2.0;
+        t190 = -t181/2.0+t185/2.0;
+    }
+    if ((frames & 0x4200003fu) != 0)
+    {
+        t61 = IGM_COS_Q(0);
+        t62 = t59*t61;
+        t73 = t72*t41;
+        t76 = t75*t41;
+        t78 = -t73/2.0-t76/2.0;
+        t79 = IGM_SIN_Q(0);
+        t80 = t78*t79;
+        A[0] = t62+t80;
+        t120 = t119*t61;
+        t131 = t130*t41;
+        t134 = t133*t41;
+        t136 = -t131/2.0-t134/2.0;
+        t137 = t136*t79;
+        A[1] = t120+t137;
+        t177 = t176*t61;
+        t188 = t187*t41;
+        t191 = t190*t41;
+        t193 = -t188/2.0-t191/2.0;
+        t194 = t193*t79;
+        A[2] = t177+t194;
+        t195 = t59*t79;
+        t196 = t78*t61;
+        A[4] = -t195+t196;
+        t197 = t119*t79;
+        t198 = t136*t61;
+        A[5] = -t197+t198;
+        t199 = t176*t79;
+        t200 = t193*t61;
+        A[6] = -t199+t200;
+        A[8] = t73/2.0-t76/2.0;
+        A[9] = t131/2.0-t134/2.0;
+        A[10] = t188/2.0-t191/2.0;
+    }
+    if ((frames & 0x00000001u) != 0)
+    {
+        A[3] = IGM_CONST(0.0);
+        A[7] = IGM_CONST(0.0);
+        A[11] = IGM_CONST(0.0);
+        A[15] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x0200003fu) != 0)
+    {
+        t204 = 0.5E-1*t66;
+        t205 = 0.5E-1*t70;
+        t212 = 0.5E-1*t124;
+        t213 = 0.5E-1*t128;
+        t220 = 0.5E-1*t181;
+        t221 = 0.5E-1*t185;
+    }
+    if ((frames & 0x3bfff1ffu) != 0)
+    {
+        t206 = 0.1*t19;
+        t207 = 0.1*t24;
+        t214 = 0.1*t90;
+        t215 = 0.1*t94;
+        t222 = 0.1*t147;
+        t223 = 0.1*t151;
+    }
+    if ((frames & 0x3bfff3ffu) != 0)
+    {
+        t208 = 0.10274*t12;
+        t209 = 0.10274*t15;
+        t216 = 0.10274*t86;
+        t217 = 0.10274*t88;
+        t224 = 0.10274*t143;
+        t225 = 0.10274*t145;
+    }
+    if ((frames & 0x3bffffffu) != 0)
+    {
+        t210 = 0.4511E-1*t2;
+        t218 = 0.4511E-1*t81;
+        t226 = 0.4511E-1*t138;
+    }
+    if ((frames & 0x00000007u) != 0)
+    {
+        A[12] = t204+t205-t206+t207-t208-t209+t210+t211;
+        A[13] = t212+t213-t214+t215-t216-t217+t218+t219;
+        A[14] = t220+t221-t222+t223-t224-t225+t226+t227;
+    }
+    if ((frames & 0x4200003eu) != 0)
+    {
+        t228 = -A[8];
+        t230 = IGM_COS_Q(1);
+        t231 = t228*t230;
+        t232 = IGM_SIN_Q(1);
+        t233 = A[4]*t232;
+        A[16] = t231+t233;
+        t234 = -A[9];
+        t235 = t234*t230;
+        t236 = A[5]*t232;
+        A[17] = t235+t236;
+        t237 = -A[10];
+        t238 = t237*t230;
+        t239 = A[6]*t232;
+        A[18] = t238+t239;
+        t240 = t228*t232;
+        t241 = A[4]*t230;
+        A[20] = -t240+t241;
+        t242 = t234*t232;
+        t243 = A[5]*t230;
+        A[21] = -t242+t243;
+        t244 = t237*t232;
+        t245 = A[6]*t230;
+        A[22] = -t244+t245;
+        A[24] = A[0];
+        A[25] = A[1];
+        A[26] = A[2];
+    }
+    if ((frames & 0x00000002u) != 0)
+    {
+        A[19] = IGM_CONST(0.0);
+        A[23] = IGM_CONST(0.0);
+        A[27] = IGM_CONST(0.0);
+        A[31] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x00000006u) != 0)
+    {
+        A[28] = A[12];
+        A[29] = A[13];
+        A[30] = A[14];
+    }
+    if ((frames & 0x4200003cu) != 0)
+    {
+        t246 = A[16]*t41;
+        t247 = A[20]*t41;
+        t249 = t246/2.0-t247/2.0;
+        t251 = IGM_COS_Q(2);
+        t252 = t249*t251;
+        t253 = IGM_SIN_Q(2);
+        t254 = A[24]*t253;
+        A[32] = t252+t254;
+        t255 = A[17]*t41;
+        t256 = A[21]*t41;
+        t258 = t255/2.0-t256/2.0;
+        t259 = t258*t251;
+        t260 = A[25]*t253;
+        A[33] = t259+t260;
+        t261 = A[18]*t41;
+        t262 = A[22]*t41;
+        t264 = t261/2.0-t262/2.0;
+        t265 = t264*t251;
+        t266 = A[26]*t253;
+        A[34] = t265+t266;
+        t267 = t249*t253;
+        t268 = A[24]*t251;
+        A[36] = -t267+t268;
+        t269 = t258*t253;
+        t270 = A[25]*t251;
+        A[37] = -t269+t270;
+        t271 = t264*t253;
+        t272 = A[26]*t251;
+        A[38] = -t271+t272;
+        A[40] = -t246/2.0-t247/2.0;
+        A[41] = -t255/2.0-t256/2.0;
+        A[42] = -t261/2.0-t262/2.0;
+    }
+    if ((frames & 0x00000004u) != 0)
+    {
+        A[35] = IGM_CONST(0.0);
+        A[39] = IGM_CONST(0.0);
+        A[43] = IGM_CONST(0.0);
+        A[44] = A[28];
+        A[45] = A[29];
+        A[46] = A[30];
+        A[47] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x42000038u) != 0)
+    {
+        t277 = IGM_COS_Q(3);
+        t278 = A[32]*t277;
+        t279 = IGM_SIN_Q(3);
+        t280 = A[36]*t279;
+        A[48] = t278+t280;
+        t281 = A[33]*t277;
+        t282 = A[37]*t279;
+        A[49] = t281+t282;
+        t283 = A[34]*t277;
+        t284 = A[38]*t279;
+        A[50] = t283+t284;
+        t285 = A[32]*t279;
+        t286 = A[36]*t277;
+        A[52] = -t285+t286;
+        t287 = A[33]*t279;
+        t288 = A[37]*t277;
+        A[53] = -t287+t288;
+        t289 = A[34]*t279;
+        t290 = A[38]*t277;
+        A[54] = -t289+t290;
+        A[56] = A[40];
+        A[57] = A[41];
+        A[58] = A[42];
+    }
+    if ((frames & 0x00000008u) != 0)
+    {
+        A[51] = IGM_CONST(0.0);
+        A[55] = IGM_CONST(0.0);
+        A[59] = IGM_CONST(0.0);
+        A[63] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x02000038u) != 0)
+    {
+        t291 = 0.1*t252;
+        t292 = 0.1*t254;
+        t293 = 0.1*t259;
+        t294 = 0.1*t260;
+        t295 = 0.1*t265;
+        t296 = 0.1*t266;
+    }
+    if ((frames & 0x00000008u) != 0)
+    {
+        A[60] = -t291-t292+t204+t205-t206+t207-t208-t209+t210+t211;
+        A[61] = -t293-t294+t212+t213-t214+t215-t216-t217+t218+t219;
+        A[62] = -t295-t296+t220+t221-t222+t223-t224-t225+t226+t227;
+    }
+    if ((frames & 0x42000030u) != 0)
+    {
+        t298 = IGM_COS_Q(4);
+        t299 = A[48]*t298;
+        t300 = IGM_SIN_Q(4);
+        t301 = A[52]*t300;
+        A[64] = t299+t301;
+        t302 = A[49]*t298;
+        t303 = A[53]*t300;
+        A[65] = t302+t303;
+        t304 = A[50]*t298;
+        t305 = A[54]*t300;
+        A[66] = t304+t305;
+        t306 = A[48]*t300;
+        t307 = A[52]*t298;
+        t308 = A[49]*t300;
+        t309 = A[53]*t298;
+        t310 = A[50]*t300;
+        t311 = A[54]*t298;
+        A[72] = A[56];
+        A[73] = A[57];
+        A[74] = A[58];
+    }
+    if ((frames & 0x00000010u) != 0)
+    {
+        A[67] = IGM_CONST(0.0);
+        A[71] = IGM_CONST(0.0);
+        A[75] = IGM_CONST(0.0);
+        A[79] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x02000030u) != 0)
+    {
+        A[68] = -t306+t307;
+        A[69] = -t308+t309;
+        A[70] = -t310+t311;
+        t312 = 0.10274*t278;
+        t313 = 0.10274*t280;
+        t314 = 0.10274*t281;
+        t315 = 0.10274*t282;
+        t316 = 0.10274*t283;
+        t317 = 0.10274*t284;
+    }
+    if ((frames & 0x00000030u) != 0)
+    {
+        A[76] = -t312-t313-t291-t292+t204+t205-t206+t207-t208-t209+t210+t211;
+        A[77] = -t314-t315-t293-t294+t212+t213-t214+t215-t216-t217+t218+t219;
+        A[78] = -t316-t317-t295-t296+t220+t221-t222+t223-t224-t225+t226+t227;
+    }
+    if ((frames & 0x42000020u) != 0)
+    {
+        t319 = IGM_COS_Q(5);
+        t320 = A[64]*t319;
+        t321 = -A[72];
+        t322 = IGM_SIN_Q(5);
+        t323 = t321*t322;
+        t324 = A[65]*t319;
+        t325 = -A[73];
+        t326 = t325*t322;
+        t327 = A[66]*t319;
+        t328 = -A[74];
+        t329 = t328*t322;
+        t330 = A[64]*t322;
+        t331 = t321*t319;
+        t332 = A[65]*t322;
+        t333 = t325*t319;
+        t334 = A[66]*t322;
+        t335 = t328*t319;
+    }
+    if ((frames & 0x02000020u) != 0)
+    {
+        A[80] = t320+t323;
+        A[81] = t324+t326;
+        A[82] = t327+t329;
+        A[84] = -t330+t331;
+        A[85] = -t332+t333;
+        A[86] = -t334+t335;
+        A[88] = A[68];
+        A[89] = A[69];
+        A[90] = A[70];
+    }
+    if ((frames & 0x00000020u) != 0)
+    {
+        A[83] = IGM_CONST(0.0);
+        A[87] = IGM_CONST(0.0);
+        A[91] = IGM_CONST(0.0);
+        A[92] = A[76];
+        A[93] = A[77];
+        A[94] = A[78];
+        A[95] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x000000c0u) != 0)
+    {
+        A[96] = t34;
+        A[97] = t101;
+        A[98] = t158;
+    }
+    if ((frames & 0x00000040u) != 0)
+    {
+        A[99] = IGM_CONST(0.0);
+        A[100] = t56;
+        A[101] = t117;
+        A[102] = t174;
+        A[103] = IGM_CONST(0.0);
+        A[104] = t69;
+        A[105] = t127;
+        A[106] = t184;
+        A[107] = IGM_CONST(0.0);
+        A[111] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x000001c0u) != 0)
+    {
+        A[108] = -t206+t207-t208-t209+t210+t211;
+        A[109] = -t214+t215-t216-t217+t218+t219;
+        A[110] = -t222+t223-t224-t225+t226+t227;
+    }
+    if ((frames & 0x00000080u) != 0)
+    {
+        A[112] = t48;
+        A[113] = t112;
+        A[114] = t169;
+        A[115] = IGM_CONST(0.0);
+        A[116] = t53;
+        A[117] = t115;
+        A[118] = t172;
+        A[119] = IGM_CONST(0.0);
+        A[120] = A[96];
+        A[121] = A[97];
+        A[122] = A[98];
+        A[123] = IGM_CONST(0.0);
+        A[127] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x00000180u) != 0)
+    {
+        A[124] = A[108];
+        A[125] = A[109];
+        A[126] = A[110];
+    }
+    if ((frames & 0x00000100u) != 0)
+    {
+        A[128] = t25;
+        A[129] = t95;
+        A[130] = t152;
+        A[131] = IGM_CONST(0.0);
+        A[132] = t31;
+        A[133] = t99;
+        A[134] = t156;
+        A[135] = IGM_CONST(0.0);
+        A[139] = IGM_CONST(0.0);
+        A[140] = A[124];
+        A[141] = A[125];
+        A[142] = A[126];
+        A[143] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x00000700u) != 0)
+    {
+        A[136] = t45;
+        A[137] = t109;
+        A[138] = t166;
+    }
+    if ((frames & 0x00000200u) != 0)
+    {
+        A[144] = t16;
+        A[145] = t89;
+        A[146] = t146;
+        A[147] = IGM_CONST(0.0);
+        A[148] = t22;
+        A[149] = t93;
+        A[150] = t150;
+        A[151] = IGM_CONST(0.0);
+        A[155] = IGM_CONST(0.0);
+        A[156] = -t208-t209+t210+t211;
+        A[157] = -t216-t217+t218+t219;
+        A[158] = -t224-t225+t226+t227;
+        A[159] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x00000600u) != 0)
+    {
+        A[152] = A[136];
+        A[153] = A[137];
+        A[154] = A[138];
+    }
+    if ((frames & 0x00000400u) != 0)
+    {
+        A[160] = t9;
+        A[161] = t85;
+        A[162] = t142;
+        A[163] = IGM_CONST(0.0);
+        A[164] = -t13;
+        A[165] = -t87;
+        A[166] = -t144;
+        A[167] = IGM_CONST(0.0);
+        A[168] = A[152];
+        A[169] = A[153];
+        A[170] = A[154];
+        A[171] = IGM_CONST(0.0);
+        A[175] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x00000c00u) != 0)
+    {
+        A[172] = t210+t211;
+        A[173] = t218+t219;
+        A[174] = t226+t227;
+    }
+    if ((frames & 0x00000800u) != 0)
+    {
+        A[176] = -t2;
+        A[177] = -t81;
+        A[178] = -t138;
+        A[179] = IGM_CONST(0.0);
+        A[183] = IGM_CONST(0.0);
+        A[187] = IGM_CONST(0.0);
+        A[188] = A[172];
+        A[189] = A[173];
+        A[190] = A[174];
+        A[191] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x44000800u) != 0)
+    {
+        A[180] = t6;
+        A[181] = t83;
+        A[182] = t140;
+        A[184] = t13;
+        A[185] = t87;
+        A[186] = t144;
+    }
+    if ((frames & 0x4801f000u) != 0)
+    {
+        t337 = IGM_COS_Q(12);
+        t338 = t59*t337;
+        t340 = IGM_SIN_Q(12);
+        t342 = t119*t337;
+        t345 = t176*t337;
+        t348 = t59*t340;
+        t350 = t119*t340;
+        t352 = t176*t340;
+    }
+    if ((frames & 0x78bff000u) != 0)
+    {
+        t339 = -t75;
+        t343 = -t133;
+        t346 = -t190;
+    }
+    if ((frames & 0x4801f000u) != 0)
+    {
+        t341 = t339*t340;
+        A[192] = t338+t341;
+        t344 = t343*t340;
+        A[193] = t342+t344;
+        t347 = t346*t340;
+        A[194] = t345+t347;
+        t349 = t339*t337;
+        A[196] = -t348+t349;
+        t351 = t343*t337;
+        A[197] = -t350+t351;
+        t353 = t346*t337;
+        A[198] = -t352+t353;
+    }
+    if ((frames & 0x00001000u) != 0)
+    {
+        A[195] = IGM_CONST(0.0);
+        A[199] = IGM_CONST(0.0);
+        A[203] = IGM_CONST(0.0);
+        A[207] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x79fff000u) != 0)
+    {
+        A[200] = t72;
+        A[201] = t130;
+        A[202] = t187;
+    }
+    if ((frames & 0x0801f000u) != 0)
+    {
+        t354 = 0.185E-1*t66;
+        t355 = 0.1665*t70;
+        t356 = 0.185E-1*t124;
+        t357 = 0.1665*t128;
+        t358 = 0.185E-1*t181;
+        t359 = 0.1665*t185;
+    }
+    if ((frames & 0x00003000u) != 0)
+    {
+        A[204] = -t354+t355-t206+t207-t208-t209+t210+t211;
+        A[205] = -t356+t357-t214+t215-t216-t217+t218+t219;
+        A[206] = -t358+t359-t222+t223-t224-t225+t226+t227;
+    }
+    if ((frames & 0x4801e000u) != 0)
+    {
+        t361 = IGM_COS_Q(13);
+        t362 = A[192]*t361;
+        t363 = IGM_SIN_Q(13);
+        t364 = A[200]*t363;
+        A[208] = t362+t364;
+        t365 = A[193]*t361;
+        t366 = A[201]*t363;
+        A[209] = t365+t366;
+        t367 = A[194]*t361;
+        t368 = A[202]*t363;
+        A[210] = t367+t368;
+        t369 = A[192]*t363;
+        t370 = A[200]*t361;
+        A[212] = -t369+t370;
+        t371 = A[193]*t363;
+        t372 = A[201]*t361;
+        A[213] = -t371+t372;
+        t373 = A[194]*t363;
+        t374 = A[202]*t361;
+        A[214] = -t373+t374;
+    }
+    if ((frames & 0x00002000u) != 0)
+    {
+        A[211] = IGM_CONST(0.0);
+        A[215] = IGM_CONST(0.0);
+        A[216] = -A[196];
+        A[217] = -A[197];
+        A[218] = -A[198];
+        A[219] = IGM_CONST(0.0);
+        A[220] = A[204];
+        A[221] = A[205];
+        A[222] = A[206];
+        A[223] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x4801c000u) != 0)
+    {
+        t376 = IGM_COS_Q(14);
+        t377 = A[196]*t376;
+        t378 = IGM_SIN_Q(14);
+        t379 = A[212]*t378;
+        A[224] = t377+t379;
+        t380 = A[197]*t376;
+        t381 = A[213]*t378;
+        A[225] = t380+t381;
+        t382 = A[198]*t376;
+        t383 = A[214]*t378;
+        A[226] = t382+t383;
+        t384 = A[196]*t378;
+        t385 = A[212]*t376;
+        A[228] = -t384+t385;
+        t386 = A[197]*t378;
+        t387 = A[213]*t376;
+        A[229] = -t386+t387;
+        t388 = A[198]*t378;
+        t389 = A[214]*t376;
+        A[230] = -t388+t389;
+        A[232] = A[208];
+        A[233] = A[209];
+        A[234] = A[210];
+    }
+    if ((frames & 0x00004000u) != 0)
+    {
+        A[227] = IGM_CONST(0.0);
+        A[231] = IGM_CONST(0.0);
+        A[235] = IGM_CONST(0.0);
+        A[239] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x0801c000u) != 0)
+    {
+        t390 = 0.9E-1*t362;
+        t391 = 0.9E-1*t364;
+        t392 = 0.9E-1*t365;
+        t393 = 0.9E-1*t366;
+        t394 = 0.9E-1*t367;
+        t395 = 0.9E-1*t368;
+    }
+    if ((frames & 0x0000c000u) != 0)
+    {
+        A[236] = t390+t391-t354+t355-t206+t207-t208-t209+t210+t211;
+        A[237] = t392+t393-t356+t357-t214+t215-t216-t217+t218+t219;
+        A[238] = t394+t395-t358+t359-t222+t223-t224-t225+t226+t227;
+    }
+    if ((frames & 0x48018000u) != 0)
+    {
+        t397 = IGM_COS_Q(15);
+        t398 = A[232]*t397;
+        t399 = IGM_SIN_Q(15);
+        t400 = A[228]*t399;
+        t401 = A[233]*t397;
+        t402 = A[229]*t399;
+        t403 = A[234]*t397;
+        t404 = A[230]*t399;
+        t405 = A[232]*t399;
+        t406 = A[228]*t397;
+        A[244] = -t405+t406;
+        t407 = A[233]*t399;
+        t408 = A[229]*t397;
+        A[245] = -t407+t408;
+        t409 = A[234]*t399;
+        t410 = A[230]*t397;
+        A[246] = -t409+t410;
+    }
+    if ((frames & 0x08018000u) != 0)
+    {
+        A[240] = t398+t400;
+        A[241] = t401+t402;
+        A[242] = t403+t404;
+    }
+    if ((frames & 0x00008000u) != 0)
+    {
+        A[243] = IGM_CONST(0.0);
+        A[247] = IGM_CONST(0.0);
+        A[248] = -A[224];
+        A[249] = -A[225];
+        A[250] = -A[226];
+        A[251] = IGM_CONST(0.0);
+        A[252] = A[236];
+        A[253] = A[237];
+        A[254] = A[238];
+        A[255] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x48010000u) != 0)
+    {
+        t412 = IGM_COS_Q(16);
+        t413 = A[224]*t412;
+        t414 = IGM_SIN_Q(16);
+        t415 = A[244]*t414;
+        t416 = A[225]*t412;
+        t417 = A[245]*t414;
+        t418 = A[226]*t412;
+        t419 = A[246]*t414;
+        t420 = A[224]*t414;
+        t421 = A[244]*t412;
+        t422 = A[225]*t414;
+        t423 = A[245]*t412;
+        t424 = A[226]*t414;
+        t425 = A[246]*t412;
+    }
+    if ((frames & 0x08010000u) != 0)
+    {
+        A[256] = t413+t415;
+        A[257] = t416+t417;
+        A[258] = t418+t419;
+        A[260] = -t420+t421;
+        A[261] = -t422+t423;
+        A[262] = -t424+t425;
+        A[264] = A[240];
+        A[265] = A[241];
+        A[266] = A[242];
+    }
+    if ((frames & 0x00010000u) != 0)
+    {
+        A[259] = IGM_CONST(0.0);
+        A[263] = IGM_CONST(0.0);
+        A[267] = IGM_CONST(0.0);
+        A[268] = 0.5055E-1*t398+0.5055E-1*t400+t390+t391-t354+t355-t206+t207-t208-
+t209+t210+t211;
+        A[269] = 0.5055E-1*t401+0.5055E-1*t402+t392+t393-t356+t357-t214+t215-t216-
+t217+t218+t219;
+        A[270] = 0.5055E-1*t403+0.5055E-1*t404+t394+t395-t358+t359-t222+t223-t224-
+t225+t226+t227;
+        A[271] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x503e0000u) != 0)
+    {
+        t433 = IGM_COS_Q(17);
+        t434 = t59*t433;
+        t435 = IGM_SIN_Q(17);
+        t436 = t339*t435;
+        A[272] = t434+t436;
+        t437 = t119*t433;
+        t438 = t343*t435;
+        A[273] = t437+t438;
+        t439 = t176*t433;
+        t440 = t346*t435;
+        A[274] = t439+t440;
+        t441 = t59*t435;
+        t442 = t339*t433;
+        A[276] = -t441+t442;
+        t443 = t119*t435;
+        t444 = t343*t433;
+        A[277] = -t443+t444;
+        t445 = t176*t435;
+        t446 = t346*t433;
+        A[278] = -t445+t446;
+    }
+    if ((frames & 0x00020000u) != 0)
+    {
+        A[275] = IGM_CONST(0.0);
+        A[279] = IGM_CONST(0.0);
+        A[283] = IGM_CONST(0.0);
+        A[287] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x71fe0000u) != 0)
+    {
+        A[280] = A[200];
+        A[281] = A[201];
+        A[282] = A[202];
+    }
+    if ((frames & 0x103e0000u) != 0)
+    {
+        t447 = 0.1165*t66;
+        t448 = 0.685E-1*t70;
+        t449 = 0.1165*t124;
+        t450 = 0.685E-1*t128;
+        t451 = 0.1165*t181;
+        t452 = 0.685E-1*t185;
+    }
+    if ((frames & 0x00060000u) != 0)
+    {
+        A[284] = -t447+t448-t206+t207-t208-t209+t210+t211;
+        A[285] = -t449+t450-t214+t215-t216-t217+t218+t219;
+        A[286] = -t451+t452-t222+t223-t224-t225+t226+t227;
+    }
+    if ((frames & 0x503c0000u) != 0)
+    {
+        t454 = IGM_COS_Q(18);
+        t455 = A[272]*t454;
+        t456 = IGM_SIN_Q(18);
+        t457 = A[280]*t456;
+        A[288] = t455+t457;
+        t458 = A[273]*t454;
+        t459 = A[281]*t456;
+        A[289] = t458+t459;
+        t460 = A[274]*t454;
+        t461 = A[282]*t456;
+        A[290] = t460+t461;
+        t462 = A[272]*t456;
+        t463 = A[280]*t454;
+        A[292] = -t462+t463;
+        t464 = A[273]*t456;
+        t465 = A[281]*t454;
+        A[293] = -t464+t465;
+        t466 = A[274]*t456;
+        t467 = A[282]*t454;
+        A[294] = -t466+t467;
+    }
+    if ((frames & 0x00040000u) != 0)
+    {
+        A[291] = IGM_CONST(0.0);
+        A[295] = IGM_CONST(0.0);
+        A[296] = -A[276];
+        A[297] = -A[277];
+        A[298] = -A[278];
+        A[299] = IGM_CONST(0.0);
+        A[300] = A[284];
+        A[301] = A[285];
+        A[302] = A[286];
+        A[303] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x50380000u) != 0)
+    {
+        t469 = IGM_COS_Q(19);
+        t470 = A[276]*t469;
+        t471 = IGM_SIN_Q(19);
+        t472 = A[292]*t471;
+        A[304] = t470+t472;
+        t473 = A[277]*t469;
+        t474 = A[293]*t471;
+        A[305] = t473+t474;
+        t475 = A[278]*t469;
+        t476 = A[294]*t471;
+        A[306] = t475+t476;
+        t477 = A[276]*t471;
+        t478 = A[292]*t469;
+        A[308] = -t477+t478;
+        t479 = A[277]*t471;
+        t480 = A[293]*t469;
+        A[309] = -t479+t480;
+        t481 = A[278]*t471;
+        t482 = A[294]*t469;
+        A[310] = -t481+t482;
+        A[312] = A[288];
+        A[313] = A[289];
+        A[314] = A[290];
+    }
+    if ((frames & 0x00080000u) != 0)
+    {
+        A[307] = IGM_CONST(0.0);
+        A[311] = IGM_CONST(0.0);
+        A[315] = IGM_CONST(0.0);
+        A[319] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x10380000u) != 0)
+    {
+        t483 = 0.9E-1*t455;
+        t484 = 0.9E-1*t457;
+        t485 = 0.9E-1*t458;
+        t486 = 0.9E-1*t459;
+        t487 = 0.9E-1*t460;
+        t488 = 0.9E-1*t461;
+    }
+    if ((frames & 0x00180000u) != 0)
+    {
+        A[316] = t483+t484-t447+t448-t206+t207-t208-t209+t210+t211;
+        A[317] = t485+t486-t449+t450-t214+t215-t216-t217+t218+t219;
+        A[318] = t487+t488-t451+t452-t222+t223-t224-t225+t226+t227;
+    }
+    if ((frames & 0x50300000u) != 0)
+    {
+        t490 = IGM_COS_Q(20);
+        t491 = A[312]*t490;
+        t492 = IGM_SIN_Q(20);
+        t493 = A[308]*t492;
+        t494 = A[313]*t490;
+        t495 = A[309]*t492;
+        t496 = A[314]*t490;
+        t497 = A[310]*t492;
+        t498 = A[312]*t492;
+        t499 = A[308]*t490;
+        A[324] = -t498+t499;
+        t500 = A[313]*t492;
+        t501 = A[309]*t490;
+        A[325] = -t500+t501;
+        t502 = A[314]*t492;
+        t503 = A[310]*t490;
+        A[326] = -t502+t503;
+    }
+    if ((frames & 0x10300000u) != 0)
+    {
+        A[320] = t491+t493;
+        A[321] = t494+t495;
+        A[322] = t496+t497;
+    }
+    if ((frames & 0x00100000u) != 0)
+    {
+        A[323] = IGM_CONST(0.0);
+        A[327] = IGM_CONST(0.0);
+        A[328] = -A[304];
+        A[329] = -A[305];
+        A[330] = -A[306];
+        A[331] = IGM_CONST(0.0);
+        A[332] = A[316];
+        A[333] = A[317];
+        A[334] = A[318];
+        A[335] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x50200000u) != 0)
+    {
+        t505 = IGM_COS_Q(21);
+        t506 = A[304]*t505;
+        t507 = IGM_SIN_Q(21);
+        t508 = A[324]*t507;
+        t509 = A[305]*t505;
+        t510 = A[325]*t507;
+        t511 = A[306]*t505;
+        t512 = A[326]*t507;
+        t513 = A[304]*t507;
+        t514 = A[324]*t505;
+        t515 = A[305]*t507;
+        t516 = A[325]*t505;
+        t517 = A[306]*t507;
+        t518 = A[326]*t505;
+    }
+    if ((frames & 0x10200000u) != 0)
+    {
+        A[336] = t506+t508;
+        A[337] = t509+t510;
+        A[338] = t511+t512;
+        A[340] = -t513+t514;
+        A[341] = -t515+t516;
+        A[342] = -t517+t518;
+        A[344] = A[320];
+        A[345] = A[321];
+        A[346] = A[322];
+    }
+    if ((frames & 0x00200000u) != 0)
+    {
+        A[339] = IGM_CONST(0.0);
+        A[343] = IGM_CONST(0.0);
+        A[347] = IGM_CONST(0.0);
+        A[348] = 0.5055E-1*t491+0.5055E-1*t493+t483+t484-t447+t448-t206+t207-t208-
+t209+t210+t211;
+        A[349] = 0.5055E-1*t494+0.5055E-1*t495+t485+t486-t449+t450-t214+t215-t216-
+t217+t218+t219;
+        A[350] = 0.5055E-1*t496+0.5055E-1*t497+t487+t488-t451+t452-t222+t223-t224-
+t225+t226+t227;
+        A[351] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x60c00000u) != 0)
+    {
+        t526 = IGM_COS_Q(22);
+        t527 = t59*t526;
+        t528 = IGM_SIN_Q(22);
+        t529 = A[280]*t528;
+        A[352] = t527+t529;
+        t530 = t119*t526;
+        t531 = A[281]*t528;
+        A[353] = t530+t531;
+        t532 = t176*t526;
+        t533 = A[282]*t528;
+        A[354] = t532+t533;
+        t534 = t59*t528;
+        t535 = A[280]*t526;
+        t536 = t119*t528;
+        t537 = A[281]*t526;
+        t538 = t176*t528;
+        t539 = A[282]*t526;
+    }
+    if ((frames & 0x00400000u) != 0)
+    {
+        A[355] = IGM_CONST(0.0);
+        A[359] = IGM_CONST(0.0);
+        A[363] = IGM_CONST(0.0);
+        A[367] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x20c00000u) != 0)
+    {
+        A[356] = -t534+t535;
+        A[357] = -t536+t537;
+        A[358] = -t538+t539;
+        A[364] = -0.8075E-1*t66+0.13075*t70-t206+t207-t208-t209+t210+t211;
+        A[365] = -0.8075E-1*t124+0.13075*t128-t214+t215-t216-t217+t218+t219;
+        A[366] = -0.8075E-1*t181+0.13075*t185-t222+t223-t224-t225+t226+t227;
+    }
+    if ((frames & 0x01400000u) != 0)
+    {
+        A[360] = t75;
+        A[361] = t133;
+        A[362] = t190;
+    }
+    if ((frames & 0x60800000u) != 0)
+    {
+        t547 = IGM_COS_Q(23);
+        t548 = A[352]*t547;
+        t549 = IGM_SIN_Q(23);
+        t550 = t339*t549;
+        t551 = A[353]*t547;
+        t552 = t343*t549;
+        t553 = A[354]*t547;
+        t554 = t346*t549;
+        t555 = A[352]*t549;
+        t556 = t339*t547;
+        t557 = A[353]*t549;
+        t558 = t343*t547;
+        t559 = A[354]*t549;
+        t560 = t346*t547;
+    }
+    if ((frames & 0x20800000u) != 0)
+    {
+        A[368] = t548+t550;
+        A[369] = t551+t552;
+        A[370] = t553+t554;
+        A[372] = -t555+t556;
+        A[373] = -t557+t558;
+        A[374] = -t559+t560;
+        A[376] = A[356];
+        A[377] = A[357];
+        A[378] = A[358];
+        A[380] = A[364];
+        A[381] = A[365];
+        A[382] = A[366];
+    }
+    if ((frames & 0x00800000u) != 0)
+    {
+        A[371] = IGM_CONST(0.0);
+        A[375] = IGM_CONST(0.0);
+        A[379] = IGM_CONST(0.0);
+        A[383] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x01000000u) != 0)
+    {
+        A[384] = t59;
+        A[385] = t119;
+        A[386] = t176;
+        A[387] = IGM_CONST(0.0);
+        A[388] = A[280];
+        A[389] = A[281];
+        A[390] = A[282];
+        A[391] = IGM_CONST(0.0);
+        A[392] = A[360];
+        A[393] = A[361];
+        A[394] = A[362];
+        A[395] = IGM_CONST(0.0);
+        A[396] = -0.175E-1*t66+0.675E-1*t70-t206+t207-t208-t209+t210+t211;
+        A[397] = -0.175E-1*t124+0.675E-1*t128-t214+t215-t216-t217+t218+t219;
+        A[398] = -0.175E-1*t181+0.675E-1*t185-t222+t223-t224-t225+t226+t227;
+        A[399] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x02000000u) != 0)
+    {
+        A[400] = A[88];
+        A[401] = A[89];
+        A[402] = A[90];
+        A[403] = IGM_CONST(0.0);
+        A[404] = -A[84];
+        A[405] = -A[85];
+        A[406] = -A[86];
+        A[407] = IGM_CONST(0.0);
+        A[408] = A[80];
+        A[409] = A[81];
+        A[410] = A[82];
+        A[411] = IGM_CONST(0.0);
+        A[412] = -0.4511E-1*t320-0.4511E-1*t323-t312-t313-t291-t292+t204+t205-t206+
+t207-t208-t209+t210+t211;
+        A[413] = -0.4511E-1*t324-0.4511E-1*t326-t314-t315-t293-t294+t212+t213-t214+
+t215-t216-t217+t218+t219;
+        A[414] = -0.4511E-1*t327-0.4511E-1*t329-t316-t317-t295-t296+t220+t221-t222+
+t223-t224-t225+t226+t227;
+        A[415] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x44000000u) != 0)
+    {
+        A[416] = A[184];
+        A[417] = A[185];
+        A[418] = A[186];
+        A[420] = A[180];
+        A[421] = A[181];
+        A[422] = A[182];
+        A[424] = t2;
+        A[425] = t81;
+        A[426] = t138;
+    }
+    if ((frames & 0x04000000u) != 0)
+    {
+        A[419] = IGM_CONST(0.0);
+        A[423] = IGM_CONST(0.0);
+        A[427] = IGM_CONST(0.0);
+        A[431] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x5c000000u) != 0)
+    {
+        A[428] = t211;
+        A[429] = t219;
+        A[430] = t227;
+    }
+    if ((frames & 0x08000000u) != 0)
+    {
+        A[432] = A[264];
+        A[433] = A[265];
+        A[434] = A[266];
+        A[435] = IGM_CONST(0.0);
+        A[436] = A[260];
+        A[437] = A[261];
+        A[438] = A[262];
+        A[439] = IGM_CONST(0.0);
+        A[440] = -A[256];
+        A[441] = -A[257];
+        A[442] = -A[258];
+        A[443] = IGM_CONST(0.0);
+        A[444] = 0.159E-1*t413+0.159E-1*t415+0.10855*t398+0.10855*t400+t390+t391-
+t354+t355-t206+t207-t208-t209+t210+A[428];
+        A[445] = 0.159E-1*t416+0.159E-1*t417+0.10855*t401+0.10855*t402+t392+t393-
+t356+t357-t214+t215-t216-t217+t218+A[429];
+        A[446] = 0.159E-1*t418+0.159E-1*t419+0.10855*t403+0.10855*t404+t394+t395-
+t358+t359-t222+t223-t224-t225+t226+A[430];
+        A[447] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x10000000u) != 0)
+    {
+        A[448] = A[344];
+        A[449] = A[345];
+        A[450] = A[346];
+        A[451] = IGM_CONST(0.0);
+        A[452] = A[340];
+        A[453] = A[341];
+        A[454] = A[342];
+        A[455] = IGM_CONST(0.0);
+        A[456] = -A[336];
+        A[457] = -A[337];
+        A[458] = -A[338];
+        A[459] = IGM_CONST(0.0);
+        A[460] = 0.159E-1*t506+0.159E-1*t508+0.10855*t491+0.10855*t493+t483+t484-
+t447+t448-t206+t207-t208-t209+t210+A[428];
+        A[461] = 0.159E-1*t509+0.159E-1*t510+0.10855*t494+0.10855*t495+t485+t486-
+t449+t450-t214+t215-t216-t217+t218+A[429];
+        A[462] = 0.159E-1*t511+0.159E-1*t512+0.10855*t496+0.10855*t497+t487+t488-
+t451+t452-t222+t223-t224-t225+t226+A[430];
+        A[463] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x20000000u) != 0)
+    {
+        A[464] = A[368];
+        A[465] = A[369];
+        A[466] = A[370];
+        A[467] = IGM_CONST(0.0);
+        A[468] = A[376];
+        A[469] = A[377];
+        A[470] = A[378];
+        A[471] = IGM_CONST(0.0);
+        A[472] = -A[372];
+        A[473] = -A[373];
+        A[474] = -A[374];
+        A[475] = IGM_CONST(0.0);
+        A[476] = A[380];
+        A[477] = A[381];
+        A[478] = A[382];
+        A[479] = IGM_CONST(1.0);
+    }
+    if ((frames & 0x40000000u) != 0)
+    {
+        t610 = 0.8503258945E-4*t462-0.8503258945E-4*t463-0.7932620886E-4*t420+
+0.7932620886E-4*t421-0.1702509553E-4*t379-0.3696711277E-6*t529+0.2369931678E-4*
+t498-0.2369931678E-4*t499-0.1659098766E-1*t66-0.4122466806E-3*t67+
+0.4122466806E-3*t68+0.6660372088E-1*t70-0.2061233404E-3*t73;
+        t624 = 0.2606799616E-2*t493-0.1702509553E-4*t470-0.9970896939E-4*t233
+-0.2893250095E-3*t285+0.2893250095E-3*t286+0.8051018213E-4*t508-0.2570662873E-4
+*t338-0.2570662873E-4*t341-0.9761137487E-4*t369+0.9761137487E-4*t370+
+0.5082624939E-2*t555-0.5082624939E-2*t556+0.1832763156E-3*t299;
+        t639 = 0.1232237092E-6*t384-0.1232237092E-6*t385-0.9970896939E-4*t231+
+0.4677530128E-2*t455-0.9419629563E-2*t278-0.1078086072E-3*t267+0.1078086072E-3*
+t268+0.8051018213E-4*t413-0.8823452451E-4*t240+0.8823452451E-4*t241
+-0.1702509553E-4*t377+0.2606799616E-2*t400+0.8051018213E-4*t506;
+        t653 = -0.8799425961E-3*t306+0.8799425961E-3*t307-0.2570662873E-4*t434
+-0.2369931678E-4*t405+0.2369931678E-4*t406-0.2570662873E-4*t436+0.1112574236E-3
+*t330-0.1112574236E-3*t331+0.4402844298E-1*A[424]-0.1112574236E-3*A[420]
+-0.1081557015E-2*t323-0.1232237092E-6*t477+0.1232237092E-6*t478;
+        t669 = 0.8051018213E-4*t415+0.2061233404E-3*t76+0.3775495252E-3*t550+
+0.9999999999*A[428]-0.1681938551E-1*t252+0.8799425961E-3*A[416]-0.3696711277E-6
+*t527+0.2606799616E-2*t398+0.1607889161E-3*t195-0.1607889161E-3*t196
+-0.1512290733E-3*t246+0.3775495252E-3*t548-0.1702509553E-4*t472;
+        t683 = 0.9381437244E-4*t348-0.9381437244E-4*t349+0.2606799616E-2*t491
+-0.1081557015E-2*t320-0.9419629563E-2*t280+0.7932620886E-4*t513-0.7932620886E-4
+*t514+0.4677530128E-2*t362-0.1512290733E-3*t247-0.1681938551E-1*t254+
+0.4677530128E-2*t457+0.9381437244E-4*t441-0.9381437244E-4*t442;
+        t698 = 0.1832763156E-3*t301+0.8945848979E-4*t534-0.8945848979E-4*t535+
+0.4677530128E-2*t364-0.5687628827E-3*t62-0.101865705E-2*t37-0.8318061448E-1*t19
+-0.9332037043E-1*t12+0.1832763156E-3*t5+0.1832763156E-3*t8-0.9332037043E-1*t15
+-0.2893250095E-3*t20+0.2893250095E-3*t21;
+        t712 = 0.8318061448E-1*t24+0.5687628827E-3*t28-0.1078086072E-3*t29
+-0.1078086072E-3*t30+0.5687628827E-3*t33-0.1607889161E-3*t51+0.9397174694E-4*
+t42+0.3024581465E-3*t43-0.3024581465E-3*t44-0.5737222431E-5*t46-0.1607889161E-3
+*t55+0.101865705E-2*t58-0.5687628827E-3*t80;
+        A[480] = t610+t624+t639+t653+t669+t683+t698+t712;
+        t728 = 0.8503258945E-4*t464-0.8503258945E-4*t465+0.2369931678E-4*t500
+-0.2369931678E-4*t501-0.3696711277E-6*t530-0.3696711277E-6*t531-0.9419629563E-2
+*t281-0.1078086072E-3*t269+0.1078086072E-3*t270-0.1232237092E-6*t479+
+0.1232237092E-6*t480+0.1232237092E-6*t386-0.1232237092E-6*t387;
+        t742 = 0.8051018213E-4*t416-0.7932620886E-4*t422+0.7932620886E-4*t423+
+0.4677530128E-2*t459-0.9970896939E-4*t236+0.9381437244E-4*t443-0.9381437244E-4*
+t444-0.2570662873E-4*t342-0.2570662873E-4*t344-0.1512290733E-3*t256
+-0.1681938551E-1*t260-0.2893250095E-3*t287+0.2893250095E-3*t288;
+        t757 = 0.4402844298E-1*A[425]-0.1112574236E-3*A[421]+0.8799425961E-3*A[417]
++0.1832763156E-3*t303+0.9999999999*A[429]+0.9381437244E-4*t350-0.9381437244E-4*
+t351-0.2570662873E-4*t437-0.2570662873E-4*t438-0.1081557015E-2*t326
+-0.1681938551E-1*t259-0.2369931678E-4*t407+0.2369931678E-4*t408;
+        t771 = -0.1702509553E-4*t473-0.9970896939E-4*t235+0.2606799616E-2*t494+
+0.8051018213E-4*t509-0.5687628827E-3*t120-0.101865705E-2*t102-0.8318061448E-1*
+t90-0.9332037043E-1*t86+0.1832763156E-3*t82+0.1832763156E-3*t84-0.9332037043E-1
+*t88-0.2893250095E-3*t91+0.2893250095E-3*t92;
+        t787 = 0.8318061448E-1*t94+0.5687628827E-3*t96-0.1078086072E-3*t97
+-0.1078086072E-3*t98+0.5687628827E-3*t100-0.1607889161E-3*t113+0.9397174694E-4*
+t106+0.3024581465E-3*t107-0.3024581465E-3*t108-0.5737222431E-5*t110
+-0.1607889161E-3*t116+0.101865705E-2*t118-0.5687628827E-3*t137;
+        t801 = -0.1659098766E-1*t124-0.4122466806E-3*t125+0.4122466806E-3*t126+
+0.6660372088E-1*t128-0.2061233404E-3*t131-0.1512290733E-3*t255+0.3775495252E-3*
+t551+0.3775495252E-3*t552-0.1702509553E-4*t474+0.1832763156E-3*t302
+-0.1702509553E-4*t380-0.1702509553E-4*t381-0.8823452451E-4*t242;
+        t816 = 0.8823452451E-4*t243-0.9761137487E-4*t371+0.9761137487E-4*t372
+-0.1081557015E-2*t324+0.2606799616E-2*t402+0.8051018213E-4*t510+0.2061233404E-3
+*t134+0.8945848979E-4*t536-0.8945848979E-4*t537-0.9419629563E-2*t282+
+0.4677530128E-2*t458-0.8799425961E-3*t308+0.8799425961E-3*t309;
+        t830 = 0.5082624939E-2*t557-0.5082624939E-2*t558+0.2606799616E-2*t495+
+0.1112574236E-3*t332-0.1112574236E-3*t333+0.8051018213E-4*t417+0.1607889161E-3*
+t197-0.1607889161E-3*t198+0.7932620886E-4*t515-0.7932620886E-4*t516+
+0.4677530128E-2*t366+0.2606799616E-2*t401+0.4677530128E-2*t365;
+        A[481] = t728+t742+t757+t771+t787+t801+t816+t830;
+        t846 = -0.1512290733E-3*t262-0.1681938551E-1*t266-0.7932620886E-4*t424+
+0.7932620886E-4*t425-0.1702509553E-4*t475-0.1702509553E-4*t476-0.1081557015E-2*
+t327-0.3696711277E-6*t532+0.8503258945E-4*t466-0.8503258945E-4*t467+
+0.8051018213E-4*t419+0.1832763156E-3*t305-0.9419629563E-2*t284;
+        t860 = -0.9970896939E-4*t238+0.9999999999*A[430]+0.8051018213E-4*t512
+-0.9761137487E-4*t373+0.9761137487E-4*t374-0.1702509553E-4*t382+0.5082624939E-2
+*t559-0.5082624939E-2*t560+0.8051018213E-4*t511-0.1078086072E-3*t271+
+0.1078086072E-3*t272+0.4677530128E-2*t368-0.2570662873E-4*t439;
+        t875 = 0.9381437244E-4*t352-0.9381437244E-4*t353-0.2893250095E-3*t289+
+0.2893250095E-3*t290+0.1232237092E-6*t388-0.1232237092E-6*t389-0.9970896939E-4*
+t239-0.1659098766E-1*t181-0.4122466806E-3*t182+0.4122466806E-3*t183+
+0.6660372088E-1*t185-0.2061233404E-3*t188+0.2061233404E-3*t191;
+        t889 = 0.2606799616E-2*t497+0.2606799616E-2*t404+0.1832763156E-3*t304
+-0.1512290733E-3*t261+0.8051018213E-4*t418+0.1112574236E-3*t334-0.1112574236E-3
+*t335-0.8799425961E-3*t310+0.8799425961E-3*t311+0.4677530128E-2*t460+
+0.4677530128E-2*t461-0.1681938551E-1*t265-0.8823452451E-4*t244;
+        t905 = 0.8823452451E-4*t245-0.1081557015E-2*t329+0.2606799616E-2*t496+
+0.4402844298E-1*A[426]-0.1112574236E-3*A[422]+0.8799425961E-3*A[418]
+-0.2570662873E-4*t345-0.2570662873E-4*t347+0.1607889161E-3*t199-0.1607889161E-3
+*t200+0.2369931678E-4*t502-0.2369931678E-4*t503-0.5687628827E-3*t177;
+        t919 = -0.101865705E-2*t159-0.8318061448E-1*t147-0.9332037043E-1*t143+
+0.1832763156E-3*t139+0.1832763156E-3*t141-0.9332037043E-1*t145-0.2893250095E-3*
+t148+0.2893250095E-3*t149+0.8318061448E-1*t151+0.5687628827E-3*t153
+-0.1078086072E-3*t154-0.1078086072E-3*t155+0.5687628827E-3*t157;
+        t934 = -0.1607889161E-3*t170+0.9397174694E-4*t163+0.3024581465E-3*t164
+-0.3024581465E-3*t165-0.5737222431E-5*t167-0.1607889161E-3*t173+0.101865705E-2*
+t175-0.5687628827E-3*t194-0.2369931678E-4*t409+0.2369931678E-4*t410
+-0.1232237092E-6*t481+0.1232237092E-6*t482+0.2606799616E-2*t403;
+        t948 = 0.8945848979E-4*t538-0.8945848979E-4*t539-0.1702509553E-4*t383+
+0.9381437244E-4*t445-0.9381437244E-4*t446+0.7932620886E-4*t517-0.7932620886E-4*
+t518-0.2570662873E-4*t440+0.4677530128E-2*t367+0.3775495252E-3*t553+
+0.3775495252E-3*t554-0.3696711277E-6*t533-0.9419629563E-2*t283;
+        A[482] = t846+t860+t875+t889+t905+t919+t934+t948;
+    }
+    return;
+  }
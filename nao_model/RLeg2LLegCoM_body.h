@@ -0,0 +1,1123 @@
+/* Generated using codegen (2012-02-13, 17:03:54) */
+/*
+ * Body of RLeg2LLegCoM(), the IGM_* macros are described in maple_double.h.
+ * The statements of RLeg2LLeg_body.h and RLeg2CoM_body.h are merged,
+ * identical operations are computed once.
+ */
+  IGM_REAL t1;
+  IGM_REAL t10;
+  IGM_REAL t100;
+  IGM_REAL t101;
+  IGM_REAL t102;
+  IGM_REAL t103;
+  IGM_REAL t104;
+  IGM_REAL t105;
+  IGM_REAL t106;
+  IGM_REAL t107;
+  IGM_REAL t108;
+  IGM_REAL t109;
+  IGM_REAL t11;
+  IGM_REAL t110;
+  IGM_REAL t111;
+  IGM_REAL t112;
+  IGM_REAL t113;
+  IGM_REAL t114;
+  IGM_REAL t115;
+  IGM_REAL t116;
+  IGM_REAL t117;
+  IGM_REAL t118;
+  IGM_REAL t119;
+  IGM_REAL t12;
+  IGM_REAL t120;
+  IGM_REAL t121;
+  IGM_REAL t122;
+  IGM_REAL t123;
+  IGM_REAL t124;
+  IGM_REAL t125;
+  IGM_REAL t126;
+  IGM_REAL t127;
+  IGM_REAL t128;
+  IGM_REAL t129;
+  IGM_REAL t13;
+  IGM_REAL t130;
+  IGM_REAL t131;
+  IGM_REAL t132;
+  IGM_REAL t133;
+  IGM_REAL t134;
+  IGM_REAL t135;
+  IGM_REAL t136;
+  IGM_REAL t137;
+  IGM_REAL t138;
+  IGM_REAL t139;
+  IGM_REAL t14;
+  IGM_REAL t140;
+  IGM_REAL t141;
+  IGM_REAL t142;
+  IGM_REAL t143;
+  IGM_REAL t144;
+  IGM_REAL t145;
+  IGM_REAL t146;
+  IGM_REAL t147;
+  IGM_REAL t148;
+  IGM_REAL t149;
+  IGM_REAL t15;
+  IGM_REAL t150;
+  IGM_REAL t151;
+  IGM_REAL t152;
+  IGM_REAL t153;
+  IGM_REAL t154;
+  IGM_REAL t155;
+  IGM_REAL t156;
+  IGM_REAL t157;
+  IGM_REAL t158;
+  IGM_REAL t159;
+  IGM_REAL t16;
+  IGM_REAL t160;
+  IGM_REAL t161;
+  IGM_REAL t162;
+  IGM_REAL t163;
+  IGM_REAL t164;
+  IGM_REAL t165;
+  IGM_REAL t166;
+  IGM_REAL t167;
+  IGM_REAL t168;
+  IGM_REAL t169;
+  IGM_REAL t17;
+  IGM_REAL t170;
+  IGM_REAL t171;
+  IGM_REAL t172;
+  IGM_REAL t173;
+  IGM_REAL t174;
+  IGM_REAL t175;
+  IGM_REAL t176;
+  IGM_REAL t177;
+  IGM_REAL t178;
+  IGM_REAL t179;
+  IGM_REAL t18;
+  IGM_REAL t180;
+  IGM_REAL t181;
+  IGM_REAL t182;
+  IGM_REAL t183;
+  IGM_REAL t184;
+  IGM_REAL t185;
+  IGM_REAL t186;
+  IGM_REAL t187;
+  IGM_REAL t188;
+  IGM_REAL t189;
+  IGM_REAL t19;
+  IGM_REAL t190;
+  IGM_REAL t191;
+  IGM_REAL t192;
+  IGM_REAL t193;
+  IGM_REAL t194;
+  IGM_REAL t195;
+  IGM_REAL t196;
+  IGM_REAL t197;
+  IGM_REAL t198;
+  IGM_REAL t199;
+  IGM_REAL t2;
+  IGM_REAL t20;
+  IGM_REAL t200;
+  IGM_REAL t201;
+  IGM_REAL t202;
+  IGM_REAL t203;
+  IGM_REAL t204;
+  IGM_REAL t205;
+  IGM_REAL t206;
+  IGM_REAL t207;
+  IGM_REAL t208;
+  IGM_REAL t209;
+  IGM_REAL t21;
+  IGM_REAL t210;
+  IGM_REAL t211;
+  IGM_REAL t212;
+  IGM_REAL t213;
+  IGM_REAL t214;
+  IGM_REAL t215;
+  IGM_REAL t216;
+  IGM_REAL t217;
+  IGM_REAL t218;
+  IGM_REAL t219;
+  IGM_REAL t22;
+  IGM_REAL t220;
+  IGM_REAL t221;
+  IGM_REAL t222;
+  IGM_REAL t223;
+  IGM_REAL t224;
+  IGM_REAL t225;
+  IGM_REAL t226;
+  IGM_REAL t227;
+  IGM_REAL t228;
+  IGM_REAL t229;
+  IGM_REAL t23;
+  IGM_REAL t230;
+  IGM_REAL t231;
+  IGM_REAL t232;
+  IGM_REAL t233;
+  IGM_REAL t234;
+  IGM_REAL t235;
+  IGM_REAL t236;
+  IGM_REAL t237;
+  IGM_REAL t238;
+  IGM_REAL t239;
+  IGM_REAL t24;
+  IGM_REAL t240;
+  IGM_REAL t241;
+  IGM_REAL t242;
+  IGM_REAL t243;
+  IGM_REAL t244;
+  IGM_REAL t245;
+  IGM_REAL t246;
+  IGM_REAL t247;
+  IGM_REAL t248;
+  IGM_REAL t249;
+  IGM_REAL t25;
+  IGM_REAL t250;
+  IGM_REAL t251;
+  IGM_REAL t252;
+  IGM_REAL t253;
+  IGM_REAL t254;
+  IGM_REAL t255;
+  IGM_REAL t256;
+  IGM_REAL t257;
+  IGM_REAL t258;
+  IGM_REAL t259;
+  IGM_REAL t26;
+  IGM_REAL t260;
+  IGM_REAL t261;
+  IGM_REAL t262;
+  IGM_REAL t263;
+  IGM_REAL t264;
+  IGM_REAL t265;
+  IGM_REAL t266;
+  IGM_REAL t267;
+  IGM_REAL t268;
+  IGM_REAL t269;
+  IGM_REAL t27;
+  IGM_REAL t270;
+  IGM_REAL t271;
+  IGM_REAL t272;
+  IGM_REAL t273;
+  IGM_REAL t274;
+  IGM_REAL t275;
+  IGM_REAL t276;
+  IGM_REAL t277;
+  IGM_REAL t278;
+  IGM_REAL t279;
+  IGM_REAL t28;
+  IGM_REAL t280;
+  IGM_REAL t281;
+  IGM_REAL t282;
+  IGM_REAL t283;
+  IGM_REAL t284;
+  IGM_REAL t285;
+  IGM_REAL t286;
+  IGM_REAL t287;
+  IGM_REAL t288;
+  IGM_REAL t289;
+  IGM_REAL t29;
+  IGM_REAL t290;
+  IGM_REAL t291;
+  IGM_REAL t292;
+  IGM_REAL t293;
+  IGM_REAL t294;
+  IGM_REAL t295;
+  IGM_REAL t296;
+  IGM_REAL t297;
+  IGM_REAL t298;
+  IGM_REAL t299;
+  IGM_REAL t3;
+  IGM_REAL t30;
+  IGM_REAL t300;
+  IGM_REAL t301;
+  IGM_REAL t302;
+  IGM_REAL t303;
+  IGM_REAL t304;
+  IGM_REAL t305;
+  IGM_REAL t306;
+  IGM_REAL t307;
+  IGM_REAL t308;
+  IGM_REAL t309;
+  IGM_REAL t31;
+  IGM_REAL t310;
+  IGM_REAL t311;
+  IGM_REAL t312;
+  IGM_REAL t313;
+  IGM_REAL t314;
+  IGM_REAL t315;
+  IGM_REAL t316;
+  IGM_REAL t317;
+  IGM_REAL t318;
+  IGM_REAL t319;
+  IGM_REAL t32;
+  IGM_REAL t320;
+  IGM_REAL t321;
+  IGM_REAL t322;
+  IGM_REAL t323;
+  IGM_REAL t324;
+  IGM_REAL t325;
+  IGM_REAL t326;
+  IGM_REAL t327;
+  IGM_REAL t328;
+  IGM_REAL t329;
+  IGM_REAL t33;
+  IGM_REAL t330;
+  IGM_REAL t331;
+  IGM_REAL t332;
+  IGM_REAL t333;
+  IGM_REAL t334;
+  IGM_REAL t335;
+  IGM_REAL t336;
+  IGM_REAL t337;
+  IGM_REAL t338;
+  IGM_REAL t339;
+  IGM_REAL t34;
+  IGM_REAL t340;
+  IGM_REAL t341;
+  IGM_REAL t342;
+  IGM_REAL t343;
+  IGM_REAL t344;
+  IGM_REAL t345;
+  IGM_REAL t346;
+  IGM_REAL t347;
+  IGM_REAL t348;
+  IGM_REAL t349;
+  IGM_REAL t35;
+  IGM_REAL t350;
+  IGM_REAL t351;
+  IGM_REAL t352;
+  IGM_REAL t353;
+  IGM_REAL t354;
+  IGM_REAL t355;
+  IGM_REAL t356;
+  IGM_REAL t357;
+  IGM_REAL t358;
+  IGM_REAL t359;
+  IGM_REAL t36;
+  IGM_REAL t360;
+  IGM_REAL t361;
+  IGM_REAL t362;
+  IGM_REAL t363;
+  IGM_REAL t364;
+  IGM_REAL t365;
+  IGM_REAL t366;
+  IGM_REAL t367;
+  IGM_REAL t368;
+  IGM_REAL t369;
+  IGM_REAL t37;
+  IGM_REAL t370;
+  IGM_REAL t371;
+  IGM_REAL t372;
+  IGM_REAL t373;
+  IGM_REAL t374;
+  IGM_REAL t375;
+  IGM_REAL t376;
+  IGM_REAL t377;
+  IGM_REAL t378;
+  IGM_REAL t379;
+  IGM_REAL t38;
+  IGM_REAL t380;
+  IGM_REAL t381;
+  IGM_REAL t382;
+  IGM_REAL t383;
+  IGM_REAL t384;
+  IGM_REAL t385;
+  IGM_REAL t386;
+  IGM_REAL t387;
+  IGM_REAL t388;
+  IGM_REAL t389;
+  IGM_REAL t39;
+  IGM_REAL t390;
+  IGM_REAL t391;
+  IGM_REAL t392;
+  IGM_REAL t393;
+  IGM_REAL t394;
+  IGM_REAL t395;
+  IGM_REAL t396;
+  IGM_REAL t397;
+  IGM_REAL t398;
+  IGM_REAL t399;
+  IGM_REAL t4;
+  IGM_REAL t40;
+  IGM_REAL t400;
+  IGM_REAL t401;
+  IGM_REAL t402;
+  IGM_REAL t403;
+  IGM_REAL t404;
+  IGM_REAL t405;
+  IGM_REAL t406;
+  IGM_REAL t407;
+  IGM_REAL t408;
+  IGM_REAL t409;
+  IGM_REAL t41;
+  IGM_REAL t410;
+  IGM_REAL t411;
+  IGM_REAL t412;
+  IGM_REAL t413;
+  IGM_REAL t414;
+  IGM_REAL t415;
+  IGM_REAL t416;
+  IGM_REAL t417;
+  IGM_REAL t418;
+  IGM_REAL t419;
+  IGM_REAL t42;
+  IGM_REAL t420;
+  IGM_REAL t421;
+  IGM_REAL t422;
+  IGM_REAL t423;
+  IGM_REAL t424;
+  IGM_REAL t425;
+  IGM_REAL t426;
+  IGM_REAL t427;
+  IGM_REAL t428;
+  IGM_REAL t429;
+  IGM_REAL t43;
+  IGM_REAL t430;
+  IGM_REAL t431;
+  IGM_REAL t432;
+  IGM_REAL t433;
+  IGM_REAL t434;
+  IGM_REAL t435;
+  IGM_REAL t436;
+  IGM_REAL t437;
+  IGM_REAL t438;
+  IGM_REAL t439;
+  IGM_REAL t44;
+  IGM_REAL t440;
+  IGM_REAL t441;
+  IGM_REAL t442;
+  IGM_REAL t443;
+  IGM_REAL t444;
+  IGM_REAL t445;
+  IGM_REAL t446;
+  IGM_REAL t447;
+  IGM_REAL t448;
+  IGM_REAL t449;
+  IGM_REAL t45;
+  IGM_REAL t450;
+  IGM_REAL t451;
+  IGM_REAL t452;
+  IGM_REAL t453;
+  IGM_REAL t454;
+  IGM_REAL t455;
+  IGM_REAL t456;
+  IGM_REAL t457;
+  IGM_REAL t458;
+  IGM_REAL t459;
+  IGM_REAL t46;
+  IGM_REAL t460;
+  IGM_REAL t461;
+  IGM_REAL t462;
+  IGM_REAL t463;
+  IGM_REAL t464;
+  IGM_REAL t465;
+  IGM_REAL t466;
+  IGM_REAL t467;
+  IGM_REAL t468;
+  IGM_REAL t469;
+  IGM_REAL t47;
+  IGM_REAL t470;
+  IGM_REAL t471;
+  IGM_REAL t472;
+  IGM_REAL t473;
+  IGM_REAL t474;
+  IGM_REAL t475;
+  IGM_REAL t476;
+  IGM_REAL t477;
+  IGM_REAL t478;
+  IGM_REAL t479;
+  IGM_REAL t48;
+  IGM_REAL t480;
+  IGM_REAL t481;
+  IGM_REAL t482;
+  IGM_REAL t483;
+  IGM_REAL t484;
+  IGM_REAL t485;
+  IGM_REAL t486;
+  IGM_REAL t487;
+  IGM_REAL t488;
+  IGM_REAL t489;
+  IGM_REAL t49;
+  IGM_REAL t490;
+  IGM_REAL t491;
+  IGM_REAL t492;
+  IGM_REAL t493;
+  IGM_REAL t494;
+  IGM_REAL t495;
+  IGM_REAL t496;
+  IGM_REAL t497;
+  IGM_REAL t498;
+  IGM_REAL t499;
+  IGM_REAL t5;
+  IGM_REAL t50;
+  IGM_REAL t500;
+  IGM_REAL t501;
+  IGM_REAL t502;
+  IGM_REAL t503;
+  IGM_REAL t51;
+  IGM_REAL t52;
+  IGM_REAL t53;
+  IGM_REAL t54;
+  IGM_REAL t55;
+  IGM_REAL t56;
+  IGM_REAL t57;
+  IGM_REAL t58;
+  IGM_REAL t59;
+  IGM_REAL t6;
+  IGM_REAL t60;
+  IGM_REAL t61;
+  IGM_REAL t62;
+  IGM_REAL t63;
+  IGM_REAL t64;
+  IGM_REAL t65;
+  IGM_REAL t66;
+  IGM_REAL t67;
+  IGM_REAL t68;
+  IGM_REAL t69;
+  IGM_REAL t7;
+  IGM_REAL t70;
+  IGM_REAL t71;
+  IGM_REAL t72;
+  IGM_REAL t73;
+  IGM_REAL t74;
+  IGM_REAL t75;
+  IGM_REAL t76;
+  IGM_REAL t77;
+  IGM_REAL t78;
+  IGM_REAL t79;
+  IGM_REAL t8;
+  IGM_REAL t80;
+  IGM_REAL t81;
+  IGM_REAL t82;
+  IGM_REAL t83;
+  IGM_REAL t84;
+  IGM_REAL t85;
+  IGM_REAL t86;
+  IGM_REAL t87;
+  IGM_REAL t88;
+  IGM_REAL t89;
+  IGM_REAL t9;
+  IGM_REAL t90;
+  IGM_REAL t91;
+  IGM_REAL t92;
+  IGM_REAL t93;
+  IGM_REAL t94;
+  IGM_REAL t95;
+  IGM_REAL t96;
+  IGM_REAL t97;
+  IGM_REAL t98;
+  IGM_REAL t99;
+  {
+    t1 = RL[8];
+    t2 = IGM_COS_Q(11);
+    t3 = RL[4];
+    t4 = IGM_SIN_Q(11);
+    t5 = t1*t2;
+    t6 = t3*t4;
+    t7 = -t5-t6;
+    t8 = IGM_COS_Q(10);
+    t9 = t7*t8;
+    t10 = RL[0];
+    t11 = IGM_SIN_Q(10);
+    t12 = t10*t11;
+    t13 = t9+t12;
+    t14 = IGM_COS_Q(9);
+    t15 = t13*t14;
+    t16 = t7*t11;
+    t17 = t10*t8;
+    t18 = t16-t17;
+    t19 = IGM_SIN_Q(9);
+    t20 = t18*t19;
+    t21 = t15-t20;
+    t22 = IGM_SIN_Q(8);
+    t23 = t13*t19;
+    t24 = t18*t14;
+    t25 = t23+t24;
+    t26 = IGM_COS_Q(8);
+    t27 = t21*t22;
+    t28 = t25*t26;
+    t29 = -t27-t28;
+    t30 = IGM_SIN_Q(6);
+    t31 = IGM_CONST(sqrt(2.0));
+    t32 = (t21*t26-t25*t22)*t31;
+    t33 = t1*t4;
+    t34 = t3*t2;
+    t35 = (t34-t33)*t31;
+    t36 = t32/2.0;
+    t37 = t35/2.0;
+    t38 = t36-t37;
+    t39 = IGM_SIN_Q(7);
+    t40 = t36+t37;
+    t41 = IGM_COS_Q(7);
+    t42 = t38*t39;
+    t43 = t40*t41;
+    t44 = t42+t43;
+    t45 = IGM_COS_Q(6);
+    t46 = (t29*t30+t44*t45)*t31;
+    t47 = t38*t41;
+    t48 = t40*t39;
+    t49 = (t48-t47)*t31;
+    t50 = t46/2.0;
+    t51 = t49/2.0;
+    t52 = t50+t51;
+    t53 = t52*t31;
+    t54 = t51-t50;
+    t55 = t54*t31;
+    t56 = t53/2.0;
+    t57 = t55/2.0;
+    t58 = t57-t56;
+    t59 = IGM_COS_Q(1);
+    t60 = t29*t45;
+    t61 = t44*t30;
+    t62 = t60-t61;
+    t63 = IGM_SIN_Q(0);
+    t64 = -t56-t57;
+    t65 = IGM_COS_Q(0);
+    t66 = t62*t63;
+    t67 = t64*t65;
+    t68 = t67-t66;
+    t69 = IGM_SIN_Q(1);
+    t70 = t58*t59;
+    t71 = t68*t69;
+    t72 = (t70+t71)*t31;
+    t73 = t58*t69;
+    t74 = t68*t59;
+    t75 = (t74-t73)*t31;
+    t76 = t72/2.0;
+    t77 = t75/2.0;
+    t78 = t76-t77;
+    t79 = IGM_COS_Q(2);
+    t80 = t78*t79;
+    t81 = t62*t65;
+    t82 = t64*t63;
+    t83 = t81+t82;
+    t84 = IGM_SIN_Q(2);
+    t85 = t83*t84;
+    t86 = t80+t85;
+    t87 = IGM_COS_Q(3);
+    t88 = t86*t87;
+    t89 = t78*t84;
+    t90 = t83*t79;
+    t91 = t90-t89;
+    t92 = IGM_SIN_Q(3);
+    t93 = t91*t92;
+    t94 = t88+t93;
+    t95 = IGM_SIN_Q(4);
+    t96 = t86*t92;
+    t97 = t91*t87;
+    t98 = t97-t96;
+    t99 = IGM_COS_Q(4);
+    t100 = RL[9];
+    t101 = RL[5];
+    t102 = t100*t2;
+    t103 = t101*t4;
+    t104 = -t102-t103;
+    t105 = t104*t8;
+    t106 = RL[1];
+    t107 = t106*t11;
+    t108 = t105+t107;
+    t109 = t108*t14;
+    t110 = t104*t11;
+    t111 = t106*t8;
+    t112 = t110-t111;
+    t113 = t112*t19;
+    t114 = t109-t113;
+    t115 = t108*t19;
+    t116 = t112*t14;
+    t117 = t115+t116;
+    t118 = t114*t22;
+    t119 = t117*t26;
+    t120 = -t118-t119;
+    t121 = (t114*t26-t117*t22)*t31;
+    t122 = t100*t4;
+    t123 = t101*t2;
+    t124 = (t123-t122)*t31;
+    t125 = t121/2.0;
+    t126 = t124/2.0;
+    t127 = t125-t126;
+    t128 = t125+t126;
+    t129 = t127*t39;
+    t130 = t128*t41;
+    t131 = t129+t130;
+    t132 = (t120*t30+t131*t45)*t31;
+    t133 = t127*t41;
+    t134 = t128*t39;
+    t135 = (t134-t133)*t31;
+    t136 = t132/2.0;
+    t137 = t135/2.0;
+    t138 = t136+t137;
+    t139 = t138*t31;
+    t140 = (t137-t136)*t31;
+    t141 = t139/2.0;
+    t142 = -t141;
+    t143 = t140/2.0;
+    t144 = t143-t141;
+    t145 = t120*t45;
+    t146 = t131*t30;
+    t147 = t145-t146;
+    t148 = t142-t143;
+    t149 = t147*t63;
+    t150 = t148*t65-t149;
+    t151 = (t144*t59+t150*t69)*t31;
+    t152 = (t150*t59-t144*t69)*t31;
+    t153 = t151/2.0;
+    t154 = t152/2.0;
+    t155 = t153-t154;
+    t156 = t155*t79;
+    t157 = t147*t65;
+    t158 = t157+t148*t63;
+    t159 = t158*t84;
+    t160 = t156+t159;
+    t161 = t160*t87;
+    t162 = t158*t79-t155*t84;
+    t163 = t162*t92;
+    t164 = t161+t163;
+    t165 = t162*t87-t160*t92;
+    t166 = RL[10];
+    t167 = RL[6];
+    t168 = t166*t2;
+    t169 = t167*t4;
+    t170 = -t168-t169;
+    t171 = t170*t8;
+    t172 = RL[2];
+    t173 = t172*t11;
+    t174 = t171+t173;
+    t175 = t174*t14;
+    t176 = t170*t11;
+    t177 = t172*t8;
+    t178 = t176-t177;
+    t179 = t178*t19;
+    t180 = t175-t179;
+    t181 = t174*t19;
+    t182 = t178*t14;
+    t183 = t181+t182;
+    t184 = t180*t22;
+    t185 = t183*t26;
+    t186 = -t184-t185;
+    t187 = (t180*t26-t183*t22)*t31;
+    t188 = t166*t4;
+    t189 = t167*t2;
+    t190 = (t189-t188)*t31;
+    t191 = t187/2.0;
+    t192 = t190/2.0;
+    t193 = t191-t192;
+    t194 = t191+t192;
+    t195 = t193*t39;
+    t196 = t194*t41;
+    t197 = t195+t196;
+    t198 = (t186*t30+t197*t45)*t31;
+    t199 = t193*t41;
+    t200 = t194*t39;
+    t201 = (t200-t199)*t31;
+    t202 = t198/2.0;
+    t203 = t201/2.0;
+    t204 = t202+t203;
+    t205 = t204*t31;
+    t206 = (t203-t202)*t31;
+    t207 = t205/2.0;
+    t208 = -t207;
+    t209 = t206/2.0;
+    t210 = t209-t207;
+    t211 = t186*t45;
+    t212 = t197*t30;
+    t213 = t211-t212;
+    t214 = t208-t209;
+    t215 = t213*t63;
+    t216 = t214*t65-t215;
+    t217 = (t210*t59+t216*t69)*t31;
+    t218 = (t216*t59-t210*t69)*t31;
+    t219 = t217/2.0;
+    t220 = t218/2.0;
+    t221 = t219-t220;
+    t222 = t221*t79;
+    t223 = t213*t65;
+    t224 = t223+t214*t63;
+    t225 = t224*t84;
+    t226 = t222+t225;
+    t227 = t226*t87;
+    t228 = t224*t79-t221*t84;
+    t229 = t228*t92;
+    t230 = t227+t229;
+    t231 = t228*t87-t226*t92;
+    t232 = t94*t99;
+    t233 = t98*t95;
+    t234 = t232+t233;
+    t235 = IGM_SIN_Q(5);
+    t236 = t76+t77;
+    t237 = IGM_COS_Q(5);
+    t238 = t164*t99+t165*t95;
+    t239 = t153+t154;
+    t240 = t230*t99+t231*t95;
+    t241 = t219+t220;
+    t242 = t234*t237;
+    t243 = t236*t235;
+    t244 = t238*t237;
+    t245 = t239*t235;
+    t246 = t240*t237;
+    t247 = t241*t235;
+    t248 = RL[12];
+    t249 = RL[13];
+    t250 = RL[14];
+    t251 = IGM_SIN_Q(13);
+    t252 = t52*t251;
+    t253 = IGM_COS_Q(12);
+    t254 = t62*t253;
+    t255 = IGM_SIN_Q(12);
+    t256 = t54*t255;
+    t257 = t254-t256;
+    t258 = IGM_COS_Q(13);
+    t259 = t257*t258;
+    t260 = t259+t252;
+    t261 = IGM_COS_Q(15);
+    t262 = t62*t255;
+    t263 = t54*t253;
+    t264 = -t263;
+    t265 = IGM_SIN_Q(15);
+    t266 = t260*t265;
+    t267 = -t262+t264;
+    t268 = IGM_SIN_Q(14);
+    t269 = t267*t268;
+    t270 = t257*t251;
+    t271 = t52*t258;
+    t272 = t271-t270;
+    t273 = IGM_COS_Q(14);
+    t274 = t272*t273;
+    t275 = t274-t269;
+    t276 = t275*t261;
+    t277 = t276-t266;
+    t278 = IGM_SIN_Q(16);
+    t279 = t272*t268;
+    t280 = IGM_SIN_Q(17);
+    t281 = t62*t280;
+    t282 = IGM_COS_Q(17);
+    t283 = t54*t282;
+    t284 = -t283;
+    t285 = -t281+t284;
+    t286 = IGM_COS_Q(19);
+    t287 = t285*t286;
+    t288 = t62*t282;
+    t289 = t54*t280;
+    t290 = t288-t289;
+    t291 = IGM_SIN_Q(18);
+    t292 = t290*t291;
+    t293 = IGM_COS_Q(18);
+    t294 = t52*t293;
+    t295 = t294-t292;
+    t296 = IGM_SIN_Q(19);
+    t297 = t295*t296;
+    t298 = t287+t297;
+    t299 = IGM_COS_Q(21);
+    t300 = 0.1078086072E-3*t90-0.1512290733E-3*t75-0.2893250095E-3*t96
++0.1832763156E-3*t233+0.4677530128E-2*t252+0.2606799616E-2*t260*t261
++0.9381437244E-4*t262+0.9381437244E-4*t263-0.1078086072E-3*t89+0.8051018213E-4
+*t277*t278-0.1702509553E-4*t279-0.8799425961E-3*t94*t95+0.8051018213E-4*t298
+*t299;
+    t301 = IGM_COS_Q(22);
+    t302 = t62*t301;
+    t303 = IGM_SIN_Q(22);
+    t304 = t52*t303;
+    t305 = IGM_COS_Q(16);
+    t306 = IGM_COS_Q(23);
+    t307 = t302+t304;
+    t308 = IGM_SIN_Q(23);
+    t309 = t290*t293;
+    t310 = t52*t291;
+    t311 = t309+t310;
+    t312 = IGM_SIN_Q(20);
+    t313 = t311*t312;
+    t314 = t285*t296;
+    t315 = t295*t286;
+    t316 = t315-t314;
+    t317 = IGM_COS_Q(20);
+    t318 = t316*t317;
+    t319 = t318-t313;
+    t320 = t267*t273;
+    t321 = t320+t279;
+    t322 = -(0.3696711277E-6*t302)-0.3696711277E-6*t304+0.7932620886E-4*t277
+*t305-0.5687628827E-3*t82+0.5082624939E-2*t54*t306+0.5082624939E-2*t307*t308
+-0.7932620886E-4*t319*t299+0.2893250095E-3*t97-0.1681938551E-1*t80
+-0.5687628827E-3*t81-0.7932620886E-4*t321*t278-0.1702509553E-4*t287
+-0.2570662873E-4*t288;
+    t323 = 0.2570662873E-4*t289+0.8503258945E-4*t292-0.8503258945E-4*t294
+-0.1702509553E-4*t297-0.1232237092E-6*t314+0.4677530128E-2*t309-0.1681938551E-1
+*t85+0.2369931678E-4*t276+0.8799425961E-3*t98*t99-0.1081557015E-2*t234*t237
++0.2606799616E-2*t275*t265-0.1112574236E-3*t236*t237-0.9419629563E-2*t93;
+    t324 = IGM_SIN_Q(21);
+    t325 = 0.1232237092E-6*t269-0.1232237092E-6*t274-0.9761137487E-4*t270
++0.9761137487E-4*t271-0.9419629563E-2*t88+0.8051018213E-4*t319*t324
++0.2606799616E-2*t316*t312+0.3775495252E-3*t307*t306-0.3775495252E-3*t54*t308
+-0.1081557015E-2*t236*t235+0.1232237092E-6*t315-0.2369931678E-4*t318
++0.1832763156E-3*t232;
+    t326 = 0.4677530128E-2*t310+0.2606799616E-2*t311*t317-0.8318061448E-1*t15
+-0.9332037043E-1*t9+0.1832763156E-3*t5+0.1832763156E-3*t6-0.9332037043E-1*t12
+-0.2893250095E-3*t16+0.2893250095E-3*t17+0.8318061448E-1*t20+0.5687628827E-3
+*t27-0.1078086072E-3*t23-0.1078086072E-3*t24;
+    t327 = 0.5687628827E-3*t28-0.1607889161E-3*t42+0.9397174694E-4*t32
++0.3024581465E-3*t33-0.3024581465E-3*t34-0.5737222431E-5*t35-0.1607889161E-3
+*t43-0.1659098766E-1*t46-0.4122466806E-3*t47+0.4122466806E-3*t48
++0.6660372088E-1*t49-0.2061233404E-3*t53+0.2061233404E-3*t55;
+    t328 = -(0.9970896939E-4*t70)-0.101865705E-2*t60+0.8799425961E-3*t10
+-0.1112574236E-3*t3+0.4402844298E-1*t1+0.9999999999*t248+0.101865705E-2*t61
++0.1607889161E-3*t66-0.1607889161E-3*t67-0.9970896939E-4*t71+0.8823452451E-4
+*t74-0.8823452451E-4*t73+0.9381437244E-4*t281;
+    t329 = 0.9381437244E-4*t283+0.8051018213E-4*t321*t305-0.2369931678E-4*t266
+-0.1702509553E-4*t320+0.7932620886E-4*t298*t324+0.4677530128E-2*t259
+-0.2570662873E-4*t254+0.2570662873E-4*t256+0.2369931678E-4*t313-0.1512290733E-3
+*t72-0.8945848979E-4*t52*t301+0.8945848979E-4*t62*t303+0.1112574236E-3*t234
+*t235;
+    t330 = t147*t301;
+    t331 = t138*t303;
+    t332 = t330+t331;
+    t333 = t147*t253;
+    t334 = t136-t137;
+    t335 = t334*t255;
+    t336 = t333+t335;
+    t337 = t336*t258;
+    t338 = t138*t251;
+    t339 = t337+t338;
+    t340 = t339*t265;
+    t341 = t147*t255;
+    t342 = t334*t253;
+    t343 = t342-t341;
+    t344 = t343*t268;
+    t345 = t336*t251;
+    t346 = t138*t258;
+    t347 = t346-t345;
+    t348 = t347*t273;
+    t349 = t348-t344;
+    t350 = t349*t261;
+    t351 = t350-t340;
+    t352 = t334*t31;
+    t353 = t352/2.0;
+    t354 = t142+(-t353);
+    t355 = t354*t59;
+    t356 = t353-t141;
+    t357 = t356*t65;
+    t358 = t357-t149;
+    t359 = t358*t69;
+    t360 = (t355+t359)*t31;
+    t361 = t354*t69;
+    t362 = t358*t59;
+    t363 = (t362-t361)*t31;
+    t364 = t360/2.0;
+    t365 = t363/2.0;
+    t366 = t364-t365;
+    t367 = t366*t84;
+    t368 = t356*t63;
+    t369 = t157+t368;
+    t370 = t369*t79;
+    t371 = t370-t367;
+    t372 = t371*t87;
+    t373 = t366*t79;
+    t374 = t369*t84;
+    t375 = t373+t374;
+    t376 = t375*t87;
+    t377 = t371*t92;
+    t378 = t376+t377;
+    t379 = t378*t99;
+    t380 = t375*t92;
+    t381 = t372-t380;
+    t382 = t381*t95;
+    t383 = t379+t382;
+    t384 = t147*t280;
+    t385 = t334*t282;
+    t386 = t385-t384;
+    t387 = t386*t286;
+    t388 = t147*t282;
+    t389 = t334*t280;
+    t390 = t388+t389;
+    t391 = t390*t291;
+    t392 = t138*t293;
+    t393 = t392-t391;
+    t394 = t393*t296;
+    t395 = t387+t394;
+    t396 = 0.5082624939E-2*t332*t308+0.8051018213E-4*t351*t278+0.3775495252E-3
+*t334*t308+0.2893250095E-3*t372-0.1681938551E-1*t373-0.1081557015E-2*t383*t237
++0.1112574236E-3*t383*t235+0.8051018213E-4*t395*t299-0.2893250095E-3*t380
++0.1607889161E-3*t149-0.1607889161E-3*t357-0.9970896939E-4*t359-0.1512290733E-3
+*t360;
+    t397 = t347*t268;
+    t398 = 0.1832763156E-3*t102-0.1702509553E-4*t397+0.1832763156E-3*t103
+-0.9332037043E-1*t105-0.3696711277E-6*t330-0.101865705E-2*t145-0.8318061448E-1
+*t109-0.9332037043E-1*t107-0.2893250095E-3*t110+0.2893250095E-3*t111
++0.8318061448E-1*t113+0.5687628827E-3*t118-0.1078086072E-3*t115;
+    t399 = t364+t365;
+    t400 = t343*t273;
+    t401 = t400+t397;
+    t402 = 0.5687628827E-3*t119-0.1078086072E-3*t116-0.1607889161E-3*t129
++0.9397174694E-4*t121+0.3024581465E-3*t122-0.3024581465E-3*t123-0.5737222431E-5
+*t124-0.1607889161E-3*t130-0.1112574236E-3*t399*t237-0.8945848979E-4*t138*t301
++0.8945848979E-4*t147*t303+0.1832763156E-3*t382+0.8051018213E-4*t401*t305;
+    t403 = 0.1078086072E-3*t370-0.1078086072E-3*t367+0.4402844298E-1*t100
+-0.1112574236E-3*t101+0.8799425961E-3*t106+0.101865705E-2*t146-0.3696711277E-6
+*t331-0.1659098766E-1*t132-0.4122466806E-3*t133+0.4122466806E-3*t134
++0.6660372088E-1*t135+0.3775495252E-3*t332*t306-0.2061233404E-3*t139;
+    t404 = -(0.2061233404E-3*t352)-0.9970896939E-4*t355+0.9999999999*t249
++0.8799425961E-3*t381*t99-0.9419629563E-2*t376-0.9419629563E-2*t377
+-0.8799425961E-3*t378*t95-0.2570662873E-4*t333-0.2570662873E-4*t388
+-0.2570662873E-4*t389+0.8503258945E-4*t391-0.8503258945E-4*t392-0.1702509553E-4
+*t394;
+    t405 = t393*t286;
+    t406 = t386*t296;
+    t407 = t405-t406;
+    t408 = t407*t317;
+    t409 = t390*t293;
+    t410 = t138*t291;
+    t411 = t409+t410;
+    t412 = t411*t312;
+    t413 = t408-t412;
+    t414 = 0.1232237092E-6*t405+0.9381437244E-4*t384-0.9381437244E-4*t385
+-0.5082624939E-2*t334*t306-0.1232237092E-6*t406+0.2606799616E-2*t407*t312
++0.8823452451E-4*t362-0.2369931678E-4*t408+0.4677530128E-2*t409+0.4677530128E-2
+*t410+0.2369931678E-4*t412+0.1832763156E-3*t379+0.8051018213E-4*t413*t324;
+    t415 = -(0.7932620886E-4*t413*t299)-0.1702509553E-4*t387-0.1512290733E-3
+*t363-0.5687628827E-3*t157-0.5687628827E-3*t368+0.7932620886E-4*t395*t324
++0.2606799616E-2*t411*t317-0.2570662873E-4*t335-0.9761137487E-4*t345
++0.9761137487E-4*t346-0.1232237092E-6*t348+0.9381437244E-4*t341-0.9381437244E-4
+*t342;
+    t416 = 0.1232237092E-6*t344-0.1081557015E-2*t399*t235+0.2606799616E-2*t349
+*t265+0.2369931678E-4*t350+0.4677530128E-2*t337+0.4677530128E-2*t338
+-0.2369931678E-4*t340+0.2606799616E-2*t339*t261-0.1702509553E-4*t400
+-0.8823452451E-4*t361+0.7932620886E-4*t351*t305-0.7932620886E-4*t401*t278
+-0.1681938551E-1*t374;
+    t417 = t213*t280;
+    t418 = t202-t203;
+    t419 = t418*t282;
+    t420 = t419-t417;
+    t421 = t420*t296;
+    t422 = t213*t282;
+    t423 = t418*t280;
+    t424 = t422+t423;
+    t425 = t424*t291;
+    t426 = t204*t293;
+    t427 = t426-t425;
+    t428 = t427*t286;
+    t429 = t428-t421;
+    t430 = t424*t293;
+    t431 = t204*t291;
+    t432 = t430+t431;
+    t433 = t432*t312;
+    t434 = t429*t317;
+    t435 = t434-t433;
+    t436 = t418*t31;
+    t437 = t436/2.0;
+    t438 = t208+(-t437);
+    t439 = t438*t59;
+    t440 = t437-t207;
+    t441 = t440*t65;
+    t442 = t441-t215;
+    t443 = t442*t69;
+    t444 = (t439+t443)*t31;
+    t445 = t438*t69;
+    t446 = t442*t59;
+    t447 = (t446-t445)*t31;
+    t448 = t444/2.0;
+    t449 = t447/2.0;
+    t450 = t448-t449;
+    t451 = t450*t84;
+    t452 = t440*t63;
+    t453 = t223+t452;
+    t454 = t453*t79;
+    t455 = t454-t451;
+    t456 = t455*t92;
+    t457 = t420*t286;
+    t458 = t427*t296;
+    t459 = t457+t458;
+    t460 = t213*t255;
+    t461 = t418*t253;
+    t462 = t461-t460;
+    t463 = t462*t268;
+    t464 = t213*t253;
+    t465 = t418*t255;
+    t466 = t464+t465;
+    t467 = t466*t251;
+    t468 = t204*t258;
+    t469 = t468-t467;
+    t470 = t469*t273;
+    t471 = t470-t463;
+    t472 = t213*t301;
+    t473 = 0.2606799616E-2*t429*t312+0.8051018213E-4*t435*t324-0.9419629563E-2
+*t456+0.8051018213E-4*t459*t299+0.2606799616E-2*t471*t265-0.8823452451E-4*t445
++0.1832763156E-3*t168+0.1832763156E-3*t169-0.9332037043E-1*t171-0.3696711277E-6
+*t472-0.101865705E-2*t211-0.8318061448E-1*t175-0.9332037043E-1*t173;
+    t474 = 0.2893250095E-3*t177-0.2893250095E-3*t176+0.8318061448E-1*t179
++0.5687628827E-3*t184-0.1078086072E-3*t181-0.1078086072E-3*t182+0.5687628827E-3
+*t185-0.1607889161E-3*t195+0.9397174694E-4*t187+0.3024581465E-3*t188
+-0.3024581465E-3*t189-0.5737222431E-5*t190-0.1607889161E-3*t196;
+    t475 = t204*t303;
+    t476 = t462*t273;
+    t477 = t469*t268;
+    t478 = t476+t477;
+    t479 = t466*t258;
+    t480 = t204*t251;
+    t481 = t479+t480;
+    t482 = t481*t265;
+    t483 = t455*t87;
+    t484 = t450*t79;
+    t485 = 0.101865705E-2*t212-0.3696711277E-6*t475-0.1659098766E-1*t198
+-0.4122466806E-3*t199+0.4122466806E-3*t200-0.8945848979E-4*t204*t301
++0.8945848979E-4*t213*t303+0.3775495252E-3*t418*t308-0.7932620886E-4*t478*t278
+-0.2369931678E-4*t482-0.1702509553E-4*t476+0.2893250095E-3*t483-0.1681938551E-1
+*t484;
+    t486 = t448+t449;
+    t487 = -(0.1512290733E-3*t444)-0.2061233404E-3*t205-0.2061233404E-3*t436
+-0.9970896939E-4*t439+0.1607889161E-3*t215-0.1607889161E-3*t441+0.4677530128E-2
+*t431+0.2369931678E-4*t433-0.1081557015E-2*t486*t235-0.2570662873E-4*t465
+-0.9761137487E-4*t467+0.9761137487E-4*t468-0.1702509553E-4*t477;
+    t488 = t453*t84;
+    t489 = t484+t488;
+    t490 = t489*t87;
+    t491 = t490+t456;
+    t492 = t491*t99;
+    t493 = t489*t92;
+    t494 = t483-t493;
+    t495 = t494*t95;
+    t496 = t492+t495;
+    t497 = t472+t475;
+    t498 = t471*t261;
+    t499 = 0.8823452451E-4*t446-0.9970896939E-4*t443-0.1702509553E-4*t458
++0.2606799616E-2*t481*t261+0.9999999999*t250-0.1081557015E-2*t496*t237
+-0.1112574236E-3*t486*t237+0.8051018213E-4*t478*t305+0.1112574236E-3*t496*t235
+-0.5082624939E-2*t418*t306+0.5082624939E-2*t497*t308+0.2369931678E-4*t498
++0.4677530128E-2*t479;
+    t500 = 0.4677530128E-2*t480+0.1078086072E-3*t454+0.6660372088E-1*t201
++0.3775495252E-3*t497*t306-0.8799425961E-3*t491*t95-0.2570662873E-4*t464
++0.1832763156E-3*t495+0.7932620886E-4*t459*t324+0.2606799616E-2*t432*t317
+-0.2369931678E-4*t434+0.4677530128E-2*t430+0.1232237092E-6*t428+0.9381437244E-4
+*t417;
+    t501 = t498-t482;
+    t502 = -(0.9381437244E-4*t419)-0.1232237092E-6*t421+0.8799425961E-3*t494
+*t99-0.9419629563E-2*t490+0.8051018213E-4*t501*t278+0.7932620886E-4*t501*t305
+-0.1232237092E-6*t470+0.9381437244E-4*t460-0.9381437244E-4*t461+0.1232237092E-6
+*t463-0.2570662873E-4*t422-0.2570662873E-4*t423+0.8503258945E-4*t425;
+    t503 = -(0.8503258945E-4*t426)-0.1512290733E-3*t447-0.5687628827E-3*t223
+-0.5687628827E-3*t452-0.1681938551E-1*t488-0.2893250095E-3*t493-0.7932620886E-4
+*t435*t299-0.1702509553E-4*t457-0.1078086072E-3*t451+0.1832763156E-3*t492
++0.4402844298E-1*t166-0.1112574236E-3*t167+0.8799425961E-3*t172;
+    T[0] = t98*t99-t94*t95;
+    T[1] = t165*t99-t164*t95;
+    T[2] = t231*t99-t230*t95;
+    T[3] = IGM_CONST(0.0);
+    T[4] = t234*t235-t236*t237;
+    T[5] = t238*t235-t239*t237;
+    T[6] = t240*t235-t241*t237;
+    T[7] = IGM_CONST(0.0);
+    T[8] = t242+t243;
+    T[9] = t244+t245;
+    T[10] = t246+t247;
+    T[11] = IGM_CONST(0.0);
+    T[12] = -(0.4511E-1*t242)-0.4511E-1*t243-0.10274*t88-0.10274*t93-0.1*t80
+-0.1*t85+0.5E-1*t46+0.5E-1*t49-0.1*t15+0.1*t20-0.10274*t9-0.10274*t12+0.4511E-1
+*t1+t248;
+    T[13] = -(0.4511E-1*t244)-0.4511E-1*t245-0.10274*t161-0.10274*t163-0.1*t156
+-0.1*t159+0.5E-1*t132+0.5E-1*t135-0.1*t109+0.1*t113-0.10274*t105-0.10274*t107
++0.4511E-1*t100+t249;
+    T[14] = -(0.4511E-1*t246)-0.4511E-1*t247-0.10274*t227-0.10274*t229-0.1*t222
+-0.1*t225+0.5E-1*t198+0.5E-1*t201-0.1*t175+0.1*t179-0.10274*t171-0.10274*t173
++0.4511E-1*t166+t250;
+    T[15] = IGM_CONST(1.0);
+    A[0] = t300+t322+t323+t325+t326+t327+t328+t329;
+    A[1] = t396+t398+t402+t403+t404+t414+t415+t416;
+    A[2] = t473+t474+t485+t487+t499+t500+t502+t503;
+    return;
+  }
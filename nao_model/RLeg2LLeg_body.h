@@ -0,0 +1,331 @@
+/* Generated using codegen (2012-02-13, 17:03:54) */ 
+/*
+ * Body of RLeg2LLeg(), the IGM_* macros are described in maple_double.h.
+ */
+  IGM_REAL t1;
+  IGM_REAL t10;
+  IGM_REAL t101;
+  IGM_REAL t102;
+  IGM_REAL t103;
+  IGM_REAL t104;
+  IGM_REAL t106;
+  IGM_REAL t107;
+  IGM_REAL t11;
+  IGM_REAL t110;
+  IGM_REAL t111;
+  IGM_REAL t112;
+  IGM_REAL t113;
+  IGM_REAL t115;
+  IGM_REAL t119;
+  IGM_REAL t12;
+  IGM_REAL t120;
+  IGM_REAL t122;
+  IGM_REAL t124;
+  IGM_REAL t126;
+  IGM_REAL t127;
+  IGM_REAL t128;
+  IGM_REAL t129;
+  IGM_REAL t13;
+  IGM_REAL t130;
+  IGM_REAL t131;
+  IGM_REAL t134;
+  IGM_REAL t135;
+  IGM_REAL t136;
+  IGM_REAL t14;
+  IGM_REAL t140;
+  IGM_REAL t142;
+  IGM_REAL t147;
+  IGM_REAL t15;
+  IGM_REAL t151;
+  IGM_REAL t153;
+  IGM_REAL t156;
+  IGM_REAL t158;
+  IGM_REAL t161;
+  IGM_REAL t165;
+  IGM_REAL t168;
+  IGM_REAL t17;
+  IGM_REAL t171;
+  IGM_REAL t173;
+  IGM_REAL t177;
+  IGM_REAL t18;
+  IGM_REAL t180;
+  IGM_REAL t182;
+  IGM_REAL t185;
+  IGM_REAL t189;
+  IGM_REAL t191;
+  IGM_REAL t192;
+  IGM_REAL t195;
+  IGM_REAL t196;
+  IGM_REAL t197;
+  IGM_REAL t198;
+  IGM_REAL t201;
+  IGM_REAL t202;
+  IGM_REAL t203;
+  IGM_REAL t207;
+  IGM_REAL t209;
+  IGM_REAL t21;
+  IGM_REAL t211;
+  IGM_REAL t213;
+  IGM_REAL t214;
+  IGM_REAL t215;
+  IGM_REAL t216;
+  IGM_REAL t217;
+  IGM_REAL t218;
+  IGM_REAL t22;
+  IGM_REAL t221;
+  IGM_REAL t222;
+  IGM_REAL t223;
+  IGM_REAL t227;
+  IGM_REAL t229;
+  IGM_REAL t23;
+  IGM_REAL t234;
+  IGM_REAL t238;
+  IGM_REAL t24;
+  IGM_REAL t240;
+  IGM_REAL t243;
+  IGM_REAL t245;
+  IGM_REAL t248;
+  IGM_REAL t252;
+  IGM_REAL t255;
+  IGM_REAL t258;
+  IGM_REAL t26;
+  IGM_REAL t260;
+  IGM_REAL t264;
+  IGM_REAL t267;
+  IGM_REAL t269;
+  IGM_REAL t272;
+  IGM_REAL t276;
+  IGM_REAL t278;
+  IGM_REAL t279;
+  IGM_REAL t282;
+  IGM_REAL t283;
+  IGM_REAL t284;
+  IGM_REAL t285;
+  IGM_REAL t288;
+  IGM_REAL t289;
+  IGM_REAL t290;
+  IGM_REAL t294;
+  IGM_REAL t298;
+  IGM_REAL t3;
+  IGM_REAL t30;
+  IGM_REAL t300;
+  IGM_REAL t303;
+  IGM_REAL t304;
+  IGM_REAL t308;
+  IGM_REAL t31;
+  IGM_REAL t311;
+  IGM_REAL t315;
+  IGM_REAL t318;
+  IGM_REAL t320;
+  IGM_REAL t321;
+  IGM_REAL t322;
+  IGM_REAL t323;
+  IGM_REAL t324;
+  IGM_REAL t325;
+  IGM_REAL t33;
+  IGM_REAL t35;
+  IGM_REAL t40;
+  IGM_REAL t41;
+  IGM_REAL t45;
+  IGM_REAL t47;
+  IGM_REAL t49;
+  IGM_REAL t5;
+  IGM_REAL t52;
+  IGM_REAL t53;
+  IGM_REAL t55;
+  IGM_REAL t56;
+  IGM_REAL t59;
+  IGM_REAL t6;
+  IGM_REAL t63;
+  IGM_REAL t66;
+  IGM_REAL t69;
+  IGM_REAL t71;
+  IGM_REAL t73;
+  IGM_REAL t77;
+  IGM_REAL t79;
+  IGM_REAL t8;
+  IGM_REAL t82;
+  IGM_REAL t83;
+  IGM_REAL t85;
+  IGM_REAL t86;
+  IGM_REAL t89;
+  IGM_REAL t93;
+  IGM_REAL t95;
+  IGM_REAL t97;
+  IGM_REAL t98;
+  {
+    t1 = RL[8];
+    t3 = IGM_COS_Q(11);
+    t5 = RL[4];
+    t6 = IGM_SIN_Q(11);
+    t8 = -t1*t3-t5*t6;
+    t10 = IGM_COS_Q(10);
+    t11 = t8*t10;
+    t12 = RL[0];
+    t13 = IGM_SIN_Q(10);
+    t14 = t12*t13;
+    t15 = t11+t14;
+    t17 = IGM_COS_Q(9);
+    t18 = t15*t17;
+    t21 = t8*t13-t12*t10;
+    t22 = IGM_SIN_Q(9);
+    t23 = t21*t22;
+    t24 = t18-t23;
+    t26 = IGM_SIN_Q(8);
+    t30 = t15*t22+t21*t17;
+    t31 = IGM_COS_Q(8);
+    t33 = -t24*t26-t30*t31;
+    t35 = IGM_SIN_Q(6);
+    t40 = IGM_CONST(sqrt(2.0));
+    t41 = (t24*t31-t30*t26)*t40;
+    t45 = (-t1*t6+t5*t3)*t40;
+    t47 = t41/2.0-t45/2.0;
+    t49 = IGM_SIN_Q(7);
+    t52 = t41/2.0+t45/2.0;
+    t53 = IGM_COS_Q(7);
+    t55 = t47*t49+t52*t53;
+    t56 = IGM_COS_Q(6);
+    t59 = (t33*t35+t55*t56)*t40;
+    t63 = (-t47*t53+t52*t49)*t40;
+    t66 = (t59/2.0+t63/2.0)*t40;
+    t69 = (-t59/2.0+t63/2.0)*t40;
+    t71 = -t66/2.0+t69/2.0;
+    t73 = IGM_COS_Q(1);
+    t77 = t33*t56-t55*t35;
+    t79 = IGM_SIN_Q(0);
+    t82 = -t66/2.0-t69/2.0;
+    t83 = IGM_COS_Q(0);
+    t85 = -t77*t79+t82*t83;
+    t86 = IGM_SIN_Q(1);
+    t89 = (t71*t73+t85*t86)*t40;
+    t93 = (-t71*t86+t85*t73)*t40;
+    t95 = t89/2.0-t93/2.0;
+    t97 = IGM_COS_Q(2);
+    t98 = t95*t97;
+    t101 = t77*t83+t82*t79;
+    t102 = IGM_SIN_Q(2);
+    t103 = t101*t102;
+    t104 = t98+t103;
+    t106 = IGM_COS_Q(3);
+    t107 = t104*t106;
+    t110 = -t95*t102+t101*t97;
+    t111 = IGM_SIN_Q(3);
+    t112 = t110*t111;
+    t113 = t107+t112;
+    t115 = IGM_SIN_Q(4);
+    t119 = -t104*t111+t110*t106;
+    t120 = IGM_COS_Q(4);
+    T[0] = -t113*t115+t119*t120;
+    t122 = RL[9];
+    t124 = RL[5];
+    t126 = -t122*t3-t124*t6;
+    t127 = t126*t10;
+    t128 = RL[1];
+    t129 = t128*t13;
+    t130 = t127+t129;
+    t131 = t130*t17;
+    t134 = t126*t13-t128*t10;
+    t135 = t134*t22;
+    t136 = t131-t135;
+    t140 = t130*t22+t134*t17;
+    t142 = -t136*t26-t140*t31;
+    t147 = (t136*t31-t140*t26)*t40;
+    t151 = (-t122*t6+t124*t3)*t40;
+    t153 = t147/2.0-t151/2.0;
+    t156 = t147/2.0+t151/2.0;
+    t158 = t153*t49+t156*t53;
+    t161 = (t142*t35+t158*t56)*t40;
+    t165 = (-t153*t53+t156*t49)*t40;
+    t168 = (t161/2.0+t165/2.0)*t40;
+    t171 = (-t161/2.0+t165/2.0)*t40;
+    t173 = -t168/2.0+t171/2.0;
+    t177 = t142*t56-t158*t35;
+    t180 = -t168/2.0-t171/2.0;
+    t182 = -t177*t79+t180*t83;
+    t185 = (t173*t73+t182*t86)*t40;
+    t189 = (-t173*t86+t182*t73)*t40;
+    t191 = t185/2.0-t189/2.0;
+    t192 = t191*t97;
+    t195 = t177*t83+t180*t79;
+    t196 = t195*t102;
+    t197 = t192+t196;
+    t198 = t197*t106;
+    t201 = -t191*t102+t195*t97;
+    t202 = t201*t111;
+    t203 = t198+t202;
+    t207 = -t197*t111+t201*t106;
+    T[1] = -t203*t115+t207*t120;
+    t209 = RL[10];
+    t211 = RL[6];
+    t213 = -t209*t3-t211*t6;
+    t214 = t213*t10;
+    t215 = RL[2];
+    t216 = t215*t13;
+    t217 = t214+t216;
+    t218 = t217*t17;
+    t221 = t213*t13-t215*t10;
+    t222 = t221*t22;
+    t223 = t218-t222;
+    t227 = t217*t22+t221*t17;
+    t229 = -t223*t26-t227*t31;
+    t234 = (t223*t31-t227*t26)*t40;
+    t238 = (-t209*t6+t211*t3)*t40;
+    t240 = t234/2.0-t238/2.0;
+    t243 = t234/2.0+t238/2.0;
+    t245 = t240*t49+t243*t53;
+    t248 = (t229*t35+t245*t56)*t40;
+    t252 = (-t240*t53+t243*t49)*t40;
+    t255 = (t248/2.0+t252/2.0)*t40;
+    t258 = (-t248/2.0+t252/2.0)*t40;
+    t260 = -t255/2.0+t258/2.0;
+    t264 = t229*t56-t245*t35;
+    t267 = -t255/2.0-t258/2.0;
+    t269 = -t264*t79+t267*t83;
+    t272 = (t260*t73+t269*t86)*t40;
+    t276 = (-t260*t86+t269*t73)*t40;
+    t278 = t272/2.0-t276/2.0;
+    t279 = t278*t97;
+    t282 = t264*t83+t267*t79;
+    t283 = t282*t102;
+    t284 = t279+t283;
+    t285 = t284*t106;
+    t288 = -t278*t102+t282*t97;
+    t289 = t288*t111;
+    t290 = t285+t289;
+    t294 = -t284*t111+t288*t106;
+    T[2] = -t290*t115+t294*t120;
+    T[3] = IGM_CONST(0.0);
+    t298 = t113*t120+t119*t115;
+    t300 = IGM_SIN_Q(5);
+    t303 = t89/2.0+t93/2.0;
+    t304 = IGM_COS_Q(5);
+    T[4] = t298*t300-t303*t304;
+    t308 = t203*t120+t207*t115;
+    t311 = t185/2.0+t189/2.0;
+    T[5] = t308*t300-t311*t304;
+    t315 = t290*t120+t294*t115;
+    t318 = t272/2.0+t276/2.0;
+    T[6] = t315*t300-t318*t304;
+    T[7] = IGM_CONST(0.0);
+    t320 = t298*t304;
+    t321 = t303*t300;
+    T[8] = t320+t321;
+    t322 = t308*t304;
+    t323 = t311*t300;
+    T[9] = t322+t323;
+    t324 = t315*t304;
+    t325 = t318*t300;
+    T[10] = t324+t325;
+    T[11] = IGM_CONST(0.0);
+    T[12] = -0.4511E-1*t320-0.4511E-1*t321-0.10274*t107-0.10274*t112-0.1*t98
+-0.1*t103+0.5E-1*t59+0.5E-1*t63-0.1*t18+0.1*t23-0.10274*t11-0.10274*t14+
+0.4511E-1*t1+RL[12];
+    T[13] = -0.4511E-1*t322-0.4511E-1*t323-0.10274*t198-0.10274*t202-0.1*t192
+-0.1*t196+0.5E-1*t161+0.5E-1*t165-0.1*t131+0.1*t135-0.10274*t127-0.10274*t129+
+0.4511E-1*t122+RL[13];
+    T[14] = -0.4511E-1*t324-0.4511E-1*t325-0.10274*t285-0.10274*t289-0.1*t279
+-0.1*t283+0.5E-1*t248+0.5E-1*t252-0.1*t218+0.1*t222-0.10274*t214-0.10274*t216+
+0.4511E-1*t209+RL[14];
+    T[15] = IGM_CONST(1.0);
+    return;
+  }
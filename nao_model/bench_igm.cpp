@@ -0,0 +1,529 @@
+// bench_igm.cpp
+//
+// Microbenchmarks of the generated functions and of the stages of the
+// solver. Each function is called on random configurations within the
+// bounds of jointState, igm() is called on the ticks of the standard gait
+// (igmGait), each call is timed separately after a warmup.
+// A summary is printed to stderr, the results are printed to stdout in JSON.
+//
+// usage: bench_igm.a [number of samples]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+
+#include <time.h>
+
+#if defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#define BENCH_CYCLE_COUNTER "tsc"
+#else
+#define BENCH_CYCLE_COUNTER "none"
+#endif
+
+#include "nao_igm.h"
+#include "leg2joints.h"
+#include "maple_functions.h"
+#include "igm_solver.h"
+
+using namespace std;
+
+
+#define NUM_CONFIGURATIONS 256
+#define NUM_SAMPLES 20000
+#define NUM_WARMUP 1000
+
+/// Targets of igm() are obtained from configurations, which are this close
+/// to the initial configuration, so that the solver converges.
+#define IGM_TARGET_SCALE 0.2
+
+#define HOMOGENEOUS_MATRIX_SIZE 16
+
+
+
+/**
+ * Data of the benchmarks, the functions are called on configurations[i].
+ */
+class benchContext
+{
+    public:
+        nao_igm nao;
+        igmOptions options;
+        double mu;
+
+        jointState initial;
+        jointState configurations[NUM_CONFIGURATIONS];
+
+        /// Output of from_LLeg_3() for each configuration.
+        double kernel_output[NUM_CONFIGURATIONS][IGM_KERNEL_OUTPUT_SIZE];
+
+        /// Problems with random targets: the state is reset to initial
+        /// before each call.
+        igmModel models[NUM_CONFIGURATIONS];
+        jointState state;
+
+        /// Problems on the ticks of the standard gait: the initial guess
+        /// is the solution on the previous tick.
+        igmModel gait_models[NUM_CONFIGURATIONS];
+        jointState gait_states[NUM_CONFIGURATIONS];
+
+        double q[JOINTS_NUM];
+        double iH[LOWER_JOINTS_NUM];
+        double dq0[LOWER_JOINTS_NUM];
+        double dq[LOWER_JOINTS_NUM];
+
+        float sin_q_f[JOINTS_NUM];
+        float cos_q_f[JOINTS_NUM];
+        float LL_f[HOMOGENEOUS_MATRIX_SIZE];
+        float RL_f[HOMOGENEOUS_MATRIX_SIZE];
+        float CoM_f[POSITION_VECTOR_SIZE];
+        float out_f[IGM_KERNEL_OUTPUT_SIZE];
+
+        double out[LEG2JOINTS_OUTPUT_SIZE];
+        double T[HOMOGENEOUS_MATRIX_SIZE];
+        double CoM[POSITION_VECTOR_SIZE];
+
+        int iter;
+};
+
+
+typedef void (*benchFunction)(benchContext &, const int);
+
+
+/**
+ * Benchmarked functions.
+ */
+void bench_empty (benchContext &, const int)
+{
+}
+
+void bench_from_LLeg_3 (benchContext &c, const int i)
+{
+    from_LLeg_3(c.configurations[i].q, c.nao.left_foot_posture.data(), c.nao.right_foot_posture.data(), c.nao.CoM_position, c.out);
+}
+
+void bench_from_RLeg_3 (benchContext &c, const int i)
+{
+    from_RLeg_3(c.configurations[i].q, c.nao.right_foot_posture.data(), c.nao.left_foot_posture.data(), c.nao.CoM_position, c.out);
+}
+
+void bench_from_LLeg_3_trig (benchContext &c, const int i)
+{
+    const jointTrig &t = c.configurations[i].trig;
+    from_LLeg_3_trig(t.sin_q, t.cos_q, c.nao.left_foot_posture.data(), c.nao.right_foot_posture.data(), c.nao.CoM_position, c.out);
+}
+
+void bench_from_LLeg_3_residual_trig (benchContext &c, const int i)
+{
+    const jointTrig &t = c.configurations[i].trig;
+    from_LLeg_3_residual_trig(t.sin_q, t.cos_q, c.nao.left_foot_posture.data(), c.nao.right_foot_posture.data(), c.nao.CoM_position, c.out);
+}
+
+void bench_from_LLeg_3_float (benchContext &c, const int)
+{
+    // the first configuration converted to float
+    from_LLeg_3_float(c.sin_q_f, c.cos_q_f, c.LL_f, c.RL_f, c.CoM_f, c.out_f);
+}
+
+void bench_LLeg2CoM (benchContext &c, const int i)
+{
+    LLeg2CoM(c.configurations[i].q, c.nao.left_foot_posture.data(), c.CoM);
+}
+
+void bench_LLeg2RLeg (benchContext &c, const int i)
+{
+    LLeg2RLeg(c.configurations[i].q, c.nao.left_foot_posture.data(), c.T);
+}
+
+void bench_LLeg2RLegCoM (benchContext &c, const int i)
+{
+    LLeg2RLegCoM(c.configurations[i].q, c.nao.left_foot_posture.data(), c.T, c.CoM);
+}
+
+void bench_LLeg2CoM_trig (benchContext &c, const int i)
+{
+    const jointTrig &t = c.configurations[i].trig;
+    LLeg2CoM_trig(t.sin_q, t.cos_q, c.nao.left_foot_posture.data(), c.CoM);
+}
+
+void bench_LLeg2RLeg_trig (benchContext &c, const int i)
+{
+    const jointTrig &t = c.configurations[i].trig;
+    LLeg2RLeg_trig(t.sin_q, t.cos_q, c.nao.left_foot_posture.data(), c.T);
+}
+
+void bench_LLeg2Joints (benchContext &c, const int i)
+{
+    LLeg2Joints(c.configurations[i].q, c.nao.left_foot_posture.data(), c.out);
+}
+
+void bench_LLeg2Joints_trig (benchContext &c, const int i)
+{
+    const jointTrig &t = c.configurations[i].trig;
+    LLeg2Joints_trig(t.sin_q, t.cos_q, c.nao.left_foot_posture.data(), c.out);
+}
+
+void bench_trig_update (benchContext &c, const int i)
+{
+    c.state.trig.update(c.configurations[i].q);
+}
+
+void bench_igmSolveKKT (benchContext &c, const int i)
+{
+    igmSolveKKT(c.kernel_output[i], c.iH, c.dq0, c.dq);
+}
+
+void bench_igmSolveKKTReduced (benchContext &c, const int i)
+{
+    igmSolveKKTReduced(c.kernel_output[i], c.iH, c.dq0, c.dq);
+}
+
+void bench_igmStep (benchContext &c, const int i)
+{
+    memcpy(c.q, c.configurations[i].q, sizeof(c.q));
+    igmStep(c.options, c.kernel_output[i], c.initial.q, c.mu, c.q);
+}
+
+void bench_igm (benchContext &c, const int i)
+{
+    c.state = c.gait_states[i];
+    c.iter = c.gait_models[i].solve(c.state, c.initial.q, c.mu, 0.0015, 20);
+}
+
+void bench_igm_random (benchContext &c, const int i)
+{
+    c.state = c.initial;
+    c.iter = c.models[i].solve(c.state, c.initial.q, c.mu, 0.0015, 20);
+}
+
+
+
+/**
+ * Statistics of a benchmark.
+ */
+class benchResult
+{
+    public:
+        const char *name;
+        double min_ns;
+        double mean_ns;
+        double median_ns;
+        double p99_ns;
+        double max_ns;
+        double median_cycles;
+        double p99_cycles;
+        double max_cycles;
+};
+
+
+inline unsigned long long readCycles()
+{
+#if defined(__i386__) || defined(__x86_64__)
+    return (__rdtsc());
+#else
+    return (0);
+#endif
+}
+
+
+inline double readTime()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (t.tv_sec * 1e9 + t.tv_nsec);
+}
+
+
+/**
+ * Value of a sorted vector at the given quantile (nearest rank).
+ */
+double quantile (const vector<double> &sorted, const double q)
+{
+    size_t index = (size_t) ceil(q * sorted.size());
+    if (index > 0)
+    {
+        --index;
+    }
+    return (sorted[min(index, sorted.size() - 1)]);
+}
+
+
+/**
+ * Call the function num_samples times after num_warmup calls, the timer
+ * overheads are subtracted.
+ */
+benchResult run (
+        benchContext &context,
+        const char *name,
+        benchFunction function,
+        const int num_samples,
+        const double overhead_ns,
+        const double overhead_cycles)
+{
+    vector<double> ns(num_samples);
+    vector<double> cycles(num_samples);
+
+    for (int i = 0; i < NUM_WARMUP; ++i)
+    {
+        function(context, i % NUM_CONFIGURATIONS);
+    }
+
+    for (int i = 0; i < num_samples; ++i)
+    {
+        const int config = i % NUM_CONFIGURATIONS;
+
+        double start = readTime();
+        unsigned long long start_cycles = readCycles();
+        function(context, config);
+        unsigned long long end_cycles = readCycles();
+        double end = readTime();
+
+        ns[i] = max(end - start - overhead_ns, 0.0);
+        cycles[i] = max((double) (end_cycles - start_cycles) - overhead_cycles, 0.0);
+    }
+
+    benchResult result;
+    result.name = name;
+
+    result.mean_ns = 0.0;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        result.mean_ns += ns[i];
+    }
+    result.mean_ns /= num_samples;
+
+    sort(ns.begin(), ns.end());
+    sort(cycles.begin(), cycles.end());
+
+    result.min_ns = ns.front();
+    result.median_ns = quantile(ns, 0.5);
+    result.p99_ns = quantile(ns, 0.99);
+    result.max_ns = ns.back();
+    result.median_cycles = quantile(cycles, 0.5);
+    result.p99_cycles = quantile(cycles, 0.99);
+    result.max_cycles = cycles.back();
+
+    return (result);
+}
+
+
+
+/**
+ * Generate random configurations and the problems.
+ */
+void initContext (benchContext &c)
+{
+    c.mu = 1.2;
+
+    // the first ticks of the standard gait
+    nao_igm nao;
+    igmGait gait;
+    gait.num_steps = 0;
+    gait.init (nao);
+    const jointState gait_initial = nao.state_model;
+    for (int i = 0; i < NUM_CONFIGURATIONS; ++i)
+    {
+        gait.next (nao);
+        c.gait_states[i] = nao.state_model;
+        c.gait_models[i] = nao;
+        nao.igm (gait_initial.q, c.mu, 0.0015, 20);
+    }
+
+    c.nao.init (
+            IGM_SUPPORT_LEFT,
+            0.0, -0.05, 0.0,
+            0.0, 0.0, 0.0);
+    c.initial = c.nao.state_model;
+    c.options = c.nao.options;
+
+    srand(1);
+    for (int i = 0; i < NUM_CONFIGURATIONS; ++i)
+    {
+        jointState &s = c.configurations[i];
+        for (int j = 0; j < JOINTS_NUM; ++j)
+        {
+            s.q[j] = jointState::q_lower_bound[j] +
+                (jointState::q_upper_bound[j] - jointState::q_lower_bound[j]) * rand() / RAND_MAX;
+        }
+        s.trig.update(s.q);
+
+        from_LLeg_3_trig(s.trig.sin_q, s.trig.cos_q,
+                c.nao.left_foot_posture.data(), c.nao.right_foot_posture.data(), c.nao.CoM_position,
+                c.kernel_output[i]);
+
+
+        // the target of igm() is between the initial and the random
+        // configurations, the bounds are convex
+        jointState target = c.initial;
+        for (int j = 0; j < LOWER_JOINTS_NUM; ++j)
+        {
+            target.q[j] += IGM_TARGET_SCALE * (s.q[j] - c.initial.q[j]);
+        }
+        target.q[R_HIP_YAW_PITCH] = target.q[L_HIP_YAW_PITCH];
+
+        igmModel &model = c.models[i];
+        model.support_foot = c.nao.support_foot;
+        model.left_foot_posture = c.nao.left_foot_posture;
+        model.getSwingFootPosture(target, model.right_foot_posture.data());
+        model.getCoM(target, model.CoM_position);
+    }
+
+    for (int j = 0; j < LOWER_JOINTS_NUM; ++j)
+    {
+        c.iH[j] = 1.0;
+        c.dq0[j] = c.mu * (c.configurations[0].q[j] - c.initial.q[j]);
+    }
+
+    for (int j = 0; j < JOINTS_NUM; ++j)
+    {
+        c.sin_q_f[j] = c.configurations[0].trig.sin_q[j];
+        c.cos_q_f[j] = c.configurations[0].trig.cos_q[j];
+    }
+    for (int j = 0; j < HOMOGENEOUS_MATRIX_SIZE; ++j)
+    {
+        c.LL_f[j] = c.nao.left_foot_posture.data()[j];
+        c.RL_f[j] = c.nao.right_foot_posture.data()[j];
+    }
+    for (int j = 0; j < POSITION_VECTOR_SIZE; ++j)
+    {
+        c.CoM_f[j] = c.nao.CoM_position[j];
+    }
+}
+
+
+
+int main(int argc, char** argv)
+{
+    int num_samples = NUM_SAMPLES;
+    if (argc > 1)
+    {
+        num_samples = atoi(argv[1]);
+        if (num_samples <= 0)
+        {
+            fprintf(stderr, "usage: %s [number of samples]\n", argv[0]);
+            return (1);
+        }
+    }
+
+    benchContext *context = new benchContext;
+    initContext(*context);
+
+
+    const char *names[] = {
+        "from_LLeg_3",
+        "from_RLeg_3",
+        "from_LLeg_3_trig",
+        "from_LLeg_3_residual_trig",
+        "from_LLeg_3_float",
+        "LLeg2CoM",
+        "LLeg2RLeg",
+        "LLeg2RLegCoM",
+        "LLeg2CoM_trig",
+        "LLeg2RLeg_trig",
+        "LLeg2Joints",
+        "LLeg2Joints_trig",
+        "jointTrig::update",
+        "igmSolveKKT",
+        "igmSolveKKTReduced",
+        "igmStep",
+        "igm",
+        "igm_random",
+        NULL};
+    const benchFunction functions[] = {
+        bench_from_LLeg_3,
+        bench_from_RLeg_3,
+        bench_from_LLeg_3_trig,
+        bench_from_LLeg_3_residual_trig,
+        bench_from_LLeg_3_float,
+        bench_LLeg2CoM,
+        bench_LLeg2RLeg,
+        bench_LLeg2RLegCoM,
+        bench_LLeg2CoM_trig,
+        bench_LLeg2RLeg_trig,
+        bench_LLeg2Joints,
+        bench_LLeg2Joints_trig,
+        bench_trig_update,
+        bench_igmSolveKKT,
+        bench_igmSolveKKTReduced,
+        bench_igmStep,
+        bench_igm,
+        bench_igm_random};
+
+
+    // overhead of the timers
+    benchResult overhead = run(*context, "empty", bench_empty, num_samples, 0.0, 0.0);
+
+    vector<benchResult> results;
+    for (int i = 0; names[i] != NULL; ++i)
+    {
+        results.push_back(run(*context, names[i], functions[i], num_samples,
+                    overhead.median_ns, overhead.median_cycles));
+    }
+
+
+    // the number of iterations of igm() for reference
+    int max_iter = 0;
+    int num_failed = 0;
+    int max_iter_random = 0;
+    int num_failed_random = 0;
+    for (int i = 0; i < NUM_CONFIGURATIONS; ++i)
+    {
+        bench_igm(*context, i);
+        max_iter = max(max_iter, context->iter);
+        if (context->iter < 0)
+        {
+            ++num_failed;
+        }
+
+        bench_igm_random(*context, i);
+        max_iter_random = max(max_iter_random, context->iter);
+        if (context->iter < 0)
+        {
+            ++num_failed_random;
+        }
+    }
+
+
+    fprintf(stderr, "%-26s %10s %10s %10s %12s\n", "", "median, ns", "p99, ns", "max, ns", "median, cyc");
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        fprintf(stderr, "%-26s %10.1f %10.1f %10.1f %12.0f\n",
+                results[i].name, results[i].median_ns, results[i].p99_ns,
+                results[i].max_ns, results[i].median_cycles);
+    }
+    fprintf(stderr, "igm: max iterations = %d, failures = %d\n", max_iter, num_failed);
+    fprintf(stderr, "igm_random: max iterations = %d, failures = %d\n", max_iter_random, num_failed_random);
+
+
+    printf("{\n");
+    printf("  \"samples\": %d,\n", num_samples);
+    printf("  \"warmup\": %d,\n", NUM_WARMUP);
+    printf("  \"configurations\": %d,\n", NUM_CONFIGURATIONS);
+    printf("  \"cycle_counter\": \"%s\",\n", BENCH_CYCLE_COUNTER);
+    printf("  \"timer_overhead_ns\": %.1f,\n", overhead.median_ns);
+    printf("  \"timer_overhead_cycles\": %.0f,\n", overhead.median_cycles);
+    printf("  \"igm_max_iterations\": %d,\n", max_iter);
+    printf("  \"igm_failures\": %d,\n", num_failed);
+    printf("  \"igm_random_max_iterations\": %d,\n", max_iter_random);
+    printf("  \"igm_random_failures\": %d,\n", num_failed_random);
+    printf("  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const benchResult &r = results[i];
+        printf("    {\"name\": \"%s\", \"min_ns\": %.1f, \"mean_ns\": %.1f, \"median_ns\": %.1f, "
+                "\"p99_ns\": %.1f, \"max_ns\": %.1f, \"median_cycles\": %.0f, \"p99_cycles\": %.0f, "
+                "\"max_cycles\": %.0f}%s\n",
+                r.name, r.min_ns, r.mean_ns, r.median_ns, r.p99_ns, r.max_ns,
+                r.median_cycles, r.p99_cycles, r.max_cycles,
+                (i + 1 < results.size()) ? "," : "");
+    }
+    printf("  ]\n");
+    printf("}\n");
+
+    delete context;
+
+    return (((num_failed == 0) && (num_failed_random == 0)) ? 0 : 1);
+}
@@ -0,0 +1,351 @@
+// bench_latency.cpp
+//
+// Tail latency of igm() in a control loop: the standard gait (igmGait) is
+// followed indefinitely at a fixed rate, each call is timed. The process is optionally
+// pinned to a CPU core, SCHED_FIFO and mlockall() are used if permitted,
+// otherwise the benchmark runs with normal scheduling. A histogram of
+// latencies, quantiles and the worst ticks with their timestamps are
+// printed to stderr, the results are printed to stdout in JSON.
+//
+// usage: bench_latency.a [-c cpu] [-p priority] [-n ticks] [-t period, us]
+//   -c   pin to the core (not pinned by default),
+//   -p   SCHED_FIFO priority, 0 to keep normal scheduling (default 80),
+//   -n   the number of control ticks (default 6000),
+//   -t   control period in microseconds (default 10000, i.e. 100 Hz).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <algorithm>
+#include <vector>
+
+#include <time.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+#include "nao_igm.h"
+
+using namespace std;
+
+
+#define NUM_TICKS 6000
+#define PERIOD_US 10000
+#define FIFO_PRIORITY 80
+
+#define MAX_ITER 20
+
+/// Width of a bin of the histogram.
+#define HIST_BIN_US 5
+/// The number of bins, the last bin counts all longer calls.
+#define HIST_SIZE 100
+/// The number of reported worst ticks.
+#define NUM_OUTLIERS 10
+
+/// Size of the stack, which is touched before the loop to avoid page faults.
+#define PREFAULT_STACK_SIZE (256*1024)
+
+
+
+/**
+ * A control tick.
+ */
+class latencySample
+{
+    public:
+        int tick;
+        /// Time of the wakeup since the start of the loop in seconds.
+        double timestamp;
+        /// Duration of igm() in microseconds.
+        double latency;
+        /// Delay of the wakeup after the scheduled time in microseconds.
+        double wakeup_delay;
+        int iter;
+
+
+        bool operator< (const latencySample &sample) const
+        {
+            return (latency > sample.latency);
+        }
+};
+
+
+
+inline double getTime (const struct timespec &t)
+{
+    return (t.tv_sec * 1e6 + t.tv_nsec * 1e-3);
+}
+
+
+inline void addTime (struct timespec &t, const long ns)
+{
+    t.tv_nsec += ns;
+    while (t.tv_nsec >= 1000000000L)
+    {
+        t.tv_nsec -= 1000000000L;
+        ++t.tv_sec;
+    }
+}
+
+
+/**
+ * Value of a sorted vector at the given quantile (nearest rank).
+ */
+double quantile (const vector<double> &sorted, const double q)
+{
+    size_t index = (size_t) ceil(q * sorted.size());
+    if (index > 0)
+    {
+        --index;
+    }
+    return (sorted[min(index, sorted.size() - 1)]);
+}
+
+
+/**
+ * Touch the stack, so that it is mapped before the loop.
+ */
+void prefaultStack ()
+{
+    unsigned char stack[PREFAULT_STACK_SIZE];
+    memset(stack, 0, sizeof(stack));
+    // keep the writes
+    __asm__ __volatile__ ("" : : "r" (stack) : "memory");
+}
+
+
+
+int main(int argc, char** argv)
+{
+    int cpu = -1;
+    int priority = FIFO_PRIORITY;
+    int num_ticks = NUM_TICKS;
+    int period_us = PERIOD_US;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "c:p:n:t:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'c':
+                cpu = atoi(optarg);
+                break;
+            case 'p':
+                priority = atoi(optarg);
+                break;
+            case 'n':
+                num_ticks = atoi(optarg);
+                break;
+            case 't':
+                period_us = atoi(optarg);
+                break;
+            default:
+                num_ticks = 0;
+                break;
+        }
+    }
+    if ((num_ticks <= 0) || (period_us <= 0) || (priority < 0))
+    {
+        fprintf(stderr, "usage: %s [-c cpu] [-p priority] [-n ticks] [-t period, us]\n", argv[0]);
+        return (1);
+    }
+
+
+    // real-time setup, each step may fail without privileges
+    bool pinned = false;
+    if (cpu >= 0)
+    {
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(cpu, &cpu_set);
+        if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0)
+        {
+            pinned = true;
+        }
+        else
+        {
+            fprintf(stderr, "warning: cannot pin to CPU %d: %s\n", cpu, strerror(errno));
+        }
+    }
+
+    bool fifo = false;
+    if (priority > 0)
+    {
+        struct sched_param param;
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = priority;
+        if (sched_setscheduler(0, SCHED_FIFO, &param) == 0)
+        {
+            fifo = true;
+        }
+        else
+        {
+            fprintf(stderr, "warning: SCHED_FIFO is not permitted (%s), using normal scheduling\n", strerror(errno));
+        }
+    }
+
+    bool locked = false;
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) == 0)
+    {
+        locked = true;
+    }
+    else
+    {
+        fprintf(stderr, "warning: mlockall() failed: %s\n", strerror(errno));
+    }
+
+
+    nao_igm nao;
+    igmGait gait;
+    double ref_angles[LOWER_JOINTS_NUM];
+    vector<latencySample> samples(num_ticks);
+    vector<double> latencies(num_ticks);
+    int hist[HIST_SIZE] = {0};
+    int num_failed = 0;
+    int num_overruns = 0;
+    int max_iter = 0;
+
+    gait.num_steps = 0;
+    gait.init(nao);
+    memcpy(ref_angles, nao.state_model.q, sizeof(ref_angles));
+    prefaultStack();
+
+
+    struct timespec next;
+    struct timespec wakeup;
+    struct timespec start;
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    const double loop_start = getTime(next);
+
+    for (int i = 0; i < num_ticks; ++i)
+    {
+        addTime(next, period_us * 1000L);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR)
+        {
+        }
+        clock_gettime(CLOCK_MONOTONIC, &wakeup);
+
+        gait.next(nao);
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        int iter = nao.igm(ref_angles, 1.2, 0.0015, MAX_ITER);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        latencySample &sample = samples[i];
+        sample.tick = i;
+        sample.timestamp = (getTime(wakeup) - loop_start) * 1e-6;
+        sample.latency = getTime(end) - getTime(start);
+        sample.wakeup_delay = getTime(wakeup) - getTime(next);
+        sample.iter = iter;
+        latencies[i] = sample.latency;
+
+        int bin = (int) (sample.latency / HIST_BIN_US);
+        ++hist[min(bin, HIST_SIZE - 1)];
+
+        if (iter < 0)
+        {
+            ++num_failed;
+        }
+        else
+        {
+            max_iter = max(max_iter, iter);
+        }
+
+        // skip the missed periods
+        if (getTime(end) > getTime(next) + period_us)
+        {
+            ++num_overruns;
+            next = end;
+        }
+    }
+
+    munlockall();
+
+
+    double mean = 0.0;
+    double max_wakeup_delay = 0.0;
+    for (int i = 0; i < num_ticks; ++i)
+    {
+        mean += latencies[i];
+        max_wakeup_delay = max(max_wakeup_delay, samples[i].wakeup_delay);
+    }
+    mean /= num_ticks;
+
+    sort(latencies.begin(), latencies.end());
+    const int num_outliers = min(NUM_OUTLIERS, num_ticks);
+    partial_sort(samples.begin(), samples.begin() + num_outliers, samples.end());
+
+
+    fprintf(stderr, "pinned = %d, SCHED_FIFO = %d, mlockall = %d, ticks = %d, period = %d us\n",
+            pinned, fifo, locked, num_ticks, period_us);
+    fprintf(stderr, "igm: max iterations = %d, failures = %d, overruns = %d\n",
+            max_iter, num_failed, num_overruns);
+    fprintf(stderr, "latency, us: mean = %.1f, median = %.1f, p99 = %.1f, p99.9 = %.1f, max = %.1f\n",
+            mean, quantile(latencies, 0.5), quantile(latencies, 0.99),
+            quantile(latencies, 0.999), latencies.back());
+    fprintf(stderr, "max wakeup delay = %.1f us\n", max_wakeup_delay);
+
+    fprintf(stderr, "%12s %8s\n", "latency, us", "ticks");
+    for (int i = 0; i < HIST_SIZE; ++i)
+    {
+        if (hist[i] == 0)
+        {
+            continue;
+        }
+        if (i < HIST_SIZE - 1)
+        {
+            fprintf(stderr, "%5d - %4d %8d\n", i * HIST_BIN_US, (i + 1) * HIST_BIN_US, hist[i]);
+        }
+        else
+        {
+            fprintf(stderr, "%5d -      %8d\n", i * HIST_BIN_US, hist[i]);
+        }
+    }
+
+    fprintf(stderr, "%6s %10s %12s %12s %5s\n", "tick", "time, s", "latency, us", "wakeup, us", "iter");
+    for (int i = 0; i < num_outliers; ++i)
+    {
+        fprintf(stderr, "%6d %10.3f %12.1f %12.1f %5d\n",
+                samples[i].tick, samples[i].timestamp, samples[i].latency,
+                samples[i].wakeup_delay, samples[i].iter);
+    }
+
+
+    printf("{\n");
+    printf("  \"ticks\": %d,\n", num_ticks);
+    printf("  \"period_us\": %d,\n", period_us);
+    printf("  \"pinned\": %s,\n", pinned ? "true" : "false");
+    printf("  \"sched_fifo\": %s,\n", fifo ? "true" : "false");
+    printf("  \"mlockall\": %s,\n", locked ? "true" : "false");
+    printf("  \"igm_max_iterations\": %d,\n", max_iter);
+    printf("  \"igm_failures\": %d,\n", num_failed);
+    printf("  \"overruns\": %d,\n", num_overruns);
+    printf("  \"mean_us\": %.1f,\n", mean);
+    printf("  \"median_us\": %.1f,\n", quantile(latencies, 0.5));
+    printf("  \"p99_us\": %.1f,\n", quantile(latencies, 0.99));
+    printf("  \"p999_us\": %.1f,\n", quantile(latencies, 0.999));
+    printf("  \"max_us\": %.1f,\n", latencies.back());
+    printf("  \"max_wakeup_delay_us\": %.1f,\n", max_wakeup_delay);
+    printf("  \"histogram_bin_us\": %d,\n", HIST_BIN_US);
+    printf("  \"histogram\": [");
+    for (int i = 0; i < HIST_SIZE; ++i)
+    {
+        printf("%d%s", hist[i], (i + 1 < HIST_SIZE) ? ", " : "");
+    }
+    printf("],\n");
+    printf("  \"outliers\": [\n");
+    for (int i = 0; i < num_outliers; ++i)
+    {
+        printf("    {\"tick\": %d, \"time_s\": %.6f, \"latency_us\": %.1f, \"wakeup_delay_us\": %.1f, \"iter\": %d}%s\n",
+                samples[i].tick, samples[i].timestamp, samples[i].latency,
+                samples[i].wakeup_delay, samples[i].iter,
+                (i + 1 < num_outliers) ? "," : "");
+    }
+    printf("  ]\n");
+    printf("}\n");
+
+    return (num_failed == 0 ? 0 : 1);
+}
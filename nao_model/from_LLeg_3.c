@@ -1,5 +1,6 @@
 /* Generated using codegen (2012-03-12, 10:11:20) */
 #include <math.h>
+#include "maple_double.h"
 void from_LLeg_3(q,LL,RL,CoM,A)
 double q[24];
 double LL[16];
@@ -7,3203 +8,5 @@ double RL[16];
 double CoM[3];
 double A[130];
 {
-  double t10;
-  double t100;
-  double t1000;
-  double t1001;
-  double t1002;
-  double t1003;
-  double t1004;
-  double t1005;
-  double t1006;
-  double t1015;
-  double t1016;
-  double t1017;
-  double t1018;
-  double t1019;
-  double t102;
-  double t1020;
-  double t1021;
-  double t1024;
-  double t1025;
-  double t1026;
-  double t1027;
-  double t1028;
-  double t1029;
-  double t103;
-  double t1030;
-  double t1035;
-  double t1036;
-  double t1037;
-  double t1038;
-  double t1039;
-  double t1040;
-  double t1041;
-  double t1044;
-  double t1049;
-  double t105;
-  double t1050;
-  double t1051;
-  double t1052;
-  double t1053;
-  double t1054;
-  double t1055;
-  double t1056;
-  double t1057;
-  double t1058;
-  double t1059;
-  double t106;
-  double t1060;
-  double t1061;
-  double t1062;
-  double t1063;
-  double t1064;
-  double t1065;
-  double t1066;
-  double t1067;
-  double t1068;
-  double t1069;
-  double t107;
-  double t1072;
-  double t1073;
-  double t1074;
-  double t1075;
-  double t1076;
-  double t1077;
-  double t1078;
-  double t108;
-  double t1081;
-  double t1082;
-  double t1083;
-  double t1084;
-  double t1085;
-  double t1086;
-  double t1087;
-  double t1088;
-  double t1089;
-  double t109;
-  double t1090;
-  double t1091;
-  double t1092;
-  double t1093;
-  double t1094;
-  double t11;
-  double t110;
-  double t1101;
-  double t1102;
-  double t1103;
-  double t1104;
-  double t1105;
-  double t1106;
-  double t1107;
-  double t111;
-  double t1118;
-  double t1119;
-  double t112;
-  double t1120;
-  double t1121;
-  double t1122;
-  double t1123;
-  double t1124;
-  double t1125;
-  double t1126;
-  double t1129;
-  double t113;
-  double t1130;
-  double t1131;
-  double t1132;
-  double t1133;
-  double t1134;
-  double t1135;
-  double t1138;
-  double t1139;
-  double t114;
-  double t1140;
-  double t1141;
-  double t1142;
-  double t1143;
-  double t1144;
-  double t1147;
-  double t1148;
-  double t1149;
-  double t1150;
-  double t1151;
-  double t1152;
-  double t1153;
-  double t1156;
-  double t1157;
-  double t1158;
-  double t1159;
-  double t116;
-  double t1160;
-  double t1161;
-  double t1162;
-  double t1169;
-  double t117;
-  double t118;
-  double t119;
-  double t12;
-  double t120;
-  double t1208;
-  double t121;
-  double t123;
-  double t124;
-  double t1247;
-  double t1248;
-  double t125;
-  double t1250;
-  double t1253;
-  double t127;
-  double t129;
-  double t1297;
-  double t13;
-  double t130;
-  double t131;
-  double t132;
-  double t133;
-  double t1332;
-  double t1333;
-  double t1334;
-  double t1335;
-  double t1336;
-  double t1337;
-  double t1338;
-  double t134;
-  double t1341;
-  double t1342;
-  double t1343;
-  double t1344;
-  double t1345;
-  double t1346;
-  double t1347;
-  double t135;
-  double t1352;
-  double t136;
-  double t137;
-  double t138;
-  double t139;
-  double t1391;
-  double t1392;
-  double t1393;
-  double t1394;
-  double t1395;
-  double t1396;
-  double t1397;
-  double t14;
-  double t140;
-  double t1400;
-  double t141;
-  double t142;
-  double t143;
-  double t144;
-  double t1441;
-  double t145;
-  double t146;
-  double t147;
-  double t148;
-  double t1482;
-  double t149;
-  double t15;
-  double t150;
-  double t151;
-  double t152;
-  double t1523;
-  double t1524;
-  double t1526;
-  double t1529;
-  double t153;
-  double t154;
-  double t155;
-  double t156;
-  double t157;
-  double t1576;
-  double t158;
-  double t159;
-  double t1592;
-  double t1593;
-  double t1594;
-  double t1595;
-  double t1596;
-  double t1599;
-  double t16;
-  double t160;
-  double t1600;
-  double t1601;
-  double t1602;
-  double t1603;
-  double t162;
-  double t163;
-  double t1631;
-  double t164;
-  double t165;
-  double t166;
-  double t167;
-  double t1676;
-  double t168;
-  double t169;
-  double t1694;
-  double t1695;
-  double t1696;
-  double t1697;
-  double t1698;
-  double t17;
-  double t170;
-  double t171;
-  double t172;
-  double t1726;
-  double t174;
-  double t175;
-  double t176;
-  double t177;
-  double t1771;
-  double t179;
-  double t18;
-  double t180;
-  double t181;
-  double t1816;
-  double t1818;
-  double t1819;
-  double t1820;
-  double t1822;
-  double t1823;
-  double t1824;
-  double t1826;
-  double t1827;
-  double t1828;
-  double t1833;
-  double t1836;
-  double t1839;
-  double t184;
-  double t1842;
-  double t1845;
-  double t1848;
-  double t1851;
-  double t1854;
-  double t1857;
-  double t186;
-  double t1860;
-  double t1863;
-  double t1866;
-  double t1867;
-  double t1870;
-  double t1873;
-  double t1876;
-  double t1879;
-  double t188;
-  double t1882;
-  double t1885;
-  double t1888;
-  double t189;
-  double t1891;
-  double t1894;
-  double t1897;
-  double t19;
-  double t1900;
-  double t1902;
-  double t1905;
-  double t1908;
-  double t191;
-  double t1911;
-  double t1914;
-  double t1917;
-  double t192;
-  double t1920;
-  double t1923;
-  double t1926;
-  double t1929;
-  double t1932;
-  double t1935;
-  double t1936;
-  double t1939;
-  double t194;
-  double t1940;
-  double t1941;
-  double t1942;
-  double t1943;
-  double t1944;
-  double t1945;
-  double t1948;
-  double t1949;
-  double t195;
-  double t1950;
-  double t1951;
-  double t1952;
-  double t1953;
-  double t1954;
-  double t1957;
-  double t196;
-  double t1960;
-  double t1963;
-  double t1966;
-  double t1969;
-  double t197;
-  double t1972;
-  double t1975;
-  double t1978;
-  double t198;
-  double t1981;
-  double t1983;
-  double t199;
-  double t1990;
-  double t1995;
-  double t2;
-  double t20;
-  double t2000;
-  double t2007;
-  double t201;
-  double t2010;
-  double t2011;
-  double t2014;
-  double t2019;
-  double t202;
-  double t2026;
-  double t2029;
-  double t203;
-  double t2032;
-  double t2039;
-  double t204;
-  double t2041;
-  double t2046;
-  double t2049;
-  double t2052;
-  double t2057;
-  double t206;
-  double t2064;
-  double t2069;
-  double t207;
-  double t2074;
-  double t2079;
-  double t208;
-  double t2080;
-  double t2081;
-  double t2082;
-  double t2083;
-  double t2084;
-  double t2085;
-  double t2090;
-  double t2093;
-  double t21;
-  double t210;
-  double t2100;
-  double t2103;
-  double t212;
-  double t2127;
-  double t213;
-  double t214;
-  double t215;
-  double t2150;
-  double t216;
-  double t217;
-  double t2174;
-  double t218;
-  double t219;
-  double t2197;
-  double t2199;
-  double t22;
-  double t220;
-  double t2200;
-  double t2201;
-  double t2203;
-  double t2204;
-  double t2205;
-  double t2207;
-  double t2208;
-  double t2209;
-  double t221;
-  double t2214;
-  double t2217;
-  double t222;
-  double t2220;
-  double t2223;
-  double t2226;
-  double t2229;
-  double t223;
-  double t2232;
-  double t2235;
-  double t2238;
-  double t224;
-  double t2241;
-  double t2244;
-  double t2247;
-  double t2248;
-  double t225;
-  double t2251;
-  double t2254;
-  double t2257;
-  double t226;
-  double t2260;
-  double t2269;
-  double t227;
-  double t2278;
-  double t228;
-  double t2281;
-  double t2284;
-  double t2287;
-  double t229;
-  double t2290;
-  double t2293;
-  double t2296;
-  double t2298;
-  double t23;
-  double t230;
-  double t2301;
-  double t2304;
-  double t2307;
-  double t231;
-  double t2310;
-  double t2313;
-  double t2316;
-  double t2319;
-  double t232;
-  double t2322;
-  double t2325;
-  double t2328;
-  double t2331;
-  double t2332;
-  double t2335;
-  double t2338;
-  double t234;
-  double t2341;
-  double t2344;
-  double t2347;
-  double t235;
-  double t2350;
-  double t2353;
-  double t2356;
-  double t2359;
-  double t236;
-  double t2362;
-  double t2365;
-  double t2368;
-  double t237;
-  double t2370;
-  double t2373;
-  double t238;
-  double t2380;
-  double t2387;
-  double t239;
-  double t2392;
-  double t2397;
-  double t2398;
-  double t24;
-  double t240;
-  double t2403;
-  double t2406;
-  double t2409;
-  double t241;
-  double t2414;
-  double t2417;
-  double t242;
-  double t2426;
-  double t2429;
-  double t243;
-  double t2433;
-  double t2440;
-  double t2445;
-  double t245;
-  double t2450;
-  double t246;
-  double t2461;
-  double t2464;
-  double t247;
-  double t2471;
-  double t2476;
-  double t2479;
-  double t248;
-  double t2486;
-  double t2489;
-  double t249;
-  double t2492;
-  double t2495;
-  double t25;
-  double t250;
-  double t251;
-  double t2519;
-  double t252;
-  double t253;
-  double t254;
-  double t2544;
-  double t255;
-  double t256;
-  double t2568;
-  double t257;
-  double t258;
-  double t259;
-  double t2593;
-  double t26;
-  double t260;
-  double t261;
-  double t262;
-  double t2625;
-  double t263;
-  double t264;
-  double t2649;
-  double t265;
-  double t2657;
-  double t2662;
-  double t2688;
-  double t27;
-  double t270;
-  double t271;
-  double t2713;
-  double t272;
-  double t2724;
-  double t273;
-  double t274;
-  double t2745;
-  double t276;
-  double t277;
-  double t2770;
-  double t279;
-  double t2796;
-  double t280;
-  double t281;
-  double t2821;
-  double t284;
-  double t2847;
-  double t285;
-  double t286;
-  double t287;
-  double t2872;
-  double t288;
-  double t2898;
-  double t29;
-  double t290;
-  double t291;
-  double t2923;
-  double t2925;
-  double t2926;
-  double t2928;
-  double t2929;
-  double t293;
-  double t2931;
-  double t2933;
-  double t2937;
-  double t294;
-  double t2940;
-  double t2943;
-  double t2946;
-  double t2949;
-  double t2952;
-  double t2955;
-  double t2958;
-  double t296;
-  double t2961;
-  double t2964;
-  double t2967;
-  double t297;
-  double t2970;
-  double t2973;
-  double t2978;
-  double t298;
-  double t2983;
-  double t2988;
-  double t299;
-  double t2993;
-  double t2998;
-  double t3;
-  double t30;
-  double t300;
-  double t301;
-  double t3027;
-  double t3029;
-  double t303;
-  double t3032;
-  double t304;
-  double t305;
-  double t306;
-  double t308;
-  double t309;
-  double t31;
-  double t310;
-  double t312;
-  double t314;
-  double t315;
-  double t3150;
-  double t3152;
-  double t3154;
-  double t3159;
-  double t316;
-  double t3162;
-  double t3165;
-  double t3168;
-  double t317;
-  double t3171;
-  double t3174;
-  double t3177;
-  double t318;
-  double t3182;
-  double t3187;
-  double t319;
-  double t32;
-  double t320;
-  double t3204;
-  double t3206;
-  double t3208;
-  double t321;
-  double t3213;
-  double t3216;
-  double t3219;
-  double t322;
-  double t3222;
-  double t3225;
-  double t323;
-  double t3230;
-  double t324;
-  double t3243;
-  double t3245;
-  double t3248;
-  double t325;
-  double t326;
-  double t327;
-  double t3270;
-  double t3277;
-  double t328;
-  double t3284;
-  double t3285;
-  double t3288;
-  double t329;
-  double t3291;
-  double t3292;
-  double t3295;
-  double t3296;
-  double t3299;
-  double t330;
-  double t3300;
-  double t3303;
-  double t3304;
-  double t3307;
-  double t331;
-  double t3312;
-  double t3315;
-  double t3318;
-  double t332;
-  double t3321;
-  double t333;
-  double t334;
-  double t3349;
-  double t336;
-  double t3363;
-  double t337;
-  double t3378;
-  double t338;
-  double t339;
-  double t3392;
-  double t340;
-  double t3408;
-  double t341;
-  double t342;
-  double t3422;
-  double t343;
-  double t3437;
-  double t344;
-  double t345;
-  double t3452;
-  double t3468;
-  double t347;
-  double t3482;
-  double t3497;
-  double t35;
-  double t351;
-  double t3511;
-  double t352;
-  double t3527;
-  double t353;
-  double t354;
-  double t3541;
-  double t355;
-  double t3556;
-  double t356;
-  double t357;
-  double t3571;
-  double t358;
-  double t3587;
-  double t359;
-  double t36;
-  double t360;
-  double t3601;
-  double t361;
-  double t3616;
-  double t362;
-  double t363;
-  double t3630;
-  double t364;
-  double t3646;
-  double t365;
-  double t366;
-  double t3660;
-  double t367;
-  double t3675;
-  double t368;
-  double t369;
-  double t3690;
-  double t37;
-  double t370;
-  double t371;
-  double t372;
-  double t373;
-  double t374;
-  double t375;
-  double t376;
-  double t377;
-  double t378;
-  double t379;
-  double t38;
-  double t380;
-  double t381;
-  double t382;
-  double t383;
-  double t384;
-  double t387;
-  double t388;
-  double t389;
-  double t39;
-  double t390;
-  double t391;
-  double t392;
-  double t393;
-  double t394;
-  double t395;
-  double t396;
-  double t397;
-  double t398;
-  double t399;
-  double t4;
-  double t40;
-  double t400;
-  double t401;
-  double t402;
-  double t403;
-  double t404;
-  double t405;
-  double t406;
-  double t407;
-  double t408;
-  double t409;
-  double t410;
-  double t411;
-  double t414;
-  double t415;
-  double t416;
-  double t417;
-  double t418;
-  double t419;
-  double t42;
-  double t420;
-  double t423;
-  double t424;
-  double t425;
-  double t426;
-  double t427;
-  double t428;
-  double t429;
-  double t43;
-  double t430;
-  double t431;
-  double t432;
-  double t433;
-  double t434;
-  double t435;
-  double t436;
-  double t437;
-  double t438;
-  double t439;
-  double t44;
-  double t440;
-  double t443;
-  double t444;
-  double t445;
-  double t446;
-  double t447;
-  double t448;
-  double t449;
-  double t45;
-  double t452;
-  double t453;
-  double t454;
-  double t455;
-  double t456;
-  double t457;
-  double t458;
-  double t461;
-  double t462;
-  double t463;
-  double t464;
-  double t465;
-  double t466;
-  double t467;
-  double t47;
-  double t470;
-  double t471;
-  double t472;
-  double t473;
-  double t474;
-  double t475;
-  double t476;
-  double t477;
-  double t478;
-  double t479;
-  double t48;
-  double t480;
-  double t481;
-  double t482;
-  double t483;
-  double t484;
-  double t485;
-  double t486;
-  double t487;
-  double t488;
-  double t489;
-  double t49;
-  double t490;
-  double t491;
-  double t492;
-  double t493;
-  double t496;
-  double t497;
-  double t498;
-  double t499;
-  double t5;
-  double t50;
-  double t500;
-  double t501;
-  double t502;
-  double t505;
-  double t506;
-  double t507;
-  double t508;
-  double t509;
-  double t51;
-  double t510;
-  double t511;
-  double t512;
-  double t513;
-  double t514;
-  double t515;
-  double t516;
-  double t517;
-  double t518;
-  double t519;
-  double t52;
-  double t520;
-  double t521;
-  double t522;
-  double t523;
-  double t524;
-  double t525;
-  double t526;
-  double t527;
-  double t528;
-  double t529;
-  double t53;
-  double t530;
-  double t531;
-  double t534;
-  double t535;
-  double t536;
-  double t537;
-  double t538;
-  double t539;
-  double t54;
-  double t540;
-  double t543;
-  double t544;
-  double t545;
-  double t546;
-  double t547;
-  double t548;
-  double t549;
-  double t55;
-  double t552;
-  double t553;
-  double t554;
-  double t555;
-  double t556;
-  double t557;
-  double t558;
-  double t559;
-  double t56;
-  double t560;
-  double t561;
-  double t562;
-  double t563;
-  double t564;
-  double t565;
-  double t566;
-  double t567;
-  double t568;
-  double t569;
-  double t57;
-  double t570;
-  double t571;
-  double t572;
-  double t575;
-  double t576;
-  double t577;
-  double t578;
-  double t579;
-  double t58;
-  double t580;
-  double t581;
-  double t582;
-  double t583;
-  double t584;
-  double t585;
-  double t586;
-  double t587;
-  double t588;
-  double t589;
-  double t59;
-  double t590;
-  double t591;
-  double t592;
-  double t593;
-  double t594;
-  double t595;
-  double t596;
-  double t597;
-  double t598;
-  double t599;
-  double t6;
-  double t60;
-  double t600;
-  double t601;
-  double t602;
-  double t603;
-  double t604;
-  double t605;
-  double t606;
-  double t607;
-  double t608;
-  double t609;
-  double t61;
-  double t610;
-  double t611;
-  double t612;
-  double t613;
-  double t614;
-  double t615;
-  double t616;
-  double t617;
-  double t618;
-  double t619;
-  double t62;
-  double t620;
-  double t621;
-  double t622;
-  double t623;
-  double t624;
-  double t625;
-  double t626;
-  double t627;
-  double t63;
-  double t630;
-  double t631;
-  double t632;
-  double t633;
-  double t634;
-  double t637;
-  double t638;
-  double t639;
-  double t64;
-  double t640;
-  double t641;
-  double t644;
-  double t645;
-  double t646;
-  double t647;
-  double t648;
-  double t649;
-  double t65;
-  double t650;
-  double t653;
-  double t654;
-  double t655;
-  double t656;
-  double t657;
-  double t658;
-  double t659;
-  double t66;
-  double t660;
-  double t661;
-  double t662;
-  double t663;
-  double t664;
-  double t665;
-  double t666;
-  double t667;
-  double t668;
-  double t669;
-  double t67;
-  double t670;
-  double t671;
-  double t672;
-  double t673;
-  double t674;
-  double t675;
-  double t676;
-  double t677;
-  double t678;
-  double t679;
-  double t68;
-  double t680;
-  double t681;
-  double t682;
-  double t683;
-  double t684;
-  double t687;
-  double t688;
-  double t689;
-  double t69;
-  double t690;
-  double t691;
-  double t692;
-  double t693;
-  double t696;
-  double t697;
-  double t698;
-  double t699;
-  double t7;
-  double t70;
-  double t700;
-  double t701;
-  double t702;
-  double t703;
-  double t706;
-  double t707;
-  double t708;
-  double t709;
-  double t71;
-  double t710;
-  double t711;
-  double t712;
-  double t715;
-  double t716;
-  double t717;
-  double t718;
-  double t719;
-  double t72;
-  double t720;
-  double t721;
-  double t722;
-  double t723;
-  double t724;
-  double t725;
-  double t728;
-  double t729;
-  double t73;
-  double t730;
-  double t731;
-  double t732;
-  double t733;
-  double t734;
-  double t737;
-  double t738;
-  double t739;
-  double t740;
-  double t741;
-  double t742;
-  double t743;
-  double t746;
-  double t747;
-  double t748;
-  double t749;
-  double t750;
-  double t751;
-  double t752;
-  double t755;
-  double t756;
-  double t757;
-  double t758;
-  double t759;
-  double t760;
-  double t761;
-  double t764;
-  double t765;
-  double t766;
-  double t767;
-  double t768;
-  double t769;
-  double t770;
-  double t773;
-  double t774;
-  double t775;
-  double t776;
-  double t777;
-  double t778;
-  double t779;
-  double t78;
-  double t780;
-  double t781;
-  double t782;
-  double t783;
-  double t786;
-  double t787;
-  double t788;
-  double t789;
-  double t79;
-  double t790;
-  double t791;
-  double t792;
-  double t795;
-  double t796;
-  double t797;
-  double t798;
-  double t799;
-  double t8;
-  double t80;
-  double t800;
-  double t801;
-  double t804;
-  double t805;
-  double t806;
-  double t807;
-  double t808;
-  double t809;
-  double t81;
-  double t810;
-  double t813;
-  double t814;
-  double t815;
-  double t816;
-  double t817;
-  double t818;
-  double t819;
-  double t82;
-  double t820;
-  double t821;
-  double t822;
-  double t823;
-  double t824;
-  double t825;
-  double t828;
-  double t829;
-  double t830;
-  double t831;
-  double t832;
-  double t833;
-  double t834;
-  double t837;
-  double t838;
-  double t839;
-  double t84;
-  double t840;
-  double t841;
-  double t842;
-  double t843;
-  double t846;
-  double t847;
-  double t848;
-  double t849;
-  double t85;
-  double t850;
-  double t851;
-  double t852;
-  double t855;
-  double t856;
-  double t857;
-  double t858;
-  double t859;
-  double t860;
-  double t861;
-  double t864;
-  double t865;
-  double t866;
-  double t867;
-  double t868;
-  double t869;
-  double t87;
-  double t870;
-  double t873;
-  double t874;
-  double t875;
-  double t876;
-  double t877;
-  double t878;
-  double t879;
-  double t88;
-  double t882;
-  double t885;
-  double t886;
-  double t887;
-  double t888;
-  double t889;
-  double t89;
-  double t890;
-  double t891;
-  double t892;
-  double t893;
-  double t894;
-  double t895;
-  double t896;
-  double t897;
-  double t898;
-  double t899;
-  double t9;
-  double t90;
-  double t900;
-  double t901;
-  double t902;
-  double t903;
-  double t904;
-  double t905;
-  double t906;
-  double t907;
-  double t908;
-  double t909;
-  double t912;
-  double t913;
-  double t914;
-  double t915;
-  double t916;
-  double t917;
-  double t918;
-  double t919;
-  double t920;
-  double t921;
-  double t922;
-  double t923;
-  double t924;
-  double t925;
-  double t926;
-  double t927;
-  double t928;
-  double t929;
-  double t93;
-  double t930;
-  double t931;
-  double t932;
-  double t933;
-  double t934;
-  double t935;
-  double t936;
-  double t937;
-  double t938;
-  double t939;
-  double t94;
-  double t940;
-  double t941;
-  double t942;
-  double t943;
-  double t944;
-  double t945;
-  double t946;
-  double t947;
-  double t948;
-  double t949;
-  double t95;
-  double t952;
-  double t953;
-  double t954;
-  double t955;
-  double t956;
-  double t957;
-  double t958;
-  double t96;
-  double t963;
-  double t964;
-  double t965;
-  double t966;
-  double t967;
-  double t97;
-  double t972;
-  double t973;
-  double t974;
-  double t975;
-  double t976;
-  double t977;
-  double t978;
-  double t985;
-  double t986;
-  double t987;
-  double t988;
-  double t989;
-  double t99;
-  double t990;
-  double t991;
-  double t992;
-  double t993;
-  double t994;
-  double t995;
-  double t998;
-  double t999;
-  {
-    t2 = LL[9];
-    t3 = q[5];
-    t4 = cos(t3);
-    t5 = t2*t4;
-    t6 = LL[5];
-    t7 = sin(t3);
-    t8 = t6*t7;
-    t9 = t5+t8;
-    t10 = q[4];
-    t11 = cos(t10);
-    t12 = t9*t11;
-    t13 = LL[1];
-    t14 = sin(t10);
-    t15 = t13*t14;
-    t16 = t12-t15;
-    t17 = q[3];
-    t18 = cos(t17);
-    t19 = t16*t18;
-    t20 = t9*t14;
-    t21 = t13*t11;
-    t22 = t20+t21;
-    t23 = sin(t17);
-    t24 = t22*t23;
-    t25 = t19-t24;
-    t26 = q[2];
-    t27 = cos(t26);
-    t29 = t16*t23;
-    t30 = t22*t18;
-    t31 = t29+t30;
-    t32 = sin(t26);
-    t35 = sqrt(2.0);
-    t36 = (t25*t27-t31*t32)*t35;
-    t37 = t2*t7;
-    t38 = t6*t4;
-    t39 = -t37+t38;
-    t40 = t39*t35;
-    t42 = t36/2.0-t40/2.0;
-    t43 = q[1];
-    t44 = cos(t43);
-    t45 = t42*t44;
-    t47 = -t36/2.0-t40/2.0;
-    t48 = sin(t43);
-    t49 = t47*t48;
-    t50 = t45-t49;
-    t51 = LL[10];
-    t52 = t51*t4;
-    t53 = LL[6];
-    t54 = t53*t7;
-    t55 = t52+t54;
-    t56 = t55*t11;
-    t57 = LL[2];
-    t58 = t57*t14;
-    t59 = t56-t58;
-    t60 = t59*t18;
-    t61 = t55*t14;
-    t62 = t57*t11;
-    t63 = t61+t62;
-    t64 = t63*t23;
-    t65 = t60-t64;
-    t66 = t65*t32;
-    t67 = t59*t23;
-    t68 = t63*t18;
-    t69 = t67+t68;
-    t70 = t69*t27;
-    t71 = t66+t70;
-    t72 = q[0];
-    t73 = sin(t72);
-    t78 = (t65*t27-t69*t32)*t35;
-    t79 = t51*t7;
-    t80 = t53*t4;
-    t81 = -t79+t80;
-    t82 = t81*t35;
-    t84 = t78/2.0-t82/2.0;
-    t85 = t84*t48;
-    t87 = -t78/2.0-t82/2.0;
-    t88 = t87*t44;
-    t89 = t85+t88;
-    t90 = cos(t72);
-    t93 = (t71*t73+t89*t90)*t35;
-    t94 = t84*t44;
-    t95 = t87*t48;
-    t96 = -t94+t95;
-    t97 = t96*t35;
-    t99 = -t93/2.0+t97/2.0;
-    t100 = t99*t35;
-    t102 = -t93/2.0-t97/2.0;
-    t103 = t102*t35;
-    t105 = -t100/2.0-t103/2.0;
-    t106 = q[7];
-    t107 = cos(t106);
-    t108 = t105*t107;
-    t109 = t71*t90;
-    t110 = t89*t73;
-    t111 = t109-t110;
-    t112 = q[6];
-    t113 = sin(t112);
-    t114 = t111*t113;
-    t116 = t100/2.0-t103/2.0;
-    t117 = cos(t112);
-    t118 = t116*t117;
-    t119 = -t114+t118;
-    t120 = sin(t106);
-    t121 = t119*t120;
-    t123 = (t108+t121)*t35;
-    t124 = t105*t120;
-    t125 = t119*t107;
-    t127 = (-t124+t125)*t35;
-    t129 = t123/2.0+t127/2.0;
-    t130 = q[8];
-    t131 = cos(t130);
-    t132 = t129*t131;
-    t133 = t111*t117;
-    t134 = t116*t113;
-    t135 = -t133-t134;
-    t136 = sin(t130);
-    t137 = t135*t136;
-    t138 = t132+t137;
-    t139 = q[9];
-    t140 = cos(t139);
-    t141 = t138*t140;
-    t142 = t129*t136;
-    t143 = t135*t131;
-    t144 = -t142+t143;
-    t145 = sin(t139);
-    t146 = t144*t145;
-    t147 = t141+t146;
-    t148 = q[10];
-    t149 = cos(t148);
-    t150 = t147*t149;
-    t151 = t138*t145;
-    t152 = t144*t140;
-    t153 = -t151+t152;
-    t154 = sin(t148);
-    t155 = t153*t154;
-    t156 = t150+t155;
-    t157 = q[11];
-    t158 = cos(t157);
-    t159 = t156*t158;
-    t160 = 0.4511E-1*t159;
-    t162 = -t123/2.0+t127/2.0;
-    t163 = sin(t157);
-    t164 = t162*t163;
-    t165 = 0.4511E-1*t164;
-    t166 = 0.10274*t141;
-    t167 = 0.10274*t146;
-    t168 = 0.1*t132;
-    t169 = 0.1*t137;
-    t170 = 0.5E-1*t93;
-    t171 = 0.5E-1*t97;
-    t172 = t160+t165+t166+t167+t168+t169+t170-t171;
-    t174 = -t96;
-    t175 = t25*t32;
-    t176 = t31*t27;
-    t177 = t175+t176;
-    t179 = t42*t48;
-    t180 = t47*t44;
-    t181 = t179+t180;
-    t184 = (t177*t73+t181*t90)*t35;
-    t186 = -t50*t35;
-    t188 = -t184/2.0+t186/2.0;
-    t189 = t188*t35;
-    t191 = -t184/2.0-t186/2.0;
-    t192 = t191*t35;
-    t194 = -t189/2.0-t192/2.0;
-    t195 = t194*t107;
-    t196 = t177*t90;
-    t197 = t181*t73;
-    t198 = t196-t197;
-    t199 = t198*t113;
-    t201 = t189/2.0-t192/2.0;
-    t202 = t201*t117;
-    t203 = -t199+t202;
-    t204 = t203*t120;
-    t206 = (t195+t204)*t35;
-    t207 = t194*t120;
-    t208 = t203*t107;
-    t210 = (-t207+t208)*t35;
-    t212 = t206/2.0+t210/2.0;
-    t213 = t212*t131;
-    t214 = t198*t117;
-    t215 = t201*t113;
-    t216 = -t214-t215;
-    t217 = t216*t136;
-    t218 = t213+t217;
-    t219 = t218*t140;
-    t220 = t212*t136;
-    t221 = t216*t131;
-    t222 = -t220+t221;
-    t223 = t222*t145;
-    t224 = t219+t223;
-    t225 = t224*t149;
-    t226 = t218*t145;
-    t227 = t222*t140;
-    t228 = -t226+t227;
-    t229 = t228*t154;
-    t230 = t225+t229;
-    t231 = t230*t158;
-    t232 = 0.4511E-1*t231;
-    t234 = -t206/2.0+t210/2.0;
-    t235 = t234*t163;
-    t236 = 0.4511E-1*t235;
-    t237 = 0.10274*t219;
-    t238 = 0.10274*t223;
-    t239 = 0.1*t213;
-    t240 = 0.1*t217;
-    t241 = 0.5E-1*t184;
-    t242 = 0.5E-1*t186;
-    t243 = t232+t236+t237+t238+t239+t240+t241-t242;
-    A[0] = t50*t172-t174*t243;
-    t245 = LL[8];
-    t246 = t245*t4;
-    t247 = LL[4];
-    t248 = t247*t7;
-    t249 = t246+t248;
-    t250 = t249*t11;
-    t251 = LL[0];
-    t252 = t251*t14;
-    t253 = t250-t252;
-    t254 = t253*t18;
-    t255 = t249*t14;
-    t256 = t251*t11;
-    t257 = t255+t256;
-    t258 = t257*t23;
-    t259 = t254-t258;
-    t260 = t259*t32;
-    t261 = t253*t23;
-    t262 = t257*t18;
-    t263 = t261+t262;
-    t264 = t263*t27;
-    t265 = t260+t264;
-    t270 = (t259*t27-t263*t32)*t35;
-    t271 = t245*t7;
-    t272 = t247*t4;
-    t273 = -t271+t272;
-    t274 = t273*t35;
-    t276 = t270/2.0-t274/2.0;
-    t277 = t276*t48;
-    t279 = -t270/2.0-t274/2.0;
-    t280 = t279*t44;
-    t281 = t277+t280;
-    t284 = (t265*t73+t281*t90)*t35;
-    t285 = t276*t44;
-    t286 = t279*t48;
-    t287 = -t285+t286;
-    t288 = t287*t35;
-    t290 = -t284/2.0+t288/2.0;
-    t291 = t290*t35;
-    t293 = -t284/2.0-t288/2.0;
-    t294 = t293*t35;
-    t296 = -t291/2.0-t294/2.0;
-    t297 = t296*t107;
-    t298 = t265*t90;
-    t299 = t281*t73;
-    t300 = t298-t299;
-    t301 = t300*t113;
-    t303 = t291/2.0-t294/2.0;
-    t304 = t303*t117;
-    t305 = -t301+t304;
-    t306 = t305*t120;
-    t308 = (t297+t306)*t35;
-    t309 = t296*t120;
-    t310 = t305*t107;
-    t312 = (-t309+t310)*t35;
-    t314 = t308/2.0+t312/2.0;
-    t315 = t314*t131;
-    t316 = t300*t117;
-    t317 = t303*t113;
-    t318 = -t316-t317;
-    t319 = t318*t136;
-    t320 = t315+t319;
-    t321 = t320*t140;
-    t322 = t314*t136;
-    t323 = t318*t131;
-    t324 = -t322+t323;
-    t325 = t324*t145;
-    t326 = t321+t325;
-    t327 = t326*t149;
-    t328 = t320*t145;
-    t329 = t324*t140;
-    t330 = -t328+t329;
-    t331 = t330*t154;
-    t332 = t327+t331;
-    t333 = t332*t158;
-    t334 = 0.4511E-1*t333;
-    t336 = -t308/2.0+t312/2.0;
-    t337 = t336*t163;
-    t338 = 0.4511E-1*t337;
-    t339 = 0.10274*t321;
-    t340 = 0.10274*t325;
-    t341 = 0.1*t315;
-    t342 = 0.1*t319;
-    t343 = 0.5E-1*t284;
-    t344 = 0.5E-1*t288;
-    t345 = t334+t338+t339+t340+t341+t342+t343-t344;
-    t347 = -t287;
-    A[1] = t174*t345-t347*t172;
-    A[2] = t347*t243-t50*t345;
-    A[3] = t347;
-    A[4] = t50;
-    A[5] = t174;
-    t351 = q[17];
-    t352 = sin(t351);
-    t353 = t198*t352;
-    t354 = -t191;
-    t355 = cos(t351);
-    t356 = t354*t355;
-    t357 = -t353+t356;
-    t358 = q[19];
-    t359 = cos(t358);
-    t360 = t357*t359;
-    t361 = 0.2E-3*t360;
-    t362 = t198*t355;
-    t363 = t354*t352;
-    t364 = t362+t363;
-    t365 = q[18];
-    t366 = sin(t365);
-    t367 = t364*t366;
-    t368 = cos(t365);
-    t369 = t188*t368;
-    t370 = -t367+t369;
-    t371 = sin(t358);
-    t372 = t370*t371;
-    t373 = 0.2E-3*t372;
-    t374 = t357*t371;
-    t375 = 0.1E-4*t374;
-    t376 = t370*t359;
-    t377 = 0.1E-4*t376;
-    t378 = t364*t368;
-    t379 = 0.6427E-1*t378;
-    t380 = t188*t366;
-    t381 = 0.6427E-1*t380;
-    t382 = 0.185E-1*t184;
-    t383 = 0.1665*t186;
-    t384 = t361+t373-t375+t377+t379+t381-t382-t383;
-    t387 = q[22];
-    t388 = cos(t387);
-    t389 = t111*t388;
-    t390 = sin(t387);
-    t391 = t99*t390;
-    t392 = t389+t391;
-    t393 = q[23];
-    t394 = cos(t393);
-    t395 = t392*t394;
-    t396 = 0.383E-2*t395;
-    t397 = -t102;
-    t398 = sin(t393);
-    t399 = t397*t398;
-    t400 = 0.383E-2*t399;
-    t401 = t392*t398;
-    t402 = 0.5156E-1*t401;
-    t403 = t397*t394;
-    t404 = 0.5156E-1*t403;
-    t405 = t111*t390;
-    t406 = 0.93E-3*t405;
-    t407 = t99*t388;
-    t408 = 0.93E-3*t407;
-    t409 = 0.8075E-1*t93;
-    t410 = 0.13075*t97;
-    t411 = t396+t400+t402-t404+t406-t408-t409-t410;
-    t414 = 0.717E-2*t133;
-    t415 = 0.717E-2*t134;
-    t416 = 0.10733880938412E-1*t114;
-    t417 = 0.10733880938412E-1*t118;
-    t418 = 0.1376029796E-1*t100;
-    t419 = 0.1376029796E-1*t103;
-    t420 = -t414-t415+t416-t417+t418+t419+t170-t171;
-    t423 = t198*t388;
-    t424 = t188*t390;
-    t425 = t423+t424;
-    t426 = t425*t394;
-    t427 = 0.383E-2*t426;
-    t428 = t354*t398;
-    t429 = 0.383E-2*t428;
-    t430 = t425*t398;
-    t431 = 0.5156E-1*t430;
-    t432 = t354*t394;
-    t433 = 0.5156E-1*t432;
-    t434 = t198*t390;
-    t435 = 0.93E-3*t434;
-    t436 = t188*t388;
-    t437 = 0.93E-3*t436;
-    t438 = 0.8075E-1*t184;
-    t439 = 0.13075*t186;
-    t440 = t427+t429+t431-t433+t435-t437-t438-t439;
-    t443 = 0.2067E-1*t378;
-    t444 = 0.2067E-1*t380;
-    t445 = 0.338E-2*t367;
-    t446 = 0.338E-2*t369;
-    t447 = 0.362E-2*t353;
-    t448 = 0.362E-2*t356;
-    t449 = t443+t444+t445-t446+t447-t448-t382-t383;
-    t452 = 0.4891E-1*t219;
-    t453 = 0.4891E-1*t223;
-    t454 = 0.471E-2*t226;
-    t455 = 0.471E-2*t227;
-    t456 = 0.105E-2*t206;
-    t457 = 0.105E-2*t210;
-    t458 = t452+t453+t454-t455+t456-t457+t239+t240+t241-t242;
-    t461 = 0.356381817718E-2*t195;
-    t462 = 0.356381817718E-2*t204;
-    t463 = 0.3153696244092E-2*t207;
-    t464 = 0.3153696244092E-2*t208;
-    t465 = 0.1649E-1*t214;
-    t466 = 0.1649E-1*t215;
-    t467 = t461+t462-t463+t464-t465-t466+t241-t242;
-    t470 = t111*t352;
-    t471 = t397*t355;
-    t472 = -t470+t471;
-    t473 = t472*t359;
-    t474 = 0.2E-3*t473;
-    t475 = t111*t355;
-    t476 = t397*t352;
-    t477 = t475+t476;
-    t478 = t477*t366;
-    t479 = t99*t368;
-    t480 = -t478+t479;
-    t481 = t480*t371;
-    t482 = 0.2E-3*t481;
-    t483 = t472*t371;
-    t484 = 0.1E-4*t483;
-    t485 = t480*t359;
-    t486 = 0.1E-4*t485;
-    t487 = t477*t368;
-    t488 = 0.6427E-1*t487;
-    t489 = t99*t366;
-    t490 = 0.6427E-1*t489;
-    t491 = 0.185E-1*t93;
-    t492 = 0.1665*t97;
-    t493 = t474+t482-t484+t486+t488+t490-t491-t492;
-    t496 = 0.3E-4*t423;
-    t497 = 0.3E-4*t424;
-    t498 = 0.18E-3*t434;
-    t499 = 0.18E-3*t436;
-    t500 = 0.67885E-1*t184;
-    t501 = 0.117885*t186;
-    t502 = -t496-t497-t498+t499-t500-t501;
-    t505 = t360+t372;
-    t506 = q[21];
-    t507 = cos(t506);
-    t508 = t505*t507;
-    t509 = 0.272E-2*t508;
-    t510 = t378+t380;
-    t511 = q[20];
-    t512 = sin(t511);
-    t513 = t510*t512;
-    t514 = -t374+t376;
-    t515 = cos(t511);
-    t516 = t514*t515;
-    t517 = -t513+t516;
-    t518 = sin(t506);
-    t519 = t517*t518;
-    t520 = 0.272E-2*t519;
-    t521 = t505*t518;
-    t522 = 0.268E-2*t521;
-    t523 = t517*t507;
-    t524 = 0.268E-2*t523;
-    t525 = t510*t515;
-    t526 = 0.8296E-1*t525;
-    t527 = t514*t512;
-    t528 = 0.8296E-1*t527;
-    t529 = 0.9E-1*t378;
-    t530 = 0.9E-1*t380;
-    t531 = t509+t520+t522-t524+t526+t528+t529+t530-t382-t383;
-    t534 = 0.5386E-1*t213;
-    t535 = 0.5386E-1*t217;
-    t536 = 0.131E-2*t220;
-    t537 = 0.131E-2*t221;
-    t538 = 0.1005E-2*t206;
-    t539 = 0.1005E-2*t210;
-    t540 = t534+t535+t536-t537+t538-t539+t241-t242;
-    t543 = 0.178E-2*t362;
-    t544 = 0.178E-2*t363;
-    t545 = 0.19E-3*t353;
-    t546 = 0.19E-3*t356;
-    t547 = 0.31035E-1*t184;
-    t548 = 0.153965*t186;
-    t549 = -t543-t544+t545-t546-t547-t548;
-    t552 = t473+t481;
-    t553 = t552*t507;
-    t554 = 0.272E-2*t553;
-    t555 = t487+t489;
-    t556 = t555*t512;
-    t557 = -t483+t485;
-    t558 = t557*t515;
-    t559 = -t556+t558;
-    t560 = t559*t518;
-    t561 = 0.272E-2*t560;
-    t562 = t552*t518;
-    t563 = 0.268E-2*t562;
-    t564 = t559*t507;
-    t565 = 0.268E-2*t564;
-    t566 = t555*t515;
-    t567 = 0.8296E-1*t566;
-    t568 = t557*t512;
-    t569 = 0.8296E-1*t568;
-    t570 = 0.9E-1*t487;
-    t571 = 0.9E-1*t489;
-    t572 = t554+t561+t563-t565+t567+t569+t570+t571-t491-t492;
-    t575 = q[12];
-    t576 = sin(t575);
-    t577 = t111*t576;
-    t578 = cos(t575);
-    t579 = t397*t578;
-    t580 = -t577+t579;
-    t581 = q[14];
-    t582 = cos(t581);
-    t583 = t580*t582;
-    t584 = t111*t578;
-    t585 = t397*t576;
-    t586 = t584+t585;
-    t587 = q[13];
-    t588 = sin(t587);
-    t589 = t586*t588;
-    t590 = cos(t587);
-    t591 = t99*t590;
-    t592 = -t589+t591;
-    t593 = sin(t581);
-    t594 = t592*t593;
-    t595 = t583+t594;
-    t596 = q[16];
-    t597 = cos(t596);
-    t598 = t595*t597;
-    t599 = 0.272E-2*t598;
-    t600 = t586*t590;
-    t601 = t99*t588;
-    t602 = t600+t601;
-    t603 = q[15];
-    t604 = sin(t603);
-    t605 = t602*t604;
-    t606 = t580*t593;
-    t607 = t592*t582;
-    t608 = -t606+t607;
-    t609 = cos(t603);
-    t610 = t608*t609;
-    t611 = -t605+t610;
-    t612 = sin(t596);
-    t613 = t611*t612;
-    t614 = 0.272E-2*t613;
-    t615 = t595*t612;
-    t616 = 0.268E-2*t615;
-    t617 = t611*t597;
-    t618 = 0.268E-2*t617;
-    t619 = t602*t609;
-    t620 = 0.8296E-1*t619;
-    t621 = t608*t604;
-    t622 = 0.8296E-1*t621;
-    t623 = 0.9E-1*t600;
-    t624 = 0.9E-1*t601;
-    t625 = 0.1165*t93;
-    t626 = 0.685E-1*t97;
-    t627 = t599+t614-t616+t618+t620+t622+t623+t624-t625-t626;
-    t630 = 0.48E-2*t109;
-    t631 = 0.48E-2*t110;
-    t632 = 0.38665E-1*t93;
-    t633 = 0.88605E-1*t97;
-    t634 = -t630+t631-t632-t633;
-    t637 = 0.48E-2*t196;
-    t638 = 0.48E-2*t197;
-    t639 = 0.38665E-1*t184;
-    t640 = 0.88605E-1*t186;
-    t641 = -t637+t638-t639-t640;
-    t644 = 0.4891E-1*t141;
-    t645 = 0.4891E-1*t146;
-    t646 = 0.471E-2*t151;
-    t647 = 0.471E-2*t152;
-    t648 = 0.105E-2*t123;
-    t649 = 0.105E-2*t127;
-    t650 = t644+t645+t646-t647+t648-t649+t168+t169+t170-t171;
-    t653 = t198*t578;
-    t654 = t354*t576;
-    t655 = t653+t654;
-    t656 = t655*t590;
-    t657 = t188*t588;
-    t658 = t656+t657;
-    t659 = t658*t609;
-    t660 = 0.194E-1*t659;
-    t661 = t198*t576;
-    t662 = t354*t578;
-    t663 = -t661+t662;
-    t664 = t663*t593;
-    t665 = t655*t588;
-    t666 = t188*t590;
-    t667 = -t665+t666;
-    t668 = t667*t582;
-    t669 = -t664+t668;
-    t670 = t669*t604;
-    t671 = 0.194E-1*t670;
-    t672 = t658*t604;
-    t673 = 0.304E-2*t672;
-    t674 = t669*t609;
-    t675 = 0.304E-2*t674;
-    t676 = t663*t582;
-    t677 = 0.25E-2*t676;
-    t678 = t667*t593;
-    t679 = 0.25E-2*t678;
-    t680 = 0.9E-1*t656;
-    t681 = 0.9E-1*t657;
-    t682 = 0.1165*t184;
-    t683 = 0.685E-1*t186;
-    t684 = t660+t671-t673+t675-t677-t679+t680+t681-t682-t683;
-    t687 = 0.2E-3*t676;
-    t688 = 0.2E-3*t678;
-    t689 = 0.1E-4*t664;
-    t690 = 0.1E-4*t668;
-    t691 = 0.6427E-1*t656;
-    t692 = 0.6427E-1*t657;
-    t693 = t687+t688+t689-t690+t691+t692-t682-t683;
-    t696 = -0.1232237092E-1*A[5]*t384+0.9857689952E-1*A[4]*t411+0.1497956955E-1
-*A[4]*t420-0.9857689952E-1*A[5]*t440-0.2515757084E-1*A[5]*t449-0.6142781518E-1*
-A[5]*t458-0.2797813032E-1*A[5]*t467+0.1232237092E-1*A[4]*t493-0.1232237092E-1*A
-[5]*t502-0.2959933166E-1*A[5]*t531-0.8229664675E-1*A[5]*t540-0.1444192625E-1*A
-[5]*t549+0.2959933166E-1*A[4]*t572+0.2959933166E-1*A[4]*t627+0.2122202187*A[4]*
-t634-0.2122202187*A[5]*t641+0.6142781518E-1*A[4]*t650-0.7795827887E-2*A[5]*t684
--0.1232237092E-1*A[5]*t693;
-    t697 = 0.178E-2*t653;
-    t698 = 0.178E-2*t654;
-    t699 = 0.19E-3*t661;
-    t700 = 0.19E-3*t662;
-    t701 = 0.103965*t184;
-    t702 = 0.81035E-1*t186;
-    t703 = -t697-t698+t699-t700-t701-t702;
-    t706 = 0.194E-1*t619;
-    t707 = 0.194E-1*t621;
-    t708 = 0.304E-2*t605;
-    t709 = 0.304E-2*t610;
-    t710 = 0.25E-2*t583;
-    t711 = 0.25E-2*t594;
-    t712 = t706+t707-t708+t709-t710-t711+t623+t624-t625-t626;
-    t715 = 0.3208E-1*t231;
-    t716 = 0.3208E-1*t235;
-    t717 = t230*t163;
-    t718 = 0.33E-2*t717;
-    t719 = t234*t158;
-    t720 = 0.33E-2*t719;
-    t721 = t224*t154;
-    t722 = 0.2489E-1*t721;
-    t723 = t228*t149;
-    t724 = 0.2489E-1*t723;
-    t725 = t715+t716+t718-t720+t722-t724+t237+t238+t239+t240+t241-t242;
-    t728 = 0.2067E-1*t487;
-    t729 = 0.2067E-1*t489;
-    t730 = 0.338E-2*t478;
-    t731 = 0.338E-2*t479;
-    t732 = 0.362E-2*t470;
-    t733 = 0.362E-2*t471;
-    t734 = t728+t729+t730-t731+t732-t733-t491-t492;
-    t737 = 0.2067E-1*t656;
-    t738 = 0.2067E-1*t657;
-    t739 = 0.388E-2*t665;
-    t740 = 0.388E-2*t666;
-    t741 = 0.362E-2*t661;
-    t742 = 0.362E-2*t662;
-    t743 = t737+t738-t739+t740+t741-t742-t682-t683;
-    t746 = 0.2067E-1*t600;
-    t747 = 0.2067E-1*t601;
-    t748 = 0.388E-2*t589;
-    t749 = 0.388E-2*t591;
-    t750 = 0.362E-2*t577;
-    t751 = 0.362E-2*t579;
-    t752 = t746+t747-t748+t749+t750-t751-t625-t626;
-    t755 = 0.638E-2*t225;
-    t756 = 0.638E-2*t229;
-    t757 = 0.142E-2*t721;
-    t758 = 0.142E-2*t723;
-    t759 = 0.14E-3*t206;
-    t760 = 0.14E-3*t210;
-    t761 = -t755-t756+t757-t758+t759-t760+t237+t238+t239+t240+t241-t242;
-    t764 = 0.178E-2*t584;
-    t765 = 0.178E-2*t585;
-    t766 = 0.19E-3*t577;
-    t767 = 0.19E-3*t579;
-    t768 = 0.103965*t93;
-    t769 = 0.81035E-1*t97;
-    t770 = -t764-t765+t766-t767-t768-t769;
-    t773 = 0.3208E-1*t159;
-    t774 = 0.3208E-1*t164;
-    t775 = t156*t163;
-    t776 = 0.33E-2*t775;
-    t777 = t162*t158;
-    t778 = 0.33E-2*t777;
-    t779 = t147*t154;
-    t780 = 0.2489E-1*t779;
-    t781 = t153*t149;
-    t782 = 0.2489E-1*t781;
-    t783 = t773+t774+t776-t778+t780-t782+t166+t167+t168+t169+t170-t171;
-    t786 = 0.717E-2*t214;
-    t787 = 0.717E-2*t215;
-    t788 = 0.10733880938412E-1*t199;
-    t789 = 0.10733880938412E-1*t202;
-    t790 = 0.1376029796E-1*t189;
-    t791 = 0.1376029796E-1*t192;
-    t792 = -t786-t787+t788-t789+t790+t791+t241-t242;
-    t795 = 0.2E-3*t583;
-    t796 = 0.2E-3*t594;
-    t797 = 0.1E-4*t606;
-    t798 = 0.1E-4*t607;
-    t799 = 0.6427E-1*t600;
-    t800 = 0.6427E-1*t601;
-    t801 = t795+t796+t797-t798+t799+t800-t625-t626;
-    t804 = 0.5386E-1*t132;
-    t805 = 0.5386E-1*t137;
-    t806 = 0.131E-2*t142;
-    t807 = 0.131E-2*t143;
-    t808 = 0.1005E-2*t123;
-    t809 = 0.1005E-2*t127;
-    t810 = t804+t805+t806-t807+t808-t809+t170-t171;
-    t813 = t676+t678;
-    t814 = t813*t597;
-    t815 = 0.272E-2*t814;
-    t816 = -t672+t674;
-    t817 = t816*t612;
-    t818 = 0.272E-2*t817;
-    t819 = t813*t612;
-    t820 = 0.268E-2*t819;
-    t821 = t816*t597;
-    t822 = 0.268E-2*t821;
-    t823 = 0.8296E-1*t659;
-    t824 = 0.8296E-1*t670;
-    t825 = t815+t818-t820+t822+t823+t824+t680+t681-t682-t683;
-    t828 = 0.3E-4*t389;
-    t829 = 0.3E-4*t391;
-    t830 = 0.18E-3*t405;
-    t831 = 0.18E-3*t407;
-    t832 = 0.67885E-1*t93;
-    t833 = 0.117885*t97;
-    t834 = -t828-t829-t830+t831-t832-t833;
-    t837 = 0.356381817718E-2*t108;
-    t838 = 0.356381817718E-2*t121;
-    t839 = 0.3153696244092E-2*t124;
-    t840 = 0.3153696244092E-2*t125;
-    t841 = 0.1649E-1*t133;
-    t842 = 0.1649E-1*t134;
-    t843 = t837+t838-t839+t840-t841-t842+t170-t171;
-    t846 = 0.638E-2*t150;
-    t847 = 0.638E-2*t155;
-    t848 = 0.142E-2*t779;
-    t849 = 0.142E-2*t781;
-    t850 = 0.14E-3*t123;
-    t851 = 0.14E-3*t127;
-    t852 = -t846-t847+t848-t849+t850-t851+t166+t167+t168+t169+t170-t171;
-    t855 = 0.178E-2*t475;
-    t856 = 0.178E-2*t476;
-    t857 = 0.19E-3*t470;
-    t858 = 0.19E-3*t471;
-    t859 = 0.31035E-1*t93;
-    t860 = 0.153965*t97;
-    t861 = -t855-t856+t857-t858-t859-t860;
-    t864 = 0.194E-1*t566;
-    t865 = 0.194E-1*t568;
-    t866 = 0.304E-2*t556;
-    t867 = 0.304E-2*t558;
-    t868 = 0.25E-2*t473;
-    t869 = 0.25E-2*t481;
-    t870 = t864+t865+t866-t867-t868-t869+t570+t571-t491-t492;
-    t873 = 0.194E-1*t525;
-    t874 = 0.194E-1*t527;
-    t875 = 0.304E-2*t513;
-    t876 = 0.304E-2*t516;
-    t877 = 0.25E-2*t360;
-    t878 = 0.25E-2*t372;
-    t879 = t873+t874+t875-t876-t877-t878+t529+t530-t382-t383;
-    t882 = -0.1444192625E-1*A[5]*t703+0.7795827887E-2*A[4]*t712-0.3371437079E-1
-*A[5]*t725+0.2515757084E-1*A[4]*t734-0.2515757084E-1*A[5]*t743+0.2515757084E-1*
-A[4]*t752-0.2872669523E-1*A[5]*t761+0.1444192625E-1*A[4]*t770+0.3371437079E-1*A
-[4]*t783-0.1497956955E-1*A[5]*t792+0.1232237092E-1*A[4]*t801+0.8229664675E-1*A
-[4]*t810-0.2959933166E-1*A[5]*t825+0.1232237092E-1*A[4]*t834+0.2797813032E-1*A
-[4]*t843+0.2872669523E-1*A[4]*t852+0.1444192625E-1*A[4]*t861+0.7795827887E-2*A
-[4]*t870-0.7795827887E-2*A[5]*t879;
-    A[6] = t696+t882;
-    t885 = t300*t352;
-    t886 = -t293;
-    t887 = t886*t355;
-    t888 = -t885+t887;
-    t889 = t888*t359;
-    t890 = 0.2E-3*t889;
-    t891 = t300*t355;
-    t892 = t886*t352;
-    t893 = t891+t892;
-    t894 = t893*t366;
-    t895 = t290*t368;
-    t896 = -t894+t895;
-    t897 = t896*t371;
-    t898 = 0.2E-3*t897;
-    t899 = t888*t371;
-    t900 = 0.1E-4*t899;
-    t901 = t896*t359;
-    t902 = 0.1E-4*t901;
-    t903 = t893*t368;
-    t904 = 0.6427E-1*t903;
-    t905 = t290*t366;
-    t906 = 0.6427E-1*t905;
-    t907 = 0.185E-1*t284;
-    t908 = 0.1665*t288;
-    t909 = t890+t898-t900+t902+t904+t906-t907-t908;
-    t912 = t300*t576;
-    t913 = t886*t578;
-    t914 = -t912+t913;
-    t915 = t914*t582;
-    t916 = t300*t578;
-    t917 = t886*t576;
-    t918 = t916+t917;
-    t919 = t918*t588;
-    t920 = t290*t590;
-    t921 = -t919+t920;
-    t922 = t921*t593;
-    t923 = t915+t922;
-    t924 = t923*t597;
-    t925 = 0.272E-2*t924;
-    t926 = t918*t590;
-    t927 = t290*t588;
-    t928 = t926+t927;
-    t929 = t928*t604;
-    t930 = t914*t593;
-    t931 = t921*t582;
-    t932 = -t930+t931;
-    t933 = t932*t609;
-    t934 = -t929+t933;
-    t935 = t934*t612;
-    t936 = 0.272E-2*t935;
-    t937 = t923*t612;
-    t938 = 0.268E-2*t937;
-    t939 = t934*t597;
-    t940 = 0.268E-2*t939;
-    t941 = t928*t609;
-    t942 = 0.8296E-1*t941;
-    t943 = t932*t604;
-    t944 = 0.8296E-1*t943;
-    t945 = 0.9E-1*t926;
-    t946 = 0.9E-1*t927;
-    t947 = 0.1165*t284;
-    t948 = 0.685E-1*t288;
-    t949 = t925+t936-t938+t940+t942+t944+t945+t946-t947-t948;
-    t952 = 0.717E-2*t316;
-    t953 = 0.717E-2*t317;
-    t954 = 0.10733880938412E-1*t301;
-    t955 = 0.10733880938412E-1*t304;
-    t956 = 0.1376029796E-1*t291;
-    t957 = 0.1376029796E-1*t294;
-    t958 = -t952-t953+t954-t955+t956+t957+t343-t344;
-    t963 = 0.48E-2*t298;
-    t964 = 0.48E-2*t299;
-    t965 = 0.38665E-1*t284;
-    t966 = 0.88605E-1*t288;
-    t967 = -t963+t964-t965-t966;
-    t972 = 0.2067E-1*t903;
-    t973 = 0.2067E-1*t905;
-    t974 = 0.338E-2*t894;
-    t975 = 0.338E-2*t895;
-    t976 = 0.362E-2*t885;
-    t977 = 0.362E-2*t887;
-    t978 = t972+t973+t974-t975+t976-t977-t907-t908;
-    t985 = t300*t388;
-    t986 = 0.3E-4*t985;
-    t987 = t290*t390;
-    t988 = 0.3E-4*t987;
-    t989 = t300*t390;
-    t990 = 0.18E-3*t989;
-    t991 = t290*t388;
-    t992 = 0.18E-3*t991;
-    t993 = 0.67885E-1*t284;
-    t994 = 0.117885*t288;
-    t995 = -t986-t988-t990+t992-t993-t994;
-    t998 = 0.638E-2*t327;
-    t999 = 0.638E-2*t331;
-    t1000 = t326*t154;
-    t1001 = 0.142E-2*t1000;
-    t1002 = t330*t149;
-    t1003 = 0.142E-2*t1002;
-    t1004 = 0.14E-3*t308;
-    t1005 = 0.14E-3*t312;
-    t1006 = -t998-t999+t1001-t1003+t1004-t1005+t339+t340+t341+t342+t343-t344;
-    t1015 = 0.2E-3*t915;
-    t1016 = 0.2E-3*t922;
-    t1017 = 0.1E-4*t930;
-    t1018 = 0.1E-4*t931;
-    t1019 = 0.6427E-1*t926;
-    t1020 = 0.6427E-1*t927;
-    t1021 = t1015+t1016+t1017-t1018+t1019+t1020-t947-t948;
-    t1024 = 0.356381817718E-2*t297;
-    t1025 = 0.356381817718E-2*t306;
-    t1026 = 0.3153696244092E-2*t309;
-    t1027 = 0.3153696244092E-2*t310;
-    t1028 = 0.1649E-1*t316;
-    t1029 = 0.1649E-1*t317;
-    t1030 = t1024+t1025-t1026+t1027-t1028-t1029+t343-t344;
-    t1035 = 0.4891E-1*t321;
-    t1036 = 0.4891E-1*t325;
-    t1037 = 0.471E-2*t328;
-    t1038 = 0.471E-2*t329;
-    t1039 = 0.105E-2*t308;
-    t1040 = 0.105E-2*t312;
-    t1041 = t1035+t1036+t1037-t1038+t1039-t1040+t341+t342+t343-t344;
-    t1044 = -0.2515757084E-1*A[3]*t734+0.1232237092E-1*A[5]*t909+
-0.2959933166E-1*A[5]*t949+0.1497956955E-1*A[5]*t958-0.2959933166E-1*A[3]*t627+
-0.2122202187*A[5]*t967-0.9857689952E-1*A[3]*t411+0.2515757084E-1*A[5]*t978
--0.3371437079E-1*A[3]*t783-0.2797813032E-1*A[3]*t843+0.1232237092E-1*A[5]*t995+
-0.2872669523E-1*A[5]*t1006-0.2515757084E-1*A[3]*t752-0.8229664675E-1*A[3]*t810
--0.2872669523E-1*A[3]*t852+0.1232237092E-1*A[5]*t1021+0.2797813032E-1*A[5]*
-t1030-0.1497956955E-1*A[3]*t420+0.6142781518E-1*A[5]*t1041;
-    t1049 = t889+t897;
-    t1050 = t1049*t507;
-    t1051 = 0.272E-2*t1050;
-    t1052 = t903+t905;
-    t1053 = t1052*t512;
-    t1054 = -t899+t901;
-    t1055 = t1054*t515;
-    t1056 = -t1053+t1055;
-    t1057 = t1056*t518;
-    t1058 = 0.272E-2*t1057;
-    t1059 = t1049*t518;
-    t1060 = 0.268E-2*t1059;
-    t1061 = t1056*t507;
-    t1062 = 0.268E-2*t1061;
-    t1063 = t1052*t515;
-    t1064 = 0.8296E-1*t1063;
-    t1065 = t1054*t512;
-    t1066 = 0.8296E-1*t1065;
-    t1067 = 0.9E-1*t903;
-    t1068 = 0.9E-1*t905;
-    t1069 = t1051+t1058+t1060-t1062+t1064+t1066+t1067+t1068-t907-t908;
-    t1072 = 0.194E-1*t1063;
-    t1073 = 0.194E-1*t1065;
-    t1074 = 0.304E-2*t1053;
-    t1075 = 0.304E-2*t1055;
-    t1076 = 0.25E-2*t889;
-    t1077 = 0.25E-2*t897;
-    t1078 = t1072+t1073+t1074-t1075-t1076-t1077+t1067+t1068-t907-t908;
-    t1081 = t985+t987;
-    t1082 = t1081*t394;
-    t1083 = 0.383E-2*t1082;
-    t1084 = t886*t398;
-    t1085 = 0.383E-2*t1084;
-    t1086 = t1081*t398;
-    t1087 = 0.5156E-1*t1086;
-    t1088 = t886*t394;
-    t1089 = 0.5156E-1*t1088;
-    t1090 = 0.93E-3*t989;
-    t1091 = 0.93E-3*t991;
-    t1092 = 0.8075E-1*t284;
-    t1093 = 0.13075*t288;
-    t1094 = t1083+t1085+t1087-t1089+t1090-t1091-t1092-t1093;
-    t1101 = 0.194E-1*t941;
-    t1102 = 0.194E-1*t943;
-    t1103 = 0.304E-2*t929;
-    t1104 = 0.304E-2*t933;
-    t1105 = 0.25E-2*t915;
-    t1106 = 0.25E-2*t922;
-    t1107 = t1101+t1102-t1103+t1104-t1105-t1106+t945+t946-t947-t948;
-    t1118 = 0.3208E-1*t333;
-    t1119 = 0.3208E-1*t337;
-    t1120 = t332*t163;
-    t1121 = 0.33E-2*t1120;
-    t1122 = t336*t158;
-    t1123 = 0.33E-2*t1122;
-    t1124 = 0.2489E-1*t1000;
-    t1125 = 0.2489E-1*t1002;
-    t1126 = t1118+t1119+t1121-t1123+t1124-t1125+t339+t340+t341+t342+t343-t344;
-    t1129 = 0.178E-2*t891;
-    t1130 = 0.178E-2*t892;
-    t1131 = 0.19E-3*t885;
-    t1132 = 0.19E-3*t887;
-    t1133 = 0.31035E-1*t284;
-    t1134 = 0.153965*t288;
-    t1135 = -t1129-t1130+t1131-t1132-t1133-t1134;
-    t1138 = 0.178E-2*t916;
-    t1139 = 0.178E-2*t917;
-    t1140 = 0.19E-3*t912;
-    t1141 = 0.19E-3*t913;
-    t1142 = 0.103965*t284;
-    t1143 = 0.81035E-1*t288;
-    t1144 = -t1138-t1139+t1140-t1141-t1142-t1143;
-    t1147 = 0.2067E-1*t926;
-    t1148 = 0.2067E-1*t927;
-    t1149 = 0.388E-2*t919;
-    t1150 = 0.388E-2*t920;
-    t1151 = 0.362E-2*t912;
-    t1152 = 0.362E-2*t913;
-    t1153 = t1147+t1148-t1149+t1150+t1151-t1152-t947-t948;
-    t1156 = 0.5386E-1*t315;
-    t1157 = 0.5386E-1*t319;
-    t1158 = 0.131E-2*t322;
-    t1159 = 0.131E-2*t323;
-    t1160 = 0.1005E-2*t308;
-    t1161 = 0.1005E-2*t312;
-    t1162 = t1156+t1157+t1158-t1159+t1160-t1161+t343-t344;
-    t1169 = -0.1444192625E-1*A[3]*t770-0.6142781518E-1*A[3]*t650+
-0.2959933166E-1*A[5]*t1069+0.7795827887E-2*A[5]*t1078+0.9857689952E-1*A[5]*
-t1094-0.7795827887E-2*A[3]*t712-0.2122202187*A[3]*t634+0.7795827887E-2*A[5]*
-t1107-0.2959933166E-1*A[3]*t572-0.1444192625E-1*A[3]*t861-0.7795827887E-2*A[3]*
-t870-0.1232237092E-1*A[3]*t801+0.3371437079E-1*A[5]*t1126+0.1444192625E-1*A[5]*
-t1135+0.1444192625E-1*A[5]*t1144+0.2515757084E-1*A[5]*t1153+0.8229664675E-1*A
-[5]*t1162-0.1232237092E-1*A[3]*t493-0.1232237092E-1*A[3]*t834;
-    A[7] = t1044+t1169;
-    t1208 = 0.2959933166E-1*A[3]*t531-0.2122202187*A[4]*t967-0.7795827887E-2*A
-[4]*t1078+0.1232237092E-1*A[3]*t502+0.1232237092E-1*A[3]*t384-0.2515757084E-1*A
-[4]*t1153-0.1497956955E-1*A[4]*t958+0.2515757084E-1*A[3]*t743-0.6142781518E-1*A
-[4]*t1041+0.1497956955E-1*A[3]*t792-0.9857689952E-1*A[4]*t1094+0.2959933166E-1*
-A[3]*t825-0.2872669523E-1*A[4]*t1006+0.2515757084E-1*A[3]*t449+0.2872669523E-1*
-A[3]*t761+0.1444192625E-1*A[3]*t549-0.1444192625E-1*A[4]*t1144-0.2797813032E-1*
-A[4]*t1030+0.7795827887E-2*A[3]*t684;
-    t1247 = -0.7795827887E-2*A[4]*t1107-0.2515757084E-1*A[4]*t978+
-0.6142781518E-1*A[3]*t458-0.3371437079E-1*A[4]*t1126+0.3371437079E-1*A[3]*t725
--0.1232237092E-1*A[4]*t909-0.2959933166E-1*A[4]*t1069+0.8229664675E-1*A[3]*t540
--0.1232237092E-1*A[4]*t995-0.8229664675E-1*A[4]*t1162+0.2122202187*A[3]*t641+
-0.7795827887E-2*A[3]*t879-0.1444192625E-1*A[4]*t1135+0.1444192625E-1*A[3]*t703
--0.2959933166E-1*A[4]*t949+0.1232237092E-1*A[3]*t693+0.9857689952E-1*A[3]*t440
--0.1232237092E-1*A[4]*t1021+0.2797813032E-1*A[3]*t467;
-    A[8] = t1208+t1247;
-    A[9] = 1.0;
-    t1248 = -t177;
-    t1250 = -t71;
-    A[10] = t1248*t172-t1250*t243;
-    t1253 = -t265;
-    A[11] = t1250*t345-t1253*t172;
-    A[12] = t1253*t243-t1248*t345;
-    A[13] = t1253;
-    A[14] = t1248;
-    A[15] = t1250;
-    t1297 = -0.2872669523E-1*A[15]*t761+0.3371437079E-1*A[14]*t783+
-0.2959933166E-1*A[14]*t572+0.2515757084E-1*A[14]*t734-0.2959933166E-1*A[15]*
-t531+0.7795827887E-2*A[14]*t712-0.3371437079E-1*A[15]*t725-0.2797813032E-1*A
-[15]*t467-0.1232237092E-1*A[15]*t384-0.8229664675E-1*A[15]*t540+0.2872669523E-1
-*A[14]*t852+0.2797813032E-1*A[14]*t843+0.1444192625E-1*A[14]*t861+0.2122202187*
-A[14]*t634-0.2122202187*A[15]*t641-0.7795827887E-2*A[15]*t879+0.2515757084E-1*A
-[14]*t752+0.2959933166E-1*A[14]*t627-0.2959933166E-1*A[15]*t825+0.1232237092E-1
-*A[14]*t801;
-    t1332 = 0.717E-2*t66;
-    t1333 = 0.717E-2*t70;
-    t1334 = 0.10733880938412E-1*t85;
-    t1335 = 0.10733880938412E-1*t88;
-    t1336 = 0.2752059592378E-1*t94;
-    t1337 = 0.2752059592378E-1*t95;
-    t1338 = -t1332-t1333-t1334-t1335+t1336-t1337;
-    t1341 = 0.717E-2*t175;
-    t1342 = 0.717E-2*t176;
-    t1343 = 0.10733880938412E-1*t179;
-    t1344 = 0.10733880938412E-1*t180;
-    t1345 = 0.2752059592378E-1*t45;
-    t1346 = 0.2752059592378E-1*t49;
-    t1347 = -t1341-t1342-t1343-t1344+t1345-t1346;
-    t1352 = -0.1444192625E-1*A[15]*t549-0.1232237092E-1*A[15]*t693
--0.6142781518E-1*A[15]*t458+0.6142781518E-1*A[14]*t650+0.1497956955E-1*A[14]*
-t420-0.1444192625E-1*A[15]*t703+0.9857689952E-1*A[14]*t411+0.8229664675E-1*A
-[14]*t810-0.1232237092E-1*A[15]*t502-0.9857689952E-1*A[15]*t440+0.1444192625E-1
-*A[14]*t770-0.7795827887E-2*A[15]*t684-0.1497956955E-1*A[15]*t792
--0.2515757084E-1*A[15]*t743+0.7795827887E-2*A[14]*t870-0.2515757084E-1*A[15]*
-t449+0.1232237092E-1*A[14]*t834+0.1497956955E-1*A[14]*t1338-0.1497956955E-1*A
-[15]*t1347+0.1232237092E-1*A[14]*t493;
-    A[16] = t1297+t1352;
-    t1391 = 0.717E-2*t260;
-    t1392 = 0.717E-2*t264;
-    t1393 = 0.10733880938412E-1*t277;
-    t1394 = 0.10733880938412E-1*t280;
-    t1395 = 0.2752059592378E-1*t285;
-    t1396 = 0.2752059592378E-1*t286;
-    t1397 = -t1391-t1392-t1393-t1394+t1395-t1396;
-    t1400 = -0.1497956955E-1*A[13]*t1338+0.1232237092E-1*A[15]*t995
--0.1444192625E-1*A[13]*t861-0.1232237092E-1*A[13]*t493-0.9857689952E-1*A[13]*
-t411+0.1497956955E-1*A[15]*t958-0.1444192625E-1*A[13]*t770-0.2959933166E-1*A
-[13]*t627+0.2122202187*A[15]*t967+0.1444192625E-1*A[15]*t1135+0.2515757084E-1*A
-[15]*t978+0.2797813032E-1*A[15]*t1030+0.3371437079E-1*A[15]*t1126+
-0.8229664675E-1*A[15]*t1162-0.7795827887E-2*A[13]*t712+0.2959933166E-1*A[15]*
-t1069+0.1232237092E-1*A[15]*t1021+0.2515757084E-1*A[15]*t1153-0.1232237092E-1*A
-[13]*t834+0.1497956955E-1*A[15]*t1397;
-    t1441 = 0.1444192625E-1*A[15]*t1144-0.2872669523E-1*A[13]*t852+
-0.2959933166E-1*A[15]*t949-0.2515757084E-1*A[13]*t734-0.1232237092E-1*A[13]*
-t801+0.9857689952E-1*A[15]*t1094-0.2959933166E-1*A[13]*t572-0.2122202187*A[13]*
-t634-0.2797813032E-1*A[13]*t843+0.7795827887E-2*A[15]*t1107-0.6142781518E-1*A
-[13]*t650-0.2515757084E-1*A[13]*t752-0.7795827887E-2*A[13]*t870+0.7795827887E-2
-*A[15]*t1078-0.1497956955E-1*A[13]*t420+0.1232237092E-1*A[15]*t909
--0.8229664675E-1*A[13]*t810+0.6142781518E-1*A[15]*t1041-0.3371437079E-1*A[13]*
-t783+0.2872669523E-1*A[15]*t1006;
-    A[17] = t1400+t1441;
-    t1482 = -0.7795827887E-2*A[14]*t1078+0.2872669523E-1*A[13]*t761
--0.2515757084E-1*A[14]*t1153+0.2515757084E-1*A[13]*t449+0.1497956955E-1*A[13]*
-t1347+0.1232237092E-1*A[13]*t384-0.1232237092E-1*A[14]*t995+0.2959933166E-1*A
-[13]*t825+0.1444192625E-1*A[13]*t549+0.2959933166E-1*A[13]*t531-0.3371437079E-1
-*A[14]*t1126-0.7795827887E-2*A[14]*t1107+0.2797813032E-1*A[13]*t467+
-0.7795827887E-2*A[13]*t684-0.2959933166E-1*A[14]*t1069+0.2515757084E-1*A[13]*
-t743-0.1444192625E-1*A[14]*t1144-0.2515757084E-1*A[14]*t978+0.9857689952E-1*A
-[13]*t440-0.9857689952E-1*A[14]*t1094;
-    t1523 = -0.2959933166E-1*A[14]*t949+0.2122202187*A[13]*t641+0.7795827887E-2
-*A[13]*t879-0.2122202187*A[14]*t967+0.1232237092E-1*A[13]*t693-0.2872669523E-1*
-A[14]*t1006-0.6142781518E-1*A[14]*t1041+0.1232237092E-1*A[13]*t502
--0.1497956955E-1*A[14]*t958+0.1497956955E-1*A[13]*t792-0.1232237092E-1*A[14]*
-t909+0.1444192625E-1*A[13]*t703-0.2797813032E-1*A[14]*t1030+0.3371437079E-1*A
-[13]*t725-0.1232237092E-1*A[14]*t1021+0.6142781518E-1*A[13]*t458
--0.1444192625E-1*A[14]*t1135+0.8229664675E-1*A[13]*t540-0.8229664675E-1*A[14]*
-t1162-0.1497956955E-1*A[14]*t1397;
-    A[18] = t1482+t1523;
-    A[19] = 0.0;
-    t1524 = -t39;
-    t1526 = -t81;
-    A[20] = t1524*t172-t1526*t243;
-    t1529 = -t273;
-    A[21] = t1526*t345-t1529*t172;
-    A[22] = t1529*t243-t1524*t345;
-    A[23] = t1529;
-    A[24] = t1524;
-    A[25] = t1526;
-    t1576 = 0.6142781518E-1*A[24]*t650+0.2515757084E-1*A[24]*t734+
-0.2797813032E-1*A[24]*t843+0.8229664675E-1*A[24]*t810+0.1232237092E-1*A[24]*
-t493-0.7795827887E-2*A[25]*t879-0.1444192625E-1*A[25]*t703-0.2515757084E-1*A
-[25]*t449-0.2959933166E-1*A[25]*t825+0.2122202187*A[24]*t634-0.2122202187*A[25]
-*t641;
-    t1592 = 0.335875721E-2*t78;
-    t1593 = 0.205060966E-3*t82;
-    t1594 = 0.1649E-1*t66;
-    t1595 = 0.1649E-1*t70;
-    t1596 = -t1592+t1593-t1594-t1595;
-    t1599 = 0.335875721E-2*t36;
-    t1600 = 0.205060966E-3*t40;
-    t1601 = 0.1649E-1*t175;
-    t1602 = 0.1649E-1*t176;
-    t1603 = -t1599+t1600-t1601-t1602;
-    t1631 = 0.9857689952E-1*A[24]*t411-0.2959933166E-1*A[25]*t531+
-0.2515757084E-1*A[24]*t752-0.3371437079E-1*A[25]*t725+0.1497956955E-1*A[24]*
-t420-0.7795827887E-2*A[25]*t684+0.1232237092E-1*A[24]*t834-0.2872669523E-1*A
-[25]*t761-0.2797813032E-1*A[25]*t467-0.1497956955E-1*A[25]*t1347+
-0.2872669523E-1*A[24]*t852;
-    A[26] = -0.1497956955E-1*A[25]*t792+0.1444192625E-1*A[24]*t861
--0.1232237092E-1*A[25]*t693+0.3371437079E-1*A[24]*t783-0.1232237092E-1*A[25]*
-t502+0.1497956955E-1*A[24]*t1338+0.7795827887E-2*A[24]*t870+0.2959933166E-1*A
-[24]*t627-0.6142781518E-1*A[25]*t458+0.7795827887E-2*A[24]*t712+t1576+
-0.2959933166E-1*A[24]*t572+0.1444192625E-1*A[24]*t770-0.1232237092E-1*A[25]*
-t384-0.2515757084E-1*A[25]*t743-0.8229664675E-1*A[25]*t540-0.1444192625E-1*A
-[25]*t549-0.9857689952E-1*A[25]*t440+0.2797813032E-1*A[24]*t1596
--0.2797813032E-1*A[25]*t1603+0.1232237092E-1*A[24]*t801+t1631;
-    t1676 = -0.1232237092E-1*A[23]*t834+0.1444192625E-1*A[25]*t1135
--0.1232237092E-1*A[23]*t801+0.3371437079E-1*A[25]*t1126+0.1444192625E-1*A[25]*
-t1144+0.1232237092E-1*A[25]*t1021+0.1232237092E-1*A[25]*t909+0.2959933166E-1*A
-[25]*t1069+0.2515757084E-1*A[25]*t1153-0.2797813032E-1*A[23]*t1596+
-0.8229664675E-1*A[25]*t1162;
-    t1694 = 0.335875721E-2*t270;
-    t1695 = 0.205060966E-3*t274;
-    t1696 = 0.1649E-1*t260;
-    t1697 = 0.1649E-1*t264;
-    t1698 = -t1694+t1695-t1696-t1697;
-    t1726 = -0.2515757084E-1*A[23]*t734+0.1232237092E-1*A[25]*t995
--0.1232237092E-1*A[23]*t493-0.3371437079E-1*A[23]*t783+0.9857689952E-1*A[25]*
-t1094+0.6142781518E-1*A[25]*t1041+0.2122202187*A[25]*t967-0.2122202187*A[23]*
-t634+0.7795827887E-2*A[25]*t1107-0.2797813032E-1*A[23]*t843-0.8229664675E-1*A
-[23]*t810;
-    A[27] = -0.7795827887E-2*A[23]*t870-0.7795827887E-2*A[23]*t712
--0.1444192625E-1*A[23]*t770+0.7795827887E-2*A[25]*t1078-0.2959933166E-1*A[23]*
-t572-0.2959933166E-1*A[23]*t627+0.2959933166E-1*A[25]*t949+0.2515757084E-1*A
-[25]*t978-0.1444192625E-1*A[23]*t861-0.2872669523E-1*A[23]*t852+t1676
--0.1497956955E-1*A[23]*t420+0.1497956955E-1*A[25]*t958-0.2515757084E-1*A[23]*
-t752-0.6142781518E-1*A[23]*t650+0.1497956955E-1*A[25]*t1397-0.1497956955E-1*A
-[23]*t1338+0.2872669523E-1*A[25]*t1006-0.9857689952E-1*A[23]*t411+
-0.2797813032E-1*A[25]*t1698+0.2797813032E-1*A[25]*t1030+t1726;
-    t1771 = -0.9857689952E-1*A[24]*t1094+0.2797813032E-1*A[23]*t1603
--0.2959933166E-1*A[24]*t949-0.1444192625E-1*A[24]*t1144-0.2959933166E-1*A[24]*
-t1069+0.1497956955E-1*A[23]*t792+0.9857689952E-1*A[23]*t440-0.1232237092E-1*A
-[24]*t1021+0.7795827887E-2*A[23]*t684-0.2515757084E-1*A[24]*t1153
--0.1232237092E-1*A[24]*t995;
-    t1816 = 0.2515757084E-1*A[23]*t743+0.2872669523E-1*A[23]*t761+
-0.6142781518E-1*A[23]*t458-0.2872669523E-1*A[24]*t1006-0.7795827887E-2*A[24]*
-t1078-0.6142781518E-1*A[24]*t1041+0.2515757084E-1*A[23]*t449+0.2797813032E-1*A
-[23]*t467-0.2797813032E-1*A[24]*t1030+0.1232237092E-1*A[23]*t502
--0.1497956955E-1*A[24]*t958;
-    A[28] = 0.1444192625E-1*A[23]*t703+0.3371437079E-1*A[23]*t725
--0.3371437079E-1*A[24]*t1126-0.1497956955E-1*A[24]*t1397+0.2959933166E-1*A[23]*
-t531+0.2959933166E-1*A[23]*t825-0.2797813032E-1*A[24]*t1698+0.2122202187*A[23]*
-t641+0.1444192625E-1*A[23]*t549-0.2122202187*A[24]*t967+t1771+0.1497956955E-1*A
-[23]*t1347+0.1232237092E-1*A[23]*t693+0.8229664675E-1*A[23]*t540
--0.1444192625E-1*A[24]*t1135-0.1232237092E-1*A[24]*t909-0.7795827887E-2*A[24]*
-t1107-0.8229664675E-1*A[24]*t1162+0.7795827887E-2*A[23]*t879+0.1232237092E-1*A
-[23]*t384-0.2515757084E-1*A[24]*t978+t1816;
-    A[29] = 0.0;
-    t1818 = 0.1*t60;
-    t1819 = 0.1*t64;
-    t1820 = t160+t165+t166+t167+t168+t169+t170-t171+t1818-t1819;
-    t1822 = 0.1*t19;
-    t1823 = 0.1*t24;
-    t1824 = t232+t236+t237+t238+t239+t240+t241-t242+t1822-t1823;
-    A[30] = A[24]*t1820-A[25]*t1824;
-    t1826 = 0.1*t254;
-    t1827 = 0.1*t258;
-    t1828 = t334+t338+t339+t340+t341+t342+t343-t344+t1826-t1827;
-    A[31] = A[25]*t1828-A[23]*t1820;
-    A[32] = A[23]*t1824-A[24]*t1828;
-    A[33] = A[23];
-    A[34] = A[24];
-    A[35] = A[25];
-    t1833 = t728+t729+t730-t731+t732-t733-t491-t492+t1818-t1819;
-    t1836 = t452+t453+t454-t455+t456-t457+t239+t240+t241-t242+t1822-t1823;
-    t1839 = t660+t671-t673+t675-t677-t679+t680+t681-t682-t683+t1822-t1823;
-    t1842 = t873+t874+t875-t876-t877-t878+t529+t530-t382-t383+t1822-t1823;
-    t1845 = t715+t716+t718-t720+t722-t724+t237+t238+t239+t240+t241-t242+t1822-
-t1823;
-    t1848 = t599+t614-t616+t618+t620+t622+t623+t624-t625-t626+t1818-t1819;
-    t1851 = t737+t738-t739+t740+t741-t742-t682-t683+t1822-t1823;
-    t1854 = -t496-t497-t498+t499-t500-t501+t1822-t1823;
-    t1857 = -t414-t415+t416-t417+t418+t419+t170-t171+t1818-t1819;
-    t1860 = -t697-t698+t699-t700-t701-t702+t1822-t1823;
-    t1863 = -t786-t787+t788-t789+t790+t791+t241-t242+t1822-t1823;
-    t1866 = 0.2515757084E-1*A[34]*t1833-0.6142781518E-1*A[35]*t1836
--0.7795827887E-2*A[35]*t1839-0.7795827887E-2*A[35]*t1842-0.3371437079E-1*A[35]*
-t1845+0.2959933166E-1*A[34]*t1848-0.2515757084E-1*A[35]*t1851-0.1232237092E-1*A
-[35]*t1854+0.1497956955E-1*A[34]*t1857-0.1444192625E-1*A[35]*t1860
--0.1497956955E-1*A[35]*t1863;
-    t1867 = t554+t561+t563-t565+t567+t569+t570+t571-t491-t492+t1818-t1819;
-    t1870 = t746+t747-t748+t749+t750-t751-t625-t626+t1818-t1819;
-    t1873 = t443+t444+t445-t446+t447-t448-t382-t383+t1822-t1823;
-    t1876 = t687+t688+t689-t690+t691+t692-t682-t683+t1822-t1823;
-    t1879 = t706+t707-t708+t709-t710-t711+t623+t624-t625-t626+t1818-t1819;
-    t1882 = t815+t818-t820+t822+t823+t824+t680+t681-t682-t683+t1822-t1823;
-    t1885 = t509+t520+t522-t524+t526+t528+t529+t530-t382-t383+t1822-t1823;
-    t1888 = -t828-t829-t830+t831-t832-t833+t1818-t1819;
-    t1891 = t795+t796+t797-t798+t799+t800-t625-t626+t1818-t1819;
-    t1894 = t396+t400+t402-t404+t406-t408-t409-t410+t1818-t1819;
-    t1897 = t837+t838-t839+t840-t841-t842+t170-t171+t1818-t1819;
-    t1900 = 0.2959933166E-1*A[34]*t1867+0.2515757084E-1*A[34]*t1870
--0.2515757084E-1*A[35]*t1873-0.1232237092E-1*A[35]*t1876+0.7795827887E-2*A[34]*
-t1879-0.2959933166E-1*A[35]*t1882-0.2959933166E-1*A[35]*t1885+0.1232237092E-1*A
-[34]*t1888+0.1232237092E-1*A[34]*t1891+0.9857689952E-1*A[34]*t1894+
-0.2797813032E-1*A[34]*t1897;
-    t1902 = t644+t645+t646-t647+t648-t649+t168+t169+t170-t171+t1818-t1819;
-    t1905 = t361+t373-t375+t377+t379+t381-t382-t383+t1822-t1823;
-    t1908 = -t846-t847+t848-t849+t850-t851+t166+t167+t168+t169+t170-t171+t1818-
-t1819;
-    t1911 = t427+t429+t431-t433+t435-t437-t438-t439+t1822-t1823;
-    t1914 = -t1592+t1593-t1594-t1595+t1818-t1819;
-    t1917 = -t543-t544+t545-t546-t547-t548+t1822-t1823;
-    t1920 = t461+t462-t463+t464-t465-t466+t241-t242+t1822-t1823;
-    t1923 = -t630+t631-t632-t633+t1818-t1819;
-    t1926 = -t755-t756+t757-t758+t759-t760+t237+t238+t239+t240+t241-t242+t1822-
-t1823;
-    t1929 = t864+t865+t866-t867-t868-t869+t570+t571-t491-t492+t1818-t1819;
-    t1932 = -t1341-t1342-t1343-t1344+t1345-t1346+t1822-t1823;
-    t1935 = 0.6142781518E-1*A[34]*t1902-0.1232237092E-1*A[35]*t1905+
-0.2872669523E-1*A[34]*t1908-0.9857689952E-1*A[35]*t1911+0.2797813032E-1*A[34]*
-t1914-0.1444192625E-1*A[35]*t1917-0.2797813032E-1*A[35]*t1920+0.2122202187*A
-[34]*t1923-0.2872669523E-1*A[35]*t1926+0.7795827887E-2*A[34]*t1929
--0.1497956955E-1*A[35]*t1932;
-    t1936 = -t1599+t1600-t1601-t1602+t1822-t1823;
-    t1939 = 0.4614E-1*t60;
-    t1940 = 0.4614E-1*t64;
-    t1941 = 0.131E-2*t67;
-    t1942 = 0.131E-2*t68;
-    t1943 = 0.201E-2*t79;
-    t1944 = 0.201E-2*t80;
-    t1945 = t1939-t1940+t1941+t1942-t1943+t1944;
-    t1948 = 0.4614E-1*t19;
-    t1949 = 0.4614E-1*t24;
-    t1950 = 0.131E-2*t29;
-    t1951 = 0.131E-2*t30;
-    t1952 = 0.201E-2*t37;
-    t1953 = 0.201E-2*t38;
-    t1954 = t1948-t1949+t1950+t1951-t1952+t1953;
-    t1957 = -t764-t765+t766-t767-t768-t769+t1818-t1819;
-    t1960 = -t1332-t1333-t1334-t1335+t1336-t1337+t1818-t1819;
-    t1963 = t804+t805+t806-t807+t808-t809+t170-t171+t1818-t1819;
-    t1966 = t773+t774+t776-t778+t780-t782+t166+t167+t168+t169+t170-t171+t1818-
-t1819;
-    t1969 = -t637+t638-t639-t640+t1822-t1823;
-    t1972 = -t855-t856+t857-t858-t859-t860+t1818-t1819;
-    t1975 = t474+t482-t484+t486+t488+t490-t491-t492+t1818-t1819;
-    t1978 = t534+t535+t536-t537+t538-t539+t241-t242+t1822-t1823;
-    t1981 = -0.2797813032E-1*A[35]*t1936+0.8229664675E-1*A[34]*t1945
--0.8229664675E-1*A[35]*t1954+0.1444192625E-1*A[34]*t1957+0.1497956955E-1*A[34]*
-t1960+0.8229664675E-1*A[34]*t1963+0.3371437079E-1*A[34]*t1966-0.2122202187*A
-[35]*t1969+0.1444192625E-1*A[34]*t1972+0.1232237092E-1*A[34]*t1975
--0.8229664675E-1*A[35]*t1978;
-    A[36] = t1866+t1900+t1935+t1981;
-    t1983 = t1156+t1157+t1158-t1159+t1160-t1161+t343-t344+t1826-t1827;
-    t1990 = t1118+t1119+t1121-t1123+t1124-t1125+t339+t340+t341+t342+t343-t344+
-t1826-t1827;
-    t1995 = -t998-t999+t1001-t1003+t1004-t1005+t339+t340+t341+t342+t343-t344+
-t1826-t1827;
-    t2000 = t1015+t1016+t1017-t1018+t1019+t1020-t947-t948+t1826-t1827;
-    t2007 = -t963+t964-t965-t966+t1826-t1827;
-    t2010 = 0.8229664675E-1*A[35]*t1983-0.1444192625E-1*A[33]*t1972
--0.3371437079E-1*A[33]*t1966+0.3371437079E-1*A[35]*t1990-0.8229664675E-1*A[33]*
-t1963+0.2872669523E-1*A[35]*t1995-0.2959933166E-1*A[33]*t1848+0.1232237092E-1*A
-[35]*t2000-0.2122202187*A[33]*t1923-0.2959933166E-1*A[33]*t1867+0.2122202187*A
-[35]*t2007;
-    t2011 = t890+t898-t900+t902+t904+t906-t907-t908+t1826-t1827;
-    t2014 = t1051+t1058+t1060-t1062+t1064+t1066+t1067+t1068-t907-t908+t1826-
-t1827;
-    t2019 = -t986-t988-t990+t992-t993-t994+t1826-t1827;
-    t2026 = -t1129-t1130+t1131-t1132-t1133-t1134+t1826-t1827;
-    t2029 = t1083+t1085+t1087-t1089+t1090-t1091-t1092-t1093+t1826-t1827;
-    t2032 = t1035+t1036+t1037-t1038+t1039-t1040+t341+t342+t343-t344+t1826-t1827
-;
-    t2039 = 0.1232237092E-1*A[35]*t2011+0.2959933166E-1*A[35]*t2014
--0.6142781518E-1*A[33]*t1902+0.1232237092E-1*A[35]*t2019-0.7795827887E-2*A[33]*
-t1879-0.2797813032E-1*A[33]*t1897+0.1444192625E-1*A[35]*t2026+0.9857689952E-1*A
-[35]*t2029+0.6142781518E-1*A[35]*t2032-0.7795827887E-2*A[33]*t1929
--0.1232237092E-1*A[33]*t1891;
-    t2041 = t1024+t1025-t1026+t1027-t1028-t1029+t343-t344+t1826-t1827;
-    t2046 = t925+t936-t938+t940+t942+t944+t945+t946-t947-t948+t1826-t1827;
-    t2049 = -t952-t953+t954-t955+t956+t957+t343-t344+t1826-t1827;
-    t2052 = t1147+t1148-t1149+t1150+t1151-t1152-t947-t948+t1826-t1827;
-    t2057 = t1072+t1073+t1074-t1075-t1076-t1077+t1067+t1068-t907-t908+t1826-
-t1827;
-    t2064 = -t1391-t1392-t1393-t1394+t1395-t1396+t1826-t1827;
-    t2069 = 0.2797813032E-1*A[35]*t2041-0.1232237092E-1*A[33]*t1975+
-0.2959933166E-1*A[35]*t2046+0.1497956955E-1*A[35]*t2049+0.2515757084E-1*A[35]*
-t2052-0.2872669523E-1*A[33]*t1908+0.7795827887E-2*A[35]*t2057-0.1497956955E-1*A
-[33]*t1857-0.1232237092E-1*A[33]*t1888+0.1497956955E-1*A[35]*t2064
--0.1497956955E-1*A[33]*t1960;
-    t2074 = -t1694+t1695-t1696-t1697+t1826-t1827;
-    t2079 = 0.4614E-1*t254;
-    t2080 = 0.4614E-1*t258;
-    t2081 = 0.131E-2*t261;
-    t2082 = 0.131E-2*t262;
-    t2083 = 0.201E-2*t271;
-    t2084 = 0.201E-2*t272;
-    t2085 = t2079-t2080+t2081+t2082-t2083+t2084;
-    t2090 = t1101+t1102-t1103+t1104-t1105-t1106+t945+t946-t947-t948+t1826-t1827
-;
-    t2093 = t972+t973+t974-t975+t976-t977-t907-t908+t1826-t1827;
-    t2100 = -t1138-t1139+t1140-t1141-t1142-t1143+t1826-t1827;
-    t2103 = -0.2515757084E-1*A[33]*t1870-0.9857689952E-1*A[33]*t1894+
-0.2797813032E-1*A[35]*t2074-0.2797813032E-1*A[33]*t1914+0.8229664675E-1*A[35]*
-t2085-0.8229664675E-1*A[33]*t1945+0.7795827887E-2*A[35]*t2090+0.2515757084E-1*A
-[35]*t2093-0.2515757084E-1*A[33]*t1833-0.1444192625E-1*A[33]*t1957+
-0.1444192625E-1*A[35]*t2100;
-    A[37] = t2010+t2039+t2069+t2103;
-    t2127 = -0.2959933166E-1*A[34]*t2046+0.2122202187*A[33]*t1969
--0.2797813032E-1*A[34]*t2041-0.1232237092E-1*A[34]*t2019-0.2515757084E-1*A[34]*
-t2093+0.2797813032E-1*A[33]*t1920-0.6142781518E-1*A[34]*t2032-0.2959933166E-1*A
-[34]*t2014-0.1497956955E-1*A[34]*t2049+0.2959933166E-1*A[33]*t1882+
-0.7795827887E-2*A[33]*t1842;
-    t2150 = -0.1444192625E-1*A[34]*t2026-0.8229664675E-1*A[34]*t1983+
-0.1444192625E-1*A[33]*t1917-0.1232237092E-1*A[34]*t2011-0.2872669523E-1*A[34]*
-t1995-0.2122202187*A[34]*t2007-0.1232237092E-1*A[34]*t2000+0.7795827887E-2*A
-[33]*t1839+0.1444192625E-1*A[33]*t1860-0.7795827887E-2*A[34]*t2057+
-0.2515757084E-1*A[33]*t1873;
-    t2174 = 0.1232237092E-1*A[33]*t1854+0.6142781518E-1*A[33]*t1836+
-0.1232237092E-1*A[33]*t1876+0.2797813032E-1*A[33]*t1936-0.2797813032E-1*A[34]*
-t2074+0.8229664675E-1*A[33]*t1954-0.8229664675E-1*A[34]*t2085-0.3371437079E-1*A
-[34]*t1990+0.1232237092E-1*A[33]*t1905-0.2515757084E-1*A[34]*t2052+
-0.2515757084E-1*A[33]*t1851;
-    t2197 = 0.2872669523E-1*A[33]*t1926+0.8229664675E-1*A[33]*t1978+
-0.2959933166E-1*A[33]*t1885+0.3371437079E-1*A[33]*t1845-0.1444192625E-1*A[34]*
-t2100-0.9857689952E-1*A[34]*t2029+0.1497956955E-1*A[33]*t1863-0.7795827887E-2*A
-[34]*t2090+0.9857689952E-1*A[33]*t1911+0.1497956955E-1*A[33]*t1932
--0.1497956955E-1*A[34]*t2064;
-    A[38] = t2127+t2150+t2174+t2197;
-    A[39] = 0.0;
-    t2199 = 0.10274*t56;
-    t2200 = 0.10274*t58;
-    t2201 = t160+t165+t166+t167+t168+t169+t170-t171+t1818-t1819+t2199-t2200;
-    t2203 = 0.10274*t12;
-    t2204 = 0.10274*t15;
-    t2205 = t232+t236+t237+t238+t239+t240+t241-t242+t1822-t1823+t2203-t2204;
-    A[40] = A[34]*t2201-A[35]*t2205;
-    t2207 = 0.10274*t250;
-    t2208 = 0.10274*t252;
-    t2209 = t334+t338+t339+t340+t341+t342+t343-t344+t1826-t1827+t2207-t2208;
-    A[41] = A[35]*t2209-A[33]*t2201;
-    A[42] = A[33]*t2205-A[34]*t2209;
-    A[43] = A[33];
-    A[44] = A[34];
-    A[45] = A[35];
-    t2214 = t534+t535+t536-t537+t538-t539+t241-t242+t1822-t1823+t2203-t2204;
-    t2217 = t715+t716+t718-t720+t722-t724+t237+t238+t239+t240+t241-t242+t1822-
-t1823+t2203-t2204;
-    t2220 = t706+t707-t708+t709-t710-t711+t623+t624-t625-t626+t1818-t1819+t2199
--t2200;
-    t2223 = -t755-t756+t757-t758+t759-t760+t237+t238+t239+t240+t241-t242+t1822-
-t1823+t2203-t2204;
-    t2226 = t474+t482-t484+t486+t488+t490-t491-t492+t1818-t1819+t2199-t2200;
-    t2229 = t599+t614-t616+t618+t620+t622+t623+t624-t625-t626+t1818-t1819+t2199
--t2200;
-    t2232 = -t630+t631-t632-t633+t1818-t1819+t2199-t2200;
-    t2235 = t361+t373-t375+t377+t379+t381-t382-t383+t1822-t1823+t2203-t2204;
-    t2238 = t396+t400+t402-t404+t406-t408-t409-t410+t1818-t1819+t2199-t2200;
-    t2241 = t795+t796+t797-t798+t799+t800-t625-t626+t1818-t1819+t2199-t2200;
-    t2244 = t746+t747-t748+t749+t750-t751-t625-t626+t1818-t1819+t2199-t2200;
-    t2247 = -0.8229664675E-1*A[45]*t2214-0.3371437079E-1*A[45]*t2217+
-0.7795827887E-2*A[44]*t2220-0.2872669523E-1*A[45]*t2223+0.1232237092E-1*A[44]*
-t2226+0.2959933166E-1*A[44]*t2229+0.2122202187*A[44]*t2232-0.1232237092E-1*A
-[45]*t2235+0.9857689952E-1*A[44]*t2238+0.1232237092E-1*A[44]*t2241+
-0.2515757084E-1*A[44]*t2244;
-    t2248 = t443+t444+t445-t446+t447-t448-t382-t383+t1822-t1823+t2203-t2204;
-    t2251 = -t1592+t1593-t1594-t1595+t1818-t1819+t2199-t2200;
-    t2254 = -t1599+t1600-t1601-t1602+t1822-t1823+t2203-t2204;
-    t2257 = t1939-t1940+t1941+t1942-t1943+t1944+t2199-t2200;
-    t2260 = t1948-t1949+t1950+t1951-t1952+t1953+t2203-t2204;
-    t2269 = 0.5383E-1*t56-0.5383E-1*t58+0.471E-2*t61+0.471E-2*t62-0.21E-2*t79+
-0.21E-2*t80;
-    t2278 = 0.5383E-1*t12-0.5383E-1*t15+0.471E-2*t20+0.471E-2*t21-0.21E-2*t37+
-0.21E-2*t38;
-    t2281 = t644+t645+t646-t647+t648-t649+t168+t169+t170-t171+t1818-t1819+t2199
--t2200;
-    t2284 = -t828-t829-t830+t831-t832-t833+t1818-t1819+t2199-t2200;
-    t2287 = -t697-t698+t699-t700-t701-t702+t1822-t1823+t2203-t2204;
-    t2290 = t660+t671-t673+t675-t677-t679+t680+t681-t682-t683+t1822-t1823+t2203
--t2204;
-    t2293 = -t543-t544+t545-t546-t547-t548+t1822-t1823+t2203-t2204;
-    t2296 = -0.2515757084E-1*A[45]*t2248+0.2797813032E-1*A[44]*t2251
--0.2797813032E-1*A[45]*t2254+0.8229664675E-1*A[44]*t2257-0.8229664675E-1*A[45]*
-t2260+0.6142781518E-1*A[44]*t2269-0.6142781518E-1*A[45]*t2278+0.6142781518E-1*A
-[44]*t2281+0.1232237092E-1*A[44]*t2284-0.1444192625E-1*A[45]*t2287
--0.7795827887E-2*A[45]*t2290-0.1444192625E-1*A[45]*t2293;
-    t2298 = t837+t838-t839+t840-t841-t842+t170-t171+t1818-t1819+t2199-t2200;
-    t2301 = t452+t453+t454-t455+t456-t457+t239+t240+t241-t242+t1822-t1823+t2203
--t2204;
-    t2304 = t864+t865+t866-t867-t868-t869+t570+t571-t491-t492+t1818-t1819+t2199
--t2200;
-    t2307 = -t414-t415+t416-t417+t418+t419+t170-t171+t1818-t1819+t2199-t2200;
-    t2310 = -t846-t847+t848-t849+t850-t851+t166+t167+t168+t169+t170-t171+t1818-
-t1819+t2199-t2200;
-    t2313 = t554+t561+t563-t565+t567+t569+t570+t571-t491-t492+t1818-t1819+t2199
--t2200;
-    t2316 = -t786-t787+t788-t789+t790+t791+t241-t242+t1822-t1823+t2203-t2204;
-    t2319 = -t855-t856+t857-t858-t859-t860+t1818-t1819+t2199-t2200;
-    t2322 = -t1341-t1342-t1343-t1344+t1345-t1346+t1822-t1823+t2203-t2204;
-    t2325 = t687+t688+t689-t690+t691+t692-t682-t683+t1822-t1823+t2203-t2204;
-    t2328 = -t637+t638-t639-t640+t1822-t1823+t2203-t2204;
-    t2331 = 0.2797813032E-1*A[44]*t2298-0.6142781518E-1*A[45]*t2301+
-0.7795827887E-2*A[44]*t2304+0.1497956955E-1*A[44]*t2307+0.2872669523E-1*A[44]*
-t2310+0.2959933166E-1*A[44]*t2313-0.1497956955E-1*A[45]*t2316+0.1444192625E-1*A
-[44]*t2319-0.1497956955E-1*A[45]*t2322-0.1232237092E-1*A[45]*t2325-0.2122202187
-*A[45]*t2328;
-    t2332 = t873+t874+t875-t876-t877-t878+t529+t530-t382-t383+t1822-t1823+t2203
--t2204;
-    t2335 = -t764-t765+t766-t767-t768-t769+t1818-t1819+t2199-t2200;
-    t2338 = t427+t429+t431-t433+t435-t437-t438-t439+t1822-t1823+t2203-t2204;
-    t2341 = t461+t462-t463+t464-t465-t466+t241-t242+t1822-t1823+t2203-t2204;
-    t2344 = t728+t729+t730-t731+t732-t733-t491-t492+t1818-t1819+t2199-t2200;
-    t2347 = t509+t520+t522-t524+t526+t528+t529+t530-t382-t383+t1822-t1823+t2203
--t2204;
-    t2350 = -t496-t497-t498+t499-t500-t501+t1822-t1823+t2203-t2204;
-    t2353 = -t1332-t1333-t1334-t1335+t1336-t1337+t1818-t1819+t2199-t2200;
-    t2356 = t773+t774+t776-t778+t780-t782+t166+t167+t168+t169+t170-t171+t1818-
-t1819+t2199-t2200;
-    t2359 = t737+t738-t739+t740+t741-t742-t682-t683+t1822-t1823+t2203-t2204;
-    t2362 = t815+t818-t820+t822+t823+t824+t680+t681-t682-t683+t1822-t1823+t2203
--t2204;
-    t2365 = t804+t805+t806-t807+t808-t809+t170-t171+t1818-t1819+t2199-t2200;
-    t2368 = -0.7795827887E-2*A[45]*t2332+0.1444192625E-1*A[44]*t2335
--0.9857689952E-1*A[45]*t2338-0.2797813032E-1*A[45]*t2341+0.2515757084E-1*A[44]*
-t2344-0.2959933166E-1*A[45]*t2347-0.1232237092E-1*A[45]*t2350+0.1497956955E-1*A
-[44]*t2353+0.3371437079E-1*A[44]*t2356-0.2515757084E-1*A[45]*t2359
--0.2959933166E-1*A[45]*t2362+0.8229664675E-1*A[44]*t2365;
-    A[46] = t2247+t2296+t2331+t2368;
-    t2370 = t1147+t1148-t1149+t1150+t1151-t1152-t947-t948+t1826-t1827+t2207-
-t2208;
-    t2373 = -t963+t964-t965-t966+t1826-t1827+t2207-t2208;
-    t2380 = t1072+t1073+t1074-t1075-t1076-t1077+t1067+t1068-t907-t908+t1826-
-t1827+t2207-t2208;
-    t2387 = t890+t898-t900+t902+t904+t906-t907-t908+t1826-t1827+t2207-t2208;
-    t2392 = -t986-t988-t990+t992-t993-t994+t1826-t1827+t2207-t2208;
-    t2397 = 0.2515757084E-1*A[45]*t2370+0.2122202187*A[45]*t2373-0.2122202187*A
-[43]*t2232-0.1444192625E-1*A[43]*t2319+0.7795827887E-2*A[45]*t2380
--0.2797813032E-1*A[43]*t2298-0.6142781518E-1*A[43]*t2281+0.1232237092E-1*A[45]*
-t2387-0.7795827887E-2*A[43]*t2304+0.1232237092E-1*A[45]*t2392-0.1232237092E-1*A
-[43]*t2284;
-    t2398 = -t1391-t1392-t1393-t1394+t1395-t1396+t1826-t1827+t2207-t2208;
-    t2403 = -t998-t999+t1001-t1003+t1004-t1005+t339+t340+t341+t342+t343-t344+
-t1826-t1827+t2207-t2208;
-    t2406 = -t1129-t1130+t1131-t1132-t1133-t1134+t1826-t1827+t2207-t2208;
-    t2409 = -t1138-t1139+t1140-t1141-t1142-t1143+t1826-t1827+t2207-t2208;
-    t2414 = t1101+t1102-t1103+t1104-t1105-t1106+t945+t946-t947-t948+t1826-t1827
-+t2207-t2208;
-    t2417 = -t952-t953+t954-t955+t956+t957+t343-t344+t1826-t1827+t2207-t2208;
-    t2426 = t1156+t1157+t1158-t1159+t1160-t1161+t343-t344+t1826-t1827+t2207-
-t2208;
-    t2429 = 0.1497956955E-1*A[45]*t2398-0.1497956955E-1*A[43]*t2353+
-0.2872669523E-1*A[45]*t2403+0.1444192625E-1*A[45]*t2406+0.1444192625E-1*A[45]*
-t2409-0.2515757084E-1*A[43]*t2344+0.7795827887E-2*A[45]*t2414+0.1497956955E-1*A
-[45]*t2417-0.2959933166E-1*A[43]*t2313-0.7795827887E-2*A[43]*t2220
--0.8229664675E-1*A[43]*t2365+0.8229664675E-1*A[45]*t2426;
-    t2433 = t1024+t1025-t1026+t1027-t1028-t1029+t343-t344+t1826-t1827+t2207-
-t2208;
-    t2440 = t1051+t1058+t1060-t1062+t1064+t1066+t1067+t1068-t907-t908+t1826-
-t1827+t2207-t2208;
-    t2445 = -t1694+t1695-t1696-t1697+t1826-t1827+t2207-t2208;
-    t2450 = t2079-t2080+t2081+t2082-t2083+t2084+t2207-t2208;
-    t2461 = 0.5383E-1*t250-0.5383E-1*t252+0.471E-2*t255+0.471E-2*t256-0.21E-2*
-t271+0.21E-2*t272;
-    t2464 = -0.2872669523E-1*A[43]*t2310+0.2797813032E-1*A[45]*t2433
--0.1444192625E-1*A[43]*t2335-0.1497956955E-1*A[43]*t2307+0.2959933166E-1*A[45]*
-t2440-0.9857689952E-1*A[43]*t2238+0.2797813032E-1*A[45]*t2445-0.2797813032E-1*A
-[43]*t2251+0.8229664675E-1*A[45]*t2450-0.8229664675E-1*A[43]*t2257+
-0.6142781518E-1*A[45]*t2461;
-    t2471 = t1015+t1016+t1017-t1018+t1019+t1020-t947-t948+t1826-t1827+t2207-
-t2208;
-    t2476 = t1083+t1085+t1087-t1089+t1090-t1091-t1092-t1093+t1826-t1827+t2207-
-t2208;
-    t2479 = t1118+t1119+t1121-t1123+t1124-t1125+t339+t340+t341+t342+t343-t344+
-t1826-t1827+t2207-t2208;
-    t2486 = t1035+t1036+t1037-t1038+t1039-t1040+t341+t342+t343-t344+t1826-t1827
-+t2207-t2208;
-    t2489 = t972+t973+t974-t975+t976-t977-t907-t908+t1826-t1827+t2207-t2208;
-    t2492 = t925+t936-t938+t940+t942+t944+t945+t946-t947-t948+t1826-t1827+t2207
--t2208;
-    t2495 = -0.6142781518E-1*A[43]*t2269-0.1232237092E-1*A[43]*t2241
--0.2515757084E-1*A[43]*t2244+0.1232237092E-1*A[45]*t2471-0.3371437079E-1*A[43]*
-t2356+0.9857689952E-1*A[45]*t2476+0.3371437079E-1*A[45]*t2479-0.1232237092E-1*A
-[43]*t2226-0.2959933166E-1*A[43]*t2229+0.6142781518E-1*A[45]*t2486+
-0.2515757084E-1*A[45]*t2489+0.2959933166E-1*A[45]*t2492;
-    A[47] = t2397+t2429+t2464+t2495;
-    t2519 = 0.8229664675E-1*A[43]*t2214-0.1232237092E-1*A[44]*t2471+
-0.9857689952E-1*A[43]*t2338+0.7795827887E-2*A[43]*t2332-0.9857689952E-1*A[44]*
-t2476+0.2797813032E-1*A[43]*t2254-0.2797813032E-1*A[44]*t2445+0.8229664675E-1*A
-[43]*t2260-0.8229664675E-1*A[44]*t2450+0.6142781518E-1*A[43]*t2278
--0.6142781518E-1*A[44]*t2461;
-    t2544 = -0.2515757084E-1*A[44]*t2370+0.1497956955E-1*A[43]*t2316
--0.1497956955E-1*A[44]*t2417+0.1232237092E-1*A[43]*t2350-0.7795827887E-2*A[44]*
-t2380+0.2515757084E-1*A[43]*t2359+0.1444192625E-1*A[43]*t2287-0.2872669523E-1*A
-[44]*t2403-0.2797813032E-1*A[44]*t2433+0.2797813032E-1*A[43]*t2341+
-0.3371437079E-1*A[43]*t2217-0.6142781518E-1*A[44]*t2486;
-    t2568 = -0.1444192625E-1*A[44]*t2406-0.1232237092E-1*A[44]*t2387+
-0.2959933166E-1*A[43]*t2347-0.1232237092E-1*A[44]*t2392+0.1497956955E-1*A[43]*
-t2322+0.1232237092E-1*A[43]*t2235+0.7795827887E-2*A[43]*t2290-0.2515757084E-1*A
-[44]*t2489+0.2515757084E-1*A[43]*t2248-0.3371437079E-1*A[44]*t2479
--0.1444192625E-1*A[44]*t2409;
-    t2593 = -0.8229664675E-1*A[44]*t2426+0.2122202187*A[43]*t2328-0.2122202187*
-A[44]*t2373+0.1444192625E-1*A[43]*t2293-0.2959933166E-1*A[44]*t2492+
-0.2959933166E-1*A[43]*t2362+0.1232237092E-1*A[43]*t2325-0.2959933166E-1*A[44]*
-t2440+0.2872669523E-1*A[43]*t2223-0.7795827887E-2*A[44]*t2414-0.1497956955E-1*A
-[44]*t2398+0.6142781518E-1*A[43]*t2301;
-    A[48] = t2519+t2544+t2568+t2593;
-    A[49] = 0.0;
-    A[50] = -t13*t2201+t57*t2205;
-    A[51] = -t57*t2209+t251*t2201;
-    A[52] = -t251*t2205+t13*t2209;
-    A[53] = -t251;
-    A[54] = -t13;
-    A[55] = -t57;
-    t2625 = -0.7795827887E-2*t13*t2304-0.1444192625E-1*t13*t2319+0.2122202187*
-t57*t2328-0.2797813032E-1*t13*t2298-0.2872669523E-1*t13*t2310+0.6142781518E-1*
-t57*t2301-0.1444192625E-1*t13*t2335-0.2122202187*t13*t2232-0.1232237092E-1*t13*
-t2284-0.1232237092E-1*t13*t2226-0.2515757084E-1*t13*t2344+0.1497956955E-1*t57*
-t2316;
-    t2649 = 0.638E-2*t52+0.638E-2*t54+0.142E-2*t57-0.28E-3*t79+0.28E-3*t80;
-    t2657 = 0.638E-2*t5+0.638E-2*t8+0.142E-2*t13-0.28E-3*t37+0.28E-3*t38;
-    t2662 = 0.1444192625E-1*t57*t2287-0.1497956955E-1*t13*t2307-0.7795827887E-2
-*t13*t2220-0.2959933166E-1*t13*t2229+0.2515757084E-1*t57*t2248+0.7795827887E-2*
-t57*t2332+0.1497956955E-1*t57*t2322+0.2959933166E-1*t57*t2362-0.8229664675E-1*
-t13*t2365-0.2872669523E-1*t13*t2649+0.2872669523E-1*t57*t2657+0.1232237092E-1*
-t57*t2325;
-    t2688 = -0.2515757084E-1*t13*t2244+0.9857689952E-1*t57*t2338
--0.2797813032E-1*t13*t2251+0.2797813032E-1*t57*t2254-0.8229664675E-1*t13*t2257+
-0.8229664675E-1*t57*t2260-0.6142781518E-1*t13*t2269+0.6142781518E-1*t57*t2278+
-0.7795827887E-2*t57*t2290+0.1232237092E-1*t57*t2350-0.1497956955E-1*t13*t2353+
-0.2797813032E-1*t57*t2341;
-    t2713 = 0.2959933166E-1*t57*t2347+0.2515757084E-1*t57*t2359-0.3371437079E-1
-*t13*t2356+0.1444192625E-1*t57*t2293+0.3371437079E-1*t57*t2217+0.8229664675E-1*
-t57*t2214-0.2959933166E-1*t13*t2313+0.2872669523E-1*t57*t2223-0.9857689952E-1*
-t13*t2238-0.1232237092E-1*t13*t2241-0.6142781518E-1*t13*t2281+0.1232237092E-1*
-t57*t2235;
-    A[56] = t2625+t2662+t2688+t2713;
-    t2724 = 0.638E-2*t246+0.638E-2*t248+0.142E-2*t251-0.28E-3*t271+0.28E-3*t272
-;
-    t2745 = -0.6142781518E-1*t57*t2461+0.6142781518E-1*t251*t2269
--0.2872669523E-1*t57*t2724+0.2872669523E-1*t251*t2649-0.2959933166E-1*t57*t2440
-+0.7795827887E-2*t251*t2304-0.1497956955E-1*t57*t2398+0.1497956955E-1*t251*
-t2353-0.7795827887E-2*t57*t2380-0.1444192625E-1*t57*t2406-0.2515757084E-1*t57*
-t2370-0.3371437079E-1*t57*t2479;
-    t2770 = 0.9857689952E-1*t251*t2238-0.2797813032E-1*t57*t2445+
-0.2797813032E-1*t251*t2251-0.8229664675E-1*t57*t2450+0.8229664675E-1*t251*t2257
--0.2122202187*t57*t2373+0.1232237092E-1*t251*t2284-0.1497956955E-1*t57*t2417
--0.8229664675E-1*t57*t2426-0.1444192625E-1*t57*t2409+0.1497956955E-1*t251*t2307
-+0.8229664675E-1*t251*t2365;
-    t2796 = 0.1444192625E-1*t251*t2319+0.1444192625E-1*t251*t2335
--0.1232237092E-1*t57*t2471-0.2515757084E-1*t57*t2489-0.1232237092E-1*t57*t2387+
-0.2797813032E-1*t251*t2298+0.2515757084E-1*t251*t2344-0.2959933166E-1*t57*t2492
-+0.2959933166E-1*t251*t2229-0.1232237092E-1*t57*t2392-0.2797813032E-1*t57*t2433
-+0.3371437079E-1*t251*t2356;
-    t2821 = 0.2515757084E-1*t251*t2244+0.1232237092E-1*t251*t2241
--0.7795827887E-2*t57*t2414-0.6142781518E-1*t57*t2486-0.2872669523E-1*t57*t2403+
-0.7795827887E-2*t251*t2220+0.1232237092E-1*t251*t2226+0.2122202187*t251*t2232+
-0.6142781518E-1*t251*t2281+0.2959933166E-1*t251*t2313-0.9857689952E-1*t57*t2476
-+0.2872669523E-1*t251*t2310;
-    A[57] = t2745+t2770+t2796+t2821;
-    t2847 = -0.1444192625E-1*t251*t2293-0.1232237092E-1*t251*t2350+
-0.7795827887E-2*t13*t2414-0.2515757084E-1*t251*t2359+0.3371437079E-1*t13*t2479
--0.2959933166E-1*t251*t2347-0.2872669523E-1*t251*t2223-0.9857689952E-1*t251*
-t2338+0.9857689952E-1*t13*t2476-0.2797813032E-1*t251*t2254+0.2797813032E-1*t13*
-t2445-0.8229664675E-1*t251*t2260;
-    t2872 = 0.8229664675E-1*t13*t2450-0.6142781518E-1*t251*t2278
--0.1444192625E-1*t251*t2287+0.1232237092E-1*t13*t2387-0.2515757084E-1*t251*
-t2248-0.2959933166E-1*t251*t2362-0.1232237092E-1*t251*t2325+0.2515757084E-1*t13
-*t2370+0.2959933166E-1*t13*t2440-0.1232237092E-1*t251*t2235-0.7795827887E-2*
-t251*t2290+0.2872669523E-1*t13*t2403;
-    t2898 = 0.1232237092E-1*t13*t2392-0.8229664675E-1*t251*t2214+0.2122202187*
-t13*t2373+0.6142781518E-1*t13*t2486-0.3371437079E-1*t251*t2217+0.6142781518E-1*
-t13*t2461-0.2872669523E-1*t251*t2657+0.2872669523E-1*t13*t2724+0.2515757084E-1*
-t13*t2489+0.2959933166E-1*t13*t2492+0.8229664675E-1*t13*t2426+0.1444192625E-1*
-t13*t2406;
-    t2923 = 0.2797813032E-1*t13*t2433-0.2797813032E-1*t251*t2341
--0.1497956955E-1*t251*t2322+0.1497956955E-1*t13*t2398-0.6142781518E-1*t251*
-t2301-0.1497956955E-1*t251*t2316+0.7795827887E-2*t13*t2380+0.1497956955E-1*t13*
-t2417+0.1444192625E-1*t13*t2409-0.7795827887E-2*t251*t2332-0.2122202187*t251*
-t2328+0.1232237092E-1*t13*t2471;
-    A[58] = t2847+t2872+t2898+t2923;
-    A[59] = 0.0;
-    t2925 = -t194;
-    t2926 = t160+t165+t166+t167+t168+t169;
-    t2928 = -t105;
-    t2929 = t232+t236+t237+t238+t239+t240;
-    A[60] = t2925*t2926-t2928*t2929;
-    t2931 = t334+t338+t339+t340+t341+t342;
-    t2933 = -t296;
-    A[61] = t2928*t2931-t2933*t2926;
-    A[62] = t2933*t2929-t2925*t2931;
-    A[63] = t2933;
-    A[64] = t2925;
-    A[65] = t2928;
-    t2937 = -t414-t415+t416-t417+t418+t419;
-    t2940 = -t786-t787+t788-t789+t790+t791;
-    t2943 = t837+t838-t839+t840-t841-t842;
-    t2946 = t461+t462-t463+t464-t465-t466;
-    t2949 = t804+t805+t806-t807+t808-t809;
-    t2952 = t534+t535+t536-t537+t538-t539;
-    t2955 = t644+t645+t646-t647+t648-t649+t168+t169;
-    t2958 = t452+t453+t454-t455+t456-t457+t239+t240;
-    t2961 = t850-t851+t169+t167-t847-t849+t848+t168+t166-t846;
-    t2964 = t759-t760+t240+t238-t756-t758+t757+t239+t237-t755;
-    t2967 = t169+t167-t782+t780+t168+t166+t774-t778+t776+t773;
-    t2970 = t240+t238-t724+t722+t239+t237+t716-t720+t718+t715;
-    A[66] = 0.1497956955E-1*A[64]*t2937-0.1497956955E-1*A[65]*t2940+
-0.2797813032E-1*A[64]*t2943-0.2797813032E-1*A[65]*t2946+0.8229664675E-1*A[64]*
-t2949-0.8229664675E-1*A[65]*t2952+0.6142781518E-1*A[64]*t2955-0.6142781518E-1*A
-[65]*t2958+0.2872669523E-1*A[64]*t2961-0.2872669523E-1*A[65]*t2964+
-0.3371437079E-1*A[64]*t2967-0.3371437079E-1*A[65]*t2970;
-    t2973 = -t952-t953+t954-t955+t956+t957;
-    t2978 = t1024+t1025-t1026+t1027-t1028-t1029;
-    t2983 = t1156+t1157+t1158-t1159+t1160-t1161;
-    t2988 = t1035+t1036+t1037-t1038+t1039-t1040+t341+t342;
-    t2993 = t1004-t1005+t341+t342+t339+t340-t998-t999-t1003+t1001;
-    t2998 = t341+t342+t339+t340-t1125+t1124+t1118+t1119-t1123+t1121;
-    A[67] = 0.1497956955E-1*A[65]*t2973-0.1497956955E-1*A[63]*t2937+
-0.2797813032E-1*A[65]*t2978-0.2797813032E-1*A[63]*t2943+0.8229664675E-1*A[65]*
-t2983-0.8229664675E-1*A[63]*t2949+0.6142781518E-1*A[65]*t2988-0.6142781518E-1*A
-[63]*t2955+0.2872669523E-1*A[65]*t2993-0.2872669523E-1*A[63]*t2961+
-0.3371437079E-1*A[65]*t2998-0.3371437079E-1*A[63]*t2967;
-    A[68] = 0.1497956955E-1*A[63]*t2940-0.1497956955E-1*A[64]*t2973+
-0.2797813032E-1*A[63]*t2946-0.2797813032E-1*A[64]*t2978+0.8229664675E-1*A[63]*
-t2952-0.8229664675E-1*A[64]*t2983+0.6142781518E-1*A[63]*t2958-0.6142781518E-1*A
-[64]*t2988+0.2872669523E-1*A[63]*t2964-0.2872669523E-1*A[64]*t2993+
-0.3371437079E-1*A[63]*t2970-0.3371437079E-1*A[64]*t2998;
-    A[69] = -1.0;
-    t3027 = -t216;
-    t3029 = -t135;
-    A[70] = t3027*t2926-t3029*t2929;
-    t3032 = -t318;
-    A[71] = t3029*t2931-t3032*t2926;
-    A[72] = t3032*t2929-t3027*t2931;
-    A[73] = t3032;
-    A[74] = t3027;
-    A[75] = t3029;
-    A[76] = 0.2797813032E-1*A[74]*t2943-0.2797813032E-1*A[75]*t2946+
-0.8229664675E-1*A[74]*t2949-0.8229664675E-1*A[75]*t2952+0.6142781518E-1*A[74]*
-t2955-0.6142781518E-1*A[75]*t2958+0.2872669523E-1*A[74]*t2961-0.2872669523E-1*A
-[75]*t2964+0.3371437079E-1*A[74]*t2967-0.3371437079E-1*A[75]*t2970;
-    A[77] = 0.2797813032E-1*A[75]*t2978-0.2797813032E-1*A[73]*t2943+
-0.8229664675E-1*A[75]*t2983-0.8229664675E-1*A[73]*t2949+0.6142781518E-1*A[75]*
-t2988-0.6142781518E-1*A[73]*t2955+0.2872669523E-1*A[75]*t2993-0.2872669523E-1*A
-[73]*t2961+0.3371437079E-1*A[75]*t2998-0.3371437079E-1*A[73]*t2967;
-    A[78] = 0.2797813032E-1*A[73]*t2946-0.2797813032E-1*A[74]*t2978+
-0.8229664675E-1*A[73]*t2952-0.8229664675E-1*A[74]*t2983+0.6142781518E-1*A[73]*
-t2958-0.6142781518E-1*A[74]*t2988+0.2872669523E-1*A[73]*t2964-0.2872669523E-1*A
-[74]*t2993+0.3371437079E-1*A[73]*t2970-0.3371437079E-1*A[74]*t2998;
-    A[79] = 0.0;
-    A[80] = t234*t2926-t162*t2929;
-    A[81] = t162*t2931-t336*t2926;
-    A[82] = t336*t2929-t234*t2931;
-    A[83] = t336;
-    A[84] = t234;
-    A[85] = t162;
-    A[86] = 0.8229664675E-1*A[84]*t2949-0.8229664675E-1*A[85]*t2952+
-0.6142781518E-1*A[84]*t2955-0.6142781518E-1*A[85]*t2958+0.2872669523E-1*A[84]*
-t2961-0.2872669523E-1*A[85]*t2964+0.3371437079E-1*A[84]*t2967-0.3371437079E-1*A
-[85]*t2970;
-    A[87] = 0.8229664675E-1*A[85]*t2983-0.8229664675E-1*A[83]*t2949+
-0.6142781518E-1*A[85]*t2988-0.6142781518E-1*A[83]*t2955+0.2872669523E-1*A[85]*
-t2993-0.2872669523E-1*A[83]*t2961+0.3371437079E-1*A[85]*t2998-0.3371437079E-1*A
-[83]*t2967;
-    A[88] = 0.8229664675E-1*A[83]*t2952-0.8229664675E-1*A[84]*t2983+
-0.6142781518E-1*A[83]*t2958-0.6142781518E-1*A[84]*t2988+0.2872669523E-1*A[83]*
-t2964-0.2872669523E-1*A[84]*t2993+0.3371437079E-1*A[83]*t2970-0.3371437079E-1*A
-[84]*t2998;
-    A[89] = 0.0;
-    t3150 = t160+t165+t166+t167;
-    t3152 = t232+t236+t237+t238;
-    A[90] = A[84]*t3150-A[85]*t3152;
-    t3154 = t334+t338+t339+t340;
-    A[91] = A[85]*t3154-A[83]*t3150;
-    A[92] = A[83]*t3152-A[84]*t3154;
-    A[93] = A[83];
-    A[94] = A[84];
-    A[95] = A[85];
-    t3159 = t648-t649+t645-t647+t646+t644;
-    t3162 = t456-t457+t453-t455+t454+t452;
-    t3165 = t850-t851+t167-t847-t849+t848+t166-t846;
-    t3168 = t759-t760+t238-t756-t758+t757+t237-t755;
-    t3171 = t167-t782+t780+t166+t774-t778+t776+t773;
-    t3174 = t238-t724+t722+t237+t716-t720+t718+t715;
-    A[96] = 0.6142781518E-1*A[94]*t3159-0.6142781518E-1*A[95]*t3162+
-0.2872669523E-1*A[94]*t3165-0.2872669523E-1*A[95]*t3168+0.3371437079E-1*A[94]*
-t3171-0.3371437079E-1*A[95]*t3174;
-    t3177 = t1039-t1040+t1035+t1036-t1038+t1037;
-    t3182 = t1004-t1005+t339+t340-t998-t999-t1003+t1001;
-    t3187 = t339+t340-t1125+t1124+t1118+t1119-t1123+t1121;
-    A[97] = 0.6142781518E-1*A[95]*t3177-0.6142781518E-1*A[93]*t3159+
-0.2872669523E-1*A[95]*t3182-0.2872669523E-1*A[93]*t3165+0.3371437079E-1*A[95]*
-t3187-0.3371437079E-1*A[93]*t3171;
-    A[98] = 0.6142781518E-1*A[93]*t3162-0.6142781518E-1*A[94]*t3177+
-0.2872669523E-1*A[93]*t3168-0.2872669523E-1*A[94]*t3182+0.3371437079E-1*A[93]*
-t3174-0.3371437079E-1*A[94]*t3187;
-    A[99] = 0.0;
-    t3204 = t160+t165;
-    t3206 = t232+t236;
-    A[100] = A[94]*t3204-A[95]*t3206;
-    t3208 = t334+t338;
-    A[101] = A[95]*t3208-A[93]*t3204;
-    A[102] = A[93]*t3206-A[94]*t3208;
-    A[103] = A[93];
-    A[104] = A[94];
-    A[105] = A[95];
-    t3213 = t850-t851-t847-t849+t848-t846;
-    t3216 = t759-t760-t756-t758+t757-t755;
-    t3219 = -t782+t780+t774-t778+t776+t773;
-    t3222 = -t724+t722+t716-t720+t718+t715;
-    A[106] = 0.2872669523E-1*A[104]*t3213-0.2872669523E-1*A[105]*t3216+
-0.3371437079E-1*A[104]*t3219-0.3371437079E-1*A[105]*t3222;
-    t3225 = t1004-t1005-t998-t999-t1003+t1001;
-    t3230 = -t1125+t1124+t1118+t1119-t1123+t1121;
-    A[107] = 0.2872669523E-1*A[105]*t3225-0.2872669523E-1*A[103]*t3213+
-0.3371437079E-1*A[105]*t3230-0.3371437079E-1*A[103]*t3219;
-    A[108] = 0.2872669523E-1*A[103]*t3216-0.2872669523E-1*A[104]*t3225+
-0.3371437079E-1*A[103]*t3222-0.3371437079E-1*A[104]*t3230;
-    A[109] = 0.0;
-    t3243 = t721-t723;
-    t3245 = t779-t781;
-    A[110] = t3243*t3204-t3245*t3206;
-    t3248 = t1000-t1002;
-    A[111] = t3245*t3208-t3248*t3204;
-    A[112] = t3248*t3206-t3243*t3208;
-    A[113] = t3248;
-    A[114] = t3243;
-    A[115] = t3245;
-    A[116] = 0.3371437079E-1*A[114]*t3219-0.3371437079E-1*A[115]*t3222;
-    A[117] = 0.3371437079E-1*A[115]*t3230-0.3371437079E-1*A[113]*t3219;
-    A[118] = 0.3371437079E-1*A[113]*t3222-0.3371437079E-1*A[114]*t3230;
-    A[119] = 0.0;
-    t3270 = LL[12];
-    A[120] = RL[12]-t334-t338-t339-t340-t341-t342-t343+t344-0.1*t254+0.1*t258
--0.10274*t250+0.10274*t252-0.4511E-1*t245-t3270;
-    t3277 = LL[13];
-    A[121] = RL[13]-t232-t236-t237-t238-t239-t240-t241+t242-0.1*t19+0.1*t24
--0.10274*t12+0.10274*t15-0.4511E-1*t2-t3277;
-    t3284 = LL[14];
-    A[122] = RL[14]-t160-t165-t166-t167-t168-t169-t170+t171-0.1*t60+0.1*t64
--0.10274*t56+0.10274*t58-0.4511E-1*t51-t3284;
-    t3285 = RL[2];
-    t3288 = RL[1];
-    t3291 = RL[6];
-    t3292 = -t717+t719;
-    t3295 = RL[5];
-    t3296 = -t775+t777;
-    t3299 = RL[10];
-    t3300 = -t231-t235;
-    t3303 = RL[9];
-    t3304 = -t159-t164;
-    A[123] = 0.5*t3285*A[114]-0.5*t3288*A[115]+0.5*t3291*t3292-0.5*t3295*t3296+
-0.5*t3299*t3300-0.5*t3303*t3304;
-    t3307 = RL[0];
-    t3312 = RL[4];
-    t3315 = -t1120+t1122;
-    t3318 = RL[8];
-    t3321 = -t333-t337;
-    A[124] = 0.5*t3307*A[115]-0.5*t3285*A[113]+0.5*t3312*t3296-0.5*t3291*t3315+
-0.5*t3318*t3304-0.5*t3299*t3321;
-    A[125] = 0.5*t3288*A[113]-0.5*t3307*A[114]+0.5*t3295*t3315-0.5*t3312*t3292+
-0.5*t3303*t3321-0.5*t3318*t3300;
-    t3349 = -0.8051018213E-4*t924+0.5082624939E-2*t1088-0.2369931678E-4*t933+
-0.1702509553E-4*t915-0.7932620886E-4*t939+0.3696711277E-6*t987-0.8945848979E-4*
-t989-0.1078086072E-3*t322+0.1078086072E-3*t323+0.1832763156E-3*t331+
-0.7932620886E-4*t937-0.2061233404E-3*t294-0.9970896939E-4*t306;
-    t3363 = 0.101865705E-2*t298-0.101865705E-2*t299-0.1607889161E-3*t301+
-0.1607889161E-3*t304-0.1512290733E-3*t308-0.4402844298E-1*t245-0.1112574236E-3*
-t247-0.8799425961E-3*t251-0.2893250095E-3*t328+0.2893250095E-3*t329
--0.8051018213E-4*t935+CoM[0]-0.5082624939E-2*t1086;
-    t3378 = 0.3696711277E-6*t985-0.2606799616E-2*t1065+0.9761137487E-4*t919
--0.9761137487E-4*t920-0.2606799616E-2*t943-0.1112574236E-3*t1120
--0.8051018213E-4*t1057+0.2369931678E-4*t929+0.8799425961E-3*t1002-0.9999999999*
-t3270-0.4677530128E-2*t926+0.2570662873E-4*t916+0.2570662873E-4*t917;
-    t3392 = -0.4677530128E-2*t927+0.8823452451E-4*t309-0.8823452451E-4*t310
--0.7932620886E-4*t1059-0.4677530128E-2*t905-0.2369931678E-4*t1053+
-0.2369931678E-4*t1055+0.1232237092E-6*t899-0.1232237092E-6*t901+0.1512290733E-3
-*t312-0.1681938551E-1*t319+0.5687628827E-3*t316-0.3775495252E-3*t1084;
-    t3408 = 0.1112574236E-3*t1122+0.1702509553E-4*t889-0.9381437244E-4*t885+
-0.9381437244E-4*t887+0.1702509553E-4*t897+0.2570662873E-4*t891+0.7932620886E-4*
-t1061+0.2570662873E-4*t892-0.8503258945E-4*t894+0.8503258945E-4*t895
--0.8051018213E-4*t1050-0.4677530128E-2*t903+0.8945848979E-4*t991;
-    t3422 = 0.1702509553E-4*t922+0.1832763156E-3*t327-0.9419629563E-2*t321
--0.1681938551E-1*t315-0.9970896939E-4*t297+0.5687628827E-3*t260-0.8318061448E-1
-*t254-0.9332037043E-1*t250-0.1832763156E-3*t246-0.1832763156E-3*t248+
-0.9332037043E-1*t252-0.2893250095E-3*t255-0.2893250095E-3*t256;
-    t3437 = 0.8318061448E-1*t258+0.5687628827E-3*t264-0.1078086072E-3*t261
--0.1078086072E-3*t262+0.1607889161E-3*t277+0.9397174694E-4*t270+0.3024581465E-3
-*t271-0.3024581465E-3*t272-0.5737222431E-5*t274+0.1607889161E-3*t280+
-0.1660372087E-1*t284-0.4122466806E-3*t285+0.4122466806E-3*t286;
-    t3452 = 0.6659098766E-1*t288-0.2061233404E-3*t291-0.2606799616E-2*t941
--0.9381437244E-4*t912+0.9381437244E-4*t913-0.1232237092E-6*t930+0.1232237092E-6
-*t931-0.2606799616E-2*t1063-0.1081557015E-2*t333+0.5687628827E-3*t317
--0.9419629563E-2*t325-0.3775495252E-3*t1082-0.1081557015E-2*t337
--0.8799425961E-3*t1000;
-    A[126] = t3349+t3363+t3378+t3392+t3408+t3422+t3437+t3452;
-    t3468 = -0.3775495252E-3*t428-0.3775495252E-3*t426+0.1660372087E-1*t184+
-0.6659098766E-1*t186-0.2061233404E-3*t189-0.2061233404E-3*t192-0.9970896939E-4*
-t204+0.101865705E-2*t196-0.101865705E-2*t197-0.1607889161E-3*t199+
-0.1607889161E-3*t202-0.5082624939E-2*t430-0.2606799616E-2*t525;
-    t3482 = 0.9761137487E-4*t665-0.9761137487E-4*t666-0.2606799616E-2*t670+
-0.8945848979E-4*t436-0.4122466806E-3*t45-0.8318061448E-1*t19-0.9332037043E-1*
-t12-0.1832763156E-3*t5-0.1832763156E-3*t8+0.9332037043E-1*t15-0.2893250095E-3*
-t20-0.2893250095E-3*t21+0.8318061448E-1*t24;
-    t3497 = -0.1078086072E-3*t29-0.1078086072E-3*t30+0.9397174694E-4*t36+
-0.3024581465E-3*t37-0.3024581465E-3*t38-0.5737222431E-5*t40+0.8799425961E-3*
-t723-0.1081557015E-2*t231-0.1512290733E-3*t206+0.8823452451E-4*t207
--0.8823452451E-4*t208-0.8799425961E-3*t721-0.1078086072E-3*t220;
-    t3511 = 0.1078086072E-3*t221-0.2606799616E-2*t659-0.9381437244E-4*t661+
-0.9381437244E-4*t662-0.1232237092E-6*t664+0.1232237092E-6*t668+0.1702509553E-4*
-t360+0.1232237092E-6*t374-0.1232237092E-6*t376-0.8051018213E-4*t519
--0.2893250095E-3*t226+0.2893250095E-3*t227+0.1112574236E-3*t719;
-    t3527 = 0.2369931678E-4*t672-0.8051018213E-4*t817+0.1702509553E-4*t372+
-0.2570662873E-4*t362+0.2570662873E-4*t363-0.8051018213E-4*t814-0.2606799616E-2*
-t527-0.4677530128E-2*t656+0.2570662873E-4*t653+0.2570662873E-4*t654
--0.4677530128E-2*t657+CoM[1]-0.7932620886E-4*t821;
-    t3541 = -0.7932620886E-4*t521-0.4677530128E-2*t380-0.2369931678E-4*t513+
-0.2369931678E-4*t516-0.2369931678E-4*t674-0.1081557015E-2*t235+0.1702509553E-4*
-t676+0.1702509553E-4*t678+0.5082624939E-2*t432+0.1832763156E-3*t229+
-0.7932620886E-4*t523-0.8503258945E-4*t367+0.8503258945E-4*t369;
-    t3556 = -0.8051018213E-4*t508-0.4677530128E-2*t378+0.7932620886E-4*t819+
-0.5687628827E-3*t215-0.9419629563E-2*t223-0.9999999999*t3277+0.3696711277E-6*
-t423+0.3696711277E-6*t424-0.8945848979E-4*t434+0.1832763156E-3*t225
--0.9419629563E-2*t219-0.1681938551E-1*t213-0.9970896939E-4*t195;
-    t3571 = 0.5687628827E-3*t175+0.5687628827E-3*t176+0.1607889161E-3*t179+
-0.1607889161E-3*t180+0.1512290733E-3*t210-0.1681938551E-1*t217+0.5687628827E-3*
-t214-0.9381437244E-4*t353+0.9381437244E-4*t356-0.1112574236E-3*t717
--0.4402844298E-1*t2-0.1112574236E-3*t6-0.8799425961E-3*t13+0.4122466806E-3*t49;
-    A[127] = t3468+t3482+t3497+t3511+t3527+t3541+t3556+t3571;
-    t3587 = -0.3775495252E-3*t399+0.8799425961E-3*t781-0.4402844298E-1*t51
--0.1112574236E-3*t53-0.8799425961E-3*t57-0.1078086072E-3*t142+0.1078086072E-3*
-t143-0.8051018213E-4*t560+0.5082624939E-2*t403+0.1512290733E-3*t127
--0.1681938551E-1*t137+0.5687628827E-3*t133-0.8799425961E-3*t779;
-    t3601 = -0.1112574236E-3*t775+0.1832763156E-3*t155+0.3696711277E-6*t389
--0.2369931678E-4*t610+0.1702509553E-4*t583+0.1232237092E-6*t483-0.1232237092E-6
-*t485-0.2606799616E-2*t566-0.1081557015E-2*t159+0.3696711277E-6*t391
--0.8945848979E-4*t405+0.8945848979E-4*t407-0.9381437244E-4*t470;
-    t3616 = 0.9381437244E-4*t471+0.1702509553E-4*t481+0.2570662873E-4*t475+
-0.2570662873E-4*t476-0.8503258945E-4*t478+0.8503258945E-4*t479+0.1702509553E-4*
-t473+0.6659098766E-1*t97-0.2061233404E-3*t100-0.2061233404E-3*t103
--0.9970896939E-4*t121+0.101865705E-2*t109-0.101865705E-2*t110;
-    t3630 = -0.1607889161E-3*t114+0.1607889161E-3*t118+CoM[2]+0.7932620886E-4*
-t615-0.2606799616E-2*t568-0.8051018213E-4*t553-0.4677530128E-2*t487
--0.4677530128E-2*t489-0.2369931678E-4*t556+0.2369931678E-4*t558-0.1232237092E-6
-*t606+0.1232237092E-6*t607+0.9761137487E-4*t589;
-    t3646 = -0.9761137487E-4*t591+0.7932620886E-4*t564-0.9999999999*t3284+
-0.5687628827E-3*t134-0.9419629563E-2*t146-0.8051018213E-4*t613-0.8051018213E-4*
-t598-0.4677530128E-2*t600+0.2570662873E-4*t584+0.2570662873E-4*t585
--0.4677530128E-2*t601-0.2606799616E-2*t619-0.9381437244E-4*t577;
-    t3660 = 0.9381437244E-4*t579-0.7932620886E-4*t562-0.1512290733E-3*t123+
-0.1112574236E-3*t777-0.2606799616E-2*t621+0.2369931678E-4*t605-0.7932620886E-4*
-t617+0.8823452451E-4*t124-0.8823452451E-4*t125+0.1702509553E-4*t594
--0.1081557015E-2*t164-0.3775495252E-3*t395-0.2893250095E-3*t151;
-    t3675 = 0.2893250095E-3*t152+0.1832763156E-3*t150-0.9419629563E-2*t141
--0.1681938551E-1*t132-0.9970896939E-4*t108+0.5687628827E-3*t66-0.8318061448E-1*
-t60-0.9332037043E-1*t56-0.1832763156E-3*t52-0.1832763156E-3*t54+0.9332037043E-1
-*t58-0.2893250095E-3*t61-0.2893250095E-3*t62;
-    t3690 = 0.8318061448E-1*t64+0.5687628827E-3*t70-0.1078086072E-3*t67
--0.1078086072E-3*t68+0.1607889161E-3*t85+0.9397174694E-4*t78+0.3024581465E-3*
-t79-0.3024581465E-3*t80-0.5737222431E-5*t82+0.1607889161E-3*t88+0.1660372087E-1
-*t93-0.4122466806E-3*t94+0.4122466806E-3*t95-0.5082624939E-2*t401;
-    A[128] = t3587+t3601+t3616+t3630+t3646+t3660+t3675+t3690;
-    A[129] = 0.0;
-    return;
-  }
+#include "from_LLeg_3_body.h"
 }
-
@@ -0,0 +1,1203 @@
+/* Generated using codegen (2012-03-12, 10:11:20) */
+/*
+ * Body of from_LLeg_3_residual(), the IGM_* macros are described in maple_double.h.
+ * Only the statements of from_LLeg_3_body.h, which are needed to compute the
+ * residuals A[120..129], are kept; the residuals are written to A[0..9].
+ */
+  IGM_REAL t100;
+  IGM_REAL t1000;
+  IGM_REAL t1002;
+  IGM_REAL t102;
+  IGM_REAL t103;
+  IGM_REAL t1049;
+  IGM_REAL t105;
+  IGM_REAL t1050;
+  IGM_REAL t1052;
+  IGM_REAL t1053;
+  IGM_REAL t1054;
+  IGM_REAL t1055;
+  IGM_REAL t1056;
+  IGM_REAL t1057;
+  IGM_REAL t1059;
+  IGM_REAL t1061;
+  IGM_REAL t1063;
+  IGM_REAL t1065;
+  IGM_REAL t107;
+  IGM_REAL t108;
+  IGM_REAL t1081;
+  IGM_REAL t1082;
+  IGM_REAL t1084;
+  IGM_REAL t1086;
+  IGM_REAL t1088;
+  IGM_REAL t109;
+  IGM_REAL t11;
+  IGM_REAL t110;
+  IGM_REAL t111;
+  IGM_REAL t1120;
+  IGM_REAL t1122;
+  IGM_REAL t113;
+  IGM_REAL t114;
+  IGM_REAL t116;
+  IGM_REAL t117;
+  IGM_REAL t118;
+  IGM_REAL t119;
+  IGM_REAL t12;
+  IGM_REAL t120;
+  IGM_REAL t121;
+  IGM_REAL t123;
+  IGM_REAL t124;
+  IGM_REAL t125;
+  IGM_REAL t127;
+  IGM_REAL t129;
+  IGM_REAL t13;
+  IGM_REAL t131;
+  IGM_REAL t132;
+  IGM_REAL t133;
+  IGM_REAL t134;
+  IGM_REAL t135;
+  IGM_REAL t136;
+  IGM_REAL t137;
+  IGM_REAL t138;
+  IGM_REAL t14;
+  IGM_REAL t140;
+  IGM_REAL t141;
+  IGM_REAL t142;
+  IGM_REAL t143;
+  IGM_REAL t144;
+  IGM_REAL t145;
+  IGM_REAL t146;
+  IGM_REAL t147;
+  IGM_REAL t149;
+  IGM_REAL t15;
+  IGM_REAL t150;
+  IGM_REAL t151;
+  IGM_REAL t152;
+  IGM_REAL t153;
+  IGM_REAL t154;
+  IGM_REAL t155;
+  IGM_REAL t156;
+  IGM_REAL t158;
+  IGM_REAL t159;
+  IGM_REAL t16;
+  IGM_REAL t160;
+  IGM_REAL t162;
+  IGM_REAL t163;
+  IGM_REAL t164;
+  IGM_REAL t165;
+  IGM_REAL t166;
+  IGM_REAL t167;
+  IGM_REAL t168;
+  IGM_REAL t169;
+  IGM_REAL t170;
+  IGM_REAL t171;
+  IGM_REAL t175;
+  IGM_REAL t176;
+  IGM_REAL t177;
+  IGM_REAL t179;
+  IGM_REAL t18;
+  IGM_REAL t180;
+  IGM_REAL t181;
+  IGM_REAL t184;
+  IGM_REAL t186;
+  IGM_REAL t188;
+  IGM_REAL t189;
+  IGM_REAL t19;
+  IGM_REAL t191;
+  IGM_REAL t192;
+  IGM_REAL t194;
+  IGM_REAL t195;
+  IGM_REAL t196;
+  IGM_REAL t197;
+  IGM_REAL t198;
+  IGM_REAL t199;
+  IGM_REAL t2;
+  IGM_REAL t20;
+  IGM_REAL t201;
+  IGM_REAL t202;
+  IGM_REAL t203;
+  IGM_REAL t204;
+  IGM_REAL t206;
+  IGM_REAL t207;
+  IGM_REAL t208;
+  IGM_REAL t21;
+  IGM_REAL t210;
+  IGM_REAL t212;
+  IGM_REAL t213;
+  IGM_REAL t214;
+  IGM_REAL t215;
+  IGM_REAL t216;
+  IGM_REAL t217;
+  IGM_REAL t218;
+  IGM_REAL t219;
+  IGM_REAL t22;
+  IGM_REAL t220;
+  IGM_REAL t221;
+  IGM_REAL t222;
+  IGM_REAL t223;
+  IGM_REAL t224;
+  IGM_REAL t225;
+  IGM_REAL t226;
+  IGM_REAL t227;
+  IGM_REAL t228;
+  IGM_REAL t229;
+  IGM_REAL t23;
+  IGM_REAL t230;
+  IGM_REAL t231;
+  IGM_REAL t232;
+  IGM_REAL t234;
+  IGM_REAL t235;
+  IGM_REAL t236;
+  IGM_REAL t237;
+  IGM_REAL t238;
+  IGM_REAL t239;
+  IGM_REAL t24;
+  IGM_REAL t240;
+  IGM_REAL t241;
+  IGM_REAL t242;
+  IGM_REAL t245;
+  IGM_REAL t246;
+  IGM_REAL t247;
+  IGM_REAL t248;
+  IGM_REAL t249;
+  IGM_REAL t25;
+  IGM_REAL t250;
+  IGM_REAL t251;
+  IGM_REAL t252;
+  IGM_REAL t253;
+  IGM_REAL t254;
+  IGM_REAL t255;
+  IGM_REAL t256;
+  IGM_REAL t257;
+  IGM_REAL t258;
+  IGM_REAL t259;
+  IGM_REAL t260;
+  IGM_REAL t261;
+  IGM_REAL t262;
+  IGM_REAL t263;
+  IGM_REAL t264;
+  IGM_REAL t265;
+  IGM_REAL t27;
+  IGM_REAL t270;
+  IGM_REAL t271;
+  IGM_REAL t272;
+  IGM_REAL t273;
+  IGM_REAL t274;
+  IGM_REAL t276;
+  IGM_REAL t277;
+  IGM_REAL t279;
+  IGM_REAL t280;
+  IGM_REAL t281;
+  IGM_REAL t284;
+  IGM_REAL t285;
+  IGM_REAL t286;
+  IGM_REAL t287;
+  IGM_REAL t288;
+  IGM_REAL t29;
+  IGM_REAL t290;
+  IGM_REAL t291;
+  IGM_REAL t293;
+  IGM_REAL t294;
+  IGM_REAL t296;
+  IGM_REAL t297;
+  IGM_REAL t298;
+  IGM_REAL t299;
+  IGM_REAL t30;
+  IGM_REAL t300;
+  IGM_REAL t301;
+  IGM_REAL t303;
+  IGM_REAL t304;
+  IGM_REAL t305;
+  IGM_REAL t306;
+  IGM_REAL t308;
+  IGM_REAL t309;
+  IGM_REAL t31;
+  IGM_REAL t310;
+  IGM_REAL t312;
+  IGM_REAL t314;
+  IGM_REAL t315;
+  IGM_REAL t316;
+  IGM_REAL t317;
+  IGM_REAL t318;
+  IGM_REAL t319;
+  IGM_REAL t32;
+  IGM_REAL t320;
+  IGM_REAL t321;
+  IGM_REAL t322;
+  IGM_REAL t323;
+  IGM_REAL t324;
+  IGM_REAL t3243;
+  IGM_REAL t3245;
+  IGM_REAL t3248;
+  IGM_REAL t325;
+  IGM_REAL t326;
+  IGM_REAL t327;
+  IGM_REAL t3270;
+  IGM_REAL t3277;
+  IGM_REAL t328;
+  IGM_REAL t3284;
+  IGM_REAL t3285;
+  IGM_REAL t3288;
+  IGM_REAL t329;
+  IGM_REAL t3291;
+  IGM_REAL t3292;
+  IGM_REAL t3295;
+  IGM_REAL t3296;
+  IGM_REAL t3299;
+  IGM_REAL t330;
+  IGM_REAL t3300;
+  IGM_REAL t3303;
+  IGM_REAL t3304;
+  IGM_REAL t3307;
+  IGM_REAL t331;
+  IGM_REAL t3312;
+  IGM_REAL t3315;
+  IGM_REAL t3318;
+  IGM_REAL t332;
+  IGM_REAL t3321;
+  IGM_REAL t333;
+  IGM_REAL t334;
+  IGM_REAL t3349;
+  IGM_REAL t336;
+  IGM_REAL t3363;
+  IGM_REAL t337;
+  IGM_REAL t3378;
+  IGM_REAL t338;
+  IGM_REAL t339;
+  IGM_REAL t3392;
+  IGM_REAL t340;
+  IGM_REAL t3408;
+  IGM_REAL t341;
+  IGM_REAL t342;
+  IGM_REAL t3422;
+  IGM_REAL t343;
+  IGM_REAL t3437;
+  IGM_REAL t344;
+  IGM_REAL t3452;
+  IGM_REAL t3468;
+  IGM_REAL t3482;
+  IGM_REAL t3497;
+  IGM_REAL t35;
+  IGM_REAL t3511;
+  IGM_REAL t352;
+  IGM_REAL t3527;
+  IGM_REAL t353;
+  IGM_REAL t354;
+  IGM_REAL t3541;
+  IGM_REAL t355;
+  IGM_REAL t3556;
+  IGM_REAL t356;
+  IGM_REAL t357;
+  IGM_REAL t3571;
+  IGM_REAL t3587;
+  IGM_REAL t359;
+  IGM_REAL t36;
+  IGM_REAL t360;
+  IGM_REAL t3601;
+  IGM_REAL t3616;
+  IGM_REAL t362;
+  IGM_REAL t363;
+  IGM_REAL t3630;
+  IGM_REAL t364;
+  IGM_REAL t3646;
+  IGM_REAL t366;
+  IGM_REAL t3660;
+  IGM_REAL t367;
+  IGM_REAL t3675;
+  IGM_REAL t368;
+  IGM_REAL t369;
+  IGM_REAL t3690;
+  IGM_REAL t37;
+  IGM_REAL t370;
+  IGM_REAL t371;
+  IGM_REAL t372;
+  IGM_REAL t374;
+  IGM_REAL t376;
+  IGM_REAL t378;
+  IGM_REAL t38;
+  IGM_REAL t380;
+  IGM_REAL t388;
+  IGM_REAL t389;
+  IGM_REAL t39;
+  IGM_REAL t390;
+  IGM_REAL t391;
+  IGM_REAL t392;
+  IGM_REAL t394;
+  IGM_REAL t395;
+  IGM_REAL t397;
+  IGM_REAL t398;
+  IGM_REAL t399;
+  IGM_REAL t4;
+  IGM_REAL t40;
+  IGM_REAL t401;
+  IGM_REAL t403;
+  IGM_REAL t405;
+  IGM_REAL t407;
+  IGM_REAL t42;
+  IGM_REAL t423;
+  IGM_REAL t424;
+  IGM_REAL t425;
+  IGM_REAL t426;
+  IGM_REAL t428;
+  IGM_REAL t430;
+  IGM_REAL t432;
+  IGM_REAL t434;
+  IGM_REAL t436;
+  IGM_REAL t44;
+  IGM_REAL t45;
+  IGM_REAL t47;
+  IGM_REAL t470;
+  IGM_REAL t471;
+  IGM_REAL t472;
+  IGM_REAL t473;
+  IGM_REAL t475;
+  IGM_REAL t476;
+  IGM_REAL t477;
+  IGM_REAL t478;
+  IGM_REAL t479;
+  IGM_REAL t48;
+  IGM_REAL t480;
+  IGM_REAL t481;
+  IGM_REAL t483;
+  IGM_REAL t485;
+  IGM_REAL t487;
+  IGM_REAL t489;
+  IGM_REAL t49;
+  IGM_REAL t5;
+  IGM_REAL t50;
+  IGM_REAL t505;
+  IGM_REAL t507;
+  IGM_REAL t508;
+  IGM_REAL t51;
+  IGM_REAL t510;
+  IGM_REAL t512;
+  IGM_REAL t513;
+  IGM_REAL t514;
+  IGM_REAL t515;
+  IGM_REAL t516;
+  IGM_REAL t517;
+  IGM_REAL t518;
+  IGM_REAL t519;
+  IGM_REAL t52;
+  IGM_REAL t521;
+  IGM_REAL t523;
+  IGM_REAL t525;
+  IGM_REAL t527;
+  IGM_REAL t53;
+  IGM_REAL t54;
+  IGM_REAL t55;
+  IGM_REAL t552;
+  IGM_REAL t553;
+  IGM_REAL t555;
+  IGM_REAL t556;
+  IGM_REAL t557;
+  IGM_REAL t558;
+  IGM_REAL t559;
+  IGM_REAL t56;
+  IGM_REAL t560;
+  IGM_REAL t562;
+  IGM_REAL t564;
+  IGM_REAL t566;
+  IGM_REAL t568;
+  IGM_REAL t57;
+  IGM_REAL t576;
+  IGM_REAL t577;
+  IGM_REAL t578;
+  IGM_REAL t579;
+  IGM_REAL t58;
+  IGM_REAL t580;
+  IGM_REAL t582;
+  IGM_REAL t583;
+  IGM_REAL t584;
+  IGM_REAL t585;
+  IGM_REAL t586;
+  IGM_REAL t588;
+  IGM_REAL t589;
+  IGM_REAL t59;
+  IGM_REAL t590;
+  IGM_REAL t591;
+  IGM_REAL t592;
+  IGM_REAL t593;
+  IGM_REAL t594;
+  IGM_REAL t595;
+  IGM_REAL t597;
+  IGM_REAL t598;
+  IGM_REAL t6;
+  IGM_REAL t60;
+  IGM_REAL t600;
+  IGM_REAL t601;
+  IGM_REAL t602;
+  IGM_REAL t604;
+  IGM_REAL t605;
+  IGM_REAL t606;
+  IGM_REAL t607;
+  IGM_REAL t608;
+  IGM_REAL t609;
+  IGM_REAL t61;
+  IGM_REAL t610;
+  IGM_REAL t611;
+  IGM_REAL t612;
+  IGM_REAL t613;
+  IGM_REAL t615;
+  IGM_REAL t617;
+  IGM_REAL t619;
+  IGM_REAL t62;
+  IGM_REAL t621;
+  IGM_REAL t63;
+  IGM_REAL t64;
+  IGM_REAL t65;
+  IGM_REAL t653;
+  IGM_REAL t654;
+  IGM_REAL t655;
+  IGM_REAL t656;
+  IGM_REAL t657;
+  IGM_REAL t658;
+  IGM_REAL t659;
+  IGM_REAL t66;
+  IGM_REAL t661;
+  IGM_REAL t662;
+  IGM_REAL t663;
+  IGM_REAL t664;
+  IGM_REAL t665;
+  IGM_REAL t666;
+  IGM_REAL t667;
+  IGM_REAL t668;
+  IGM_REAL t669;
+  IGM_REAL t67;
+  IGM_REAL t670;
+  IGM_REAL t672;
+  IGM_REAL t674;
+  IGM_REAL t676;
+  IGM_REAL t678;
+  IGM_REAL t68;
+  IGM_REAL t69;
+  IGM_REAL t7;
+  IGM_REAL t70;
+  IGM_REAL t71;
+  IGM_REAL t717;
+  IGM_REAL t719;
+  IGM_REAL t721;
+  IGM_REAL t723;
+  IGM_REAL t73;
+  IGM_REAL t775;
+  IGM_REAL t777;
+  IGM_REAL t779;
+  IGM_REAL t78;
+  IGM_REAL t781;
+  IGM_REAL t79;
+  IGM_REAL t8;
+  IGM_REAL t80;
+  IGM_REAL t81;
+  IGM_REAL t813;
+  IGM_REAL t814;
+  IGM_REAL t816;
+  IGM_REAL t817;
+  IGM_REAL t819;
+  IGM_REAL t82;
+  IGM_REAL t821;
+  IGM_REAL t84;
+  IGM_REAL t85;
+  IGM_REAL t87;
+  IGM_REAL t88;
+  IGM_REAL t885;
+  IGM_REAL t886;
+  IGM_REAL t887;
+  IGM_REAL t888;
+  IGM_REAL t889;
+  IGM_REAL t89;
+  IGM_REAL t891;
+  IGM_REAL t892;
+  IGM_REAL t893;
+  IGM_REAL t894;
+  IGM_REAL t895;
+  IGM_REAL t896;
+  IGM_REAL t897;
+  IGM_REAL t899;
+  IGM_REAL t9;
+  IGM_REAL t90;
+  IGM_REAL t901;
+  IGM_REAL t903;
+  IGM_REAL t905;
+  IGM_REAL t912;
+  IGM_REAL t913;
+  IGM_REAL t914;
+  IGM_REAL t915;
+  IGM_REAL t916;
+  IGM_REAL t917;
+  IGM_REAL t918;
+  IGM_REAL t919;
+  IGM_REAL t920;
+  IGM_REAL t921;
+  IGM_REAL t922;
+  IGM_REAL t923;
+  IGM_REAL t924;
+  IGM_REAL t926;
+  IGM_REAL t927;
+  IGM_REAL t928;
+  IGM_REAL t929;
+  IGM_REAL t93;
+  IGM_REAL t930;
+  IGM_REAL t931;
+  IGM_REAL t932;
+  IGM_REAL t933;
+  IGM_REAL t934;
+  IGM_REAL t935;
+  IGM_REAL t937;
+  IGM_REAL t939;
+  IGM_REAL t94;
+  IGM_REAL t941;
+  IGM_REAL t943;
+  IGM_REAL t95;
+  IGM_REAL t96;
+  IGM_REAL t97;
+  IGM_REAL t985;
+  IGM_REAL t987;
+  IGM_REAL t989;
+  IGM_REAL t99;
+  IGM_REAL t991;
+  IGM_REAL tA113;
+  IGM_REAL tA114;
+  IGM_REAL tA115;
+  {
+    t2 = LL[9];
+    t4 = IGM_COS_Q(5);
+    t5 = t2*t4;
+    t6 = LL[5];
+    t7 = IGM_SIN_Q(5);
+    t8 = t6*t7;
+    t9 = t5+t8;
+    t11 = IGM_COS_Q(4);
+    t12 = t9*t11;
+    t13 = LL[1];
+    t14 = IGM_SIN_Q(4);
+    t15 = t13*t14;
+    t16 = t12-t15;
+    t18 = IGM_COS_Q(3);
+    t19 = t16*t18;
+    t20 = t9*t14;
+    t21 = t13*t11;
+    t22 = t20+t21;
+    t23 = IGM_SIN_Q(3);
+    t24 = t22*t23;
+    t25 = t19-t24;
+    t27 = IGM_COS_Q(2);
+    t29 = t16*t23;
+    t30 = t22*t18;
+    t31 = t29+t30;
+    t32 = IGM_SIN_Q(2);
+    t35 = IGM_CONST(sqrt(2.0));
+    t36 = (t25*t27-t31*t32)*t35;
+    t37 = t2*t7;
+    t38 = t6*t4;
+    t39 = -t37+t38;
+    t40 = t39*t35;
+    t42 = t36/2.0-t40/2.0;
+    t44 = IGM_COS_Q(1);
+    t45 = t42*t44;
+    t47 = -t36/2.0-t40/2.0;
+    t48 = IGM_SIN_Q(1);
+    t49 = t47*t48;
+    t50 = t45-t49;
+    t51 = LL[10];
+    t52 = t51*t4;
+    t53 = LL[6];
+    t54 = t53*t7;
+    t55 = t52+t54;
+    t56 = t55*t11;
+    t57 = LL[2];
+    t58 = t57*t14;
+    t59 = t56-t58;
+    t60 = t59*t18;
+    t61 = t55*t14;
+    t62 = t57*t11;
+    t63 = t61+t62;
+    t64 = t63*t23;
+    t65 = t60-t64;
+    t66 = t65*t32;
+    t67 = t59*t23;
+    t68 = t63*t18;
+    t69 = t67+t68;
+    t70 = t69*t27;
+    t71 = t66+t70;
+    t73 = IGM_SIN_Q(0);
+    t78 = (t65*t27-t69*t32)*t35;
+    t79 = t51*t7;
+    t80 = t53*t4;
+    t81 = -t79+t80;
+    t82 = t81*t35;
+    t84 = t78/2.0-t82/2.0;
+    t85 = t84*t48;
+    t87 = -t78/2.0-t82/2.0;
+    t88 = t87*t44;
+    t89 = t85+t88;
+    t90 = IGM_COS_Q(0);
+    t93 = (t71*t73+t89*t90)*t35;
+    t94 = t84*t44;
+    t95 = t87*t48;
+    t96 = -t94+t95;
+    t97 = t96*t35;
+    t99 = -t93/2.0+t97/2.0;
+    t100 = t99*t35;
+    t102 = -t93/2.0-t97/2.0;
+    t103 = t102*t35;
+    t105 = -t100/2.0-t103/2.0;
+    t107 = IGM_COS_Q(7);
+    t108 = t105*t107;
+    t109 = t71*t90;
+    t110 = t89*t73;
+    t111 = t109-t110;
+    t113 = IGM_SIN_Q(6);
+    t114 = t111*t113;
+    t116 = t100/2.0-t103/2.0;
+    t117 = IGM_COS_Q(6);
+    t118 = t116*t117;
+    t119 = -t114+t118;
+    t120 = IGM_SIN_Q(7);
+    t121 = t119*t120;
+    t123 = (t108+t121)*t35;
+    t124 = t105*t120;
+    t125 = t119*t107;
+    t127 = (-t124+t125)*t35;
+    t129 = t123/2.0+t127/2.0;
+    t131 = IGM_COS_Q(8);
+    t132 = t129*t131;
+    t133 = t111*t117;
+    t134 = t116*t113;
+    t135 = -t133-t134;
+    t136 = IGM_SIN_Q(8);
+    t137 = t135*t136;
+    t138 = t132+t137;
+    t140 = IGM_COS_Q(9);
+    t141 = t138*t140;
+    t142 = t129*t136;
+    t143 = t135*t131;
+    t144 = -t142+t143;
+    t145 = IGM_SIN_Q(9);
+    t146 = t144*t145;
+    t147 = t141+t146;
+    t149 = IGM_COS_Q(10);
+    t150 = t147*t149;
+    t151 = t138*t145;
+    t152 = t144*t140;
+    t153 = -t151+t152;
+    t154 = IGM_SIN_Q(10);
+    t155 = t153*t154;
+    t156 = t150+t155;
+    t158 = IGM_COS_Q(11);
+    t159 = t156*t158;
+    t160 = 0.4511E-1*t159;
+    t162 = -t123/2.0+t127/2.0;
+    t163 = IGM_SIN_Q(11);
+    t164 = t162*t163;
+    t165 = 0.4511E-1*t164;
+    t166 = 0.10274*t141;
+    t167 = 0.10274*t146;
+    t168 = 0.1*t132;
+    t169 = 0.1*t137;
+    t170 = 0.5E-1*t93;
+    t171 = 0.5E-1*t97;
+    t175 = t25*t32;
+    t176 = t31*t27;
+    t177 = t175+t176;
+    t179 = t42*t48;
+    t180 = t47*t44;
+    t181 = t179+t180;
+    t184 = (t177*t73+t181*t90)*t35;
+    t186 = -t50*t35;
+    t188 = -t184/2.0+t186/2.0;
+    t189 = t188*t35;
+    t191 = -t184/2.0-t186/2.0;
+    t192 = t191*t35;
+    t194 = -t189/2.0-t192/2.0;
+    t195 = t194*t107;
+    t196 = t177*t90;
+    t197 = t181*t73;
+    t198 = t196-t197;
+    t199 = t198*t113;
+    t201 = t189/2.0-t192/2.0;
+    t202 = t201*t117;
+    t203 = -t199+t202;
+    t204 = t203*t120;
+    t206 = (t195+t204)*t35;
+    t207 = t194*t120;
+    t208 = t203*t107;
+    t210 = (-t207+t208)*t35;
+    t212 = t206/2.0+t210/2.0;
+    t213 = t212*t131;
+    t214 = t198*t117;
+    t215 = t201*t113;
+    t216 = -t214-t215;
+    t217 = t216*t136;
+    t218 = t213+t217;
+    t219 = t218*t140;
+    t220 = t212*t136;
+    t221 = t216*t131;
+    t222 = -t220+t221;
+    t223 = t222*t145;
+    t224 = t219+t223;
+    t225 = t224*t149;
+    t226 = t218*t145;
+    t227 = t222*t140;
+    t228 = -t226+t227;
+    t229 = t228*t154;
+    t230 = t225+t229;
+    t231 = t230*t158;
+    t232 = 0.4511E-1*t231;
+    t234 = -t206/2.0+t210/2.0;
+    t235 = t234*t163;
+    t236 = 0.4511E-1*t235;
+    t237 = 0.10274*t219;
+    t238 = 0.10274*t223;
+    t239 = 0.1*t213;
+    t240 = 0.1*t217;
+    t241 = 0.5E-1*t184;
+    t242 = 0.5E-1*t186;
+    t245 = LL[8];
+    t246 = t245*t4;
+    t247 = LL[4];
+    t248 = t247*t7;
+    t249 = t246+t248;
+    t250 = t249*t11;
+    t251 = LL[0];
+    t252 = t251*t14;
+    t253 = t250-t252;
+    t254 = t253*t18;
+    t255 = t249*t14;
+    t256 = t251*t11;
+    t257 = t255+t256;
+    t258 = t257*t23;
+    t259 = t254-t258;
+    t260 = t259*t32;
+    t261 = t253*t23;
+    t262 = t257*t18;
+    t263 = t261+t262;
+    t264 = t263*t27;
+    t265 = t260+t264;
+    t270 = (t259*t27-t263*t32)*t35;
+    t271 = t245*t7;
+    t272 = t247*t4;
+    t273 = -t271+t272;
+    t274 = t273*t35;
+    t276 = t270/2.0-t274/2.0;
+    t277 = t276*t48;
+    t279 = -t270/2.0-t274/2.0;
+    t280 = t279*t44;
+    t281 = t277+t280;
+    t284 = (t265*t73+t281*t90)*t35;
+    t285 = t276*t44;
+    t286 = t279*t48;
+    t287 = -t285+t286;
+    t288 = t287*t35;
+    t290 = -t284/2.0+t288/2.0;
+    t291 = t290*t35;
+    t293 = -t284/2.0-t288/2.0;
+    t294 = t293*t35;
+    t296 = -t291/2.0-t294/2.0;
+    t297 = t296*t107;
+    t298 = t265*t90;
+    t299 = t281*t73;
+    t300 = t298-t299;
+    t301 = t300*t113;
+    t303 = t291/2.0-t294/2.0;
+    t304 = t303*t117;
+    t305 = -t301+t304;
+    t306 = t305*t120;
+    t308 = (t297+t306)*t35;
+    t309 = t296*t120;
+    t310 = t305*t107;
+    t312 = (-t309+t310)*t35;
+    t314 = t308/2.0+t312/2.0;
+    t315 = t314*t131;
+    t316 = t300*t117;
+    t317 = t303*t113;
+    t318 = -t316-t317;
+    t319 = t318*t136;
+    t320 = t315+t319;
+    t321 = t320*t140;
+    t322 = t314*t136;
+    t323 = t318*t131;
+    t324 = -t322+t323;
+    t325 = t324*t145;
+    t326 = t321+t325;
+    t327 = t326*t149;
+    t328 = t320*t145;
+    t329 = t324*t140;
+    t330 = -t328+t329;
+    t331 = t330*t154;
+    t332 = t327+t331;
+    t333 = t332*t158;
+    t334 = 0.4511E-1*t333;
+    t336 = -t308/2.0+t312/2.0;
+    t337 = t336*t163;
+    t338 = 0.4511E-1*t337;
+    t339 = 0.10274*t321;
+    t340 = 0.10274*t325;
+    t341 = 0.1*t315;
+    t342 = 0.1*t319;
+    t343 = 0.5E-1*t284;
+    t344 = 0.5E-1*t288;
+    t352 = IGM_SIN_Q(17);
+    t353 = t198*t352;
+    t354 = -t191;
+    t355 = IGM_COS_Q(17);
+    t356 = t354*t355;
+    t357 = -t353+t356;
+    t359 = IGM_COS_Q(19);
+    t360 = t357*t359;
+    t362 = t198*t355;
+    t363 = t354*t352;
+    t364 = t362+t363;
+    t366 = IGM_SIN_Q(18);
+    t367 = t364*t366;
+    t368 = IGM_COS_Q(18);
+    t369 = t188*t368;
+    t370 = -t367+t369;
+    t371 = IGM_SIN_Q(19);
+    t372 = t370*t371;
+    t374 = t357*t371;
+    t376 = t370*t359;
+    t378 = t364*t368;
+    t380 = t188*t366;
+    t388 = IGM_COS_Q(22);
+    t389 = t111*t388;
+    t390 = IGM_SIN_Q(22);
+    t391 = t99*t390;
+    t392 = t389+t391;
+    t394 = IGM_COS_Q(23);
+    t395 = t392*t394;
+    t397 = -t102;
+    t398 = IGM_SIN_Q(23);
+    t399 = t397*t398;
+    t401 = t392*t398;
+    t403 = t397*t394;
+    t405 = t111*t390;
+    t407 = t99*t388;
+    t423 = t198*t388;
+    t424 = t188*t390;
+    t425 = t423+t424;
+    t426 = t425*t394;
+    t428 = t354*t398;
+    t430 = t425*t398;
+    t432 = t354*t394;
+    t434 = t198*t390;
+    t436 = t188*t388;
+    t470 = t111*t352;
+    t471 = t397*t355;
+    t472 = -t470+t471;
+    t473 = t472*t359;
+    t475 = t111*t355;
+    t476 = t397*t352;
+    t477 = t475+t476;
+    t478 = t477*t366;
+    t479 = t99*t368;
+    t480 = -t478+t479;
+    t481 = t480*t371;
+    t483 = t472*t371;
+    t485 = t480*t359;
+    t487 = t477*t368;
+    t489 = t99*t366;
+    t505 = t360+t372;
+    t507 = IGM_COS_Q(21);
+    t508 = t505*t507;
+    t510 = t378+t380;
+    t512 = IGM_SIN_Q(20);
+    t513 = t510*t512;
+    t514 = -t374+t376;
+    t515 = IGM_COS_Q(20);
+    t516 = t514*t515;
+    t517 = -t513+t516;
+    t518 = IGM_SIN_Q(21);
+    t519 = t517*t518;
+    t521 = t505*t518;
+    t523 = t517*t507;
+    t525 = t510*t515;
+    t527 = t514*t512;
+    t552 = t473+t481;
+    t553 = t552*t507;
+    t555 = t487+t489;
+    t556 = t555*t512;
+    t557 = -t483+t485;
+    t558 = t557*t515;
+    t559 = -t556+t558;
+    t560 = t559*t518;
+    t562 = t552*t518;
+    t564 = t559*t507;
+    t566 = t555*t515;
+    t568 = t557*t512;
+    t576 = IGM_SIN_Q(12);
+    t577 = t111*t576;
+    t578 = IGM_COS_Q(12);
+    t579 = t397*t578;
+    t580 = -t577+t579;
+    t582 = IGM_COS_Q(14);
+    t583 = t580*t582;
+    t584 = t111*t578;
+    t585 = t397*t576;
+    t586 = t584+t585;
+    t588 = IGM_SIN_Q(13);
+    t589 = t586*t588;
+    t590 = IGM_COS_Q(13);
+    t591 = t99*t590;
+    t592 = -t589+t591;
+    t593 = IGM_SIN_Q(14);
+    t594 = t592*t593;
+    t595 = t583+t594;
+    t597 = IGM_COS_Q(16);
+    t598 = t595*t597;
+    t600 = t586*t590;
+    t601 = t99*t588;
+    t602 = t600+t601;
+    t604 = IGM_SIN_Q(15);
+    t605 = t602*t604;
+    t606 = t580*t593;
+    t607 = t592*t582;
+    t608 = -t606+t607;
+    t609 = IGM_COS_Q(15);
+    t610 = t608*t609;
+    t611 = -t605+t610;
+    t612 = IGM_SIN_Q(16);
+    t613 = t611*t612;
+    t615 = t595*t612;
+    t617 = t611*t597;
+    t619 = t602*t609;
+    t621 = t608*t604;
+    t653 = t198*t578;
+    t654 = t354*t576;
+    t655 = t653+t654;
+    t656 = t655*t590;
+    t657 = t188*t588;
+    t658 = t656+t657;
+    t659 = t658*t609;
+    t661 = t198*t576;
+    t662 = t354*t578;
+    t663 = -t661+t662;
+    t664 = t663*t593;
+    t665 = t655*t588;
+    t666 = t188*t590;
+    t667 = -t665+t666;
+    t668 = t667*t582;
+    t669 = -t664+t668;
+    t670 = t669*t604;
+    t672 = t658*t604;
+    t674 = t669*t609;
+    t676 = t663*t582;
+    t678 = t667*t593;
+    t717 = t230*t163;
+    t719 = t234*t158;
+    t721 = t224*t154;
+    t723 = t228*t149;
+    t775 = t156*t163;
+    t777 = t162*t158;
+    t779 = t147*t154;
+    t781 = t153*t149;
+    t813 = t676+t678;
+    t814 = t813*t597;
+    t816 = -t672+t674;
+    t817 = t816*t612;
+    t819 = t813*t612;
+    t821 = t816*t597;
+    t885 = t300*t352;
+    t886 = -t293;
+    t887 = t886*t355;
+    t888 = -t885+t887;
+    t889 = t888*t359;
+    t891 = t300*t355;
+    t892 = t886*t352;
+    t893 = t891+t892;
+    t894 = t893*t366;
+    t895 = t290*t368;
+    t896 = -t894+t895;
+    t897 = t896*t371;
+    t899 = t888*t371;
+    t901 = t896*t359;
+    t903 = t893*t368;
+    t905 = t290*t366;
+    t912 = t300*t576;
+    t913 = t886*t578;
+    t914 = -t912+t913;
+    t915 = t914*t582;
+    t916 = t300*t578;
+    t917 = t886*t576;
+    t918 = t916+t917;
+    t919 = t918*t588;
+    t920 = t290*t590;
+    t921 = -t919+t920;
+    t922 = t921*t593;
+    t923 = t915+t922;
+    t924 = t923*t597;
+    t926 = t918*t590;
+    t927 = t290*t588;
+    t928 = t926+t927;
+    t929 = t928*t604;
+    t930 = t914*t593;
+    t931 = t921*t582;
+    t932 = -t930+t931;
+    t933 = t932*t609;
+    t934 = -t929+t933;
+    t935 = t934*t612;
+    t937 = t923*t612;
+    t939 = t934*t597;
+    t941 = t928*t609;
+    t943 = t932*t604;
+    t985 = t300*t388;
+    t987 = t290*t390;
+    t989 = t300*t390;
+    t991 = t290*t388;
+    t1000 = t326*t154;
+    t1002 = t330*t149;
+    t1049 = t889+t897;
+    t1050 = t1049*t507;
+    t1052 = t903+t905;
+    t1053 = t1052*t512;
+    t1054 = -t899+t901;
+    t1055 = t1054*t515;
+    t1056 = -t1053+t1055;
+    t1057 = t1056*t518;
+    t1059 = t1049*t518;
+    t1061 = t1056*t507;
+    t1063 = t1052*t515;
+    t1065 = t1054*t512;
+    t1081 = t985+t987;
+    t1082 = t1081*t394;
+    t1084 = t886*t398;
+    t1086 = t1081*t398;
+    t1088 = t886*t394;
+    t1120 = t332*t163;
+    t1122 = t336*t158;
+    t3243 = t721-t723;
+    t3245 = t779-t781;
+    t3248 = t1000-t1002;
+    tA113 = t3248;
+    tA114 = t3243;
+    tA115 = t3245;
+    t3270 = LL[12];
+    A[0] = RL[12]-t334-t338-t339-t340-t341-t342-t343+t344-0.1*t254+0.1*t258
+-0.10274*t250+0.10274*t252-0.4511E-1*t245-t3270;
+    t3277 = LL[13];
+    A[1] = RL[13]-t232-t236-t237-t238-t239-t240-t241+t242-0.1*t19+0.1*t24
+-0.10274*t12+0.10274*t15-0.4511E-1*t2-t3277;
+    t3284 = LL[14];
+    A[2] = RL[14]-t160-t165-t166-t167-t168-t169-t170+t171-0.1*t60+0.1*t64
+-0.10274*t56+0.10274*t58-0.4511E-1*t51-t3284;
+    t3285 = RL[2];
+    t3288 = RL[1];
+    t3291 = RL[6];
+    t3292 = -t717+t719;
+    t3295 = RL[5];
+    t3296 = -t775+t777;
+    t3299 = RL[10];
+    t3300 = -t231-t235;
+    t3303 = RL[9];
+    t3304 = -t159-t164;
+    A[3] = 0.5*t3285*tA114-0.5*t3288*tA115+0.5*t3291*t3292-0.5*t3295*t3296+
+0.5*t3299*t3300-0.5*t3303*t3304;
+    t3307 = RL[0];
+    t3312 = RL[4];
+    t3315 = -t1120+t1122;
+    t3318 = RL[8];
+    t3321 = -t333-t337;
+    A[4] = 0.5*t3307*tA115-0.5*t3285*tA113+0.5*t3312*t3296-0.5*t3291*t3315+
+0.5*t3318*t3304-0.5*t3299*t3321;
+    A[5] = 0.5*t3288*tA113-0.5*t3307*tA114+0.5*t3295*t3315-0.5*t3312*t3292+
+0.5*t3303*t3321-0.5*t3318*t3300;
+    t3349 = -0.8051018213E-4*t924+0.5082624939E-2*t1088-0.2369931678E-4*t933+
+0.1702509553E-4*t915-0.7932620886E-4*t939+0.3696711277E-6*t987-0.8945848979E-4*
+t989-0.1078086072E-3*t322+0.1078086072E-3*t323+0.1832763156E-3*t331+
+0.7932620886E-4*t937-0.2061233404E-3*t294-0.9970896939E-4*t306;
+    t3363 = 0.101865705E-2*t298-0.101865705E-2*t299-0.1607889161E-3*t301+
+0.1607889161E-3*t304-0.1512290733E-3*t308-0.4402844298E-1*t245-0.1112574236E-3*
+t247-0.8799425961E-3*t251-0.2893250095E-3*t328+0.2893250095E-3*t329
+-0.8051018213E-4*t935+CoM[0]-0.5082624939E-2*t1086;
+    t3378 = 0.3696711277E-6*t985-0.2606799616E-2*t1065+0.9761137487E-4*t919
+-0.9761137487E-4*t920-0.2606799616E-2*t943-0.1112574236E-3*t1120
+-0.8051018213E-4*t1057+0.2369931678E-4*t929+0.8799425961E-3*t1002-0.9999999999*
+t3270-0.4677530128E-2*t926+0.2570662873E-4*t916+0.2570662873E-4*t917;
+    t3392 = -0.4677530128E-2*t927+0.8823452451E-4*t309-0.8823452451E-4*t310
+-0.7932620886E-4*t1059-0.4677530128E-2*t905-0.2369931678E-4*t1053+
+0.2369931678E-4*t1055+0.1232237092E-6*t899-0.1232237092E-6*t901+0.1512290733E-3
+*t312-0.1681938551E-1*t319+0.5687628827E-3*t316-0.3775495252E-3*t1084;
+    t3408 = 0.1112574236E-3*t1122+0.1702509553E-4*t889-0.9381437244E-4*t885+
+0.9381437244E-4*t887+0.1702509553E-4*t897+0.2570662873E-4*t891+0.7932620886E-4*
+t1061+0.2570662873E-4*t892-0.8503258945E-4*t894+0.8503258945E-4*t895
+-0.8051018213E-4*t1050-0.4677530128E-2*t903+0.8945848979E-4*t991;
+    t3422 = 0.1702509553E-4*t922+0.1832763156E-3*t327-0.9419629563E-2*t321
+-0.1681938551E-1*t315-0.9970896939E-4*t297+0.5687628827E-3*t260-0.8318061448E-1
+*t254-0.9332037043E-1*t250-0.1832763156E-3*t246-0.1832763156E-3*t248+
+0.9332037043E-1*t252-0.2893250095E-3*t255-0.2893250095E-3*t256;
+    t3437 = 0.8318061448E-1*t258+0.5687628827E-3*t264-0.1078086072E-3*t261
+-0.1078086072E-3*t262+0.1607889161E-3*t277+0.9397174694E-4*t270+0.3024581465E-3
+*t271-0.3024581465E-3*t272-0.5737222431E-5*t274+0.1607889161E-3*t280+
+0.1660372087E-1*t284-0.4122466806E-3*t285+0.4122466806E-3*t286;
+    t3452 = 0.6659098766E-1*t288-0.2061233404E-3*t291-0.2606799616E-2*t941
+-0.9381437244E-4*t912+0.9381437244E-4*t913-0.1232237092E-6*t930+0.1232237092E-6
+*t931-0.2606799616E-2*t1063-0.1081557015E-2*t333+0.5687628827E-3*t317
+-0.9419629563E-2*t325-0.3775495252E-3*t1082-0.1081557015E-2*t337
+-0.8799425961E-3*t1000;
+    A[6] = t3349+t3363+t3378+t3392+t3408+t3422+t3437+t3452;
+    t3468 = -0.3775495252E-3*t428-0.3775495252E-3*t426+0.1660372087E-1*t184+
+0.6659098766E-1*t186-0.2061233404E-3*t189-0.2061233404E-3*t192-0.9970896939E-4*
+t204+0.101865705E-2*t196-0.101865705E-2*t197-0.1607889161E-3*t199+
+0.1607889161E-3*t202-0.5082624939E-2*t430-0.2606799616E-2*t525;
+    t3482 = 0.9761137487E-4*t665-0.9761137487E-4*t666-0.2606799616E-2*t670+
+0.8945848979E-4*t436-0.4122466806E-3*t45-0.8318061448E-1*t19-0.9332037043E-1*
+t12-0.1832763156E-3*t5-0.1832763156E-3*t8+0.9332037043E-1*t15-0.2893250095E-3*
+t20-0.2893250095E-3*t21+0.8318061448E-1*t24;
+    t3497 = -0.1078086072E-3*t29-0.1078086072E-3*t30+0.9397174694E-4*t36+
+0.3024581465E-3*t37-0.3024581465E-3*t38-0.5737222431E-5*t40+0.8799425961E-3*
+t723-0.1081557015E-2*t231-0.1512290733E-3*t206+0.8823452451E-4*t207
+-0.8823452451E-4*t208-0.8799425961E-3*t721-0.1078086072E-3*t220;
+    t3511 = 0.1078086072E-3*t221-0.2606799616E-2*t659-0.9381437244E-4*t661+
+0.9381437244E-4*t662-0.1232237092E-6*t664+0.1232237092E-6*t668+0.1702509553E-4*
+t360+0.1232237092E-6*t374-0.1232237092E-6*t376-0.8051018213E-4*t519
+-0.2893250095E-3*t226+0.2893250095E-3*t227+0.1112574236E-3*t719;
+    t3527 = 0.2369931678E-4*t672-0.8051018213E-4*t817+0.1702509553E-4*t372+
+0.2570662873E-4*t362+0.2570662873E-4*t363-0.8051018213E-4*t814-0.2606799616E-2*
+t527-0.4677530128E-2*t656+0.2570662873E-4*t653+0.2570662873E-4*t654
+-0.4677530128E-2*t657+CoM[1]-0.7932620886E-4*t821;
+    t3541 = -0.7932620886E-4*t521-0.4677530128E-2*t380-0.2369931678E-4*t513+
+0.2369931678E-4*t516-0.2369931678E-4*t674-0.1081557015E-2*t235+0.1702509553E-4*
+t676+0.1702509553E-4*t678+0.5082624939E-2*t432+0.1832763156E-3*t229+
+0.7932620886E-4*t523-0.8503258945E-4*t367+0.8503258945E-4*t369;
+    t3556 = -0.8051018213E-4*t508-0.4677530128E-2*t378+0.7932620886E-4*t819+
+0.5687628827E-3*t215-0.9419629563E-2*t223-0.9999999999*t3277+0.3696711277E-6*
+t423+0.3696711277E-6*t424-0.8945848979E-4*t434+0.1832763156E-3*t225
+-0.9419629563E-2*t219-0.1681938551E-1*t213-0.9970896939E-4*t195;
+    t3571 = 0.5687628827E-3*t175+0.5687628827E-3*t176+0.1607889161E-3*t179+
+0.1607889161E-3*t180+0.1512290733E-3*t210-0.1681938551E-1*t217+0.5687628827E-3*
+t214-0.9381437244E-4*t353+0.9381437244E-4*t356-0.1112574236E-3*t717
+-0.4402844298E-1*t2-0.1112574236E-3*t6-0.8799425961E-3*t13+0.4122466806E-3*t49;
+    A[7] = t3468+t3482+t3497+t3511+t3527+t3541+t3556+t3571;
+    t3587 = -0.3775495252E-3*t399+0.8799425961E-3*t781-0.4402844298E-1*t51
+-0.1112574236E-3*t53-0.8799425961E-3*t57-0.1078086072E-3*t142+0.1078086072E-3*
+t143-0.8051018213E-4*t560+0.5082624939E-2*t403+0.1512290733E-3*t127
+-0.1681938551E-1*t137+0.5687628827E-3*t133-0.8799425961E-3*t779;
+    t3601 = -0.1112574236E-3*t775+0.1832763156E-3*t155+0.3696711277E-6*t389
+-0.2369931678E-4*t610+0.1702509553E-4*t583+0.1232237092E-6*t483-0.1232237092E-6
+*t485-0.2606799616E-2*t566-0.1081557015E-2*t159+0.3696711277E-6*t391
+-0.8945848979E-4*t405+0.8945848979E-4*t407-0.9381437244E-4*t470;
+    t3616 = 0.9381437244E-4*t471+0.1702509553E-4*t481+0.2570662873E-4*t475+
+0.2570662873E-4*t476-0.8503258945E-4*t478+0.8503258945E-4*t479+0.1702509553E-4*
+t473+0.6659098766E-1*t97-0.2061233404E-3*t100-0.2061233404E-3*t103
+-0.9970896939E-4*t121+0.101865705E-2*t109-0.101865705E-2*t110;
+    t3630 = -0.1607889161E-3*t114+0.1607889161E-3*t118+CoM[2]+0.7932620886E-4*
+t615-0.2606799616E-2*t568-0.8051018213E-4*t553-0.4677530128E-2*t487
+-0.4677530128E-2*t489-0.2369931678E-4*t556+0.2369931678E-4*t558-0.1232237092E-6
+*t606+0.1232237092E-6*t607+0.9761137487E-4*t589;
+    t3646 = -0.9761137487E-4*t591+0.7932620886E-4*t564-0.9999999999*t3284+
+0.5687628827E-3*t134-0.9419629563E-2*t146-0.8051018213E-4*t613-0.8051018213E-4*
+t598-0.4677530128E-2*t600+0.2570662873E-4*t584+0.2570662873E-4*t585
+-0.4677530128E-2*t601-0.2606799616E-2*t619-0.9381437244E-4*t577;
+    t3660 = 0.9381437244E-4*t579-0.7932620886E-4*t562-0.1512290733E-3*t123+
+0.1112574236E-3*t777-0.2606799616E-2*t621+0.2369931678E-4*t605-0.7932620886E-4*
+t617+0.8823452451E-4*t124-0.8823452451E-4*t125+0.1702509553E-4*t594
+-0.1081557015E-2*t164-0.3775495252E-3*t395-0.2893250095E-3*t151;
+    t3675 = 0.2893250095E-3*t152+0.1832763156E-3*t150-0.9419629563E-2*t141
+-0.1681938551E-1*t132-0.9970896939E-4*t108+0.5687628827E-3*t66-0.8318061448E-1*
+t60-0.9332037043E-1*t56-0.1832763156E-3*t52-0.1832763156E-3*t54+0.9332037043E-1
+*t58-0.2893250095E-3*t61-0.2893250095E-3*t62;
+    t3690 = 0.8318061448E-1*t64+0.5687628827E-3*t70-0.1078086072E-3*t67
+-0.1078086072E-3*t68+0.1607889161E-3*t85+0.9397174694E-4*t78+0.3024581465E-3*
+t79-0.3024581465E-3*t80-0.5737222431E-5*t82+0.1607889161E-3*t88+0.1660372087E-1
+*t93-0.4122466806E-3*t94+0.4122466806E-3*t95-0.5082624939E-2*t401;
+    A[8] = t3587+t3601+t3616+t3630+t3646+t3660+t3675+t3690;
+    A[9] = IGM_CONST(0.0);
+  }
@@ -0,0 +1,10 @@
+/**
+ * @file
+ * @brief AVX2 versions of from_LLeg_3() and from_RLeg_3(), must be compiled
+ * with '-mavx2 -mfma'.
+ */
+
+#define IGM_SIMD_WIDTH      4
+#define IGM_SIMD_NAME(name) name##_x4
+
+#include "from_Leg_3_simd.h"
@@ -0,0 +1,10 @@
+/**
+ * @file
+ * @brief AVX-512 versions of from_LLeg_3() and from_RLeg_3(), must be compiled
+ * with '-mavx512f'.
+ */
+
+#define IGM_SIMD_WIDTH      8
+#define IGM_SIMD_NAME(name) name##_x8
+
+#include "from_Leg_3_simd.h"
@@ -0,0 +1,32 @@
+/**
+ * @file
+ * @brief Single precision versions of from_LLeg_3() and from_RLeg_3(),
+ * which use precomputed sine and cosine of joint angles, see maple_float.h.
+ */
+
+#include <math.h>
+#include "maple_float.h"
+
+
+void from_LLeg_3_float (
+        const float *sin_q,
+        const float *cos_q,
+        const float *LL,
+        const float *RL,
+        const float *CoM,
+        float *A)
+{
+#include "from_LLeg_3_body.h"
+}
+
+
+void from_RLeg_3_float (
+        const float *sin_q,
+        const float *cos_q,
+        const float *RL,
+        const float *LL,
+        const float *CoM,
+        float *A)
+{
+#include "from_RLeg_3_body.h"
+}
@@ -0,0 +1,245 @@
+/**
+ * @file
+ * @brief Evaluation of from_LLeg_3() and from_RLeg_3() for multiple
+ * configurations with run-time selection of the widest available SIMD
+ * version.
+ *
+ * SIMD versions are compiled only if IGM_SIMD_ENABLE is defined, otherwise
+ * the scalar functions are called for each configuration.
+ */
+
+
+/****************************************
+ * DEFINES
+ ****************************************/
+
+#define IGM_MAX_SIMD_WIDTH  8
+
+#define Q_SIZE      24
+#define LEG_SIZE    16
+#define COM_SIZE    3
+#define A_SIZE      130
+
+
+/****************************************
+ * TYPEDEFS
+ ****************************************/
+
+typedef void (*from_Leg_3_simd) (
+        const double *,
+        const double *,
+        const double *,
+        const double *,
+        double *);
+
+
+/****************************************
+ * PROTOTYPES
+ ****************************************/
+
+void from_LLeg_3(double *q,double *LL,double *RL,double *CoM,double *A);
+void from_RLeg_3(double *q,double *RL,double *LL,double *CoM,double *A);
+
+#ifdef IGM_SIMD_ENABLE
+void from_LLeg_3_x4(const double *, const double *, const double *, const double *, double *);
+void from_RLeg_3_x4(const double *, const double *, const double *, const double *, double *);
+void from_LLeg_3_x8(const double *, const double *, const double *, const double *, double *);
+void from_RLeg_3_x8(const double *, const double *, const double *, const double *, double *);
+#endif
+
+
+
+/****************************************
+ * FUNCTIONS
+ ****************************************/
+
+/**
+ * @brief Returns the number of configurations processed by the generated
+ * functions at once on this CPU.
+ *
+ * @return 8 if AVX-512 is available, 4 if AVX2 is available, 1 otherwise.
+ */
+int igmSIMDWidth ()
+{
+#ifdef IGM_SIMD_ENABLE
+    if (__builtin_cpu_supports ("avx512f"))
+    {
+        return (8);
+    }
+    if (__builtin_cpu_supports ("avx2") && __builtin_cpu_supports ("fma"))
+    {
+        return (4);
+    }
+#endif
+    return (1);
+}
+
+
+
+#ifdef IGM_SIMD_ENABLE
+/**
+ * @brief Convert data to the structure-of-arrays format, call a SIMD function
+ * and convert the results back.
+ *
+ * @param[in] width the number of configurations processed by the function.
+ * @param[in] from_Leg_3 SIMD function.
+ * @param[in] num the number of configurations.
+ * @param[in] q num x Q_SIZE joint angles.
+ * @param[in] support num x LEG_SIZE postures of the support foot.
+ * @param[in] swing num x LEG_SIZE postures of the swing foot.
+ * @param[in] CoM num x COM_SIZE positions of the CoM.
+ * @param[out] A num x A_SIZE results.
+ *
+ * @note If num is not a multiple of width, the last configuration is
+ * replicated.
+ */
+static void from_Leg_3_multi (
+        const int width,
+        const from_Leg_3_simd from_Leg_3,
+        const int num,
+        const double *q,
+        const double *support,
+        const double *swing,
+        const double *CoM,
+        double *A)
+{
+    double q_soa[Q_SIZE*IGM_MAX_SIMD_WIDTH] __attribute__ ((aligned (64)));
+    double support_soa[LEG_SIZE*IGM_MAX_SIMD_WIDTH] __attribute__ ((aligned (64)));
+    double swing_soa[LEG_SIZE*IGM_MAX_SIMD_WIDTH] __attribute__ ((aligned (64)));
+    double CoM_soa[COM_SIZE*IGM_MAX_SIMD_WIDTH] __attribute__ ((aligned (64)));
+    double A_soa[A_SIZE*IGM_MAX_SIMD_WIDTH] __attribute__ ((aligned (64)));
+
+    int first, i, j, k;
+
+
+    for (first = 0; first < num; first += width)
+    {
+        for (j = 0; j < width; ++j)
+        {
+            k = (first + j < num) ? first + j : num - 1;
+
+            for (i = 0; i < Q_SIZE; ++i)
+            {
+                q_soa[i*width + j] = q[k*Q_SIZE + i];
+            }
+            for (i = 0; i < LEG_SIZE; ++i)
+            {
+                support_soa[i*width + j] = support[k*LEG_SIZE + i];
+                swing_soa[i*width + j] = swing[k*LEG_SIZE + i];
+            }
+            for (i = 0; i < COM_SIZE; ++i)
+            {
+                CoM_soa[i*width + j] = CoM[k*COM_SIZE + i];
+            }
+        }
+
+        from_Leg_3 (q_soa, support_soa, swing_soa, CoM_soa, A_soa);
+
+        for (j = 0; (j < width) && (first + j < num); ++j)
+        {
+            for (i = 0; i < A_SIZE; ++i)
+            {
+                A[(first + j)*A_SIZE + i] = A_soa[i*width + j];
+            }
+        }
+    }
+}
+#endif
+
+
+
+/**
+ * @brief Evaluate from_LLeg_3() for multiple configurations.
+ *
+ * @param[in] num the number of configurations.
+ * @param[in] q num x 24 joint angles.
+ * @param[in] LL num x 16 postures of the left foot.
+ * @param[in] RL num x 16 postures of the right foot.
+ * @param[in] CoM num x 3 positions of the CoM.
+ * @param[out] A num x 130 results.
+ *
+ * @note SIMD versions use their own implementation of sine and cosine, hence
+ * the results may differ from the results of from_LLeg_3() in the last bits.
+ */
+void from_LLeg_3_multi (
+        const int num,
+        const double *q,
+        const double *LL,
+        const double *RL,
+        const double *CoM,
+        double *A)
+{
+    int i;
+
+    switch (igmSIMDWidth())
+    {
+#ifdef IGM_SIMD_ENABLE
+        case 8:
+            from_Leg_3_multi (8, from_LLeg_3_x8, num, q, LL, RL, CoM, A);
+            break;
+        case 4:
+            from_Leg_3_multi (4, from_LLeg_3_x4, num, q, LL, RL, CoM, A);
+            break;
+#endif
+        default:
+            for (i = 0; i < num; ++i)
+            {
+                from_LLeg_3 (
+                        (double *) q + i*Q_SIZE,
+                        (double *) LL + i*LEG_SIZE,
+                        (double *) RL + i*LEG_SIZE,
+                        (double *) CoM + i*COM_SIZE,
+                        A + i*A_SIZE);
+            }
+            break;
+    }
+}
+
+
+
+/**
+ * @brief Evaluate from_RLeg_3() for multiple configurations.
+ *
+ * @param[in] num the number of configurations.
+ * @param[in] q num x 24 joint angles.
+ * @param[in] RL num x 16 postures of the right foot.
+ * @param[in] LL num x 16 postures of the left foot.
+ * @param[in] CoM num x 3 positions of the CoM.
+ * @param[out] A num x 130 results.
+ *
+ * @note SIMD versions use their own implementation of sine and cosine, hence
+ * the results may differ from the results of from_RLeg_3() in the last bits.
+ */
+void from_RLeg_3_multi (
+        const int num,
+        const double *q,
+        const double *RL,
+        const double *LL,
+        const double *CoM,
+        double *A)
+{
+    int i;
+
+    switch (igmSIMDWidth())
+    {
+#ifdef IGM_SIMD_ENABLE
+        case 8:
+            from_Leg_3_multi (8, from_RLeg_3_x8, num, q, RL, LL, CoM, A);
+            break;
+        case 4:
+            from_Leg_3_multi (4, from_RLeg_3_x4, num, q, RL, LL, CoM, A);
+            break;
+#endif
+        default:
+            for (i = 0; i < num; ++i)
+            {
+                from_RLeg_3 (
+                        (double *) q + i*Q_SIZE,
+                        (double *) RL + i*LEG_SIZE,
+                        (double *) LL + i*LEG_SIZE,
+                        (double *) CoM + i*COM_SIZE,
+                        A + i*A_SIZE);
+            }
+            break;
+    }
+}
@@ -0,0 +1,31 @@
+/**
+ * @file
+ * @brief Versions of from_LLeg_3() and from_RLeg_3(), which compute only
+ * the residuals of the constraints (the last IGM_NUM_CONSTRAINTS entries of
+ * the output of the original functions).
+ */
+
+#include <math.h>
+#include "maple_double.h"
+
+
+void from_LLeg_3_residual (
+        const double *q,
+        const double *LL,
+        const double *RL,
+        const double *CoM,
+        double *A)
+{
+#include "from_LLeg_3_residual_body.h"
+}
+
+
+void from_RLeg_3_residual (
+        const double *q,
+        const double *RL,
+        const double *LL,
+        const double *CoM,
+        double *A)
+{
+#include "from_RLeg_3_residual_body.h"
+}
@@ -0,0 +1,83 @@
+/**
+ * @file
+ * @brief Vectorized versions of from_LLeg_3() and from_RLeg_3(), which
+ * evaluate IGM_SIMD_WIDTH configurations at once.
+ *
+ * IGM_SIMD_WIDTH and IGM_SIMD_NAME(name) must be defined before inclusion of
+ * this file.
+ *
+ * All arguments are stored in the structure-of-arrays format: the element
+ * 'i' of the configuration 'j' is located at [i*IGM_SIMD_WIDTH + j]. The
+ * sizes of arguments are the same as in the scalar functions. The arguments
+ * must be aligned to IGM_SIMD_WIDTH*sizeof(double) bytes.
+ */
+
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include <math.h>
+
+#include "maple_simd.h"
+
+
+/****************************************
+ * FUNCTIONS
+ ****************************************/
+
+void IGM_SIMD_NAME(from_LLeg_3) (
+        const double *q_soa,
+        const double *LL_soa,
+        const double *RL_soa,
+        const double *CoM_soa,
+        double *A_soa)
+{
+    const igm_vreal *q = (const igm_vreal *) q_soa;
+    const igm_vreal *LL = (const igm_vreal *) LL_soa;
+    const igm_vreal *RL = (const igm_vreal *) RL_soa;
+    const igm_vreal *CoM = (const igm_vreal *) CoM_soa;
+    igm_vreal *A = (igm_vreal *) A_soa;
+
+    igm_vreal sin_q[24];
+    igm_vreal cos_q[24];
+    int i;
+
+    for (i = 0; i < 24; ++i)
+    {
+        igm_vsincos (q[i], &sin_q[i], &cos_q[i]);
+    }
+
+    {
+#include "from_LLeg_3_body.h"
+    }
+}
+
+
+
+void IGM_SIMD_NAME(from_RLeg_3) (
+        const double *q_soa,
+        const double *RL_soa,
+        const double *LL_soa,
+        const double *CoM_soa,
+        double *A_soa)
+{
+    const igm_vreal *q = (const igm_vreal *) q_soa;
+    const igm_vreal *RL = (const igm_vreal *) RL_soa;
+    const igm_vreal *LL = (const igm_vreal *) LL_soa;
+    const igm_vreal *CoM = (const igm_vreal *) CoM_soa;
+    igm_vreal *A = (igm_vreal *) A_soa;
+
+    igm_vreal sin_q[24];
+    igm_vreal cos_q[24];
+    int i;
+
+    for (i = 0; i < 24; ++i)
+    {
+        igm_vsincos (q[i], &sin_q[i], &cos_q[i]);
+    }
+
+    {
+#include "from_RLeg_3_body.h"
+    }
+}
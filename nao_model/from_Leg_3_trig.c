@@ -0,0 +1,56 @@
+/**
+ * @file
+ * @brief Versions of from_LLeg_3(), from_RLeg_3() and their residual-only
+ * versions, which use precomputed sine and cosine of joint angles.
+ */
+
+#include <math.h>
+#include "maple_trig.h"
+
+
+void from_LLeg_3_trig (
+        const double *sin_q,
+        const double *cos_q,
+        const double *LL,
+        const double *RL,
+        const double *CoM,
+        double *A)
+{
+#include "from_LLeg_3_body.h"
+}
+
+
+void from_RLeg_3_trig (
+        const double *sin_q,
+        const double *cos_q,
+        const double *RL,
+        const double *LL,
+        const double *CoM,
+        double *A)
+{
+#include "from_RLeg_3_body.h"
+}
+
+
+void from_LLeg_3_residual_trig (
+        const double *sin_q,
+        const double *cos_q,
+        const double *LL,
+        const double *RL,
+        const double *CoM,
+        double *A)
+{
+#include "from_LLeg_3_residual_body.h"
+}
+
+
+void from_RLeg_3_residual_trig (
+        const double *sin_q,
+        const double *cos_q,
+        const double *RL,
+        const double *LL,
+        const double *CoM,
+        double *A)
+{
+#include "from_RLeg_3_residual_body.h"
+}
@@ -0,0 +1,3181 @@
+/* Generated using codegen (2012-03-12, 10:16:23) */ 
+/*
+ * Body of from_RLeg_3(), the IGM_* macros are described in maple_double.h.
+ */
+  IGM_REAL t100;
+  IGM_REAL t1000;
+  IGM_REAL t1001;
+  IGM_REAL t1002;
+  IGM_REAL t1003;
+  IGM_REAL t1004;
+  IGM_REAL t1005;
+  IGM_REAL t1006;
+  IGM_REAL t1007;
+  IGM_REAL t1008;
+  IGM_REAL t1009;
+  IGM_REAL t101;
+  IGM_REAL t1010;
+  IGM_REAL t1011;
+  IGM_REAL t1014;
+  IGM_REAL t1016;
+  IGM_REAL t1017;
+  IGM_REAL t1018;
+  IGM_REAL t1019;
+  IGM_REAL t102;
+  IGM_REAL t1020;
+  IGM_REAL t1021;
+  IGM_REAL t1022;
+  IGM_REAL t1023;
+  IGM_REAL t1024;
+  IGM_REAL t1025;
+  IGM_REAL t1026;
+  IGM_REAL t1027;
+  IGM_REAL t1028;
+  IGM_REAL t1029;
+  IGM_REAL t1030;
+  IGM_REAL t1031;
+  IGM_REAL t1034;
+  IGM_REAL t1037;
+  IGM_REAL t104;
+  IGM_REAL t1040;
+  IGM_REAL t1041;
+  IGM_REAL t1042;
+  IGM_REAL t1043;
+  IGM_REAL t1044;
+  IGM_REAL t1045;
+  IGM_REAL t1046;
+  IGM_REAL t1049;
+  IGM_REAL t105;
+  IGM_REAL t1050;
+  IGM_REAL t1051;
+  IGM_REAL t1052;
+  IGM_REAL t1053;
+  IGM_REAL t1054;
+  IGM_REAL t1055;
+  IGM_REAL t1056;
+  IGM_REAL t1057;
+  IGM_REAL t1058;
+  IGM_REAL t1059;
+  IGM_REAL t1060;
+  IGM_REAL t1061;
+  IGM_REAL t1064;
+  IGM_REAL t1067;
+  IGM_REAL t107;
+  IGM_REAL t1070;
+  IGM_REAL t1071;
+  IGM_REAL t1073;
+  IGM_REAL t1074;
+  IGM_REAL t1075;
+  IGM_REAL t1076;
+  IGM_REAL t1077;
+  IGM_REAL t1078;
+  IGM_REAL t1079;
+  IGM_REAL t108;
+  IGM_REAL t1080;
+  IGM_REAL t1081;
+  IGM_REAL t1082;
+  IGM_REAL t1083;
+  IGM_REAL t1084;
+  IGM_REAL t1085;
+  IGM_REAL t1086;
+  IGM_REAL t1089;
+  IGM_REAL t109;
+  IGM_REAL t1090;
+  IGM_REAL t1091;
+  IGM_REAL t1092;
+  IGM_REAL t1093;
+  IGM_REAL t1094;
+  IGM_REAL t1095;
+  IGM_REAL t1098;
+  IGM_REAL t11;
+  IGM_REAL t1101;
+  IGM_REAL t1104;
+  IGM_REAL t1107;
+  IGM_REAL t1109;
+  IGM_REAL t1110;
+  IGM_REAL t1111;
+  IGM_REAL t1112;
+  IGM_REAL t1113;
+  IGM_REAL t1114;
+  IGM_REAL t1115;
+  IGM_REAL t1116;
+  IGM_REAL t1117;
+  IGM_REAL t1118;
+  IGM_REAL t1119;
+  IGM_REAL t112;
+  IGM_REAL t1120;
+  IGM_REAL t1121;
+  IGM_REAL t1122;
+  IGM_REAL t1125;
+  IGM_REAL t1126;
+  IGM_REAL t1127;
+  IGM_REAL t1128;
+  IGM_REAL t1129;
+  IGM_REAL t113;
+  IGM_REAL t1130;
+  IGM_REAL t1131;
+  IGM_REAL t1132;
+  IGM_REAL t1133;
+  IGM_REAL t1134;
+  IGM_REAL t1135;
+  IGM_REAL t1136;
+  IGM_REAL t1137;
+  IGM_REAL t1138;
+  IGM_REAL t1139;
+  IGM_REAL t114;
+  IGM_REAL t1142;
+  IGM_REAL t1145;
+  IGM_REAL t1146;
+  IGM_REAL t1147;
+  IGM_REAL t1148;
+  IGM_REAL t1149;
+  IGM_REAL t115;
+  IGM_REAL t1150;
+  IGM_REAL t1151;
+  IGM_REAL t1152;
+  IGM_REAL t1153;
+  IGM_REAL t1154;
+  IGM_REAL t1155;
+  IGM_REAL t1156;
+  IGM_REAL t1157;
+  IGM_REAL t1158;
+  IGM_REAL t1159;
+  IGM_REAL t116;
+  IGM_REAL t1160;
+  IGM_REAL t1161;
+  IGM_REAL t1162;
+  IGM_REAL t1163;
+  IGM_REAL t1164;
+  IGM_REAL t1165;
+  IGM_REAL t1168;
+  IGM_REAL t1169;
+  IGM_REAL t1170;
+  IGM_REAL t1171;
+  IGM_REAL t1172;
+  IGM_REAL t1175;
+  IGM_REAL t1176;
+  IGM_REAL t1177;
+  IGM_REAL t1178;
+  IGM_REAL t1179;
+  IGM_REAL t118;
+  IGM_REAL t1180;
+  IGM_REAL t1181;
+  IGM_REAL t1184;
+  IGM_REAL t1187;
+  IGM_REAL t1188;
+  IGM_REAL t1189;
+  IGM_REAL t119;
+  IGM_REAL t1190;
+  IGM_REAL t1191;
+  IGM_REAL t1192;
+  IGM_REAL t1193;
+  IGM_REAL t1196;
+  IGM_REAL t1197;
+  IGM_REAL t1198;
+  IGM_REAL t1199;
+  IGM_REAL t12;
+  IGM_REAL t1200;
+  IGM_REAL t1201;
+  IGM_REAL t1202;
+  IGM_REAL t1203;
+  IGM_REAL t1204;
+  IGM_REAL t1205;
+  IGM_REAL t1206;
+  IGM_REAL t1207;
+  IGM_REAL t1208;
+  IGM_REAL t121;
+  IGM_REAL t1211;
+  IGM_REAL t1212;
+  IGM_REAL t1213;
+  IGM_REAL t1214;
+  IGM_REAL t1215;
+  IGM_REAL t1216;
+  IGM_REAL t1217;
+  IGM_REAL t1218;
+  IGM_REAL t1219;
+  IGM_REAL t122;
+  IGM_REAL t1220;
+  IGM_REAL t1221;
+  IGM_REAL t1222;
+  IGM_REAL t1223;
+  IGM_REAL t1224;
+  IGM_REAL t1227;
+  IGM_REAL t1228;
+  IGM_REAL t1229;
+  IGM_REAL t1230;
+  IGM_REAL t1231;
+  IGM_REAL t1232;
+  IGM_REAL t1233;
+  IGM_REAL t1236;
+  IGM_REAL t1237;
+  IGM_REAL t1238;
+  IGM_REAL t1239;
+  IGM_REAL t124;
+  IGM_REAL t1240;
+  IGM_REAL t1241;
+  IGM_REAL t1242;
+  IGM_REAL t1245;
+  IGM_REAL t1246;
+  IGM_REAL t1247;
+  IGM_REAL t1248;
+  IGM_REAL t1249;
+  IGM_REAL t1250;
+  IGM_REAL t1251;
+  IGM_REAL t1254;
+  IGM_REAL t1255;
+  IGM_REAL t1256;
+  IGM_REAL t1257;
+  IGM_REAL t1258;
+  IGM_REAL t126;
+  IGM_REAL t1261;
+  IGM_REAL t1262;
+  IGM_REAL t127;
+  IGM_REAL t1277;
+  IGM_REAL t128;
+  IGM_REAL t1280;
+  IGM_REAL t1285;
+  IGM_REAL t129;
+  IGM_REAL t1290;
+  IGM_REAL t1291;
+  IGM_REAL t1292;
+  IGM_REAL t1293;
+  IGM_REAL t1294;
+  IGM_REAL t1295;
+  IGM_REAL t1296;
+  IGM_REAL t1297;
+  IGM_REAL t1298;
+  IGM_REAL t1299;
+  IGM_REAL t13;
+  IGM_REAL t130;
+  IGM_REAL t1300;
+  IGM_REAL t1301;
+  IGM_REAL t1302;
+  IGM_REAL t1303;
+  IGM_REAL t1304;
+  IGM_REAL t1305;
+  IGM_REAL t1306;
+  IGM_REAL t1307;
+  IGM_REAL t1308;
+  IGM_REAL t1309;
+  IGM_REAL t1310;
+  IGM_REAL t1311;
+  IGM_REAL t1312;
+  IGM_REAL t1313;
+  IGM_REAL t1314;
+  IGM_REAL t1315;
+  IGM_REAL t1316;
+  IGM_REAL t1317;
+  IGM_REAL t1318;
+  IGM_REAL t1319;
+  IGM_REAL t132;
+  IGM_REAL t1320;
+  IGM_REAL t1321;
+  IGM_REAL t1322;
+  IGM_REAL t1323;
+  IGM_REAL t1324;
+  IGM_REAL t1325;
+  IGM_REAL t1326;
+  IGM_REAL t1327;
+  IGM_REAL t1328;
+  IGM_REAL t133;
+  IGM_REAL t1331;
+  IGM_REAL t1332;
+  IGM_REAL t1333;
+  IGM_REAL t1334;
+  IGM_REAL t1335;
+  IGM_REAL t1336;
+  IGM_REAL t1337;
+  IGM_REAL t1338;
+  IGM_REAL t1339;
+  IGM_REAL t1340;
+  IGM_REAL t1341;
+  IGM_REAL t1342;
+  IGM_REAL t1343;
+  IGM_REAL t1344;
+  IGM_REAL t1345;
+  IGM_REAL t1346;
+  IGM_REAL t1347;
+  IGM_REAL t1348;
+  IGM_REAL t1349;
+  IGM_REAL t135;
+  IGM_REAL t1350;
+  IGM_REAL t1351;
+  IGM_REAL t1352;
+  IGM_REAL t1353;
+  IGM_REAL t1354;
+  IGM_REAL t1359;
+  IGM_REAL t136;
+  IGM_REAL t1360;
+  IGM_REAL t1361;
+  IGM_REAL t1362;
+  IGM_REAL t1363;
+  IGM_REAL t1364;
+  IGM_REAL t1365;
+  IGM_REAL t1368;
+  IGM_REAL t1369;
+  IGM_REAL t137;
+  IGM_REAL t1370;
+  IGM_REAL t1371;
+  IGM_REAL t1372;
+  IGM_REAL t1373;
+  IGM_REAL t1374;
+  IGM_REAL t1375;
+  IGM_REAL t1376;
+  IGM_REAL t1377;
+  IGM_REAL t1378;
+  IGM_REAL t1379;
+  IGM_REAL t138;
+  IGM_REAL t1380;
+  IGM_REAL t1381;
+  IGM_REAL t1382;
+  IGM_REAL t1383;
+  IGM_REAL t1384;
+  IGM_REAL t1385;
+  IGM_REAL t1386;
+  IGM_REAL t1387;
+  IGM_REAL t1388;
+  IGM_REAL t139;
+  IGM_REAL t1391;
+  IGM_REAL t1394;
+  IGM_REAL t1395;
+  IGM_REAL t1396;
+  IGM_REAL t1397;
+  IGM_REAL t1398;
+  IGM_REAL t14;
+  IGM_REAL t140;
+  IGM_REAL t1401;
+  IGM_REAL t1402;
+  IGM_REAL t1403;
+  IGM_REAL t1404;
+  IGM_REAL t1405;
+  IGM_REAL t1406;
+  IGM_REAL t1407;
+  IGM_REAL t1408;
+  IGM_REAL t1411;
+  IGM_REAL t1412;
+  IGM_REAL t1413;
+  IGM_REAL t1414;
+  IGM_REAL t1415;
+  IGM_REAL t1416;
+  IGM_REAL t1417;
+  IGM_REAL t142;
+  IGM_REAL t1420;
+  IGM_REAL t1421;
+  IGM_REAL t1422;
+  IGM_REAL t1423;
+  IGM_REAL t1424;
+  IGM_REAL t1425;
+  IGM_REAL t1426;
+  IGM_REAL t143;
+  IGM_REAL t144;
+  IGM_REAL t1447;
+  IGM_REAL t1448;
+  IGM_REAL t1449;
+  IGM_REAL t1450;
+  IGM_REAL t1451;
+  IGM_REAL t1452;
+  IGM_REAL t1453;
+  IGM_REAL t1456;
+  IGM_REAL t1457;
+  IGM_REAL t1458;
+  IGM_REAL t1459;
+  IGM_REAL t146;
+  IGM_REAL t1460;
+  IGM_REAL t1461;
+  IGM_REAL t1462;
+  IGM_REAL t1465;
+  IGM_REAL t1468;
+  IGM_REAL t1469;
+  IGM_REAL t1470;
+  IGM_REAL t1471;
+  IGM_REAL t1472;
+  IGM_REAL t1473;
+  IGM_REAL t1474;
+  IGM_REAL t1475;
+  IGM_REAL t1476;
+  IGM_REAL t1477;
+  IGM_REAL t1478;
+  IGM_REAL t148;
+  IGM_REAL t1481;
+  IGM_REAL t1482;
+  IGM_REAL t1483;
+  IGM_REAL t1484;
+  IGM_REAL t1485;
+  IGM_REAL t1486;
+  IGM_REAL t1487;
+  IGM_REAL t1488;
+  IGM_REAL t1489;
+  IGM_REAL t1490;
+  IGM_REAL t1491;
+  IGM_REAL t1492;
+  IGM_REAL t1493;
+  IGM_REAL t1494;
+  IGM_REAL t1497;
+  IGM_REAL t1498;
+  IGM_REAL t1499;
+  IGM_REAL t15;
+  IGM_REAL t150;
+  IGM_REAL t1500;
+  IGM_REAL t1501;
+  IGM_REAL t1502;
+  IGM_REAL t1503;
+  IGM_REAL t1508;
+  IGM_REAL t151;
+  IGM_REAL t152;
+  IGM_REAL t153;
+  IGM_REAL t154;
+  IGM_REAL t1547;
+  IGM_REAL t155;
+  IGM_REAL t156;
+  IGM_REAL t157;
+  IGM_REAL t1586;
+  IGM_REAL t1587;
+  IGM_REAL t1589;
+  IGM_REAL t159;
+  IGM_REAL t1592;
+  IGM_REAL t16;
+  IGM_REAL t160;
+  IGM_REAL t161;
+  IGM_REAL t1616;
+  IGM_REAL t1617;
+  IGM_REAL t1618;
+  IGM_REAL t1619;
+  IGM_REAL t162;
+  IGM_REAL t1620;
+  IGM_REAL t1621;
+  IGM_REAL t1622;
+  IGM_REAL t163;
+  IGM_REAL t164;
+  IGM_REAL t1643;
+  IGM_REAL t165;
+  IGM_REAL t1652;
+  IGM_REAL t1653;
+  IGM_REAL t1654;
+  IGM_REAL t1655;
+  IGM_REAL t1656;
+  IGM_REAL t1657;
+  IGM_REAL t1658;
+  IGM_REAL t166;
+  IGM_REAL t168;
+  IGM_REAL t169;
+  IGM_REAL t1691;
+  IGM_REAL t170;
+  IGM_REAL t171;
+  IGM_REAL t172;
+  IGM_REAL t173;
+  IGM_REAL t1732;
+  IGM_REAL t174;
+  IGM_REAL t175;
+  IGM_REAL t1765;
+  IGM_REAL t1766;
+  IGM_REAL t1767;
+  IGM_REAL t1768;
+  IGM_REAL t1769;
+  IGM_REAL t177;
+  IGM_REAL t1770;
+  IGM_REAL t1771;
+  IGM_REAL t178;
+  IGM_REAL t1780;
+  IGM_REAL t179;
+  IGM_REAL t18;
+  IGM_REAL t181;
+  IGM_REAL t182;
+  IGM_REAL t1821;
+  IGM_REAL t183;
+  IGM_REAL t184;
+  IGM_REAL t185;
+  IGM_REAL t186;
+  IGM_REAL t1862;
+  IGM_REAL t1863;
+  IGM_REAL t1865;
+  IGM_REAL t1868;
+  IGM_REAL t187;
+  IGM_REAL t188;
+  IGM_REAL t1888;
+  IGM_REAL t1889;
+  IGM_REAL t189;
+  IGM_REAL t1890;
+  IGM_REAL t1891;
+  IGM_REAL t1892;
+  IGM_REAL t1895;
+  IGM_REAL t1896;
+  IGM_REAL t1897;
+  IGM_REAL t1898;
+  IGM_REAL t1899;
+  IGM_REAL t19;
+  IGM_REAL t191;
+  IGM_REAL t192;
+  IGM_REAL t1925;
+  IGM_REAL t193;
+  IGM_REAL t194;
+  IGM_REAL t195;
+  IGM_REAL t196;
+  IGM_REAL t197;
+  IGM_REAL t1970;
+  IGM_REAL t199;
+  IGM_REAL t1997;
+  IGM_REAL t1998;
+  IGM_REAL t1999;
+  IGM_REAL t2;
+  IGM_REAL t20;
+  IGM_REAL t200;
+  IGM_REAL t2000;
+  IGM_REAL t2001;
+  IGM_REAL t201;
+  IGM_REAL t202;
+  IGM_REAL t2020;
+  IGM_REAL t204;
+  IGM_REAL t205;
+  IGM_REAL t206;
+  IGM_REAL t2065;
+  IGM_REAL t208;
+  IGM_REAL t21;
+  IGM_REAL t210;
+  IGM_REAL t211;
+  IGM_REAL t2110;
+  IGM_REAL t212;
+  IGM_REAL t213;
+  IGM_REAL t214;
+  IGM_REAL t215;
+  IGM_REAL t2155;
+  IGM_REAL t2157;
+  IGM_REAL t2158;
+  IGM_REAL t2159;
+  IGM_REAL t216;
+  IGM_REAL t2161;
+  IGM_REAL t2162;
+  IGM_REAL t2163;
+  IGM_REAL t2165;
+  IGM_REAL t2166;
+  IGM_REAL t2167;
+  IGM_REAL t217;
+  IGM_REAL t2172;
+  IGM_REAL t2175;
+  IGM_REAL t2178;
+  IGM_REAL t218;
+  IGM_REAL t2181;
+  IGM_REAL t2184;
+  IGM_REAL t2187;
+  IGM_REAL t219;
+  IGM_REAL t2190;
+  IGM_REAL t2193;
+  IGM_REAL t2196;
+  IGM_REAL t2199;
+  IGM_REAL t22;
+  IGM_REAL t220;
+  IGM_REAL t2202;
+  IGM_REAL t2205;
+  IGM_REAL t2206;
+  IGM_REAL t2209;
+  IGM_REAL t221;
+  IGM_REAL t2212;
+  IGM_REAL t2215;
+  IGM_REAL t2218;
+  IGM_REAL t222;
+  IGM_REAL t2221;
+  IGM_REAL t2224;
+  IGM_REAL t2227;
+  IGM_REAL t223;
+  IGM_REAL t2230;
+  IGM_REAL t2233;
+  IGM_REAL t2236;
+  IGM_REAL t2239;
+  IGM_REAL t224;
+  IGM_REAL t2241;
+  IGM_REAL t2244;
+  IGM_REAL t2247;
+  IGM_REAL t225;
+  IGM_REAL t2250;
+  IGM_REAL t2253;
+  IGM_REAL t2256;
+  IGM_REAL t2259;
+  IGM_REAL t226;
+  IGM_REAL t2262;
+  IGM_REAL t2265;
+  IGM_REAL t2268;
+  IGM_REAL t2269;
+  IGM_REAL t227;
+  IGM_REAL t2270;
+  IGM_REAL t2271;
+  IGM_REAL t2272;
+  IGM_REAL t2273;
+  IGM_REAL t2274;
+  IGM_REAL t2277;
+  IGM_REAL t2278;
+  IGM_REAL t2279;
+  IGM_REAL t228;
+  IGM_REAL t2280;
+  IGM_REAL t2281;
+  IGM_REAL t2282;
+  IGM_REAL t2283;
+  IGM_REAL t2286;
+  IGM_REAL t2287;
+  IGM_REAL t229;
+  IGM_REAL t2290;
+  IGM_REAL t2293;
+  IGM_REAL t2296;
+  IGM_REAL t2299;
+  IGM_REAL t23;
+  IGM_REAL t230;
+  IGM_REAL t2302;
+  IGM_REAL t2305;
+  IGM_REAL t2308;
+  IGM_REAL t2311;
+  IGM_REAL t2314;
+  IGM_REAL t2317;
+  IGM_REAL t232;
+  IGM_REAL t2320;
+  IGM_REAL t2322;
+  IGM_REAL t2325;
+  IGM_REAL t233;
+  IGM_REAL t2330;
+  IGM_REAL t2335;
+  IGM_REAL t2338;
+  IGM_REAL t234;
+  IGM_REAL t2343;
+  IGM_REAL t2346;
+  IGM_REAL t235;
+  IGM_REAL t2351;
+  IGM_REAL t2352;
+  IGM_REAL t2355;
+  IGM_REAL t236;
+  IGM_REAL t2360;
+  IGM_REAL t2365;
+  IGM_REAL t2368;
+  IGM_REAL t237;
+  IGM_REAL t2373;
+  IGM_REAL t238;
+  IGM_REAL t2380;
+  IGM_REAL t2384;
+  IGM_REAL t2387;
+  IGM_REAL t239;
+  IGM_REAL t2390;
+  IGM_REAL t2395;
+  IGM_REAL t24;
+  IGM_REAL t2404;
+  IGM_REAL t2409;
+  IGM_REAL t241;
+  IGM_REAL t2410;
+  IGM_REAL t2413;
+  IGM_REAL t2418;
+  IGM_REAL t2419;
+  IGM_REAL t242;
+  IGM_REAL t2420;
+  IGM_REAL t2421;
+  IGM_REAL t2422;
+  IGM_REAL t2423;
+  IGM_REAL t2424;
+  IGM_REAL t243;
+  IGM_REAL t2433;
+  IGM_REAL t244;
+  IGM_REAL t2442;
+  IGM_REAL t245;
+  IGM_REAL t246;
+  IGM_REAL t2466;
+  IGM_REAL t247;
+  IGM_REAL t248;
+  IGM_REAL t2489;
+  IGM_REAL t249;
+  IGM_REAL t25;
+  IGM_REAL t250;
+  IGM_REAL t251;
+  IGM_REAL t2513;
+  IGM_REAL t252;
+  IGM_REAL t253;
+  IGM_REAL t2536;
+  IGM_REAL t2538;
+  IGM_REAL t2539;
+  IGM_REAL t254;
+  IGM_REAL t2540;
+  IGM_REAL t2542;
+  IGM_REAL t2543;
+  IGM_REAL t2544;
+  IGM_REAL t2546;
+  IGM_REAL t2547;
+  IGM_REAL t2548;
+  IGM_REAL t255;
+  IGM_REAL t2553;
+  IGM_REAL t2556;
+  IGM_REAL t2559;
+  IGM_REAL t256;
+  IGM_REAL t2562;
+  IGM_REAL t2565;
+  IGM_REAL t2568;
+  IGM_REAL t257;
+  IGM_REAL t2571;
+  IGM_REAL t2574;
+  IGM_REAL t2577;
+  IGM_REAL t258;
+  IGM_REAL t2580;
+  IGM_REAL t2583;
+  IGM_REAL t2586;
+  IGM_REAL t2587;
+  IGM_REAL t259;
+  IGM_REAL t2590;
+  IGM_REAL t2593;
+  IGM_REAL t2596;
+  IGM_REAL t2599;
+  IGM_REAL t260;
+  IGM_REAL t2602;
+  IGM_REAL t2605;
+  IGM_REAL t2608;
+  IGM_REAL t261;
+  IGM_REAL t2611;
+  IGM_REAL t2614;
+  IGM_REAL t2617;
+  IGM_REAL t2620;
+  IGM_REAL t2623;
+  IGM_REAL t2625;
+  IGM_REAL t2628;
+  IGM_REAL t2631;
+  IGM_REAL t2634;
+  IGM_REAL t2637;
+  IGM_REAL t2640;
+  IGM_REAL t2649;
+  IGM_REAL t2658;
+  IGM_REAL t266;
+  IGM_REAL t2661;
+  IGM_REAL t2664;
+  IGM_REAL t2667;
+  IGM_REAL t267;
+  IGM_REAL t2670;
+  IGM_REAL t2671;
+  IGM_REAL t2674;
+  IGM_REAL t2677;
+  IGM_REAL t268;
+  IGM_REAL t2680;
+  IGM_REAL t2683;
+  IGM_REAL t2686;
+  IGM_REAL t2689;
+  IGM_REAL t269;
+  IGM_REAL t2692;
+  IGM_REAL t2695;
+  IGM_REAL t2698;
+  IGM_REAL t27;
+  IGM_REAL t270;
+  IGM_REAL t2701;
+  IGM_REAL t2704;
+  IGM_REAL t2707;
+  IGM_REAL t2711;
+  IGM_REAL t2714;
+  IGM_REAL t2719;
+  IGM_REAL t272;
+  IGM_REAL t2722;
+  IGM_REAL t2725;
+  IGM_REAL t273;
+  IGM_REAL t2732;
+  IGM_REAL t2737;
+  IGM_REAL t2738;
+  IGM_REAL t2749;
+  IGM_REAL t275;
+  IGM_REAL t2756;
+  IGM_REAL t276;
+  IGM_REAL t2763;
+  IGM_REAL t2766;
+  IGM_REAL t277;
+  IGM_REAL t2771;
+  IGM_REAL t2774;
+  IGM_REAL t2776;
+  IGM_REAL t2779;
+  IGM_REAL t2788;
+  IGM_REAL t2791;
+  IGM_REAL t28;
+  IGM_REAL t280;
+  IGM_REAL t2800;
+  IGM_REAL t2803;
+  IGM_REAL t2806;
+  IGM_REAL t2809;
+  IGM_REAL t281;
+  IGM_REAL t2816;
+  IGM_REAL t282;
+  IGM_REAL t2821;
+  IGM_REAL t2826;
+  IGM_REAL t2829;
+  IGM_REAL t283;
+  IGM_REAL t2834;
+  IGM_REAL t284;
+  IGM_REAL t2858;
+  IGM_REAL t286;
+  IGM_REAL t287;
+  IGM_REAL t2883;
+  IGM_REAL t289;
+  IGM_REAL t29;
+  IGM_REAL t290;
+  IGM_REAL t2907;
+  IGM_REAL t292;
+  IGM_REAL t293;
+  IGM_REAL t2932;
+  IGM_REAL t294;
+  IGM_REAL t295;
+  IGM_REAL t296;
+  IGM_REAL t2964;
+  IGM_REAL t297;
+  IGM_REAL t2989;
+  IGM_REAL t299;
+  IGM_REAL t30;
+  IGM_REAL t300;
+  IGM_REAL t301;
+  IGM_REAL t3015;
+  IGM_REAL t302;
+  IGM_REAL t3023;
+  IGM_REAL t3031;
+  IGM_REAL t304;
+  IGM_REAL t305;
+  IGM_REAL t3052;
+  IGM_REAL t306;
+  IGM_REAL t3078;
+  IGM_REAL t308;
+  IGM_REAL t31;
+  IGM_REAL t310;
+  IGM_REAL t3103;
+  IGM_REAL t311;
+  IGM_REAL t3114;
+  IGM_REAL t312;
+  IGM_REAL t313;
+  IGM_REAL t3135;
+  IGM_REAL t314;
+  IGM_REAL t315;
+  IGM_REAL t316;
+  IGM_REAL t3160;
+  IGM_REAL t317;
+  IGM_REAL t318;
+  IGM_REAL t3186;
+  IGM_REAL t319;
+  IGM_REAL t32;
+  IGM_REAL t320;
+  IGM_REAL t321;
+  IGM_REAL t3211;
+  IGM_REAL t322;
+  IGM_REAL t323;
+  IGM_REAL t3237;
+  IGM_REAL t324;
+  IGM_REAL t325;
+  IGM_REAL t326;
+  IGM_REAL t3262;
+  IGM_REAL t327;
+  IGM_REAL t3270;
+  IGM_REAL t3277;
+  IGM_REAL t328;
+  IGM_REAL t3284;
+  IGM_REAL t3285;
+  IGM_REAL t3288;
+  IGM_REAL t329;
+  IGM_REAL t3291;
+  IGM_REAL t3292;
+  IGM_REAL t3295;
+  IGM_REAL t3296;
+  IGM_REAL t3299;
+  IGM_REAL t33;
+  IGM_REAL t330;
+  IGM_REAL t3300;
+  IGM_REAL t3303;
+  IGM_REAL t3304;
+  IGM_REAL t3307;
+  IGM_REAL t3312;
+  IGM_REAL t3315;
+  IGM_REAL t3318;
+  IGM_REAL t332;
+  IGM_REAL t3321;
+  IGM_REAL t333;
+  IGM_REAL t334;
+  IGM_REAL t3349;
+  IGM_REAL t335;
+  IGM_REAL t336;
+  IGM_REAL t3363;
+  IGM_REAL t337;
+  IGM_REAL t3378;
+  IGM_REAL t338;
+  IGM_REAL t339;
+  IGM_REAL t3392;
+  IGM_REAL t34;
+  IGM_REAL t3408;
+  IGM_REAL t341;
+  IGM_REAL t3422;
+  IGM_REAL t3437;
+  IGM_REAL t345;
+  IGM_REAL t3452;
+  IGM_REAL t346;
+  IGM_REAL t3468;
+  IGM_REAL t347;
+  IGM_REAL t348;
+  IGM_REAL t3482;
+  IGM_REAL t349;
+  IGM_REAL t3497;
+  IGM_REAL t350;
+  IGM_REAL t351;
+  IGM_REAL t3511;
+  IGM_REAL t3527;
+  IGM_REAL t354;
+  IGM_REAL t3541;
+  IGM_REAL t355;
+  IGM_REAL t3556;
+  IGM_REAL t356;
+  IGM_REAL t357;
+  IGM_REAL t3571;
+  IGM_REAL t358;
+  IGM_REAL t3587;
+  IGM_REAL t359;
+  IGM_REAL t36;
+  IGM_REAL t360;
+  IGM_REAL t3601;
+  IGM_REAL t3616;
+  IGM_REAL t363;
+  IGM_REAL t3630;
+  IGM_REAL t364;
+  IGM_REAL t3646;
+  IGM_REAL t365;
+  IGM_REAL t366;
+  IGM_REAL t3660;
+  IGM_REAL t367;
+  IGM_REAL t3675;
+  IGM_REAL t368;
+  IGM_REAL t369;
+  IGM_REAL t3690;
+  IGM_REAL t372;
+  IGM_REAL t373;
+  IGM_REAL t374;
+  IGM_REAL t375;
+  IGM_REAL t376;
+  IGM_REAL t377;
+  IGM_REAL t378;
+  IGM_REAL t381;
+  IGM_REAL t382;
+  IGM_REAL t383;
+  IGM_REAL t384;
+  IGM_REAL t385;
+  IGM_REAL t386;
+  IGM_REAL t387;
+  IGM_REAL t390;
+  IGM_REAL t391;
+  IGM_REAL t392;
+  IGM_REAL t393;
+  IGM_REAL t394;
+  IGM_REAL t395;
+  IGM_REAL t396;
+  IGM_REAL t399;
+  IGM_REAL t4;
+  IGM_REAL t400;
+  IGM_REAL t401;
+  IGM_REAL t402;
+  IGM_REAL t403;
+  IGM_REAL t404;
+  IGM_REAL t405;
+  IGM_REAL t408;
+  IGM_REAL t409;
+  IGM_REAL t41;
+  IGM_REAL t410;
+  IGM_REAL t411;
+  IGM_REAL t412;
+  IGM_REAL t413;
+  IGM_REAL t414;
+  IGM_REAL t417;
+  IGM_REAL t418;
+  IGM_REAL t419;
+  IGM_REAL t42;
+  IGM_REAL t420;
+  IGM_REAL t421;
+  IGM_REAL t422;
+  IGM_REAL t423;
+  IGM_REAL t424;
+  IGM_REAL t425;
+  IGM_REAL t428;
+  IGM_REAL t429;
+  IGM_REAL t43;
+  IGM_REAL t430;
+  IGM_REAL t431;
+  IGM_REAL t432;
+  IGM_REAL t433;
+  IGM_REAL t434;
+  IGM_REAL t435;
+  IGM_REAL t436;
+  IGM_REAL t439;
+  IGM_REAL t44;
+  IGM_REAL t440;
+  IGM_REAL t441;
+  IGM_REAL t442;
+  IGM_REAL t443;
+  IGM_REAL t444;
+  IGM_REAL t445;
+  IGM_REAL t446;
+  IGM_REAL t447;
+  IGM_REAL t45;
+  IGM_REAL t450;
+  IGM_REAL t451;
+  IGM_REAL t452;
+  IGM_REAL t453;
+  IGM_REAL t454;
+  IGM_REAL t455;
+  IGM_REAL t456;
+  IGM_REAL t457;
+  IGM_REAL t458;
+  IGM_REAL t46;
+  IGM_REAL t461;
+  IGM_REAL t462;
+  IGM_REAL t463;
+  IGM_REAL t464;
+  IGM_REAL t465;
+  IGM_REAL t466;
+  IGM_REAL t467;
+  IGM_REAL t472;
+  IGM_REAL t473;
+  IGM_REAL t474;
+  IGM_REAL t475;
+  IGM_REAL t476;
+  IGM_REAL t477;
+  IGM_REAL t478;
+  IGM_REAL t48;
+  IGM_REAL t483;
+  IGM_REAL t484;
+  IGM_REAL t485;
+  IGM_REAL t486;
+  IGM_REAL t487;
+  IGM_REAL t488;
+  IGM_REAL t489;
+  IGM_REAL t494;
+  IGM_REAL t495;
+  IGM_REAL t496;
+  IGM_REAL t497;
+  IGM_REAL t498;
+  IGM_REAL t499;
+  IGM_REAL t5;
+  IGM_REAL t50;
+  IGM_REAL t500;
+  IGM_REAL t505;
+  IGM_REAL t506;
+  IGM_REAL t507;
+  IGM_REAL t508;
+  IGM_REAL t509;
+  IGM_REAL t51;
+  IGM_REAL t510;
+  IGM_REAL t511;
+  IGM_REAL t512;
+  IGM_REAL t513;
+  IGM_REAL t518;
+  IGM_REAL t519;
+  IGM_REAL t520;
+  IGM_REAL t521;
+  IGM_REAL t522;
+  IGM_REAL t523;
+  IGM_REAL t524;
+  IGM_REAL t525;
+  IGM_REAL t526;
+  IGM_REAL t53;
+  IGM_REAL t54;
+  IGM_REAL t55;
+  IGM_REAL t56;
+  IGM_REAL t57;
+  IGM_REAL t6;
+  IGM_REAL t60;
+  IGM_REAL t61;
+  IGM_REAL t62;
+  IGM_REAL t621;
+  IGM_REAL t623;
+  IGM_REAL t626;
+  IGM_REAL t63;
+  IGM_REAL t64;
+  IGM_REAL t66;
+  IGM_REAL t67;
+  IGM_REAL t678;
+  IGM_REAL t680;
+  IGM_REAL t682;
+  IGM_REAL t687;
+  IGM_REAL t69;
+  IGM_REAL t690;
+  IGM_REAL t693;
+  IGM_REAL t696;
+  IGM_REAL t699;
+  IGM_REAL t7;
+  IGM_REAL t70;
+  IGM_REAL t702;
+  IGM_REAL t705;
+  IGM_REAL t710;
+  IGM_REAL t715;
+  IGM_REAL t72;
+  IGM_REAL t73;
+  IGM_REAL t732;
+  IGM_REAL t734;
+  IGM_REAL t736;
+  IGM_REAL t74;
+  IGM_REAL t741;
+  IGM_REAL t744;
+  IGM_REAL t747;
+  IGM_REAL t75;
+  IGM_REAL t750;
+  IGM_REAL t753;
+  IGM_REAL t758;
+  IGM_REAL t76;
+  IGM_REAL t77;
+  IGM_REAL t771;
+  IGM_REAL t773;
+  IGM_REAL t776;
+  IGM_REAL t78;
+  IGM_REAL t79;
+  IGM_REAL t792;
+  IGM_REAL t793;
+  IGM_REAL t794;
+  IGM_REAL t795;
+  IGM_REAL t797;
+  IGM_REAL t798;
+  IGM_REAL t799;
+  IGM_REAL t8;
+  IGM_REAL t80;
+  IGM_REAL t800;
+  IGM_REAL t802;
+  IGM_REAL t803;
+  IGM_REAL t804;
+  IGM_REAL t806;
+  IGM_REAL t81;
+  IGM_REAL t810;
+  IGM_REAL t813;
+  IGM_REAL t817;
+  IGM_REAL t818;
+  IGM_REAL t819;
+  IGM_REAL t82;
+  IGM_REAL t820;
+  IGM_REAL t821;
+  IGM_REAL t822;
+  IGM_REAL t824;
+  IGM_REAL t825;
+  IGM_REAL t826;
+  IGM_REAL t827;
+  IGM_REAL t828;
+  IGM_REAL t829;
+  IGM_REAL t83;
+  IGM_REAL t831;
+  IGM_REAL t832;
+  IGM_REAL t833;
+  IGM_REAL t834;
+  IGM_REAL t835;
+  IGM_REAL t836;
+  IGM_REAL t837;
+  IGM_REAL t838;
+  IGM_REAL t839;
+  IGM_REAL t84;
+  IGM_REAL t840;
+  IGM_REAL t841;
+  IGM_REAL t842;
+  IGM_REAL t843;
+  IGM_REAL t844;
+  IGM_REAL t845;
+  IGM_REAL t846;
+  IGM_REAL t847;
+  IGM_REAL t848;
+  IGM_REAL t849;
+  IGM_REAL t85;
+  IGM_REAL t852;
+  IGM_REAL t855;
+  IGM_REAL t856;
+  IGM_REAL t857;
+  IGM_REAL t858;
+  IGM_REAL t859;
+  IGM_REAL t86;
+  IGM_REAL t860;
+  IGM_REAL t861;
+  IGM_REAL t865;
+  IGM_REAL t866;
+  IGM_REAL t867;
+  IGM_REAL t868;
+  IGM_REAL t869;
+  IGM_REAL t87;
+  IGM_REAL t870;
+  IGM_REAL t871;
+  IGM_REAL t872;
+  IGM_REAL t873;
+  IGM_REAL t874;
+  IGM_REAL t875;
+  IGM_REAL t876;
+  IGM_REAL t877;
+  IGM_REAL t88;
+  IGM_REAL t881;
+  IGM_REAL t882;
+  IGM_REAL t883;
+  IGM_REAL t884;
+  IGM_REAL t885;
+  IGM_REAL t886;
+  IGM_REAL t888;
+  IGM_REAL t889;
+  IGM_REAL t89;
+  IGM_REAL t890;
+  IGM_REAL t891;
+  IGM_REAL t892;
+  IGM_REAL t894;
+  IGM_REAL t895;
+  IGM_REAL t896;
+  IGM_REAL t897;
+  IGM_REAL t898;
+  IGM_REAL t899;
+  IGM_REAL t9;
+  IGM_REAL t90;
+  IGM_REAL t901;
+  IGM_REAL t902;
+  IGM_REAL t903;
+  IGM_REAL t904;
+  IGM_REAL t905;
+  IGM_REAL t906;
+  IGM_REAL t907;
+  IGM_REAL t908;
+  IGM_REAL t909;
+  IGM_REAL t91;
+  IGM_REAL t910;
+  IGM_REAL t911;
+  IGM_REAL t912;
+  IGM_REAL t913;
+  IGM_REAL t914;
+  IGM_REAL t915;
+  IGM_REAL t916;
+  IGM_REAL t917;
+  IGM_REAL t918;
+  IGM_REAL t919;
+  IGM_REAL t92;
+  IGM_REAL t920;
+  IGM_REAL t921;
+  IGM_REAL t922;
+  IGM_REAL t923;
+  IGM_REAL t924;
+  IGM_REAL t927;
+  IGM_REAL t928;
+  IGM_REAL t929;
+  IGM_REAL t93;
+  IGM_REAL t930;
+  IGM_REAL t931;
+  IGM_REAL t932;
+  IGM_REAL t933;
+  IGM_REAL t934;
+  IGM_REAL t935;
+  IGM_REAL t936;
+  IGM_REAL t937;
+  IGM_REAL t938;
+  IGM_REAL t939;
+  IGM_REAL t940;
+  IGM_REAL t941;
+  IGM_REAL t942;
+  IGM_REAL t943;
+  IGM_REAL t944;
+  IGM_REAL t945;
+  IGM_REAL t946;
+  IGM_REAL t947;
+  IGM_REAL t948;
+  IGM_REAL t949;
+  IGM_REAL t950;
+  IGM_REAL t953;
+  IGM_REAL t954;
+  IGM_REAL t955;
+  IGM_REAL t957;
+  IGM_REAL t958;
+  IGM_REAL t959;
+  IGM_REAL t960;
+  IGM_REAL t961;
+  IGM_REAL t962;
+  IGM_REAL t963;
+  IGM_REAL t964;
+  IGM_REAL t965;
+  IGM_REAL t966;
+  IGM_REAL t967;
+  IGM_REAL t968;
+  IGM_REAL t969;
+  IGM_REAL t970;
+  IGM_REAL t971;
+  IGM_REAL t972;
+  IGM_REAL t973;
+  IGM_REAL t976;
+  IGM_REAL t977;
+  IGM_REAL t978;
+  IGM_REAL t979;
+  IGM_REAL t98;
+  IGM_REAL t980;
+  IGM_REAL t981;
+  IGM_REAL t982;
+  IGM_REAL t985;
+  IGM_REAL t986;
+  IGM_REAL t987;
+  IGM_REAL t988;
+  IGM_REAL t989;
+  IGM_REAL t99;
+  IGM_REAL t990;
+  IGM_REAL t991;
+  IGM_REAL t994;
+  IGM_REAL t995;
+  IGM_REAL t996;
+  IGM_REAL t997;
+  IGM_REAL t998;
+  IGM_REAL t999;
+  {
+    t2 = RL[9];
+    t4 = IGM_COS_Q(11);
+    t5 = t2*t4;
+    t6 = RL[5];
+    t7 = IGM_SIN_Q(11);
+    t8 = t6*t7;
+    t9 = -t5-t8;
+    t11 = IGM_COS_Q(10);
+    t12 = t9*t11;
+    t13 = RL[1];
+    t14 = IGM_SIN_Q(10);
+    t15 = t13*t14;
+    t16 = t12+t15;
+    t18 = IGM_COS_Q(9);
+    t19 = t16*t18;
+    t20 = t9*t14;
+    t21 = t13*t11;
+    t22 = t20-t21;
+    t23 = IGM_SIN_Q(9);
+    t24 = t22*t23;
+    t25 = t19-t24;
+    t27 = IGM_SIN_Q(8);
+    t28 = t25*t27;
+    t29 = t16*t23;
+    t30 = t22*t18;
+    t31 = t29+t30;
+    t32 = IGM_COS_Q(8);
+    t33 = t31*t32;
+    t34 = -t28-t33;
+    t36 = IGM_SIN_Q(6);
+    t41 = IGM_CONST(sqrt(2.0));
+    t42 = (t25*t32-t31*t27)*t41;
+    t43 = t2*t7;
+    t44 = t6*t4;
+    t45 = -t43+t44;
+    t46 = t45*t41;
+    t48 = t42/2.0-t46/2.0;
+    t50 = IGM_SIN_Q(7);
+    t51 = t48*t50;
+    t53 = t42/2.0+t46/2.0;
+    t54 = IGM_COS_Q(7);
+    t55 = t53*t54;
+    t56 = t51+t55;
+    t57 = IGM_COS_Q(6);
+    t60 = (t34*t36+t56*t57)*t41;
+    t61 = t48*t54;
+    t62 = t53*t50;
+    t63 = -t61+t62;
+    t64 = t63*t41;
+    t66 = t60/2.0+t64/2.0;
+    t67 = t66*t41;
+    t69 = -t60/2.0+t64/2.0;
+    t70 = t69*t41;
+    t72 = t67/2.0-t70/2.0;
+    t73 = RL[10];
+    t74 = t73*t4;
+    t75 = RL[6];
+    t76 = t75*t7;
+    t77 = -t74-t76;
+    t78 = t77*t11;
+    t79 = RL[2];
+    t80 = t79*t14;
+    t81 = t78+t80;
+    t82 = t81*t18;
+    t83 = t77*t14;
+    t84 = t79*t11;
+    t85 = t83-t84;
+    t86 = t85*t23;
+    t87 = t82-t86;
+    t88 = t87*t27;
+    t89 = t81*t23;
+    t90 = t85*t18;
+    t91 = t89+t90;
+    t92 = t91*t32;
+    t93 = -t88-t92;
+    t98 = (t87*t32-t91*t27)*t41;
+    t99 = t73*t7;
+    t100 = t75*t4;
+    t101 = -t99+t100;
+    t102 = t101*t41;
+    t104 = t98/2.0-t102/2.0;
+    t105 = t104*t50;
+    t107 = t98/2.0+t102/2.0;
+    t108 = t107*t54;
+    t109 = t105+t108;
+    t112 = (t93*t36+t109*t57)*t41;
+    t113 = t104*t54;
+    t114 = t107*t50;
+    t115 = -t113+t114;
+    t116 = t115*t41;
+    t118 = t112/2.0+t116/2.0;
+    t119 = t118*t41;
+    t121 = -t112/2.0+t116/2.0;
+    t122 = t121*t41;
+    t124 = -t119/2.0+t122/2.0;
+    t126 = IGM_COS_Q(1);
+    t127 = t124*t126;
+    t128 = t93*t57;
+    t129 = t109*t36;
+    t130 = t128-t129;
+    t132 = IGM_SIN_Q(0);
+    t133 = t130*t132;
+    t135 = -t119/2.0-t122/2.0;
+    t136 = IGM_COS_Q(0);
+    t137 = t135*t136;
+    t138 = -t133+t137;
+    t139 = IGM_SIN_Q(1);
+    t140 = t138*t139;
+    t142 = (t127+t140)*t41;
+    t143 = t124*t139;
+    t144 = t138*t126;
+    t146 = (-t143+t144)*t41;
+    t148 = t142/2.0-t146/2.0;
+    t150 = IGM_COS_Q(2);
+    t151 = t148*t150;
+    t152 = t130*t136;
+    t153 = t135*t132;
+    t154 = t152+t153;
+    t155 = IGM_SIN_Q(2);
+    t156 = t154*t155;
+    t157 = t151+t156;
+    t159 = IGM_COS_Q(3);
+    t160 = t157*t159;
+    t161 = t148*t155;
+    t162 = t154*t150;
+    t163 = -t161+t162;
+    t164 = IGM_SIN_Q(3);
+    t165 = t163*t164;
+    t166 = t160+t165;
+    t168 = IGM_COS_Q(4);
+    t169 = t166*t168;
+    t170 = t157*t164;
+    t171 = t163*t159;
+    t172 = -t170+t171;
+    t173 = IGM_SIN_Q(4);
+    t174 = t172*t173;
+    t175 = t169+t174;
+    t177 = IGM_COS_Q(5);
+    t178 = t175*t177;
+    t179 = 0.4511E-1*t178;
+    t181 = t142/2.0+t146/2.0;
+    t182 = IGM_SIN_Q(5);
+    t183 = t181*t182;
+    t184 = 0.4511E-1*t183;
+    t185 = 0.10274*t160;
+    t186 = 0.10274*t165;
+    t187 = 0.1*t151;
+    t188 = 0.1*t156;
+    t189 = -t179-t184-t185-t186-t187-t188;
+    t191 = -t124;
+    t192 = -t72;
+    t193 = t192*t126;
+    t194 = t34*t57;
+    t195 = t56*t36;
+    t196 = t194-t195;
+    t197 = t196*t132;
+    t199 = -t67/2.0-t70/2.0;
+    t200 = t199*t136;
+    t201 = -t197+t200;
+    t202 = t201*t139;
+    t204 = (t193+t202)*t41;
+    t205 = t192*t139;
+    t206 = t201*t126;
+    t208 = (-t205+t206)*t41;
+    t210 = t204/2.0-t208/2.0;
+    t211 = t210*t150;
+    t212 = t196*t136;
+    t213 = t199*t132;
+    t214 = t212+t213;
+    t215 = t214*t155;
+    t216 = t211+t215;
+    t217 = t216*t159;
+    t218 = t210*t155;
+    t219 = t214*t150;
+    t220 = -t218+t219;
+    t221 = t220*t164;
+    t222 = t217+t221;
+    t223 = t222*t168;
+    t224 = t216*t164;
+    t225 = t220*t159;
+    t226 = -t224+t225;
+    t227 = t226*t173;
+    t228 = t223+t227;
+    t229 = t228*t177;
+    t230 = 0.4511E-1*t229;
+    t232 = t204/2.0+t208/2.0;
+    t233 = t232*t182;
+    t234 = 0.4511E-1*t233;
+    t235 = 0.10274*t217;
+    t236 = 0.10274*t221;
+    t237 = 0.1*t211;
+    t238 = 0.1*t215;
+    t239 = -t230-t234-t235-t236-t237-t238;
+    A[0] = t72*t189-t191*t239;
+    t241 = RL[8];
+    t242 = t241*t4;
+    t243 = RL[4];
+    t244 = t243*t7;
+    t245 = -t242-t244;
+    t246 = t245*t11;
+    t247 = RL[0];
+    t248 = t247*t14;
+    t249 = t246+t248;
+    t250 = t249*t18;
+    t251 = t245*t14;
+    t252 = t247*t11;
+    t253 = t251-t252;
+    t254 = t253*t23;
+    t255 = t250-t254;
+    t256 = t255*t27;
+    t257 = t249*t23;
+    t258 = t253*t18;
+    t259 = t257+t258;
+    t260 = t259*t32;
+    t261 = -t256-t260;
+    t266 = (t255*t32-t259*t27)*t41;
+    t267 = t241*t7;
+    t268 = t243*t4;
+    t269 = -t267+t268;
+    t270 = t269*t41;
+    t272 = t266/2.0-t270/2.0;
+    t273 = t272*t50;
+    t275 = t266/2.0+t270/2.0;
+    t276 = t275*t54;
+    t277 = t273+t276;
+    t280 = (t261*t36+t277*t57)*t41;
+    t281 = t272*t54;
+    t282 = t275*t50;
+    t283 = -t281+t282;
+    t284 = t283*t41;
+    t286 = t280/2.0+t284/2.0;
+    t287 = t286*t41;
+    t289 = -t280/2.0+t284/2.0;
+    t290 = t289*t41;
+    t292 = -t287/2.0+t290/2.0;
+    t293 = t292*t126;
+    t294 = t261*t57;
+    t295 = t277*t36;
+    t296 = t294-t295;
+    t297 = t296*t132;
+    t299 = -t287/2.0-t290/2.0;
+    t300 = t299*t136;
+    t301 = -t297+t300;
+    t302 = t301*t139;
+    t304 = (t293+t302)*t41;
+    t305 = t292*t139;
+    t306 = t301*t126;
+    t308 = (-t305+t306)*t41;
+    t310 = t304/2.0-t308/2.0;
+    t311 = t310*t150;
+    t312 = t296*t136;
+    t313 = t299*t132;
+    t314 = t312+t313;
+    t315 = t314*t155;
+    t316 = t311+t315;
+    t317 = t316*t159;
+    t318 = t310*t155;
+    t319 = t314*t150;
+    t320 = -t318+t319;
+    t321 = t320*t164;
+    t322 = t317+t321;
+    t323 = t322*t168;
+    t324 = t316*t164;
+    t325 = t320*t159;
+    t326 = -t324+t325;
+    t327 = t326*t173;
+    t328 = t323+t327;
+    t329 = t328*t177;
+    t330 = 0.4511E-1*t329;
+    t332 = t304/2.0+t308/2.0;
+    t333 = t332*t182;
+    t334 = 0.4511E-1*t333;
+    t335 = 0.10274*t317;
+    t336 = 0.10274*t321;
+    t337 = 0.1*t311;
+    t338 = 0.1*t315;
+    t339 = -t330-t334-t335-t336-t337-t338;
+    t341 = -t292;
+    A[1] = t191*t339-t341*t189;
+    A[2] = t341*t239-t72*t339;
+    A[3] = t341;
+    A[4] = t72;
+    A[5] = t191;
+    t345 = 0.717E-2*t152;
+    t346 = 0.717E-2*t153;
+    t347 = 0.10733880938412E-1*t133;
+    t348 = 0.10733880938412E-1*t137;
+    t349 = 0.1376029796E-1*t119;
+    t350 = 0.1376029796E-1*t122;
+    t351 = -t345-t346+t347-t348-t349+t350;
+    t354 = 0.717E-2*t212;
+    t355 = 0.717E-2*t213;
+    t356 = 0.10733880938412E-1*t197;
+    t357 = 0.10733880938412E-1*t200;
+    t358 = 0.1376029796E-1*t67;
+    t359 = 0.1376029796E-1*t70;
+    t360 = -t354-t355+t356-t357-t358+t359;
+    t363 = 0.356381817718E-2*t127;
+    t364 = 0.356381817718E-2*t140;
+    t365 = 0.3153696244092E-2*t143;
+    t366 = 0.3153696244092E-2*t144;
+    t367 = 0.1649E-1*t152;
+    t368 = 0.1649E-1*t153;
+    t369 = -t363-t364-t365+t366-t367-t368;
+    t372 = 0.356381817718E-2*t193;
+    t373 = 0.356381817718E-2*t202;
+    t374 = 0.3153696244092E-2*t205;
+    t375 = 0.3153696244092E-2*t206;
+    t376 = 0.1649E-1*t212;
+    t377 = 0.1649E-1*t213;
+    t378 = -t372-t373-t374+t375-t376-t377;
+    t381 = 0.5386E-1*t151;
+    t382 = 0.5386E-1*t156;
+    t383 = 0.131E-2*t161;
+    t384 = 0.131E-2*t162;
+    t385 = 0.1005E-2*t142;
+    t386 = 0.1005E-2*t146;
+    t387 = -t381-t382-t383+t384-t385-t386;
+    t390 = 0.5386E-1*t211;
+    t391 = 0.5386E-1*t215;
+    t392 = 0.131E-2*t218;
+    t393 = 0.131E-2*t219;
+    t394 = 0.1005E-2*t204;
+    t395 = 0.1005E-2*t208;
+    t396 = -t390-t391-t392+t393-t394-t395;
+    t399 = 0.4891E-1*t160;
+    t400 = 0.4891E-1*t165;
+    t401 = 0.471E-2*t170;
+    t402 = 0.471E-2*t171;
+    t403 = 0.105E-2*t142;
+    t404 = 0.105E-2*t146;
+    t405 = -t399-t400-t401+t402-t403-t404-t187-t188;
+    t408 = 0.4891E-1*t217;
+    t409 = 0.4891E-1*t221;
+    t410 = 0.471E-2*t224;
+    t411 = 0.471E-2*t225;
+    t412 = 0.105E-2*t204;
+    t413 = 0.105E-2*t208;
+    t414 = -t408-t409-t410+t411-t412-t413-t237-t238;
+    t417 = 0.14E-3*t142;
+    t418 = 0.14E-3*t146;
+    t419 = 0.638E-2*t174;
+    t420 = t172*t168;
+    t421 = 0.142E-2*t420;
+    t422 = t166*t173;
+    t423 = 0.142E-2*t422;
+    t424 = 0.638E-2*t169;
+    t425 = -t417-t418-t188-t186+t419+t421-t423-t187-t185+t424;
+    t428 = 0.14E-3*t204;
+    t429 = 0.14E-3*t208;
+    t430 = 0.638E-2*t227;
+    t431 = t226*t168;
+    t432 = 0.142E-2*t431;
+    t433 = t222*t173;
+    t434 = 0.142E-2*t433;
+    t435 = 0.638E-2*t223;
+    t436 = -t428-t429-t238-t236+t430+t432-t434-t237-t235+t435;
+    t439 = 0.2489E-1*t420;
+    t440 = 0.2489E-1*t422;
+    t441 = 0.3208E-1*t183;
+    t442 = t181*t177;
+    t443 = 0.33E-2*t442;
+    t444 = t175*t182;
+    t445 = 0.33E-2*t444;
+    t446 = 0.3208E-1*t178;
+    t447 = -t188-t186+t439-t440-t187-t185-t441-t443+t445-t446;
+    t450 = 0.2489E-1*t431;
+    t451 = 0.2489E-1*t433;
+    t452 = 0.3208E-1*t233;
+    t453 = t232*t177;
+    t454 = 0.33E-2*t453;
+    t455 = t228*t182;
+    t456 = 0.33E-2*t455;
+    t457 = 0.3208E-1*t229;
+    t458 = -t238-t236+t450-t451-t237-t235-t452-t454+t456-t457;
+    A[6] = 0.1497956955E-1*A[4]*t351-0.1497956955E-1*A[5]*t360+0.2797813032E-1*
+A[4]*t369-0.2797813032E-1*A[5]*t378+0.8229664675E-1*A[4]*t387-0.8229664675E-1*A
+[5]*t396+0.6142781518E-1*A[4]*t405-0.6142781518E-1*A[5]*t414+0.2872669523E-1*A
+[4]*t425-0.2872669523E-1*A[5]*t436+0.3371437079E-1*A[4]*t447-0.3371437079E-1*A
+[5]*t458;
+    t461 = 0.717E-2*t312;
+    t462 = 0.717E-2*t313;
+    t463 = 0.10733880938412E-1*t297;
+    t464 = 0.10733880938412E-1*t300;
+    t465 = 0.1376029796E-1*t287;
+    t466 = 0.1376029796E-1*t290;
+    t467 = -t461-t462+t463-t464-t465+t466;
+    t472 = 0.356381817718E-2*t293;
+    t473 = 0.356381817718E-2*t302;
+    t474 = 0.3153696244092E-2*t305;
+    t475 = 0.3153696244092E-2*t306;
+    t476 = 0.1649E-1*t312;
+    t477 = 0.1649E-1*t313;
+    t478 = -t472-t473-t474+t475-t476-t477;
+    t483 = 0.5386E-1*t311;
+    t484 = 0.5386E-1*t315;
+    t485 = 0.131E-2*t318;
+    t486 = 0.131E-2*t319;
+    t487 = 0.1005E-2*t304;
+    t488 = 0.1005E-2*t308;
+    t489 = -t483-t484-t485+t486-t487-t488;
+    t494 = 0.4891E-1*t317;
+    t495 = 0.4891E-1*t321;
+    t496 = 0.471E-2*t324;
+    t497 = 0.471E-2*t325;
+    t498 = 0.105E-2*t304;
+    t499 = 0.105E-2*t308;
+    t500 = -t494-t495-t496+t497-t498-t499-t337-t338;
+    t505 = 0.14E-3*t304;
+    t506 = 0.14E-3*t308;
+    t507 = 0.638E-2*t323;
+    t508 = 0.638E-2*t327;
+    t509 = t326*t168;
+    t510 = 0.142E-2*t509;
+    t511 = t322*t173;
+    t512 = 0.142E-2*t511;
+    t513 = -t505-t506-t337-t338-t335-t336+t507+t508+t510-t512;
+    t518 = 0.2489E-1*t509;
+    t519 = 0.2489E-1*t511;
+    t520 = 0.3208E-1*t329;
+    t521 = 0.3208E-1*t333;
+    t522 = t332*t177;
+    t523 = 0.33E-2*t522;
+    t524 = t328*t182;
+    t525 = 0.33E-2*t524;
+    t526 = -t337-t338-t335-t336+t518-t519-t520-t521-t523+t525;
+    A[7] = 0.1497956955E-1*A[5]*t467-0.1497956955E-1*A[3]*t351+0.2797813032E-1*
+A[5]*t478-0.2797813032E-1*A[3]*t369+0.8229664675E-1*A[5]*t489-0.8229664675E-1*A
+[3]*t387+0.6142781518E-1*A[5]*t500-0.6142781518E-1*A[3]*t405+0.2872669523E-1*A
+[5]*t513-0.2872669523E-1*A[3]*t425+0.3371437079E-1*A[5]*t526-0.3371437079E-1*A
+[3]*t447;
+    A[8] = 0.1497956955E-1*A[3]*t360-0.1497956955E-1*A[4]*t467+0.2797813032E-1*
+A[3]*t378-0.2797813032E-1*A[4]*t478+0.8229664675E-1*A[3]*t396-0.8229664675E-1*A
+[4]*t489+0.6142781518E-1*A[3]*t414-0.6142781518E-1*A[4]*t500+0.2872669523E-1*A
+[3]*t436-0.2872669523E-1*A[4]*t513+0.3371437079E-1*A[3]*t458-0.3371437079E-1*A
+[4]*t526;
+    A[9] = IGM_CONST(1.0);
+    A[10] = t214*t189-t154*t239;
+    A[11] = t154*t339-t314*t189;
+    A[12] = t314*t239-t214*t339;
+    A[13] = t314;
+    A[14] = t214;
+    A[15] = t154;
+    A[16] = 0.2797813032E-1*A[14]*t369-0.2797813032E-1*A[15]*t378+
+0.8229664675E-1*A[14]*t387-0.8229664675E-1*A[15]*t396+0.6142781518E-1*A[14]*
+t405-0.6142781518E-1*A[15]*t414+0.2872669523E-1*A[14]*t425-0.2872669523E-1*A
+[15]*t436+0.3371437079E-1*A[14]*t447-0.3371437079E-1*A[15]*t458;
+    A[17] = 0.2797813032E-1*A[15]*t478-0.2797813032E-1*A[13]*t369+
+0.8229664675E-1*A[15]*t489-0.8229664675E-1*A[13]*t387+0.6142781518E-1*A[15]*
+t500-0.6142781518E-1*A[13]*t405+0.2872669523E-1*A[15]*t513-0.2872669523E-1*A
+[13]*t425+0.3371437079E-1*A[15]*t526-0.3371437079E-1*A[13]*t447;
+    A[18] = 0.2797813032E-1*A[13]*t378-0.2797813032E-1*A[14]*t478+
+0.8229664675E-1*A[13]*t396-0.8229664675E-1*A[14]*t489+0.6142781518E-1*A[13]*
+t414-0.6142781518E-1*A[14]*t500+0.2872669523E-1*A[13]*t436-0.2872669523E-1*A
+[14]*t513+0.3371437079E-1*A[13]*t458-0.3371437079E-1*A[14]*t526;
+    A[19] = IGM_CONST(0.0);
+    t621 = -t232;
+    t623 = -t181;
+    A[20] = t621*t189-t623*t239;
+    t626 = -t332;
+    A[21] = t623*t339-t626*t189;
+    A[22] = t626*t239-t621*t339;
+    A[23] = t626;
+    A[24] = t621;
+    A[25] = t623;
+    A[26] = 0.8229664675E-1*A[24]*t387-0.8229664675E-1*A[25]*t396+
+0.6142781518E-1*A[24]*t405-0.6142781518E-1*A[25]*t414+0.2872669523E-1*A[24]*
+t425-0.2872669523E-1*A[25]*t436+0.3371437079E-1*A[24]*t447-0.3371437079E-1*A
+[25]*t458;
+    A[27] = 0.8229664675E-1*A[25]*t489-0.8229664675E-1*A[23]*t387+
+0.6142781518E-1*A[25]*t500-0.6142781518E-1*A[23]*t405+0.2872669523E-1*A[25]*
+t513-0.2872669523E-1*A[23]*t425+0.3371437079E-1*A[25]*t526-0.3371437079E-1*A
+[23]*t447;
+    A[28] = 0.8229664675E-1*A[23]*t396-0.8229664675E-1*A[24]*t489+
+0.6142781518E-1*A[23]*t414-0.6142781518E-1*A[24]*t500+0.2872669523E-1*A[23]*
+t436-0.2872669523E-1*A[24]*t513+0.3371437079E-1*A[23]*t458-0.3371437079E-1*A
+[24]*t526;
+    A[29] = IGM_CONST(0.0);
+    t678 = -t179-t184-t185-t186;
+    t680 = -t230-t234-t235-t236;
+    A[30] = A[24]*t678-A[25]*t680;
+    t682 = -t330-t334-t335-t336;
+    A[31] = A[25]*t682-A[23]*t678;
+    A[32] = A[23]*t680-A[24]*t682;
+    A[33] = A[23];
+    A[34] = A[24];
+    A[35] = A[25];
+    t687 = -t403-t404-t400+t402-t401-t399;
+    t690 = -t412-t413-t409+t411-t410-t408;
+    t693 = -t417-t418-t186+t419+t421-t423-t185+t424;
+    t696 = -t428-t429-t236+t430+t432-t434-t235+t435;
+    t699 = -t186+t439-t440-t185-t441-t443+t445-t446;
+    t702 = -t236+t450-t451-t235-t452-t454+t456-t457;
+    A[36] = 0.6142781518E-1*A[34]*t687-0.6142781518E-1*A[35]*t690+
+0.2872669523E-1*A[34]*t693-0.2872669523E-1*A[35]*t696+0.3371437079E-1*A[34]*
+t699-0.3371437079E-1*A[35]*t702;
+    t705 = -t498-t499-t494-t495+t497-t496;
+    t710 = -t505-t506-t335-t336+t507+t508+t510-t512;
+    t715 = -t335-t336+t518-t519-t520-t521-t523+t525;
+    A[37] = 0.6142781518E-1*A[35]*t705-0.6142781518E-1*A[33]*t687+
+0.2872669523E-1*A[35]*t710-0.2872669523E-1*A[33]*t693+0.3371437079E-1*A[35]*
+t715-0.3371437079E-1*A[33]*t699;
+    A[38] = 0.6142781518E-1*A[33]*t690-0.6142781518E-1*A[34]*t705+
+0.2872669523E-1*A[33]*t696-0.2872669523E-1*A[34]*t710+0.3371437079E-1*A[33]*
+t702-0.3371437079E-1*A[34]*t715;
+    A[39] = IGM_CONST(0.0);
+    t732 = -t179-t184;
+    t734 = -t230-t234;
+    A[40] = A[34]*t732-A[35]*t734;
+    t736 = -t330-t334;
+    A[41] = A[35]*t736-A[33]*t732;
+    A[42] = A[33]*t734-A[34]*t736;
+    A[43] = A[33];
+    A[44] = A[34];
+    A[45] = A[35];
+    t741 = -t417-t418+t419+t421-t423+t424;
+    t744 = -t428-t429+t430+t432-t434+t435;
+    t747 = t439-t440-t441-t443+t445-t446;
+    t750 = t450-t451-t452-t454+t456-t457;
+    A[46] = 0.2872669523E-1*A[44]*t741-0.2872669523E-1*A[45]*t744+
+0.3371437079E-1*A[44]*t747-0.3371437079E-1*A[45]*t750;
+    t753 = -t505-t506+t507+t508+t510-t512;
+    t758 = t518-t519-t520-t521-t523+t525;
+    A[47] = 0.2872669523E-1*A[45]*t753-0.2872669523E-1*A[43]*t741+
+0.3371437079E-1*A[45]*t758-0.3371437079E-1*A[43]*t747;
+    A[48] = 0.2872669523E-1*A[43]*t744-0.2872669523E-1*A[44]*t753+
+0.3371437079E-1*A[43]*t750-0.3371437079E-1*A[44]*t758;
+    A[49] = IGM_CONST(0.0);
+    t771 = -t433+t431;
+    t773 = -t422+t420;
+    A[50] = t771*t732-t773*t734;
+    t776 = -t511+t509;
+    A[51] = t773*t736-t776*t732;
+    A[52] = t776*t734-t771*t736;
+    A[53] = t776;
+    A[54] = t771;
+    A[55] = t773;
+    A[56] = 0.3371437079E-1*A[54]*t747-0.3371437079E-1*A[55]*t750;
+    A[57] = 0.3371437079E-1*A[55]*t758-0.3371437079E-1*A[53]*t747;
+    A[58] = 0.3371437079E-1*A[53]*t750-0.3371437079E-1*A[54]*t758;
+    A[59] = IGM_CONST(0.0);
+    t792 = -t63;
+    t793 = 0.5E-1*t112;
+    t794 = 0.5E-1*t116;
+    t795 = -t179-t184-t185-t186-t187-t188+t793+t794;
+    t797 = -t115;
+    t798 = 0.5E-1*t60;
+    t799 = 0.5E-1*t64;
+    t800 = -t230-t234-t235-t236-t237-t238+t798+t799;
+    A[60] = t792*t795-t797*t800;
+    t802 = 0.5E-1*t280;
+    t803 = 0.5E-1*t284;
+    t804 = -t330-t334-t335-t336-t337-t338+t802+t803;
+    t806 = -t283;
+    A[61] = t797*t804-t806*t795;
+    A[62] = t806*t800-t792*t804;
+    A[63] = t806;
+    A[64] = t792;
+    A[65] = t797;
+    t810 = -t372-t373-t374+t375-t376-t377+t798+t799;
+    t813 = t424+t419-t423+t421-t417-t418-t185-t186-t187-t188+t793+t794;
+    t817 = IGM_SIN_Q(17);
+    t818 = t130*t817;
+    t819 = -t121;
+    t820 = IGM_COS_Q(17);
+    t821 = t819*t820;
+    t822 = -t818+t821;
+    t824 = IGM_COS_Q(19);
+    t825 = t822*t824;
+    t826 = 0.2E-3*t825;
+    t827 = t130*t820;
+    t828 = t819*t817;
+    t829 = t827+t828;
+    t831 = IGM_SIN_Q(18);
+    t832 = t829*t831;
+    t833 = IGM_COS_Q(18);
+    t834 = t118*t833;
+    t835 = -t832+t834;
+    t836 = IGM_SIN_Q(19);
+    t837 = t835*t836;
+    t838 = 0.2E-3*t837;
+    t839 = t822*t836;
+    t840 = 0.1E-4*t839;
+    t841 = t835*t824;
+    t842 = 0.1E-4*t841;
+    t843 = t829*t833;
+    t844 = 0.6427E-1*t843;
+    t845 = t118*t831;
+    t846 = 0.6427E-1*t845;
+    t847 = 0.1165*t112;
+    t848 = 0.685E-1*t116;
+    t849 = t826+t838-t840+t842+t844+t846-t847+t848;
+    t852 = -t408-t409-t410+t411-t412-t413-t237-t238+t798+t799;
+    t855 = 0.2067E-1*t843;
+    t856 = 0.2067E-1*t845;
+    t857 = 0.338E-2*t832;
+    t858 = 0.338E-2*t834;
+    t859 = 0.362E-2*t818;
+    t860 = 0.362E-2*t821;
+    t861 = t855+t856+t857-t858+t859-t860-t847+t848;
+    t865 = IGM_COS_Q(22);
+    t866 = t196*t865;
+    t867 = 0.3E-4*t866;
+    t868 = IGM_SIN_Q(22);
+    t869 = t66*t868;
+    t870 = 0.3E-4*t869;
+    t871 = t196*t868;
+    t872 = 0.18E-3*t871;
+    t873 = t66*t865;
+    t874 = 0.18E-3*t873;
+    t875 = 0.67885E-1*t60;
+    t876 = 0.117885*t64;
+    t877 = -t867-t870-t872+t874-t875+t876;
+    t881 = IGM_COS_Q(12);
+    t882 = t196*t881;
+    t883 = -t69;
+    t884 = IGM_SIN_Q(12);
+    t885 = t883*t884;
+    t886 = t882+t885;
+    t888 = IGM_COS_Q(13);
+    t889 = t886*t888;
+    t890 = IGM_SIN_Q(13);
+    t891 = t66*t890;
+    t892 = t889+t891;
+    t894 = IGM_COS_Q(15);
+    t895 = t892*t894;
+    t896 = 0.194E-1*t895;
+    t897 = t196*t884;
+    t898 = t883*t881;
+    t899 = -t897+t898;
+    t901 = IGM_SIN_Q(14);
+    t902 = t899*t901;
+    t903 = t886*t890;
+    t904 = t66*t888;
+    t905 = -t903+t904;
+    t906 = IGM_COS_Q(14);
+    t907 = t905*t906;
+    t908 = -t902+t907;
+    t909 = IGM_SIN_Q(15);
+    t910 = t908*t909;
+    t911 = 0.194E-1*t910;
+    t912 = t892*t909;
+    t913 = 0.304E-2*t912;
+    t914 = t908*t894;
+    t915 = 0.304E-2*t914;
+    t916 = t899*t906;
+    t917 = 0.25E-2*t916;
+    t918 = t905*t901;
+    t919 = 0.25E-2*t918;
+    t920 = 0.9E-1*t889;
+    t921 = 0.9E-1*t891;
+    t922 = 0.185E-1*t60;
+    t923 = 0.1665*t64;
+    t924 = t896+t911-t913+t915-t917-t919+t920+t921-t922+t923;
+    t927 = t196*t817;
+    t928 = t883*t820;
+    t929 = -t927+t928;
+    t930 = t929*t824;
+    t931 = 0.2E-3*t930;
+    t932 = t196*t820;
+    t933 = t883*t817;
+    t934 = t932+t933;
+    t935 = t934*t831;
+    t936 = t66*t833;
+    t937 = -t935+t936;
+    t938 = t937*t836;
+    t939 = 0.2E-3*t938;
+    t940 = t929*t836;
+    t941 = 0.1E-4*t940;
+    t942 = t937*t824;
+    t943 = 0.1E-4*t942;
+    t944 = t934*t833;
+    t945 = 0.6427E-1*t944;
+    t946 = t66*t831;
+    t947 = 0.6427E-1*t946;
+    t948 = 0.1165*t60;
+    t949 = 0.685E-1*t64;
+    t950 = t931+t939-t941+t943+t945+t947-t948+t949;
+    t953 = t130*t865;
+    t954 = t118*t868;
+    t955 = t953+t954;
+    t957 = IGM_COS_Q(23);
+    t958 = t955*t957;
+    t959 = 0.383E-2*t958;
+    t960 = IGM_SIN_Q(23);
+    t961 = t819*t960;
+    t962 = 0.383E-2*t961;
+    t963 = t955*t960;
+    t964 = 0.5156E-1*t963;
+    t965 = t819*t957;
+    t966 = 0.5156E-1*t965;
+    t967 = t130*t868;
+    t968 = 0.93E-3*t967;
+    t969 = t118*t865;
+    t970 = 0.93E-3*t969;
+    t971 = 0.8075E-1*t112;
+    t972 = 0.13075*t116;
+    t973 = t959+t962+t964-t966+t968-t970-t971+t972;
+    t976 = 0.178E-2*t932;
+    t977 = 0.178E-2*t933;
+    t978 = 0.19E-3*t927;
+    t979 = 0.19E-3*t928;
+    t980 = 0.103965*t60;
+    t981 = 0.81035E-1*t64;
+    t982 = -t976-t977+t978-t979-t980+t981;
+    t985 = 0.2067E-1*t944;
+    t986 = 0.2067E-1*t946;
+    t987 = 0.338E-2*t935;
+    t988 = 0.338E-2*t936;
+    t989 = 0.362E-2*t927;
+    t990 = 0.362E-2*t928;
+    t991 = t985+t986+t987-t988+t989-t990-t948+t949;
+    t994 = t130*t881;
+    t995 = t819*t884;
+    t996 = t994+t995;
+    t997 = t996*t888;
+    t998 = 0.2067E-1*t997;
+    t999 = t118*t890;
+    t1000 = 0.2067E-1*t999;
+    t1001 = t996*t890;
+    t1002 = 0.388E-2*t1001;
+    t1003 = t118*t888;
+    t1004 = 0.388E-2*t1003;
+    t1005 = t130*t884;
+    t1006 = 0.362E-2*t1005;
+    t1007 = t819*t881;
+    t1008 = 0.362E-2*t1007;
+    t1009 = 0.185E-1*t112;
+    t1010 = 0.1665*t116;
+    t1011 = t998+t1000-t1002+t1004+t1006-t1008-t1009+t1010;
+    t1014 = t843+t845;
+    t1016 = IGM_COS_Q(20);
+    t1017 = t1014*t1016;
+    t1018 = 0.194E-1*t1017;
+    t1019 = -t839+t841;
+    t1020 = IGM_SIN_Q(20);
+    t1021 = t1019*t1020;
+    t1022 = 0.194E-1*t1021;
+    t1023 = t1014*t1020;
+    t1024 = 0.304E-2*t1023;
+    t1025 = t1019*t1016;
+    t1026 = 0.304E-2*t1025;
+    t1027 = 0.25E-2*t825;
+    t1028 = 0.25E-2*t837;
+    t1029 = 0.9E-1*t843;
+    t1030 = 0.9E-1*t845;
+    t1031 = t1018+t1022+t1024-t1026-t1027-t1028+t1029+t1030-t847+t848;
+    t1034 = -t345-t346+t347-t348-t349+t350+t793+t794;
+    t1037 = -t363-t364-t365+t366-t367-t368+t793+t794;
+    t1040 = 0.178E-2*t882;
+    t1041 = 0.178E-2*t885;
+    t1042 = 0.19E-3*t897;
+    t1043 = 0.19E-3*t898;
+    t1044 = 0.31035E-1*t60;
+    t1045 = 0.153965*t64;
+    t1046 = -t1040-t1041+t1042-t1043-t1044+t1045;
+    t1049 = -t1005+t1007;
+    t1050 = t1049*t906;
+    t1051 = 0.2E-3*t1050;
+    t1052 = -t1001+t1003;
+    t1053 = t1052*t901;
+    t1054 = 0.2E-3*t1053;
+    t1055 = t1049*t901;
+    t1056 = 0.1E-4*t1055;
+    t1057 = t1052*t906;
+    t1058 = 0.1E-4*t1057;
+    t1059 = 0.6427E-1*t997;
+    t1060 = 0.6427E-1*t999;
+    t1061 = t1051+t1054+t1056-t1058+t1059+t1060-t1009+t1010;
+    t1064 = -t399-t400-t401+t402-t403-t404-t187-t188+t793+t794;
+    t1067 = -t354-t355+t356-t357-t358+t359+t798+t799;
+    t1070 = -0.2797813032E-1*A[65]*t810+0.2872669523E-1*A[64]*t813+
+0.1232237092E-1*A[64]*t849-0.6142781518E-1*A[65]*t852+0.2515757084E-1*A[64]*
+t861-0.1232237092E-1*A[65]*t877-0.7795827887E-2*A[65]*t924-0.1232237092E-1*A
+[65]*t950+0.9857689952E-1*A[64]*t973-0.1444192625E-1*A[65]*t982-0.2515757084E-1
+*A[65]*t991+0.2515757084E-1*A[64]*t1011+0.7795827887E-2*A[64]*t1031+
+0.1497956955E-1*A[64]*t1034+0.2797813032E-1*A[64]*t1037-0.1444192625E-1*A[65]*
+t1046+0.1232237092E-1*A[64]*t1061+0.6142781518E-1*A[64]*t1064-0.1497956955E-1*A
+[65]*t1067;
+    t1071 = t916+t918;
+    t1073 = IGM_COS_Q(16);
+    t1074 = t1071*t1073;
+    t1075 = 0.272E-2*t1074;
+    t1076 = -t912+t914;
+    t1077 = IGM_SIN_Q(16);
+    t1078 = t1076*t1077;
+    t1079 = 0.272E-2*t1078;
+    t1080 = t1071*t1077;
+    t1081 = 0.268E-2*t1080;
+    t1082 = t1076*t1073;
+    t1083 = 0.268E-2*t1082;
+    t1084 = 0.8296E-1*t895;
+    t1085 = 0.8296E-1*t910;
+    t1086 = t1075+t1079-t1081+t1083+t1084+t1085+t920+t921-t922+t923;
+    t1089 = 0.178E-2*t827;
+    t1090 = 0.178E-2*t828;
+    t1091 = 0.19E-3*t818;
+    t1092 = 0.19E-3*t821;
+    t1093 = 0.103965*t112;
+    t1094 = 0.81035E-1*t116;
+    t1095 = -t1089-t1090+t1091-t1092-t1093+t1094;
+    t1098 = -t446-t441+t445-t443-t440+t439-t185-t186-t187-t188+t793+t794;
+    t1101 = -t457-t452+t456-t454-t451+t450-t235-t236-t237-t238+t798+t799;
+    t1104 = -t390-t391-t392+t393-t394-t395+t798+t799;
+    t1107 = t825+t837;
+    t1109 = IGM_COS_Q(21);
+    t1110 = t1107*t1109;
+    t1111 = 0.272E-2*t1110;
+    t1112 = -t1023+t1025;
+    t1113 = IGM_SIN_Q(21);
+    t1114 = t1112*t1113;
+    t1115 = 0.272E-2*t1114;
+    t1116 = t1107*t1113;
+    t1117 = 0.268E-2*t1116;
+    t1118 = t1112*t1109;
+    t1119 = 0.268E-2*t1118;
+    t1120 = 0.8296E-1*t1017;
+    t1121 = 0.8296E-1*t1021;
+    t1122 = t1111+t1115+t1117-t1119+t1120+t1121+t1029+t1030-t847+t848;
+    t1125 = t944+t946;
+    t1126 = t1125*t1016;
+    t1127 = 0.194E-1*t1126;
+    t1128 = -t940+t942;
+    t1129 = t1128*t1020;
+    t1130 = 0.194E-1*t1129;
+    t1131 = t1125*t1020;
+    t1132 = 0.304E-2*t1131;
+    t1133 = t1128*t1016;
+    t1134 = 0.304E-2*t1133;
+    t1135 = 0.25E-2*t930;
+    t1136 = 0.25E-2*t938;
+    t1137 = 0.9E-1*t944;
+    t1138 = 0.9E-1*t946;
+    t1139 = t1127+t1130+t1132-t1134-t1135-t1136+t1137+t1138-t948+t949;
+    t1142 = -t381-t382-t383+t384-t385-t386+t793+t794;
+    t1145 = t1050+t1053;
+    t1146 = t1145*t1073;
+    t1147 = 0.272E-2*t1146;
+    t1148 = t997+t999;
+    t1149 = t1148*t909;
+    t1150 = -t1055+t1057;
+    t1151 = t1150*t894;
+    t1152 = -t1149+t1151;
+    t1153 = t1152*t1077;
+    t1154 = 0.272E-2*t1153;
+    t1155 = t1145*t1077;
+    t1156 = 0.268E-2*t1155;
+    t1157 = t1152*t1073;
+    t1158 = 0.268E-2*t1157;
+    t1159 = t1148*t894;
+    t1160 = 0.8296E-1*t1159;
+    t1161 = t1150*t909;
+    t1162 = 0.8296E-1*t1161;
+    t1163 = 0.9E-1*t997;
+    t1164 = 0.9E-1*t999;
+    t1165 = t1147+t1154-t1156+t1158+t1160+t1162+t1163+t1164-t1009+t1010;
+    t1168 = 0.48E-2*t194;
+    t1169 = 0.48E-2*t195;
+    t1170 = 0.38605E-1*t60;
+    t1171 = 0.88665E-1*t64;
+    t1172 = -t1168+t1169-t1170+t1171;
+    t1175 = 0.2067E-1*t889;
+    t1176 = 0.2067E-1*t891;
+    t1177 = 0.388E-2*t903;
+    t1178 = 0.388E-2*t904;
+    t1179 = 0.362E-2*t897;
+    t1180 = 0.362E-2*t898;
+    t1181 = t1175+t1176-t1177+t1178+t1179-t1180-t922+t923;
+    t1184 = t435+t430-t434+t432-t428-t429-t235-t236-t237-t238+t798+t799;
+    t1187 = 0.178E-2*t994;
+    t1188 = 0.178E-2*t995;
+    t1189 = 0.19E-3*t1005;
+    t1190 = 0.19E-3*t1007;
+    t1191 = 0.31035E-1*t112;
+    t1192 = 0.153965*t116;
+    t1193 = -t1187-t1188+t1189-t1190-t1191+t1192;
+    t1196 = t930+t938;
+    t1197 = t1196*t1109;
+    t1198 = 0.272E-2*t1197;
+    t1199 = -t1131+t1133;
+    t1200 = t1199*t1113;
+    t1201 = 0.272E-2*t1200;
+    t1202 = t1196*t1113;
+    t1203 = 0.268E-2*t1202;
+    t1204 = t1199*t1109;
+    t1205 = 0.268E-2*t1204;
+    t1206 = 0.8296E-1*t1126;
+    t1207 = 0.8296E-1*t1129;
+    t1208 = t1198+t1201+t1203-t1205+t1206+t1207+t1137+t1138-t948+t949;
+    t1211 = t866+t869;
+    t1212 = t1211*t957;
+    t1213 = 0.383E-2*t1212;
+    t1214 = t883*t960;
+    t1215 = 0.383E-2*t1214;
+    t1216 = t1211*t960;
+    t1217 = 0.5156E-1*t1216;
+    t1218 = t883*t957;
+    t1219 = 0.5156E-1*t1218;
+    t1220 = 0.93E-3*t871;
+    t1221 = 0.93E-3*t873;
+    t1222 = 0.8075E-1*t60;
+    t1223 = 0.13075*t64;
+    t1224 = t1213+t1215+t1217-t1219+t1220-t1221-t1222+t1223;
+    t1227 = 0.194E-1*t1159;
+    t1228 = 0.194E-1*t1161;
+    t1229 = 0.304E-2*t1149;
+    t1230 = 0.304E-2*t1151;
+    t1231 = 0.25E-2*t1050;
+    t1232 = 0.25E-2*t1053;
+    t1233 = t1227+t1228-t1229+t1230-t1231-t1232+t1163+t1164-t1009+t1010;
+    t1236 = 0.2E-3*t916;
+    t1237 = 0.2E-3*t918;
+    t1238 = 0.1E-4*t902;
+    t1239 = 0.1E-4*t907;
+    t1240 = 0.6427E-1*t889;
+    t1241 = 0.6427E-1*t891;
+    t1242 = t1236+t1237+t1238-t1239+t1240+t1241-t922+t923;
+    t1245 = 0.3E-4*t953;
+    t1246 = 0.3E-4*t954;
+    t1247 = 0.18E-3*t967;
+    t1248 = 0.18E-3*t969;
+    t1249 = 0.67885E-1*t112;
+    t1250 = 0.117885*t116;
+    t1251 = -t1245-t1246-t1247+t1248-t1249+t1250;
+    t1254 = 0.48E-2*t128;
+    t1255 = 0.48E-2*t129;
+    t1256 = 0.38605E-1*t112;
+    t1257 = 0.88665E-1*t116;
+    t1258 = -t1254+t1255-t1256+t1257;
+    t1261 = -0.2959933166E-1*A[65]*t1086+0.1444192625E-1*A[64]*t1095+
+0.3371437079E-1*A[64]*t1098-0.3371437079E-1*A[65]*t1101-0.8229664675E-1*A[65]*
+t1104+0.2959933166E-1*A[64]*t1122-0.7795827887E-2*A[65]*t1139+0.8229664675E-1*A
+[64]*t1142+0.2959933166E-1*A[64]*t1165-0.2122202187*A[65]*t1172-0.2515757084E-1
+*A[65]*t1181-0.2872669523E-1*A[65]*t1184+0.1444192625E-1*A[64]*t1193
+-0.2959933166E-1*A[65]*t1208-0.9857689952E-1*A[65]*t1224+0.7795827887E-2*A[64]*
+t1233-0.1232237092E-1*A[65]*t1242+0.1232237092E-1*A[64]*t1251+0.2122202187*A
+[64]*t1258;
+    A[66] = t1070+t1261;
+    t1262 = -t494-t495-t496+t497-t498-t499-t337-t338+t802+t803;
+    t1277 = t507+t508-t512+t510-t505-t506-t335-t336-t337-t338+t802+t803;
+    t1280 = -t483-t484-t485+t486-t487-t488+t802+t803;
+    t1285 = -t472-t473-t474+t475-t476-t477+t802+t803;
+    t1290 = t296*t884;
+    t1291 = -t289;
+    t1292 = t1291*t881;
+    t1293 = -t1290+t1292;
+    t1294 = t1293*t906;
+    t1295 = t296*t881;
+    t1296 = t1291*t884;
+    t1297 = t1295+t1296;
+    t1298 = t1297*t890;
+    t1299 = t286*t888;
+    t1300 = -t1298+t1299;
+    t1301 = t1300*t901;
+    t1302 = t1294+t1301;
+    t1303 = t1302*t1073;
+    t1304 = 0.272E-2*t1303;
+    t1305 = t1297*t888;
+    t1306 = t286*t890;
+    t1307 = t1305+t1306;
+    t1308 = t1307*t909;
+    t1309 = t1293*t901;
+    t1310 = t1300*t906;
+    t1311 = -t1309+t1310;
+    t1312 = t1311*t894;
+    t1313 = -t1308+t1312;
+    t1314 = t1313*t1077;
+    t1315 = 0.272E-2*t1314;
+    t1316 = t1302*t1077;
+    t1317 = 0.268E-2*t1316;
+    t1318 = t1313*t1073;
+    t1319 = 0.268E-2*t1318;
+    t1320 = t1307*t894;
+    t1321 = 0.8296E-1*t1320;
+    t1322 = t1311*t909;
+    t1323 = 0.8296E-1*t1322;
+    t1324 = 0.9E-1*t1305;
+    t1325 = 0.9E-1*t1306;
+    t1326 = 0.185E-1*t280;
+    t1327 = 0.1665*t284;
+    t1328 = t1304+t1315-t1317+t1319+t1321+t1323+t1324+t1325-t1326+t1327;
+    t1331 = t296*t817;
+    t1332 = t1291*t820;
+    t1333 = -t1331+t1332;
+    t1334 = t1333*t824;
+    t1335 = 0.2E-3*t1334;
+    t1336 = t296*t820;
+    t1337 = t1291*t817;
+    t1338 = t1336+t1337;
+    t1339 = t1338*t831;
+    t1340 = t286*t833;
+    t1341 = -t1339+t1340;
+    t1342 = t1341*t836;
+    t1343 = 0.2E-3*t1342;
+    t1344 = t1333*t836;
+    t1345 = 0.1E-4*t1344;
+    t1346 = t1341*t824;
+    t1347 = 0.1E-4*t1346;
+    t1348 = t1338*t833;
+    t1349 = 0.6427E-1*t1348;
+    t1350 = t286*t831;
+    t1351 = 0.6427E-1*t1350;
+    t1352 = 0.1165*t280;
+    t1353 = 0.685E-1*t284;
+    t1354 = t1335+t1343-t1345+t1347+t1349+t1351-t1352+t1353;
+    t1359 = 0.178E-2*t1295;
+    t1360 = 0.178E-2*t1296;
+    t1361 = 0.19E-3*t1290;
+    t1362 = 0.19E-3*t1292;
+    t1363 = 0.31035E-1*t280;
+    t1364 = 0.153965*t284;
+    t1365 = -t1359-t1360+t1361-t1362-t1363+t1364;
+    t1368 = t1334+t1342;
+    t1369 = t1368*t1109;
+    t1370 = 0.272E-2*t1369;
+    t1371 = t1348+t1350;
+    t1372 = t1371*t1020;
+    t1373 = -t1344+t1346;
+    t1374 = t1373*t1016;
+    t1375 = -t1372+t1374;
+    t1376 = t1375*t1113;
+    t1377 = 0.272E-2*t1376;
+    t1378 = t1368*t1113;
+    t1379 = 0.268E-2*t1378;
+    t1380 = t1375*t1109;
+    t1381 = 0.268E-2*t1380;
+    t1382 = t1371*t1016;
+    t1383 = 0.8296E-1*t1382;
+    t1384 = t1373*t1020;
+    t1385 = 0.8296E-1*t1384;
+    t1386 = 0.9E-1*t1348;
+    t1387 = 0.9E-1*t1350;
+    t1388 = t1370+t1377+t1379-t1381+t1383+t1385+t1386+t1387-t1352+t1353;
+    t1391 = -t461-t462+t463-t464-t465+t466+t802+t803;
+    t1394 = 0.48E-2*t294;
+    t1395 = 0.48E-2*t295;
+    t1396 = 0.38605E-1*t280;
+    t1397 = 0.88665E-1*t284;
+    t1398 = -t1394+t1395-t1396+t1397;
+    t1401 = 0.6142781518E-1*A[65]*t1262-0.6142781518E-1*A[63]*t1064
+-0.2515757084E-1*A[63]*t1011-0.1444192625E-1*A[63]*t1095-0.2959933166E-1*A[63]*
+t1122-0.1444192625E-1*A[63]*t1193-0.2122202187*A[63]*t1258+0.2872669523E-1*A
+[65]*t1277+0.8229664675E-1*A[65]*t1280-0.2872669523E-1*A[63]*t813+
+0.2797813032E-1*A[65]*t1285-0.8229664675E-1*A[63]*t1142+0.2959933166E-1*A[65]*
+t1328+0.1232237092E-1*A[65]*t1354-0.7795827887E-2*A[63]*t1233+0.1444192625E-1*A
+[65]*t1365+0.2959933166E-1*A[65]*t1388+0.1497956955E-1*A[65]*t1391+0.2122202187
+*A[65]*t1398;
+    t1402 = 0.2067E-1*t1305;
+    t1403 = 0.2067E-1*t1306;
+    t1404 = 0.388E-2*t1298;
+    t1405 = 0.388E-2*t1299;
+    t1406 = 0.362E-2*t1290;
+    t1407 = 0.362E-2*t1292;
+    t1408 = t1402+t1403-t1404+t1405+t1406-t1407-t1326+t1327;
+    t1411 = 0.194E-1*t1382;
+    t1412 = 0.194E-1*t1384;
+    t1413 = 0.304E-2*t1372;
+    t1414 = 0.304E-2*t1374;
+    t1415 = 0.25E-2*t1334;
+    t1416 = 0.25E-2*t1342;
+    t1417 = t1411+t1412+t1413-t1414-t1415-t1416+t1386+t1387-t1352+t1353;
+    t1420 = 0.2E-3*t1294;
+    t1421 = 0.2E-3*t1301;
+    t1422 = 0.1E-4*t1309;
+    t1423 = 0.1E-4*t1310;
+    t1424 = 0.6427E-1*t1305;
+    t1425 = 0.6427E-1*t1306;
+    t1426 = t1420+t1421+t1422-t1423+t1424+t1425-t1326+t1327;
+    t1447 = 0.2067E-1*t1348;
+    t1448 = 0.2067E-1*t1350;
+    t1449 = 0.338E-2*t1339;
+    t1450 = 0.338E-2*t1340;
+    t1451 = 0.362E-2*t1331;
+    t1452 = 0.362E-2*t1332;
+    t1453 = t1447+t1448+t1449-t1450+t1451-t1452-t1352+t1353;
+    t1456 = 0.194E-1*t1320;
+    t1457 = 0.194E-1*t1322;
+    t1458 = 0.304E-2*t1308;
+    t1459 = 0.304E-2*t1312;
+    t1460 = 0.25E-2*t1294;
+    t1461 = 0.25E-2*t1301;
+    t1462 = t1456+t1457-t1458+t1459-t1460-t1461+t1324+t1325-t1326+t1327;
+    t1465 = -t520-t521+t525-t523-t519+t518-t335-t336-t337-t338+t802+t803;
+    t1468 = t296*t865;
+    t1469 = 0.3E-4*t1468;
+    t1470 = t286*t868;
+    t1471 = 0.3E-4*t1470;
+    t1472 = t296*t868;
+    t1473 = 0.18E-3*t1472;
+    t1474 = t286*t865;
+    t1475 = 0.18E-3*t1474;
+    t1476 = 0.67885E-1*t280;
+    t1477 = 0.117885*t284;
+    t1478 = -t1469-t1471-t1473+t1475-t1476+t1477;
+    t1481 = t1468+t1470;
+    t1482 = t1481*t957;
+    t1483 = 0.383E-2*t1482;
+    t1484 = t1291*t960;
+    t1485 = 0.383E-2*t1484;
+    t1486 = t1481*t960;
+    t1487 = 0.5156E-1*t1486;
+    t1488 = t1291*t957;
+    t1489 = 0.5156E-1*t1488;
+    t1490 = 0.93E-3*t1472;
+    t1491 = 0.93E-3*t1474;
+    t1492 = 0.8075E-1*t280;
+    t1493 = 0.13075*t284;
+    t1494 = t1483+t1485+t1487-t1489+t1490-t1491-t1492+t1493;
+    t1497 = 0.178E-2*t1336;
+    t1498 = 0.178E-2*t1337;
+    t1499 = 0.19E-3*t1331;
+    t1500 = 0.19E-3*t1332;
+    t1501 = 0.103965*t280;
+    t1502 = 0.81035E-1*t284;
+    t1503 = -t1497-t1498+t1499-t1500-t1501+t1502;
+    t1508 = 0.2515757084E-1*A[65]*t1408+0.7795827887E-2*A[65]*t1417+
+0.1232237092E-1*A[65]*t1426-0.9857689952E-1*A[63]*t973-0.2515757084E-1*A[63]*
+t861-0.1232237092E-1*A[63]*t849-0.2797813032E-1*A[63]*t1037-0.7795827887E-2*A
+[63]*t1031-0.1232237092E-1*A[63]*t1251-0.2959933166E-1*A[63]*t1165
+-0.3371437079E-1*A[63]*t1098-0.1232237092E-1*A[63]*t1061+0.2515757084E-1*A[65]*
+t1453+0.7795827887E-2*A[65]*t1462+0.3371437079E-1*A[65]*t1465+0.1232237092E-1*A
+[65]*t1478+0.9857689952E-1*A[65]*t1494+0.1444192625E-1*A[65]*t1503
+-0.1497956955E-1*A[63]*t1034;
+    A[67] = t1401+t1508;
+    t1547 = -0.2515757084E-1*A[64]*t1408+0.2515757084E-1*A[63]*t991+
+0.1497956955E-1*A[63]*t1067+0.7795827887E-2*A[63]*t924-0.2515757084E-1*A[64]*
+t1453-0.1232237092E-1*A[64]*t1478-0.6142781518E-1*A[64]*t1262+0.1444192625E-1*A
+[63]*t1046+0.2959933166E-1*A[63]*t1086+0.1232237092E-1*A[63]*t950
+-0.9857689952E-1*A[64]*t1494+0.2797813032E-1*A[63]*t810+0.2122202187*A[63]*
+t1172-0.2122202187*A[64]*t1398-0.3371437079E-1*A[64]*t1465+0.8229664675E-1*A
+[63]*t1104+0.2959933166E-1*A[63]*t1208-0.1232237092E-1*A[64]*t1354+
+0.1232237092E-1*A[63]*t1242;
+    t1586 = -0.2872669523E-1*A[64]*t1277+0.7795827887E-2*A[63]*t1139+
+0.1232237092E-1*A[63]*t877-0.7795827887E-2*A[64]*t1417-0.1232237092E-1*A[64]*
+t1426+0.2515757084E-1*A[63]*t1181-0.1497956955E-1*A[64]*t1391-0.1444192625E-1*A
+[64]*t1365+0.2872669523E-1*A[63]*t1184-0.2797813032E-1*A[64]*t1285
+-0.2959933166E-1*A[64]*t1388+0.6142781518E-1*A[63]*t852+0.9857689952E-1*A[63]*
+t1224+0.3371437079E-1*A[63]*t1101-0.1444192625E-1*A[64]*t1503-0.2959933166E-1*A
+[64]*t1328-0.7795827887E-2*A[64]*t1462-0.8229664675E-1*A[64]*t1280+
+0.1444192625E-1*A[63]*t982;
+    A[68] = t1547+t1586;
+    A[69] = IGM_CONST(-1.0);
+    t1587 = -t34;
+    t1589 = -t93;
+    A[70] = t1587*t795-t1589*t800;
+    t1592 = -t261;
+    A[71] = t1589*t804-t1592*t795;
+    A[72] = t1592*t800-t1587*t804;
+    A[73] = t1592;
+    A[74] = t1587;
+    A[75] = t1589;
+    t1616 = 0.717E-2*t88;
+    t1617 = 0.717E-2*t92;
+    t1618 = 0.10733880938412E-1*t105;
+    t1619 = 0.10733880938412E-1*t108;
+    t1620 = 0.2752059592378E-1*t113;
+    t1621 = 0.2752059592378E-1*t114;
+    t1622 = t1616+t1617-t1618-t1619-t1620+t1621;
+    t1643 = -0.1232237092E-1*A[75]*t1242-0.1232237092E-1*A[75]*t950+
+0.7795827887E-2*A[74]*t1031-0.2797813032E-1*A[75]*t810-0.2959933166E-1*A[75]*
+t1208+0.9857689952E-1*A[74]*t973+0.2515757084E-1*A[74]*t1011-0.2515757084E-1*A
+[75]*t1181-0.1444192625E-1*A[75]*t1046-0.3371437079E-1*A[75]*t1101+
+0.1497956955E-1*A[74]*t1622+0.3371437079E-1*A[74]*t1098+0.1444192625E-1*A[74]*
+t1193+0.1232237092E-1*A[74]*t849+0.1232237092E-1*A[74]*t1061+0.1444192625E-1*A
+[74]*t1095+0.1232237092E-1*A[74]*t1251-0.1444192625E-1*A[75]*t982+
+0.2872669523E-1*A[74]*t813-0.9857689952E-1*A[75]*t1224;
+    t1652 = 0.717E-2*t28;
+    t1653 = 0.717E-2*t33;
+    t1654 = 0.10733880938412E-1*t51;
+    t1655 = 0.10733880938412E-1*t55;
+    t1656 = 0.2752059592378E-1*t61;
+    t1657 = 0.2752059592378E-1*t62;
+    t1658 = t1652+t1653-t1654-t1655-t1656+t1657;
+    t1691 = -0.8229664675E-1*A[75]*t1104-0.2959933166E-1*A[75]*t1086+
+0.2959933166E-1*A[74]*t1165-0.2515757084E-1*A[75]*t991-0.1497956955E-1*A[75]*
+t1658+0.6142781518E-1*A[74]*t1064-0.1497956955E-1*A[75]*t1067-0.7795827887E-2*A
+[75]*t1139+0.2515757084E-1*A[74]*t861+0.2797813032E-1*A[74]*t1037+0.2122202187*
+A[74]*t1258-0.2122202187*A[75]*t1172-0.1232237092E-1*A[75]*t877+0.2959933166E-1
+*A[74]*t1122-0.7795827887E-2*A[75]*t924-0.2872669523E-1*A[75]*t1184+
+0.8229664675E-1*A[74]*t1142-0.6142781518E-1*A[75]*t852+0.7795827887E-2*A[74]*
+t1233+0.1497956955E-1*A[74]*t1034;
+    A[76] = t1643+t1691;
+    t1732 = -0.2872669523E-1*A[73]*t813-0.8229664675E-1*A[73]*t1142+
+0.8229664675E-1*A[75]*t1280-0.2122202187*A[73]*t1258-0.2959933166E-1*A[73]*
+t1165+0.1232237092E-1*A[75]*t1478-0.1232237092E-1*A[73]*t1061-0.1444192625E-1*A
+[73]*t1095+0.2872669523E-1*A[75]*t1277+0.2959933166E-1*A[75]*t1328
+-0.2959933166E-1*A[73]*t1122+0.2122202187*A[75]*t1398-0.1232237092E-1*A[73]*
+t849-0.1232237092E-1*A[73]*t1251-0.3371437079E-1*A[73]*t1098+0.9857689952E-1*A
+[75]*t1494-0.2797813032E-1*A[73]*t1037-0.1497956955E-1*A[73]*t1034
+-0.6142781518E-1*A[73]*t1064+0.2515757084E-1*A[75]*t1408;
+    t1765 = 0.717E-2*t256;
+    t1766 = 0.717E-2*t260;
+    t1767 = 0.10733880938412E-1*t273;
+    t1768 = 0.10733880938412E-1*t276;
+    t1769 = 0.2752059592378E-1*t281;
+    t1770 = 0.2752059592378E-1*t282;
+    t1771 = t1765+t1766-t1767-t1768-t1769+t1770;
+    t1780 = -0.7795827887E-2*A[73]*t1233-0.2515757084E-1*A[73]*t1011
+-0.9857689952E-1*A[73]*t973+0.2797813032E-1*A[75]*t1285+0.1232237092E-1*A[75]*
+t1426-0.7795827887E-2*A[73]*t1031+0.7795827887E-2*A[75]*t1417+0.2959933166E-1*A
+[75]*t1388-0.2515757084E-1*A[73]*t861+0.3371437079E-1*A[75]*t1465+
+0.7795827887E-2*A[75]*t1462+0.1444192625E-1*A[75]*t1503-0.1444192625E-1*A[73]*
+t1193+0.1444192625E-1*A[75]*t1365+0.1497956955E-1*A[75]*t1391+0.1232237092E-1*A
+[75]*t1354+0.1497956955E-1*A[75]*t1771-0.1497956955E-1*A[73]*t1622+
+0.2515757084E-1*A[75]*t1453+0.6142781518E-1*A[75]*t1262;
+    A[77] = t1732+t1780;
+    t1821 = 0.2515757084E-1*A[73]*t991-0.7795827887E-2*A[74]*t1462
+-0.2515757084E-1*A[74]*t1408+0.1232237092E-1*A[73]*t877+0.1497956955E-1*A[73]*
+t1067-0.2959933166E-1*A[74]*t1388+0.2959933166E-1*A[73]*t1086-0.1232237092E-1*A
+[74]*t1354+0.1232237092E-1*A[73]*t1242+0.7795827887E-2*A[73]*t1139
+-0.2797813032E-1*A[74]*t1285+0.1444192625E-1*A[73]*t982-0.1444192625E-1*A[74]*
+t1503-0.2872669523E-1*A[74]*t1277+0.3371437079E-1*A[73]*t1101-0.1497956955E-1*A
+[74]*t1391+0.9857689952E-1*A[73]*t1224-0.1444192625E-1*A[74]*t1365+
+0.1444192625E-1*A[73]*t1046-0.1232237092E-1*A[74]*t1478;
+    t1862 = -0.1497956955E-1*A[74]*t1771-0.1232237092E-1*A[74]*t1426
+-0.7795827887E-2*A[74]*t1417-0.2122202187*A[74]*t1398-0.3371437079E-1*A[74]*
+t1465+0.2797813032E-1*A[73]*t810+0.2515757084E-1*A[73]*t1181+0.2959933166E-1*A
+[73]*t1208-0.2515757084E-1*A[74]*t1453+0.6142781518E-1*A[73]*t852+
+0.2872669523E-1*A[73]*t1184-0.8229664675E-1*A[74]*t1280-0.2959933166E-1*A[74]*
+t1328+0.1497956955E-1*A[73]*t1658+0.2122202187*A[73]*t1172+0.7795827887E-2*A
+[73]*t924-0.9857689952E-1*A[74]*t1494+0.8229664675E-1*A[73]*t1104
+-0.6142781518E-1*A[74]*t1262+0.1232237092E-1*A[73]*t950;
+    A[78] = t1821+t1862;
+    A[79] = IGM_CONST(0.0);
+    t1863 = -t45;
+    t1865 = -t101;
+    A[80] = t1863*t795-t1865*t800;
+    t1868 = -t269;
+    A[81] = t1865*t804-t1868*t795;
+    A[82] = t1868*t800-t1863*t804;
+    A[83] = t1868;
+    A[84] = t1863;
+    A[85] = t1865;
+    t1888 = 0.335875721E-2*t98;
+    t1889 = 0.205060966E-3*t102;
+    t1890 = 0.1649E-1*t88;
+    t1891 = 0.1649E-1*t92;
+    t1892 = t1888-t1889+t1890+t1891;
+    t1895 = 0.335875721E-2*t42;
+    t1896 = 0.205060966E-3*t46;
+    t1897 = 0.1649E-1*t28;
+    t1898 = 0.1649E-1*t33;
+    t1899 = t1895-t1896+t1897+t1898;
+    t1925 = -0.2122202187*A[85]*t1172+0.1232237092E-1*A[84]*t1251+
+0.2872669523E-1*A[84]*t813+0.2959933166E-1*A[84]*t1165-0.2797813032E-1*A[85]*
+t810-0.9857689952E-1*A[85]*t1224-0.8229664675E-1*A[85]*t1104-0.1232237092E-1*A
+[85]*t1242+0.7795827887E-2*A[84]*t1031-0.2872669523E-1*A[85]*t1184
+-0.1232237092E-1*A[85]*t950;
+    t1970 = 0.1232237092E-1*A[84]*t1061-0.2515757084E-1*A[85]*t991
+-0.1497956955E-1*A[85]*t1067+0.6142781518E-1*A[84]*t1064-0.1232237092E-1*A[85]*
+t877-0.3371437079E-1*A[85]*t1101+0.2515757084E-1*A[84]*t861+0.2122202187*A[84]*
+t1258-0.2959933166E-1*A[85]*t1086+0.1232237092E-1*A[84]*t849+0.1497956955E-1*A
+[84]*t1034;
+    A[86] = -0.2959933166E-1*A[85]*t1208+0.3371437079E-1*A[84]*t1098
+-0.7795827887E-2*A[85]*t1139+0.2515757084E-1*A[84]*t1011-0.6142781518E-1*A[85]*
+t852+0.7795827887E-2*A[84]*t1233+0.1497956955E-1*A[84]*t1622-0.1497956955E-1*A
+[85]*t1658+0.2797813032E-1*A[84]*t1892-0.2797813032E-1*A[85]*t1899+t1925+
+0.2959933166E-1*A[84]*t1122-0.2515757084E-1*A[85]*t1181+0.9857689952E-1*A[84]*
+t973+0.8229664675E-1*A[84]*t1142-0.7795827887E-2*A[85]*t924-0.1444192625E-1*A
+[85]*t1046+0.1444192625E-1*A[84]*t1193+0.1444192625E-1*A[84]*t1095+
+0.2797813032E-1*A[84]*t1037-0.1444192625E-1*A[85]*t982+t1970;
+    t1997 = 0.335875721E-2*t266;
+    t1998 = 0.205060966E-3*t270;
+    t1999 = 0.1649E-1*t256;
+    t2000 = 0.1649E-1*t260;
+    t2001 = t1997-t1998+t1999+t2000;
+    t2020 = 0.1232237092E-1*A[85]*t1478-0.1497956955E-1*A[83]*t1034+
+0.2797813032E-1*A[85]*t2001-0.2797813032E-1*A[83]*t1892+0.1497956955E-1*A[85]*
+t1771-0.1444192625E-1*A[83]*t1095+0.2797813032E-1*A[85]*t1285+0.2515757084E-1*A
+[85]*t1453-0.2797813032E-1*A[83]*t1037+0.2872669523E-1*A[85]*t1277+0.2122202187
+*A[85]*t1398;
+    t2065 = 0.2515757084E-1*A[85]*t1408+0.3371437079E-1*A[85]*t1465+
+0.1444192625E-1*A[85]*t1503-0.3371437079E-1*A[83]*t1098-0.2959933166E-1*A[83]*
+t1122+0.6142781518E-1*A[85]*t1262+0.7795827887E-2*A[85]*t1462+0.2959933166E-1*A
+[85]*t1328-0.9857689952E-1*A[83]*t973+0.1497956955E-1*A[85]*t1391
+-0.7795827887E-2*A[83]*t1233;
+    A[87] = -0.2959933166E-1*A[83]*t1165-0.2515757084E-1*A[83]*t861
+-0.1497956955E-1*A[83]*t1622+0.1232237092E-1*A[85]*t1354-0.2515757084E-1*A[83]*
+t1011+0.1444192625E-1*A[85]*t1365-0.1232237092E-1*A[83]*t1251-0.1232237092E-1*A
+[83]*t849-0.2122202187*A[83]*t1258-0.6142781518E-1*A[83]*t1064+t2020+
+0.9857689952E-1*A[85]*t1494+0.7795827887E-2*A[85]*t1417-0.1232237092E-1*A[83]*
+t1061-0.2872669523E-1*A[83]*t813+0.8229664675E-1*A[85]*t1280-0.7795827887E-2*A
+[83]*t1031+0.1232237092E-1*A[85]*t1426-0.8229664675E-1*A[83]*t1142
+-0.1444192625E-1*A[83]*t1193+0.2959933166E-1*A[85]*t1388+t2065;
+    t2110 = -0.2122202187*A[84]*t1398+0.9857689952E-1*A[83]*t1224
+-0.2797813032E-1*A[84]*t1285+0.1444192625E-1*A[83]*t1046-0.2959933166E-1*A[84]*
+t1328+0.1232237092E-1*A[83]*t877-0.1444192625E-1*A[84]*t1365-0.3371437079E-1*A
+[84]*t1465+0.1497956955E-1*A[83]*t1658-0.1497956955E-1*A[84]*t1771
+-0.9857689952E-1*A[84]*t1494;
+    t2155 = -0.8229664675E-1*A[84]*t1280+0.3371437079E-1*A[83]*t1101
+-0.2959933166E-1*A[84]*t1388-0.2515757084E-1*A[84]*t1453+0.2515757084E-1*A[83]*
+t1181+0.6142781518E-1*A[83]*t852+0.1444192625E-1*A[83]*t982+0.1232237092E-1*A
+[83]*t1242+0.2797813032E-1*A[83]*t810-0.1232237092E-1*A[84]*t1354
+-0.1232237092E-1*A[84]*t1426;
+    A[88] = 0.7795827887E-2*A[83]*t1139+0.7795827887E-2*A[83]*t924+
+0.2959933166E-1*A[83]*t1086+0.2797813032E-1*A[83]*t1899-0.2797813032E-1*A[84]*
+t2001-0.6142781518E-1*A[84]*t1262-0.1232237092E-1*A[84]*t1478-0.7795827887E-2*A
+[84]*t1462-0.1444192625E-1*A[84]*t1503+0.2122202187*A[83]*t1172+t2110+
+0.2872669523E-1*A[83]*t1184-0.2515757084E-1*A[84]*t1408-0.2872669523E-1*A[84]*
+t1277-0.1497956955E-1*A[84]*t1391-0.7795827887E-2*A[84]*t1417+0.8229664675E-1*A
+[83]*t1104+0.1497956955E-1*A[83]*t1067+0.2959933166E-1*A[83]*t1208+
+0.2515757084E-1*A[83]*t991+0.1232237092E-1*A[83]*t950+t2155;
+    A[89] = IGM_CONST(0.0);
+    t2157 = 0.1*t82;
+    t2158 = 0.1*t86;
+    t2159 = -t179-t184-t185-t186-t187-t188+t793+t794-t2157+t2158;
+    t2161 = 0.1*t19;
+    t2162 = 0.1*t24;
+    t2163 = -t230-t234-t235-t236-t237-t238+t798+t799-t2161+t2162;
+    A[90] = A[84]*t2159-A[85]*t2163;
+    t2165 = 0.1*t250;
+    t2166 = 0.1*t254;
+    t2167 = -t330-t334-t335-t336-t337-t338+t802+t803-t2165+t2166;
+    A[91] = A[85]*t2167-A[83]*t2159;
+    A[92] = A[83]*t2163-A[84]*t2167;
+    A[93] = A[83];
+    A[94] = A[84];
+    A[95] = A[85];
+    t2172 = t998+t1000-t1002+t1004+t1006-t1008-t1009+t1010-t2157+t2158;
+    t2175 = -t399-t400-t401+t402-t403-t404-t187-t188+t793+t794-t2157+t2158;
+    t2178 = -t1089-t1090+t1091-t1092-t1093+t1094-t2157+t2158;
+    t2181 = t435+t430-t434+t432-t428-t429-t235-t236-t237-t238+t798+t799-t2161+
+t2162;
+    t2184 = -t1040-t1041+t1042-t1043-t1044+t1045-t2161+t2162;
+    t2187 = t1111+t1115+t1117-t1119+t1120+t1121+t1029+t1030-t847+t848-t2157+
+t2158;
+    t2190 = -t867-t870-t872+t874-t875+t876-t2161+t2162;
+    t2193 = -t390-t391-t392+t393-t394-t395+t798+t799-t2161+t2162;
+    t2196 = t959+t962+t964-t966+t968-t970-t971+t972-t2157+t2158;
+    t2199 = -t372-t373-t374+t375-t376-t377+t798+t799-t2161+t2162;
+    t2202 = t1127+t1130+t1132-t1134-t1135-t1136+t1137+t1138-t948+t949-t2161+
+t2162;
+    t2205 = 0.2515757084E-1*A[94]*t2172+0.6142781518E-1*A[94]*t2175+
+0.1444192625E-1*A[94]*t2178-0.2872669523E-1*A[95]*t2181-0.1444192625E-1*A[95]*
+t2184+0.2959933166E-1*A[94]*t2187-0.1232237092E-1*A[95]*t2190-0.8229664675E-1*A
+[95]*t2193+0.9857689952E-1*A[94]*t2196-0.2797813032E-1*A[95]*t2199
+-0.7795827887E-2*A[95]*t2202;
+    t2206 = -t363-t364-t365+t366-t367-t368+t793+t794-t2157+t2158;
+    t2209 = -t354-t355+t356-t357-t358+t359+t798+t799-t2161+t2162;
+    t2212 = -t408-t409-t410+t411-t412-t413-t237-t238+t798+t799-t2161+t2162;
+    t2215 = t896+t911-t913+t915-t917-t919+t920+t921-t922+t923-t2161+t2162;
+    t2218 = t1213+t1215+t1217-t1219+t1220-t1221-t1222+t1223-t2161+t2162;
+    t2221 = -t1254+t1255-t1256+t1257-t2157+t2158;
+    t2224 = -t1168+t1169-t1170+t1171-t2161+t2162;
+    t2227 = t1175+t1176-t1177+t1178+t1179-t1180-t922+t923-t2161+t2162;
+    t2230 = t855+t856+t857-t858+t859-t860-t847+t848-t2157+t2158;
+    t2233 = t931+t939-t941+t943+t945+t947-t948+t949-t2161+t2162;
+    t2236 = -t1245-t1246-t1247+t1248-t1249+t1250-t2157+t2158;
+    t2239 = 0.2797813032E-1*A[94]*t2206-0.1497956955E-1*A[95]*t2209
+-0.6142781518E-1*A[95]*t2212-0.7795827887E-2*A[95]*t2215-0.9857689952E-1*A[95]*
+t2218+0.2122202187*A[94]*t2221-0.2122202187*A[95]*t2224-0.2515757084E-1*A[95]*
+t2227+0.2515757084E-1*A[94]*t2230-0.1232237092E-1*A[95]*t2233+0.1232237092E-1*A
+[94]*t2236;
+    t2241 = -t457-t452+t456-t454-t451+t450-t235-t236-t237-t238+t798+t799-t2161+
+t2162;
+    t2244 = t1198+t1201+t1203-t1205+t1206+t1207+t1137+t1138-t948+t949-t2161+
+t2162;
+    t2247 = -t345-t346+t347-t348-t349+t350+t793+t794-t2157+t2158;
+    t2250 = t1236+t1237+t1238-t1239+t1240+t1241-t922+t923-t2161+t2162;
+    t2253 = -t976-t977+t978-t979-t980+t981-t2161+t2162;
+    t2256 = t1616+t1617-t1618-t1619-t1620+t1621-t2157+t2158;
+    t2259 = t1652+t1653-t1654-t1655-t1656+t1657-t2161+t2162;
+    t2262 = t1888-t1889+t1890+t1891-t2157+t2158;
+    t2265 = t1895-t1896+t1897+t1898-t2161+t2162;
+    t2268 = 0.4614E-1*t82;
+    t2269 = 0.4614E-1*t86;
+    t2270 = 0.131E-2*t89;
+    t2271 = 0.131E-2*t90;
+    t2272 = 0.201E-2*t99;
+    t2273 = 0.201E-2*t100;
+    t2274 = -t2268+t2269-t2270-t2271+t2272-t2273;
+    t2277 = 0.4614E-1*t19;
+    t2278 = 0.4614E-1*t24;
+    t2279 = 0.131E-2*t29;
+    t2280 = 0.131E-2*t30;
+    t2281 = 0.201E-2*t43;
+    t2282 = 0.201E-2*t44;
+    t2283 = -t2277+t2278-t2279-t2280+t2281-t2282;
+    t2286 = -0.3371437079E-1*A[95]*t2241-0.2959933166E-1*A[95]*t2244+
+0.1497956955E-1*A[94]*t2247-0.1232237092E-1*A[95]*t2250-0.1444192625E-1*A[95]*
+t2253+0.1497956955E-1*A[94]*t2256-0.1497956955E-1*A[95]*t2259+0.2797813032E-1*A
+[94]*t2262-0.2797813032E-1*A[95]*t2265+0.8229664675E-1*A[94]*t2274
+-0.8229664675E-1*A[95]*t2283;
+    t2287 = t1075+t1079-t1081+t1083+t1084+t1085+t920+t921-t922+t923-t2161+t2162
+;
+    t2290 = t1147+t1154-t1156+t1158+t1160+t1162+t1163+t1164-t1009+t1010-t2157+
+t2158;
+    t2293 = -t446-t441+t445-t443-t440+t439-t185-t186-t187-t188+t793+t794-t2157+
+t2158;
+    t2296 = t985+t986+t987-t988+t989-t990-t948+t949-t2161+t2162;
+    t2299 = t424+t419-t423+t421-t417-t418-t185-t186-t187-t188+t793+t794-t2157+
+t2158;
+    t2302 = -t381-t382-t383+t384-t385-t386+t793+t794-t2157+t2158;
+    t2305 = t1018+t1022+t1024-t1026-t1027-t1028+t1029+t1030-t847+t848-t2157+
+t2158;
+    t2308 = -t1187-t1188+t1189-t1190-t1191+t1192-t2157+t2158;
+    t2311 = t826+t838-t840+t842+t844+t846-t847+t848-t2157+t2158;
+    t2314 = t1051+t1054+t1056-t1058+t1059+t1060-t1009+t1010-t2157+t2158;
+    t2317 = t1227+t1228-t1229+t1230-t1231-t1232+t1163+t1164-t1009+t1010-t2157+
+t2158;
+    t2320 = -0.2959933166E-1*A[95]*t2287+0.2959933166E-1*A[94]*t2290+
+0.3371437079E-1*A[94]*t2293-0.2515757084E-1*A[95]*t2296+0.2872669523E-1*A[94]*
+t2299+0.8229664675E-1*A[94]*t2302+0.7795827887E-2*A[94]*t2305+0.1444192625E-1*A
+[94]*t2308+0.1232237092E-1*A[94]*t2311+0.1232237092E-1*A[94]*t2314+
+0.7795827887E-2*A[94]*t2317;
+    A[96] = t2205+t2239+t2286+t2320;
+    t2322 = t1402+t1403-t1404+t1405+t1406-t1407-t1326+t1327-t2165+t2166;
+    t2325 = -t483-t484-t485+t486-t487-t488+t802+t803-t2165+t2166;
+    t2330 = t1447+t1448+t1449-t1450+t1451-t1452-t1352+t1353-t2165+t2166;
+    t2335 = t507+t508-t512+t510-t505-t506-t335-t336-t337-t338+t802+t803-t2165+
+t2166;
+    t2338 = t1335+t1343-t1345+t1347+t1349+t1351-t1352+t1353-t2165+t2166;
+    t2343 = t1765+t1766-t1767-t1768-t1769+t1770-t2165+t2166;
+    t2346 = t1420+t1421+t1422-t1423+t1424+t1425-t1326+t1327-t2165+t2166;
+    t2351 = 0.2515757084E-1*A[95]*t2322+0.8229664675E-1*A[95]*t2325
+-0.1497956955E-1*A[93]*t2256+0.2515757084E-1*A[95]*t2330-0.7795827887E-2*A[93]*
+t2317+0.2872669523E-1*A[95]*t2335+0.1232237092E-1*A[95]*t2338-0.3371437079E-1*A
+[93]*t2293+0.1497956955E-1*A[95]*t2343+0.1232237092E-1*A[95]*t2346
+-0.7795827887E-2*A[93]*t2305;
+    t2352 = -t1394+t1395-t1396+t1397-t2165+t2166;
+    t2355 = -t1469-t1471-t1473+t1475-t1476+t1477-t2165+t2166;
+    t2360 = -t472-t473-t474+t475-t476-t477+t802+t803-t2165+t2166;
+    t2365 = -t494-t495-t496+t497-t498-t499-t337-t338+t802+t803-t2165+t2166;
+    t2368 = t1997-t1998+t1999+t2000-t2165+t2166;
+    t2373 = t1411+t1412+t1413-t1414-t1415-t1416+t1386+t1387-t1352+t1353-t2165+
+t2166;
+    t2380 = 0.2122202187*A[95]*t2352+0.1232237092E-1*A[95]*t2355
+-0.2515757084E-1*A[93]*t2172+0.2797813032E-1*A[95]*t2360-0.2797813032E-1*A[93]*
+t2206+0.6142781518E-1*A[95]*t2365+0.2797813032E-1*A[95]*t2368-0.9857689952E-1*A
+[93]*t2196+0.7795827887E-2*A[95]*t2373-0.1444192625E-1*A[93]*t2308
+-0.1232237092E-1*A[93]*t2311;
+    t2384 = t1483+t1485+t1487-t1489+t1490-t1491-t1492+t1493-t2165+t2166;
+    t2387 = -t1497-t1498+t1499-t1500-t1501+t1502-t2165+t2166;
+    t2390 = t1304+t1315-t1317+t1319+t1321+t1323+t1324+t1325-t1326+t1327-t2165+
+t2166;
+    t2395 = -t461-t462+t463-t464-t465+t466+t802+t803-t2165+t2166;
+    t2404 = -t520-t521+t525-t523-t519+t518-t335-t336-t337-t338+t802+t803-t2165+
+t2166;
+    t2409 = -0.1232237092E-1*A[93]*t2314+0.9857689952E-1*A[95]*t2384+
+0.1444192625E-1*A[95]*t2387+0.2959933166E-1*A[95]*t2390-0.2959933166E-1*A[93]*
+t2187+0.1497956955E-1*A[95]*t2395-0.1497956955E-1*A[93]*t2247-0.1444192625E-1*A
+[93]*t2178-0.6142781518E-1*A[93]*t2175+0.3371437079E-1*A[95]*t2404
+-0.8229664675E-1*A[93]*t2302;
+    t2410 = t1456+t1457-t1458+t1459-t1460-t1461+t1324+t1325-t1326+t1327-t2165+
+t2166;
+    t2413 = -t1359-t1360+t1361-t1362-t1363+t1364-t2165+t2166;
+    t2418 = 0.4614E-1*t250;
+    t2419 = 0.4614E-1*t254;
+    t2420 = 0.131E-2*t257;
+    t2421 = 0.131E-2*t258;
+    t2422 = 0.201E-2*t267;
+    t2423 = 0.201E-2*t268;
+    t2424 = -t2418+t2419-t2420-t2421+t2422-t2423;
+    t2433 = t1370+t1377+t1379-t1381+t1383+t1385+t1386+t1387-t1352+t1353-t2165+
+t2166;
+    t2442 = 0.7795827887E-2*A[95]*t2410+0.1444192625E-1*A[95]*t2413
+-0.2797813032E-1*A[93]*t2262+0.8229664675E-1*A[95]*t2424-0.8229664675E-1*A[93]*
+t2274-0.2122202187*A[93]*t2221-0.1232237092E-1*A[93]*t2236+0.2959933166E-1*A
+[95]*t2433-0.2872669523E-1*A[93]*t2299-0.2515757084E-1*A[93]*t2230
+-0.2959933166E-1*A[93]*t2290;
+    A[97] = t2351+t2380+t2409+t2442;
+    t2466 = 0.2515757084E-1*A[93]*t2227+0.2959933166E-1*A[93]*t2287
+-0.1232237092E-1*A[94]*t2346-0.2797813032E-1*A[94]*t2360-0.7795827887E-2*A[94]*
+t2410+0.9857689952E-1*A[93]*t2218+0.7795827887E-2*A[93]*t2215+0.1232237092E-1*A
+[93]*t2250-0.2959933166E-1*A[94]*t2433+0.2122202187*A[93]*t2224-0.9857689952E-1
+*A[94]*t2384;
+    t2489 = 0.1232237092E-1*A[93]*t2233-0.2122202187*A[94]*t2352
+-0.1444192625E-1*A[94]*t2387-0.2515757084E-1*A[94]*t2330+0.8229664675E-1*A[93]*
+t2193+0.8229664675E-1*A[93]*t2283-0.8229664675E-1*A[94]*t2424-0.6142781518E-1*A
+[94]*t2365-0.3371437079E-1*A[94]*t2404+0.1497956955E-1*A[93]*t2259
+-0.1497956955E-1*A[94]*t2343;
+    t2513 = 0.2797813032E-1*A[93]*t2265-0.2797813032E-1*A[94]*t2368
+-0.7795827887E-2*A[94]*t2373+0.2959933166E-1*A[93]*t2244-0.2515757084E-1*A[94]*
+t2322+0.3371437079E-1*A[93]*t2241+0.2797813032E-1*A[93]*t2199+0.1497956955E-1*A
+[93]*t2209+0.2872669523E-1*A[93]*t2181+0.1444192625E-1*A[93]*t2184
+-0.1232237092E-1*A[94]*t2338;
+    t2536 = -0.1497956955E-1*A[94]*t2395+0.6142781518E-1*A[93]*t2212+
+0.2515757084E-1*A[93]*t2296+0.1232237092E-1*A[93]*t2190-0.1444192625E-1*A[94]*
+t2413-0.2959933166E-1*A[94]*t2390-0.2872669523E-1*A[94]*t2335-0.1232237092E-1*A
+[94]*t2355+0.1444192625E-1*A[93]*t2253+0.7795827887E-2*A[93]*t2202
+-0.8229664675E-1*A[94]*t2325;
+    A[98] = t2466+t2489+t2513+t2536;
+    A[99] = IGM_CONST(0.0);
+    t2538 = 0.10274*t78;
+    t2539 = 0.10274*t80;
+    t2540 = -t179-t184-t185-t186-t187-t188+t793+t794-t2157+t2158-t2538-t2539;
+    t2542 = 0.10274*t12;
+    t2543 = 0.10274*t15;
+    t2544 = -t230-t234-t235-t236-t237-t238+t798+t799-t2161+t2162-t2542-t2543;
+    A[100] = A[94]*t2540-A[95]*t2544;
+    t2546 = 0.10274*t246;
+    t2547 = 0.10274*t248;
+    t2548 = -t330-t334-t335-t336-t337-t338+t802+t803-t2165+t2166-t2546-t2547;
+    A[101] = A[95]*t2548-A[93]*t2540;
+    A[102] = A[93]*t2544-A[94]*t2548;
+    A[103] = A[93];
+    A[104] = A[94];
+    A[105] = A[95];
+    t2553 = t1895-t1896+t1897+t1898-t2161+t2162-t2542-t2543;
+    t2556 = -t867-t870-t872+t874-t875+t876-t2161+t2162-t2542-t2543;
+    t2559 = -t1245-t1246-t1247+t1248-t1249+t1250-t2157+t2158-t2538-t2539;
+    t2562 = t1616+t1617-t1618-t1619-t1620+t1621-t2157+t2158-t2538-t2539;
+    t2565 = -t1168+t1169-t1170+t1171-t2161+t2162-t2542-t2543;
+    t2568 = -t1254+t1255-t1256+t1257-t2157+t2158-t2538-t2539;
+    t2571 = -t457-t452+t456-t454-t451+t450-t235-t236-t237-t238+t798+t799-t2161+
+t2162-t2542-t2543;
+    t2574 = t1213+t1215+t1217-t1219+t1220-t1221-t1222+t1223-t2161+t2162-t2542-
+t2543;
+    t2577 = t1888-t1889+t1890+t1891-t2157+t2158-t2538-t2539;
+    t2580 = t896+t911-t913+t915-t917-t919+t920+t921-t922+t923-t2161+t2162-t2542
+-t2543;
+    t2583 = -t345-t346+t347-t348-t349+t350+t793+t794-t2157+t2158-t2538-t2539;
+    t2586 = -0.2797813032E-1*A[105]*t2553-0.1232237092E-1*A[105]*t2556+
+0.1232237092E-1*A[104]*t2559+0.1497956955E-1*A[104]*t2562-0.2122202187*A[105]*
+t2565+0.2122202187*A[104]*t2568-0.3371437079E-1*A[105]*t2571-0.9857689952E-1*A
+[105]*t2574+0.2797813032E-1*A[104]*t2577-0.7795827887E-2*A[105]*t2580+
+0.1497956955E-1*A[104]*t2583;
+    t2587 = t826+t838-t840+t842+t844+t846-t847+t848-t2157+t2158-t2538-t2539;
+    t2590 = -t390-t391-t392+t393-t394-t395+t798+t799-t2161+t2162-t2542-t2543;
+    t2593 = -t372-t373-t374+t375-t376-t377+t798+t799-t2161+t2162-t2542-t2543;
+    t2596 = -t381-t382-t383+t384-t385-t386+t793+t794-t2157+t2158-t2538-t2539;
+    t2599 = -t363-t364-t365+t366-t367-t368+t793+t794-t2157+t2158-t2538-t2539;
+    t2602 = t1198+t1201+t1203-t1205+t1206+t1207+t1137+t1138-t948+t949-t2161+
+t2162-t2542-t2543;
+    t2605 = t1111+t1115+t1117-t1119+t1120+t1121+t1029+t1030-t847+t848-t2157+
+t2158-t2538-t2539;
+    t2608 = -t1187-t1188+t1189-t1190-t1191+t1192-t2157+t2158-t2538-t2539;
+    t2611 = t1147+t1154-t1156+t1158+t1160+t1162+t1163+t1164-t1009+t1010-t2157+
+t2158-t2538-t2539;
+    t2614 = t985+t986+t987-t988+t989-t990-t948+t949-t2161+t2162-t2542-t2543;
+    t2617 = -t408-t409-t410+t411-t412-t413-t237-t238+t798+t799-t2161+t2162-
+t2542-t2543;
+    t2620 = -t399-t400-t401+t402-t403-t404-t187-t188+t793+t794-t2157+t2158-
+t2538-t2539;
+    t2623 = 0.1232237092E-1*A[104]*t2587-0.8229664675E-1*A[105]*t2590
+-0.2797813032E-1*A[105]*t2593+0.8229664675E-1*A[104]*t2596+0.2797813032E-1*A
+[104]*t2599-0.2959933166E-1*A[105]*t2602+0.2959933166E-1*A[104]*t2605+
+0.1444192625E-1*A[104]*t2608+0.2959933166E-1*A[104]*t2611-0.2515757084E-1*A
+[105]*t2614-0.6142781518E-1*A[105]*t2617+0.6142781518E-1*A[104]*t2620;
+    t2625 = t424+t419-t423+t421-t417-t418-t185-t186-t187-t188+t793+t794-t2157+
+t2158-t2538-t2539;
+    t2628 = t959+t962+t964-t966+t968-t970-t971+t972-t2157+t2158-t2538-t2539;
+    t2631 = -t446-t441+t445-t443-t440+t439-t185-t186-t187-t188+t793+t794-t2157+
+t2158-t2538-t2539;
+    t2634 = t1051+t1054+t1056-t1058+t1059+t1060-t1009+t1010-t2157+t2158-t2538-
+t2539;
+    t2637 = -t2268+t2269-t2270-t2271+t2272-t2273-t2538-t2539;
+    t2640 = -t2277+t2278-t2279-t2280+t2281-t2282-t2542-t2543;
+    t2649 = -0.5383E-1*t78-0.5383E-1*t80-0.471E-2*t83+0.471E-2*t84+0.21E-2*t99
+-0.21E-2*t100;
+    t2658 = -0.5383E-1*t12-0.5383E-1*t15-0.471E-2*t20+0.471E-2*t21+0.21E-2*t43
+-0.21E-2*t44;
+    t2661 = -t976-t977+t978-t979-t980+t981-t2161+t2162-t2542-t2543;
+    t2664 = t931+t939-t941+t943+t945+t947-t948+t949-t2161+t2162-t2542-t2543;
+    t2667 = -t354-t355+t356-t357-t358+t359+t798+t799-t2161+t2162-t2542-t2543;
+    t2670 = 0.2872669523E-1*A[104]*t2625+0.9857689952E-1*A[104]*t2628+
+0.3371437079E-1*A[104]*t2631+0.1232237092E-1*A[104]*t2634+0.8229664675E-1*A
+[104]*t2637-0.8229664675E-1*A[105]*t2640+0.6142781518E-1*A[104]*t2649
+-0.6142781518E-1*A[105]*t2658-0.1444192625E-1*A[105]*t2661-0.1232237092E-1*A
+[105]*t2664-0.1497956955E-1*A[105]*t2667;
+    t2671 = t1227+t1228-t1229+t1230-t1231-t1232+t1163+t1164-t1009+t1010-t2157+
+t2158-t2538-t2539;
+    t2674 = t1018+t1022+t1024-t1026-t1027-t1028+t1029+t1030-t847+t848-t2157+
+t2158-t2538-t2539;
+    t2677 = t435+t430-t434+t432-t428-t429-t235-t236-t237-t238+t798+t799-t2161+
+t2162-t2542-t2543;
+    t2680 = -t1089-t1090+t1091-t1092-t1093+t1094-t2157+t2158-t2538-t2539;
+    t2683 = -t1040-t1041+t1042-t1043-t1044+t1045-t2161+t2162-t2542-t2543;
+    t2686 = t1236+t1237+t1238-t1239+t1240+t1241-t922+t923-t2161+t2162-t2542-
+t2543;
+    t2689 = t1175+t1176-t1177+t1178+t1179-t1180-t922+t923-t2161+t2162-t2542-
+t2543;
+    t2692 = t1652+t1653-t1654-t1655-t1656+t1657-t2161+t2162-t2542-t2543;
+    t2695 = t998+t1000-t1002+t1004+t1006-t1008-t1009+t1010-t2157+t2158-t2538-
+t2539;
+    t2698 = t1075+t1079-t1081+t1083+t1084+t1085+t920+t921-t922+t923-t2161+t2162
+-t2542-t2543;
+    t2701 = t1127+t1130+t1132-t1134-t1135-t1136+t1137+t1138-t948+t949-t2161+
+t2162-t2542-t2543;
+    t2704 = t855+t856+t857-t858+t859-t860-t847+t848-t2157+t2158-t2538-t2539;
+    t2707 = 0.7795827887E-2*A[104]*t2671+0.7795827887E-2*A[104]*t2674
+-0.2872669523E-1*A[105]*t2677+0.1444192625E-1*A[104]*t2680-0.1444192625E-1*A
+[105]*t2683-0.1232237092E-1*A[105]*t2686-0.2515757084E-1*A[105]*t2689
+-0.1497956955E-1*A[105]*t2692+0.2515757084E-1*A[104]*t2695-0.2959933166E-1*A
+[105]*t2698-0.7795827887E-2*A[105]*t2701+0.2515757084E-1*A[104]*t2704;
+    A[106] = t2586+t2623+t2670+t2707;
+    t2711 = -t1497-t1498+t1499-t1500-t1501+t1502-t2165+t2166-t2546-t2547;
+    t2714 = t1456+t1457-t1458+t1459-t1460-t1461+t1324+t1325-t1326+t1327-t2165+
+t2166-t2546-t2547;
+    t2719 = -t1469-t1471-t1473+t1475-t1476+t1477-t2165+t2166-t2546-t2547;
+    t2722 = t1370+t1377+t1379-t1381+t1383+t1385+t1386+t1387-t1352+t1353-t2165+
+t2166-t2546-t2547;
+    t2725 = -t494-t495-t496+t497-t498-t499-t337-t338+t802+t803-t2165+t2166-
+t2546-t2547;
+    t2732 = -t1359-t1360+t1361-t1362-t1363+t1364-t2165+t2166-t2546-t2547;
+    t2737 = -0.7795827887E-2*A[103]*t2674+0.1444192625E-1*A[105]*t2711+
+0.7795827887E-2*A[105]*t2714-0.2872669523E-1*A[103]*t2625+0.1232237092E-1*A
+[105]*t2719+0.2959933166E-1*A[105]*t2722+0.6142781518E-1*A[105]*t2725
+-0.1497956955E-1*A[103]*t2583-0.7795827887E-2*A[103]*t2671+0.1444192625E-1*A
+[105]*t2732-0.2797813032E-1*A[103]*t2577;
+    t2738 = -t2418+t2419-t2420-t2421+t2422-t2423-t2546-t2547;
+    t2749 = -0.5383E-1*t246-0.5383E-1*t248-0.471E-2*t251+0.471E-2*t252+0.21E-2*
+t267-0.21E-2*t268;
+    t2756 = -t483-t484-t485+t486-t487-t488+t802+t803-t2165+t2166-t2546-t2547;
+    t2763 = -t1394+t1395-t1396+t1397-t2165+t2166-t2546-t2547;
+    t2766 = t507+t508-t512+t510-t505-t506-t335-t336-t337-t338+t802+t803-t2165+
+t2166-t2546-t2547;
+    t2771 = t1304+t1315-t1317+t1319+t1321+t1323+t1324+t1325-t1326+t1327-t2165+
+t2166-t2546-t2547;
+    t2774 = 0.8229664675E-1*A[105]*t2738-0.8229664675E-1*A[103]*t2637+
+0.6142781518E-1*A[105]*t2749-0.6142781518E-1*A[103]*t2649-0.2959933166E-1*A
+[103]*t2611+0.8229664675E-1*A[105]*t2756-0.3371437079E-1*A[103]*t2631
+-0.1232237092E-1*A[103]*t2634+0.2122202187*A[105]*t2763+0.2872669523E-1*A[105]*
+t2766-0.2797813032E-1*A[103]*t2599+0.2959933166E-1*A[105]*t2771;
+    t2776 = -t472-t473-t474+t475-t476-t477+t802+t803-t2165+t2166-t2546-t2547;
+    t2779 = t1335+t1343-t1345+t1347+t1349+t1351-t1352+t1353-t2165+t2166-t2546-
+t2547;
+    t2788 = t1411+t1412+t1413-t1414-t1415-t1416+t1386+t1387-t1352+t1353-t2165+
+t2166-t2546-t2547;
+    t2791 = t1420+t1421+t1422-t1423+t1424+t1425-t1326+t1327-t2165+t2166-t2546-
+t2547;
+    t2800 = -t520-t521+t525-t523-t519+t518-t335-t336-t337-t338+t802+t803-t2165+
+t2166-t2546-t2547;
+    t2803 = 0.2797813032E-1*A[105]*t2776+0.1232237092E-1*A[105]*t2779
+-0.1444192625E-1*A[103]*t2680-0.8229664675E-1*A[103]*t2596-0.2515757084E-1*A
+[103]*t2704+0.7795827887E-2*A[105]*t2788+0.1232237092E-1*A[105]*t2791
+-0.6142781518E-1*A[103]*t2620-0.2959933166E-1*A[103]*t2605-0.1232237092E-1*A
+[103]*t2559+0.3371437079E-1*A[105]*t2800;
+    t2806 = t1447+t1448+t1449-t1450+t1451-t1452-t1352+t1353-t2165+t2166-t2546-
+t2547;
+    t2809 = t1483+t1485+t1487-t1489+t1490-t1491-t1492+t1493-t2165+t2166-t2546-
+t2547;
+    t2816 = -t461-t462+t463-t464-t465+t466+t802+t803-t2165+t2166-t2546-t2547;
+    t2821 = t1765+t1766-t1767-t1768-t1769+t1770-t2165+t2166-t2546-t2547;
+    t2826 = t1997-t1998+t1999+t2000-t2165+t2166-t2546-t2547;
+    t2829 = t1402+t1403-t1404+t1405+t1406-t1407-t1326+t1327-t2165+t2166-t2546-
+t2547;
+    t2834 = -0.1232237092E-1*A[103]*t2587+0.2515757084E-1*A[105]*t2806+
+0.9857689952E-1*A[105]*t2809-0.9857689952E-1*A[103]*t2628-0.2515757084E-1*A
+[103]*t2695+0.1497956955E-1*A[105]*t2816-0.2122202187*A[103]*t2568+
+0.1497956955E-1*A[105]*t2821-0.1497956955E-1*A[103]*t2562+0.2797813032E-1*A
+[105]*t2826+0.2515757084E-1*A[105]*t2829-0.1444192625E-1*A[103]*t2608;
+    A[107] = t2737+t2774+t2803+t2834;
+    t2858 = -0.2959933166E-1*A[104]*t2722+0.2797813032E-1*A[103]*t2553
+-0.2872669523E-1*A[104]*t2766+0.3371437079E-1*A[103]*t2571-0.7795827887E-2*A
+[104]*t2714-0.2797813032E-1*A[104]*t2776+0.6142781518E-1*A[103]*t2617+
+0.7795827887E-2*A[103]*t2580+0.1444192625E-1*A[103]*t2683-0.1444192625E-1*A
+[104]*t2732+0.2515757084E-1*A[103]*t2689;
+    t2883 = 0.9857689952E-1*A[103]*t2574-0.1497956955E-1*A[104]*t2821+
+0.1444192625E-1*A[103]*t2661+0.1232237092E-1*A[103]*t2686+0.2959933166E-1*A
+[103]*t2698-0.1497956955E-1*A[104]*t2816-0.7795827887E-2*A[104]*t2788+
+0.2959933166E-1*A[103]*t2602-0.3371437079E-1*A[104]*t2800+0.1497956955E-1*A
+[103]*t2692+0.2872669523E-1*A[103]*t2677-0.1232237092E-1*A[104]*t2791;
+    t2907 = 0.2122202187*A[103]*t2565+0.7795827887E-2*A[103]*t2701
+-0.1232237092E-1*A[104]*t2779-0.2515757084E-1*A[104]*t2829+0.2515757084E-1*A
+[103]*t2614-0.2959933166E-1*A[104]*t2771-0.9857689952E-1*A[104]*t2809
+-0.2515757084E-1*A[104]*t2806-0.8229664675E-1*A[104]*t2756+0.1232237092E-1*A
+[103]*t2664+0.2797813032E-1*A[103]*t2593;
+    t2932 = -0.1444192625E-1*A[104]*t2711+0.1232237092E-1*A[103]*t2556
+-0.1232237092E-1*A[104]*t2719+0.1497956955E-1*A[103]*t2667+0.8229664675E-1*A
+[103]*t2590-0.2797813032E-1*A[104]*t2826+0.8229664675E-1*A[103]*t2640
+-0.8229664675E-1*A[104]*t2738+0.6142781518E-1*A[103]*t2658-0.6142781518E-1*A
+[104]*t2749-0.2122202187*A[104]*t2763-0.6142781518E-1*A[104]*t2725;
+    A[108] = t2858+t2883+t2907+t2932;
+    A[109] = IGM_CONST(0.0);
+    A[110] = -t13*t2540+t79*t2544;
+    A[111] = -t79*t2548+t247*t2540;
+    A[112] = -t247*t2544+t13*t2548;
+    A[113] = -t247;
+    A[114] = -t13;
+    A[115] = -t79;
+    t2964 = 0.7795827887E-2*t79*t2580+0.2797813032E-1*t79*t2593+0.1232237092E-1
+*t79*t2686+0.1444192625E-1*t79*t2683+0.2797813032E-1*t79*t2553-0.8229664675E-1*
+t13*t2637+0.8229664675E-1*t79*t2640-0.6142781518E-1*t13*t2649+0.6142781518E-1*
+t79*t2658-0.2959933166E-1*t13*t2605-0.1497956955E-1*t13*t2562+0.2959933166E-1*
+t79*t2698;
+    t2989 = -0.8229664675E-1*t13*t2596-0.1232237092E-1*t13*t2559+
+0.1444192625E-1*t79*t2661-0.7795827887E-2*t13*t2674+0.1497956955E-1*t79*t2692
+-0.2797813032E-1*t13*t2577-0.2122202187*t13*t2568+0.2122202187*t79*t2565
+-0.2515757084E-1*t13*t2704-0.2872669523E-1*t13*t2625-0.1232237092E-1*t13*t2634+
+0.3371437079E-1*t79*t2571;
+    t3015 = 0.1232237092E-1*t79*t2556+0.1232237092E-1*t79*t2664-0.1232237092E-1
+*t13*t2587+0.9857689952E-1*t79*t2574-0.9857689952E-1*t13*t2628+0.2959933166E-1*
+t79*t2602-0.1444192625E-1*t13*t2608+0.8229664675E-1*t79*t2590-0.2959933166E-1*
+t13*t2611-0.2797813032E-1*t13*t2599+0.7795827887E-2*t79*t2701-0.2515757084E-1*
+t13*t2695;
+    t3023 = 0.638E-2*t74+0.638E-2*t76+0.142E-2*t79+0.28E-3*t99-0.28E-3*t100;
+    t3031 = 0.638E-2*t5+0.638E-2*t8+0.142E-2*t13+0.28E-3*t43-0.28E-3*t44;
+    t3052 = 0.2515757084E-1*t79*t2614-0.2872669523E-1*t13*t3023+0.2872669523E-1
+*t79*t3031+0.1497956955E-1*t79*t2667-0.6142781518E-1*t13*t2620-0.1497956955E-1*
+t13*t2583+0.2872669523E-1*t79*t2677-0.7795827887E-2*t13*t2671+0.6142781518E-1*
+t79*t2617-0.3371437079E-1*t13*t2631+0.2515757084E-1*t79*t2689-0.1444192625E-1*
+t13*t2680;
+    A[116] = t2964+t2989+t3015+t3052;
+    t3078 = 0.2515757084E-1*t247*t2695+0.2959933166E-1*t247*t2605+
+0.9857689952E-1*t247*t2628+0.1497956955E-1*t247*t2583-0.1497956955E-1*t79*t2816
++0.1497956955E-1*t247*t2562-0.2797813032E-1*t79*t2826+0.2797813032E-1*t247*
+t2577-0.8229664675E-1*t79*t2738+0.8229664675E-1*t247*t2637-0.6142781518E-1*t79*
+t2749+0.6142781518E-1*t247*t2649;
+    t3103 = -0.7795827887E-2*t79*t2714-0.1444192625E-1*t79*t2711+
+0.6142781518E-1*t247*t2620+0.1232237092E-1*t247*t2587+0.1444192625E-1*t247*
+t2608-0.3371437079E-1*t79*t2800+0.2872669523E-1*t247*t2625-0.2959933166E-1*t79*
+t2722-0.1232237092E-1*t79*t2779+0.7795827887E-2*t247*t2674-0.2872669523E-1*t79*
+t2766+0.1232237092E-1*t247*t2559;
+    t3114 = 0.638E-2*t242+0.638E-2*t244+0.142E-2*t247+0.28E-3*t267-0.28E-3*t268
+;
+    t3135 = 0.2959933166E-1*t247*t2611+0.2515757084E-1*t247*t2704
+-0.2872669523E-1*t79*t3114+0.2872669523E-1*t247*t3023+0.2122202187*t247*t2568
+-0.6142781518E-1*t79*t2725+0.2797813032E-1*t247*t2599-0.7795827887E-2*t79*t2788
+-0.8229664675E-1*t79*t2756+0.3371437079E-1*t247*t2631+0.8229664675E-1*t247*
+t2596-0.2122202187*t79*t2763;
+    t3160 = -0.1444192625E-1*t79*t2732-0.1497956955E-1*t79*t2821+
+0.7795827887E-2*t247*t2671-0.2515757084E-1*t79*t2829-0.2959933166E-1*t79*t2771+
+0.1232237092E-1*t247*t2634+0.1444192625E-1*t247*t2680-0.9857689952E-1*t79*t2809
+-0.1232237092E-1*t79*t2791-0.2797813032E-1*t79*t2776-0.1232237092E-1*t79*t2719
+-0.2515757084E-1*t79*t2806;
+    A[117] = t3078+t3103+t3135+t3160;
+    t3186 = -0.2515757084E-1*t247*t2614-0.3371437079E-1*t247*t2571-0.2122202187
+*t247*t2565+0.2122202187*t13*t2763+0.1497956955E-1*t13*t2821-0.2797813032E-1*
+t247*t2553-0.2959933166E-1*t247*t2602+0.2515757084E-1*t13*t2829-0.1232237092E-1
+*t247*t2664+0.1497956955E-1*t13*t2816-0.1232237092E-1*t247*t2556+
+0.7795827887E-2*t13*t2788;
+    t3211 = -0.1497956955E-1*t247*t2667-0.9857689952E-1*t247*t2574+
+0.1232237092E-1*t13*t2791-0.1232237092E-1*t247*t2686-0.8229664675E-1*t247*t2590
++0.2872669523E-1*t13*t2766+0.7795827887E-2*t13*t2714+0.1232237092E-1*t13*t2719+
+0.2959933166E-1*t13*t2771+0.1444192625E-1*t13*t2732-0.2959933166E-1*t247*t2698
+-0.6142781518E-1*t247*t2617;
+    t3237 = -0.7795827887E-2*t247*t2701+0.2797813032E-1*t13*t2826
+-0.8229664675E-1*t247*t2640+0.8229664675E-1*t13*t2738-0.6142781518E-1*t247*
+t2658+0.6142781518E-1*t13*t2749-0.2797813032E-1*t247*t2593+0.9857689952E-1*t13*
+t2809+0.2959933166E-1*t13*t2722+0.8229664675E-1*t13*t2756-0.2872669523E-1*t247*
+t2677-0.1444192625E-1*t247*t2661;
+    t3262 = -0.1444192625E-1*t247*t2683+0.3371437079E-1*t13*t2800
+-0.1497956955E-1*t247*t2692+0.6142781518E-1*t13*t2725-0.7795827887E-2*t247*
+t2580+0.2515757084E-1*t13*t2806-0.2872669523E-1*t247*t3031+0.2872669523E-1*t13*
+t3114-0.2515757084E-1*t247*t2689+0.2797813032E-1*t13*t2776+0.1444192625E-1*t13*
+t2711+0.1232237092E-1*t13*t2779;
+    A[118] = t3186+t3211+t3237+t3262;
+    A[119] = IGM_CONST(0.0);
+    t3270 = RL[12];
+    A[120] = LL[12]+t330+t334+t335+t336+t337+t338-t802-t803+0.1*t250-0.1*t254+
+0.10274*t246+0.10274*t248-0.4511E-1*t241-t3270;
+    t3277 = RL[13];
+    A[121] = LL[13]+t230+t234+t235+t236+t237+t238-t798-t799+0.1*t19-0.1*t24+
+0.10274*t12+0.10274*t15-0.4511E-1*t2-t3277;
+    t3284 = RL[14];
+    A[122] = LL[14]+t179+t184+t185+t186+t187+t188-t793-t794+0.1*t82-0.1*t86+
+0.10274*t78+0.10274*t80-0.4511E-1*t73-t3284;
+    t3285 = LL[2];
+    t3288 = LL[1];
+    t3291 = LL[6];
+    t3292 = t455-t453;
+    t3295 = LL[5];
+    t3296 = t444-t442;
+    t3299 = LL[10];
+    t3300 = t229+t233;
+    t3303 = LL[9];
+    t3304 = t178+t183;
+    A[123] = 0.5*t3285*A[54]-0.5*t3288*A[55]+0.5*t3291*t3292-0.5*t3295*t3296+
+0.5*t3299*t3300-0.5*t3303*t3304;
+    t3307 = LL[0];
+    t3312 = LL[4];
+    t3315 = t524-t522;
+    t3318 = LL[8];
+    t3321 = t329+t333;
+    A[124] = 0.5*t3307*A[55]-0.5*t3285*A[53]+0.5*t3312*t3296-0.5*t3291*t3315+
+0.5*t3318*t3304-0.5*t3299*t3321;
+    A[125] = 0.5*t3288*A[53]-0.5*t3307*A[54]+0.5*t3295*t3315-0.5*t3312*t3292+
+0.5*t3303*t3321-0.5*t3318*t3300;
+    t3349 = 0.8799425961E-3*t511-0.1112574236E-3*t524-0.2369931678E-4*t1372+
+0.1112574236E-3*t522-0.8051018213E-4*t1303-0.2606799616E-2*t1382
+-0.9381437244E-4*t1331+0.9381437244E-4*t1332+0.1232237092E-6*t1344
+-0.1232237092E-6*t1346-0.7932620886E-4*t1318+0.1512290733E-3*t304+
+0.9761137487E-4*t1298;
+    t3363 = -0.9761137487E-4*t1299-0.2606799616E-2*t1322+0.5082624939E-2*t1488+
+0.8823452451E-4*t305-0.8823452451E-4*t306+CoM[0]-0.4402844298E-1*t241+
+0.1112574236E-3*t243-0.8799425961E-3*t247-0.8503258945E-4*t1339+0.8503258945E-4
+*t1340-0.2606799616E-2*t1384+0.1081557015E-2*t329;
+    t3378 = 0.7932620886E-4*t1316+0.1512290733E-3*t308+0.1681938551E-1*t315+
+0.5687628827E-3*t312+0.5687628827E-3*t313-0.1832763156E-3*t323+0.9419629563E-2*
+t317+0.1681938551E-1*t311+0.9970896939E-4*t293+0.8318061448E-1*t250+
+0.9332037043E-1*t246-0.1832763156E-3*t242-0.1832763156E-3*t244;
+    t3392 = 0.9332037043E-1*t248+0.2893250095E-3*t251-0.2893250095E-3*t252
+-0.8318061448E-1*t254-0.5687628827E-3*t256+0.1078086072E-3*t257+0.1078086072E-3
+*t258-0.5687628827E-3*t260+0.1607889161E-3*t273-0.9397174694E-4*t266
+-0.3024581465E-3*t267+0.3024581465E-3*t268+0.5737222431E-5*t270;
+    t3408 = 0.1607889161E-3*t276+0.1659098766E-1*t280+0.4122466806E-3*t281
+-0.4122466806E-3*t282-0.6660372088E-1*t284+0.2061233404E-3*t287+0.1702509553E-4
+*t1301-0.9999999999*t3270-0.2061233404E-3*t290+0.9970896939E-4*t302+
+0.101865705E-2*t294-0.101865705E-2*t295-0.1607889161E-3*t297;
+    t3422 = 0.1607889161E-3*t300+0.7932620886E-4*t1380-0.2606799616E-2*t1320
+-0.9381437244E-4*t1290+0.9381437244E-4*t1292-0.1232237092E-6*t1309+
+0.1232237092E-6*t1310-0.8051018213E-4*t1369+0.9419629563E-2*t321
+-0.8051018213E-4*t1376+0.2369931678E-4*t1374+0.1702509553E-4*t1334
+-0.4677530128E-2*t1348;
+    t3437 = 0.2570662873E-4*t1336+0.2570662873E-4*t1337-0.4677530128E-2*t1350
+-0.2369931678E-4*t1312+0.1702509553E-4*t1294+0.3696711277E-6*t1470
+-0.8945848979E-4*t1472-0.8051018213E-4*t1314-0.4677530128E-2*t1305+
+0.2570662873E-4*t1295+0.2570662873E-4*t1296-0.4677530128E-2*t1306+
+0.1702509553E-4*t1342;
+    t3452 = -0.1832763156E-3*t327-0.8799425961E-3*t509-0.3775495252E-3*t1482
+-0.3775495252E-3*t1484-0.5082624939E-2*t1486+0.8945848979E-4*t1474
+-0.7932620886E-4*t1378+0.1081557015E-2*t333+0.1078086072E-3*t318
+-0.1078086072E-3*t319+0.2893250095E-3*t324-0.2893250095E-3*t325+0.2369931678E-4
+*t1308+0.3696711277E-6*t1468;
+    A[126] = t3349+t3363+t3378+t3392+t3408+t3422+t3437+t3452;
+    t3468 = 0.8823452451E-4*t205-0.8823452451E-4*t206-0.2606799616E-2*t895
+-0.101865705E-2*t195-0.1607889161E-3*t197+0.1607889161E-3*t200+0.1512290733E-3*
+t204+0.8945848979E-4*t873-0.8503258945E-4*t935+0.8503258945E-4*t936
+-0.2606799616E-2*t1129-0.8051018213E-4*t1078+0.7932620886E-4*t1204;
+    t3482 = 0.2893250095E-3*t224-0.2893250095E-3*t225-0.8799425961E-3*t431+
+0.1702509553E-4*t918-0.4677530128E-2*t944+0.2570662873E-4*t932+0.8318061448E-1*
+t19+0.9332037043E-1*t12-0.1832763156E-3*t5-0.1832763156E-3*t8+0.9332037043E-1*
+t15+0.2893250095E-3*t20-0.2893250095E-3*t21;
+    t3497 = -0.8318061448E-1*t24-0.5687628827E-3*t28+0.1078086072E-3*t29+
+0.1078086072E-3*t30-0.5687628827E-3*t33+0.1607889161E-3*t51-0.9397174694E-4*t42
+-0.3024581465E-3*t43+0.3024581465E-3*t44+0.5737222431E-5*t46+0.1607889161E-3*
+t55+0.1659098766E-1*t60+0.4122466806E-3*t61;
+    t3511 = -0.4122466806E-3*t62-0.6660372088E-1*t64+0.2061233404E-3*t67
+-0.2061233404E-3*t70-0.1832763156E-3*t223+0.9419629563E-2*t217+0.1681938551E-1*
+t211+0.9970896939E-4*t193+0.1081557015E-2*t233+0.3696711277E-6*t866+
+0.3696711277E-6*t869-0.8945848979E-4*t871-0.9381437244E-4*t897;
+    t3527 = 0.9381437244E-4*t898-0.1232237092E-6*t902+0.1232237092E-6*t907
+-0.7932620886E-4*t1202+0.2570662873E-4*t933-0.4677530128E-2*t946+CoM[1]
+-0.3775495252E-3*t1212-0.3775495252E-3*t1214-0.5082624939E-2*t1216+
+0.9419629563E-2*t221+0.2369931678E-4*t912-0.1832763156E-3*t227;
+    t3541 = -0.9999999999*t3277+0.1702509553E-4*t916+0.1702509553E-4*t930+
+0.9761137487E-4*t903-0.9761137487E-4*t904-0.2606799616E-2*t910+0.9970896939E-4*
+t202+0.101865705E-2*t194+0.1512290733E-3*t208+0.1681938551E-1*t215+
+0.5687628827E-3*t212+0.5687628827E-3*t213-0.4677530128E-2*t891;
+    t3556 = 0.1112574236E-3*t453-0.2369931678E-4*t914-0.8051018213E-4*t1200
+-0.7932620886E-4*t1082+0.1702509553E-4*t938+0.1078086072E-3*t218
+-0.1078086072E-3*t219+0.8799425961E-3*t433-0.8051018213E-4*t1074+
+0.1081557015E-2*t229+0.5082624939E-2*t1218+0.7932620886E-4*t1080
+-0.1112574236E-3*t455;
+    t3571 = -0.2369931678E-4*t1131-0.8051018213E-4*t1197-0.4677530128E-2*t889+
+0.2570662873E-4*t882+0.2570662873E-4*t885+0.2369931678E-4*t1133-0.2606799616E-2
+*t1126-0.9381437244E-4*t927+0.9381437244E-4*t928+0.1232237092E-6*t940
+-0.1232237092E-6*t942-0.4402844298E-1*t2+0.1112574236E-3*t6-0.8799425961E-3*t13
+;
+    A[127] = t3468+t3482+t3497+t3511+t3527+t3541+t3556+t3571;
+    t3587 = -0.3775495252E-3*t958+0.1702509553E-4*t1050+0.1512290733E-3*t146+
+0.1681938551E-1*t156+0.5687628827E-3*t152+0.5687628827E-3*t153-0.4402844298E-1*
+t73+0.1112574236E-3*t75-0.8799425961E-3*t79+0.2369931678E-4*t1149
+-0.3775495252E-3*t961-0.5082624939E-2*t963+0.7932620886E-4*t1155;
+    t3601 = 0.3696711277E-6*t954-0.8945848979E-4*t967+0.8945848979E-4*t969
+-0.8799425961E-3*t420+0.1702509553E-4*t1053-0.7932620886E-4*t1157+
+0.1081557015E-2*t183-0.1832763156E-3*t174+0.2570662873E-4*t827+0.5082624939E-2*
+t965+0.1702509553E-4*t825-0.1832763156E-3*t169+0.9419629563E-2*t160;
+    t3616 = 0.1681938551E-1*t151+0.9970896939E-4*t127+0.8318061448E-1*t82+
+0.9332037043E-1*t78-0.1832763156E-3*t74-0.1832763156E-3*t76+0.9332037043E-1*t80
++0.2893250095E-3*t83-0.2893250095E-3*t84-0.8318061448E-1*t86-0.5687628827E-3*
+t88+0.1078086072E-3*t89+0.1078086072E-3*t90;
+    t3630 = -0.5687628827E-3*t92+0.1607889161E-3*t105-0.9397174694E-4*t98
+-0.3024581465E-3*t99+0.3024581465E-3*t100+0.5737222431E-5*t102+0.1607889161E-3*
+t108+0.1659098766E-1*t112+0.4122466806E-3*t113-0.4122466806E-3*t114
+-0.6660372088E-1*t116+0.2061233404E-3*t119-0.7932620886E-4*t1116;
+    t3646 = -0.2369931678E-4*t1151-0.2369931678E-4*t1023-0.1232237092E-6*t1055+
+0.1232237092E-6*t1057+0.9761137487E-4*t1001-0.9761137487E-4*t1003
+-0.2606799616E-2*t1161+0.1112574236E-3*t442+0.8799425961E-3*t422+
+0.3696711277E-6*t953-0.2061233404E-3*t122+0.9970896939E-4*t140+0.101865705E-2*
+t128;
+    t3660 = -0.101865705E-2*t129-0.1607889161E-3*t133+0.1607889161E-3*t137
+-0.1112574236E-3*t444+0.1232237092E-6*t839-0.1232237092E-6*t841-0.8503258945E-4
+*t832+0.8503258945E-4*t834-0.4677530128E-2*t999-0.2606799616E-2*t1159
+-0.9381437244E-4*t1005+0.9381437244E-4*t1007-0.4677530128E-2*t997;
+    t3675 = 0.2570662873E-4*t994-0.8051018213E-4*t1110-0.2606799616E-2*t1021+
+0.7932620886E-4*t1118-0.9999999999*t3284+0.2570662873E-4*t828-0.4677530128E-2*
+t845-0.2606799616E-2*t1017-0.9381437244E-4*t818+0.9381437244E-4*t821+CoM[2]
+-0.8051018213E-4*t1114+0.1512290733E-3*t142;
+    t3690 = 0.8823452451E-4*t143-0.8823452451E-4*t144+0.2369931678E-4*t1025+
+0.9419629563E-2*t165+0.1078086072E-3*t161-0.1078086072E-3*t162-0.8051018213E-4*
+t1146-0.4677530128E-2*t843+0.1081557015E-2*t178+0.1702509553E-4*t837+
+0.2570662873E-4*t995-0.8051018213E-4*t1153+0.2893250095E-3*t170-0.2893250095E-3
+*t171;
+    A[128] = t3587+t3601+t3616+t3630+t3646+t3660+t3675+t3690;
+    A[129] = IGM_CONST(0.0);
+    return;
+  }
@@ -0,0 +1,1212 @@
+/* Generated using codegen (2012-03-12, 10:16:23) */ 
+/*
+ * Body of from_RLeg_3_residual(), the IGM_* macros are described in maple_double.h.
+ * Only the statements of from_RLeg_3_body.h, which are needed to compute the
+ * residuals A[120..129], are kept; the residuals are written to A[0..9].
+ */
+  IGM_REAL t100;
+  IGM_REAL t1001;
+  IGM_REAL t1003;
+  IGM_REAL t1005;
+  IGM_REAL t1007;
+  IGM_REAL t101;
+  IGM_REAL t1014;
+  IGM_REAL t1016;
+  IGM_REAL t1017;
+  IGM_REAL t1019;
+  IGM_REAL t102;
+  IGM_REAL t1020;
+  IGM_REAL t1021;
+  IGM_REAL t1023;
+  IGM_REAL t1025;
+  IGM_REAL t104;
+  IGM_REAL t1049;
+  IGM_REAL t105;
+  IGM_REAL t1050;
+  IGM_REAL t1052;
+  IGM_REAL t1053;
+  IGM_REAL t1055;
+  IGM_REAL t1057;
+  IGM_REAL t107;
+  IGM_REAL t1071;
+  IGM_REAL t1073;
+  IGM_REAL t1074;
+  IGM_REAL t1076;
+  IGM_REAL t1077;
+  IGM_REAL t1078;
+  IGM_REAL t108;
+  IGM_REAL t1080;
+  IGM_REAL t1082;
+  IGM_REAL t109;
+  IGM_REAL t11;
+  IGM_REAL t1107;
+  IGM_REAL t1109;
+  IGM_REAL t1110;
+  IGM_REAL t1112;
+  IGM_REAL t1113;
+  IGM_REAL t1114;
+  IGM_REAL t1116;
+  IGM_REAL t1118;
+  IGM_REAL t112;
+  IGM_REAL t1125;
+  IGM_REAL t1126;
+  IGM_REAL t1128;
+  IGM_REAL t1129;
+  IGM_REAL t113;
+  IGM_REAL t1131;
+  IGM_REAL t1133;
+  IGM_REAL t114;
+  IGM_REAL t1145;
+  IGM_REAL t1146;
+  IGM_REAL t1148;
+  IGM_REAL t1149;
+  IGM_REAL t115;
+  IGM_REAL t1150;
+  IGM_REAL t1151;
+  IGM_REAL t1152;
+  IGM_REAL t1153;
+  IGM_REAL t1155;
+  IGM_REAL t1157;
+  IGM_REAL t1159;
+  IGM_REAL t116;
+  IGM_REAL t1161;
+  IGM_REAL t118;
+  IGM_REAL t119;
+  IGM_REAL t1196;
+  IGM_REAL t1197;
+  IGM_REAL t1199;
+  IGM_REAL t12;
+  IGM_REAL t1200;
+  IGM_REAL t1202;
+  IGM_REAL t1204;
+  IGM_REAL t121;
+  IGM_REAL t1211;
+  IGM_REAL t1212;
+  IGM_REAL t1214;
+  IGM_REAL t1216;
+  IGM_REAL t1218;
+  IGM_REAL t122;
+  IGM_REAL t124;
+  IGM_REAL t126;
+  IGM_REAL t127;
+  IGM_REAL t128;
+  IGM_REAL t129;
+  IGM_REAL t1290;
+  IGM_REAL t1291;
+  IGM_REAL t1292;
+  IGM_REAL t1293;
+  IGM_REAL t1294;
+  IGM_REAL t1295;
+  IGM_REAL t1296;
+  IGM_REAL t1297;
+  IGM_REAL t1298;
+  IGM_REAL t1299;
+  IGM_REAL t13;
+  IGM_REAL t130;
+  IGM_REAL t1300;
+  IGM_REAL t1301;
+  IGM_REAL t1302;
+  IGM_REAL t1303;
+  IGM_REAL t1305;
+  IGM_REAL t1306;
+  IGM_REAL t1307;
+  IGM_REAL t1308;
+  IGM_REAL t1309;
+  IGM_REAL t1310;
+  IGM_REAL t1311;
+  IGM_REAL t1312;
+  IGM_REAL t1313;
+  IGM_REAL t1314;
+  IGM_REAL t1316;
+  IGM_REAL t1318;
+  IGM_REAL t132;
+  IGM_REAL t1320;
+  IGM_REAL t1322;
+  IGM_REAL t133;
+  IGM_REAL t1331;
+  IGM_REAL t1332;
+  IGM_REAL t1333;
+  IGM_REAL t1334;
+  IGM_REAL t1336;
+  IGM_REAL t1337;
+  IGM_REAL t1338;
+  IGM_REAL t1339;
+  IGM_REAL t1340;
+  IGM_REAL t1341;
+  IGM_REAL t1342;
+  IGM_REAL t1344;
+  IGM_REAL t1346;
+  IGM_REAL t1348;
+  IGM_REAL t135;
+  IGM_REAL t1350;
+  IGM_REAL t136;
+  IGM_REAL t1368;
+  IGM_REAL t1369;
+  IGM_REAL t137;
+  IGM_REAL t1371;
+  IGM_REAL t1372;
+  IGM_REAL t1373;
+  IGM_REAL t1374;
+  IGM_REAL t1375;
+  IGM_REAL t1376;
+  IGM_REAL t1378;
+  IGM_REAL t138;
+  IGM_REAL t1380;
+  IGM_REAL t1382;
+  IGM_REAL t1384;
+  IGM_REAL t139;
+  IGM_REAL t14;
+  IGM_REAL t140;
+  IGM_REAL t142;
+  IGM_REAL t143;
+  IGM_REAL t144;
+  IGM_REAL t146;
+  IGM_REAL t1468;
+  IGM_REAL t1470;
+  IGM_REAL t1472;
+  IGM_REAL t1474;
+  IGM_REAL t148;
+  IGM_REAL t1481;
+  IGM_REAL t1482;
+  IGM_REAL t1484;
+  IGM_REAL t1486;
+  IGM_REAL t1488;
+  IGM_REAL t15;
+  IGM_REAL t150;
+  IGM_REAL t151;
+  IGM_REAL t152;
+  IGM_REAL t153;
+  IGM_REAL t154;
+  IGM_REAL t155;
+  IGM_REAL t156;
+  IGM_REAL t157;
+  IGM_REAL t159;
+  IGM_REAL t16;
+  IGM_REAL t160;
+  IGM_REAL t161;
+  IGM_REAL t162;
+  IGM_REAL t163;
+  IGM_REAL t164;
+  IGM_REAL t165;
+  IGM_REAL t166;
+  IGM_REAL t168;
+  IGM_REAL t169;
+  IGM_REAL t170;
+  IGM_REAL t171;
+  IGM_REAL t172;
+  IGM_REAL t173;
+  IGM_REAL t174;
+  IGM_REAL t175;
+  IGM_REAL t177;
+  IGM_REAL t178;
+  IGM_REAL t179;
+  IGM_REAL t18;
+  IGM_REAL t181;
+  IGM_REAL t182;
+  IGM_REAL t183;
+  IGM_REAL t184;
+  IGM_REAL t185;
+  IGM_REAL t186;
+  IGM_REAL t187;
+  IGM_REAL t188;
+  IGM_REAL t19;
+  IGM_REAL t192;
+  IGM_REAL t193;
+  IGM_REAL t194;
+  IGM_REAL t195;
+  IGM_REAL t196;
+  IGM_REAL t197;
+  IGM_REAL t199;
+  IGM_REAL t2;
+  IGM_REAL t20;
+  IGM_REAL t200;
+  IGM_REAL t201;
+  IGM_REAL t202;
+  IGM_REAL t204;
+  IGM_REAL t205;
+  IGM_REAL t206;
+  IGM_REAL t208;
+  IGM_REAL t21;
+  IGM_REAL t210;
+  IGM_REAL t211;
+  IGM_REAL t212;
+  IGM_REAL t213;
+  IGM_REAL t214;
+  IGM_REAL t215;
+  IGM_REAL t216;
+  IGM_REAL t217;
+  IGM_REAL t218;
+  IGM_REAL t219;
+  IGM_REAL t22;
+  IGM_REAL t220;
+  IGM_REAL t221;
+  IGM_REAL t222;
+  IGM_REAL t223;
+  IGM_REAL t224;
+  IGM_REAL t225;
+  IGM_REAL t226;
+  IGM_REAL t227;
+  IGM_REAL t228;
+  IGM_REAL t229;
+  IGM_REAL t23;
+  IGM_REAL t230;
+  IGM_REAL t232;
+  IGM_REAL t233;
+  IGM_REAL t234;
+  IGM_REAL t235;
+  IGM_REAL t236;
+  IGM_REAL t237;
+  IGM_REAL t238;
+  IGM_REAL t24;
+  IGM_REAL t241;
+  IGM_REAL t242;
+  IGM_REAL t243;
+  IGM_REAL t244;
+  IGM_REAL t245;
+  IGM_REAL t246;
+  IGM_REAL t247;
+  IGM_REAL t248;
+  IGM_REAL t249;
+  IGM_REAL t25;
+  IGM_REAL t250;
+  IGM_REAL t251;
+  IGM_REAL t252;
+  IGM_REAL t253;
+  IGM_REAL t254;
+  IGM_REAL t255;
+  IGM_REAL t256;
+  IGM_REAL t257;
+  IGM_REAL t258;
+  IGM_REAL t259;
+  IGM_REAL t260;
+  IGM_REAL t261;
+  IGM_REAL t266;
+  IGM_REAL t267;
+  IGM_REAL t268;
+  IGM_REAL t269;
+  IGM_REAL t27;
+  IGM_REAL t270;
+  IGM_REAL t272;
+  IGM_REAL t273;
+  IGM_REAL t275;
+  IGM_REAL t276;
+  IGM_REAL t277;
+  IGM_REAL t28;
+  IGM_REAL t280;
+  IGM_REAL t281;
+  IGM_REAL t282;
+  IGM_REAL t283;
+  IGM_REAL t284;
+  IGM_REAL t286;
+  IGM_REAL t287;
+  IGM_REAL t289;
+  IGM_REAL t29;
+  IGM_REAL t290;
+  IGM_REAL t292;
+  IGM_REAL t293;
+  IGM_REAL t294;
+  IGM_REAL t295;
+  IGM_REAL t296;
+  IGM_REAL t297;
+  IGM_REAL t299;
+  IGM_REAL t30;
+  IGM_REAL t300;
+  IGM_REAL t301;
+  IGM_REAL t302;
+  IGM_REAL t304;
+  IGM_REAL t305;
+  IGM_REAL t306;
+  IGM_REAL t308;
+  IGM_REAL t31;
+  IGM_REAL t310;
+  IGM_REAL t311;
+  IGM_REAL t312;
+  IGM_REAL t313;
+  IGM_REAL t314;
+  IGM_REAL t315;
+  IGM_REAL t316;
+  IGM_REAL t317;
+  IGM_REAL t318;
+  IGM_REAL t319;
+  IGM_REAL t32;
+  IGM_REAL t320;
+  IGM_REAL t321;
+  IGM_REAL t322;
+  IGM_REAL t323;
+  IGM_REAL t324;
+  IGM_REAL t325;
+  IGM_REAL t326;
+  IGM_REAL t327;
+  IGM_REAL t3270;
+  IGM_REAL t3277;
+  IGM_REAL t328;
+  IGM_REAL t3284;
+  IGM_REAL t3285;
+  IGM_REAL t3288;
+  IGM_REAL t329;
+  IGM_REAL t3291;
+  IGM_REAL t3292;
+  IGM_REAL t3295;
+  IGM_REAL t3296;
+  IGM_REAL t3299;
+  IGM_REAL t33;
+  IGM_REAL t330;
+  IGM_REAL t3300;
+  IGM_REAL t3303;
+  IGM_REAL t3304;
+  IGM_REAL t3307;
+  IGM_REAL t3312;
+  IGM_REAL t3315;
+  IGM_REAL t3318;
+  IGM_REAL t332;
+  IGM_REAL t3321;
+  IGM_REAL t333;
+  IGM_REAL t334;
+  IGM_REAL t3349;
+  IGM_REAL t335;
+  IGM_REAL t336;
+  IGM_REAL t3363;
+  IGM_REAL t337;
+  IGM_REAL t3378;
+  IGM_REAL t338;
+  IGM_REAL t3392;
+  IGM_REAL t34;
+  IGM_REAL t3408;
+  IGM_REAL t3422;
+  IGM_REAL t3437;
+  IGM_REAL t3452;
+  IGM_REAL t3468;
+  IGM_REAL t3482;
+  IGM_REAL t3497;
+  IGM_REAL t3511;
+  IGM_REAL t3527;
+  IGM_REAL t3541;
+  IGM_REAL t3556;
+  IGM_REAL t3571;
+  IGM_REAL t3587;
+  IGM_REAL t36;
+  IGM_REAL t3601;
+  IGM_REAL t3616;
+  IGM_REAL t3630;
+  IGM_REAL t3646;
+  IGM_REAL t3660;
+  IGM_REAL t3675;
+  IGM_REAL t3690;
+  IGM_REAL t4;
+  IGM_REAL t41;
+  IGM_REAL t42;
+  IGM_REAL t420;
+  IGM_REAL t422;
+  IGM_REAL t43;
+  IGM_REAL t431;
+  IGM_REAL t433;
+  IGM_REAL t44;
+  IGM_REAL t442;
+  IGM_REAL t444;
+  IGM_REAL t45;
+  IGM_REAL t453;
+  IGM_REAL t455;
+  IGM_REAL t46;
+  IGM_REAL t48;
+  IGM_REAL t5;
+  IGM_REAL t50;
+  IGM_REAL t509;
+  IGM_REAL t51;
+  IGM_REAL t511;
+  IGM_REAL t522;
+  IGM_REAL t524;
+  IGM_REAL t53;
+  IGM_REAL t54;
+  IGM_REAL t55;
+  IGM_REAL t56;
+  IGM_REAL t57;
+  IGM_REAL t6;
+  IGM_REAL t60;
+  IGM_REAL t61;
+  IGM_REAL t62;
+  IGM_REAL t63;
+  IGM_REAL t64;
+  IGM_REAL t66;
+  IGM_REAL t67;
+  IGM_REAL t69;
+  IGM_REAL t7;
+  IGM_REAL t70;
+  IGM_REAL t72;
+  IGM_REAL t73;
+  IGM_REAL t74;
+  IGM_REAL t75;
+  IGM_REAL t76;
+  IGM_REAL t77;
+  IGM_REAL t771;
+  IGM_REAL t773;
+  IGM_REAL t776;
+  IGM_REAL t78;
+  IGM_REAL t79;
+  IGM_REAL t793;
+  IGM_REAL t794;
+  IGM_REAL t798;
+  IGM_REAL t799;
+  IGM_REAL t8;
+  IGM_REAL t80;
+  IGM_REAL t802;
+  IGM_REAL t803;
+  IGM_REAL t81;
+  IGM_REAL t817;
+  IGM_REAL t818;
+  IGM_REAL t819;
+  IGM_REAL t82;
+  IGM_REAL t820;
+  IGM_REAL t821;
+  IGM_REAL t822;
+  IGM_REAL t824;
+  IGM_REAL t825;
+  IGM_REAL t827;
+  IGM_REAL t828;
+  IGM_REAL t829;
+  IGM_REAL t83;
+  IGM_REAL t831;
+  IGM_REAL t832;
+  IGM_REAL t833;
+  IGM_REAL t834;
+  IGM_REAL t835;
+  IGM_REAL t836;
+  IGM_REAL t837;
+  IGM_REAL t839;
+  IGM_REAL t84;
+  IGM_REAL t841;
+  IGM_REAL t843;
+  IGM_REAL t845;
+  IGM_REAL t85;
+  IGM_REAL t86;
+  IGM_REAL t865;
+  IGM_REAL t866;
+  IGM_REAL t868;
+  IGM_REAL t869;
+  IGM_REAL t87;
+  IGM_REAL t871;
+  IGM_REAL t873;
+  IGM_REAL t88;
+  IGM_REAL t881;
+  IGM_REAL t882;
+  IGM_REAL t883;
+  IGM_REAL t884;
+  IGM_REAL t885;
+  IGM_REAL t886;
+  IGM_REAL t888;
+  IGM_REAL t889;
+  IGM_REAL t89;
+  IGM_REAL t890;
+  IGM_REAL t891;
+  IGM_REAL t892;
+  IGM_REAL t894;
+  IGM_REAL t895;
+  IGM_REAL t897;
+  IGM_REAL t898;
+  IGM_REAL t899;
+  IGM_REAL t9;
+  IGM_REAL t90;
+  IGM_REAL t901;
+  IGM_REAL t902;
+  IGM_REAL t903;
+  IGM_REAL t904;
+  IGM_REAL t905;
+  IGM_REAL t906;
+  IGM_REAL t907;
+  IGM_REAL t908;
+  IGM_REAL t909;
+  IGM_REAL t91;
+  IGM_REAL t910;
+  IGM_REAL t912;
+  IGM_REAL t914;
+  IGM_REAL t916;
+  IGM_REAL t918;
+  IGM_REAL t92;
+  IGM_REAL t927;
+  IGM_REAL t928;
+  IGM_REAL t929;
+  IGM_REAL t93;
+  IGM_REAL t930;
+  IGM_REAL t932;
+  IGM_REAL t933;
+  IGM_REAL t934;
+  IGM_REAL t935;
+  IGM_REAL t936;
+  IGM_REAL t937;
+  IGM_REAL t938;
+  IGM_REAL t940;
+  IGM_REAL t942;
+  IGM_REAL t944;
+  IGM_REAL t946;
+  IGM_REAL t953;
+  IGM_REAL t954;
+  IGM_REAL t955;
+  IGM_REAL t957;
+  IGM_REAL t958;
+  IGM_REAL t960;
+  IGM_REAL t961;
+  IGM_REAL t963;
+  IGM_REAL t965;
+  IGM_REAL t967;
+  IGM_REAL t969;
+  IGM_REAL t98;
+  IGM_REAL t99;
+  IGM_REAL t994;
+  IGM_REAL t995;
+  IGM_REAL t996;
+  IGM_REAL t997;
+  IGM_REAL t999;
+  IGM_REAL tA53;
+  IGM_REAL tA54;
+  IGM_REAL tA55;
+  {
+    t2 = RL[9];
+    t4 = IGM_COS_Q(11);
+    t5 = t2*t4;
+    t6 = RL[5];
+    t7 = IGM_SIN_Q(11);
+    t8 = t6*t7;
+    t9 = -t5-t8;
+    t11 = IGM_COS_Q(10);
+    t12 = t9*t11;
+    t13 = RL[1];
+    t14 = IGM_SIN_Q(10);
+    t15 = t13*t14;
+    t16 = t12+t15;
+    t18 = IGM_COS_Q(9);
+    t19 = t16*t18;
+    t20 = t9*t14;
+    t21 = t13*t11;
+    t22 = t20-t21;
+    t23 = IGM_SIN_Q(9);
+    t24 = t22*t23;
+    t25 = t19-t24;
+    t27 = IGM_SIN_Q(8);
+    t28 = t25*t27;
+    t29 = t16*t23;
+    t30 = t22*t18;
+    t31 = t29+t30;
+    t32 = IGM_COS_Q(8);
+    t33 = t31*t32;
+    t34 = -t28-t33;
+    t36 = IGM_SIN_Q(6);
+    t41 = IGM_CONST(sqrt(2.0));
+    t42 = (t25*t32-t31*t27)*t41;
+    t43 = t2*t7;
+    t44 = t6*t4;
+    t45 = -t43+t44;
+    t46 = t45*t41;
+    t48 = t42/2.0-t46/2.0;
+    t50 = IGM_SIN_Q(7);
+    t51 = t48*t50;
+    t53 = t42/2.0+t46/2.0;
+    t54 = IGM_COS_Q(7);
+    t55 = t53*t54;
+    t56 = t51+t55;
+    t57 = IGM_COS_Q(6);
+    t60 = (t34*t36+t56*t57)*t41;
+    t61 = t48*t54;
+    t62 = t53*t50;
+    t63 = -t61+t62;
+    t64 = t63*t41;
+    t66 = t60/2.0+t64/2.0;
+    t67 = t66*t41;
+    t69 = -t60/2.0+t64/2.0;
+    t70 = t69*t41;
+    t72 = t67/2.0-t70/2.0;
+    t73 = RL[10];
+    t74 = t73*t4;
+    t75 = RL[6];
+    t76 = t75*t7;
+    t77 = -t74-t76;
+    t78 = t77*t11;
+    t79 = RL[2];
+    t80 = t79*t14;
+    t81 = t78+t80;
+    t82 = t81*t18;
+    t83 = t77*t14;
+    t84 = t79*t11;
+    t85 = t83-t84;
+    t86 = t85*t23;
+    t87 = t82-t86;
+    t88 = t87*t27;
+    t89 = t81*t23;
+    t90 = t85*t18;
+    t91 = t89+t90;
+    t92 = t91*t32;
+    t93 = -t88-t92;
+    t98 = (t87*t32-t91*t27)*t41;
+    t99 = t73*t7;
+    t100 = t75*t4;
+    t101 = -t99+t100;
+    t102 = t101*t41;
+    t104 = t98/2.0-t102/2.0;
+    t105 = t104*t50;
+    t107 = t98/2.0+t102/2.0;
+    t108 = t107*t54;
+    t109 = t105+t108;
+    t112 = (t93*t36+t109*t57)*t41;
+    t113 = t104*t54;
+    t114 = t107*t50;
+    t115 = -t113+t114;
+    t116 = t115*t41;
+    t118 = t112/2.0+t116/2.0;
+    t119 = t118*t41;
+    t121 = -t112/2.0+t116/2.0;
+    t122 = t121*t41;
+    t124 = -t119/2.0+t122/2.0;
+    t126 = IGM_COS_Q(1);
+    t127 = t124*t126;
+    t128 = t93*t57;
+    t129 = t109*t36;
+    t130 = t128-t129;
+    t132 = IGM_SIN_Q(0);
+    t133 = t130*t132;
+    t135 = -t119/2.0-t122/2.0;
+    t136 = IGM_COS_Q(0);
+    t137 = t135*t136;
+    t138 = -t133+t137;
+    t139 = IGM_SIN_Q(1);
+    t140 = t138*t139;
+    t142 = (t127+t140)*t41;
+    t143 = t124*t139;
+    t144 = t138*t126;
+    t146 = (-t143+t144)*t41;
+    t148 = t142/2.0-t146/2.0;
+    t150 = IGM_COS_Q(2);
+    t151 = t148*t150;
+    t152 = t130*t136;
+    t153 = t135*t132;
+    t154 = t152+t153;
+    t155 = IGM_SIN_Q(2);
+    t156 = t154*t155;
+    t157 = t151+t156;
+    t159 = IGM_COS_Q(3);
+    t160 = t157*t159;
+    t161 = t148*t155;
+    t162 = t154*t150;
+    t163 = -t161+t162;
+    t164 = IGM_SIN_Q(3);
+    t165 = t163*t164;
+    t166 = t160+t165;
+    t168 = IGM_COS_Q(4);
+    t169 = t166*t168;
+    t170 = t157*t164;
+    t171 = t163*t159;
+    t172 = -t170+t171;
+    t173 = IGM_SIN_Q(4);
+    t174 = t172*t173;
+    t175 = t169+t174;
+    t177 = IGM_COS_Q(5);
+    t178 = t175*t177;
+    t179 = 0.4511E-1*t178;
+    t181 = t142/2.0+t146/2.0;
+    t182 = IGM_SIN_Q(5);
+    t183 = t181*t182;
+    t184 = 0.4511E-1*t183;
+    t185 = 0.10274*t160;
+    t186 = 0.10274*t165;
+    t187 = 0.1*t151;
+    t188 = 0.1*t156;
+    t192 = -t72;
+    t193 = t192*t126;
+    t194 = t34*t57;
+    t195 = t56*t36;
+    t196 = t194-t195;
+    t197 = t196*t132;
+    t199 = -t67/2.0-t70/2.0;
+    t200 = t199*t136;
+    t201 = -t197+t200;
+    t202 = t201*t139;
+    t204 = (t193+t202)*t41;
+    t205 = t192*t139;
+    t206 = t201*t126;
+    t208 = (-t205+t206)*t41;
+    t210 = t204/2.0-t208/2.0;
+    t211 = t210*t150;
+    t212 = t196*t136;
+    t213 = t199*t132;
+    t214 = t212+t213;
+    t215 = t214*t155;
+    t216 = t211+t215;
+    t217 = t216*t159;
+    t218 = t210*t155;
+    t219 = t214*t150;
+    t220 = -t218+t219;
+    t221 = t220*t164;
+    t222 = t217+t221;
+    t223 = t222*t168;
+    t224 = t216*t164;
+    t225 = t220*t159;
+    t226 = -t224+t225;
+    t227 = t226*t173;
+    t228 = t223+t227;
+    t229 = t228*t177;
+    t230 = 0.4511E-1*t229;
+    t232 = t204/2.0+t208/2.0;
+    t233 = t232*t182;
+    t234 = 0.4511E-1*t233;
+    t235 = 0.10274*t217;
+    t236 = 0.10274*t221;
+    t237 = 0.1*t211;
+    t238 = 0.1*t215;
+    t241 = RL[8];
+    t242 = t241*t4;
+    t243 = RL[4];
+    t244 = t243*t7;
+    t245 = -t242-t244;
+    t246 = t245*t11;
+    t247 = RL[0];
+    t248 = t247*t14;
+    t249 = t246+t248;
+    t250 = t249*t18;
+    t251 = t245*t14;
+    t252 = t247*t11;
+    t253 = t251-t252;
+    t254 = t253*t23;
+    t255 = t250-t254;
+    t256 = t255*t27;
+    t257 = t249*t23;
+    t258 = t253*t18;
+    t259 = t257+t258;
+    t260 = t259*t32;
+    t261 = -t256-t260;
+    t266 = (t255*t32-t259*t27)*t41;
+    t267 = t241*t7;
+    t268 = t243*t4;
+    t269 = -t267+t268;
+    t270 = t269*t41;
+    t272 = t266/2.0-t270/2.0;
+    t273 = t272*t50;
+    t275 = t266/2.0+t270/2.0;
+    t276 = t275*t54;
+    t277 = t273+t276;
+    t280 = (t261*t36+t277*t57)*t41;
+    t281 = t272*t54;
+    t282 = t275*t50;
+    t283 = -t281+t282;
+    t284 = t283*t41;
+    t286 = t280/2.0+t284/2.0;
+    t287 = t286*t41;
+    t289 = -t280/2.0+t284/2.0;
+    t290 = t289*t41;
+    t292 = -t287/2.0+t290/2.0;
+    t293 = t292*t126;
+    t294 = t261*t57;
+    t295 = t277*t36;
+    t296 = t294-t295;
+    t297 = t296*t132;
+    t299 = -t287/2.0-t290/2.0;
+    t300 = t299*t136;
+    t301 = -t297+t300;
+    t302 = t301*t139;
+    t304 = (t293+t302)*t41;
+    t305 = t292*t139;
+    t306 = t301*t126;
+    t308 = (-t305+t306)*t41;
+    t310 = t304/2.0-t308/2.0;
+    t311 = t310*t150;
+    t312 = t296*t136;
+    t313 = t299*t132;
+    t314 = t312+t313;
+    t315 = t314*t155;
+    t316 = t311+t315;
+    t317 = t316*t159;
+    t318 = t310*t155;
+    t319 = t314*t150;
+    t320 = -t318+t319;
+    t321 = t320*t164;
+    t322 = t317+t321;
+    t323 = t322*t168;
+    t324 = t316*t164;
+    t325 = t320*t159;
+    t326 = -t324+t325;
+    t327 = t326*t173;
+    t328 = t323+t327;
+    t329 = t328*t177;
+    t330 = 0.4511E-1*t329;
+    t332 = t304/2.0+t308/2.0;
+    t333 = t332*t182;
+    t334 = 0.4511E-1*t333;
+    t335 = 0.10274*t317;
+    t336 = 0.10274*t321;
+    t337 = 0.1*t311;
+    t338 = 0.1*t315;
+    t420 = t172*t168;
+    t422 = t166*t173;
+    t431 = t226*t168;
+    t433 = t222*t173;
+    t442 = t181*t177;
+    t444 = t175*t182;
+    t453 = t232*t177;
+    t455 = t228*t182;
+    t509 = t326*t168;
+    t511 = t322*t173;
+    t522 = t332*t177;
+    t524 = t328*t182;
+    t771 = -t433+t431;
+    t773 = -t422+t420;
+    t776 = -t511+t509;
+    tA53 = t776;
+    tA54 = t771;
+    tA55 = t773;
+    t793 = 0.5E-1*t112;
+    t794 = 0.5E-1*t116;
+    t798 = 0.5E-1*t60;
+    t799 = 0.5E-1*t64;
+    t802 = 0.5E-1*t280;
+    t803 = 0.5E-1*t284;
+    t817 = IGM_SIN_Q(17);
+    t818 = t130*t817;
+    t819 = -t121;
+    t820 = IGM_COS_Q(17);
+    t821 = t819*t820;
+    t822 = -t818+t821;
+    t824 = IGM_COS_Q(19);
+    t825 = t822*t824;
+    t827 = t130*t820;
+    t828 = t819*t817;
+    t829 = t827+t828;
+    t831 = IGM_SIN_Q(18);
+    t832 = t829*t831;
+    t833 = IGM_COS_Q(18);
+    t834 = t118*t833;
+    t835 = -t832+t834;
+    t836 = IGM_SIN_Q(19);
+    t837 = t835*t836;
+    t839 = t822*t836;
+    t841 = t835*t824;
+    t843 = t829*t833;
+    t845 = t118*t831;
+    t865 = IGM_COS_Q(22);
+    t866 = t196*t865;
+    t868 = IGM_SIN_Q(22);
+    t869 = t66*t868;
+    t871 = t196*t868;
+    t873 = t66*t865;
+    t881 = IGM_COS_Q(12);
+    t882 = t196*t881;
+    t883 = -t69;
+    t884 = IGM_SIN_Q(12);
+    t885 = t883*t884;
+    t886 = t882+t885;
+    t888 = IGM_COS_Q(13);
+    t889 = t886*t888;
+    t890 = IGM_SIN_Q(13);
+    t891 = t66*t890;
+    t892 = t889+t891;
+    t894 = IGM_COS_Q(15);
+    t895 = t892*t894;
+    t897 = t196*t884;
+    t898 = t883*t881;
+    t899 = -t897+t898;
+    t901 = IGM_SIN_Q(14);
+    t902 = t899*t901;
+    t903 = t886*t890;
+    t904 = t66*t888;
+    t905 = -t903+t904;
+    t906 = IGM_COS_Q(14);
+    t907 = t905*t906;
+    t908 = -t902+t907;
+    t909 = IGM_SIN_Q(15);
+    t910 = t908*t909;
+    t912 = t892*t909;
+    t914 = t908*t894;
+    t916 = t899*t906;
+    t918 = t905*t901;
+    t927 = t196*t817;
+    t928 = t883*t820;
+    t929 = -t927+t928;
+    t930 = t929*t824;
+    t932 = t196*t820;
+    t933 = t883*t817;
+    t934 = t932+t933;
+    t935 = t934*t831;
+    t936 = t66*t833;
+    t937 = -t935+t936;
+    t938 = t937*t836;
+    t940 = t929*t836;
+    t942 = t937*t824;
+    t944 = t934*t833;
+    t946 = t66*t831;
+    t953 = t130*t865;
+    t954 = t118*t868;
+    t955 = t953+t954;
+    t957 = IGM_COS_Q(23);
+    t958 = t955*t957;
+    t960 = IGM_SIN_Q(23);
+    t961 = t819*t960;
+    t963 = t955*t960;
+    t965 = t819*t957;
+    t967 = t130*t868;
+    t969 = t118*t865;
+    t994 = t130*t881;
+    t995 = t819*t884;
+    t996 = t994+t995;
+    t997 = t996*t888;
+    t999 = t118*t890;
+    t1001 = t996*t890;
+    t1003 = t118*t888;
+    t1005 = t130*t884;
+    t1007 = t819*t881;
+    t1014 = t843+t845;
+    t1016 = IGM_COS_Q(20);
+    t1017 = t1014*t1016;
+    t1019 = -t839+t841;
+    t1020 = IGM_SIN_Q(20);
+    t1021 = t1019*t1020;
+    t1023 = t1014*t1020;
+    t1025 = t1019*t1016;
+    t1049 = -t1005+t1007;
+    t1050 = t1049*t906;
+    t1052 = -t1001+t1003;
+    t1053 = t1052*t901;
+    t1055 = t1049*t901;
+    t1057 = t1052*t906;
+    t1071 = t916+t918;
+    t1073 = IGM_COS_Q(16);
+    t1074 = t1071*t1073;
+    t1076 = -t912+t914;
+    t1077 = IGM_SIN_Q(16);
+    t1078 = t1076*t1077;
+    t1080 = t1071*t1077;
+    t1082 = t1076*t1073;
+    t1107 = t825+t837;
+    t1109 = IGM_COS_Q(21);
+    t1110 = t1107*t1109;
+    t1112 = -t1023+t1025;
+    t1113 = IGM_SIN_Q(21);
+    t1114 = t1112*t1113;
+    t1116 = t1107*t1113;
+    t1118 = t1112*t1109;
+    t1125 = t944+t946;
+    t1126 = t1125*t1016;
+    t1128 = -t940+t942;
+    t1129 = t1128*t1020;
+    t1131 = t1125*t1020;
+    t1133 = t1128*t1016;
+    t1145 = t1050+t1053;
+    t1146 = t1145*t1073;
+    t1148 = t997+t999;
+    t1149 = t1148*t909;
+    t1150 = -t1055+t1057;
+    t1151 = t1150*t894;
+    t1152 = -t1149+t1151;
+    t1153 = t1152*t1077;
+    t1155 = t1145*t1077;
+    t1157 = t1152*t1073;
+    t1159 = t1148*t894;
+    t1161 = t1150*t909;
+    t1196 = t930+t938;
+    t1197 = t1196*t1109;
+    t1199 = -t1131+t1133;
+    t1200 = t1199*t1113;
+    t1202 = t1196*t1113;
+    t1204 = t1199*t1109;
+    t1211 = t866+t869;
+    t1212 = t1211*t957;
+    t1214 = t883*t960;
+    t1216 = t1211*t960;
+    t1218 = t883*t957;
+    t1290 = t296*t884;
+    t1291 = -t289;
+    t1292 = t1291*t881;
+    t1293 = -t1290+t1292;
+    t1294 = t1293*t906;
+    t1295 = t296*t881;
+    t1296 = t1291*t884;
+    t1297 = t1295+t1296;
+    t1298 = t1297*t890;
+    t1299 = t286*t888;
+    t1300 = -t1298+t1299;
+    t1301 = t1300*t901;
+    t1302 = t1294+t1301;
+    t1303 = t1302*t1073;
+    t1305 = t1297*t888;
+    t1306 = t286*t890;
+    t1307 = t1305+t1306;
+    t1308 = t1307*t909;
+    t1309 = t1293*t901;
+    t1310 = t1300*t906;
+    t1311 = -t1309+t1310;
+    t1312 = t1311*t894;
+    t1313 = -t1308+t1312;
+    t1314 = t1313*t1077;
+    t1316 = t1302*t1077;
+    t1318 = t1313*t1073;
+    t1320 = t1307*t894;
+    t1322 = t1311*t909;
+    t1331 = t296*t817;
+    t1332 = t1291*t820;
+    t1333 = -t1331+t1332;
+    t1334 = t1333*t824;
+    t1336 = t296*t820;
+    t1337 = t1291*t817;
+    t1338 = t1336+t1337;
+    t1339 = t1338*t831;
+    t1340 = t286*t833;
+    t1341 = -t1339+t1340;
+    t1342 = t1341*t836;
+    t1344 = t1333*t836;
+    t1346 = t1341*t824;
+    t1348 = t1338*t833;
+    t1350 = t286*t831;
+    t1368 = t1334+t1342;
+    t1369 = t1368*t1109;
+    t1371 = t1348+t1350;
+    t1372 = t1371*t1020;
+    t1373 = -t1344+t1346;
+    t1374 = t1373*t1016;
+    t1375 = -t1372+t1374;
+    t1376 = t1375*t1113;
+    t1378 = t1368*t1113;
+    t1380 = t1375*t1109;
+    t1382 = t1371*t1016;
+    t1384 = t1373*t1020;
+    t1468 = t296*t865;
+    t1470 = t286*t868;
+    t1472 = t296*t868;
+    t1474 = t286*t865;
+    t1481 = t1468+t1470;
+    t1482 = t1481*t957;
+    t1484 = t1291*t960;
+    t1486 = t1481*t960;
+    t1488 = t1291*t957;
+    t3270 = RL[12];
+    A[0] = LL[12]+t330+t334+t335+t336+t337+t338-t802-t803+0.1*t250-0.1*t254+
+0.10274*t246+0.10274*t248-0.4511E-1*t241-t3270;
+    t3277 = RL[13];
+    A[1] = LL[13]+t230+t234+t235+t236+t237+t238-t798-t799+0.1*t19-0.1*t24+
+0.10274*t12+0.10274*t15-0.4511E-1*t2-t3277;
+    t3284 = RL[14];
+    A[2] = LL[14]+t179+t184+t185+t186+t187+t188-t793-t794+0.1*t82-0.1*t86+
+0.10274*t78+0.10274*t80-0.4511E-1*t73-t3284;
+    t3285 = LL[2];
+    t3288 = LL[1];
+    t3291 = LL[6];
+    t3292 = t455-t453;
+    t3295 = LL[5];
+    t3296 = t444-t442;
+    t3299 = LL[10];
+    t3300 = t229+t233;
+    t3303 = LL[9];
+    t3304 = t178+t183;
+    A[3] = 0.5*t3285*tA54-0.5*t3288*tA55+0.5*t3291*t3292-0.5*t3295*t3296+
+0.5*t3299*t3300-0.5*t3303*t3304;
+    t3307 = LL[0];
+    t3312 = LL[4];
+    t3315 = t524-t522;
+    t3318 = LL[8];
+    t3321 = t329+t333;
+    A[4] = 0.5*t3307*tA55-0.5*t3285*tA53+0.5*t3312*t3296-0.5*t3291*t3315+
+0.5*t3318*t3304-0.5*t3299*t3321;
+    A[5] = 0.5*t3288*tA53-0.5*t3307*tA54+0.5*t3295*t3315-0.5*t3312*t3292+
+0.5*t3303*t3321-0.5*t3318*t3300;
+    t3349 = 0.8799425961E-3*t511-0.1112574236E-3*t524-0.2369931678E-4*t1372+
+0.1112574236E-3*t522-0.8051018213E-4*t1303-0.2606799616E-2*t1382
+-0.9381437244E-4*t1331+0.9381437244E-4*t1332+0.1232237092E-6*t1344
+-0.1232237092E-6*t1346-0.7932620886E-4*t1318+0.1512290733E-3*t304+
+0.9761137487E-4*t1298;
+    t3363 = -0.9761137487E-4*t1299-0.2606799616E-2*t1322+0.5082624939E-2*t1488+
+0.8823452451E-4*t305-0.8823452451E-4*t306+CoM[0]-0.4402844298E-1*t241+
+0.1112574236E-3*t243-0.8799425961E-3*t247-0.8503258945E-4*t1339+0.8503258945E-4
+*t1340-0.2606799616E-2*t1384+0.1081557015E-2*t329;
+    t3378 = 0.7932620886E-4*t1316+0.1512290733E-3*t308+0.1681938551E-1*t315+
+0.5687628827E-3*t312+0.5687628827E-3*t313-0.1832763156E-3*t323+0.9419629563E-2*
+t317+0.1681938551E-1*t311+0.9970896939E-4*t293+0.8318061448E-1*t250+
+0.9332037043E-1*t246-0.1832763156E-3*t242-0.1832763156E-3*t244;
+    t3392 = 0.9332037043E-1*t248+0.2893250095E-3*t251-0.2893250095E-3*t252
+-0.8318061448E-1*t254-0.5687628827E-3*t256+0.1078086072E-3*t257+0.1078086072E-3
+*t258-0.5687628827E-3*t260+0.1607889161E-3*t273-0.9397174694E-4*t266
+-0.3024581465E-3*t267+0.3024581465E-3*t268+0.5737222431E-5*t270;
+    t3408 = 0.1607889161E-3*t276+0.1659098766E-1*t280+0.4122466806E-3*t281
+-0.4122466806E-3*t282-0.6660372088E-1*t284+0.2061233404E-3*t287+0.1702509553E-4
+*t1301-0.9999999999*t3270-0.2061233404E-3*t290+0.9970896939E-4*t302+
+0.101865705E-2*t294-0.101865705E-2*t295-0.1607889161E-3*t297;
+    t3422 = 0.1607889161E-3*t300+0.7932620886E-4*t1380-0.2606799616E-2*t1320
+-0.9381437244E-4*t1290+0.9381437244E-4*t1292-0.1232237092E-6*t1309+
+0.1232237092E-6*t1310-0.8051018213E-4*t1369+0.9419629563E-2*t321
+-0.8051018213E-4*t1376+0.2369931678E-4*t1374+0.1702509553E-4*t1334
+-0.4677530128E-2*t1348;
+    t3437 = 0.2570662873E-4*t1336+0.2570662873E-4*t1337-0.4677530128E-2*t1350
+-0.2369931678E-4*t1312+0.1702509553E-4*t1294+0.3696711277E-6*t1470
+-0.8945848979E-4*t1472-0.8051018213E-4*t1314-0.4677530128E-2*t1305+
+0.2570662873E-4*t1295+0.2570662873E-4*t1296-0.4677530128E-2*t1306+
+0.1702509553E-4*t1342;
+    t3452 = -0.1832763156E-3*t327-0.8799425961E-3*t509-0.3775495252E-3*t1482
+-0.3775495252E-3*t1484-0.5082624939E-2*t1486+0.8945848979E-4*t1474
+-0.7932620886E-4*t1378+0.1081557015E-2*t333+0.1078086072E-3*t318
+-0.1078086072E-3*t319+0.2893250095E-3*t324-0.2893250095E-3*t325+0.2369931678E-4
+*t1308+0.3696711277E-6*t1468;
+    A[6] = t3349+t3363+t3378+t3392+t3408+t3422+t3437+t3452;
+    t3468 = 0.8823452451E-4*t205-0.8823452451E-4*t206-0.2606799616E-2*t895
+-0.101865705E-2*t195-0.1607889161E-3*t197+0.1607889161E-3*t200+0.1512290733E-3*
+t204+0.8945848979E-4*t873-0.8503258945E-4*t935+0.8503258945E-4*t936
+-0.2606799616E-2*t1129-0.8051018213E-4*t1078+0.7932620886E-4*t1204;
+    t3482 = 0.2893250095E-3*t224-0.2893250095E-3*t225-0.8799425961E-3*t431+
+0.1702509553E-4*t918-0.4677530128E-2*t944+0.2570662873E-4*t932+0.8318061448E-1*
+t19+0.9332037043E-1*t12-0.1832763156E-3*t5-0.1832763156E-3*t8+0.9332037043E-1*
+t15+0.2893250095E-3*t20-0.2893250095E-3*t21;
+    t3497 = -0.8318061448E-1*t24-0.5687628827E-3*t28+0.1078086072E-3*t29+
+0.1078086072E-3*t30-0.5687628827E-3*t33+0.1607889161E-3*t51-0.9397174694E-4*t42
+-0.3024581465E-3*t43+0.3024581465E-3*t44+0.5737222431E-5*t46+0.1607889161E-3*
+t55+0.1659098766E-1*t60+0.4122466806E-3*t61;
+    t3511 = -0.4122466806E-3*t62-0.6660372088E-1*t64+0.2061233404E-3*t67
+-0.2061233404E-3*t70-0.1832763156E-3*t223+0.9419629563E-2*t217+0.1681938551E-1*
+t211+0.9970896939E-4*t193+0.1081557015E-2*t233+0.3696711277E-6*t866+
+0.3696711277E-6*t869-0.8945848979E-4*t871-0.9381437244E-4*t897;
+    t3527 = 0.9381437244E-4*t898-0.1232237092E-6*t902+0.1232237092E-6*t907
+-0.7932620886E-4*t1202+0.2570662873E-4*t933-0.4677530128E-2*t946+CoM[1]
+-0.3775495252E-3*t1212-0.3775495252E-3*t1214-0.5082624939E-2*t1216+
+0.9419629563E-2*t221+0.2369931678E-4*t912-0.1832763156E-3*t227;
+    t3541 = -0.9999999999*t3277+0.1702509553E-4*t916+0.1702509553E-4*t930+
+0.9761137487E-4*t903-0.9761137487E-4*t904-0.2606799616E-2*t910+0.9970896939E-4*
+t202+0.101865705E-2*t194+0.1512290733E-3*t208+0.1681938551E-1*t215+
+0.5687628827E-3*t212+0.5687628827E-3*t213-0.4677530128E-2*t891;
+    t3556 = 0.1112574236E-3*t453-0.2369931678E-4*t914-0.8051018213E-4*t1200
+-0.7932620886E-4*t1082+0.1702509553E-4*t938+0.1078086072E-3*t218
+-0.1078086072E-3*t219+0.8799425961E-3*t433-0.8051018213E-4*t1074+
+0.1081557015E-2*t229+0.5082624939E-2*t1218+0.7932620886E-4*t1080
+-0.1112574236E-3*t455;
+    t3571 = -0.2369931678E-4*t1131-0.8051018213E-4*t1197-0.4677530128E-2*t889+
+0.2570662873E-4*t882+0.2570662873E-4*t885+0.2369931678E-4*t1133-0.2606799616E-2
+*t1126-0.9381437244E-4*t927+0.9381437244E-4*t928+0.1232237092E-6*t940
+-0.1232237092E-6*t942-0.4402844298E-1*t2+0.1112574236E-3*t6-0.8799425961E-3*t13
+;
+    A[7] = t3468+t3482+t3497+t3511+t3527+t3541+t3556+t3571;
+    t3587 = -0.3775495252E-3*t958+0.1702509553E-4*t1050+0.1512290733E-3*t146+
+0.1681938551E-1*t156+0.5687628827E-3*t152+0.5687628827E-3*t153-0.4402844298E-1*
+t73+0.1112574236E-3*t75-0.8799425961E-3*t79+0.2369931678E-4*t1149
+-0.3775495252E-3*t961-0.5082624939E-2*t963+0.7932620886E-4*t1155;
+    t3601 = 0.3696711277E-6*t954-0.8945848979E-4*t967+0.8945848979E-4*t969
+-0.8799425961E-3*t420+0.1702509553E-4*t1053-0.7932620886E-4*t1157+
+0.1081557015E-2*t183-0.1832763156E-3*t174+0.2570662873E-4*t827+0.5082624939E-2*
+t965+0.1702509553E-4*t825-0.1832763156E-3*t169+0.9419629563E-2*t160;
+    t3616 = 0.1681938551E-1*t151+0.9970896939E-4*t127+0.8318061448E-1*t82+
+0.9332037043E-1*t78-0.1832763156E-3*t74-0.1832763156E-3*t76+0.9332037043E-1*t80
++0.2893250095E-3*t83-0.2893250095E-3*t84-0.8318061448E-1*t86-0.5687628827E-3*
+t88+0.1078086072E-3*t89+0.1078086072E-3*t90;
+    t3630 = -0.5687628827E-3*t92+0.1607889161E-3*t105-0.9397174694E-4*t98
+-0.3024581465E-3*t99+0.3024581465E-3*t100+0.5737222431E-5*t102+0.1607889161E-3*
+t108+0.1659098766E-1*t112+0.4122466806E-3*t113-0.4122466806E-3*t114
+-0.6660372088E-1*t116+0.2061233404E-3*t119-0.7932620886E-4*t1116;
+    t3646 = -0.2369931678E-4*t1151-0.2369931678E-4*t1023-0.1232237092E-6*t1055+
+0.1232237092E-6*t1057+0.9761137487E-4*t1001-0.9761137487E-4*t1003
+-0.2606799616E-2*t1161+0.1112574236E-3*t442+0.8799425961E-3*t422+
+0.3696711277E-6*t953-0.2061233404E-3*t122+0.9970896939E-4*t140+0.101865705E-2*
+t128;
+    t3660 = -0.101865705E-2*t129-0.1607889161E-3*t133+0.1607889161E-3*t137
+-0.1112574236E-3*t444+0.1232237092E-6*t839-0.1232237092E-6*t841-0.8503258945E-4
+*t832+0.8503258945E-4*t834-0.4677530128E-2*t999-0.2606799616E-2*t1159
+-0.9381437244E-4*t1005+0.9381437244E-4*t1007-0.4677530128E-2*t997;
+    t3675 = 0.2570662873E-4*t994-0.8051018213E-4*t1110-0.2606799616E-2*t1021+
+0.7932620886E-4*t1118-0.9999999999*t3284+0.2570662873E-4*t828-0.4677530128E-2*
+t845-0.2606799616E-2*t1017-0.9381437244E-4*t818+0.9381437244E-4*t821+CoM[2]
+-0.8051018213E-4*t1114+0.1512290733E-3*t142;
+    t3690 = 0.8823452451E-4*t143-0.8823452451E-4*t144+0.2369931678E-4*t1025+
+0.9419629563E-2*t165+0.1078086072E-3*t161-0.1078086072E-3*t162-0.8051018213E-4*
+t1146-0.4677530128E-2*t843+0.1081557015E-2*t178+0.1702509553E-4*t837+
+0.2570662873E-4*t995-0.8051018213E-4*t1153+0.2893250095E-3*t170-0.2893250095E-3
+*t171;
+    A[8] = t3587+t3601+t3616+t3630+t3646+t3660+t3675+t3690;
+    A[9] = IGM_CONST(0.0);
+  }
@@ -1,8 +1,42 @@
-#include <Eigen/Core>       // Cholesky decomposition + solving
-#include <Eigen/Cholesky>   // of system of linear equations.
-
 #include "nao_igm.h"
 #include "maple_functions.h"
+#include "igm_solver.h"
+
+
+
+/**
+ * @brief Constructor, the support foot is the right foot, the feet are in
+ * the origin.
+ */
+igmModel::igmModel()
+{
+    support_foot = IGM_SUPPORT_RIGHT;
+    left_foot_posture.setIdentity();
+    right_foot_posture.setIdentity();
+    setCoM(0.0, 0.0, 0.0);
+}
+
+
+
+/**
+ * @brief Constructor, speculation is not started.
+ */
+nao_igm::nao_igm()
+{
+    speculation = NULL;
+    speculative_iter = -1;
+    deadline_slack = 0.0;
+}
+
+
+
+/**
+ * @brief Destructor, stops speculation.
+ */
+nao_igm::~nao_igm()
+{
+    stopSpeculation();
+}
 
 
 
@@ -24,6 +58,7 @@ void nao_igm::getFeetPositions (
         double *right_foot_computed)
 {
     Transform<double, 3> swing_foot_posture;
+    readSensors();
     getSwingFootPosture (state_sensor, swing_foot_posture.data());
 
 
@@ -52,7 +87,7 @@ void nao_igm::getFeetPositions (
  * @param[in] y coordinate
  * @param[in] z coordinate
  */
-void nao_igm::setCoM (const double x, const double y, const double z)
+void igmModel::setCoM (const double x, const double y, const double z)
 {
     CoM_position[0] = x;
     CoM_position[1] = y;
@@ -72,7 +107,8 @@ void nao_igm::setCoM (const double x, const double y, const double z)
  * @param[in] pitch pitch angle of the support foot.
  * @param[in] yaw yaw angle of the support foot.
  *
- * @attention Joint angles in state_sensor must be set.
+ * @attention Joint angles in state_sensor must be set, either directly or
+ * through sensor_mailbox.
  */
 void nao_igm::init (
         const igmSupportFoot support_foot_,
@@ -84,7 +120,13 @@ void nao_igm::init (
         const double yaw)
 {
     support_foot = support_foot_;
+    readSensors();
     state_model = state_sensor;
+    state_speculative = state_sensor;
+    speculative_iter = -1;
+    predictor.reset();
+    iteration_time.reset();
+    residual_time.reset();
 
     if (support_foot == IGM_SUPPORT_LEFT)
     {
@@ -108,10 +150,30 @@ void nao_igm::init (
 
 /**
  * @brief Switch support foot.
+ *
+ * @note If the solution for the other support foot is available (see
+ * igmSpeculative()), it is used as the initial guess instead of
+ * state_sensor, and the current solution becomes the initial guess for the
+ * speculative solving.
+ *
+ * @note The predictor keeps only the last solution, see igmTrack().
  */
 void nao_igm::switchSupportFoot()
 {
-    state_model = state_sensor;
+    IGM_TIMELINE_INSTANT("switchSupportFoot");
+    readSensors();
+    if (speculative_iter >= 0)
+    {
+        jointState state = state_model;
+        state_model = state_speculative;
+        state_speculative = state;
+    }
+    else
+    {
+        state_model = state_sensor;
+    }
+    speculative_iter = -1;
+    predictor.restart();
 
     if (support_foot == IGM_SUPPORT_LEFT)
     {
@@ -126,20 +188,111 @@ void nao_igm::switchSupportFoot()
 
 
 /**
- * @brief Compute position of the CoM from joint angles.
+ * @brief Update state_sensor with the latest joint angles written to
+ * sensor_mailbox. Called by init(), switchSupportFoot() and
+ * getFeetPositions(), a controller may also call it at the beginning of a
+ * control tick.
+ *
+ * @return true if state_sensor is updated, false if no new data is
+ * available (state_sensor is not changed).
+ */
+bool nao_igm::readSensors()
+{
+    return (sensor_mailbox.read(state_sensor));
+}
+
+
+
+/**
+ * @brief Compute position of the CoM from joint angles, the result is
+ * cached for the joint angles and the posture of the support foot.
  *
  * @param[in] joints state of the joints.
  * @param[in,out] CoM_pos 3x1 vector of coordinates.
  */
 void nao_igm::getCoM (jointState& joints, double *CoM_pos)
 {
+    const double *support_foot_posture =
+        (support_foot == IGM_SUPPORT_LEFT) ? left_foot_posture.data() : right_foot_posture.data();
+
+    if (!CoM_cache.lookup(joints, support_foot, support_foot_posture, CoM_pos, POSITION_VECTOR_SIZE))
+    {
+        igmModel::getCoM(joints, CoM_pos);
+        CoM_cache.store(joints, support_foot, support_foot_posture, CoM_pos, POSITION_VECTOR_SIZE);
+    }
+}
+
+
+
+/**
+ * @brief Compute position of the swing foot from joint angles, the result
+ * is cached for the joint angles and the posture of the support foot.
+ *
+ * @param[in] joints state of the joints.
+ * @param[in,out] swing_foot_posture 4x4 homogeneous matrix
+ */
+void nao_igm::getSwingFootPosture (jointState& joints, double *swing_foot_posture)
+{
+    const double *support_foot_posture =
+        (support_foot == IGM_SUPPORT_LEFT) ? left_foot_posture.data() : right_foot_posture.data();
+
+    if (!swing_foot_cache.lookup(joints, support_foot, support_foot_posture, swing_foot_posture, 16))
+    {
+        igmModel::getSwingFootPosture(joints, swing_foot_posture);
+        swing_foot_cache.store(joints, support_foot, support_foot_posture, swing_foot_posture, 16);
+    }
+}
+
+
+
+/**
+ * @brief Compute posture of the swing foot and position of the CoM from
+ * joint angles, the results are cached as in getSwingFootPosture() and
+ * getCoM().
+ *
+ * @param[in] joints state of the joints.
+ * @param[in,out] swing_foot_posture 4x4 homogeneous matrix
+ * @param[in,out] CoM_pos 3x1 vector of coordinates.
+ */
+void nao_igm::getSwingFootPostureCoM (jointState& joints, double *swing_foot_posture, double *CoM_pos)
+{
+    const double *support_foot_posture =
+        (support_foot == IGM_SUPPORT_LEFT) ? left_foot_posture.data() : right_foot_posture.data();
+
+    bool swing_foot_cached = swing_foot_cache.lookup(joints, support_foot, support_foot_posture, swing_foot_posture, 16);
+    bool CoM_cached = CoM_cache.lookup(joints, support_foot, support_foot_posture, CoM_pos, POSITION_VECTOR_SIZE);
+
+    if (!swing_foot_cached || !CoM_cached)
+    {
+        igmModel::getSwingFootPostureCoM(joints, swing_foot_posture, CoM_pos);
+        swing_foot_cache.store(joints, support_foot, support_foot_posture, swing_foot_posture, 16);
+        CoM_cache.store(joints, support_foot, support_foot_posture, CoM_pos, POSITION_VECTOR_SIZE);
+    }
+}
+
+
+
+/**
+ * @brief Compute position of the CoM from joint angles.
+ *
+ * @param[in] joints state of the joints.
+ * @param[in,out] CoM_pos 3x1 vector of coordinates.
+ */
+void igmModel::getCoM (jointState& joints, double *CoM_pos) const
+{
+    igmDenormalsScope denormals_scope(options.flush_denormals);
+
+    joints.trig.update(joints.q);
+
     if (support_foot == IGM_SUPPORT_LEFT)
     {
-        LLeg2CoM(joints.q, left_foot_posture.data(), CoM_pos);
+        IGM_TIMELINE_SCOPE("LLeg2CoM");
+        LLeg2CoM_trig(joints.trig.sin_q, joints.trig.cos_q, left_foot_posture.data(), CoM_pos);
     }
     else
     {
-        RLeg2CoM(joints.q, right_foot_posture.data(), CoM_pos);
+        IGM_TIMELINE_SCOPE("RLeg2CoM");
+        RLeg2CoM_trig(joints.trig.sin_q, joints.trig.cos_q, right_foot_posture.data(), CoM_pos);
     }
 }
 
@@ -151,20 +304,109 @@ void nao_igm::getCoM (jointState& joints, double *CoM_pos)
  * @param[in] joints state of the joints.
  * @param[in,out] swing_foot_posture 4x4 homogeneous matrix
  */
-void nao_igm::getSwingFootPosture (jointState& joints, double *swing_foot_posture)
+void igmModel::getSwingFootPosture (jointState& joints, double *swing_foot_posture) const
+{
+    igmDenormalsScope denormals_scope(options.flush_denormals);
+
+    joints.trig.update(joints.q);
+
+    if (support_foot == IGM_SUPPORT_LEFT)
+    {
+        IGM_TIMELINE_SCOPE("LLeg2RLeg");
+        LLeg2RLeg_trig(joints.trig.sin_q, joints.trig.cos_q, left_foot_posture.data(), swing_foot_posture);
+    }
+    else
+    {
+        IGM_TIMELINE_SCOPE("RLeg2LLeg");
+        RLeg2LLeg_trig(joints.trig.sin_q, joints.trig.cos_q, right_foot_posture.data(), swing_foot_posture);
+    }
+}
+
+
+
+/**
+ * @brief Compute posture of the swing foot and position of the CoM from
+ * joint angles in one pass, which is faster than getSwingFootPosture()
+ * followed by getCoM().
+ *
+ * @param[in] joints state of the joints.
+ * @param[in,out] swing_foot_posture 4x4 homogeneous matrix
+ * @param[in,out] CoM_pos 3x1 vector of coordinates.
+ */
+void igmModel::getSwingFootPostureCoM (jointState& joints, double *swing_foot_posture, double *CoM_pos) const
 {
+    igmDenormalsScope denormals_scope(options.flush_denormals);
+
+    joints.trig.update(joints.q);
+
     if (support_foot == IGM_SUPPORT_LEFT)
     {
-        LLeg2RLeg(joints.q, left_foot_posture.data(), swing_foot_posture);
+        IGM_TIMELINE_SCOPE("LLeg2RLegCoM");
+        LLeg2RLegCoM_trig(joints.trig.sin_q, joints.trig.cos_q, left_foot_posture.data(), swing_foot_posture, CoM_pos);
     }
     else
     {
-        RLeg2LLeg(joints.q, right_foot_posture.data(), swing_foot_posture);
+        IGM_TIMELINE_SCOPE("RLeg2LLegCoM");
+        RLeg2LLegCoM_trig(joints.trig.sin_q, joints.trig.cos_q, right_foot_posture.data(), swing_foot_posture, CoM_pos);
     }
 }
 
 
 
+/** 
+ * @brief Solves the Inverse Geometric Problem (IGM).
+ *
+ * @param[in,out] joints state of the joints: initial guess on input,
+ * solution on output.
+ * @param[in] ref_angles LOWER_JOINTS_NUM reference joint angles
+ * @param[in] mu penalty for difference between solution and reference angles
+ * @param[in] tol tolerance
+ * @param[in] max_iter maximal number of iterations
+ * @param[in,out] trace instrumentation of the solver, may be NULL (see
+ * igmTrace).
+ *
+ * @return the same as nao_igm::igm().
+ */
+int igmModel::solve(
+        jointState& joints,
+        const double *ref_angles,
+        const double mu,
+        const double tol,
+        const int max_iter,
+        igmTrace *trace) const
+{
+    int iter;
+
+    if (support_foot == IGM_SUPPORT_LEFT)
+    {
+        iter = igmSolve (
+                options,
+                support_foot,
+                left_foot_posture.data(),
+                right_foot_posture.data(),
+                CoM_position,
+                ref_angles, mu, tol, max_iter,
+                joints.q, joints.trig,
+                trace);
+    }
+    else
+    {
+        iter = igmSolve (
+                options,
+                support_foot,
+                right_foot_posture.data(),
+                left_foot_posture.data(),
+                CoM_position,
+                ref_angles, mu, tol, max_iter,
+                joints.q, joints.trig,
+                trace);
+    }
+
+    return (iter);
+}
+
+
+
 /** 
  * @brief Solves the Inverse Geometric Problem (IGM).
  *
@@ -181,6 +423,9 @@ void nao_igm::getSwingFootPosture (jointState& joints, double *swing_foot_postur
  * @note On input, model_state.q is taken as an initial guess for the joint angles,
  * on output it contains a solution of the inverse kinematics problem (if iter >= 0). 
  * Only the joints angles in the lower part of the body are altered.
+ *
+ * @note The iterations are recorded in 'trace' if the library is compiled
+ * with IGM_TRACE_ENABLE.
 */
 int nao_igm::igm(
         const double *ref_angles,
@@ -188,76 +433,113 @@ int nao_igm::igm(
         const double tol,
         const int max_iter)
 {
-    /*
-     * Constraints:
-     *  - 3 on the position of the swing foot
-     *  - 3 on the orientation of the swing foot
-     *  - 3 on the position of the CoM
-     *  - 1 to take into account coupled joint L_HIP_YAW_PITCH / R_HIP_YAW_PITCH
-     */
-    const int num_constraints = 10;
+    IGM_TIMELINE_SCOPE("igm");
+    return (solve(state_model, ref_angles, mu, tol, max_iter, &trace));
+}
 
 
-    Map< Matrix<double, LOWER_JOINTS_NUM, 1> > q(state_model.q);
-    Map< Matrix<double, LOWER_JOINTS_NUM, 1> > q0(ref_angles);
-    Matrix<double, LOWER_JOINTS_NUM, 1> dq;
-    Matrix<double, LOWER_JOINTS_NUM, 1> iH; // inverted Hessian
 
-    iH.setConstant(1.0);
-    // joints can be penalized here:
-    //iH(L_HIP_ROLL) = 0.5;
-    //iH(R_HIP_ROLL) = 0.5;
+/**
+ * @brief Solves the Inverse Geometric Problem (IGM) on a control tick of a
+ * smooth trajectory. The initial guess is extrapolated from the solutions
+ * obtained on the previous ticks, see igmPredictor.
+ *
+ * @param[in] time time of the current control tick.
+ * @param[in] ref_angles LOWER_JOINTS_NUM reference joint angles
+ * @param[in] mu penalty for difference between solution and reference angles
+ * @param[in] tol tolerance
+ * @param[in] max_iter maximal number of iterations
+ *
+ * @return the same as igm().
+ *
+ * @note If there are no stored solutions (after init() or a failure of the
+ * solver), state_model.q is used as the initial guess. After
+ * switchSupportFoot() the previous solution is used as the initial guess.
+ */
+int nao_igm::igmTrack(
+        const double time,
+        const double *ref_angles,
+        const double mu,
+        const double tol,
+        const int max_iter)
+{
+    predictor.predict(time, state_model.q);
 
+    int iter = igm(ref_angles, mu, tol, max_iter);
 
-    double out[num_constraints*LOWER_JOINTS_NUM + num_constraints];
-    Map< Matrix<double, num_constraints, LOWER_JOINTS_NUM> > A(out);
-    Map< Matrix<double, num_constraints, 1> > err(out + num_constraints*LOWER_JOINTS_NUM);
+    if (iter >= 0)
+    {
+        predictor.add(time, state_model.q);
+    }
+    else
+    {
+        predictor.reset();
+    }
+
+    return (iter);
+}
 
 
-    int iter;
-    double norm_dq = 1.0;
 
-    for (iter = 0; (norm_dq > tol) && (iter <= max_iter); ++iter)
+/**
+ * @brief Solves the Inverse Geometric Problem (IGM) within a time budget.
+ *
+ * @param[in] ref_angles LOWER_JOINTS_NUM reference joint angles
+ * @param[in] mu penalty for difference between solution and reference angles
+ * @param[in] tol tolerance
+ * @param[in] time_budget time budget in seconds.
+ * @param[out] iter the number of performed iterations.
+ *
+ * @return IGM_CONVERGED if the solution is found, otherwise
+ * IGM_BUDGET_EXHAUSTED or IGM_DIVERGING.
+ *
+ * @note An iteration is not started if it may not be completed within the
+ * budget judging by iteration_time and residual_time. Hence, the first call
+ * after init() may exceed the budget by the duration of one iteration.
+ *
+ * @note On output, state_model.q contains the solution or the best iterate
+ * (the iterate with the smallest infinity norm of the residuals, including
+ * the last one) if the solution is not found.
+ *
+ * @note options.jacobian_update, options.residual_tol and options.precision
+ * are ignored: all iterations are performed in double precision with exact
+ * Jacobian.
+ */
+igmStatus nao_igm::igmDeadline(
+        const double *ref_angles,
+        const double mu,
+        const double tol,
+        const double time_budget,
+        int &iter)
+{
+    igmStatus status;
+
+    if (support_foot == IGM_SUPPORT_LEFT)
     {
-        // Form data
-        if (support_foot == IGM_SUPPORT_LEFT)
-        {
-            from_LLeg_3 (
-                    state_model.q, 
-                    left_foot_posture.data(), 
-                    right_foot_posture.data(), 
-                    CoM_position, 
-                    out);
-        }
-        else
-        {
-            from_RLeg_3 ( 
-                    state_model.q, 
-                    right_foot_posture.data(), 
-                    left_foot_posture.data(), 
-                    CoM_position, 
-                    out);
-        }
-
-        // Solve KKT system
-        dq = mu*(q - q0);
-        err = -err - A*dq;
-        /// @todo FP underflow occurs in solveInPlace().
-        (A*iH.asDiagonal()*A.transpose()).llt().solveInPlace(err);
-        dq = -dq - iH.asDiagonal()*A.transpose() * err;
-        // Update angles (of legs)
-        q += dq;
-
-        // Compute the infinity norm of dq
-        // (we want the absolute value of angle change to be detectable by 
-        // the corresponding sensor, see 'tol' variable above)
-        norm_dq = dq.lpNorm<Eigen::Infinity>();
+        status = igmSolveDeadline (
+                options,
+                support_foot,
+                left_foot_posture.data(),
+                right_foot_posture.data(),
+                CoM_position,
+                ref_angles, mu, tol,
+                time_budget, iteration_time, residual_time,
+                state_model.q, state_model.trig,
+                iter, deadline_slack);
     }
-
-    if (iter > max_iter)
+    else
     {
-        iter = -1;
+        status = igmSolveDeadline (
+                options,
+                support_foot,
+                right_foot_posture.data(),
+                left_foot_posture.data(),
+                CoM_position,
+                ref_angles, mu, tol,
+                time_budget, iteration_time, residual_time,
+                state_model.q, state_model.trig,
+                iter, deadline_slack);
     }
 
-    return(iter);
+    return (status);
 }
@@ -0,0 +1,219 @@
+/**
+ * @file
+ * @brief Solving of multiple IGM problems in one call.
+ */
+
+
+#include "nao_igm.h"
+
+#include <string.h>
+
+#include "maple_functions.h"
+#include "igm_solver.h"
+
+
+#define HOMOGENEOUS_MATRIX_SIZE 16
+
+/// The maximal number of problems solved simultaneously.
+#define IGM_MAX_GROUP_SIZE 8
+
+
+
+/**
+ * @brief Constructor, the batch is empty.
+ */
+igmBatch::igmBatch()
+{
+    size = 0;
+    vectorize = false;
+    warm_start = false;
+
+    support_foot = NULL;
+    support_foot_posture = NULL;
+    swing_foot_posture = NULL;
+    CoM_position = NULL;
+    ref_angles = NULL;
+
+    q = NULL;
+    iter = NULL;
+}
+
+
+
+/**
+ * @brief Solve all problems in the batch.
+ *
+ * @param[in] mu penalty for difference between solution and reference angles
+ * @param[in] tol tolerance
+ * @param[in] max_iter maximal number of iterations
+ *
+ * @return the number of problems, which were not solved within max_iter
+ * iterations.
+ *
+ * @note The results are identical to the results of nao_igm::igm() called
+ * for each problem separately (unless warm_start is set).
+ *
+ * @note SIMD versions iterate in double precision only, hence the problems
+ * are solved one by one if options.precision is not IGM_PRECISION_DOUBLE.
+ */
+int igmBatch::solve (
+        const double mu,
+        const double tol,
+        const int max_iter)
+{
+    igmDenormalsScope denormals_scope(options.flush_denormals);
+
+    int num_failed = 0;
+
+    if (vectorize && !warm_start && (options.precision == IGM_PRECISION_DOUBLE))
+    {
+        int group_size = igmSIMDWidth();
+        if (group_size > IGM_MAX_GROUP_SIZE)
+        {
+            group_size = IGM_MAX_GROUP_SIZE;
+        }
+
+        for (int first = 0; first < size; )
+        {
+            int num = 1;
+            while ((num < group_size)
+                    && (first + num < size)
+                    && (support_foot[first + num] == support_foot[first]))
+            {
+                ++num;
+            }
+
+            num_failed += solveGroup (first, num, mu, tol, max_iter);
+            first += num;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < size; ++i)
+        {
+            jointTrig trig;
+
+            if (warm_start && (i > 0))
+            {
+                memcpy(q + i*JOINTS_NUM, q + (i-1)*JOINTS_NUM, LOWER_JOINTS_NUM*sizeof(double));
+            }
+
+            iter[i] = igmSolve (
+                    options,
+                    support_foot[i],
+                    support_foot_posture + i*HOMOGENEOUS_MATRIX_SIZE,
+                    swing_foot_posture + i*HOMOGENEOUS_MATRIX_SIZE,
+                    CoM_position + i*POSITION_VECTOR_SIZE,
+                    ref_angles + i*LOWER_JOINTS_NUM,
+                    mu, tol, max_iter,
+                    q + i*JOINTS_NUM,
+                    trig);
+
+            if (iter[i] < 0)
+            {
+                ++num_failed;
+            }
+        }
+    }
+
+    return (num_failed);
+}
+
+
+
+/**
+ * @brief Solve a group of consecutive problems with the same support foot.
+ * The generated functions are evaluated for all problems in the group at
+ * once, the iterations are stopped for each problem separately.
+ *
+ * @param[in] first index of the first problem in the group.
+ * @param[in] num the number of problems in the group (<= IGM_MAX_GROUP_SIZE).
+ * @param[in] mu penalty for difference between solution and reference angles
+ * @param[in] tol tolerance
+ * @param[in] max_iter maximal number of iterations
+ *
+ * @return the number of problems, which were not solved within max_iter
+ * iterations.
+ */
+int igmBatch::solveGroup (
+        const int first,
+        const int num,
+        const double mu,
+        const double tol,
+        const int max_iter)
+{
+    double out[IGM_MAX_GROUP_SIZE*IGM_KERNEL_OUTPUT_SIZE];
+    double norm_dq[IGM_MAX_GROUP_SIZE];
+    int num_active = 0;
+    int num_failed = 0;
+
+
+    for (int j = 0; j < num; ++j)
+    {
+        norm_dq[j] = 1.0;
+        iter[first + j] = 0;
+    }
+    if ((norm_dq[0] > tol) && (max_iter >= 0))
+    {
+        num_active = num;
+    }
+
+
+    for (int i = 0; num_active > 0; ++i)
+    {
+        // Form data for all problems in the group
+        if (support_foot[first] == IGM_SUPPORT_LEFT)
+        {
+            from_LLeg_3_multi (
+                    num,
+                    q + first*JOINTS_NUM,
+                    support_foot_posture + first*HOMOGENEOUS_MATRIX_SIZE,
+                    swing_foot_posture + first*HOMOGENEOUS_MATRIX_SIZE,
+                    CoM_position + first*POSITION_VECTOR_SIZE,
+                    out);
+        }
+        else
+        {
+            from_RLeg_3_multi (
+                    num,
+                    q + first*JOINTS_NUM,
+                    support_foot_posture + first*HOMOGENEOUS_MATRIX_SIZE,
+                    swing_foot_posture + first*HOMOGENEOUS_MATRIX_SIZE,
+                    CoM_position + first*POSITION_VECTOR_SIZE,
+                    out);
+        }
+
+        // Update the problems, which have not converged yet
+        num_active = 0;
+        for (int j = 0; j < num; ++j)
+        {
+            if ((norm_dq[j] > tol) && (i <= max_iter))
+            {
+                norm_dq[j] = igmStep (
+                        options,
+                        out + j*IGM_KERNEL_OUTPUT_SIZE,
+                        ref_angles + (first + j)*LOWER_JOINTS_NUM,
+                        mu,
+                        q + (first + j)*JOINTS_NUM);
+                iter[first + j] = i + 1;
+
+                if ((norm_dq[j] > tol) && (i + 1 <= max_iter))
+                {
+                    ++num_active;
+                }
+            }
+        }
+    }
+
+
+    for (int j = 0; j < num; ++j)
+    {
+        if (iter[first + j] > max_iter)
+        {
+            iter[first + j] = -1;
+            ++num_failed;
+        }
+    }
+
+    return (num_failed);
+}
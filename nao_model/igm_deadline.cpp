@@ -0,0 +1,331 @@
+/**
+ * @file
+ * @brief Solving of the inverse geometric problem within a time budget.
+ */
+
+
+#include "nao_igm.h"
+
+#include <string.h>
+#include <time.h>
+#include <limits>
+#include <algorithm>
+
+#include <Eigen/Core>
+
+#include "igm_solver.h"
+
+
+/// The estimated durations are increased by this factor to account for
+/// variance of the durations of iterations.
+#define IGM_TIME_ESTIMATE_MARGIN 1.2
+
+
+/**
+ * @brief Get monotonic time.
+ *
+ * @return time in seconds.
+ */
+static double igmGetTime()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (t.tv_sec + 1e-9 * t.tv_nsec);
+}
+
+
+
+/**
+ * @brief Constructor, no durations are stored.
+ */
+igmTimeEstimate::igmTimeEstimate()
+{
+    reset();
+}
+
+
+
+/**
+ * @brief Forget all stored durations.
+ */
+void igmTimeEstimate::reset()
+{
+    num = 0;
+    index = 0;
+}
+
+
+
+/**
+ * @brief Store a duration, the oldest one is replaced if the window is full.
+ *
+ * @param[in] duration duration in seconds.
+ */
+void igmTimeEstimate::add (const double duration)
+{
+    durations[index] = duration;
+    index = (index + 1) % IGM_TIME_ESTIMATE_WINDOW;
+    if (num < IGM_TIME_ESTIMATE_WINDOW)
+    {
+        ++num;
+    }
+}
+
+
+
+/**
+ * @brief Forget the oldest stored duration.
+ */
+void igmTimeEstimate::forget()
+{
+    if (num > 0)
+    {
+        --num;
+    }
+}
+
+
+
+/**
+ * @brief Get the estimate: the second longest of the recent durations, so
+ * that a single outlier (e.g., preemption or cold caches) is ignored.
+ *
+ * @return duration in seconds, 0 if no durations are stored.
+ */
+double igmTimeEstimate::get() const
+{
+    double longest = 0.0;
+    double second = 0.0;
+
+    for (int i = 0; i < num; ++i)
+    {
+        const double duration = durations[(index + IGM_TIME_ESTIMATE_WINDOW - 1 - i) % IGM_TIME_ESTIMATE_WINDOW];
+        if (duration > longest)
+        {
+            second = longest;
+            longest = duration;
+        }
+        else if (duration > second)
+        {
+            second = duration;
+        }
+    }
+
+    return ((num > 1) ? second : longest);
+}
+
+
+
+/**
+ * @brief Get the shortest of the recent durations.
+ *
+ * @return duration in seconds, 0 if no durations are stored.
+ */
+double igmTimeEstimate::getMin() const
+{
+    double shortest = 0.0;
+
+    for (int i = 0; i < num; ++i)
+    {
+        const double duration = durations[(index + IGM_TIME_ESTIMATE_WINDOW - 1 - i) % IGM_TIME_ESTIMATE_WINDOW];
+        if ((i == 0) || (duration < shortest))
+        {
+            shortest = duration;
+        }
+    }
+
+    return (shortest);
+}
+
+
+
+/**
+ * @brief Solves the Inverse Geometric Problem (IGM) for the given data
+ * within the given time budget.
+ *
+ * @param[in] options options of the solver.
+ * @param[in] support_foot current support foot.
+ * @param[in] support_foot_posture 4x4 homogeneous matrix of the support foot.
+ * @param[in] swing_foot_posture 4x4 homogeneous matrix of the swing foot.
+ * @param[in] CoM_position 3x1 position of the CoM.
+ * @param[in] ref_angles LOWER_JOINTS_NUM reference joint angles
+ * @param[in] mu penalty for difference between solution and reference angles
+ * @param[in] tol tolerance
+ * @param[in] time_budget time budget in seconds.
+ * @param[in,out] iteration_time estimated duration of an iteration, an
+ * iteration is not started if it may not be completed within the budget
+ * together with evaluation of the residuals of the last iterate. The first
+ * iteration is started if it fits with the shortest recent duration. If it
+ * does not fit, the oldest durations are forgotten, so that stale
+ * estimates (e.g., obtained with cold caches) cannot prevent iterations in
+ * all subsequent calls.
+ * @param[in,out] residual_time estimated duration of evaluation of the
+ * residuals of the last iterate.
+ * @param[in,out] q JOINTS_NUM joint angles: initial guess on input, solution
+ * or the best iterate (with the smallest infinity norm of the residuals,
+ * including the last iterate) on output.
+ * @param[in,out] trig sine and cosine of joint angles, updated in each
+ * iteration.
+ * @param[out] iter the number of performed iterations.
+ * @param[out] slack the smallest difference between the budget and the
+ * estimated end of an iteration (the elapsed time at the start of the
+ * iteration and the required time, see iteration_time) over the performed
+ * iterations, std::numeric_limits<double>::max() if no iterations are
+ * performed. It is nonnegative unless an iteration is started, which may
+ * not be completed within the budget.
+ *
+ * @return status of the solver.
+ *
+ * @note The solver is considered to be diverging if the residuals increase
+ * in IGM_MAX_RESIDUAL_INCREASES consecutive iterations or are not finite.
+ *
+ * @note options.jacobian_update, options.residual_tol and options.precision
+ * are ignored: all iterations are performed in double precision with exact
+ * Jacobian.
+ */
+igmStatus igmSolveDeadline (
+        const igmOptions &options,
+        const igmSupportFoot support_foot,
+        const double *support_foot_posture,
+        const double *swing_foot_posture,
+        const double *CoM_position,
+        const double *ref_angles,
+        const double mu,
+        const double tol,
+        const double time_budget,
+        igmTimeEstimate &iteration_time,
+        igmTimeEstimate &residual_time,
+        double *q,
+        jointTrig &trig,
+        int &iter,
+        double &slack)
+{
+    igmDenormalsScope denormals_scope(options.flush_denormals);
+
+    double out[IGM_KERNEL_OUTPUT_SIZE];
+    double q_best[LOWER_JOINTS_NUM];
+
+    double norm_err_best = std::numeric_limits<double>::max();
+    double norm_err_prev = std::numeric_limits<double>::max();
+    int num_increases = 0;
+
+    igmStatus status = IGM_BUDGET_EXHAUSTED;
+    slack = std::numeric_limits<double>::max();
+    double start = igmGetTime();
+    double now = start;
+
+    for (iter = 0; ; ++iter)
+    {
+        double required_time;
+        if (iter == 0)
+        {
+            required_time = iteration_time.getMin() + residual_time.getMin();
+        }
+        else
+        {
+            required_time = iteration_time.get() + residual_time.get();
+        }
+        if (now - start + IGM_TIME_ESTIMATE_MARGIN * required_time > time_budget)
+        {
+            if (iter == 0)
+            {
+                iteration_time.forget();
+                residual_time.forget();
+            }
+            break;
+        }
+        slack = std::min(slack, time_budget - (now - start + required_time));
+
+        double iteration_start = now;
+
+        // Form data
+        if (options.incremental_trig)
+        {
+            trig.updateIncremental(q, options.trig_refresh_period);
+        }
+        else
+        {
+            trig.update(q);
+        }
+        igmEvaluate (
+                support_foot,
+                trig,
+                support_foot_posture,
+                swing_foot_posture,
+                CoM_position,
+                out);
+
+
+        // Keep the best iterate
+        double norm_err = Map< Matrix<double, IGM_NUM_CONSTRAINTS, 1> >(
+                out + IGM_NUM_CONSTRAINTS*LOWER_JOINTS_NUM).lpNorm<Eigen::Infinity>();
+
+        if (norm_err < norm_err_best)
+        {
+            norm_err_best = norm_err;
+            memcpy(q_best, q, sizeof(q_best));
+        }
+
+        if (norm_err <= norm_err_prev)
+        {
+            num_increases = 0;
+        }
+        else
+        {
+            ++num_increases;
+        }
+        norm_err_prev = norm_err;
+
+        if ((num_increases >= IGM_MAX_RESIDUAL_INCREASES)
+                || !(norm_err <= std::numeric_limits<double>::max()))
+        {
+            status = IGM_DIVERGING;
+            break;
+        }
+
+
+        double norm_dq = igmStep (options, out, ref_angles, mu, q);
+
+        now = igmGetTime();
+        iteration_time.add(now - iteration_start);
+
+        if (norm_dq <= tol)
+        {
+            ++iter;
+            status = IGM_CONVERGED;
+            break;
+        }
+    }
+
+    if ((status == IGM_BUDGET_EXHAUSTED) && (iter > 0))
+    {
+        // the last iterate is usually the best one
+        double residual_start = now;
+        double err[IGM_NUM_CONSTRAINTS];
+
+        trig.update(q);
+        igmResidual (
+                support_foot,
+                trig,
+                support_foot_posture,
+                swing_foot_posture,
+                CoM_position,
+                err);
+
+        double norm_err = Map< Matrix<double, IGM_NUM_CONSTRAINTS, 1> >(err).lpNorm<Eigen::Infinity>();
+        if (norm_err < norm_err_best)
+        {
+            norm_err_best = norm_err;
+            memcpy(q_best, q, sizeof(q_best));
+        }
+
+        residual_time.add(igmGetTime() - residual_start);
+    }
+
+    if ((status != IGM_CONVERGED) && (norm_err_best < std::numeric_limits<double>::max()))
+    {
+        memcpy(q, q_best, sizeof(q_best));
+    }
+
+    return (status);
+}
@@ -0,0 +1,61 @@
+/**
+ * @file
+ * @brief Handling of denormal floating point numbers.
+ */
+
+
+#include "nao_igm.h"
+
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#endif
+
+
+/// Flush-to-zero bit of MXCSR: denormal results are replaced with zero.
+#define IGM_MXCSR_FTZ 0x8000
+/// Denormals-are-zero bit of MXCSR: denormal inputs are treated as zero.
+#define IGM_MXCSR_DAZ 0x0040
+
+
+
+/**
+ * @brief Constructor.
+ *
+ * @param[in] enable enable flush-to-zero and denormals-are-zero modes, the
+ * scope does nothing otherwise.
+ */
+igmDenormalsScope::igmDenormalsScope(const bool enable)
+{
+    restore = false;
+    csr = 0;
+
+#if defined(__SSE2__)
+    if (enable)
+    {
+        csr = _mm_getcsr();
+        // nested scopes do not need to touch the register
+        if ((csr & (IGM_MXCSR_FTZ | IGM_MXCSR_DAZ)) != (IGM_MXCSR_FTZ | IGM_MXCSR_DAZ))
+        {
+            _mm_setcsr(csr | IGM_MXCSR_FTZ | IGM_MXCSR_DAZ);
+            restore = true;
+        }
+    }
+#endif
+}
+
+
+
+/**
+ * @brief Destructor, restores the modes of the caller.
+ */
+igmDenormalsScope::~igmDenormalsScope()
+{
+#if defined(__SSE2__)
+    if (restore)
+    {
+        // the exception flags raised within the scope are preserved
+        _mm_setcsr((_mm_getcsr() & ~(IGM_MXCSR_FTZ | IGM_MXCSR_DAZ))
+                | (csr & (IGM_MXCSR_FTZ | IGM_MXCSR_DAZ)));
+    }
+#endif
+}
@@ -0,0 +1,78 @@
+/**
+ * @file
+ * @brief Caching of results of forward kinematics.
+ */
+
+
+#include "nao_igm.h"
+
+#include <string.h>
+
+
+#define HOMOGENEOUS_MATRIX_SIZE 16
+
+
+
+/**
+ * @brief Constructor, the cache is empty.
+ */
+igmFKCache::igmFKCache()
+{
+    hits = 0;
+    misses = 0;
+    valid = false;
+    support_foot = IGM_SUPPORT_RIGHT;
+}
+
+
+
+/**
+ * @brief Get the cached result.
+ *
+ * @param[in] joints state of the joints.
+ * @param[in] support_foot_ support foot.
+ * @param[in] support_foot_posture_ 4x4 homogeneous matrix of the support foot.
+ * @param[out] result_ the result, unchanged if it is not cached.
+ * @param[in] size size of the result (<= 16).
+ *
+ * @return true if the result is cached, false otherwise.
+ */
+bool igmFKCache::lookup (
+        const jointState &joints,
+        const igmSupportFoot support_foot_,
+        const double *support_foot_posture_,
+        double *result_,
+        const int size)
+{
+    if (!valid
+            || (memcmp(q, joints.q, sizeof(q)) != 0)
+            || (support_foot != support_foot_)
+            || (memcmp(support_foot_posture, support_foot_posture_, sizeof(support_foot_posture)) != 0))
+    {
+        ++misses;
+        return (false);
+    }
+
+    memcpy(result_, result, size * sizeof(double));
+    ++hits;
+    return (true);
+}
+
+
+
+/**
+ * @brief Cache a result, the parameters are the same as in lookup().
+ */
+void igmFKCache::store (
+        const jointState &joints,
+        const igmSupportFoot support_foot_,
+        const double *support_foot_posture_,
+        const double *result_,
+        const int size)
+{
+    valid = true;
+    memcpy(q, joints.q, sizeof(q));
+    support_foot = support_foot_;
+    memcpy(support_foot_posture, support_foot_posture_, sizeof(support_foot_posture));
+    memcpy(result, result_, size * sizeof(double));
+}
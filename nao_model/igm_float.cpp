@@ -0,0 +1,131 @@
+/**
+ * @file
+ * @brief Single precision iterations of the IGM solver.
+ */
+
+
+#include "nao_igm.h"
+
+#include <math.h>
+
+#include "maple_functions.h"
+#include "igm_solver.h"
+
+
+#define HOMOGENEOUS_MATRIX_SIZE 16
+
+
+
+/**
+ * @brief Convert an array of doubles to floats.
+ *
+ * @param[in] in input array.
+ * @param[in] size size of the arrays.
+ * @param[out] out output array.
+ */
+static void igmToFloat (const double *in, const int size, float *out)
+{
+    for (int i = 0; i < size; ++i)
+    {
+        out[i] = (float) in[i];
+    }
+}
+
+
+
+/**
+ * @brief Solves the Inverse Geometric Problem (IGM) in single precision,
+ * used by igmSolve(). The parameters are the same as the parameters of
+ * igmSolve() except for the following.
+ *
+ * @param[in,out] q JOINTS_NUM joint angles: initial guess on input, solution
+ * on output (only the angles of the lower body are changed).
+ * @param[out] norm_dq infinity norm of the change of joint angles in the
+ * last iteration.
+ *
+ * @return the number of iterations performed, which exceeds max_iter if the
+ * algorithm did not converge.
+ *
+ * @note Only options.reduced_kkt is taken into account: the exact Jacobian
+ * is evaluated in each iteration, sine and cosine are computed from scratch.
+ */
+int igmSolveFloat (
+        const igmOptions &options,
+        const igmSupportFoot support_foot,
+        const double *support_foot_posture,
+        const double *swing_foot_posture,
+        const double *CoM_position,
+        const double *ref_angles,
+        const double mu,
+        const double tol,
+        const int max_iter,
+        double *q,
+        double &norm_dq)
+{
+    float out[IGM_KERNEL_OUTPUT_SIZE];
+    float support_foot_posture_f[HOMOGENEOUS_MATRIX_SIZE];
+    float swing_foot_posture_f[HOMOGENEOUS_MATRIX_SIZE];
+    float CoM_position_f[POSITION_VECTOR_SIZE];
+    float ref_angles_f[LOWER_JOINTS_NUM];
+    float q_f[LOWER_JOINTS_NUM];
+    float sin_q[JOINTS_NUM];
+    float cos_q[JOINTS_NUM];
+
+    igmToFloat (support_foot_posture, HOMOGENEOUS_MATRIX_SIZE, support_foot_posture_f);
+    igmToFloat (swing_foot_posture, HOMOGENEOUS_MATRIX_SIZE, swing_foot_posture_f);
+    igmToFloat (CoM_position, POSITION_VECTOR_SIZE, CoM_position_f);
+    igmToFloat (ref_angles, LOWER_JOINTS_NUM, ref_angles_f);
+    igmToFloat (q, LOWER_JOINTS_NUM, q_f);
+
+    // the angles of the upper body are not changed
+    for (int i = LOWER_JOINTS_NUM; i < JOINTS_NUM; ++i)
+    {
+        sin_q[i] = sinf((float) q[i]);
+        cos_q[i] = cosf((float) q[i]);
+    }
+
+
+    int iter;
+    float norm_dq_f = 1.0;
+
+    for (iter = 0; (norm_dq_f > tol) && (iter <= max_iter); ++iter)
+    {
+        for (int i = 0; i < LOWER_JOINTS_NUM; ++i)
+        {
+            sin_q[i] = sinf(q_f[i]);
+            cos_q[i] = cosf(q_f[i]);
+        }
+
+        if (support_foot == IGM_SUPPORT_LEFT)
+        {
+            IGM_TIMELINE_SCOPE("from_LLeg_3_float");
+            from_LLeg_3_float (
+                    sin_q, cos_q,
+                    support_foot_posture_f,
+                    swing_foot_posture_f,
+                    CoM_position_f,
+                    out);
+        }
+        else
+        {
+            IGM_TIMELINE_SCOPE("from_RLeg_3_float");
+            from_RLeg_3_float (
+                    sin_q, cos_q,
+                    support_foot_posture_f,
+                    swing_foot_posture_f,
+                    CoM_position_f,
+                    out);
+        }
+
+        norm_dq_f = igmStep (options, out, ref_angles_f, (float) mu, q_f);
+    }
+
+
+    for (int i = 0; i < LOWER_JOINTS_NUM; ++i)
+    {
+        q[i] = q_f[i];
+    }
+    norm_dq = norm_dq_f;
+
+    return (iter);
+}
@@ -0,0 +1,168 @@
+/**
+ * @file
+ * @brief Synthetic walking gait.
+ */
+
+
+#include "nao_igm.h"
+
+#include <string.h>
+#include <math.h>
+
+
+
+/**
+ * @brief Constructor, sets the default parameters: 8 steps, 4 cm long, with
+ * 0.4 s of single support and no double support at 100 Hz.
+ */
+igmGait::igmGait()
+{
+    step_length = 0.04;
+    step_width = 0.1;
+    step_height = 0.015;
+    CoM_sway = 0.01;
+
+    ss_ticks = 40;
+    ds_ticks = 0;
+    num_steps = 8;
+
+    copy_sensors = true;
+
+    step = 0;
+    tick = 0;
+}
+
+
+
+/**
+ * @brief Initialize the model and start the gait from the configuration in
+ * nao.state_sensor: the right foot is the support foot, it is placed at
+ * (0, -step_width/2, 0), the left foot is the first swing foot.
+ *
+ * @param[in,out] nao the model.
+ */
+void igmGait::init (nao_igm &nao)
+{
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, -0.5 * step_width, 0.0,
+            0.0, 0.0, 0.0);
+    nao.getSwingFootPosture (nao.state_sensor, nao.left_foot_posture.data());
+    nao.getCoM (nao.state_sensor, nao.CoM_position);
+
+    memcpy(CoM_initial, nao.CoM_position, sizeof(CoM_initial));
+    Vector3d::Map(swing_foot_start) = nao.left_foot_posture.translation();
+
+    step = 0;
+    tick = 0;
+}
+
+
+
+/**
+ * @brief Move the swing foot and the CoM to the next control tick, the
+ * support foot is switched (nao_igm::switchSupportFoot()) after the last
+ * tick of a step.
+ *
+ * @param[in,out] nao the model.
+ *
+ * @return false if all steps are done (the model is not changed).
+ */
+bool igmGait::next (nao_igm &nao)
+{
+    if (tick == ss_ticks + ds_ticks)
+    {
+        if ((num_steps > 0) && (step + 1 >= num_steps))
+        {
+            return (false);
+        }
+
+        if (copy_sensors)
+        {
+            nao.state_sensor = nao.state_model;
+        }
+        nao.switchSupportFoot();
+        ++step;
+        tick = 0;
+
+        const Transform<double,3> &swing_foot =
+            (nao.support_foot == IGM_SUPPORT_LEFT) ? nao.right_foot_posture : nao.left_foot_posture;
+        Vector3d::Map(swing_foot_start) = swing_foot.translation();
+    }
+    ++tick;
+
+
+    const double step_phase = (double) tick / (ss_ticks + ds_ticks);
+    double sway = 0.0;
+
+    if (tick <= ss_ticks)
+    {
+        const double phase = (double) tick / ss_ticks;
+        Transform<double,3> *swing_foot;
+        double swing_end_y;
+
+        if (nao.support_foot == IGM_SUPPORT_LEFT)
+        {
+            swing_foot = &nao.right_foot_posture;
+            swing_end_y = nao.left_foot_posture.translation().y() - step_width;
+            sway = CoM_sway * sin(M_PI * phase);
+        }
+        else
+        {
+            swing_foot = &nao.left_foot_posture;
+            swing_end_y = nao.right_foot_posture.translation().y() + step_width;
+            sway = -CoM_sway * sin(M_PI * phase);
+        }
+
+        const double swing_end_x = (step + 1) * step_length;
+        const double s = 0.5 * (1.0 - cos(M_PI * phase));
+
+        swing_foot->translation() <<
+            swing_foot_start[0] + (swing_end_x - swing_foot_start[0]) * s,
+            swing_foot_start[1] + (swing_end_y - swing_foot_start[1]) * s,
+            swing_foot_start[2] + step_height * sin(M_PI * phase);
+    }
+
+    nao.setCoM (
+            CoM_initial[0] + (step + step_phase) * step_length,
+            CoM_initial[1] + sway,
+            CoM_initial[2]);
+
+    return (true);
+}
+
+
+
+/**
+ * @brief Check if the current tick is in double support.
+ *
+ * @return true in double support.
+ */
+bool igmGait::isDoubleSupport () const
+{
+    return (tick > ss_ticks);
+}
+
+
+
+/**
+ * @brief Get the current step.
+ *
+ * @return the step, starting from 0.
+ */
+int igmGait::getStep () const
+{
+    return (step);
+}
+
+
+
+/**
+ * @brief Get the current control tick within the step.
+ *
+ * @return the tick, starting from 1 (0 before the first call of next()).
+ */
+int igmGait::getTick () const
+{
+    return (tick);
+}
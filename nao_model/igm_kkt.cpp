@@ -0,0 +1,788 @@
+/**
+ * @file
+ * @brief Unrolled solution of the KKT system of the IGM solver.
+ */
+
+
+#include <math.h>
+
+#include "nao_igm.h"
+#include "igm_solver.h"
+
+
+/// The number of constraints without the constraint on the coupled joints.
+#define IGM_NUM_REDUCED_CONSTRAINTS (IGM_NUM_CONSTRAINTS - 1)
+/// The number of joints, the coupled joints are counted once.
+#define IGM_NUM_REDUCED_JOINTS (LOWER_JOINTS_NUM - 1)
+
+
+
+/**
+ * @brief Solve the KKT system formed in each iteration of the solver:
+ *  M = A*diag(iH)*A'
+ *  M*z = -err - A*dq0
+ *  dq = -dq0 - diag(iH)*A'*z
+ * using Cholesky decomposition of M. The code is unrolled for
+ * IGM_NUM_CONSTRAINTS = 10 and LOWER_JOINTS_NUM = 12, only the lower triangle
+ * of M is formed, no memory is allocated.
+ *
+ * @param[in] out output of the generated function: the leading matrix of
+ * the constraints A (column-major) followed by the residuals err.
+ * @param[in] iH LOWER_JOINTS_NUM diagonal of the inverted Hessian.
+ * @param[in] dq0 LOWER_JOINTS_NUM gradient of the objective function.
+ * @param[out] dq LOWER_JOINTS_NUM change of joint angles.
+ *
+ * @tparam t_Real scalar type, double or float.
+ *
+ * @note It is assumed that A has full row rank, otherwise M is not
+ * positive definite.
+ */
+template <typename t_Real>
+void igmSolveKKT (
+        const t_Real *out,
+        const t_Real *iH,
+        const t_Real *dq0,
+        t_Real *dq)
+{
+    const t_Real *A = out;
+    const t_Real *err = out + IGM_NUM_CONSTRAINTS*LOWER_JOINTS_NUM;
+
+    t_Real AiH[IGM_NUM_CONSTRAINTS*LOWER_JOINTS_NUM];
+    t_Real L[IGM_NUM_CONSTRAINTS*(IGM_NUM_CONSTRAINTS+1)/2];
+    t_Real d[IGM_NUM_CONSTRAINTS];
+    t_Real z[IGM_NUM_CONSTRAINTS];
+
+
+    // A*diag(iH)
+    for (int j = 0; j < LOWER_JOINTS_NUM; ++j)
+    {
+        for (int i = 0; i < IGM_NUM_CONSTRAINTS; ++i)
+        {
+            AiH[i + IGM_NUM_CONSTRAINTS*j] = A[i + IGM_NUM_CONSTRAINTS*j] * iH[j];
+        }
+    }
+
+    // the lower triangle of M = A*diag(iH)*A', packed by rows
+    L[0] = AiH[0]*A[0] + AiH[10]*A[10] + AiH[20]*A[20] + AiH[30]*A[30] +
+           AiH[40]*A[40] + AiH[50]*A[50] + AiH[60]*A[60] + AiH[70]*A[70] +
+           AiH[80]*A[80] + AiH[90]*A[90] + AiH[100]*A[100] + AiH[110]*A[110];
+    L[1] = AiH[1]*A[0] + AiH[11]*A[10] + AiH[21]*A[20] + AiH[31]*A[30] +
+           AiH[41]*A[40] + AiH[51]*A[50] + AiH[61]*A[60] + AiH[71]*A[70] +
+           AiH[81]*A[80] + AiH[91]*A[90] + AiH[101]*A[100] + AiH[111]*A[110];
+    L[2] = AiH[1]*A[1] + AiH[11]*A[11] + AiH[21]*A[21] + AiH[31]*A[31] +
+           AiH[41]*A[41] + AiH[51]*A[51] + AiH[61]*A[61] + AiH[71]*A[71] +
+           AiH[81]*A[81] + AiH[91]*A[91] + AiH[101]*A[101] + AiH[111]*A[111];
+    L[3] = AiH[2]*A[0] + AiH[12]*A[10] + AiH[22]*A[20] + AiH[32]*A[30] +
+           AiH[42]*A[40] + AiH[52]*A[50] + AiH[62]*A[60] + AiH[72]*A[70] +
+           AiH[82]*A[80] + AiH[92]*A[90] + AiH[102]*A[100] + AiH[112]*A[110];
+    L[4] = AiH[2]*A[1] + AiH[12]*A[11] + AiH[22]*A[21] + AiH[32]*A[31] +
+           AiH[42]*A[41] + AiH[52]*A[51] + AiH[62]*A[61] + AiH[72]*A[71] +
+           AiH[82]*A[81] + AiH[92]*A[91] + AiH[102]*A[101] + AiH[112]*A[111];
+    L[5] = AiH[2]*A[2] + AiH[12]*A[12] + AiH[22]*A[22] + AiH[32]*A[32] +
+           AiH[42]*A[42] + AiH[52]*A[52] + AiH[62]*A[62] + AiH[72]*A[72] +
+           AiH[82]*A[82] + AiH[92]*A[92] + AiH[102]*A[102] + AiH[112]*A[112];
+    L[6] = AiH[3]*A[0] + AiH[13]*A[10] + AiH[23]*A[20] + AiH[33]*A[30] +
+           AiH[43]*A[40] + AiH[53]*A[50] + AiH[63]*A[60] + AiH[73]*A[70] +
+           AiH[83]*A[80] + AiH[93]*A[90] + AiH[103]*A[100] + AiH[113]*A[110];
+    L[7] = AiH[3]*A[1] + AiH[13]*A[11] + AiH[23]*A[21] + AiH[33]*A[31] +
+           AiH[43]*A[41] + AiH[53]*A[51] + AiH[63]*A[61] + AiH[73]*A[71] +
+           AiH[83]*A[81] + AiH[93]*A[91] + AiH[103]*A[101] + AiH[113]*A[111];
+    L[8] = AiH[3]*A[2] + AiH[13]*A[12] + AiH[23]*A[22] + AiH[33]*A[32] +
+           AiH[43]*A[42] + AiH[53]*A[52] + AiH[63]*A[62] + AiH[73]*A[72] +
+           AiH[83]*A[82] + AiH[93]*A[92] + AiH[103]*A[102] + AiH[113]*A[112];
+    L[9] = AiH[3]*A[3] + AiH[13]*A[13] + AiH[23]*A[23] + AiH[33]*A[33] +
+           AiH[43]*A[43] + AiH[53]*A[53] + AiH[63]*A[63] + AiH[73]*A[73] +
+           AiH[83]*A[83] + AiH[93]*A[93] + AiH[103]*A[103] + AiH[113]*A[113];
+    L[10] = AiH[4]*A[0] + AiH[14]*A[10] + AiH[24]*A[20] + AiH[34]*A[30] +
+            AiH[44]*A[40] + AiH[54]*A[50] + AiH[64]*A[60] + AiH[74]*A[70] +
+            AiH[84]*A[80] + AiH[94]*A[90] + AiH[104]*A[100] + AiH[114]*A[110];
+    L[11] = AiH[4]*A[1] + AiH[14]*A[11] + AiH[24]*A[21] + AiH[34]*A[31] +
+            AiH[44]*A[41] + AiH[54]*A[51] + AiH[64]*A[61] + AiH[74]*A[71] +
+            AiH[84]*A[81] + AiH[94]*A[91] + AiH[104]*A[101] + AiH[114]*A[111];
+    L[12] = AiH[4]*A[2] + AiH[14]*A[12] + AiH[24]*A[22] + AiH[34]*A[32] +
+            AiH[44]*A[42] + AiH[54]*A[52] + AiH[64]*A[62] + AiH[74]*A[72] +
+            AiH[84]*A[82] + AiH[94]*A[92] + AiH[104]*A[102] + AiH[114]*A[112];
+    L[13] = AiH[4]*A[3] + AiH[14]*A[13] + AiH[24]*A[23] + AiH[34]*A[33] +
+            AiH[44]*A[43] + AiH[54]*A[53] + AiH[64]*A[63] + AiH[74]*A[73] +
+            AiH[84]*A[83] + AiH[94]*A[93] + AiH[104]*A[103] + AiH[114]*A[113];
+    L[14] = AiH[4]*A[4] + AiH[14]*A[14] + AiH[24]*A[24] + AiH[34]*A[34] +
+            AiH[44]*A[44] + AiH[54]*A[54] + AiH[64]*A[64] + AiH[74]*A[74] +
+            AiH[84]*A[84] + AiH[94]*A[94] + AiH[104]*A[104] + AiH[114]*A[114];
+    L[15] = AiH[5]*A[0] + AiH[15]*A[10] + AiH[25]*A[20] + AiH[35]*A[30] +
+            AiH[45]*A[40] + AiH[55]*A[50] + AiH[65]*A[60] + AiH[75]*A[70] +
+            AiH[85]*A[80] + AiH[95]*A[90] + AiH[105]*A[100] + AiH[115]*A[110];
+    L[16] = AiH[5]*A[1] + AiH[15]*A[11] + AiH[25]*A[21] + AiH[35]*A[31] +
+            AiH[45]*A[41] + AiH[55]*A[51] + AiH[65]*A[61] + AiH[75]*A[71] +
+            AiH[85]*A[81] + AiH[95]*A[91] + AiH[105]*A[101] + AiH[115]*A[111];
+    L[17] = AiH[5]*A[2] + AiH[15]*A[12] + AiH[25]*A[22] + AiH[35]*A[32] +
+            AiH[45]*A[42] + AiH[55]*A[52] + AiH[65]*A[62] + AiH[75]*A[72] +
+            AiH[85]*A[82] + AiH[95]*A[92] + AiH[105]*A[102] + AiH[115]*A[112];
+    L[18] = AiH[5]*A[3] + AiH[15]*A[13] + AiH[25]*A[23] + AiH[35]*A[33] +
+            AiH[45]*A[43] + AiH[55]*A[53] + AiH[65]*A[63] + AiH[75]*A[73] +
+            AiH[85]*A[83] + AiH[95]*A[93] + AiH[105]*A[103] + AiH[115]*A[113];
+    L[19] = AiH[5]*A[4] + AiH[15]*A[14] + AiH[25]*A[24] + AiH[35]*A[34] +
+            AiH[45]*A[44] + AiH[55]*A[54] + AiH[65]*A[64] + AiH[75]*A[74] +
+            AiH[85]*A[84] + AiH[95]*A[94] + AiH[105]*A[104] + AiH[115]*A[114];
+    L[20] = AiH[5]*A[5] + AiH[15]*A[15] + AiH[25]*A[25] + AiH[35]*A[35] +
+            AiH[45]*A[45] + AiH[55]*A[55] + AiH[65]*A[65] + AiH[75]*A[75] +
+            AiH[85]*A[85] + AiH[95]*A[95] + AiH[105]*A[105] + AiH[115]*A[115];
+    L[21] = AiH[6]*A[0] + AiH[16]*A[10] + AiH[26]*A[20] + AiH[36]*A[30] +
+            AiH[46]*A[40] + AiH[56]*A[50] + AiH[66]*A[60] + AiH[76]*A[70] +
+            AiH[86]*A[80] + AiH[96]*A[90] + AiH[106]*A[100] + AiH[116]*A[110];
+    L[22] = AiH[6]*A[1] + AiH[16]*A[11] + AiH[26]*A[21] + AiH[36]*A[31] +
+            AiH[46]*A[41] + AiH[56]*A[51] + AiH[66]*A[61] + AiH[76]*A[71] +
+            AiH[86]*A[81] + AiH[96]*A[91] + AiH[106]*A[101] + AiH[116]*A[111];
+    L[23] = AiH[6]*A[2] + AiH[16]*A[12] + AiH[26]*A[22] + AiH[36]*A[32] +
+            AiH[46]*A[42] + AiH[56]*A[52] + AiH[66]*A[62] + AiH[76]*A[72] +
+            AiH[86]*A[82] + AiH[96]*A[92] + AiH[106]*A[102] + AiH[116]*A[112];
+    L[24] = AiH[6]*A[3] + AiH[16]*A[13] + AiH[26]*A[23] + AiH[36]*A[33] +
+            AiH[46]*A[43] + AiH[56]*A[53] + AiH[66]*A[63] + AiH[76]*A[73] +
+            AiH[86]*A[83] + AiH[96]*A[93] + AiH[106]*A[103] + AiH[116]*A[113];
+    L[25] = AiH[6]*A[4] + AiH[16]*A[14] + AiH[26]*A[24] + AiH[36]*A[34] +
+            AiH[46]*A[44] + AiH[56]*A[54] + AiH[66]*A[64] + AiH[76]*A[74] +
+            AiH[86]*A[84] + AiH[96]*A[94] + AiH[106]*A[104] + AiH[116]*A[114];
+    L[26] = AiH[6]*A[5] + AiH[16]*A[15] + AiH[26]*A[25] + AiH[36]*A[35] +
+            AiH[46]*A[45] + AiH[56]*A[55] + AiH[66]*A[65] + AiH[76]*A[75] +
+            AiH[86]*A[85] + AiH[96]*A[95] + AiH[106]*A[105] + AiH[116]*A[115];
+    L[27] = AiH[6]*A[6] + AiH[16]*A[16] + AiH[26]*A[26] + AiH[36]*A[36] +
+            AiH[46]*A[46] + AiH[56]*A[56] + AiH[66]*A[66] + AiH[76]*A[76] +
+            AiH[86]*A[86] + AiH[96]*A[96] + AiH[106]*A[106] + AiH[116]*A[116];
+    L[28] = AiH[7]*A[0] + AiH[17]*A[10] + AiH[27]*A[20] + AiH[37]*A[30] +
+            AiH[47]*A[40] + AiH[57]*A[50] + AiH[67]*A[60] + AiH[77]*A[70] +
+            AiH[87]*A[80] + AiH[97]*A[90] + AiH[107]*A[100] + AiH[117]*A[110];
+    L[29] = AiH[7]*A[1] + AiH[17]*A[11] + AiH[27]*A[21] + AiH[37]*A[31] +
+            AiH[47]*A[41] + AiH[57]*A[51] + AiH[67]*A[61] + AiH[77]*A[71] +
+            AiH[87]*A[81] + AiH[97]*A[91] + AiH[107]*A[101] + AiH[117]*A[111];
+    L[30] = AiH[7]*A[2] + AiH[17]*A[12] + AiH[27]*A[22] + AiH[37]*A[32] +
+            AiH[47]*A[42] + AiH[57]*A[52] + AiH[67]*A[62] + AiH[77]*A[72] +
+            AiH[87]*A[82] + AiH[97]*A[92] + AiH[107]*A[102] + AiH[117]*A[112];
+    L[31] = AiH[7]*A[3] + AiH[17]*A[13] + AiH[27]*A[23] + AiH[37]*A[33] +
+            AiH[47]*A[43] + AiH[57]*A[53] + AiH[67]*A[63] + AiH[77]*A[73] +
+            AiH[87]*A[83] + AiH[97]*A[93] + AiH[107]*A[103] + AiH[117]*A[113];
+    L[32] = AiH[7]*A[4] + AiH[17]*A[14] + AiH[27]*A[24] + AiH[37]*A[34] +
+            AiH[47]*A[44] + AiH[57]*A[54] + AiH[67]*A[64] + AiH[77]*A[74] +
+            AiH[87]*A[84] + AiH[97]*A[94] + AiH[107]*A[104] + AiH[117]*A[114];
+    L[33] = AiH[7]*A[5] + AiH[17]*A[15] + AiH[27]*A[25] + AiH[37]*A[35] +
+            AiH[47]*A[45] + AiH[57]*A[55] + AiH[67]*A[65] + AiH[77]*A[75] +
+            AiH[87]*A[85] + AiH[97]*A[95] + AiH[107]*A[105] + AiH[117]*A[115];
+    L[34] = AiH[7]*A[6] + AiH[17]*A[16] + AiH[27]*A[26] + AiH[37]*A[36] +
+            AiH[47]*A[46] + AiH[57]*A[56] + AiH[67]*A[66] + AiH[77]*A[76] +
+            AiH[87]*A[86] + AiH[97]*A[96] + AiH[107]*A[106] + AiH[117]*A[116];
+    L[35] = AiH[7]*A[7] + AiH[17]*A[17] + AiH[27]*A[27] + AiH[37]*A[37] +
+            AiH[47]*A[47] + AiH[57]*A[57] + AiH[67]*A[67] + AiH[77]*A[77] +
+            AiH[87]*A[87] + AiH[97]*A[97] + AiH[107]*A[107] + AiH[117]*A[117];
+    L[36] = AiH[8]*A[0] + AiH[18]*A[10] + AiH[28]*A[20] + AiH[38]*A[30] +
+            AiH[48]*A[40] + AiH[58]*A[50] + AiH[68]*A[60] + AiH[78]*A[70] +
+            AiH[88]*A[80] + AiH[98]*A[90] + AiH[108]*A[100] + AiH[118]*A[110];
+    L[37] = AiH[8]*A[1] + AiH[18]*A[11] + AiH[28]*A[21] + AiH[38]*A[31] +
+            AiH[48]*A[41] + AiH[58]*A[51] + AiH[68]*A[61] + AiH[78]*A[71] +
+            AiH[88]*A[81] + AiH[98]*A[91] + AiH[108]*A[101] + AiH[118]*A[111];
+    L[38] = AiH[8]*A[2] + AiH[18]*A[12] + AiH[28]*A[22] + AiH[38]*A[32] +
+            AiH[48]*A[42] + AiH[58]*A[52] + AiH[68]*A[62] + AiH[78]*A[72] +
+            AiH[88]*A[82] + AiH[98]*A[92] + AiH[108]*A[102] + AiH[118]*A[112];
+    L[39] = AiH[8]*A[3] + AiH[18]*A[13] + AiH[28]*A[23] + AiH[38]*A[33] +
+            AiH[48]*A[43] + AiH[58]*A[53] + AiH[68]*A[63] + AiH[78]*A[73] +
+            AiH[88]*A[83] + AiH[98]*A[93] + AiH[108]*A[103] + AiH[118]*A[113];
+    L[40] = AiH[8]*A[4] + AiH[18]*A[14] + AiH[28]*A[24] + AiH[38]*A[34] +
+            AiH[48]*A[44] + AiH[58]*A[54] + AiH[68]*A[64] + AiH[78]*A[74] +
+            AiH[88]*A[84] + AiH[98]*A[94] + AiH[108]*A[104] + AiH[118]*A[114];
+    L[41] = AiH[8]*A[5] + AiH[18]*A[15] + AiH[28]*A[25] + AiH[38]*A[35] +
+            AiH[48]*A[45] + AiH[58]*A[55] + AiH[68]*A[65] + AiH[78]*A[75] +
+            AiH[88]*A[85] + AiH[98]*A[95] + AiH[108]*A[105] + AiH[118]*A[115];
+    L[42] = AiH[8]*A[6] + AiH[18]*A[16] + AiH[28]*A[26] + AiH[38]*A[36] +
+            AiH[48]*A[46] + AiH[58]*A[56] + AiH[68]*A[66] + AiH[78]*A[76] +
+            AiH[88]*A[86] + AiH[98]*A[96] + AiH[108]*A[106] + AiH[118]*A[116];
+    L[43] = AiH[8]*A[7] + AiH[18]*A[17] + AiH[28]*A[27] + AiH[38]*A[37] +
+            AiH[48]*A[47] + AiH[58]*A[57] + AiH[68]*A[67] + AiH[78]*A[77] +
+            AiH[88]*A[87] + AiH[98]*A[97] + AiH[108]*A[107] + AiH[118]*A[117];
+    L[44] = AiH[8]*A[8] + AiH[18]*A[18] + AiH[28]*A[28] + AiH[38]*A[38] +
+            AiH[48]*A[48] + AiH[58]*A[58] + AiH[68]*A[68] + AiH[78]*A[78] +
+            AiH[88]*A[88] + AiH[98]*A[98] + AiH[108]*A[108] + AiH[118]*A[118];
+    L[45] = AiH[9]*A[0] + AiH[19]*A[10] + AiH[29]*A[20] + AiH[39]*A[30] +
+            AiH[49]*A[40] + AiH[59]*A[50] + AiH[69]*A[60] + AiH[79]*A[70] +
+            AiH[89]*A[80] + AiH[99]*A[90] + AiH[109]*A[100] + AiH[119]*A[110];
+    L[46] = AiH[9]*A[1] + AiH[19]*A[11] + AiH[29]*A[21] + AiH[39]*A[31] +
+            AiH[49]*A[41] + AiH[59]*A[51] + AiH[69]*A[61] + AiH[79]*A[71] +
+            AiH[89]*A[81] + AiH[99]*A[91] + AiH[109]*A[101] + AiH[119]*A[111];
+    L[47] = AiH[9]*A[2] + AiH[19]*A[12] + AiH[29]*A[22] + AiH[39]*A[32] +
+            AiH[49]*A[42] + AiH[59]*A[52] + AiH[69]*A[62] + AiH[79]*A[72] +
+            AiH[89]*A[82] + AiH[99]*A[92] + AiH[109]*A[102] + AiH[119]*A[112];
+    L[48] = AiH[9]*A[3] + AiH[19]*A[13] + AiH[29]*A[23] + AiH[39]*A[33] +
+            AiH[49]*A[43] + AiH[59]*A[53] + AiH[69]*A[63] + AiH[79]*A[73] +
+            AiH[89]*A[83] + AiH[99]*A[93] + AiH[109]*A[103] + AiH[119]*A[113];
+    L[49] = AiH[9]*A[4] + AiH[19]*A[14] + AiH[29]*A[24] + AiH[39]*A[34] +
+            AiH[49]*A[44] + AiH[59]*A[54] + AiH[69]*A[64] + AiH[79]*A[74] +
+            AiH[89]*A[84] + AiH[99]*A[94] + AiH[109]*A[104] + AiH[119]*A[114];
+    L[50] = AiH[9]*A[5] + AiH[19]*A[15] + AiH[29]*A[25] + AiH[39]*A[35] +
+            AiH[49]*A[45] + AiH[59]*A[55] + AiH[69]*A[65] + AiH[79]*A[75] +
+            AiH[89]*A[85] + AiH[99]*A[95] + AiH[109]*A[105] + AiH[119]*A[115];
+    L[51] = AiH[9]*A[6] + AiH[19]*A[16] + AiH[29]*A[26] + AiH[39]*A[36] +
+            AiH[49]*A[46] + AiH[59]*A[56] + AiH[69]*A[66] + AiH[79]*A[76] +
+            AiH[89]*A[86] + AiH[99]*A[96] + AiH[109]*A[106] + AiH[119]*A[116];
+    L[52] = AiH[9]*A[7] + AiH[19]*A[17] + AiH[29]*A[27] + AiH[39]*A[37] +
+            AiH[49]*A[47] + AiH[59]*A[57] + AiH[69]*A[67] + AiH[79]*A[77] +
+            AiH[89]*A[87] + AiH[99]*A[97] + AiH[109]*A[107] + AiH[119]*A[117];
+    L[53] = AiH[9]*A[8] + AiH[19]*A[18] + AiH[29]*A[28] + AiH[39]*A[38] +
+            AiH[49]*A[48] + AiH[59]*A[58] + AiH[69]*A[68] + AiH[79]*A[78] +
+            AiH[89]*A[88] + AiH[99]*A[98] + AiH[109]*A[108] + AiH[119]*A[118];
+    L[54] = AiH[9]*A[9] + AiH[19]*A[19] + AiH[29]*A[29] + AiH[39]*A[39] +
+            AiH[49]*A[49] + AiH[59]*A[59] + AiH[69]*A[69] + AiH[79]*A[79] +
+            AiH[89]*A[89] + AiH[99]*A[99] + AiH[109]*A[109] + AiH[119]*A[119];
+
+    // the right hand side: r = -err - A*dq0
+    z[0] = -err[0] - (A[0]*dq0[0] + A[10]*dq0[1] + A[20]*dq0[2] + A[30]*dq0[3] +
+                      A[40]*dq0[4] + A[50]*dq0[5] + A[60]*dq0[6] + A[70]*dq0[7] +
+                      A[80]*dq0[8] + A[90]*dq0[9] + A[100]*dq0[10] + A[110]*dq0[11]);
+    z[1] = -err[1] - (A[1]*dq0[0] + A[11]*dq0[1] + A[21]*dq0[2] + A[31]*dq0[3] +
+                      A[41]*dq0[4] + A[51]*dq0[5] + A[61]*dq0[6] + A[71]*dq0[7] +
+                      A[81]*dq0[8] + A[91]*dq0[9] + A[101]*dq0[10] + A[111]*dq0[11]);
+    z[2] = -err[2] - (A[2]*dq0[0] + A[12]*dq0[1] + A[22]*dq0[2] + A[32]*dq0[3] +
+                      A[42]*dq0[4] + A[52]*dq0[5] + A[62]*dq0[6] + A[72]*dq0[7] +
+                      A[82]*dq0[8] + A[92]*dq0[9] + A[102]*dq0[10] + A[112]*dq0[11]);
+    z[3] = -err[3] - (A[3]*dq0[0] + A[13]*dq0[1] + A[23]*dq0[2] + A[33]*dq0[3] +
+                      A[43]*dq0[4] + A[53]*dq0[5] + A[63]*dq0[6] + A[73]*dq0[7] +
+                      A[83]*dq0[8] + A[93]*dq0[9] + A[103]*dq0[10] + A[113]*dq0[11]);
+    z[4] = -err[4] - (A[4]*dq0[0] + A[14]*dq0[1] + A[24]*dq0[2] + A[34]*dq0[3] +
+                      A[44]*dq0[4] + A[54]*dq0[5] + A[64]*dq0[6] + A[74]*dq0[7] +
+                      A[84]*dq0[8] + A[94]*dq0[9] + A[104]*dq0[10] + A[114]*dq0[11]);
+    z[5] = -err[5] - (A[5]*dq0[0] + A[15]*dq0[1] + A[25]*dq0[2] + A[35]*dq0[3] +
+                      A[45]*dq0[4] + A[55]*dq0[5] + A[65]*dq0[6] + A[75]*dq0[7] +
+                      A[85]*dq0[8] + A[95]*dq0[9] + A[105]*dq0[10] + A[115]*dq0[11]);
+    z[6] = -err[6] - (A[6]*dq0[0] + A[16]*dq0[1] + A[26]*dq0[2] + A[36]*dq0[3] +
+                      A[46]*dq0[4] + A[56]*dq0[5] + A[66]*dq0[6] + A[76]*dq0[7] +
+                      A[86]*dq0[8] + A[96]*dq0[9] + A[106]*dq0[10] + A[116]*dq0[11]);
+    z[7] = -err[7] - (A[7]*dq0[0] + A[17]*dq0[1] + A[27]*dq0[2] + A[37]*dq0[3] +
+                      A[47]*dq0[4] + A[57]*dq0[5] + A[67]*dq0[6] + A[77]*dq0[7] +
+                      A[87]*dq0[8] + A[97]*dq0[9] + A[107]*dq0[10] + A[117]*dq0[11]);
+    z[8] = -err[8] - (A[8]*dq0[0] + A[18]*dq0[1] + A[28]*dq0[2] + A[38]*dq0[3] +
+                      A[48]*dq0[4] + A[58]*dq0[5] + A[68]*dq0[6] + A[78]*dq0[7] +
+                      A[88]*dq0[8] + A[98]*dq0[9] + A[108]*dq0[10] + A[118]*dq0[11]);
+    z[9] = -err[9] - (A[9]*dq0[0] + A[19]*dq0[1] + A[29]*dq0[2] + A[39]*dq0[3] +
+                      A[49]*dq0[4] + A[59]*dq0[5] + A[69]*dq0[6] + A[79]*dq0[7] +
+                      A[89]*dq0[8] + A[99]*dq0[9] + A[109]*dq0[10] + A[119]*dq0[11]);
+
+    // Cholesky decomposition M = L*L', only the inverted diagonal of L is
+    // stored
+    d[0] = 1 / sqrt(L[0]);
+    L[1] = L[1] * d[0];
+    d[1] = 1 / sqrt(L[2] - (L[1]*L[1]));
+    L[3] = L[3] * d[0];
+    L[4] = (L[4] - (L[3]*L[1])) * d[1];
+    d[2] = 1 / sqrt(L[5] - (L[3]*L[3] + L[4]*L[4]));
+    L[6] = L[6] * d[0];
+    L[7] = (L[7] - (L[6]*L[1])) * d[1];
+    L[8] = (L[8] - (L[6]*L[3] + L[7]*L[4])) * d[2];
+    d[3] = 1 / sqrt(L[9] - (L[6]*L[6] + L[7]*L[7] + L[8]*L[8]));
+    L[10] = L[10] * d[0];
+    L[11] = (L[11] - (L[10]*L[1])) * d[1];
+    L[12] = (L[12] - (L[10]*L[3] + L[11]*L[4])) * d[2];
+    L[13] = (L[13] - (L[10]*L[6] + L[11]*L[7] + L[12]*L[8])) * d[3];
+    d[4] = 1 / sqrt(L[14] - (L[10]*L[10] + L[11]*L[11] + L[12]*L[12] + L[13]*L[13]));
+    L[15] = L[15] * d[0];
+    L[16] = (L[16] - (L[15]*L[1])) * d[1];
+    L[17] = (L[17] - (L[15]*L[3] + L[16]*L[4])) * d[2];
+    L[18] = (L[18] - (L[15]*L[6] + L[16]*L[7] + L[17]*L[8])) * d[3];
+    L[19] = (L[19] - (L[15]*L[10] + L[16]*L[11] + L[17]*L[12] + L[18]*L[13])) * d[4];
+    d[5] = 1 / sqrt(L[20] - (L[15]*L[15] + L[16]*L[16] + L[17]*L[17] + L[18]*L[18] +
+                               L[19]*L[19]));
+    L[21] = L[21] * d[0];
+    L[22] = (L[22] - (L[21]*L[1])) * d[1];
+    L[23] = (L[23] - (L[21]*L[3] + L[22]*L[4])) * d[2];
+    L[24] = (L[24] - (L[21]*L[6] + L[22]*L[7] + L[23]*L[8])) * d[3];
+    L[25] = (L[25] - (L[21]*L[10] + L[22]*L[11] + L[23]*L[12] + L[24]*L[13])) * d[4];
+    L[26] = (L[26] - (L[21]*L[15] + L[22]*L[16] + L[23]*L[17] + L[24]*L[18] +
+                      L[25]*L[19])) * d[5];
+    d[6] = 1 / sqrt(L[27] - (L[21]*L[21] + L[22]*L[22] + L[23]*L[23] + L[24]*L[24] +
+                               L[25]*L[25] + L[26]*L[26]));
+    L[28] = L[28] * d[0];
+    L[29] = (L[29] - (L[28]*L[1])) * d[1];
+    L[30] = (L[30] - (L[28]*L[3] + L[29]*L[4])) * d[2];
+    L[31] = (L[31] - (L[28]*L[6] + L[29]*L[7] + L[30]*L[8])) * d[3];
+    L[32] = (L[32] - (L[28]*L[10] + L[29]*L[11] + L[30]*L[12] + L[31]*L[13])) * d[4];
+    L[33] = (L[33] - (L[28]*L[15] + L[29]*L[16] + L[30]*L[17] + L[31]*L[18] +
+                      L[32]*L[19])) * d[5];
+    L[34] = (L[34] - (L[28]*L[21] + L[29]*L[22] + L[30]*L[23] + L[31]*L[24] +
+                      L[32]*L[25] + L[33]*L[26])) * d[6];
+    d[7] = 1 / sqrt(L[35] - (L[28]*L[28] + L[29]*L[29] + L[30]*L[30] + L[31]*L[31] +
+                               L[32]*L[32] + L[33]*L[33] + L[34]*L[34]));
+    L[36] = L[36] * d[0];
+    L[37] = (L[37] - (L[36]*L[1])) * d[1];
+    L[38] = (L[38] - (L[36]*L[3] + L[37]*L[4])) * d[2];
+    L[39] = (L[39] - (L[36]*L[6] + L[37]*L[7] + L[38]*L[8])) * d[3];
+    L[40] = (L[40] - (L[36]*L[10] + L[37]*L[11] + L[38]*L[12] + L[39]*L[13])) * d[4];
+    L[41] = (L[41] - (L[36]*L[15] + L[37]*L[16] + L[38]*L[17] + L[39]*L[18] +
+                      L[40]*L[19])) * d[5];
+    L[42] = (L[42] - (L[36]*L[21] + L[37]*L[22] + L[38]*L[23] + L[39]*L[24] +
+                      L[40]*L[25] + L[41]*L[26])) * d[6];
+    L[43] = (L[43] - (L[36]*L[28] + L[37]*L[29] + L[38]*L[30] + L[39]*L[31] +
+                      L[40]*L[32] + L[41]*L[33] + L[42]*L[34])) * d[7];
+    d[8] = 1 / sqrt(L[44] - (L[36]*L[36] + L[37]*L[37] + L[38]*L[38] + L[39]*L[39] +
+                               L[40]*L[40] + L[41]*L[41] + L[42]*L[42] + L[43]*L[43]));
+    L[45] = L[45] * d[0];
+    L[46] = (L[46] - (L[45]*L[1])) * d[1];
+    L[47] = (L[47] - (L[45]*L[3] + L[46]*L[4])) * d[2];
+    L[48] = (L[48] - (L[45]*L[6] + L[46]*L[7] + L[47]*L[8])) * d[3];
+    L[49] = (L[49] - (L[45]*L[10] + L[46]*L[11] + L[47]*L[12] + L[48]*L[13])) * d[4];
+    L[50] = (L[50] - (L[45]*L[15] + L[46]*L[16] + L[47]*L[17] + L[48]*L[18] +
+                      L[49]*L[19])) * d[5];
+    L[51] = (L[51] - (L[45]*L[21] + L[46]*L[22] + L[47]*L[23] + L[48]*L[24] +
+                      L[49]*L[25] + L[50]*L[26])) * d[6];
+    L[52] = (L[52] - (L[45]*L[28] + L[46]*L[29] + L[47]*L[30] + L[48]*L[31] +
+                      L[49]*L[32] + L[50]*L[33] + L[51]*L[34])) * d[7];
+    L[53] = (L[53] - (L[45]*L[36] + L[46]*L[37] + L[47]*L[38] + L[48]*L[39] +
+                      L[49]*L[40] + L[50]*L[41] + L[51]*L[42] + L[52]*L[43])) * d[8];
+    d[9] = 1 / sqrt(L[54] - (L[45]*L[45] + L[46]*L[46] + L[47]*L[47] + L[48]*L[48] +
+                               L[49]*L[49] + L[50]*L[50] + L[51]*L[51] + L[52]*L[52] +
+                               L[53]*L[53]));
+
+    // forward substitution: L*y = r
+    z[0] *= d[0];
+    z[1] = (z[1] - (L[1]*z[0])) * d[1];
+    z[2] = (z[2] - (L[3]*z[0] + L[4]*z[1])) * d[2];
+    z[3] = (z[3] - (L[6]*z[0] + L[7]*z[1] + L[8]*z[2])) * d[3];
+    z[4] = (z[4] - (L[10]*z[0] + L[11]*z[1] + L[12]*z[2] + L[13]*z[3])) * d[4];
+    z[5] = (z[5] - (L[15]*z[0] + L[16]*z[1] + L[17]*z[2] + L[18]*z[3] +
+                    L[19]*z[4])) * d[5];
+    z[6] = (z[6] - (L[21]*z[0] + L[22]*z[1] + L[23]*z[2] + L[24]*z[3] +
+                    L[25]*z[4] + L[26]*z[5])) * d[6];
+    z[7] = (z[7] - (L[28]*z[0] + L[29]*z[1] + L[30]*z[2] + L[31]*z[3] +
+                    L[32]*z[4] + L[33]*z[5] + L[34]*z[6])) * d[7];
+    z[8] = (z[8] - (L[36]*z[0] + L[37]*z[1] + L[38]*z[2] + L[39]*z[3] +
+                    L[40]*z[4] + L[41]*z[5] + L[42]*z[6] + L[43]*z[7])) * d[8];
+    z[9] = (z[9] - (L[45]*z[0] + L[46]*z[1] + L[47]*z[2] + L[48]*z[3] +
+                    L[49]*z[4] + L[50]*z[5] + L[51]*z[6] + L[52]*z[7] +
+                    L[53]*z[8])) * d[9];
+
+    // backward substitution: L'*z = y
+    z[9] *= d[9];
+    z[8] = (z[8] - (L[53]*z[9])) * d[8];
+    z[7] = (z[7] - (L[43]*z[8] + L[52]*z[9])) * d[7];
+    z[6] = (z[6] - (L[34]*z[7] + L[42]*z[8] + L[51]*z[9])) * d[6];
+    z[5] = (z[5] - (L[26]*z[6] + L[33]*z[7] + L[41]*z[8] + L[50]*z[9])) * d[5];
+    z[4] = (z[4] - (L[19]*z[5] + L[25]*z[6] + L[32]*z[7] + L[40]*z[8] +
+                    L[49]*z[9])) * d[4];
+    z[3] = (z[3] - (L[13]*z[4] + L[18]*z[5] + L[24]*z[6] + L[31]*z[7] +
+                    L[39]*z[8] + L[48]*z[9])) * d[3];
+    z[2] = (z[2] - (L[8]*z[3] + L[12]*z[4] + L[17]*z[5] + L[23]*z[6] +
+                    L[30]*z[7] + L[38]*z[8] + L[47]*z[9])) * d[2];
+    z[1] = (z[1] - (L[4]*z[2] + L[7]*z[3] + L[11]*z[4] + L[16]*z[5] +
+                    L[22]*z[6] + L[29]*z[7] + L[37]*z[8] + L[46]*z[9])) * d[1];
+    z[0] = (z[0] - (L[1]*z[1] + L[3]*z[2] + L[6]*z[3] + L[10]*z[4] +
+                    L[15]*z[5] + L[21]*z[6] + L[28]*z[7] + L[36]*z[8] +
+                    L[45]*z[9])) * d[0];
+
+    // dq = -dq0 - diag(iH)*A'*z
+    dq[0] = -dq0[0] - (AiH[0]*z[0] + AiH[1]*z[1] + AiH[2]*z[2] + AiH[3]*z[3] +
+                       AiH[4]*z[4] + AiH[5]*z[5] + AiH[6]*z[6] + AiH[7]*z[7] +
+                       AiH[8]*z[8] + AiH[9]*z[9]);
+    dq[1] = -dq0[1] - (AiH[10]*z[0] + AiH[11]*z[1] + AiH[12]*z[2] + AiH[13]*z[3] +
+                       AiH[14]*z[4] + AiH[15]*z[5] + AiH[16]*z[6] + AiH[17]*z[7] +
+                       AiH[18]*z[8] + AiH[19]*z[9]);
+    dq[2] = -dq0[2] - (AiH[20]*z[0] + AiH[21]*z[1] + AiH[22]*z[2] + AiH[23]*z[3] +
+                       AiH[24]*z[4] + AiH[25]*z[5] + AiH[26]*z[6] + AiH[27]*z[7] +
+                       AiH[28]*z[8] + AiH[29]*z[9]);
+    dq[3] = -dq0[3] - (AiH[30]*z[0] + AiH[31]*z[1] + AiH[32]*z[2] + AiH[33]*z[3] +
+                       AiH[34]*z[4] + AiH[35]*z[5] + AiH[36]*z[6] + AiH[37]*z[7] +
+                       AiH[38]*z[8] + AiH[39]*z[9]);
+    dq[4] = -dq0[4] - (AiH[40]*z[0] + AiH[41]*z[1] + AiH[42]*z[2] + AiH[43]*z[3] +
+                       AiH[44]*z[4] + AiH[45]*z[5] + AiH[46]*z[6] + AiH[47]*z[7] +
+                       AiH[48]*z[8] + AiH[49]*z[9]);
+    dq[5] = -dq0[5] - (AiH[50]*z[0] + AiH[51]*z[1] + AiH[52]*z[2] + AiH[53]*z[3] +
+                       AiH[54]*z[4] + AiH[55]*z[5] + AiH[56]*z[6] + AiH[57]*z[7] +
+                       AiH[58]*z[8] + AiH[59]*z[9]);
+    dq[6] = -dq0[6] - (AiH[60]*z[0] + AiH[61]*z[1] + AiH[62]*z[2] + AiH[63]*z[3] +
+                       AiH[64]*z[4] + AiH[65]*z[5] + AiH[66]*z[6] + AiH[67]*z[7] +
+                       AiH[68]*z[8] + AiH[69]*z[9]);
+    dq[7] = -dq0[7] - (AiH[70]*z[0] + AiH[71]*z[1] + AiH[72]*z[2] + AiH[73]*z[3] +
+                       AiH[74]*z[4] + AiH[75]*z[5] + AiH[76]*z[6] + AiH[77]*z[7] +
+                       AiH[78]*z[8] + AiH[79]*z[9]);
+    dq[8] = -dq0[8] - (AiH[80]*z[0] + AiH[81]*z[1] + AiH[82]*z[2] + AiH[83]*z[3] +
+                       AiH[84]*z[4] + AiH[85]*z[5] + AiH[86]*z[6] + AiH[87]*z[7] +
+                       AiH[88]*z[8] + AiH[89]*z[9]);
+    dq[9] = -dq0[9] - (AiH[90]*z[0] + AiH[91]*z[1] + AiH[92]*z[2] + AiH[93]*z[3] +
+                       AiH[94]*z[4] + AiH[95]*z[5] + AiH[96]*z[6] + AiH[97]*z[7] +
+                       AiH[98]*z[8] + AiH[99]*z[9]);
+    dq[10] = -dq0[10] - (AiH[100]*z[0] + AiH[101]*z[1] + AiH[102]*z[2] + AiH[103]*z[3] +
+                         AiH[104]*z[4] + AiH[105]*z[5] + AiH[106]*z[6] + AiH[107]*z[7] +
+                         AiH[108]*z[8] + AiH[109]*z[9]);
+    dq[11] = -dq0[11] - (AiH[110]*z[0] + AiH[111]*z[1] + AiH[112]*z[2] + AiH[113]*z[3] +
+                         AiH[114]*z[4] + AiH[115]*z[5] + AiH[116]*z[6] + AiH[117]*z[7] +
+                         AiH[118]*z[8] + AiH[119]*z[9]);
+}
+
+
+
+/**
+ * @brief Solve the same KKT system as igmSolveKKT() in the reduced space:
+ * the coupled joints L_HIP_YAW_PITCH and R_HIP_YAW_PITCH are replaced by one
+ * variable, hence the last constraint (dq[L_HIP_YAW_PITCH] =
+ * dq[R_HIP_YAW_PITCH]) is satisfied implicitly and a system of
+ * IGM_NUM_REDUCED_CONSTRAINTS = 9 equations in IGM_NUM_REDUCED_JOINTS = 11
+ * unknowns is solved.
+ *
+ * @param[in] out output of the generated function: the leading matrix of
+ * the constraints A (column-major) followed by the residuals err.
+ * @param[in] iH LOWER_JOINTS_NUM diagonal of the inverted Hessian.
+ * @param[in] dq0 LOWER_JOINTS_NUM gradient of the objective function.
+ * @param[out] dq LOWER_JOINTS_NUM change of joint angles.
+ *
+ * @tparam t_Real scalar type, double or float.
+ *
+ * @note The result is the same as the result of igmSolveKKT() up to
+ * rounding errors, since the residual of the last constraint is always zero.
+ */
+template <typename t_Real>
+void igmSolveKKTReduced (
+        const t_Real *out,
+        const t_Real *iH,
+        const t_Real *dq0,
+        t_Real *dq)
+{
+    const t_Real *A = out;
+    const t_Real *err = out + IGM_NUM_CONSTRAINTS*LOWER_JOINTS_NUM;
+
+    t_Real Ar[IGM_NUM_REDUCED_CONSTRAINTS*IGM_NUM_REDUCED_JOINTS];
+    t_Real ArH[IGM_NUM_REDUCED_CONSTRAINTS*IGM_NUM_REDUCED_JOINTS];
+    t_Real iHr[IGM_NUM_REDUCED_JOINTS];
+    t_Real dx0[IGM_NUM_REDUCED_JOINTS];
+    t_Real dx[IGM_NUM_REDUCED_JOINTS];
+    t_Real L[IGM_NUM_REDUCED_CONSTRAINTS*(IGM_NUM_REDUCED_CONSTRAINTS+1)/2];
+    t_Real d[IGM_NUM_REDUCED_CONSTRAINTS];
+    t_Real z[IGM_NUM_REDUCED_CONSTRAINTS];
+
+
+    // The first variable corresponds to both coupled joints: the columns of
+    // A are added, the weights of the objective function are added.
+    iHr[0] = 1 / (1/iH[L_HIP_YAW_PITCH] + 1/iH[R_HIP_YAW_PITCH]);
+    dx0[0] = iHr[0] * (dq0[L_HIP_YAW_PITCH]/iH[L_HIP_YAW_PITCH] + dq0[R_HIP_YAW_PITCH]/iH[R_HIP_YAW_PITCH]);
+    for (int i = 0; i < IGM_NUM_REDUCED_CONSTRAINTS; ++i)
+    {
+        Ar[i] = A[i + IGM_NUM_CONSTRAINTS*L_HIP_YAW_PITCH] + A[i + IGM_NUM_CONSTRAINTS*R_HIP_YAW_PITCH];
+    }
+
+    // The other joints in the original order
+    for (int j = 1; j < IGM_NUM_REDUCED_JOINTS; ++j)
+    {
+        int k = (j < R_HIP_YAW_PITCH) ? j : j + 1;
+
+        iHr[j] = iH[k];
+        dx0[j] = dq0[k];
+        for (int i = 0; i < IGM_NUM_REDUCED_CONSTRAINTS; ++i)
+        {
+            Ar[i + IGM_NUM_REDUCED_CONSTRAINTS*j] = A[i + IGM_NUM_CONSTRAINTS*k];
+        }
+    }
+
+    // Ar*diag(iHr)
+    for (int j = 0; j < IGM_NUM_REDUCED_JOINTS; ++j)
+    {
+        for (int i = 0; i < IGM_NUM_REDUCED_CONSTRAINTS; ++i)
+        {
+            ArH[i + IGM_NUM_REDUCED_CONSTRAINTS*j] = Ar[i + IGM_NUM_REDUCED_CONSTRAINTS*j] * iHr[j];
+        }
+    }
+
+    // the lower triangle of M = Ar*diag(iHr)*Ar', packed by rows
+    L[0] = ArH[0]*Ar[0] + ArH[9]*Ar[9] + ArH[18]*Ar[18] + ArH[27]*Ar[27] +
+           ArH[36]*Ar[36] + ArH[45]*Ar[45] + ArH[54]*Ar[54] + ArH[63]*Ar[63] +
+           ArH[72]*Ar[72] + ArH[81]*Ar[81] + ArH[90]*Ar[90];
+    L[1] = ArH[1]*Ar[0] + ArH[10]*Ar[9] + ArH[19]*Ar[18] + ArH[28]*Ar[27] +
+           ArH[37]*Ar[36] + ArH[46]*Ar[45] + ArH[55]*Ar[54] + ArH[64]*Ar[63] +
+           ArH[73]*Ar[72] + ArH[82]*Ar[81] + ArH[91]*Ar[90];
+    L[2] = ArH[1]*Ar[1] + ArH[10]*Ar[10] + ArH[19]*Ar[19] + ArH[28]*Ar[28] +
+           ArH[37]*Ar[37] + ArH[46]*Ar[46] + ArH[55]*Ar[55] + ArH[64]*Ar[64] +
+           ArH[73]*Ar[73] + ArH[82]*Ar[82] + ArH[91]*Ar[91];
+    L[3] = ArH[2]*Ar[0] + ArH[11]*Ar[9] + ArH[20]*Ar[18] + ArH[29]*Ar[27] +
+           ArH[38]*Ar[36] + ArH[47]*Ar[45] + ArH[56]*Ar[54] + ArH[65]*Ar[63] +
+           ArH[74]*Ar[72] + ArH[83]*Ar[81] + ArH[92]*Ar[90];
+    L[4] = ArH[2]*Ar[1] + ArH[11]*Ar[10] + ArH[20]*Ar[19] + ArH[29]*Ar[28] +
+           ArH[38]*Ar[37] + ArH[47]*Ar[46] + ArH[56]*Ar[55] + ArH[65]*Ar[64] +
+           ArH[74]*Ar[73] + ArH[83]*Ar[82] + ArH[92]*Ar[91];
+    L[5] = ArH[2]*Ar[2] + ArH[11]*Ar[11] + ArH[20]*Ar[20] + ArH[29]*Ar[29] +
+           ArH[38]*Ar[38] + ArH[47]*Ar[47] + ArH[56]*Ar[56] + ArH[65]*Ar[65] +
+           ArH[74]*Ar[74] + ArH[83]*Ar[83] + ArH[92]*Ar[92];
+    L[6] = ArH[3]*Ar[0] + ArH[12]*Ar[9] + ArH[21]*Ar[18] + ArH[30]*Ar[27] +
+           ArH[39]*Ar[36] + ArH[48]*Ar[45] + ArH[57]*Ar[54] + ArH[66]*Ar[63] +
+           ArH[75]*Ar[72] + ArH[84]*Ar[81] + ArH[93]*Ar[90];
+    L[7] = ArH[3]*Ar[1] + ArH[12]*Ar[10] + ArH[21]*Ar[19] + ArH[30]*Ar[28] +
+           ArH[39]*Ar[37] + ArH[48]*Ar[46] + ArH[57]*Ar[55] + ArH[66]*Ar[64] +
+           ArH[75]*Ar[73] + ArH[84]*Ar[82] + ArH[93]*Ar[91];
+    L[8] = ArH[3]*Ar[2] + ArH[12]*Ar[11] + ArH[21]*Ar[20] + ArH[30]*Ar[29] +
+           ArH[39]*Ar[38] + ArH[48]*Ar[47] + ArH[57]*Ar[56] + ArH[66]*Ar[65] +
+           ArH[75]*Ar[74] + ArH[84]*Ar[83] + ArH[93]*Ar[92];
+    L[9] = ArH[3]*Ar[3] + ArH[12]*Ar[12] + ArH[21]*Ar[21] + ArH[30]*Ar[30] +
+           ArH[39]*Ar[39] + ArH[48]*Ar[48] + ArH[57]*Ar[57] + ArH[66]*Ar[66] +
+           ArH[75]*Ar[75] + ArH[84]*Ar[84] + ArH[93]*Ar[93];
+    L[10] = ArH[4]*Ar[0] + ArH[13]*Ar[9] + ArH[22]*Ar[18] + ArH[31]*Ar[27] +
+            ArH[40]*Ar[36] + ArH[49]*Ar[45] + ArH[58]*Ar[54] + ArH[67]*Ar[63] +
+            ArH[76]*Ar[72] + ArH[85]*Ar[81] + ArH[94]*Ar[90];
+    L[11] = ArH[4]*Ar[1] + ArH[13]*Ar[10] + ArH[22]*Ar[19] + ArH[31]*Ar[28] +
+            ArH[40]*Ar[37] + ArH[49]*Ar[46] + ArH[58]*Ar[55] + ArH[67]*Ar[64] +
+            ArH[76]*Ar[73] + ArH[85]*Ar[82] + ArH[94]*Ar[91];
+    L[12] = ArH[4]*Ar[2] + ArH[13]*Ar[11] + ArH[22]*Ar[20] + ArH[31]*Ar[29] +
+            ArH[40]*Ar[38] + ArH[49]*Ar[47] + ArH[58]*Ar[56] + ArH[67]*Ar[65] +
+            ArH[76]*Ar[74] + ArH[85]*Ar[83] + ArH[94]*Ar[92];
+    L[13] = ArH[4]*Ar[3] + ArH[13]*Ar[12] + ArH[22]*Ar[21] + ArH[31]*Ar[30] +
+            ArH[40]*Ar[39] + ArH[49]*Ar[48] + ArH[58]*Ar[57] + ArH[67]*Ar[66] +
+            ArH[76]*Ar[75] + ArH[85]*Ar[84] + ArH[94]*Ar[93];
+    L[14] = ArH[4]*Ar[4] + ArH[13]*Ar[13] + ArH[22]*Ar[22] + ArH[31]*Ar[31] +
+            ArH[40]*Ar[40] + ArH[49]*Ar[49] + ArH[58]*Ar[58] + ArH[67]*Ar[67] +
+            ArH[76]*Ar[76] + ArH[85]*Ar[85] + ArH[94]*Ar[94];
+    L[15] = ArH[5]*Ar[0] + ArH[14]*Ar[9] + ArH[23]*Ar[18] + ArH[32]*Ar[27] +
+            ArH[41]*Ar[36] + ArH[50]*Ar[45] + ArH[59]*Ar[54] + ArH[68]*Ar[63] +
+            ArH[77]*Ar[72] + ArH[86]*Ar[81] + ArH[95]*Ar[90];
+    L[16] = ArH[5]*Ar[1] + ArH[14]*Ar[10] + ArH[23]*Ar[19] + ArH[32]*Ar[28] +
+            ArH[41]*Ar[37] + ArH[50]*Ar[46] + ArH[59]*Ar[55] + ArH[68]*Ar[64] +
+            ArH[77]*Ar[73] + ArH[86]*Ar[82] + ArH[95]*Ar[91];
+    L[17] = ArH[5]*Ar[2] + ArH[14]*Ar[11] + ArH[23]*Ar[20] + ArH[32]*Ar[29] +
+            ArH[41]*Ar[38] + ArH[50]*Ar[47] + ArH[59]*Ar[56] + ArH[68]*Ar[65] +
+            ArH[77]*Ar[74] + ArH[86]*Ar[83] + ArH[95]*Ar[92];
+    L[18] = ArH[5]*Ar[3] + ArH[14]*Ar[12] + ArH[23]*Ar[21] + ArH[32]*Ar[30] +
+            ArH[41]*Ar[39] + ArH[50]*Ar[48] + ArH[59]*Ar[57] + ArH[68]*Ar[66] +
+            ArH[77]*Ar[75] + ArH[86]*Ar[84] + ArH[95]*Ar[93];
+    L[19] = ArH[5]*Ar[4] + ArH[14]*Ar[13] + ArH[23]*Ar[22] + ArH[32]*Ar[31] +
+            ArH[41]*Ar[40] + ArH[50]*Ar[49] + ArH[59]*Ar[58] + ArH[68]*Ar[67] +
+            ArH[77]*Ar[76] + ArH[86]*Ar[85] + ArH[95]*Ar[94];
+    L[20] = ArH[5]*Ar[5] + ArH[14]*Ar[14] + ArH[23]*Ar[23] + ArH[32]*Ar[32] +
+            ArH[41]*Ar[41] + ArH[50]*Ar[50] + ArH[59]*Ar[59] + ArH[68]*Ar[68] +
+            ArH[77]*Ar[77] + ArH[86]*Ar[86] + ArH[95]*Ar[95];
+    L[21] = ArH[6]*Ar[0] + ArH[15]*Ar[9] + ArH[24]*Ar[18] + ArH[33]*Ar[27] +
+            ArH[42]*Ar[36] + ArH[51]*Ar[45] + ArH[60]*Ar[54] + ArH[69]*Ar[63] +
+            ArH[78]*Ar[72] + ArH[87]*Ar[81] + ArH[96]*Ar[90];
+    L[22] = ArH[6]*Ar[1] + ArH[15]*Ar[10] + ArH[24]*Ar[19] + ArH[33]*Ar[28] +
+            ArH[42]*Ar[37] + ArH[51]*Ar[46] + ArH[60]*Ar[55] + ArH[69]*Ar[64] +
+            ArH[78]*Ar[73] + ArH[87]*Ar[82] + ArH[96]*Ar[91];
+    L[23] = ArH[6]*Ar[2] + ArH[15]*Ar[11] + ArH[24]*Ar[20] + ArH[33]*Ar[29] +
+            ArH[42]*Ar[38] + ArH[51]*Ar[47] + ArH[60]*Ar[56] + ArH[69]*Ar[65] +
+            ArH[78]*Ar[74] + ArH[87]*Ar[83] + ArH[96]*Ar[92];
+    L[24] = ArH[6]*Ar[3] + ArH[15]*Ar[12] + ArH[24]*Ar[21] + ArH[33]*Ar[30] +
+            ArH[42]*Ar[39] + ArH[51]*Ar[48] + ArH[60]*Ar[57] + ArH[69]*Ar[66] +
+            ArH[78]*Ar[75] + ArH[87]*Ar[84] + ArH[96]*Ar[93];
+    L[25] = ArH[6]*Ar[4] + ArH[15]*Ar[13] + ArH[24]*Ar[22] + ArH[33]*Ar[31] +
+            ArH[42]*Ar[40] + ArH[51]*Ar[49] + ArH[60]*Ar[58] + ArH[69]*Ar[67] +
+            ArH[78]*Ar[76] + ArH[87]*Ar[85] + ArH[96]*Ar[94];
+    L[26] = ArH[6]*Ar[5] + ArH[15]*Ar[14] + ArH[24]*Ar[23] + ArH[33]*Ar[32] +
+            ArH[42]*Ar[41] + ArH[51]*Ar[50] + ArH[60]*Ar[59] + ArH[69]*Ar[68] +
+            ArH[78]*Ar[77] + ArH[87]*Ar[86] + ArH[96]*Ar[95];
+    L[27] = ArH[6]*Ar[6] + ArH[15]*Ar[15] + ArH[24]*Ar[24] + ArH[33]*Ar[33] +
+            ArH[42]*Ar[42] + ArH[51]*Ar[51] + ArH[60]*Ar[60] + ArH[69]*Ar[69] +
+            ArH[78]*Ar[78] + ArH[87]*Ar[87] + ArH[96]*Ar[96];
+    L[28] = ArH[7]*Ar[0] + ArH[16]*Ar[9] + ArH[25]*Ar[18] + ArH[34]*Ar[27] +
+            ArH[43]*Ar[36] + ArH[52]*Ar[45] + ArH[61]*Ar[54] + ArH[70]*Ar[63] +
+            ArH[79]*Ar[72] + ArH[88]*Ar[81] + ArH[97]*Ar[90];
+    L[29] = ArH[7]*Ar[1] + ArH[16]*Ar[10] + ArH[25]*Ar[19] + ArH[34]*Ar[28] +
+            ArH[43]*Ar[37] + ArH[52]*Ar[46] + ArH[61]*Ar[55] + ArH[70]*Ar[64] +
+            ArH[79]*Ar[73] + ArH[88]*Ar[82] + ArH[97]*Ar[91];
+    L[30] = ArH[7]*Ar[2] + ArH[16]*Ar[11] + ArH[25]*Ar[20] + ArH[34]*Ar[29] +
+            ArH[43]*Ar[38] + ArH[52]*Ar[47] + ArH[61]*Ar[56] + ArH[70]*Ar[65] +
+            ArH[79]*Ar[74] + ArH[88]*Ar[83] + ArH[97]*Ar[92];
+    L[31] = ArH[7]*Ar[3] + ArH[16]*Ar[12] + ArH[25]*Ar[21] + ArH[34]*Ar[30] +
+            ArH[43]*Ar[39] + ArH[52]*Ar[48] + ArH[61]*Ar[57] + ArH[70]*Ar[66] +
+            ArH[79]*Ar[75] + ArH[88]*Ar[84] + ArH[97]*Ar[93];
+    L[32] = ArH[7]*Ar[4] + ArH[16]*Ar[13] + ArH[25]*Ar[22] + ArH[34]*Ar[31] +
+            ArH[43]*Ar[40] + ArH[52]*Ar[49] + ArH[61]*Ar[58] + ArH[70]*Ar[67] +
+            ArH[79]*Ar[76] + ArH[88]*Ar[85] + ArH[97]*Ar[94];
+    L[33] = ArH[7]*Ar[5] + ArH[16]*Ar[14] + ArH[25]*Ar[23] + ArH[34]*Ar[32] +
+            ArH[43]*Ar[41] + ArH[52]*Ar[50] + ArH[61]*Ar[59] + ArH[70]*Ar[68] +
+            ArH[79]*Ar[77] + ArH[88]*Ar[86] + ArH[97]*Ar[95];
+    L[34] = ArH[7]*Ar[6] + ArH[16]*Ar[15] + ArH[25]*Ar[24] + ArH[34]*Ar[33] +
+            ArH[43]*Ar[42] + ArH[52]*Ar[51] + ArH[61]*Ar[60] + ArH[70]*Ar[69] +
+            ArH[79]*Ar[78] + ArH[88]*Ar[87] + ArH[97]*Ar[96];
+    L[35] = ArH[7]*Ar[7] + ArH[16]*Ar[16] + ArH[25]*Ar[25] + ArH[34]*Ar[34] +
+            ArH[43]*Ar[43] + ArH[52]*Ar[52] + ArH[61]*Ar[61] + ArH[70]*Ar[70] +
+            ArH[79]*Ar[79] + ArH[88]*Ar[88] + ArH[97]*Ar[97];
+    L[36] = ArH[8]*Ar[0] + ArH[17]*Ar[9] + ArH[26]*Ar[18] + ArH[35]*Ar[27] +
+            ArH[44]*Ar[36] + ArH[53]*Ar[45] + ArH[62]*Ar[54] + ArH[71]*Ar[63] +
+            ArH[80]*Ar[72] + ArH[89]*Ar[81] + ArH[98]*Ar[90];
+    L[37] = ArH[8]*Ar[1] + ArH[17]*Ar[10] + ArH[26]*Ar[19] + ArH[35]*Ar[28] +
+            ArH[44]*Ar[37] + ArH[53]*Ar[46] + ArH[62]*Ar[55] + ArH[71]*Ar[64] +
+            ArH[80]*Ar[73] + ArH[89]*Ar[82] + ArH[98]*Ar[91];
+    L[38] = ArH[8]*Ar[2] + ArH[17]*Ar[11] + ArH[26]*Ar[20] + ArH[35]*Ar[29] +
+            ArH[44]*Ar[38] + ArH[53]*Ar[47] + ArH[62]*Ar[56] + ArH[71]*Ar[65] +
+            ArH[80]*Ar[74] + ArH[89]*Ar[83] + ArH[98]*Ar[92];
+    L[39] = ArH[8]*Ar[3] + ArH[17]*Ar[12] + ArH[26]*Ar[21] + ArH[35]*Ar[30] +
+            ArH[44]*Ar[39] + ArH[53]*Ar[48] + ArH[62]*Ar[57] + ArH[71]*Ar[66] +
+            ArH[80]*Ar[75] + ArH[89]*Ar[84] + ArH[98]*Ar[93];
+    L[40] = ArH[8]*Ar[4] + ArH[17]*Ar[13] + ArH[26]*Ar[22] + ArH[35]*Ar[31] +
+            ArH[44]*Ar[40] + ArH[53]*Ar[49] + ArH[62]*Ar[58] + ArH[71]*Ar[67] +
+            ArH[80]*Ar[76] + ArH[89]*Ar[85] + ArH[98]*Ar[94];
+    L[41] = ArH[8]*Ar[5] + ArH[17]*Ar[14] + ArH[26]*Ar[23] + ArH[35]*Ar[32] +
+            ArH[44]*Ar[41] + ArH[53]*Ar[50] + ArH[62]*Ar[59] + ArH[71]*Ar[68] +
+            ArH[80]*Ar[77] + ArH[89]*Ar[86] + ArH[98]*Ar[95];
+    L[42] = ArH[8]*Ar[6] + ArH[17]*Ar[15] + ArH[26]*Ar[24] + ArH[35]*Ar[33] +
+            ArH[44]*Ar[42] + ArH[53]*Ar[51] + ArH[62]*Ar[60] + ArH[71]*Ar[69] +
+            ArH[80]*Ar[78] + ArH[89]*Ar[87] + ArH[98]*Ar[96];
+    L[43] = ArH[8]*Ar[7] + ArH[17]*Ar[16] + ArH[26]*Ar[25] + ArH[35]*Ar[34] +
+            ArH[44]*Ar[43] + ArH[53]*Ar[52] + ArH[62]*Ar[61] + ArH[71]*Ar[70] +
+            ArH[80]*Ar[79] + ArH[89]*Ar[88] + ArH[98]*Ar[97];
+    L[44] = ArH[8]*Ar[8] + ArH[17]*Ar[17] + ArH[26]*Ar[26] + ArH[35]*Ar[35] +
+            ArH[44]*Ar[44] + ArH[53]*Ar[53] + ArH[62]*Ar[62] + ArH[71]*Ar[71] +
+            ArH[80]*Ar[80] + ArH[89]*Ar[89] + ArH[98]*Ar[98];
+
+    // the right hand side: r = -err - Ar*dx0
+    z[0] = -err[0] - (Ar[0]*dx0[0] + Ar[9]*dx0[1] + Ar[18]*dx0[2] + Ar[27]*dx0[3] +
+                      Ar[36]*dx0[4] + Ar[45]*dx0[5] + Ar[54]*dx0[6] + Ar[63]*dx0[7] +
+                      Ar[72]*dx0[8] + Ar[81]*dx0[9] + Ar[90]*dx0[10]);
+    z[1] = -err[1] - (Ar[1]*dx0[0] + Ar[10]*dx0[1] + Ar[19]*dx0[2] + Ar[28]*dx0[3] +
+                      Ar[37]*dx0[4] + Ar[46]*dx0[5] + Ar[55]*dx0[6] + Ar[64]*dx0[7] +
+                      Ar[73]*dx0[8] + Ar[82]*dx0[9] + Ar[91]*dx0[10]);
+    z[2] = -err[2] - (Ar[2]*dx0[0] + Ar[11]*dx0[1] + Ar[20]*dx0[2] + Ar[29]*dx0[3] +
+                      Ar[38]*dx0[4] + Ar[47]*dx0[5] + Ar[56]*dx0[6] + Ar[65]*dx0[7] +
+                      Ar[74]*dx0[8] + Ar[83]*dx0[9] + Ar[92]*dx0[10]);
+    z[3] = -err[3] - (Ar[3]*dx0[0] + Ar[12]*dx0[1] + Ar[21]*dx0[2] + Ar[30]*dx0[3] +
+                      Ar[39]*dx0[4] + Ar[48]*dx0[5] + Ar[57]*dx0[6] + Ar[66]*dx0[7] +
+                      Ar[75]*dx0[8] + Ar[84]*dx0[9] + Ar[93]*dx0[10]);
+    z[4] = -err[4] - (Ar[4]*dx0[0] + Ar[13]*dx0[1] + Ar[22]*dx0[2] + Ar[31]*dx0[3] +
+                      Ar[40]*dx0[4] + Ar[49]*dx0[5] + Ar[58]*dx0[6] + Ar[67]*dx0[7] +
+                      Ar[76]*dx0[8] + Ar[85]*dx0[9] + Ar[94]*dx0[10]);
+    z[5] = -err[5] - (Ar[5]*dx0[0] + Ar[14]*dx0[1] + Ar[23]*dx0[2] + Ar[32]*dx0[3] +
+                      Ar[41]*dx0[4] + Ar[50]*dx0[5] + Ar[59]*dx0[6] + Ar[68]*dx0[7] +
+                      Ar[77]*dx0[8] + Ar[86]*dx0[9] + Ar[95]*dx0[10]);
+    z[6] = -err[6] - (Ar[6]*dx0[0] + Ar[15]*dx0[1] + Ar[24]*dx0[2] + Ar[33]*dx0[3] +
+                      Ar[42]*dx0[4] + Ar[51]*dx0[5] + Ar[60]*dx0[6] + Ar[69]*dx0[7] +
+                      Ar[78]*dx0[8] + Ar[87]*dx0[9] + Ar[96]*dx0[10]);
+    z[7] = -err[7] - (Ar[7]*dx0[0] + Ar[16]*dx0[1] + Ar[25]*dx0[2] + Ar[34]*dx0[3] +
+                      Ar[43]*dx0[4] + Ar[52]*dx0[5] + Ar[61]*dx0[6] + Ar[70]*dx0[7] +
+                      Ar[79]*dx0[8] + Ar[88]*dx0[9] + Ar[97]*dx0[10]);
+    z[8] = -err[8] - (Ar[8]*dx0[0] + Ar[17]*dx0[1] + Ar[26]*dx0[2] + Ar[35]*dx0[3] +
+                      Ar[44]*dx0[4] + Ar[53]*dx0[5] + Ar[62]*dx0[6] + Ar[71]*dx0[7] +
+                      Ar[80]*dx0[8] + Ar[89]*dx0[9] + Ar[98]*dx0[10]);
+
+    // Cholesky decomposition M = L*L', only the inverted diagonal of L is
+    // stored
+    d[0] = 1 / sqrt(L[0]);
+    L[1] = L[1] * d[0];
+    d[1] = 1 / sqrt(L[2] - (L[1]*L[1]));
+    L[3] = L[3] * d[0];
+    L[4] = (L[4] - (L[3]*L[1])) * d[1];
+    d[2] = 1 / sqrt(L[5] - (L[3]*L[3] + L[4]*L[4]));
+    L[6] = L[6] * d[0];
+    L[7] = (L[7] - (L[6]*L[1])) * d[1];
+    L[8] = (L[8] - (L[6]*L[3] + L[7]*L[4])) * d[2];
+    d[3] = 1 / sqrt(L[9] - (L[6]*L[6] + L[7]*L[7] + L[8]*L[8]));
+    L[10] = L[10] * d[0];
+    L[11] = (L[11] - (L[10]*L[1])) * d[1];
+    L[12] = (L[12] - (L[10]*L[3] + L[11]*L[4])) * d[2];
+    L[13] = (L[13] - (L[10]*L[6] + L[11]*L[7] + L[12]*L[8])) * d[3];
+    d[4] = 1 / sqrt(L[14] - (L[10]*L[10] + L[11]*L[11] + L[12]*L[12] + L[13]*L[13]));
+    L[15] = L[15] * d[0];
+    L[16] = (L[16] - (L[15]*L[1])) * d[1];
+    L[17] = (L[17] - (L[15]*L[3] + L[16]*L[4])) * d[2];
+    L[18] = (L[18] - (L[15]*L[6] + L[16]*L[7] + L[17]*L[8])) * d[3];
+    L[19] = (L[19] - (L[15]*L[10] + L[16]*L[11] + L[17]*L[12] + L[18]*L[13])) * d[4];
+    d[5] = 1 / sqrt(L[20] - (L[15]*L[15] + L[16]*L[16] + L[17]*L[17] + L[18]*L[18] +
+                               L[19]*L[19]));
+    L[21] = L[21] * d[0];
+    L[22] = (L[22] - (L[21]*L[1])) * d[1];
+    L[23] = (L[23] - (L[21]*L[3] + L[22]*L[4])) * d[2];
+    L[24] = (L[24] - (L[21]*L[6] + L[22]*L[7] + L[23]*L[8])) * d[3];
+    L[25] = (L[25] - (L[21]*L[10] + L[22]*L[11] + L[23]*L[12] + L[24]*L[13])) * d[4];
+    L[26] = (L[26] - (L[21]*L[15] + L[22]*L[16] + L[23]*L[17] + L[24]*L[18] +
+                      L[25]*L[19])) * d[5];
+    d[6] = 1 / sqrt(L[27] - (L[21]*L[21] + L[22]*L[22] + L[23]*L[23] + L[24]*L[24] +
+                               L[25]*L[25] + L[26]*L[26]));
+    L[28] = L[28] * d[0];
+    L[29] = (L[29] - (L[28]*L[1])) * d[1];
+    L[30] = (L[30] - (L[28]*L[3] + L[29]*L[4])) * d[2];
+    L[31] = (L[31] - (L[28]*L[6] + L[29]*L[7] + L[30]*L[8])) * d[3];
+    L[32] = (L[32] - (L[28]*L[10] + L[29]*L[11] + L[30]*L[12] + L[31]*L[13])) * d[4];
+    L[33] = (L[33] - (L[28]*L[15] + L[29]*L[16] + L[30]*L[17] + L[31]*L[18] +
+                      L[32]*L[19])) * d[5];
+    L[34] = (L[34] - (L[28]*L[21] + L[29]*L[22] + L[30]*L[23] + L[31]*L[24] +
+                      L[32]*L[25] + L[33]*L[26])) * d[6];
+    d[7] = 1 / sqrt(L[35] - (L[28]*L[28] + L[29]*L[29] + L[30]*L[30] + L[31]*L[31] +
+                               L[32]*L[32] + L[33]*L[33] + L[34]*L[34]));
+    L[36] = L[36] * d[0];
+    L[37] = (L[37] - (L[36]*L[1])) * d[1];
+    L[38] = (L[38] - (L[36]*L[3] + L[37]*L[4])) * d[2];
+    L[39] = (L[39] - (L[36]*L[6] + L[37]*L[7] + L[38]*L[8])) * d[3];
+    L[40] = (L[40] - (L[36]*L[10] + L[37]*L[11] + L[38]*L[12] + L[39]*L[13])) * d[4];
+    L[41] = (L[41] - (L[36]*L[15] + L[37]*L[16] + L[38]*L[17] + L[39]*L[18] +
+                      L[40]*L[19])) * d[5];
+    L[42] = (L[42] - (L[36]*L[21] + L[37]*L[22] + L[38]*L[23] + L[39]*L[24] +
+                      L[40]*L[25] + L[41]*L[26])) * d[6];
+    L[43] = (L[43] - (L[36]*L[28] + L[37]*L[29] + L[38]*L[30] + L[39]*L[31] +
+                      L[40]*L[32] + L[41]*L[33] + L[42]*L[34])) * d[7];
+    d[8] = 1 / sqrt(L[44] - (L[36]*L[36] + L[37]*L[37] + L[38]*L[38] + L[39]*L[39] +
+                               L[40]*L[40] + L[41]*L[41] + L[42]*L[42] + L[43]*L[43]));
+
+    // forward substitution: L*y = r
+    z[0] *= d[0];
+    z[1] = (z[1] - (L[1]*z[0])) * d[1];
+    z[2] = (z[2] - (L[3]*z[0] + L[4]*z[1])) * d[2];
+    z[3] = (z[3] - (L[6]*z[0] + L[7]*z[1] + L[8]*z[2])) * d[3];
+    z[4] = (z[4] - (L[10]*z[0] + L[11]*z[1] + L[12]*z[2] + L[13]*z[3])) * d[4];
+    z[5] = (z[5] - (L[15]*z[0] + L[16]*z[1] + L[17]*z[2] + L[18]*z[3] +
+                    L[19]*z[4])) * d[5];
+    z[6] = (z[6] - (L[21]*z[0] + L[22]*z[1] + L[23]*z[2] + L[24]*z[3] +
+                    L[25]*z[4] + L[26]*z[5])) * d[6];
+    z[7] = (z[7] - (L[28]*z[0] + L[29]*z[1] + L[30]*z[2] + L[31]*z[3] +
+                    L[32]*z[4] + L[33]*z[5] + L[34]*z[6])) * d[7];
+    z[8] = (z[8] - (L[36]*z[0] + L[37]*z[1] + L[38]*z[2] + L[39]*z[3] +
+                    L[40]*z[4] + L[41]*z[5] + L[42]*z[6] + L[43]*z[7])) * d[8];
+
+    // backward substitution: L'*z = y
+    z[8] *= d[8];
+    z[7] = (z[7] - (L[43]*z[8])) * d[7];
+    z[6] = (z[6] - (L[34]*z[7] + L[42]*z[8])) * d[6];
+    z[5] = (z[5] - (L[26]*z[6] + L[33]*z[7] + L[41]*z[8])) * d[5];
+    z[4] = (z[4] - (L[19]*z[5] + L[25]*z[6] + L[32]*z[7] + L[40]*z[8])) * d[4];
+    z[3] = (z[3] - (L[13]*z[4] + L[18]*z[5] + L[24]*z[6] + L[31]*z[7] +
+                    L[39]*z[8])) * d[3];
+    z[2] = (z[2] - (L[8]*z[3] + L[12]*z[4] + L[17]*z[5] + L[23]*z[6] +
+                    L[30]*z[7] + L[38]*z[8])) * d[2];
+    z[1] = (z[1] - (L[4]*z[2] + L[7]*z[3] + L[11]*z[4] + L[16]*z[5] +
+                    L[22]*z[6] + L[29]*z[7] + L[37]*z[8])) * d[1];
+    z[0] = (z[0] - (L[1]*z[1] + L[3]*z[2] + L[6]*z[3] + L[10]*z[4] +
+                    L[15]*z[5] + L[21]*z[6] + L[28]*z[7] + L[36]*z[8])) * d[0];
+
+    // dx = -dx0 - diag(iHr)*Ar'*z
+    dx[0] = -dx0[0] - (ArH[0]*z[0] + ArH[1]*z[1] + ArH[2]*z[2] + ArH[3]*z[3] +
+                       ArH[4]*z[4] + ArH[5]*z[5] + ArH[6]*z[6] + ArH[7]*z[7] +
+                       ArH[8]*z[8]);
+    dx[1] = -dx0[1] - (ArH[9]*z[0] + ArH[10]*z[1] + ArH[11]*z[2] + ArH[12]*z[3] +
+                       ArH[13]*z[4] + ArH[14]*z[5] + ArH[15]*z[6] + ArH[16]*z[7] +
+                       ArH[17]*z[8]);
+    dx[2] = -dx0[2] - (ArH[18]*z[0] + ArH[19]*z[1] + ArH[20]*z[2] + ArH[21]*z[3] +
+                       ArH[22]*z[4] + ArH[23]*z[5] + ArH[24]*z[6] + ArH[25]*z[7] +
+                       ArH[26]*z[8]);
+    dx[3] = -dx0[3] - (ArH[27]*z[0] + ArH[28]*z[1] + ArH[29]*z[2] + ArH[30]*z[3] +
+                       ArH[31]*z[4] + ArH[32]*z[5] + ArH[33]*z[6] + ArH[34]*z[7] +
+                       ArH[35]*z[8]);
+    dx[4] = -dx0[4] - (ArH[36]*z[0] + ArH[37]*z[1] + ArH[38]*z[2] + ArH[39]*z[3] +
+                       ArH[40]*z[4] + ArH[41]*z[5] + ArH[42]*z[6] + ArH[43]*z[7] +
+                       ArH[44]*z[8]);
+    dx[5] = -dx0[5] - (ArH[45]*z[0] + ArH[46]*z[1] + ArH[47]*z[2] + ArH[48]*z[3] +
+                       ArH[49]*z[4] + ArH[50]*z[5] + ArH[51]*z[6] + ArH[52]*z[7] +
+                       ArH[53]*z[8]);
+    dx[6] = -dx0[6] - (ArH[54]*z[0] + ArH[55]*z[1] + ArH[56]*z[2] + ArH[57]*z[3] +
+                       ArH[58]*z[4] + ArH[59]*z[5] + ArH[60]*z[6] + ArH[61]*z[7] +
+                       ArH[62]*z[8]);
+    dx[7] = -dx0[7] - (ArH[63]*z[0] + ArH[64]*z[1] + ArH[65]*z[2] + ArH[66]*z[3] +
+                       ArH[67]*z[4] + ArH[68]*z[5] + ArH[69]*z[6] + ArH[70]*z[7] +
+                       ArH[71]*z[8]);
+    dx[8] = -dx0[8] - (ArH[72]*z[0] + ArH[73]*z[1] + ArH[74]*z[2] + ArH[75]*z[3] +
+                       ArH[76]*z[4] + ArH[77]*z[5] + ArH[78]*z[6] + ArH[79]*z[7] +
+                       ArH[80]*z[8]);
+    dx[9] = -dx0[9] - (ArH[81]*z[0] + ArH[82]*z[1] + ArH[83]*z[2] + ArH[84]*z[3] +
+                       ArH[85]*z[4] + ArH[86]*z[5] + ArH[87]*z[6] + ArH[88]*z[7] +
+                       ArH[89]*z[8]);
+    dx[10] = -dx0[10] - (ArH[90]*z[0] + ArH[91]*z[1] + ArH[92]*z[2] + ArH[93]*z[3] +
+                         ArH[94]*z[4] + ArH[95]*z[5] + ArH[96]*z[6] + ArH[97]*z[7] +
+                         ArH[98]*z[8]);
+
+
+    // back to the original variables
+    dq[L_HIP_YAW_PITCH] = dq[R_HIP_YAW_PITCH] = dx[0];
+    for (int j = 1; j < IGM_NUM_REDUCED_JOINTS; ++j)
+    {
+        dq[(j < R_HIP_YAW_PITCH) ? j : j + 1] = dx[j];
+    }
+}
+
+
+
+template void igmSolveKKT<double> (const double *, const double *, const double *, double *);
+template void igmSolveKKT<float> (const float *, const float *, const float *, float *);
+template void igmSolveKKTReduced<double> (const double *, const double *, const double *, double *);
+template void igmSolveKKTReduced<float> (const float *, const float *, const float *, float *);
@@ -0,0 +1,355 @@
+/**
+ * @file
+ * @brief Solving of independent batches of IGM problems by a pool of
+ * threads with work stealing.
+ */
+
+
+#include "nao_igm.h"
+
+#include <pthread.h>
+
+
+
+/**
+ * @brief Jobs of a thread: the owner takes jobs from the front, other
+ * threads steal jobs from the back.
+ */
+class igmPoolQueue
+{
+    public:
+        pthread_mutex_t mutex;
+        /// The first job in the queue.
+        int begin;
+        /// The job after the last job in the queue.
+        int end;
+
+    private:
+        char padding[IGM_CACHE_LINE_SIZE];
+};
+
+
+
+/**
+ * @brief Argument of a thread.
+ */
+class igmPoolThread
+{
+    public:
+        igmPoolState *state;
+        int index;
+};
+
+
+
+/**
+ * @brief Threads, queues and the current task of igmPool.
+ */
+class igmPoolState
+{
+    public:
+        void work (const int, int &, int &);
+
+
+        /// The number of threads including the thread calling
+        /// igmPool::solve(), which has index 0.
+        int num_threads;
+        /// num_threads - 1 started threads.
+        pthread_t *threads;
+        igmPoolThread *args;
+        /// num_threads queues.
+        igmPoolQueue *queues;
+
+        pthread_mutex_t mutex;
+        /// Signals changes of generation, terminate and num_active.
+        pthread_cond_t cond;
+
+        /// Incremented on each call of igmPool::solve().
+        int generation;
+        /// The threads must exit.
+        bool terminate;
+        /// The number of started threads, which have not finished the
+        /// current generation.
+        int num_active;
+
+        igmBatch *jobs;
+        double mu;
+        double tol;
+        int max_iter;
+
+        int num_failed;
+        int num_steals;
+};
+
+
+
+/**
+ * @brief Solve jobs from the own queue and steal jobs from other queues
+ * until all queues are empty.
+ *
+ * @param[in] index index of the thread.
+ * @param[in,out] failed the number of failed problems is added.
+ * @param[in,out] steals the number of stolen jobs is added.
+ */
+void igmPoolState::work (const int index, int &failed, int &steals)
+{
+    for (;;)
+    {
+        int job = -1;
+
+        pthread_mutex_lock(&queues[index].mutex);
+        if (queues[index].begin < queues[index].end)
+        {
+            job = queues[index].begin;
+            ++queues[index].begin;
+        }
+        pthread_mutex_unlock(&queues[index].mutex);
+
+        for (int i = 1; (job < 0) && (i < num_threads); ++i)
+        {
+            igmPoolQueue &victim = queues[(index + i) % num_threads];
+
+            pthread_mutex_lock(&victim.mutex);
+            if (victim.begin < victim.end)
+            {
+                --victim.end;
+                job = victim.end;
+                ++steals;
+            }
+            pthread_mutex_unlock(&victim.mutex);
+        }
+
+        // no new jobs are added, all queues are empty
+        if (job < 0)
+        {
+            break;
+        }
+
+        failed += jobs[job].solve(mu, tol, max_iter);
+    }
+}
+
+
+
+/**
+ * @brief Main loop of a started thread.
+ *
+ * @param[in] arg igmPoolThread object.
+ *
+ * @return NULL
+ */
+static void *igmPoolRun (void *arg)
+{
+    igmPoolState *state = static_cast<igmPoolThread *>(arg)->state;
+    int index = static_cast<igmPoolThread *>(arg)->index;
+    int generation = 0;
+
+    pthread_mutex_lock(&state->mutex);
+    for (;;)
+    {
+        while ((state->generation == generation) && !state->terminate)
+        {
+            pthread_cond_wait(&state->cond, &state->mutex);
+        }
+        if (state->terminate)
+        {
+            break;
+        }
+        generation = state->generation;
+        pthread_mutex_unlock(&state->mutex);
+
+        int failed = 0;
+        int steals = 0;
+        state->work(index, failed, steals);
+
+        pthread_mutex_lock(&state->mutex);
+        state->num_failed += failed;
+        state->num_steals += steals;
+        --state->num_active;
+        if (state->num_active == 0)
+        {
+            pthread_cond_broadcast(&state->cond);
+        }
+    }
+    pthread_mutex_unlock(&state->mutex);
+
+    return (NULL);
+}
+
+
+
+/**
+ * @brief Constructor, the pool is not started.
+ */
+igmPool::igmPool()
+{
+    num_steals = 0;
+    state = NULL;
+}
+
+
+
+/**
+ * @brief Destructor, stops the pool.
+ */
+igmPool::~igmPool()
+{
+    stop();
+}
+
+
+
+/**
+ * @brief Start the pool.
+ *
+ * @param[in] num_threads the number of threads including the thread
+ * calling solve().
+ *
+ * @return 0 on success, -1 if the threads cannot be started, solve() uses
+ * only the calling thread in this case.
+ */
+int igmPool::start (const int num_threads)
+{
+    stop();
+
+    if (num_threads < 1)
+    {
+        return (-1);
+    }
+
+    state = new igmPoolState;
+    state->num_threads = num_threads;
+    state->threads = new pthread_t[num_threads];
+    state->args = new igmPoolThread[num_threads];
+    state->queues = new igmPoolQueue[num_threads];
+    state->generation = 0;
+    state->terminate = false;
+    state->num_active = 0;
+
+    pthread_mutex_init(&state->mutex, NULL);
+    pthread_cond_init(&state->cond, NULL);
+    for (int i = 0; i < num_threads; ++i)
+    {
+        pthread_mutex_init(&state->queues[i].mutex, NULL);
+        state->queues[i].begin = 0;
+        state->queues[i].end = 0;
+    }
+
+    for (int i = 1; i < num_threads; ++i)
+    {
+        state->args[i].state = state;
+        state->args[i].index = i;
+        if (pthread_create(&state->threads[i], NULL, igmPoolRun, &state->args[i]) != 0)
+        {
+            state->num_threads = i;
+            stop();
+            return (-1);
+        }
+    }
+
+    return (0);
+}
+
+
+
+/**
+ * @brief Stop the threads of the pool.
+ */
+void igmPool::stop()
+{
+    if (state == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&state->mutex);
+    state->terminate = true;
+    pthread_cond_broadcast(&state->cond);
+    pthread_mutex_unlock(&state->mutex);
+
+    for (int i = 1; i < state->num_threads; ++i)
+    {
+        pthread_join(state->threads[i], NULL);
+    }
+    for (int i = 0; i < state->num_threads; ++i)
+    {
+        pthread_mutex_destroy(&state->queues[i].mutex);
+    }
+    pthread_cond_destroy(&state->cond);
+    pthread_mutex_destroy(&state->mutex);
+
+    delete [] state->queues;
+    delete [] state->args;
+    delete [] state->threads;
+    delete state;
+    state = NULL;
+}
+
+
+
+/**
+ * @brief Solve independent jobs, which are distributed evenly over the
+ * threads and redistributed by work stealing when a thread runs out of jobs.
+ *
+ * @param[in,out] jobs jobs, usually with igmBatch::warm_start set.
+ * @param[in] num_jobs the number of jobs.
+ * @param[in] mu penalty for difference between solution and reference angles
+ * @param[in] tol tolerance
+ * @param[in] max_iter maximal number of iterations
+ *
+ * @return the total number of problems, which were not solved within
+ * max_iter iterations.
+ *
+ * @note The results do not depend on the number of threads, since each job
+ * is solved by one thread.
+ */
+int igmPool::solve (
+        igmBatch *jobs,
+        const int num_jobs,
+        const double mu,
+        const double tol,
+        const int max_iter)
+{
+    int num_failed = 0;
+    num_steals = 0;
+
+    if (state == NULL)
+    {
+        for (int i = 0; i < num_jobs; ++i)
+        {
+            num_failed += jobs[i].solve(mu, tol, max_iter);
+        }
+        return (num_failed);
+    }
+
+
+    pthread_mutex_lock(&state->mutex);
+    for (int i = 0; i < state->num_threads; ++i)
+    {
+        state->queues[i].begin = (i * num_jobs) / state->num_threads;
+        state->queues[i].end = ((i + 1) * num_jobs) / state->num_threads;
+    }
+    state->jobs = jobs;
+    state->mu = mu;
+    state->tol = tol;
+    state->max_iter = max_iter;
+    state->num_failed = 0;
+    state->num_steals = 0;
+    state->num_active = state->num_threads - 1;
+    ++state->generation;
+    pthread_cond_broadcast(&state->cond);
+    pthread_mutex_unlock(&state->mutex);
+
+    state->work(0, num_failed, num_steals);
+
+    pthread_mutex_lock(&state->mutex);
+    while (state->num_active > 0)
+    {
+        pthread_cond_wait(&state->cond, &state->mutex);
+    }
+    num_failed += state->num_failed;
+    num_steals += state->num_steals;
+    pthread_mutex_unlock(&state->mutex);
+
+    return (num_failed);
+}
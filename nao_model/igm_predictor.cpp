@@ -0,0 +1,131 @@
+/**
+ * @file
+ * @brief Extrapolation of solutions of the IGM in time.
+ */
+
+
+#include "nao_igm.h"
+
+
+
+/**
+ * @brief Constructor, no solutions are stored.
+ */
+igmPredictor::igmPredictor()
+{
+    order = 2;
+    reset();
+}
+
+
+
+/**
+ * @brief Forget all stored solutions.
+ */
+void igmPredictor::reset()
+{
+    num = 0;
+}
+
+
+
+/**
+ * @brief Forget all stored solutions except the last one.
+ */
+void igmPredictor::restart()
+{
+    if (num > 1)
+    {
+        num = 1;
+    }
+}
+
+
+
+/**
+ * @brief Store a solution.
+ *
+ * @param[in] t time.
+ * @param[in] q_new JOINTS_NUM joint angles, only the angles of the lower
+ * part of the body are stored.
+ *
+ * @note The stored times must be distinct, otherwise extrapolation
+ * divides by zero: a solution with the same time as the last stored
+ * solution replaces it, a solution with an earlier time replaces all
+ * stored solutions.
+ */
+void igmPredictor::add (const double t, const double *q_new)
+{
+    if ((num > 0) && (t < time[0]))
+    {
+        num = 0;
+    }
+
+    if ((num == 0) || (t != time[0]))
+    {
+        for (int k = 2; k > 0; --k)
+        {
+            time[k] = time[k-1];
+            for (int i = 0; i < LOWER_JOINTS_NUM; ++i)
+            {
+                q[k][i] = q[k-1][i];
+            }
+        }
+
+        if (num < 3)
+        {
+            ++num;
+        }
+    }
+
+    time[0] = t;
+    for (int i = 0; i < LOWER_JOINTS_NUM; ++i)
+    {
+        q[0][i] = q_new[i];
+    }
+}
+
+
+
+/**
+ * @brief Predict the solution by Lagrange extrapolation of the stored
+ * solutions.
+ *
+ * @param[in] t time.
+ * @param[in,out] q_pred JOINTS_NUM joint angles, only the angles of the lower
+ * part of the body are altered. Not altered if there are no stored solutions.
+ *
+ * @note The order of extrapolation is reduced if there are not enough
+ * stored solutions.
+ */
+void igmPredictor::predict (const double t, double *q_pred) const
+{
+    int n = order + 1;
+    if (n > num)
+    {
+        n = num;
+    }
+
+    // Lagrange basis polynomials evaluated at t
+    double w[3];
+    for (int k = 0; k < n; ++k)
+    {
+        w[k] = 1.0;
+        for (int j = 0; j < n; ++j)
+        {
+            if (j != k)
+            {
+                w[k] *= (t - time[j]) / (time[k] - time[j]);
+            }
+        }
+    }
+
+    for (int i = 0; (n > 0) && (i < LOWER_JOINTS_NUM); ++i)
+    {
+        q_pred[i] = 0.0;
+        for (int k = 0; k < n; ++k)
+        {
+            q_pred[i] += w[k]*q[k][i];
+        }
+    }
+}
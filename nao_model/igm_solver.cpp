@@ -0,0 +1,508 @@
+/**
+ * @file
+ * @brief Newton-type solver of the inverse geometric problem.
+ */
+
+
+#include "nao_igm.h"
+
+#include <string.h>
+#include <math.h>
+
+#include <Eigen/Core>       // Cholesky decomposition + solving
+#include <Eigen/Cholesky>   // of system of linear equations.
+
+#include "maple_functions.h"
+#include "igm_solver.h"
+
+
+
+/**
+ * @brief Constructor, sets default options.
+ */
+igmOptions::igmOptions()
+{
+    incremental_trig = false;
+    trig_refresh_period = 16;
+
+    jacobian_update = IGM_JACOBIAN_EXACT;
+    jacobian_refresh_period = 8;
+    jacobian_stall_ratio = 0.5;
+
+    residual_tol = 0.0;
+
+    reduced_kkt = false;
+
+    precision = IGM_PRECISION_DOUBLE;
+    mixed_precision_tol = 1e-3;
+
+    flush_denormals = false;
+}
+
+
+
+/**
+ * @brief Evaluate the leading matrix of the constraints and the residuals.
+ *
+ * @param[in] support_foot current support foot.
+ * @param[in] trig sine and cosine of the current joint angles.
+ * @param[in] support_foot_posture 4x4 homogeneous matrix of the support foot.
+ * @param[in] swing_foot_posture 4x4 homogeneous matrix of the swing foot.
+ * @param[in] CoM_position 3x1 position of the CoM.
+ * @param[out] out IGM_KERNEL_OUTPUT_SIZE output of from_LLeg_3() or
+ * from_RLeg_3().
+ */
+void igmEvaluate (
+        const igmSupportFoot support_foot,
+        const jointTrig &trig,
+        const double *support_foot_posture,
+        const double *swing_foot_posture,
+        const double *CoM_position,
+        double *out)
+{
+    if (support_foot == IGM_SUPPORT_LEFT)
+    {
+        IGM_TIMELINE_SCOPE("from_LLeg_3");
+        from_LLeg_3_trig (
+                trig.sin_q, trig.cos_q,
+                support_foot_posture,
+                swing_foot_posture,
+                CoM_position,
+                out);
+    }
+    else
+    {
+        IGM_TIMELINE_SCOPE("from_RLeg_3");
+        from_RLeg_3_trig (
+                trig.sin_q, trig.cos_q,
+                support_foot_posture,
+                swing_foot_posture,
+                CoM_position,
+                out);
+    }
+}
+
+
+
+/**
+ * @brief Evaluate the residuals of the constraints without the leading
+ * matrix, the results are identical to the residuals computed by
+ * from_LLeg_3() and from_RLeg_3().
+ *
+ * @param[in] support_foot current support foot.
+ * @param[in] trig sine and cosine of the current joint angles.
+ * @param[in] support_foot_posture 4x4 homogeneous matrix of the support foot.
+ * @param[in] swing_foot_posture 4x4 homogeneous matrix of the swing foot.
+ * @param[in] CoM_position 3x1 position of the CoM.
+ * @param[out] err IGM_NUM_CONSTRAINTS residuals.
+ */
+void igmResidual (
+        const igmSupportFoot support_foot,
+        const jointTrig &trig,
+        const double *support_foot_posture,
+        const double *swing_foot_posture,
+        const double *CoM_position,
+        double *err)
+{
+    if (support_foot == IGM_SUPPORT_LEFT)
+    {
+        IGM_TIMELINE_SCOPE("from_LLeg_3_residual");
+        from_LLeg_3_residual_trig (
+                trig.sin_q, trig.cos_q,
+                support_foot_posture,
+                swing_foot_posture,
+                CoM_position,
+                err);
+    }
+    else
+    {
+        IGM_TIMELINE_SCOPE("from_RLeg_3_residual");
+        from_RLeg_3_residual_trig (
+                trig.sin_q, trig.cos_q,
+                support_foot_posture,
+                swing_foot_posture,
+                CoM_position,
+                err);
+    }
+}
+
+
+
+/**
+ * @brief Broyden rank-one update of the leading matrix of the constraints:
+ *  A = A + (err_prev - err - A*dq) * dq' / (dq' * dq)
+ * note that A = -d(err)/dq.
+ *
+ * @param[in] dq LOWER_JOINTS_NUM change of joint angles in the last
+ * iteration.
+ * @param[in] err_prev IGM_NUM_CONSTRAINTS residuals before the last
+ * iteration.
+ * @param[in,out] out the leading matrix of the constraints followed by the
+ * residuals after the last iteration (the layout of the output of
+ * from_LLeg_3()), the matrix is updated.
+ */
+void igmBroydenUpdate (
+        const double *dq_data,
+        const double *err_prev_data,
+        double *out)
+{
+    Map< Matrix<double, LOWER_JOINTS_NUM, 1> > dq(dq_data);
+    Map< Matrix<double, IGM_NUM_CONSTRAINTS, 1> > err_prev(err_prev_data);
+    Map< Matrix<double, IGM_NUM_CONSTRAINTS, 1> > err(out + IGM_NUM_CONSTRAINTS*LOWER_JOINTS_NUM);
+    Map< Matrix<double, IGM_NUM_CONSTRAINTS, LOWER_JOINTS_NUM> > A(out);
+
+    double dq_norm2 = dq.squaredNorm();
+    if (dq_norm2 > 0.0)
+    {
+        A += ((err_prev - err - A*dq) / dq_norm2) * dq.transpose();
+    }
+}
+
+
+
+/**
+ * @brief Perform one iteration of the solver using the results of
+ * from_LLeg_3() or from_RLeg_3().
+ *
+ * @param[in] options options of the solver.
+ * @param[in] out output of the generated function: the leading matrix of
+ * the constraints followed by the residuals.
+ * @param[in] ref_angles LOWER_JOINTS_NUM reference joint angles
+ * @param[in] mu penalty for difference between solution and reference angles
+ * @param[in,out] q joint angles to be updated.
+ *
+ * @return infinity norm of the change of joint angles.
+ *
+ * @tparam t_Real scalar type, double or float.
+ */
+template <typename t_Real>
+t_Real igmStep (
+        const igmOptions &options,
+        const t_Real *out,
+        const t_Real *ref_angles,
+        const t_Real mu,
+        t_Real *q)
+{
+    t_Real dq0[LOWER_JOINTS_NUM];
+    t_Real dq[LOWER_JOINTS_NUM];
+    t_Real iH[LOWER_JOINTS_NUM]; // inverted Hessian
+
+    for (int i = 0; i < LOWER_JOINTS_NUM; ++i)
+    {
+        iH[i] = 1.0;
+        dq0[i] = mu*(q[i] - ref_angles[i]);
+    }
+    // joints can be penalized here:
+    //iH[L_HIP_ROLL] = 0.5;
+    //iH[R_HIP_ROLL] = 0.5;
+
+
+    // Solve KKT system
+    if (options.reduced_kkt)
+    {
+        IGM_TIMELINE_SCOPE("igmSolveKKTReduced");
+        igmSolveKKTReduced (out, iH, dq0, dq);
+    }
+    else
+    {
+        IGM_TIMELINE_SCOPE("igmSolveKKT");
+        igmSolveKKT (out, iH, dq0, dq);
+    }
+
+
+    // Update angles (of legs) and compute the infinity norm of dq
+    // (we want the absolute value of angle change to be detectable by
+    // the corresponding sensor, see 'tol' variable above)
+    t_Real norm_dq = 0.0;
+    for (int i = 0; i < LOWER_JOINTS_NUM; ++i)
+    {
+        q[i] += dq[i];
+        if (fabs(dq[i]) > norm_dq)
+        {
+            norm_dq = fabs(dq[i]);
+        }
+    }
+
+    return (norm_dq);
+}
+
+
+template double igmStep<double> (const igmOptions &, const double *, const double *, const double, double *);
+template float igmStep<float> (const igmOptions &, const float *, const float *, const float, float *);
+
+
+
+/**
+ * @brief Perform one iteration of the solver using the results of
+ * from_LLeg_3() or from_RLeg_3(), Eigen version of igmStep(), which is
+ * kept for reference.
+ *
+ * @param[in] out output of the generated function: the leading matrix of
+ * the constraints followed by the residuals.
+ * @param[in] ref_angles LOWER_JOINTS_NUM reference joint angles
+ * @param[in] mu penalty for difference between solution and reference angles
+ * @param[in,out] q_data joint angles to be updated.
+ *
+ * @return infinity norm of the change of joint angles.
+ */
+double igmStepEigen (
+        const double *out,
+        const double *ref_angles,
+        const double mu,
+        double *q_data)
+{
+    Map< Matrix<double, LOWER_JOINTS_NUM, 1> > q(q_data);
+    Map< Matrix<double, LOWER_JOINTS_NUM, 1> > q0(ref_angles);
+    Matrix<double, LOWER_JOINTS_NUM, 1> dq;
+    Matrix<double, LOWER_JOINTS_NUM, 1> iH; // inverted Hessian
+
+    iH.setConstant(1.0);
+    // joints can be penalized here:
+    //iH(L_HIP_ROLL) = 0.5;
+    //iH(R_HIP_ROLL) = 0.5;
+
+    Map< Matrix<double, IGM_NUM_CONSTRAINTS, LOWER_JOINTS_NUM> > A(out);
+    Matrix<double, IGM_NUM_CONSTRAINTS, 1> err =
+        Map< Matrix<double, IGM_NUM_CONSTRAINTS, 1> >(out + IGM_NUM_CONSTRAINTS*LOWER_JOINTS_NUM);
+
+
+    // Solve KKT system
+    dq = mu*(q - q0);
+    err = -err - A*dq;
+    // FP underflow occurs in solveInPlace(), see igmOptions::flush_denormals.
+    (A*iH.asDiagonal()*A.transpose()).llt().solveInPlace(err);
+    dq = -dq - iH.asDiagonal()*A.transpose() * err;
+    // Update angles (of legs)
+    q += dq;
+
+    // Compute the infinity norm of dq
+    // (we want the absolute value of angle change to be detectable by
+    // the corresponding sensor, see 'tol' variable above)
+    return (dq.lpNorm<Eigen::Infinity>());
+}
+
+
+
+/**
+ * @brief Solves the Inverse Geometric Problem (IGM) for the given data.
+ *
+ * @param[in] options options of the solver.
+ * @param[in] support_foot current support foot.
+ * @param[in] support_foot_posture 4x4 homogeneous matrix of the support foot.
+ * @param[in] swing_foot_posture 4x4 homogeneous matrix of the swing foot.
+ * @param[in] CoM_position 3x1 position of the CoM.
+ * @param[in] ref_angles LOWER_JOINTS_NUM reference joint angles
+ * @param[in] mu penalty for difference between solution and reference angles
+ * @param[in] tol tolerance
+ * @param[in] max_iter maximal number of iterations
+ * @param[in,out] q JOINTS_NUM joint angles: initial guess on input, solution
+ * on output.
+ * @param[in,out] trig sine and cosine of joint angles, updated in each
+ * iteration.
+ *
+ * @return the number of iterations performed until convergence, or a negative number
+ * if the algorithm did not converge within max_iter number of iterations.
+ *
+ * @note It is assumed that the leading matrix of the constraints is nonsingular.
+ *
+ * @note If options.jacobian_update is not IGM_JACOBIAN_EXACT, the exact
+ * Jacobian is evaluated in the first iteration, when convergence stalls or
+ * after options.jacobian_refresh_period iterations with approximate
+ * Jacobian; only the residuals are evaluated in other iterations. A small
+ * step with approximate Jacobian does not imply convergence, hence the
+ * solver stops only after a step with exact Jacobian not exceeding tol.
+ *
+ * @note If options.residual_tol is positive, the residuals are evaluated
+ * before each iteration and the solver stops as soon as their infinity norm
+ * does not exceed options.residual_tol.
+ *
+ * @note If options.precision is IGM_PRECISION_FLOAT, all iterations are
+ * performed in single precision by igmSolveFloat(). If it is
+ * IGM_PRECISION_MIXED, single precision iterations are performed until the
+ * tolerance max(tol, options.mixed_precision_tol) is reached, then the
+ * solution is refined in double precision (at least one iteration). The
+ * iterations of both kinds are counted against max_iter.
+ *
+ * @note If the library is compiled with IGM_TRACE_ENABLE and trace is not
+ * NULL, the call and its double precision iterations are recorded.
+ */
+int igmSolve (
+        const igmOptions &options,
+        const igmSupportFoot support_foot,
+        const double *support_foot_posture,
+        const double *swing_foot_posture,
+        const double *CoM_position,
+        const double *ref_angles,
+        const double mu,
+        const double tol,
+        const int max_iter,
+        double *q,
+        jointTrig &trig,
+        igmTrace *trace)
+{
+    igmDenormalsScope denormals_scope(options.flush_denormals);
+
+#ifdef IGM_TRACE_ENABLE
+    double trace_start = (trace != NULL) ? igmTrace::getTime() : 0.0;
+#endif
+
+    double out[IGM_KERNEL_OUTPUT_SIZE];
+    double *err = out + IGM_NUM_CONSTRAINTS*LOWER_JOINTS_NUM;
+
+    double err_prev[IGM_NUM_CONSTRAINTS];
+    double dq[LOWER_JOINTS_NUM];
+    int num_approx = 0;
+
+    int iter;
+    double norm_dq = 1.0;
+    // true if the last step is made with exact Jacobian.
+    bool exact_step = true;
+
+    int num_float_iter = 0;
+    if (options.precision != IGM_PRECISION_DOUBLE)
+    {
+        double float_tol = tol;
+        if ((options.precision == IGM_PRECISION_MIXED) && (options.mixed_precision_tol > tol))
+        {
+            float_tol = options.mixed_precision_tol;
+        }
+
+        double norm_dq_float;
+        num_float_iter = igmSolveFloat (
+                options,
+                support_foot,
+                support_foot_posture,
+                swing_foot_posture,
+                CoM_position,
+                ref_angles,
+                mu,
+                float_tol,
+                max_iter,
+                q,
+                norm_dq_float);
+
+        if (options.precision == IGM_PRECISION_FLOAT)
+        {
+            norm_dq = norm_dq_float;
+            trig.update(q);
+        }
+    }
+
+    for (iter = 0; ((norm_dq > tol) || !exact_step) && (num_float_iter + iter <= max_iter); ++iter)
+    {
+#ifdef IGM_TRACE_ENABLE
+        double trace_kernel_start = (trace != NULL) ? igmTrace::getTime() : 0.0;
+#endif
+
+        // Form data
+        if (options.incremental_trig)
+        {
+            trig.updateIncremental(q, options.trig_refresh_period);
+        }
+        else
+        {
+            trig.update(q);
+        }
+
+        // Try to avoid evaluation of the Jacobian, convergence is checked
+        // with exact Jacobian
+        bool exact_jacobian = true;
+        bool approx_jacobian = (options.jacobian_update != IGM_JACOBIAN_EXACT)
+                                && (iter > 0)
+                                && (num_approx < options.jacobian_refresh_period)
+                                && (norm_dq > tol);
+        if (approx_jacobian || (options.residual_tol > 0.0))
+        {
+            if (iter > 0)
+            {
+                memcpy(err_prev, err, sizeof(err_prev));
+            }
+            igmResidual (
+                    support_foot,
+                    trig,
+                    support_foot_posture,
+                    swing_foot_posture,
+                    CoM_position,
+                    err);
+
+            double norm_err = Map< Matrix<double, IGM_NUM_CONSTRAINTS, 1> >(err).lpNorm<Eigen::Infinity>();
+            if (norm_err <= options.residual_tol)
+            {
+                break;
+            }
+
+            // otherwise convergence stalls
+            if (approx_jacobian
+                    && (norm_err <= options.jacobian_stall_ratio
+                        * Map< Matrix<double, IGM_NUM_CONSTRAINTS, 1> >(err_prev).lpNorm<Eigen::Infinity>()))
+            {
+                exact_jacobian = false;
+                ++num_approx;
+
+                if (options.jacobian_update == IGM_JACOBIAN_BROYDEN)
+                {
+                    igmBroydenUpdate (dq, err_prev, out);
+                }
+            }
+        }
+
+        if (exact_jacobian)
+        {
+            num_approx = 0;
+            igmEvaluate (
+                    support_foot,
+                    trig,
+                    support_foot_posture,
+                    swing_foot_posture,
+                    CoM_position,
+                    out);
+        }
+
+#ifdef IGM_TRACE_ENABLE
+        double trace_solve_start = (trace != NULL) ? igmTrace::getTime() : 0.0;
+#endif
+
+        if (options.jacobian_update == IGM_JACOBIAN_EXACT)
+        {
+            norm_dq = igmStep (options, out, ref_angles, mu, q);
+        }
+        else
+        {
+            memcpy(dq, q, sizeof(dq));
+            norm_dq = igmStep (options, out, ref_angles, mu, q);
+            for (int i = 0; i < LOWER_JOINTS_NUM; ++i)
+            {
+                dq[i] = q[i] - dq[i];
+            }
+        }
+
+#ifdef IGM_TRACE_ENABLE
+        if (trace != NULL)
+        {
+            double trace_solve_end = igmTrace::getTime();
+            trace->record (
+                    num_float_iter + iter,
+                    norm_dq,
+                    Map< Matrix<double, IGM_NUM_CONSTRAINTS, 1> >(err).lpNorm<Eigen::Infinity>(),
+                    trace_solve_start - trace_kernel_start,
+                    trace_solve_end - trace_solve_start);
+        }
+#endif
+        exact_step = exact_jacobian;
+    }
+    iter += num_float_iter;
+
+#ifdef IGM_TRACE_ENABLE
+    if (trace != NULL)
+    {
+        trace->endCall (iter, iter <= max_iter, igmTrace::getTime() - trace_start);
+    }
+#endif
+
+    if (iter > max_iter)
+    {
+        iter = -1;
+    }
+
+    return(iter);
+}
@@ -0,0 +1,137 @@
+/**
+ * @file
+ * @brief Internal interface of the IGM solver shared by single and batch
+ * solving routines.
+ */
+
+
+#ifndef IGM_SOLVER_H
+#define IGM_SOLVER_H
+
+/****************************************
+ * INCLUDES
+ ****************************************/
+
+#include "nao_igm.h"
+
+
+/****************************************
+ * DEFINES
+ ****************************************/
+
+/*
+ * Constraints:
+ *  - 3 on the position of the swing foot
+ *  - 3 on the orientation of the swing foot
+ *  - 3 on the position of the CoM
+ *  - 1 to take into account coupled joint L_HIP_YAW_PITCH / R_HIP_YAW_PITCH
+ */
+#define IGM_NUM_CONSTRAINTS 10
+
+/// The number of consecutive iterations with increasing residuals, after
+/// which the solver is considered to be diverging, see igmSolveDeadline().
+#define IGM_MAX_RESIDUAL_INCREASES 3
+
+/// The size of output of from_LLeg_3() and from_RLeg_3().
+#define IGM_KERNEL_OUTPUT_SIZE (IGM_NUM_CONSTRAINTS*LOWER_JOINTS_NUM + IGM_NUM_CONSTRAINTS)
+
+
+
+/****************************************
+ * PROTOTYPES
+ ****************************************/
+
+template <typename t_Real>
+void igmSolveKKT (
+        const t_Real *,
+        const t_Real *,
+        const t_Real *,
+        t_Real *);
+
+template <typename t_Real>
+void igmSolveKKTReduced (
+        const t_Real *,
+        const t_Real *,
+        const t_Real *,
+        t_Real *);
+
+template <typename t_Real>
+t_Real igmStep (
+        const igmOptions &,
+        const t_Real *,
+        const t_Real *,
+        const t_Real,
+        t_Real *);
+
+double igmStepEigen (
+        const double *,
+        const double *,
+        const double,
+        double *);
+
+void igmEvaluate (
+        const igmSupportFoot,
+        const jointTrig &,
+        const double *,
+        const double *,
+        const double *,
+        double *);
+
+void igmResidual (
+        const igmSupportFoot,
+        const jointTrig &,
+        const double *,
+        const double *,
+        const double *,
+        double *);
+
+void igmBroydenUpdate (
+        const double *,
+        const double *,
+        double *);
+
+int igmSolve (
+        const igmOptions &,
+        const igmSupportFoot,
+        const double *,
+        const double *,
+        const double *,
+        const double *,
+        const double,
+        const double,
+        const int,
+        double *,
+        jointTrig &,
+        igmTrace * = NULL);
+
+int igmSolveFloat (
+        const igmOptions &,
+        const igmSupportFoot,
+        const double *,
+        const double *,
+        const double *,
+        const double *,
+        const double,
+        const double,
+        const int,
+        double *,
+        double &);
+
+igmStatus igmSolveDeadline (
+        const igmOptions &,
+        const igmSupportFoot,
+        const double *,
+        const double *,
+        const double *,
+        const double *,
+        const double,
+        const double,
+        const double,
+        igmTimeEstimate &,
+        igmTimeEstimate &,
+        double *,
+        jointTrig &,
+        int &,
+        double &);
+
+#endif // IGM_SOLVER_H
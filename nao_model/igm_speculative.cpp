@@ -0,0 +1,338 @@
+/**
+ * @file
+ * @brief Speculative solving of the IGM for the other support foot in a
+ * separate thread.
+ */
+
+
+#include "nao_igm.h"
+
+#include <pthread.h>
+
+#include "igm_solver.h"
+
+
+
+/**
+ * @brief Worker thread solving one problem per request, the data of the
+ * problem is owned by the requesting thread and must not be changed until
+ * the problem is solved.
+ */
+class igmSpeculation
+{
+    public:
+        int start ();
+        void stop ();
+
+        void post (
+                const igmOptions *,
+                const igmSupportFoot,
+                const double *,
+                const double *,
+                const double *,
+                const double *,
+                const double,
+                const double,
+                const int,
+                jointState *);
+        int wait ();
+
+
+    private:
+        static void *run (void *);
+
+
+        pthread_t thread;
+        pthread_mutex_t mutex;
+        /// Signals changes of pending and terminate.
+        pthread_cond_t cond;
+
+        /// A problem is posted, but not solved yet.
+        bool pending;
+        /// The thread must exit.
+        bool terminate;
+
+        const igmOptions *options;
+        igmSupportFoot support_foot;
+        const double *support_foot_posture;
+        const double *swing_foot_posture;
+        const double *CoM_position;
+        const double *ref_angles;
+        double mu;
+        double tol;
+        int max_iter;
+        jointState *state;
+
+        /// Result of igmSolve().
+        int iter;
+};
+
+
+
+/**
+ * @brief Start the thread.
+ *
+ * @return 0 on success, -1 on failure.
+ */
+int igmSpeculation::start()
+{
+    pending = false;
+    terminate = false;
+
+    if (pthread_mutex_init(&mutex, NULL) != 0)
+    {
+        return (-1);
+    }
+    if (pthread_cond_init(&cond, NULL) != 0)
+    {
+        pthread_mutex_destroy(&mutex);
+        return (-1);
+    }
+    if (pthread_create(&thread, NULL, run, this) != 0)
+    {
+        pthread_cond_destroy(&cond);
+        pthread_mutex_destroy(&mutex);
+        return (-1);
+    }
+    return (0);
+}
+
+
+
+/**
+ * @brief Stop the thread, the pending problem (if any) is solved first.
+ */
+void igmSpeculation::stop()
+{
+    pthread_mutex_lock(&mutex);
+    terminate = true;
+    pthread_cond_broadcast(&cond);
+    pthread_mutex_unlock(&mutex);
+
+    pthread_join(thread, NULL);
+    pthread_cond_destroy(&cond);
+    pthread_mutex_destroy(&mutex);
+}
+
+
+
+/**
+ * @brief Post a problem to the thread, the parameters are the same as the
+ * parameters of igmSolve().
+ */
+void igmSpeculation::post (
+        const igmOptions *options_,
+        const igmSupportFoot support_foot_,
+        const double *support_foot_posture_,
+        const double *swing_foot_posture_,
+        const double *CoM_position_,
+        const double *ref_angles_,
+        const double mu_,
+        const double tol_,
+        const int max_iter_,
+        jointState *state_)
+{
+    pthread_mutex_lock(&mutex);
+
+    options = options_;
+    support_foot = support_foot_;
+    support_foot_posture = support_foot_posture_;
+    swing_foot_posture = swing_foot_posture_;
+    CoM_position = CoM_position_;
+    ref_angles = ref_angles_;
+    mu = mu_;
+    tol = tol_;
+    max_iter = max_iter_;
+    state = state_;
+
+    pending = true;
+    pthread_cond_broadcast(&cond);
+    pthread_mutex_unlock(&mutex);
+}
+
+
+
+/**
+ * @brief Wait until the posted problem is solved.
+ *
+ * @return the same as igmSolve().
+ */
+int igmSpeculation::wait()
+{
+    pthread_mutex_lock(&mutex);
+    while (pending)
+    {
+        pthread_cond_wait(&cond, &mutex);
+    }
+    int result = iter;
+    pthread_mutex_unlock(&mutex);
+
+    return (result);
+}
+
+
+
+/**
+ * @brief Main loop of the thread.
+ *
+ * @param[in] arg igmSpeculation object.
+ *
+ * @return NULL
+ */
+void *igmSpeculation::run (void *arg)
+{
+    igmSpeculation *w = static_cast<igmSpeculation *>(arg);
+
+    pthread_mutex_lock(&w->mutex);
+    for (;;)
+    {
+        while (!w->pending && !w->terminate)
+        {
+            pthread_cond_wait(&w->cond, &w->mutex);
+        }
+        if (!w->pending)
+        {
+            break;
+        }
+        pthread_mutex_unlock(&w->mutex);
+
+        // the data is not changed by the requesting thread until wait()
+        int result = igmSolve (
+                *w->options,
+                w->support_foot,
+                w->support_foot_posture,
+                w->swing_foot_posture,
+                w->CoM_position,
+                w->ref_angles,
+                w->mu, w->tol, w->max_iter,
+                w->state->q, w->state->trig);
+
+        pthread_mutex_lock(&w->mutex);
+        w->iter = result;
+        w->pending = false;
+        pthread_cond_broadcast(&w->cond);
+    }
+    pthread_mutex_unlock(&w->mutex);
+
+    return (NULL);
+}
+
+
+
+/**
+ * @brief Start a thread, which is used by igmSpeculative() to solve the
+ * problem for the other support foot in parallel.
+ *
+ * @return 0 on success (or if the thread is already started), -1 if the
+ * thread cannot be started, igmSpeculative() solves both problems
+ * sequentially in this case.
+ */
+int nao_igm::startSpeculation()
+{
+    if (speculation != NULL)
+    {
+        return (0);
+    }
+
+    speculation = new igmSpeculation;
+    if (speculation->start() != 0)
+    {
+        delete speculation;
+        speculation = NULL;
+        return (-1);
+    }
+    return (0);
+}
+
+
+
+/**
+ * @brief Stop the thread started by startSpeculation().
+ */
+void nao_igm::stopSpeculation()
+{
+    if (speculation != NULL)
+    {
+        speculation->stop();
+        delete speculation;
+        speculation = NULL;
+    }
+}
+
+
+
+/**
+ * @brief Solves the Inverse Geometric Problem (IGM) for the current support
+ * foot as igm() does, and for the other support foot, which is intended
+ * for double support. The problem for the other support foot is solved in
+ * a separate thread if startSpeculation() was called, and in the calling
+ * thread otherwise, the results are the same.
+ *
+ * @param[in] ref_angles LOWER_JOINTS_NUM reference joint angles
+ * @param[in] mu penalty for difference between solution and reference angles
+ * @param[in] tol tolerance
+ * @param[in] max_iter maximal number of iterations
+ *
+ * @return the same as igm() for the current support foot.
+ *
+ * @note The solution for the other support foot is stored in
+ * state_speculative, which also provides the initial guess, the number of
+ * iterations is stored in speculative_iter. The solution is used by
+ * switchSupportFoot(), so that solving for the new support foot starts
+ * from a converged solution instead of state_sensor.
+ */
+int nao_igm::igmSpeculative(
+        const double *ref_angles,
+        const double mu,
+        const double tol,
+        const int max_iter)
+{
+    igmSupportFoot other_support_foot;
+    const double *other_support_foot_posture;
+    const double *other_swing_foot_posture;
+
+    if (support_foot == IGM_SUPPORT_LEFT)
+    {
+        other_support_foot = IGM_SUPPORT_RIGHT;
+        other_support_foot_posture = right_foot_posture.data();
+        other_swing_foot_posture = left_foot_posture.data();
+    }
+    else
+    {
+        other_support_foot = IGM_SUPPORT_LEFT;
+        other_support_foot_posture = left_foot_posture.data();
+        other_swing_foot_posture = right_foot_posture.data();
+    }
+
+
+    if (speculation != NULL)
+    {
+        speculation->post (
+                &options,
+                other_support_foot,
+                other_support_foot_posture,
+                other_swing_foot_posture,
+                CoM_position,
+                ref_angles, mu, tol, max_iter,
+                &state_speculative);
+
+        int iter = igm(ref_angles, mu, tol, max_iter);
+        speculative_iter = speculation->wait();
+
+        return (iter);
+    }
+    else
+    {
+        int iter = igm(ref_angles, mu, tol, max_iter);
+        speculative_iter = igmSolve (
+                options,
+                other_support_foot,
+                other_support_foot_posture,
+                other_swing_foot_posture,
+                CoM_position,
+                ref_angles, mu, tol, max_iter,
+                state_speculative.q, state_speculative.trig);
+
+        return (iter);
+    }
+}
@@ -0,0 +1,334 @@
+/**
+ * @file
+ * @brief Timeline of the solver and forward kinematics in Chrome trace
+ * format.
+ */
+
+
+#include "nao_igm.h"
+
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+
+
+/**
+ * @brief An event: complete if duration is not negative, instant otherwise.
+ */
+class igmTimelineEvent
+{
+    public:
+        const char *name;
+        /// Time in microseconds.
+        double time;
+        double duration;
+};
+
+
+/**
+ * @brief Single-producer / single-consumer ring buffer of events: the
+ * owner thread advances head, the writer advances tail.
+ */
+class igmTimelineBuffer
+{
+    public:
+        unsigned int head;
+        unsigned int tail;
+        /// Id of the owner thread.
+        int tid;
+        /// Nonzero when the buffer is initialized.
+        int active;
+
+        igmTimelineEvent events[IGM_TIMELINE_BUFFER_SIZE];
+};
+
+
+static igmTimelineBuffer igm_timeline_buffers[IGM_TIMELINE_MAX_THREADS];
+/// The number of claimed buffers, may exceed IGM_TIMELINE_MAX_THREADS.
+static unsigned int igm_timeline_num_buffers = 0;
+static unsigned int igm_timeline_dropped = 0;
+static int igm_timeline_enabled = 0;
+
+static __thread igmTimelineBuffer *igm_timeline_buffer = NULL;
+static __thread bool igm_timeline_registered = false;
+
+
+
+/**
+ * @brief Get the buffer of the calling thread, a free buffer is claimed on
+ * the first call.
+ *
+ * @return the buffer or NULL if all buffers are taken by other threads.
+ */
+static igmTimelineBuffer *igmTimelineGetBuffer()
+{
+    if (!igm_timeline_registered)
+    {
+        igm_timeline_registered = true;
+
+        unsigned int index = __atomic_fetch_add (&igm_timeline_num_buffers, 1, __ATOMIC_ACQ_REL);
+        if (index < IGM_TIMELINE_MAX_THREADS)
+        {
+            igmTimelineBuffer *buffer = &igm_timeline_buffers[index];
+            buffer->tid = syscall(SYS_gettid);
+            __atomic_store_n (&buffer->active, 1, __ATOMIC_RELEASE);
+            igm_timeline_buffer = buffer;
+        }
+    }
+    return (igm_timeline_buffer);
+}
+
+
+
+/**
+ * @brief Add an event to the buffer of the calling thread.
+ */
+static void igmTimelinePush (const char *name, const double time, const double duration)
+{
+    igmTimelineBuffer *buffer = igmTimelineGetBuffer();
+    if (buffer != NULL)
+    {
+        unsigned int head = buffer->head;
+        if (head - __atomic_load_n (&buffer->tail, __ATOMIC_ACQUIRE) < IGM_TIMELINE_BUFFER_SIZE)
+        {
+            igmTimelineEvent &event = buffer->events[head % IGM_TIMELINE_BUFFER_SIZE];
+            event.name = name;
+            event.time = time;
+            event.duration = duration;
+            __atomic_store_n (&buffer->head, head + 1, __ATOMIC_RELEASE);
+            return;
+        }
+    }
+    __atomic_add_fetch (&igm_timeline_dropped, 1, __ATOMIC_RELAXED);
+}
+
+
+
+/**
+ * @brief Enable or disable recording of events in all threads.
+ *
+ * @param[in] enabled true to enable.
+ */
+void igmTimeline::enable (const bool enabled)
+{
+    __atomic_store_n (&igm_timeline_enabled, enabled ? 1 : 0, __ATOMIC_RELAXED);
+}
+
+
+
+/**
+ * @brief Check if recording is enabled.
+ *
+ * @return true if enabled.
+ */
+bool igmTimeline::isEnabled ()
+{
+    return (__atomic_load_n (&igm_timeline_enabled, __ATOMIC_RELAXED) != 0);
+}
+
+
+
+/**
+ * @brief Record a complete event (if recording is enabled).
+ *
+ * @param[in] name name of the event, must not be freed.
+ * @param[in] start start time in microseconds (see getTime()).
+ * @param[in] duration duration in microseconds.
+ */
+void igmTimeline::complete (const char *name, const double start, const double duration)
+{
+    if (isEnabled())
+    {
+        igmTimelinePush (name, start, duration);
+    }
+}
+
+
+
+/**
+ * @brief Record an instant event (if recording is enabled).
+ *
+ * @param[in] name name of the event, must not be freed.
+ */
+void igmTimeline::instant (const char *name)
+{
+    if (isEnabled())
+    {
+        igmTimelinePush (name, getTime(), -1.0);
+    }
+}
+
+
+
+/**
+ * @brief Time used in the events.
+ *
+ * @return CLOCK_MONOTONIC in microseconds.
+ */
+double igmTimeline::getTime ()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (t.tv_sec * 1e6 + t.tv_nsec * 1e-3);
+}
+
+
+
+/**
+ * @brief Get the number of events dropped because the buffers were full
+ * or there were too many threads.
+ *
+ * @return the number of dropped events.
+ */
+unsigned int igmTimeline::getDropped ()
+{
+    return (__atomic_load_n (&igm_timeline_dropped, __ATOMIC_RELAXED));
+}
+
+
+
+/**
+ * @brief Constructor, the start time is taken if recording is enabled.
+ *
+ * @param[in] name_ name of the event, must not be freed.
+ */
+igmTimelineScope::igmTimelineScope(const char *name_)
+{
+    name = name_;
+    start = igmTimeline::isEnabled() ? igmTimeline::getTime() : -1.0;
+}
+
+
+
+/**
+ * @brief Destructor, records the event.
+ */
+igmTimelineScope::~igmTimelineScope()
+{
+    if (start >= 0.0)
+    {
+        igmTimelinePush (name, start, igmTimeline::getTime() - start);
+    }
+}
+
+
+
+/**
+ * @brief Constructor, no file is opened.
+ */
+igmTimelineWriter::igmTimelineWriter()
+{
+    file = NULL;
+    num_events = 0;
+}
+
+
+
+/**
+ * @brief Destructor, closes the file.
+ */
+igmTimelineWriter::~igmTimelineWriter()
+{
+    close();
+}
+
+
+
+/**
+ * @brief Open a file for writing.
+ *
+ * @param[in] filename name of the file.
+ *
+ * @return 0 on success, -1 if the file cannot be opened.
+ */
+int igmTimelineWriter::open (const char *filename)
+{
+    close();
+
+    file = fopen(filename, "w");
+    if (file == NULL)
+    {
+        return (-1);
+    }
+    num_events = 0;
+    fprintf(file, "[");
+
+    return (0);
+}
+
+
+
+/**
+ * @brief Move the recorded events of all threads to the file.
+ *
+ * @return the number of written events, -1 if the file is not opened.
+ */
+int igmTimelineWriter::flush ()
+{
+    if (file == NULL)
+    {
+        return (-1);
+    }
+
+    const int pid = getpid();
+    int num_written = 0;
+
+    unsigned int num_buffers = __atomic_load_n (&igm_timeline_num_buffers, __ATOMIC_ACQUIRE);
+    if (num_buffers > IGM_TIMELINE_MAX_THREADS)
+    {
+        num_buffers = IGM_TIMELINE_MAX_THREADS;
+    }
+
+    for (unsigned int i = 0; i < num_buffers; ++i)
+    {
+        igmTimelineBuffer &buffer = igm_timeline_buffers[i];
+        if (__atomic_load_n (&buffer.active, __ATOMIC_ACQUIRE) == 0)
+        {
+            continue;
+        }
+
+        unsigned int tail = buffer.tail;
+        unsigned int head = __atomic_load_n (&buffer.head, __ATOMIC_ACQUIRE);
+        for (; tail != head; ++tail)
+        {
+            const igmTimelineEvent &event = buffer.events[tail % IGM_TIMELINE_BUFFER_SIZE];
+
+            fprintf(file, "%s\n", (num_events == 0) ? "" : ",");
+            if (event.duration >= 0.0)
+            {
+                fprintf(file,
+                        "{\"name\": \"%s\", \"cat\": \"igm\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": %d, \"tid\": %d}",
+                        event.name, event.time, event.duration, pid, buffer.tid);
+            }
+            else
+            {
+                fprintf(file,
+                        "{\"name\": \"%s\", \"cat\": \"igm\", \"ph\": \"i\", \"s\": \"t\", \"ts\": %.3f, \"pid\": %d, \"tid\": %d}",
+                        event.name, event.time, pid, buffer.tid);
+            }
+            ++num_events;
+            ++num_written;
+        }
+        __atomic_store_n (&buffer.tail, tail, __ATOMIC_RELEASE);
+    }
+    fflush(file);
+
+    return (num_written);
+}
+
+
+
+/**
+ * @brief Flush the events and close the file.
+ */
+void igmTimelineWriter::close ()
+{
+    if (file != NULL)
+    {
+        flush();
+        fprintf(file, "\n]\n");
+        fclose(file);
+        file = NULL;
+    }
+}
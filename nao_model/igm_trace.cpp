@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @brief Instrumentation of the solver.
+ */
+
+
+#include "nao_igm.h"
+
+#include <string.h>
+#include <time.h>
+
+
+
+/**
+ * @brief Constructor, the trace is empty.
+ */
+igmTrace::igmTrace()
+{
+    reset();
+}
+
+
+
+/**
+ * @brief Clear the counters and the records.
+ */
+void igmTrace::reset()
+{
+    memset(&data, 0, sizeof(data));
+    next = 0;
+}
+
+
+
+/**
+ * @brief Record an iteration of the current call, the oldest record is
+ * overwritten if the buffer is full.
+ *
+ * @param[in] iter index of the iteration.
+ * @param[in] norm_dq infinity norm of the change of joint angles.
+ * @param[in] norm_err infinity norm of the residuals before the step.
+ * @param[in] kernel_time time of evaluation of the generated function.
+ * @param[in] solve_time time of solving the KKT system.
+ */
+void igmTrace::record (
+        const int iter,
+        const double norm_dq,
+        const double norm_err,
+        const double kernel_time,
+        const double solve_time)
+{
+    igmTraceRecord &r = data.records[next];
+
+    r.call = data.calls;
+    r.iter = iter;
+    r.norm_dq = norm_dq;
+    r.norm_err = norm_err;
+    r.kernel_time = kernel_time;
+    r.solve_time = solve_time;
+
+    next = (next + 1) % IGM_TRACE_SIZE;
+    if (data.num_records < IGM_TRACE_SIZE)
+    {
+        ++data.num_records;
+    }
+}
+
+
+
+/**
+ * @brief Finish the current call of the solver.
+ *
+ * @param[in] num_iter the number of performed iterations.
+ * @param[in] converged false if the solver did not converge.
+ * @param[in] time duration of the call.
+ */
+void igmTrace::endCall (const int num_iter, const bool converged, const double time)
+{
+    data.iterations += num_iter;
+    if (!converged)
+    {
+        ++data.failures;
+    }
+
+    data.total_time += time;
+    if (time > data.max_time)
+    {
+        data.max_time = time;
+    }
+
+    ++data.calls;
+}
+
+
+
+/**
+ * @brief Copy the counters and the records (the oldest first).
+ *
+ * @param[out] snapshot snapshot of the trace.
+ */
+void igmTrace::getSnapshot (igmTraceSnapshot &snapshot) const
+{
+    snapshot = data;
+
+    int first = (next - data.num_records + IGM_TRACE_SIZE) % IGM_TRACE_SIZE;
+    for (int i = 0; i < data.num_records; ++i)
+    {
+        snapshot.records[i] = data.records[(first + i) % IGM_TRACE_SIZE];
+    }
+}
+
+
+
+/**
+ * @brief Monotonic time used by the hooks.
+ *
+ * @return time in seconds.
+ */
+double igmTrace::getTime()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (t.tv_sec + 1e-9 * t.tv_nsec);
+}
@@ -4,12 +4,87 @@
  */
 
 
+#include <math.h>
+#include <limits>
+
 #include "nao_igm.h"
 #include "maple_functions.h"
 
 
-double jointState::q_lower_bound[JOINTS_NUM];
-double jointState::q_upper_bound[JOINTS_NUM];
+/*
+ * Bounds of joint angles, the order corresponds to jointSensorIDs.
+ */
+const double jointState::q_lower_bound[JOINTS_NUM] = {
+    // LEFT LEG
+    -1.145303,  // L_HIP_YAW_PITCH
+    -0.379472,  // L_HIP_ROLL
+    -1.773912,  // L_HIP_PITCH
+    -0.092346,  // L_KNEE_PITCH
+    -1.189516,  // L_ANKLE_PITCH
+    -0.769001,  // L_ANKLE_ROLL
+
+    // RIGHT LEG
+    -1.145303,  // R_HIP_YAW_PITCH
+    -0.738321,  // R_HIP_ROLL
+    -1.772308,  // R_HIP_PITCH
+    -0.103083,  // R_KNEE_PITCH
+    -1.186448,  // R_ANKLE_PITCH
+    -0.388676,  // R_ANKLE_ROLL
+
+    // LEFT ARM
+    -2.085600,  // L_SHOULDER_PITCH
+     0.008700,  // L_SHOULDER_ROLL
+    -2.085600,  // L_ELBOW_YAW
+    -1.562100,  // L_ELBOW_ROLL
+    -1.823800,  // L_WRIST_YAW
+
+    // RIGHT ARM
+    -2.085600,  // R_SHOULDER_PITCH
+    -1.649400,  // R_SHOULDER_ROLL
+    -2.085600,  // R_ELBOW_YAW
+     0.008700,  // R_ELBOW_ROLL
+    -1.823800,  // R_WRIST_YAW
+
+    // HEAD
+    -2.085700,  // HEAD_PITCH
+    -0.672000   // HEAD_YAW
+};
+
+const double jointState::q_upper_bound[JOINTS_NUM] = {
+    // LEFT LEG
+     0.740810,  // L_HIP_YAW_PITCH
+     0.790477,  // L_HIP_ROLL
+     0.484090,  // L_HIP_PITCH
+     2.112528,  // L_KNEE_PITCH
+     0.922747,  // L_ANKLE_PITCH
+     0.397880,  // L_ANKLE_ROLL
+
+    // RIGHT LEG
+     0.740810,  // R_HIP_YAW_PITCH
+     0.414754,  // R_HIP_ROLL
+     0.485624,  // R_HIP_PITCH
+     2.120198,  // R_KNEE_PITCH
+     0.932056,  // R_ANKLE_PITCH
+     0.785875,  // R_ANKLE_ROLL
+
+    // LEFT ARM
+     2.085600,  // L_SHOULDER_PITCH
+     1.649400,  // L_SHOULDER_ROLL
+     2.085600,  // L_ELBOW_YAW
+    -0.008700,  // L_ELBOW_ROLL
+     1.823800,  // L_WRIST_YAW
+
+    // RIGHT ARM
+     2.085600,  // R_SHOULDER_PITCH
+    -0.008700,  // R_SHOULDER_ROLL
+     2.085600,  // R_ELBOW_YAW
+     1.562100,  // R_ELBOW_ROLL
+     1.823800,  // R_WRIST_YAW
+
+    // HEAD
+     2.085700,  // HEAD_PITCH
+     0.514900   // HEAD_YAW
+};
 
 
 
@@ -19,7 +94,6 @@ double jointState::q_upper_bound[JOINTS_NUM];
 jointState::jointState()
 {
     initJointAngles();
-    initBounds();
 }
 
 
@@ -32,7 +106,7 @@ jointState::jointState()
  *
  * @attention No collision checks!
  */
-int jointState::checkJointBounds()
+int jointState::checkJointBounds() const
 {
     for (int i = 0; i < JOINTS_NUM; i++)
     {
@@ -89,56 +163,91 @@ void jointState::initJointAngles()
 
 
 /**
- * @brief Initialize bounds.
+ * @brief Constructor, sine and cosine are not computed.
  */
-void jointState::initBounds()
+jointTrig::jointTrig()
 {
-    // LEFT LEG
-    setBounds(L_HIP_YAW_PITCH , -1.145303,  0.740810);
-    setBounds(L_HIP_ROLL      , -0.379472,  0.790477);
-    setBounds(L_HIP_PITCH     , -1.773912,  0.484090);
-    setBounds(L_KNEE_PITCH    , -0.092346,  2.112528);
-    setBounds(L_ANKLE_PITCH   , -1.189516,  0.922747);
-    setBounds(L_ANKLE_ROLL    , -0.769001,  0.397880);
-                              
-    // RIGHT LEG
-    setBounds(R_HIP_YAW_PITCH , -1.145303,  0.740810);
-    setBounds(R_HIP_ROLL      , -0.738321,  0.414754);
-    setBounds(R_HIP_PITCH     , -1.772308,  0.485624);
-    setBounds(R_KNEE_PITCH    , -0.103083,  2.120198);
-    setBounds(R_ANKLE_PITCH   , -1.186448,  0.932056);
-    setBounds(R_ANKLE_ROLL    , -0.388676,  0.785875);
-                              
-    // LEFT ARM
-    setBounds(L_SHOULDER_PITCH, -2.085600,  2.085600);
-    setBounds(L_SHOULDER_ROLL ,  0.008700,  1.649400);
-    setBounds(L_ELBOW_YAW     , -2.085600,  2.085600);
-    setBounds(L_ELBOW_ROLL    , -1.562100, -0.008700);
-    setBounds(L_WRIST_YAW     , -1.823800,  1.823800);
-                              
-    // RIGHT ARM
-    setBounds(R_SHOULDER_PITCH, -2.085600,  2.085600);
-    setBounds(R_SHOULDER_ROLL , -1.649400, -0.008700);
-    setBounds(R_ELBOW_YAW     , -2.085600,  2.085600);
-    setBounds(R_ELBOW_ROLL    ,  0.008700,  1.562100);
-    setBounds(R_WRIST_YAW     , -1.823800,  1.823800);
-                              
-    // HEAD                   
-    setBounds(HEAD_PITCH      , -2.085700,  2.085700);
-    setBounds(HEAD_YAW        , -0.672000,  0.514900);
+    for (int i = 0; i < JOINTS_NUM; i++)
+    {
+        q[i] = std::numeric_limits<double>::quiet_NaN();
+        num_increments[i] = 0;
+    }
 }
 
 
 
 /**
- * @brief Set bounds for a joint.
+ * @brief Update sine and cosine of joint angles.
+ *
+ * @param[in] q_new JOINTS_NUM joint angles.
  *
- * @param[in] id id of the joint.
- * @param[in] lower_bound lower bound.
- * @param[in] upper_bound upper_bound.
+ * @note Only the values corresponding to changed angles or updated
+ * incrementally are recomputed.
  */
-void jointState::setBounds (const jointSensorIDs id, const double lower_bound, const double upper_bound)
+void jointTrig::update (const double *q_new)
 {
-    q_lower_bound[id] = lower_bound;
-    q_upper_bound[id] = upper_bound;
+    for (int i = 0; i < JOINTS_NUM; i++)
+    {
+        if ((q[i] != q_new[i]) || (num_increments[i] > 0))
+        {
+            sincos(q_new[i], &sin_q[i], &cos_q[i]);
+            q[i] = q_new[i];
+            num_increments[i] = 0;
+        }
+    }
+}
+
+
+
+/**
+ * @brief Update sine and cosine of joint angles using angle-addition
+ * formulas:
+ *  sin(q + d) = sin(q)*cos(d) + cos(q)*sin(d)
+ *  cos(q + d) = cos(q)*cos(d) - sin(q)*sin(d)
+ * where sin(d) and cos(d) are approximated by Taylor polynomials.
+ *
+ * @param[in] q_new JOINTS_NUM joint angles.
+ * @param[in] refresh_period the number of incremental updates of a joint,
+ * after which its sine and cosine are computed from scratch.
+ *
+ * @note Sine and cosine are computed from scratch if the change of angle
+ * exceeds IGM_TRIG_INCREMENT_MAX, the error of polynomials is below 3e-15
+ * in this range. After each incremental update the values are normalized
+ * so that sin^2 + cos^2 = 1 holds up to the second order terms.
+ */
+void jointTrig::updateIncremental (const double *q_new, const int refresh_period)
+{
+    for (int i = 0; i < JOINTS_NUM; i++)
+    {
+        if (q[i] == q_new[i])
+        {
+            continue;
+        }
+
+        double d = q_new[i] - q[i];
+
+        if (!(fabs(d) <= IGM_TRIG_INCREMENT_MAX) // also true if q[i] is NaN
+                || (num_increments[i] >= refresh_period))
+        {
+            sincos(q_new[i], &sin_q[i], &cos_q[i]);
+            num_increments[i] = 0;
+        }
+        else
+        {
+            double d2 = d*d;
+            double sin_d = d + d*d2*(-1.0/6.0 + d2*(1.0/120.0 - d2*(1.0/5040.0)));
+            double cos_d = 1.0 + d2*(-0.5 + d2*(1.0/24.0 + d2*(-1.0/720.0 + d2*(1.0/40320.0))));
+
+            double s = sin_q[i]*cos_d + cos_q[i]*sin_d;
+            double c = cos_q[i]*cos_d - sin_q[i]*sin_d;
+
+            // 1/sqrt(x) = 1 - (x-1)/2 + O((x-1)^2)
+            double k = 1.5 - 0.5*(s*s + c*c);
+            sin_q[i] = k*s;
+            cos_q[i] = k*c;
+
+            ++num_increments[i];
+        }
+        q[i] = q_new[i];
+    }
 }
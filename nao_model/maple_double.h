@@ -0,0 +1,25 @@
+/**
+ * @file
+ * @brief Instantiation of the bodies of generated functions for double
+ * precision scalars.
+ *
+ * The bodies of generated functions (*_body.h) are parametrized with the
+ * following macros:
+ *  - IGM_REAL          type of intermediate variables;
+ *  - IGM_CONST(x)      conversion of a numerical constant to IGM_REAL;
+ *  - IGM_SIN_Q(i)      sine of the i-th joint angle in q;
+ *  - IGM_COS_Q(i)      cosine of the i-th joint angle in q.
+ *
+ * The bodies use the names of the arguments of the original functions.
+ */
+
+
+#ifndef MAPLE_DOUBLE_H
+#define MAPLE_DOUBLE_H
+
+#define IGM_REAL        double
+#define IGM_CONST(x)    (x)
+#define IGM_SIN_Q(i)    sin(q[i])
+#define IGM_COS_Q(i)    cos(q[i])
+
+#endif // MAPLE_DOUBLE_H
@@ -0,0 +1,22 @@
+/**
+ * @file
+ * @brief Instantiation of the bodies of generated functions for single
+ * precision scalars with precomputed sine and cosine of joint angles, see
+ * maple_double.h and maple_trig.h.
+ *
+ * The instantiating function must have 'sin_q' and 'cos_q' arguments. The
+ * numerical constants in the bodies are not wrapped in IGM_CONST(), hence
+ * the file must be compiled with -fsingle-precision-constant, otherwise the
+ * computations are performed in double precision.
+ */
+
+
+#ifndef MAPLE_FLOAT_H
+#define MAPLE_FLOAT_H
+
+#define IGM_REAL        float
+#define IGM_CONST(x)    ((float) (x))
+#define IGM_SIN_Q(i)    sin_q[i]
+#define IGM_COS_Q(i)    cos_q[i]
+
+#endif // MAPLE_FLOAT_H
@@ -18,10 +18,36 @@ extern "C" {
     void LLeg2CoM(double *q,double *LL,double *A);
     void RLeg2LLeg(double *q,double *RL,double *T);
     void RLeg2CoM(double *q,double *RL,double *A);
+    void LLeg2RLegCoM(double *q,double *LL,double *T,double *A);
+    void RLeg2LLegCoM(double *q,double *RL,double *T,double *A);
 
 
     void from_LLeg_3(double *q,double *LL,double *RL,double *CoM,double *A);
     void from_RLeg_3(double *q,double *RL,double *LL,double *CoM,double *A);
+
+    void from_LLeg_3_residual(const double *q,const double *LL,const double *RL,const double *CoM,double *A);
+    void from_RLeg_3_residual(const double *q,const double *RL,const double *LL,const double *CoM,double *A);
+
+
+    void LLeg2RLeg_trig(const double *sin_q,const double *cos_q,const double *LL,double *T);
+    void LLeg2CoM_trig(const double *sin_q,const double *cos_q,const double *LL,double *A);
+    void RLeg2LLeg_trig(const double *sin_q,const double *cos_q,const double *RL,double *T);
+    void RLeg2CoM_trig(const double *sin_q,const double *cos_q,const double *RL,double *A);
+    void LLeg2RLegCoM_trig(const double *sin_q,const double *cos_q,const double *LL,double *T,double *A);
+    void RLeg2LLegCoM_trig(const double *sin_q,const double *cos_q,const double *RL,double *T,double *A);
+
+    void from_LLeg_3_trig(const double *sin_q,const double *cos_q,const double *LL,const double *RL,const double *CoM,double *A);
+    void from_RLeg_3_trig(const double *sin_q,const double *cos_q,const double *RL,const double *LL,const double *CoM,double *A);
+    void from_LLeg_3_residual_trig(const double *sin_q,const double *cos_q,const double *LL,const double *RL,const double *CoM,double *A);
+    void from_RLeg_3_residual_trig(const double *sin_q,const double *cos_q,const double *RL,const double *LL,const double *CoM,double *A);
+
+    void from_LLeg_3_float(const float *sin_q,const float *cos_q,const float *LL,const float *RL,const float *CoM,float *A);
+    void from_RLeg_3_float(const float *sin_q,const float *cos_q,const float *RL,const float *LL,const float *CoM,float *A);
+
+
+    int igmSIMDWidth();
+    void from_LLeg_3_multi(const int num,const double *q,const double *LL,const double *RL,const double *CoM,double *A);
+    void from_RLeg_3_multi(const int num,const double *q,const double *RL,const double *LL,const double *CoM,double *A);
 }
 
 #endif //MAPLE_FUNCTIONS_H
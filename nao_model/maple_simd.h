@@ -0,0 +1,125 @@
+/**
+ * @file
+ * @brief Instantiation of the bodies of generated functions for vectors of
+ * IGM_SIMD_WIDTH double precision numbers, see maple_double.h.
+ *
+ * IGM_SIMD_WIDTH must be defined before inclusion of this file. The vector
+ * types are based on GCC vector extensions, the instruction set is selected
+ * by compiler flags of the including translation unit.
+ */
+
+
+#ifndef MAPLE_SIMD_H
+#define MAPLE_SIMD_H
+
+/****************************************
+ * TYPEDEFS
+ ****************************************/
+
+typedef double igm_vreal __attribute__ ((vector_size (IGM_SIMD_WIDTH*sizeof(double))));
+typedef unsigned long long igm_vint __attribute__ ((vector_size (IGM_SIMD_WIDTH*sizeof(unsigned long long))));
+
+
+/****************************************
+ * DEFINES
+ ****************************************/
+
+/*
+ * Sine and cosine of the joint angles are computed in advance, the arrays
+ * must be declared in the instantiating function.
+ */
+#define IGM_REAL        igm_vreal
+#define IGM_CONST(x)    igm_vsplat(x)
+#define IGM_SIN_Q(i)    sin_q[i]
+#define IGM_COS_Q(i)    cos_q[i]
+
+
+
+/****************************************
+ * FUNCTIONS
+ ****************************************/
+
+/**
+ * @brief Broadcast a scalar to all elements of a vector.
+ *
+ * @param[in] x scalar.
+ *
+ * @return vector.
+ */
+static inline igm_vreal igm_vsplat (const double x)
+{
+    igm_vreal v = {0.0};
+    return (v + x);
+}
+
+
+
+/**
+ * @brief Compute sine and cosine of all elements of a vector.
+ *
+ * @param[in] x angles.
+ * @param[out] sin_x sines.
+ * @param[out] cos_x cosines.
+ *
+ * @note The argument is reduced to [-pi/4, pi/4] using a three-part
+ * representation of pi/2, then the polynomial approximations of fdlibm
+ * (__kernel_sin and __kernel_cos) are used. The error is within 1 ulp for the
+ * range of joint angles.
+ */
+static inline void igm_vsincos (const igm_vreal x, igm_vreal *sin_x, igm_vreal *cos_x)
+{
+    // 1.5*2^52: the sum is rounded to an integer, which is stored in the low
+    // bits of the mantissa.
+    const double round_magic = 6755399441055744.0;
+
+    const double two_over_pi = 6.36619772367581382433e-01;
+    const double pio2_1  = 1.57079632673412561417e+00;
+    const double pio2_2  = 6.07710050630396597660e-11;
+    const double pio2_2t = 2.02226624879595063154e-21;
+
+    const double S1 = -1.66666666666666324348e-01;
+    const double S2 =  8.33333333332248946124e-03;
+    const double S3 = -1.98412698298579493134e-04;
+    const double S4 =  2.75573137070700676789e-06;
+    const double S5 = -2.50507602534068634195e-08;
+    const double S6 =  1.58969099521155010221e-10;
+
+    const double C1 =  4.16666666666666019037e-02;
+    const double C2 = -1.38888888888741095749e-03;
+    const double C3 =  2.48015872894767294178e-05;
+    const double C4 = -2.75573143513906633035e-07;
+    const double C5 =  2.08757232129817482790e-09;
+    const double C6 = -1.13596475577881948265e-11;
+
+
+    // argument reduction
+    igm_vreal n = x*two_over_pi + round_magic;
+    igm_vint quadrant = (igm_vint) n & 3;
+    n = n - round_magic;
+
+    igm_vreal r = ((x - n*pio2_1) - n*pio2_2) - n*pio2_2t;
+    igm_vreal z = r*r;
+
+
+    // polynomial approximations
+    igm_vreal s = r + r*z*(S1 + z*(S2 + z*(S3 + z*(S4 + z*(S5 + z*S6)))));
+
+    igm_vreal hz = 0.5*z;
+    igm_vreal w = 1.0 - hz;
+    igm_vreal c = w + (((1.0 - w) - hz) + z*z*(C1 + z*(C2 + z*(C3 + z*(C4 + z*(C5 + z*C6))))));
+
+
+    // sin(x) = { s,  c, -s, -c}[quadrant]
+    // cos(x) = { c, -s, -c,  s}[quadrant]
+    igm_vint swap = -(quadrant & 1);
+    igm_vint sin_sign = (quadrant & 2) << 62;
+    igm_vint cos_sign = ((quadrant + 1) & 2) << 62;
+
+    igm_vint s_bits = (igm_vint) s;
+    igm_vint c_bits = (igm_vint) c;
+
+    *sin_x = (igm_vreal) (((c_bits & swap) | (s_bits & ~swap)) ^ sin_sign);
+    *cos_x = (igm_vreal) (((s_bits & swap) | (c_bits & ~swap)) ^ cos_sign);
+}
+
+#endif // MAPLE_SIMD_H
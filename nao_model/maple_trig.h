@@ -0,0 +1,19 @@
+/**
+ * @file
+ * @brief Instantiation of the bodies of generated functions for double
+ * precision scalars with precomputed sine and cosine of joint angles, see
+ * maple_double.h and jointTrig.
+ *
+ * The instantiating function must have 'sin_q' and 'cos_q' arguments.
+ */
+
+
+#ifndef MAPLE_TRIG_H
+#define MAPLE_TRIG_H
+
+#define IGM_REAL        double
+#define IGM_CONST(x)    (x)
+#define IGM_SIN_Q(i)    sin_q[i]
+#define IGM_COS_Q(i)    cos_q[i]
+
+#endif // MAPLE_TRIG_H
@@ -0,0 +1,68 @@
+/**
+ * @file
+ * @brief Wait-free exchange of joint angles between two threads.
+ */
+
+
+#include "nao_igm.h"
+
+#include <string.h>
+
+
+/// Flag of jointStateMailbox::middle: the buffer contains a snapshot,
+/// which has not been read.
+#define IGM_MAILBOX_FRESH 4
+/// Mask of the buffer index in jointStateMailbox::middle.
+#define IGM_MAILBOX_INDEX 3
+
+
+
+/**
+ * @brief Constructor, the mailbox is empty.
+ */
+jointStateMailbox::jointStateMailbox()
+{
+    back = 0;
+    middle = 1;
+    front = 2;
+}
+
+
+
+/**
+ * @brief Publish a snapshot, must be called by one thread only.
+ *
+ * @param[in] q JOINTS_NUM joint angles.
+ */
+void jointStateMailbox::write (const double *q)
+{
+    memcpy(buffer[back], q, JOINTS_NUM * sizeof(double));
+
+    // release: the snapshot is visible before the index
+    back = __atomic_exchange_n (&middle, back | IGM_MAILBOX_FRESH, __ATOMIC_ACQ_REL)
+        & IGM_MAILBOX_INDEX;
+}
+
+
+
+/**
+ * @brief Get the latest snapshot, must be called by one thread only.
+ *
+ * @param[out] state the joint angles are updated if a new snapshot is
+ * available.
+ *
+ * @return true if a new snapshot is available, false otherwise.
+ */
+bool jointStateMailbox::read (jointState &state)
+{
+    if ((__atomic_load_n (&middle, __ATOMIC_RELAXED) & IGM_MAILBOX_FRESH) == 0)
+    {
+        return (false);
+    }
+
+    // acquire: the snapshot is visible after the index
+    front = __atomic_exchange_n (&middle, front, __ATOMIC_ACQ_REL) & IGM_MAILBOX_INDEX;
+    memcpy(state.q, buffer[front], JOINTS_NUM * sizeof(double));
+
+    return (true);
+}
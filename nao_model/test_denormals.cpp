@@ -0,0 +1,173 @@
+// test_denormals.cpp
+//
+// Provoke denormal numbers in the solver and in forward kinematics by
+// replacing zero joint angles and zero elements of the postures of the feet
+// with denormal numbers, measure the time with and without
+// igmOptions::flush_denormals and check that the mode of the floating point
+// unit of the caller is restored.
+//
+// The static initial configuration is used rather than the standard gait
+// (igmGait): along the gait the joint angles and the postures are
+// generically nonzero, so there is nothing to replace with denormals.
+
+#include <iostream>
+#include <stdio.h>
+#include <math.h>
+
+#include <sys/time.h>
+#include <time.h>
+
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#endif
+
+#include "nao_igm.h"
+
+using namespace std;
+
+
+#define NUM_CASES 4
+#define DENORMAL 1e-310
+
+
+double getTime(struct timeval &start, struct timeval &end)
+{
+    return (end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec));
+}
+
+
+unsigned int getMode()
+{
+#if defined(__SSE2__)
+    return (_mm_getcsr() & 0x8040);
+#else
+    return (0);
+#endif
+}
+
+
+int main(int argc, char** argv)
+{
+    nao_igm nao;
+    struct timeval start, end;
+    const int test_N = 1000;
+    int result = 0;
+
+
+    jointState q0;
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+    q0 = nao.state_model;
+
+    nao.getSwingFootPosture (nao.state_sensor, nao.left_foot_posture.data());
+    Transform<double,3> left_foot_posture = nao.left_foot_posture;
+    Transform<double,3> right_foot_posture = nao.right_foot_posture;
+
+    nao.getCoM (nao.state_sensor, nao.CoM_position);
+    nao.CoM_position[0] += 0.03;
+    nao.CoM_position[1] += 0.02;
+    nao.CoM_position[2] -= 0.01;
+
+
+    const char *names[NUM_CASES] = {"normal", "denormal angles", "denormal postures", "both"};
+    const unsigned int mode = getMode();
+
+    for (int c = 0; c < NUM_CASES; ++c)
+    {
+        jointState state = q0;
+        nao.left_foot_posture = left_foot_posture;
+        nao.right_foot_posture = right_foot_posture;
+
+        if (c & 1)
+        {
+            for (int i = 0; i < JOINTS_NUM; ++i)
+            {
+                if (state.q[i] == 0.0)
+                {
+                    state.q[i] = DENORMAL;
+                }
+            }
+        }
+        if (c & 2)
+        {
+            // the last row of homogeneous matrices is not used
+            for (int i = 0; i < 16; ++i)
+            {
+                if ((i % 4 != 3) && (nao.left_foot_posture.data()[i] == 0.0))
+                {
+                    nao.left_foot_posture.data()[i] = DENORMAL;
+                }
+                if ((i % 4 != 3) && (nao.right_foot_posture.data()[i] == 0.0))
+                {
+                    nao.right_foot_posture.data()[i] = DENORMAL;
+                }
+            }
+        }
+
+        double q[2][LOWER_JOINTS_NUM];
+        double time_igm[2], time_fk[2];
+        int iter[2];
+
+        printf("%s\n", names[c]);
+        for (int flush = 0; flush < 2; ++flush)
+        {
+            nao.options.flush_denormals = (flush == 1);
+
+            gettimeofday(&start,0);
+            for (int i = 0; i < test_N; ++i)
+            {
+                nao.state_model = state;
+                iter[flush] = nao.igm(state.q, 1.2, 0.0015, 20);
+            }
+            gettimeofday(&end,0);
+            time_igm[flush] = getTime(start, end)/test_N;
+
+            for (int i = 0; i < LOWER_JOINTS_NUM; ++i)
+            {
+                q[flush][i] = nao.state_model.q[i];
+            }
+
+
+            const igmModel &model = nao;
+            double CoM[POSITION_VECTOR_SIZE];
+            double swing_foot_posture[16];
+
+            gettimeofday(&start,0);
+            for (int i = 0; i < test_N; ++i)
+            {
+                model.getCoM(state, CoM);
+                model.getSwingFootPosture(state, swing_foot_posture);
+            }
+            gettimeofday(&end,0);
+            time_fk[flush] = getTime(start, end)/test_N;
+
+            printf(" flush = %d: time (igm) = %e, time (getCoM + getSwingFootPosture) = %e, iter = %d\n",
+                    flush, time_igm[flush], time_fk[flush], iter[flush]);
+        }
+
+        double diff = 0.0;
+        for (int i = 0; i < LOWER_JOINTS_NUM; ++i)
+        {
+            diff = max(diff, fabs(q[0][i] - q[1][i]));
+        }
+        printf(" max difference of solutions = %e, slowdown without flushing: igm = %.1f, fk = %.1f\n",
+                diff, time_igm[0] / time_igm[1], time_fk[0] / time_fk[1]);
+
+        if ((iter[0] != iter[1]) || (diff > 1e-12))
+        {
+            cout << "Flushing of denormals changes the solution!" << endl;
+            result = 1;
+        }
+    }
+
+
+    if (getMode() != mode)
+    {
+        cout << "The mode of the floating point unit is not restored!" << endl;
+        result = 1;
+    }
+
+    return (result);
+}
@@ -0,0 +1,138 @@
+// test_fk_cache.cpp
+//
+// Check that the cached results of nao_igm::getCoM() and
+// nao_igm::getSwingFootPosture() are reused only until the joint angles or
+// the support foot change, and measure the time of repeated queries.
+
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+
+#include <sys/time.h>
+#include <time.h>
+
+#include "nao_igm.h"
+
+using namespace std;
+
+
+double getTime(struct timeval &start, struct timeval &end)
+{
+    return (end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec));
+}
+
+
+/**
+ * Compare the cached results with the results computed from scratch.
+ */
+int compare (nao_igm &nao, jointState &state, const char *name)
+{
+    const igmModel &model = nao;
+    double CoM[POSITION_VECTOR_SIZE], CoM_ref[POSITION_VECTOR_SIZE];
+    double swing_foot[16], swing_foot_ref[16];
+
+    nao.getCoM(state, CoM);
+    nao.getSwingFootPosture(state, swing_foot);
+    model.getCoM(state, CoM_ref);
+    model.getSwingFootPosture(state, swing_foot_ref);
+
+    if ((memcmp(CoM, CoM_ref, sizeof(CoM)) != 0)
+            || (memcmp(swing_foot, swing_foot_ref, sizeof(swing_foot)) != 0))
+    {
+        cout << "Cached results differ (" << name << ")!" << endl;
+        return (1);
+    }
+    return (0);
+}
+
+
+int main(int argc, char** argv)
+{
+    nao_igm nao;
+    struct timeval start, end;
+    const int test_N = 10000;
+    int result = 0;
+
+
+    // set the problem from test_igm_3_1
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+
+    nao.getSwingFootPosture (nao.state_sensor, nao.left_foot_posture.data());
+    nao.left_foot_posture =
+        (nao.left_foot_posture) *
+        Translation<double,3>(-0.02,0.01,0.02) *
+        AngleAxisd(0.1, Vector3d::UnitX()) *
+        AngleAxisd(0.1, Vector3d::UnitY()) *
+        AngleAxisd(0.1, Vector3d::UnitZ());
+
+    nao.getCoM (nao.state_sensor, nao.CoM_position);
+    nao.CoM_position[0] += 0.03;
+    nao.CoM_position[1] += 0.02;
+    nao.CoM_position[2] -= 0.01;
+
+
+    // state_model is a copy of state_sensor, which is cached above
+    result |= compare (nao, nao.state_model, "initial");
+    result |= compare (nao, nao.state_model, "repeated");
+
+    // the joint angles are changed by the solver
+    nao.igm(nao.state_sensor.q, 1.2, 0.0015, 20);
+    result |= compare (nao, nao.state_model, "solution");
+
+    // the joint angles are changed directly
+    nao.state_model.q[L_KNEE_PITCH] += 0.01;
+    result |= compare (nao, nao.state_model, "modified");
+
+    // a joint of an arm is changed directly, the CoM depends on it
+    nao.state_model.q[L_SHOULDER_PITCH] += 0.1;
+    result |= compare (nao, nao.state_model, "modified arm");
+
+    // another state
+    result |= compare (nao, nao.state_sensor, "another state");
+
+    // the support foot is changed
+    nao.support_foot = IGM_SUPPORT_LEFT;
+    result |= compare (nao, nao.state_sensor, "support foot");
+
+    // the posture of the support foot is changed
+    nao.left_foot_posture.translation().x() += 0.01;
+    result |= compare (nao, nao.state_sensor, "support foot posture");
+    nao.support_foot = IGM_SUPPORT_RIGHT;
+
+    printf(" CoM: hits = %d, misses = %d\n", nao.CoM_cache.hits, nao.CoM_cache.misses);
+    printf(" swing foot: hits = %d, misses = %d\n", nao.swing_foot_cache.hits, nao.swing_foot_cache.misses);
+    if ((nao.CoM_cache.hits != 2) || (nao.swing_foot_cache.hits != 2))
+    {
+        cout << "Unexpected number of hits!" << endl;
+        result = 1;
+    }
+
+
+    // timing
+    double CoM[POSITION_VECTOR_SIZE];
+    double swing_foot[16];
+    const igmModel &model = nao;
+
+    gettimeofday(&start,0);
+    for (int i = 0; i < test_N; ++i)
+    {
+        model.getCoM(nao.state_sensor, CoM);
+        model.getSwingFootPosture(nao.state_sensor, swing_foot);
+    }
+    gettimeofday(&end,0);
+    printf(" time (getCoM + getSwingFootPosture, no cache) = %e\n", getTime(start, end)/test_N);
+
+    gettimeofday(&start,0);
+    for (int i = 0; i < test_N; ++i)
+    {
+        nao.getCoM(nao.state_sensor, CoM);
+        nao.getSwingFootPosture(nao.state_sensor, swing_foot);
+    }
+    gettimeofday(&end,0);
+    printf(" time (getCoM + getSwingFootPosture, cached) = %e\n", getTime(start, end)/test_N);
+
+    return (result);
+}
@@ -0,0 +1,178 @@
+// test_fk_fused.cpp
+//
+// Compare LLeg2RLegCoM() / RLeg2LLegCoM() with separate computation of the
+// posture of the swing foot and the position of the CoM on random
+// configurations within the joint bounds, and measure the time of both.
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <sys/time.h>
+#include <time.h>
+
+#include "nao_igm.h"
+#include "maple_functions.h"
+
+using namespace std;
+
+
+#define NUM_CONFIGURATIONS 1000
+#define NUM_REPETITIONS 20
+
+
+double getTime(struct timeval &start, struct timeval &end)
+{
+    return (end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec));
+}
+
+
+double maxDifference (const double *a, const double *b, const int size)
+{
+    double diff = 0.0;
+    for (int i = 0; i < size; ++i)
+    {
+        diff = max(diff, fabs(a[i] - b[i]));
+    }
+    return (diff);
+}
+
+
+int main(int argc, char** argv)
+{
+    nao_igm nao;
+    struct timeval start, end;
+    int result = 0;
+
+    jointState *states = new jointState[NUM_CONFIGURATIONS];
+    double T[16], A[POSITION_VECTOR_SIZE];
+    double T_fused[16], A_fused[POSITION_VECTOR_SIZE];
+
+
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+    double *LL = nao.left_foot_posture.data();
+    double *RL = nao.right_foot_posture.data();
+
+
+    srand(1);
+    for (int i = 0; i < NUM_CONFIGURATIONS; ++i)
+    {
+        for (int j = 0; j < JOINTS_NUM; ++j)
+        {
+            states[i].q[j] = jointState::q_lower_bound[j] +
+                (jointState::q_upper_bound[j] - jointState::q_lower_bound[j]) * rand() / RAND_MAX;
+        }
+        states[i].trig.update(states[i].q);
+    }
+
+
+    // accuracy
+    double diff = 0.0;
+    for (int i = 0; i < NUM_CONFIGURATIONS; ++i)
+    {
+        jointState &s = states[i];
+
+        LLeg2RLeg(s.q, LL, T);
+        LLeg2CoM(s.q, LL, A);
+        LLeg2RLegCoM(s.q, LL, T_fused, A_fused);
+        diff = max(diff, maxDifference(T, T_fused, 16));
+        diff = max(diff, maxDifference(A, A_fused, POSITION_VECTOR_SIZE));
+
+        RLeg2LLeg(s.q, RL, T);
+        RLeg2CoM(s.q, RL, A);
+        RLeg2LLegCoM(s.q, RL, T_fused, A_fused);
+        diff = max(diff, maxDifference(T, T_fused, 16));
+        diff = max(diff, maxDifference(A, A_fused, POSITION_VECTOR_SIZE));
+
+        LLeg2RLeg_trig(s.trig.sin_q, s.trig.cos_q, LL, T);
+        LLeg2CoM_trig(s.trig.sin_q, s.trig.cos_q, LL, A);
+        LLeg2RLegCoM_trig(s.trig.sin_q, s.trig.cos_q, LL, T_fused, A_fused);
+        diff = max(diff, maxDifference(T, T_fused, 16));
+        diff = max(diff, maxDifference(A, A_fused, POSITION_VECTOR_SIZE));
+
+        RLeg2LLeg_trig(s.trig.sin_q, s.trig.cos_q, RL, T);
+        RLeg2CoM_trig(s.trig.sin_q, s.trig.cos_q, RL, A);
+        RLeg2LLegCoM_trig(s.trig.sin_q, s.trig.cos_q, RL, T_fused, A_fused);
+        diff = max(diff, maxDifference(T, T_fused, 16));
+        diff = max(diff, maxDifference(A, A_fused, POSITION_VECTOR_SIZE));
+    }
+    printf(" max difference = %e\n", diff);
+    if (diff > 1e-12)
+    {
+        cout << "Results of fused functions differ!" << endl;
+        result = 1;
+    }
+
+
+    // timing
+    const int test_N = NUM_CONFIGURATIONS * NUM_REPETITIONS;
+
+    gettimeofday(&start,0);
+    for (int k = 0; k < NUM_REPETITIONS; ++k)
+    {
+        for (int i = 0; i < NUM_CONFIGURATIONS; ++i)
+        {
+            LLeg2RLeg(states[i].q, LL, T);
+            LLeg2CoM(states[i].q, LL, A);
+        }
+    }
+    gettimeofday(&end,0);
+    printf(" time (LLeg2RLeg + LLeg2CoM) = %e\n", getTime(start, end)/test_N);
+
+    gettimeofday(&start,0);
+    for (int k = 0; k < NUM_REPETITIONS; ++k)
+    {
+        for (int i = 0; i < NUM_CONFIGURATIONS; ++i)
+        {
+            LLeg2RLegCoM(states[i].q, LL, T, A);
+        }
+    }
+    gettimeofday(&end,0);
+    printf(" time (LLeg2RLegCoM) = %e\n", getTime(start, end)/test_N);
+
+    gettimeofday(&start,0);
+    for (int k = 0; k < NUM_REPETITIONS; ++k)
+    {
+        for (int i = 0; i < NUM_CONFIGURATIONS; ++i)
+        {
+            LLeg2RLeg_trig(states[i].trig.sin_q, states[i].trig.cos_q, LL, T);
+            LLeg2CoM_trig(states[i].trig.sin_q, states[i].trig.cos_q, LL, A);
+        }
+    }
+    gettimeofday(&end,0);
+    printf(" time (LLeg2RLeg_trig + LLeg2CoM_trig) = %e\n", getTime(start, end)/test_N);
+
+    gettimeofday(&start,0);
+    for (int k = 0; k < NUM_REPETITIONS; ++k)
+    {
+        for (int i = 0; i < NUM_CONFIGURATIONS; ++i)
+        {
+            LLeg2RLegCoM_trig(states[i].trig.sin_q, states[i].trig.cos_q, LL, T, A);
+        }
+    }
+    gettimeofday(&end,0);
+    printf(" time (LLeg2RLegCoM_trig) = %e\n", getTime(start, end)/test_N);
+
+
+    // nao_igm interface
+    const igmModel &model = nao;
+    double CoM[POSITION_VECTOR_SIZE];
+    nao.getSwingFootPostureCoM(nao.state_sensor, T_fused, A_fused);
+    model.getSwingFootPosture(nao.state_sensor, T);
+    model.getCoM(nao.state_sensor, CoM);
+    diff = max(maxDifference(T, T_fused, 16), maxDifference(CoM, A_fused, POSITION_VECTOR_SIZE));
+    nao.getCoM(nao.state_sensor, A);
+    if ((diff > 1e-12) || (nao.CoM_cache.hits != 1))
+    {
+        cout << "nao_igm::getSwingFootPostureCoM() failed!" << endl;
+        result = 1;
+    }
+
+    delete [] states;
+
+    return (result);
+}
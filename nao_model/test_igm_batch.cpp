@@ -0,0 +1,232 @@
+// test_igm_batch.cpp
+//
+// Compare igmBatch::solve() with nao_igm::igm() called in a loop and measure
+// throughput of both on a single core. The results of vectorized batch
+// solver are compared with the scalar version. In single precision the
+// vectorized batch must give the same results as nao_igm::igm().
+
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <sys/time.h>
+#include <time.h>
+
+#include "nao_igm.h"
+#include "maple_functions.h"
+
+using namespace std;
+
+
+double getTime(struct timeval &start, struct timeval &end)
+{
+    return (end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec));
+}
+
+
+int main(int argc, char** argv)
+{
+    nao_igm nao;
+
+    struct timeval start, end;
+    const int batch_N = 1000;
+    const int test_N = 10;
+
+
+    // set initial configuration
+    jointState q0;
+
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+    q0 = nao.state_model;
+
+    Transform<double,3> swing_foot_posture;
+    double CoM_position[POSITION_VECTOR_SIZE];
+    nao.getSwingFootPosture (nao.state_sensor, swing_foot_posture.data());
+    nao.getCoM (nao.state_sensor, CoM_position);
+
+
+    // form the batch: targets are spread around the target in test_igm_3_1
+    igmSupportFoot *support_foot = new igmSupportFoot[batch_N];
+    double *support_foot_posture = new double[16*batch_N];
+    double *swing_foot_expected = new double[16*batch_N];
+    double *CoM_expected = new double[POSITION_VECTOR_SIZE*batch_N];
+    double *ref_angles = new double[LOWER_JOINTS_NUM*batch_N];
+    double *q = new double[JOINTS_NUM*batch_N];
+    double *q_loop = new double[JOINTS_NUM*batch_N];
+    int *iter = new int[batch_N];
+    int *iter_loop = new int[batch_N];
+
+    for (int i = 0; i < batch_N; ++i)
+    {
+        double a = (double) i / batch_N;
+
+        Transform<double,3> target =
+            swing_foot_posture *
+            Translation<double,3>(-0.02*a, 0.01*a, 0.02*a) *
+            AngleAxisd(0.1*a, Vector3d::UnitX()) *
+            AngleAxisd(0.1*a, Vector3d::UnitY()) *
+            AngleAxisd(0.1*a, Vector3d::UnitZ());
+
+        support_foot[i] = IGM_SUPPORT_RIGHT;
+        memcpy(support_foot_posture + 16*i, nao.right_foot_posture.data(), 16*sizeof(double));
+        memcpy(swing_foot_expected + 16*i, target.data(), 16*sizeof(double));
+        CoM_expected[i*3 + 0] = CoM_position[0] + 0.03*a;
+        CoM_expected[i*3 + 1] = CoM_position[1] + 0.02*a;
+        CoM_expected[i*3 + 2] = CoM_position[2] - 0.01*a;
+        memcpy(ref_angles + LOWER_JOINTS_NUM*i, q0.q, LOWER_JOINTS_NUM*sizeof(double));
+    }
+
+
+    igmBatch batch;
+    batch.size = batch_N;
+    batch.support_foot = support_foot;
+    batch.support_foot_posture = support_foot_posture;
+    batch.swing_foot_posture = swing_foot_expected;
+    batch.CoM_position = CoM_expected;
+    batch.ref_angles = ref_angles;
+    batch.q = q;
+    batch.iter = iter;
+
+
+    // nao_igm::igm() in a loop
+    gettimeofday(&start,0);
+    for (int j = 0; j < test_N; ++j)
+    {
+        for (int i = 0; i < batch_N; ++i)
+        {
+            memcpy(nao.left_foot_posture.data(), swing_foot_expected + 16*i, 16*sizeof(double));
+            memcpy(nao.CoM_position, CoM_expected + 3*i, 3*sizeof(double));
+            nao.state_model = q0;
+            iter_loop[i] = nao.igm(ref_angles + LOWER_JOINTS_NUM*i, 1.2, 0.0015, 20);
+            memcpy(q_loop + JOINTS_NUM*i, nao.state_model.q, JOINTS_NUM*sizeof(double));
+        }
+    }
+    gettimeofday(&end,0);
+    double loop_time = getTime(start, end) / (test_N*batch_N);
+
+
+    // igmBatch::solve()
+    int num_failed = 0;
+    gettimeofday(&start,0);
+    for (int j = 0; j < test_N; ++j)
+    {
+        for (int i = 0; i < batch_N; ++i)
+        {
+            memcpy(q + JOINTS_NUM*i, q0.q, JOINTS_NUM*sizeof(double));
+        }
+        num_failed = batch.solve(1.2, 0.0015, 20);
+    }
+    gettimeofday(&end,0);
+    double batch_time = getTime(start, end) / (test_N*batch_N);
+
+
+    // igmBatch::solve() with SIMD versions of the generated functions
+    double *q_simd = new double[JOINTS_NUM*batch_N];
+    int *iter_simd = new int[batch_N];
+    batch.q = q_simd;
+    batch.iter = iter_simd;
+    batch.vectorize = true;
+
+    gettimeofday(&start,0);
+    for (int j = 0; j < test_N; ++j)
+    {
+        for (int i = 0; i < batch_N; ++i)
+        {
+            memcpy(q_simd + JOINTS_NUM*i, q0.q, JOINTS_NUM*sizeof(double));
+        }
+        batch.solve(1.2, 0.0015, 20);
+    }
+    gettimeofday(&end,0);
+    double simd_time = getTime(start, end) / (test_N*batch_N);
+
+    double simd_max_diff = 0.0;
+    int simd_iter_diff = 0;
+    for (int i = 0; i < batch_N; ++i)
+    {
+        for (int j = 0; j < LOWER_JOINTS_NUM; ++j)
+        {
+            double diff = fabs(q_simd[i*JOINTS_NUM + j] - q[i*JOINTS_NUM + j]);
+            if (diff > simd_max_diff)
+            {
+                simd_max_diff = diff;
+            }
+        }
+        if (iter_simd[i] != iter[i])
+        {
+            ++simd_iter_diff;
+        }
+    }
+
+
+    int num_iter = 0;
+    for (int i = 0; i < batch_N; ++i)
+    {
+        num_iter += iter[i];
+    }
+
+    printf(" time (igm, loop)  = % f, %.0f solutions/s per core\n", loop_time, 1.0/loop_time);
+    printf(" time (igm, batch) = % f, %.0f solutions/s per core\n", batch_time, 1.0/batch_time);
+    printf(" time (igm, batch, SIMD width %d) = % f, %.0f solutions/s per core\n",
+            igmSIMDWidth(), simd_time, 1.0/simd_time);
+    cout << "problems = " << batch_N << ", failed = " << num_failed
+         << ", average iter = " << (double) num_iter / batch_N << endl;
+
+
+    int result = 0;
+    if ((memcmp(q, q_loop, JOINTS_NUM*batch_N*sizeof(double)) != 0)
+            || (memcmp(iter, iter_loop, batch_N*sizeof(int)) != 0))
+    {
+        cout << "Batch and loop results differ!" << endl;
+        result = 1;
+    }
+    else
+    {
+        cout << "Batch and loop results are identical." << endl;
+    }
+
+    cout << "SIMD: max difference of angles = " << simd_max_diff
+         << ", different iteration counts = " << simd_iter_diff << endl;
+
+
+    // single precision is not vectorized
+    batch.options.precision = IGM_PRECISION_FLOAT;
+    nao.options.precision = IGM_PRECISION_FLOAT;
+    for (int i = 0; i < batch_N; ++i)
+    {
+        memcpy(q_simd + JOINTS_NUM*i, q0.q, JOINTS_NUM*sizeof(double));
+
+        memcpy(nao.left_foot_posture.data(), swing_foot_expected + 16*i, 16*sizeof(double));
+        memcpy(nao.CoM_position, CoM_expected + 3*i, 3*sizeof(double));
+        nao.state_model = q0;
+        iter_loop[i] = nao.igm(ref_angles + LOWER_JOINTS_NUM*i, 1.2, 0.0015, 20);
+        memcpy(q_loop + JOINTS_NUM*i, nao.state_model.q, JOINTS_NUM*sizeof(double));
+    }
+    batch.solve(1.2, 0.0015, 20);
+    if ((memcmp(q_simd, q_loop, JOINTS_NUM*batch_N*sizeof(double)) != 0)
+            || (memcmp(iter_simd, iter_loop, batch_N*sizeof(int)) != 0))
+    {
+        cout << "Batch and loop results differ in single precision!" << endl;
+        result = 1;
+    }
+    batch.options.precision = IGM_PRECISION_DOUBLE;
+    nao.options.precision = IGM_PRECISION_DOUBLE;
+
+
+    delete [] support_foot;
+    delete [] support_foot_posture;
+    delete [] swing_foot_expected;
+    delete [] CoM_expected;
+    delete [] ref_angles;
+    delete [] q;
+    delete [] q_loop;
+    delete [] iter;
+    delete [] iter_loop;
+    delete [] q_simd;
+    delete [] iter_simd;
+
+    return (result);
+}
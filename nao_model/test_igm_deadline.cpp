@@ -0,0 +1,181 @@
+// test_igm_deadline.cpp
+//
+// Solve problems with reachable and unreachable targets and the problems
+// along the standard gait (igmGait) within a time budget, report the
+// distribution of latencies and statuses.
+//
+// The solver must not start an iteration, which may not be completed within
+// the budget according to its estimates (nao_igm::deadline_slack), this is
+// checked in all calls except the warm-up call after init(). The wall-clock
+// latencies of all calls are reported, but not checked: they include
+// interruptions by the system (interrupts, preemption of the process or of
+// the virtual machine), which are not controlled by the solver.
+
+#include <iostream>
+#include <stdio.h>
+#include <algorithm>
+#include <limits>
+
+#include <time.h>
+
+#include "nao_igm.h"
+
+using namespace std;
+
+
+double getTime()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (t.tv_sec + 1e-9 * t.tv_nsec);
+}
+
+
+/**
+ * Call igmDeadline() from the current state of the model, returns the
+ * latency, min_slack is updated with nao_igm::deadline_slack.
+ */
+double solve (
+        nao_igm &nao,
+        const double *ref_angles,
+        const double time_budget,
+        igmStatus &status,
+        double &min_slack)
+{
+    int iter;
+
+    double start = getTime();
+    status = nao.igmDeadline(ref_angles, 1.2, 0.0015, time_budget, iter);
+    double latency = getTime() - start;
+
+    min_slack = min(min_slack, nao.deadline_slack);
+    return (latency);
+}
+
+
+/**
+ * Report the latencies, returns 1 if an iteration is started, which may
+ * not be completed within the budget.
+ */
+int report (
+        const char *name,
+        double *latency,
+        const int num,
+        const double time_budget,
+        const int *num_status,
+        const double min_slack)
+{
+    const char *status_names[] = {"converged", "budget exhausted", "diverging"};
+
+    sort (latency, latency + num);
+    int num_over_budget = num - (upper_bound(latency, latency + num, time_budget) - latency);
+
+    printf("%s: budget = %e, calls = %d\n", name, time_budget, num);
+    printf(" wall-clock latency: median = %e, p99 = %e, p99.9 = %e, max = %e\n",
+            latency[num / 2], latency[(num * 99) / 100], latency[(num * 999) / 1000], latency[num - 1]);
+    printf(" worst-case wall-clock overshoot = %e\n", max(latency[num - 1] - time_budget, 0.0));
+    printf(" smallest slack of a started iteration = %e\n", min_slack);
+    for (int i = 0; i < 3; ++i)
+    {
+        cout << " " << status_names[i] << ": " << num_status[i] << endl;
+    }
+    cout << " over budget: " << num_over_budget << endl;
+
+    if (min_slack < 0.0)
+    {
+        cout << "An iteration is started past the deadline!" << endl;
+        return (1);
+    }
+    return (0);
+}
+
+
+int main(int argc, char** argv)
+{
+    nao_igm nao;
+
+    const int test_N = 3000;
+    const double time_budget = 40e-6;
+    int result = 0;
+
+
+    // set initial configuration
+    jointState q0;
+
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+    q0 = nao.state_model;
+
+    Transform<double,3> swing_foot_posture;
+    double CoM_position[POSITION_VECTOR_SIZE];
+    nao.getSwingFootPosture (nao.state_sensor, swing_foot_posture.data());
+    nao.getCoM (nao.state_sensor, CoM_position);
+
+
+    double *latency = new double[test_N];
+    double min_slack = std::numeric_limits<double>::max();
+    int num_status[3] = {0, 0, 0};
+    int iter;
+
+    // warm-up: the first call after init() may exceed the budget, since
+    // the durations of iterations are not known yet
+    nao.igmDeadline(q0.q, 1.2, 0.0015, time_budget, iter);
+
+    for (int i = 0; i < test_N; ++i)
+    {
+        // every third target is unreachable
+        double a = (double) (i % 100) / 100;
+        double reach = (i % 3 == 0) ? 10.0 : 1.0;
+
+        nao.left_foot_posture =
+            swing_foot_posture *
+            Translation<double,3>(-0.02*a*reach, 0.01*a*reach, 0.02*a*reach) *
+            AngleAxisd(0.1*a, Vector3d::UnitX()) *
+            AngleAxisd(0.1*a, Vector3d::UnitY()) *
+            AngleAxisd(0.1*a, Vector3d::UnitZ());
+        nao.setCoM(
+                CoM_position[0] + 0.03*a,
+                CoM_position[1] + 0.02*a,
+                CoM_position[2] - 0.01*a);
+        nao.state_model = q0;
+
+        igmStatus status;
+        latency[i] = solve (nao, q0.q, time_budget, status, min_slack);
+        ++num_status[status];
+    }
+    result |= report ("targets", latency, test_N, time_budget, num_status, min_slack);
+    printf(" estimated duration of an iteration = %e, of the residuals = %e\n",
+            nao.iteration_time.get(), nao.residual_time.get());
+
+
+    // the standard gait, the solution on the previous tick is the initial
+    // guess
+    igmGait gait;
+    int num_ticks = 0;
+
+    min_slack = std::numeric_limits<double>::max();
+    for (int i = 0; i < 3; ++i)
+    {
+        num_status[i] = 0;
+    }
+
+    gait.num_steps = 0;
+    gait.init (nao);
+    // warm-up after init(), as above
+    nao.igmDeadline(q0.q, 1.2, 0.0015, time_budget, iter);
+    while ((num_ticks < test_N) && gait.next(nao))
+    {
+        igmStatus status;
+        latency[num_ticks] = solve (nao, q0.q, time_budget, status, min_slack);
+        ++num_status[status];
+        ++num_ticks;
+    }
+    result |= report ("gait", latency, num_ticks, time_budget, num_status, min_slack);
+
+
+    delete [] latency;
+
+    return (result);
+}
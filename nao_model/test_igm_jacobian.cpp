@@ -0,0 +1,252 @@
+// test_igm_jacobian.cpp
+//
+// Solve the problem from test_igm_3_1 and the problems along the standard
+// gait (igmGait) with exact, reused (chord) and updated (Broyden) Jacobian.
+// The solutions are compared with the reference solution obtained with
+// exact Jacobian and a tight tolerance: the convergence is linear, hence
+// the error of a solution must not exceed a small multiple of the
+// tolerance (SOLUTION_ERROR_FACTOR). The residuals computed without the
+// Jacobian are compared with the residuals computed by from_LLeg_3() /
+// from_RLeg_3().
+
+#include <iostream>
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+
+#include <sys/time.h>
+#include <time.h>
+
+#include "nao_igm.h"
+#include "maple_functions.h"
+#include "igm_solver.h"
+
+using namespace std;
+
+
+/// Bound on the error of a solution relative to the tolerance.
+#define SOLUTION_ERROR_FACTOR 3.0
+/// Tolerance of the reference solution.
+#define REFERENCE_TOL 1e-12
+
+
+
+double getTime(struct timeval &start, struct timeval &end)
+{
+    return (end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec));
+}
+
+
+/**
+ * Compute the residuals with and without the Jacobian, returns the infinity
+ * norm of the residuals and the maximal difference.
+ */
+double computeResidual(nao_igm &nao, jointState &state, double *max_diff)
+{
+    double out[IGM_KERNEL_OUTPUT_SIZE];
+    double err[IGM_NUM_CONSTRAINTS];
+    jointTrig trig;
+
+    trig.update(state.q);
+    if (nao.support_foot == IGM_SUPPORT_LEFT)
+    {
+        from_LLeg_3(state.q, nao.left_foot_posture.data(), nao.right_foot_posture.data(), nao.CoM_position, out);
+        igmResidual(nao.support_foot, trig, nao.left_foot_posture.data(), nao.right_foot_posture.data(), nao.CoM_position, err);
+    }
+    else
+    {
+        from_RLeg_3(state.q, nao.right_foot_posture.data(), nao.left_foot_posture.data(), nao.CoM_position, out);
+        igmResidual(nao.support_foot, trig, nao.right_foot_posture.data(), nao.left_foot_posture.data(), nao.CoM_position, err);
+    }
+
+    double norm_err = 0.0;
+    *max_diff = 0.0;
+    for (int i = 0; i < IGM_NUM_CONSTRAINTS; ++i)
+    {
+        double diff = fabs(err[i] - out[IGM_NUM_CONSTRAINTS*LOWER_JOINTS_NUM + i]);
+        if (!(diff <= *max_diff))
+        {
+            *max_diff = diff;
+        }
+        if (!(fabs(err[i]) <= norm_err))
+        {
+            norm_err = fabs(err[i]);
+        }
+    }
+    return (norm_err);
+}
+
+
+/**
+ * Solve the current problem from q_init with exact Jacobian and a tight
+ * tolerance, state_model and the options are not changed.
+ */
+jointState solveReference(nao_igm &nao, const jointState &q_init, const double *ref_angles)
+{
+    const jointState state = nao.state_model;
+    const igmOptions options = nao.options;
+
+    nao.options.jacobian_update = IGM_JACOBIAN_EXACT;
+    nao.state_model = q_init;
+    nao.igm(ref_angles, 1.2, REFERENCE_TOL, 200);
+
+    const jointState q_ref = nao.state_model;
+    nao.state_model = state;
+    nao.options = options;
+    return (q_ref);
+}
+
+
+/**
+ * Infinity norm of the difference of the angles of the lower part of the
+ * body.
+ */
+double maxDifference(const jointState &a, const jointState &b)
+{
+    double max_diff = 0.0;
+    for (int i = 0; i < LOWER_JOINTS_NUM; ++i)
+    {
+        max_diff = max(max_diff, fabs(a.q[i] - b.q[i]));
+    }
+    return (max_diff);
+}
+
+
+int main(int argc, char** argv)
+{
+    const char *names[] = {"exact", "chord", "Broyden"};
+    const igmJacobianUpdate modes[] = {IGM_JACOBIAN_EXACT, IGM_JACOBIAN_CHORD, IGM_JACOBIAN_BROYDEN};
+
+    nao_igm nao;
+
+    struct timeval start, end;
+    int test_N = 1000;
+    const double tol = 0.0015;
+    int result = 0;
+
+
+    // set initial configuration
+    jointState q0;
+
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+    q0 = nao.state_model;
+
+
+    nao.getSwingFootPosture (nao.state_sensor, nao.left_foot_posture.data());
+    nao.left_foot_posture =
+        (nao.left_foot_posture) *
+        Translation<double,3>(-0.02,0.01,0.02) *
+        AngleAxisd(0.1, Vector3d::UnitX()) *
+        AngleAxisd(0.1, Vector3d::UnitY()) *
+        AngleAxisd(0.1, Vector3d::UnitZ());
+
+    nao.getCoM (nao.state_sensor, nao.CoM_position);
+    nao.CoM_position[0] += 0.03;
+    nao.CoM_position[1] += 0.02;
+    nao.CoM_position[2] -= 0.01;
+
+
+    double residual_diff;
+    computeResidual(nao, q0, &residual_diff);
+    cout << "max difference of residuals = " << residual_diff << endl;
+    if (residual_diff > 1e-12)
+    {
+        cout << "Residuals differ!" << endl;
+        result = 1;
+    }
+
+
+    const jointState q_ref = solveReference(nao, q0, q0.q);
+    for (int k = 0; k < 3; ++k)
+    {
+        nao.options.jacobian_update = modes[k];
+
+        int iter;
+        gettimeofday(&start,0);
+        for (int i=0 ; i<test_N ; i++)
+        {
+            nao.state_model = q0;
+            iter = nao.igm(q0.q, 1.2, tol, 20);
+        }
+        gettimeofday(&end,0);
+        printf(" time (igm, %s Jacobian) = % f\n", names[k], getTime(start, end)/test_N);
+
+        double norm_err = computeResidual(nao, nao.state_model, &residual_diff);
+        double max_diff = maxDifference(nao.state_model, q_ref);
+        cout << "iter = " << iter
+             << ", residual = " << norm_err
+             << ", error of the solution = " << max_diff << endl;
+
+        if ((iter < 0) || (norm_err > tol) || (max_diff > SOLUTION_ERROR_FACTOR * tol))
+        {
+            result = 1;
+        }
+    }
+
+
+    // the standard gait: on each tick all modes start from the solution
+    // obtained with exact Jacobian on the previous tick
+    igmGait gait;
+    double max_gait_residual[3] = {0.0, 0.0, 0.0};
+    double max_gait_error[3] = {0.0, 0.0, 0.0};
+    double max_gait_residual_diff = 0.0;
+    int num_gait_failures[3] = {0, 0, 0};
+    int num_ticks = 0;
+
+    gait.init(nao);
+    while (gait.next(nao))
+    {
+        const jointState q_prev = nao.state_model;
+        const jointState q_gait_ref = solveReference(nao, q_prev, q0.q);
+        jointState q_exact;
+        ++num_ticks;
+
+        for (int k = 0; k < 3; ++k)
+        {
+            nao.options.jacobian_update = modes[k];
+            nao.state_model = q_prev;
+
+            int iter = nao.igm(q0.q, 1.2, tol, 20);
+            double norm_err = computeResidual(nao, nao.state_model, &residual_diff);
+            if (k == 0)
+            {
+                q_exact = nao.state_model;
+            }
+
+            double max_diff = maxDifference(nao.state_model, q_gait_ref);
+
+            max_gait_residual[k] = max(max_gait_residual[k], norm_err);
+            max_gait_error[k] = max(max_gait_error[k], max_diff);
+            max_gait_residual_diff = max(max_gait_residual_diff, residual_diff);
+            if ((iter < 0) || (norm_err > tol) || (max_diff > SOLUTION_ERROR_FACTOR * tol))
+            {
+                ++num_gait_failures[k];
+            }
+        }
+        nao.state_model = q_exact;
+    }
+    nao.options.jacobian_update = IGM_JACOBIAN_EXACT;
+
+    cout << "gait: ticks = " << num_ticks
+         << ", max difference of residuals = " << max_gait_residual_diff << endl;
+    for (int k = 0; k < 3; ++k)
+    {
+        cout << " " << names[k] << " Jacobian: max residual = " << max_gait_residual[k]
+             << ", max error of the solution = " << max_gait_error[k]
+             << ", failures = " << num_gait_failures[k] << endl;
+        if (num_gait_failures[k] > 0)
+        {
+            result = 1;
+        }
+    }
+    if (max_gait_residual_diff > 1e-12)
+    {
+        cout << "Residuals differ!" << endl;
+        result = 1;
+    }
+
+    return (result);
+}
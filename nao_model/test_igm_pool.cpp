@@ -0,0 +1,216 @@
+// test_igm_pool.cpp
+//
+// Precompute joint angles for gaits with different step lengths and
+// heights: each gait is a job solved with warm starting, the jobs are
+// solved by igmPool with different numbers of threads. The results must
+// not depend on the number of threads, the speedup is reported.
+
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "nao_igm.h"
+
+using namespace std;
+
+
+#define HOMOGENEOUS_MATRIX_SIZE 16
+
+#define STEP_TICKS 40
+#define NUM_STEPS 16
+#define GAIT_TICKS (STEP_TICKS*NUM_STEPS)
+
+
+double getTime(struct timeval &start, struct timeval &end)
+{
+    return (end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec));
+}
+
+
+/**
+ * Buffers of a job.
+ */
+class gaitJob
+{
+    public:
+        void init (nao_igm &, const jointState &, const double, const double);
+        void reset (const jointState &);
+
+        igmBatch batch;
+
+        igmSupportFoot support_foot[GAIT_TICKS];
+        double support_foot_posture[GAIT_TICKS*HOMOGENEOUS_MATRIX_SIZE];
+        double swing_foot_posture[GAIT_TICKS*HOMOGENEOUS_MATRIX_SIZE];
+        double CoM_position[GAIT_TICKS*POSITION_VECTOR_SIZE];
+        double ref_angles[GAIT_TICKS*LOWER_JOINTS_NUM];
+        double q[GAIT_TICKS*JOINTS_NUM];
+        int iter[GAIT_TICKS];
+};
+
+
+/**
+ * Form targets of the standard gait (see igmGait) with NUM_STEPS steps of
+ * the given length and height.
+ */
+void gaitJob::init (nao_igm &nao, const jointState &q0, const double step_length, const double step_height)
+{
+    igmGait gait;
+    gait.step_length = step_length;
+    gait.step_height = step_height;
+    gait.ss_ticks = STEP_TICKS;
+    gait.num_steps = NUM_STEPS;
+
+    nao.state_sensor = q0;
+    gait.init (nao);
+
+    int n = 0;
+    for (; gait.next(nao); ++n)
+    {
+        const Transform<double,3> *support_foot_;
+        const Transform<double,3> *swing_foot;
+        if (nao.support_foot == IGM_SUPPORT_LEFT)
+        {
+            support_foot_ = &nao.left_foot_posture;
+            swing_foot = &nao.right_foot_posture;
+        }
+        else
+        {
+            support_foot_ = &nao.right_foot_posture;
+            swing_foot = &nao.left_foot_posture;
+        }
+
+        support_foot[n] = nao.support_foot;
+        memcpy(support_foot_posture + n*HOMOGENEOUS_MATRIX_SIZE, support_foot_->data(), sizeof(double)*HOMOGENEOUS_MATRIX_SIZE);
+        memcpy(swing_foot_posture + n*HOMOGENEOUS_MATRIX_SIZE, swing_foot->data(), sizeof(double)*HOMOGENEOUS_MATRIX_SIZE);
+        memcpy(CoM_position + n*POSITION_VECTOR_SIZE, nao.CoM_position, sizeof(double)*POSITION_VECTOR_SIZE);
+        memcpy(ref_angles + n*LOWER_JOINTS_NUM, q0.q, sizeof(double)*LOWER_JOINTS_NUM);
+    }
+
+    batch.size = n;
+    batch.warm_start = true;
+    batch.support_foot = support_foot;
+    batch.support_foot_posture = support_foot_posture;
+    batch.swing_foot_posture = swing_foot_posture;
+    batch.CoM_position = CoM_position;
+    batch.ref_angles = ref_angles;
+    batch.q = q;
+    batch.iter = iter;
+
+    reset(q0);
+}
+
+
+/**
+ * Set the initial guesses.
+ */
+void gaitJob::reset (const jointState &q0)
+{
+    for (int i = 0; i < batch.size; ++i)
+    {
+        memcpy(q + i*JOINTS_NUM, q0.q, sizeof(double)*JOINTS_NUM);
+        iter[i] = 0;
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    const int num_lengths = 8;
+    const int num_heights = 8;
+    const int num_jobs = num_lengths * num_heights;
+
+    struct timeval start, end;
+    nao_igm nao;
+    int result = 0;
+
+
+    jointState q0;
+
+    gaitJob *jobs = new gaitJob[num_jobs];
+    igmBatch *batches = new igmBatch[num_jobs];
+    for (int i = 0; i < num_lengths; ++i)
+    {
+        for (int j = 0; j < num_heights; ++j)
+        {
+            gaitJob &job = jobs[i*num_heights + j];
+            job.init (nao, q0, 0.01 + 0.004*i, 0.01 + 0.002*j);
+            batches[i*num_heights + j] = job.batch;
+        }
+    }
+
+
+    // reference: the calling thread only
+    igmPool pool;
+    gettimeofday(&start,0);
+    int num_failed_ref = pool.solve(batches, num_jobs, 1.2, 0.0015, 20);
+    gettimeofday(&end,0);
+    double time_ref = getTime(start, end);
+
+    double *q_ref = new double[num_jobs*GAIT_TICKS*JOINTS_NUM];
+    int *iter_ref = new int[num_jobs*GAIT_TICKS];
+    for (int i = 0; i < num_jobs; ++i)
+    {
+        memcpy(q_ref + i*GAIT_TICKS*JOINTS_NUM, jobs[i].q, sizeof(jobs[i].q));
+        memcpy(iter_ref + i*GAIT_TICKS, jobs[i].iter, sizeof(jobs[i].iter));
+    }
+
+    printf(" problems = %d, failed = %d\n", num_jobs * jobs[0].batch.size, num_failed_ref);
+    printf(" cores = %ld\n", sysconf(_SC_NPROCESSORS_ONLN));
+    printf("threads   time      speedup   steals\n");
+    printf("%7s % f % f %8d\n", "-", time_ref, 1.0, 0);
+
+
+    int max_threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (max_threads < 4)
+    {
+        max_threads = 4;
+    }
+    for (int num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+    {
+        for (int i = 0; i < num_jobs; ++i)
+        {
+            jobs[i].reset(q0);
+        }
+
+        if (pool.start(num_threads) != 0)
+        {
+            cout << "Cannot start threads!" << endl;
+            result = 1;
+        }
+
+        gettimeofday(&start,0);
+        int num_failed = pool.solve(batches, num_jobs, 1.2, 0.0015, 20);
+        gettimeofday(&end,0);
+        double time = getTime(start, end);
+
+        printf("%7d % f % f %8d\n", num_threads, time, time_ref / time, pool.num_steals);
+
+        bool differ = (num_failed != num_failed_ref);
+        for (int i = 0; i < num_jobs; ++i)
+        {
+            if ((memcmp(q_ref + i*GAIT_TICKS*JOINTS_NUM, jobs[i].q, sizeof(jobs[i].q)) != 0)
+                    || (memcmp(iter_ref + i*GAIT_TICKS, jobs[i].iter, sizeof(jobs[i].iter)) != 0))
+            {
+                differ = true;
+            }
+        }
+        if (differ)
+        {
+            cout << "Results differ from the reference!" << endl;
+            result = 1;
+        }
+    }
+    pool.stop();
+
+
+    delete [] iter_ref;
+    delete [] q_ref;
+    delete [] batches;
+    delete [] jobs;
+
+    return (result);
+}
@@ -0,0 +1,202 @@
+// test_igm_precision.cpp
+//
+// Solve the problem from test_igm_3_1 and the problems along the standard
+// gait (igmGait) with double, single and mixed precision iterations,
+// compare the solutions, the residuals of the constraints and the time.
+
+#include <iostream>
+#include <stdio.h>
+#include <math.h>
+
+#include <sys/time.h>
+#include <time.h>
+
+#include "nao_igm.h"
+#include "igm_solver.h"
+
+using namespace std;
+
+
+#define NUM_TOLERANCES 2
+
+
+double getTime(struct timeval &start, struct timeval &end)
+{
+    return (end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec));
+}
+
+
+/**
+ * Infinity norm of the residuals of the constraints for the current state
+ * of the model.
+ */
+double residualNorm (nao_igm &nao)
+{
+    double err[IGM_NUM_CONSTRAINTS];
+    double *support_foot_posture = nao.right_foot_posture.data();
+    double *swing_foot_posture = nao.left_foot_posture.data();
+
+    if (nao.support_foot == IGM_SUPPORT_LEFT)
+    {
+        support_foot_posture = nao.left_foot_posture.data();
+        swing_foot_posture = nao.right_foot_posture.data();
+    }
+
+    nao.state_model.trig.update(nao.state_model.q);
+    igmResidual (
+            nao.support_foot,
+            nao.state_model.trig,
+            support_foot_posture,
+            swing_foot_posture,
+            nao.CoM_position,
+            err);
+
+    double norm = 0.0;
+    for (int i = 0; i < IGM_NUM_CONSTRAINTS; ++i)
+    {
+        norm = max(norm, fabs(err[i]));
+    }
+    return (norm);
+}
+
+
+int main(int argc, char** argv)
+{
+    nao_igm nao;
+    struct timeval start, end;
+    const int test_N = 1000;
+    int result = 0;
+
+
+    // set the problem from test_igm_3_1
+    jointState q0;
+
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+    q0 = nao.state_model;
+
+    nao.getSwingFootPosture (nao.state_sensor, nao.left_foot_posture.data());
+    nao.left_foot_posture =
+        (nao.left_foot_posture) *
+        Translation<double,3>(-0.02,0.01,0.02) *
+        AngleAxisd(0.1, Vector3d::UnitX()) *
+        AngleAxisd(0.1, Vector3d::UnitY()) *
+        AngleAxisd(0.1, Vector3d::UnitZ());
+
+    nao.getCoM (nao.state_sensor, nao.CoM_position);
+    nao.CoM_position[0] += 0.03;
+    nao.CoM_position[1] += 0.02;
+    nao.CoM_position[2] -= 0.01;
+
+
+    const double tolerances[NUM_TOLERANCES] = {0.0015, 1e-6};
+    const char *names[] = {"double", "float", "mixed"};
+    const igmPrecision precisions[] = {IGM_PRECISION_DOUBLE, IGM_PRECISION_FLOAT, IGM_PRECISION_MIXED};
+
+    for (int k = 0; k < NUM_TOLERANCES; ++k)
+    {
+        const double tol = tolerances[k];
+        double q_double[LOWER_JOINTS_NUM] = {0.0};
+
+        printf("tol = %g\n", tol);
+        for (int j = 0; j < 3; ++j)
+        {
+            // single precision cannot reach the tight tolerance
+            if ((precisions[j] == IGM_PRECISION_FLOAT) && (tol < 1e-5))
+            {
+                continue;
+            }
+            nao.options.precision = precisions[j];
+
+            int iter = 0;
+            gettimeofday(&start,0);
+            for (int i = 0; i < test_N; ++i)
+            {
+                nao.state_model = q0;
+                iter = nao.igm(q0.q, 1.2, tol, 50);
+            }
+            gettimeofday(&end,0);
+
+            double diff = 0.0;
+            for (int i = 0; i < LOWER_JOINTS_NUM; ++i)
+            {
+                if (precisions[j] == IGM_PRECISION_DOUBLE)
+                {
+                    q_double[i] = nao.state_model.q[i];
+                }
+                diff = max(diff, fabs(nao.state_model.q[i] - q_double[i]));
+            }
+            double residual = residualNorm(nao);
+
+            printf(" %-6s: time = %e, iter = %d, max |q - q_double| = %e, residual = %e\n",
+                    names[j], getTime(start, end)/test_N, iter, diff, residual);
+
+            // the solutions must agree within the tolerance
+            if ((iter < 0) || (diff > tol))
+            {
+                cout << "Unexpected solution (" << names[j] << ")!" << endl;
+                result = 1;
+            }
+        }
+    }
+
+
+    // the standard gait: on each tick all precisions start from the
+    // solution obtained in double precision on the previous tick
+    const double tol = tolerances[0];
+    igmGait gait;
+    double max_gait_diff[3] = {0.0, 0.0, 0.0};
+    double max_gait_residual[3] = {0.0, 0.0, 0.0};
+    int num_gait_failures[3] = {0, 0, 0};
+    int num_ticks = 0;
+
+    gait.init(nao);
+    while (gait.next(nao))
+    {
+        const jointState q_prev = nao.state_model;
+        jointState q_double;
+        ++num_ticks;
+
+        for (int j = 0; j < 3; ++j)
+        {
+            nao.options.precision = precisions[j];
+            nao.state_model = q_prev;
+
+            int iter = nao.igm(q0.q, 1.2, tol, 50);
+            if (j == 0)
+            {
+                q_double = nao.state_model;
+            }
+
+            double diff = 0.0;
+            for (int i = 0; i < LOWER_JOINTS_NUM; ++i)
+            {
+                diff = max(diff, fabs(nao.state_model.q[i] - q_double.q[i]));
+            }
+            max_gait_diff[j] = max(max_gait_diff[j], diff);
+            max_gait_residual[j] = max(max_gait_residual[j], residualNorm(nao));
+            if ((iter < 0) || (diff > tol))
+            {
+                ++num_gait_failures[j];
+            }
+        }
+        nao.state_model = q_double;
+    }
+    nao.options.precision = IGM_PRECISION_DOUBLE;
+
+    printf("gait: ticks = %d, tol = %g\n", num_ticks, tol);
+    for (int j = 0; j < 3; ++j)
+    {
+        printf(" %-6s: max |q - q_double| = %e, max residual = %e, failures = %d\n",
+                names[j], max_gait_diff[j], max_gait_residual[j], num_gait_failures[j]);
+        if (num_gait_failures[j] > 0)
+        {
+            cout << "Unexpected solution (" << names[j] << ", gait)!" << endl;
+            result = 1;
+        }
+    }
+
+    return (result);
+}
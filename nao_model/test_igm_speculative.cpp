@@ -0,0 +1,178 @@
+// test_igm_speculative.cpp
+//
+// Walk the standard gait (igmGait) with double support phases, the
+// support foot is switched after double support. The sensors are delayed
+// by SENSOR_DELAY control ticks. The number of iterations on the first
+// tick after switching of the support foot is reported for solving with
+// igm() and igmSpeculative() in double support.
+
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+
+#include <sys/time.h>
+#include <time.h>
+
+#include "nao_igm.h"
+
+using namespace std;
+
+
+#define MAX_ITER 20
+#define SENSOR_DELAY 10
+
+
+double getTime(struct timeval &start, struct timeval &end)
+{
+    return (end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec));
+}
+
+
+/**
+ * Solve the IGM on a control tick and update the delayed sensors.
+ */
+int tick (nao_igm &nao, const jointState &q0, const bool speculative, jointState *history, int &num_ticks)
+{
+    int iter;
+    if (speculative)
+    {
+        iter = nao.igmSpeculative(q0.q, 1.2, 0.0015, MAX_ITER);
+    }
+    else
+    {
+        iter = nao.igm(q0.q, 1.2, 0.0015, MAX_ITER);
+    }
+
+    history[num_ticks % SENSOR_DELAY] = nao.state_model;
+    ++num_ticks;
+    nao.state_sensor = history[num_ticks % SENSOR_DELAY];
+
+    return (iter);
+}
+
+
+/**
+ * Walk the gait, mode: 0 -- igm(), 1 -- igmSpeculative() in the calling
+ * thread, 2 -- igmSpeculative() in a separate thread. hist[i] is the
+ * number of steps, on which i iterations were performed on the first tick
+ * after switching of the support foot, hist[MAX_ITER+1] is the number of
+ * failures on any tick. ds_time is the average time of a double support
+ * tick.
+ */
+void walk (const jointState &q0, const int mode, int *hist, double &ds_time, double *q_final)
+{
+    struct timeval start, end;
+    nao_igm nao;
+    igmGait gait;
+    jointState history[SENSOR_DELAY];
+    int num_ticks = 0;
+    int num_ds_ticks = 0;
+
+    gait.ss_ticks = 30;
+    gait.ds_ticks = 10;
+    // the sensors are updated by tick()
+    gait.copy_sensors = false;
+
+    if ((mode == 2) && (nao.startSpeculation() != 0))
+    {
+        cout << "Cannot start a thread!" << endl;
+    }
+
+    nao.state_sensor = q0;
+    for (int i = 0; i < SENSOR_DELAY; ++i)
+    {
+        history[i] = q0;
+    }
+    gait.init (nao);
+
+    for (int i = 0; i <= MAX_ITER + 1; ++i)
+    {
+        hist[i] = 0;
+    }
+    ds_time = 0.0;
+
+
+    while (gait.next(nao))
+    {
+        const bool double_support = gait.isDoubleSupport();
+
+        gettimeofday(&start,0);
+        int iter = tick (nao, q0, double_support && (mode != 0), history, num_ticks);
+        gettimeofday(&end,0);
+
+        if (double_support)
+        {
+            ds_time += getTime(start, end);
+            ++num_ds_ticks;
+        }
+
+        if (iter < 0)
+        {
+            ++hist[MAX_ITER + 1];
+        }
+        else if ((gait.getStep() > 0) && (gait.getTick() == 1))
+        {
+            ++hist[iter];
+        }
+    }
+
+    ds_time /= num_ds_ticks;
+    memcpy(q_final, nao.state_model.q, sizeof(double) * LOWER_JOINTS_NUM);
+}
+
+
+int main(int argc, char** argv)
+{
+    const char *names[] = {"igm", "speculative", "speculative, thread"};
+    int hist[3][MAX_ITER + 2];
+    double q_final[3][LOWER_JOINTS_NUM];
+    int result = 0;
+
+    jointState q0;
+
+
+    for (int mode = 0; mode < 3; ++mode)
+    {
+        double ds_time;
+        walk (q0, mode, hist[mode], ds_time, q_final[mode]);
+        printf(" time (double support tick, %s) = % f\n", names[mode], ds_time);
+
+        if (hist[mode][MAX_ITER + 1] > 0)
+        {
+            result = 1;
+        }
+    }
+
+    if (memcmp(q_final[1], q_final[2], sizeof(q_final[1])) != 0)
+    {
+        cout << "Results of speculative solving in a thread differ!" << endl;
+        result = 1;
+    }
+
+
+    cout << "iterations after switch: igm speculative" << endl;
+    for (int i = 0; i <= MAX_ITER + 1; ++i)
+    {
+        if ((hist[0][i] == 0) && (hist[1][i] == 0))
+        {
+            continue;
+        }
+
+        if (i > MAX_ITER)
+        {
+            printf("%23s", "failed");
+        }
+        else
+        {
+            printf("%23d", i);
+        }
+        printf(" %3d %11d\n", hist[0][i], hist[1][i]);
+    }
+
+    if (result != 0)
+    {
+        cout << "Test failed!" << endl;
+    }
+
+    return (result);
+}
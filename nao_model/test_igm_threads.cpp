@@ -0,0 +1,153 @@
+// test_igm_threads.cpp
+//
+// Several threads share one igmModel and construct their own joint states,
+// each thread solves the IGM from different initial guesses and evaluates
+// the CoM and the swing foot. The results are compared with the results
+// obtained in the main thread. Build with -fsanitize=thread to check for
+// data races.
+
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <pthread.h>
+
+#include "nao_igm.h"
+
+using namespace std;
+
+
+#define NUM_THREADS 4
+#define NUM_GUESSES 16
+#define NUM_REPEATS 50
+
+
+/**
+ * Results for all initial guesses.
+ */
+class threadResults
+{
+    public:
+        double q[NUM_GUESSES][JOINTS_NUM];
+        double CoM[NUM_GUESSES][POSITION_VECTOR_SIZE];
+        double swing_foot[NUM_GUESSES][16];
+        int iter[NUM_GUESSES];
+};
+
+
+const igmModel *model;
+threadResults results[NUM_THREADS];
+
+
+/**
+ * Solve the problem for all initial guesses.
+ */
+void solveAll (const igmModel &m, threadResults &r)
+{
+    jointState ref;
+
+    for (int i = 0; i < NUM_GUESSES; ++i)
+    {
+        jointState state;
+        for (int j = 0; j < LOWER_JOINTS_NUM; ++j)
+        {
+            state.q[j] += 0.01 * sin(i + j);
+        }
+
+        r.iter[i] = m.solve(state, ref.q, 1.2, 0.0015, 20);
+        m.getCoM(state, r.CoM[i]);
+        m.getSwingFootPosture(state, r.swing_foot[i]);
+        memcpy(r.q[i], state.q, sizeof(r.q[i]));
+    }
+}
+
+
+void *run (void *arg)
+{
+    threadResults *r = static_cast<threadResults *>(arg);
+
+    for (int k = 0; k < NUM_REPEATS; ++k)
+    {
+        solveAll (*model, *r);
+    }
+    return (NULL);
+}
+
+
+int main(int argc, char** argv)
+{
+    nao_igm nao;
+    int result = 0;
+
+
+    // set the problem from test_igm_3_1
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+
+    nao.getSwingFootPosture (nao.state_sensor, nao.left_foot_posture.data());
+    nao.left_foot_posture =
+        (nao.left_foot_posture) *
+        Translation<double,3>(-0.02,0.01,0.02) *
+        AngleAxisd(0.1, Vector3d::UnitX()) *
+        AngleAxisd(0.1, Vector3d::UnitY()) *
+        AngleAxisd(0.1, Vector3d::UnitZ());
+
+    nao.getCoM (nao.state_sensor, nao.CoM_position);
+    nao.CoM_position[0] += 0.03;
+    nao.CoM_position[1] += 0.02;
+    nao.CoM_position[2] -= 0.01;
+
+    model = &nao;
+
+
+    threadResults reference;
+    solveAll (*model, reference);
+
+
+    pthread_t threads[NUM_THREADS];
+    for (int i = 0; i < NUM_THREADS; ++i)
+    {
+        if (pthread_create(&threads[i], NULL, run, &results[i]) != 0)
+        {
+            cout << "Cannot start a thread!" << endl;
+            return (1);
+        }
+    }
+    for (int i = 0; i < NUM_THREADS; ++i)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+
+    for (int i = 0; i < NUM_THREADS; ++i)
+    {
+        if ((memcmp(results[i].q, reference.q, sizeof(reference.q)) != 0)
+                || (memcmp(results[i].CoM, reference.CoM, sizeof(reference.CoM)) != 0)
+                || (memcmp(results[i].swing_foot, reference.swing_foot, sizeof(reference.swing_foot)) != 0)
+                || (memcmp(results[i].iter, reference.iter, sizeof(reference.iter)) != 0))
+        {
+            cout << "Results of thread " << i << " differ!" << endl;
+            result = 1;
+        }
+    }
+
+    for (int i = 0; i < NUM_GUESSES; ++i)
+    {
+        if (reference.iter[i] < 0)
+        {
+            cout << "Failed to solve from initial guess " << i << endl;
+            result = 1;
+        }
+    }
+
+    printf(" threads = %d, problems per thread = %d\n", NUM_THREADS, NUM_GUESSES * NUM_REPEATS);
+    if (result == 0)
+    {
+        cout << "Results are identical." << endl;
+    }
+
+    return (result);
+}
@@ -0,0 +1,164 @@
+// test_igm_timeline.cpp
+//
+// Record the timeline of igm() in the main thread and of forward
+// kinematics in another thread, write it in Chrome trace format and count
+// the events in the file. If the library is compiled without
+// IGM_TRACE_ENABLE no events must be recorded.
+
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+
+#include <pthread.h>
+
+#include "nao_igm.h"
+
+using namespace std;
+
+
+#define TIMELINE_FILE "test_igm_timeline.json"
+/// Exceeds the size of the buffer of a thread.
+#define NUM_FK_CALLS (IGM_TIMELINE_BUFFER_SIZE + 100)
+
+
+/**
+ * Count occurrences of an event in the file.
+ */
+int countEvents (const char *filename, const char *name)
+{
+    char pattern[128];
+    char line[512];
+    int count = 0;
+
+    snprintf(pattern, sizeof(pattern), "\"name\": \"%s\"", name);
+
+    FILE *file = fopen(filename, "r");
+    if (file == NULL)
+    {
+        return (-1);
+    }
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if (strstr(line, pattern) != NULL)
+        {
+            ++count;
+        }
+    }
+    fclose(file);
+
+    return (count);
+}
+
+
+/**
+ * Forward kinematics in another thread.
+ */
+void *computeCoM (void *arg)
+{
+    const igmModel &model = *((const igmModel *) arg);
+    jointState state;
+    double CoM[POSITION_VECTOR_SIZE];
+
+    for (int i = 0; i < NUM_FK_CALLS; ++i)
+    {
+        model.getCoM(state, CoM);
+    }
+    return (NULL);
+}
+
+
+int main(int argc, char** argv)
+{
+    nao_igm nao;
+    int result = 0;
+
+
+    // set the problem from test_igm_3_1
+    jointState q0;
+
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+    q0 = nao.state_model;
+
+    nao.getSwingFootPosture (nao.state_sensor, nao.left_foot_posture.data());
+    nao.left_foot_posture =
+        (nao.left_foot_posture) *
+        Translation<double,3>(-0.02,0.01,0.02) *
+        AngleAxisd(0.1, Vector3d::UnitX()) *
+        AngleAxisd(0.1, Vector3d::UnitY()) *
+        AngleAxisd(0.1, Vector3d::UnitZ());
+
+    nao.getCoM (nao.state_sensor, nao.CoM_position);
+    nao.CoM_position[0] += 0.03;
+    nao.CoM_position[1] += 0.02;
+    nao.CoM_position[2] -= 0.01;
+
+
+    // nothing is recorded when disabled
+    nao.igm(q0.q, 1.2, 0.0015, 20);
+
+    igmTimeline::enable(true);
+
+    nao.state_model = q0;
+    int iter = nao.igm(q0.q, 1.2, 0.0015, 20);
+    nao.switchSupportFoot();
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, computeCoM, &nao) != 0)
+    {
+        cout << "Cannot create a thread!" << endl;
+        return (1);
+    }
+    pthread_join(thread, NULL);
+
+    igmTimeline::enable(false);
+
+
+    igmTimelineWriter writer;
+    if (writer.open(TIMELINE_FILE) != 0)
+    {
+        cout << "Cannot open " << TIMELINE_FILE << "!" << endl;
+        return (1);
+    }
+    int num_written = writer.flush();
+    writer.close();
+
+    const int num_igm = countEvents(TIMELINE_FILE, "igm");
+    const int num_kernel = countEvents(TIMELINE_FILE, "from_RLeg_3");
+    const int num_kkt = countEvents(TIMELINE_FILE, "igmSolveKKT");
+    const int num_switch = countEvents(TIMELINE_FILE, "switchSupportFoot");
+    // the support foot is switched before starting the thread
+    const int num_CoM = countEvents(TIMELINE_FILE, "LLeg2CoM");
+    const unsigned int num_dropped = igmTimeline::getDropped();
+
+    printf(" iter = %d, written = %d, dropped = %u\n", iter, num_written, num_dropped);
+    printf(" igm = %d, from_RLeg_3 = %d, igmSolveKKT = %d, switchSupportFoot = %d, LLeg2CoM = %d\n",
+            num_igm, num_kernel, num_kkt, num_switch, num_CoM);
+
+
+#ifdef IGM_TRACE_ENABLE
+    // the events exceeding the buffer of the thread are dropped
+    if ((iter < 0)
+            || (num_igm != 1)
+            || (num_kernel != iter)
+            || (num_kkt != iter)
+            || (num_switch != 1)
+            || (num_CoM != IGM_TIMELINE_BUFFER_SIZE)
+            || (num_dropped != NUM_FK_CALLS - IGM_TIMELINE_BUFFER_SIZE)
+            || (num_written != 2 + 2*iter + IGM_TIMELINE_BUFFER_SIZE))
+    {
+        cout << "Unexpected events!" << endl;
+        result = 1;
+    }
+#else
+    if ((iter < 0) || (num_written != 0) || (num_igm != 0))
+    {
+        cout << "No events must be recorded!" << endl;
+        result = 1;
+    }
+#endif
+
+    return (result);
+}
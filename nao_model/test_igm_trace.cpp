@@ -0,0 +1,136 @@
+// test_igm_trace.cpp
+//
+// Check the instrumentation of the solver on the problem from test_igm_3_1:
+// the counters and the records of iterations of converging and failing
+// calls of igm(). If the library is compiled without IGM_TRACE_ENABLE the
+// trace must stay empty.
+
+#include <iostream>
+#include <stdio.h>
+
+#include "nao_igm.h"
+
+using namespace std;
+
+
+int main(int argc, char** argv)
+{
+    nao_igm nao;
+    int result = 0;
+
+
+    // set the problem from test_igm_3_1
+    jointState q0;
+
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+    q0 = nao.state_model;
+
+    nao.getSwingFootPosture (nao.state_sensor, nao.left_foot_posture.data());
+    nao.left_foot_posture =
+        (nao.left_foot_posture) *
+        Translation<double,3>(-0.02,0.01,0.02) *
+        AngleAxisd(0.1, Vector3d::UnitX()) *
+        AngleAxisd(0.1, Vector3d::UnitY()) *
+        AngleAxisd(0.1, Vector3d::UnitZ());
+
+    nao.getCoM (nao.state_sensor, nao.CoM_position);
+    nao.CoM_position[0] += 0.03;
+    nao.CoM_position[1] += 0.02;
+    nao.CoM_position[2] -= 0.01;
+
+
+    const double tol = 0.0015;
+    int iter = nao.igm(q0.q, 1.2, tol, 20);
+
+    // not enough iterations
+    nao.state_model = q0;
+    int iter_failed = nao.igm(q0.q, 1.2, tol, 2);
+
+
+    igmTraceSnapshot snapshot;
+    nao.trace.getSnapshot(snapshot);
+
+    printf(" calls = %u, iterations = %llu, failures = %u, max time = %e\n",
+            snapshot.calls, snapshot.iterations, snapshot.failures, snapshot.max_time);
+    for (int i = 0; i < snapshot.num_records; ++i)
+    {
+        const igmTraceRecord &r = snapshot.records[i];
+        printf(" call %u, iter %2d: norm_dq = %e, norm_err = %e, kernel = %e, solve = %e\n",
+                r.call, r.iter, r.norm_dq, r.norm_err, r.kernel_time, r.solve_time);
+    }
+
+
+#ifdef IGM_TRACE_ENABLE
+    // the failed call performs max_iter + 1 iterations
+    const int num_records = iter + 3;
+    if ((iter < 0)
+            || (iter_failed >= 0)
+            || (snapshot.calls != 2)
+            || (snapshot.failures != 1)
+            || (snapshot.iterations != (unsigned long long) num_records)
+            || (snapshot.num_records != num_records)
+            || (snapshot.max_time <= 0.0)
+            || (snapshot.max_time > snapshot.total_time))
+    {
+        cout << "Unexpected counters!" << endl;
+        result = 1;
+    }
+    else
+    {
+        for (int i = 0; i < num_records; ++i)
+        {
+            const igmTraceRecord &r = snapshot.records[i];
+            unsigned int call = (i < iter) ? 0 : 1;
+            int index = (i < iter) ? i : i - iter;
+
+            if ((r.call != call) || (r.iter != index) || (r.kernel_time < 0.0) || (r.solve_time < 0.0))
+            {
+                cout << "Unexpected record " << i << "!" << endl;
+                result = 1;
+            }
+        }
+        // the first call converged
+        if (snapshot.records[iter - 1].norm_dq > tol)
+        {
+            cout << "Unexpected norm of the step!" << endl;
+            result = 1;
+        }
+    }
+
+
+    // the ring buffer keeps the most recent iterations
+    for (int i = 0; i < IGM_TRACE_SIZE; ++i)
+    {
+        nao.state_model = q0;
+        nao.igm(q0.q, 1.2, tol, 20);
+    }
+    nao.trace.getSnapshot(snapshot);
+    const igmTraceRecord &last = snapshot.records[IGM_TRACE_SIZE - 1];
+    if ((snapshot.num_records != IGM_TRACE_SIZE)
+            || (last.call != IGM_TRACE_SIZE + 1)
+            || (last.iter != iter - 1))
+    {
+        cout << "Unexpected contents of the ring buffer!" << endl;
+        result = 1;
+    }
+
+    nao.trace.reset();
+    nao.trace.getSnapshot(snapshot);
+    if ((snapshot.calls != 0) || (snapshot.num_records != 0))
+    {
+        cout << "The trace is not reset!" << endl;
+        result = 1;
+    }
+#else
+    if ((iter < 0) || (iter_failed >= 0) || (snapshot.calls != 0) || (snapshot.num_records != 0))
+    {
+        cout << "The trace must be empty!" << endl;
+        result = 1;
+    }
+#endif
+
+    return (result);
+}
@@ -0,0 +1,172 @@
+// test_igm_track.cpp
+//
+// Solve the IGM on each control tick of the standard gait (igmGait) with
+// different initial guesses: the previous solution, linear and quadratic
+// extrapolation of the previous solutions. Histograms of the number of
+// iterations are reported. Also check that the predictor handles repeated
+// and decreasing times.
+
+#include <iostream>
+#include <stdio.h>
+#include <math.h>
+
+#include <sys/time.h>
+#include <time.h>
+
+#include "nao_igm.h"
+
+using namespace std;
+
+
+#define MAX_ITER 20
+
+
+double getTime(struct timeval &start, struct timeval &end)
+{
+    return (end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec));
+}
+
+
+/**
+ * Walk the standard gait (see igmGait) starting from the configuration q0.
+ * hist[i] is the number of ticks, on which i iterations were performed,
+ * hist[MAX_ITER+1] is the number of failures.
+ */
+double walk (const jointState &q0, const int order, int *hist)
+{
+    const double dt = 0.01;
+
+    struct timeval start, end;
+    nao_igm nao;
+    igmGait gait;
+
+    nao.state_sensor = q0;
+    gait.init (nao);
+    nao.predictor.order = order;
+
+    for (int i = 0; i <= MAX_ITER + 1; ++i)
+    {
+        hist[i] = 0;
+    }
+
+
+    double time = 0.0;
+    int num_ticks = 0;
+    gettimeofday(&start,0);
+    while (gait.next(nao))
+    {
+        time += dt;
+        ++num_ticks;
+
+        int iter = nao.igmTrack(time, q0.q, 1.2, 0.0015, MAX_ITER);
+        if (iter < 0)
+        {
+            ++hist[MAX_ITER + 1];
+        }
+        else
+        {
+            ++hist[iter];
+        }
+    }
+    gettimeofday(&end,0);
+
+    return (getTime(start, end) / num_ticks);
+}
+
+
+/**
+ * Check extrapolation of solutions stored with repeated and decreasing
+ * times: the predictions must be finite and exact for a linear motion.
+ */
+int checkPredictor ()
+{
+    igmPredictor predictor;
+    double q[JOINTS_NUM] = {0.0};
+    double q_pred[JOINTS_NUM];
+    const double times[] = {0.01, 0.02, 0.02, 0.03, 0.03, 0.01, 0.01};
+    const int num_times = sizeof(times) / sizeof(times[0]);
+    // only one solution is stored, it is returned by all orders
+    bool single = true;
+    int result = 0;
+
+    for (int i = 0; i < num_times; ++i)
+    {
+        q[0] = times[i];
+        predictor.add(times[i], q);
+        if (i > 0)
+        {
+            single = (times[i] < times[i-1]) || (single && (times[i] == times[i-1]));
+        }
+
+        for (int order = 0; order < 3; ++order)
+        {
+            predictor.order = order;
+            predictor.predict(times[i] + 0.01, q_pred);
+
+            const double expected = ((order == 0) || single) ? times[i] : times[i] + 0.01;
+            if (!(fabs(q_pred[0] - expected) < 1e-12))
+            {
+                printf(" predictor: t = %f, order = %d, q = %e, expected = %e\n",
+                        times[i], order, q_pred[0], expected);
+                result = 1;
+            }
+        }
+    }
+
+    return (result);
+}
+
+
+int main(int argc, char** argv)
+{
+    const char *names[] = {"previous", "linear", "quadratic"};
+    int hist[3][MAX_ITER + 2];
+    int result = 0;
+
+    jointState q0;
+
+
+    if (checkPredictor() != 0)
+    {
+        cout << "Prediction failed with repeated times!" << endl;
+        result = 1;
+    }
+
+    for (int order = 0; order < 3; ++order)
+    {
+        double tick_time = walk (q0, order, hist[order]);
+        printf(" time (igmTrack, %s) = % f\n", names[order], tick_time);
+
+        if (hist[order][MAX_ITER + 1] > 0)
+        {
+            result = 1;
+        }
+    }
+
+
+    cout << "iterations: previous linear quadratic" << endl;
+    for (int i = 0; i <= MAX_ITER + 1; ++i)
+    {
+        if ((hist[0][i] == 0) && (hist[1][i] == 0) && (hist[2][i] == 0))
+        {
+            continue;
+        }
+
+        if (i > MAX_ITER)
+        {
+            printf("%10s", "failed");
+        }
+        else
+        {
+            printf("%10d", i);
+        }
+        printf(" %8d %6d %9d\n", hist[0][i], hist[1][i], hist[2][i]);
+    }
+
+    if (result != 0)
+    {
+        cout << "IGM failed on some ticks!" << endl;
+    }
+
+    return (result);
+}
@@ -0,0 +1,272 @@
+// test_igm_trig.cpp
+//
+// Accuracy and timing of incremental updates of sine and cosine of joint
+// angles (igmOptions::incremental_trig), the solutions are also compared
+// along the standard gait (igmGait).
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <sys/time.h>
+#include <time.h>
+
+#include "nao_igm.h"
+#include "maple_functions.h"
+
+using namespace std;
+
+
+#define A_SIZE 130
+
+
+double getTime(struct timeval &start, struct timeval &end)
+{
+    return (end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec));
+}
+
+
+double randomNumber(const double max_abs)
+{
+    return (max_abs * (2.0*rand()/RAND_MAX - 1.0));
+}
+
+
+int main(int argc, char** argv)
+{
+    struct timeval start, end;
+    int result = 0;
+
+    srand(1);
+
+
+    // accuracy of sine and cosine along random walks of joint angles
+    const int walk_N = 100000;
+    const int refresh_period[] = {16, walk_N};
+    double max_trig_error[2];
+
+    for (int k = 0; k < 2; ++k)
+    {
+        jointState state;
+        state.trig.update(state.q);
+        max_trig_error[k] = 0.0;
+
+        for (int i = 0; i < walk_N; ++i)
+        {
+            for (int j = 0; j < LOWER_JOINTS_NUM; ++j)
+            {
+                state.q[j] += randomNumber(1.1*IGM_TRIG_INCREMENT_MAX);
+            }
+            state.trig.updateIncremental(state.q, refresh_period[k]);
+
+            for (int j = 0; j < JOINTS_NUM; ++j)
+            {
+                double error = fabs(state.trig.sin_q[j] - sin(state.q[j]))
+                             + fabs(state.trig.cos_q[j] - cos(state.q[j]));
+                if (!(error <= max_trig_error[k]))
+                {
+                    max_trig_error[k] = error;
+                }
+            }
+        }
+        cout << "max error of sin/cos, refresh period " << refresh_period[k]
+             << " = " << max_trig_error[k] << endl;
+    }
+
+
+    // accuracy of the generated function with incrementally updated sin/cos
+    nao_igm nao;
+    jointState q0;
+
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+    q0 = nao.state_model;
+    nao.getSwingFootPosture (nao.state_sensor, nao.left_foot_posture.data());
+    nao.getCoM (nao.state_sensor, nao.CoM_position);
+
+    double max_kernel_error = 0.0;
+    {
+        jointState state = q0;
+        double A_exact[A_SIZE];
+        double A_incremental[A_SIZE];
+
+        for (int i = 0; i < walk_N/10; ++i)
+        {
+            for (int j = 0; j < LOWER_JOINTS_NUM; ++j)
+            {
+                state.q[j] = q0.q[j] + 0.5*sin(0.01*i + j) + randomNumber(0.01);
+            }
+            state.trig.updateIncremental(state.q, refresh_period[0]);
+
+            from_RLeg_3 (state.q, nao.right_foot_posture.data(), nao.left_foot_posture.data(),
+                    nao.CoM_position, A_exact);
+            from_RLeg_3_trig (state.trig.sin_q, state.trig.cos_q,
+                    nao.right_foot_posture.data(), nao.left_foot_posture.data(),
+                    nao.CoM_position, A_incremental);
+
+            for (int j = 0; j < A_SIZE; ++j)
+            {
+                double error = fabs(A_exact[j] - A_incremental[j]) / (1.0 + fabs(A_exact[j]));
+                if (!(error <= max_kernel_error))
+                {
+                    max_kernel_error = error;
+                }
+            }
+        }
+    }
+    cout << "max relative error of from_RLeg_3 = " << max_kernel_error << endl;
+
+
+    // time of trigonometric updates for the leg joints
+    const int update_N = 1000000;
+    double trig_time[2];
+    for (int k = 0; k < 2; ++k)
+    {
+        jointState state;
+        state.trig.update(state.q);
+
+        gettimeofday(&start,0);
+        for (int i = 0; i < update_N; ++i)
+        {
+            double d = (i % 2 == 0) ? 0.001 : -0.001;
+            for (int j = 0; j < LOWER_JOINTS_NUM; ++j)
+            {
+                state.q[j] += d;
+            }
+            if (k == 0)
+            {
+                state.trig.update(state.q);
+            }
+            else
+            {
+                state.trig.updateIncremental(state.q, refresh_period[0]);
+            }
+        }
+        gettimeofday(&end,0);
+        trig_time[k] = getTime(start, end) / update_N;
+    }
+    printf(" time (trig update, exact)       = % e\n", trig_time[0]);
+    printf(" time (trig update, incremental) = % e\n", trig_time[1]);
+    printf(" speedup (trig update) = %.2f\n", trig_time[0] / trig_time[1]);
+
+
+    // solver: the targets are spread around the target in test_igm_3_1
+    const int target_N = 1000;
+    const int test_N = 10;
+    double q_exact[target_N][LOWER_JOINTS_NUM];
+    int iter_exact[target_N];
+    double iter_time[2];
+    double max_q_diff = 0.0;
+    int num_iter_diff = 0;
+
+    Transform<double,3> swing_foot_posture = nao.left_foot_posture;
+    double CoM_position[POSITION_VECTOR_SIZE];
+    memcpy(CoM_position, nao.CoM_position, sizeof(CoM_position));
+
+    for (int k = 0; k < 2; ++k)
+    {
+        nao.options.incremental_trig = (k == 1);
+        int num_iter = 0;
+
+        gettimeofday(&start,0);
+        for (int l = 0; l < test_N; ++l)
+        {
+            for (int i = 0; i < target_N; ++i)
+            {
+                double a = (double) i / target_N;
+
+                nao.left_foot_posture =
+                    swing_foot_posture *
+                    Translation<double,3>(-0.02*a, 0.01*a, 0.02*a) *
+                    AngleAxisd(0.1*a, Vector3d::UnitX()) *
+                    AngleAxisd(0.1*a, Vector3d::UnitY()) *
+                    AngleAxisd(0.1*a, Vector3d::UnitZ());
+                nao.setCoM (CoM_position[0] + 0.03*a, CoM_position[1] + 0.02*a, CoM_position[2] - 0.01*a);
+
+                nao.state_model = q0;
+                int iter = nao.igm(q0.q, 1.2, 0.0015, 20);
+                num_iter += iter;
+
+                if (k == 0)
+                {
+                    memcpy(q_exact[i], nao.state_model.q, sizeof(q_exact[i]));
+                    iter_exact[i] = iter;
+                }
+                else if (l == 0)
+                {
+                    for (int j = 0; j < LOWER_JOINTS_NUM; ++j)
+                    {
+                        double diff = fabs(q_exact[i][j] - nao.state_model.q[j]);
+                        if (!(diff <= max_q_diff))
+                        {
+                            max_q_diff = diff;
+                        }
+                    }
+                    if (iter_exact[i] != iter)
+                    {
+                        ++num_iter_diff;
+                    }
+                }
+            }
+        }
+        gettimeofday(&end,0);
+        iter_time[k] = getTime(start, end) / num_iter;
+    }
+    printf(" time per iteration (igm, exact trig)       = % e\n", iter_time[0]);
+    printf(" time per iteration (igm, incremental trig) = % e\n", iter_time[1]);
+    printf(" speedup (iteration of igm) = %.3f\n", iter_time[0] / iter_time[1]);
+    cout << "max difference of solutions = " << max_q_diff
+         << ", different iteration counts = " << num_iter_diff << endl;
+
+
+    // the standard gait: on each tick both modes start from the solution
+    // obtained with exact sine and cosine on the previous tick
+    igmGait gait;
+    int num_ticks = 0;
+    int num_gait_iter_diff = 0;
+
+    gait.init(nao);
+    while (gait.next(nao))
+    {
+        const jointState q_prev = nao.state_model;
+        ++num_ticks;
+
+        nao.options.incremental_trig = false;
+        int iter = nao.igm(q0.q, 1.2, 0.0015, 20);
+        const jointState q_gait_exact = nao.state_model;
+
+        nao.options.incremental_trig = true;
+        nao.state_model = q_prev;
+        if (iter != nao.igm(q0.q, 1.2, 0.0015, 20))
+        {
+            ++num_gait_iter_diff;
+        }
+
+        for (int j = 0; j < LOWER_JOINTS_NUM; ++j)
+        {
+            double diff = fabs(q_gait_exact.q[j] - nao.state_model.q[j]);
+            if (!(diff <= max_q_diff))
+            {
+                max_q_diff = diff;
+            }
+        }
+        nao.state_model = q_gait_exact;
+    }
+    nao.options.incremental_trig = false;
+    cout << "gait: ticks = " << num_ticks
+         << ", max difference of solutions = " << max_q_diff
+         << ", different iteration counts = " << num_gait_iter_diff << endl;
+
+
+    if (!(max_trig_error[0] <= 1e-13) || !(max_kernel_error <= 1e-12) || !(max_q_diff <= 1e-10))
+    {
+        cout << "Incremental updates are not accurate!" << endl;
+        result = 1;
+    }
+
+    return (result);
+}
@@ -0,0 +1,138 @@
+// test_kkt.cpp
+//
+// Compare the unrolled solution of the KKT system (igmStep()) in the full
+// and reduced spaces with the Eigen version (igmStepEigen()) and measure
+// time per iteration.
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <sys/time.h>
+#include <time.h>
+
+#include "nao_igm.h"
+#include "maple_functions.h"
+#include "igm_solver.h"
+
+using namespace std;
+
+
+double getTime(struct timeval &start, struct timeval &end)
+{
+    return (end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec));
+}
+
+
+int main(int argc, char** argv)
+{
+    struct timeval start, end;
+    const int conf_N = 1000;
+    const int test_N = 100;
+    const double mu = 1.2;
+
+    nao_igm nao;
+    jointState q0;
+
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+    nao.getSwingFootPosture (nao.state_sensor, nao.left_foot_posture.data());
+    nao.getCoM (nao.state_sensor, nao.CoM_position);
+
+
+    // random configurations, half of them with the left support foot
+    double *q = new double[JOINTS_NUM*conf_N];
+    double *q_unrolled = new double[JOINTS_NUM*conf_N];
+    double *q_eigen = new double[JOINTS_NUM*conf_N];
+    double *out = new double[IGM_KERNEL_OUTPUT_SIZE*conf_N];
+
+    srand(1);
+    for (int i = 0; i < conf_N; ++i)
+    {
+        for (int j = 0; j < JOINTS_NUM; ++j)
+        {
+            q[i*JOINTS_NUM + j] = q0.q[j] + 0.5 * (2.0*rand()/RAND_MAX - 1.0);
+        }
+
+        if (i % 2 == 0)
+        {
+            from_RLeg_3 (q + i*JOINTS_NUM, nao.right_foot_posture.data(), nao.left_foot_posture.data(),
+                    nao.CoM_position, out + i*IGM_KERNEL_OUTPUT_SIZE);
+        }
+        else
+        {
+            from_LLeg_3 (q + i*JOINTS_NUM, nao.left_foot_posture.data(), nao.right_foot_posture.data(),
+                    nao.CoM_position, out + i*IGM_KERNEL_OUTPUT_SIZE);
+        }
+    }
+
+
+    // Eigen
+    gettimeofday(&start,0);
+    for (int k = 0; k < test_N; ++k)
+    {
+        memcpy(q_eigen, q, JOINTS_NUM*conf_N*sizeof(double));
+        for (int i = 0; i < conf_N; ++i)
+        {
+            igmStepEigen (out + i*IGM_KERNEL_OUTPUT_SIZE, q0.q, mu, q_eigen + i*JOINTS_NUM);
+        }
+    }
+    gettimeofday(&end,0);
+    printf(" time (igmStepEigen) = % e\n", getTime(start, end) / (test_N*conf_N));
+
+
+    // unrolled, full and reduced
+    const char *names[] = {"full", "reduced"};
+    double max_diff[2];
+    for (int r = 0; r < 2; ++r)
+    {
+        igmOptions options;
+        options.reduced_kkt = (r == 1);
+
+        gettimeofday(&start,0);
+        for (int k = 0; k < test_N; ++k)
+        {
+            memcpy(q_unrolled, q, JOINTS_NUM*conf_N*sizeof(double));
+            for (int i = 0; i < conf_N; ++i)
+            {
+                igmStep (options, out + i*IGM_KERNEL_OUTPUT_SIZE, q0.q, mu, q_unrolled + i*JOINTS_NUM);
+            }
+        }
+        gettimeofday(&end,0);
+        printf(" time (igmStep, unrolled, %s) = % e\n", names[r], getTime(start, end) / (test_N*conf_N));
+
+
+        // relative difference of the changes of angles
+        max_diff[r] = 0.0;
+        for (int i = 0; i < conf_N; ++i)
+        {
+            for (int j = 0; j < LOWER_JOINTS_NUM; ++j)
+            {
+                double dq_eigen = q_eigen[i*JOINTS_NUM + j] - q[i*JOINTS_NUM + j];
+                double diff = fabs(q_unrolled[i*JOINTS_NUM + j] - q_eigen[i*JOINTS_NUM + j]) / (1.0 + fabs(dq_eigen));
+                if (!(diff <= max_diff[r]))
+                {
+                    max_diff[r] = diff;
+                }
+            }
+        }
+        cout << "max relative difference (" << names[r] << ") = " << max_diff[r] << endl;
+    }
+
+
+    delete [] q;
+    delete [] q_unrolled;
+    delete [] q_eigen;
+    delete [] out;
+
+    if ((max_diff[0] > 1e-12) || (max_diff[1] > 1e-12))
+    {
+        cout << "Unrolled and Eigen results differ!" << endl;
+        return (1);
+    }
+    return (0);
+}
@@ -0,0 +1,153 @@
+// test_leg2joints_select.cpp
+//
+// Compare the frames computed by LLeg2Joints_select() / RLeg2Joints_select()
+// with the frames computed by LLeg2Joints() / RLeg2Joints(), and measure the
+// time of computing all frames and a few subsets of frames.
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sys/time.h>
+#include <time.h>
+
+#include "nao_igm.h"
+#include "leg2joints.h"
+
+using namespace std;
+
+
+#define NUM_CONFIGURATIONS 1000
+#define NUM_REPETITIONS 10
+
+
+double getTime(struct timeval &start, struct timeval &end)
+{
+    return (end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec));
+}
+
+
+/**
+ * Check the selected frames, returns the number of differences.
+ */
+int compare (const double *A, const double *A_select, const unsigned int frames)
+{
+    int num_errors = 0;
+
+    for (int id = 0; id < LEG2JOINTS_FRAMES_NUM; ++id)
+    {
+        if ((frames & LEG2JOINTS_FRAME(id)) == 0)
+        {
+            continue;
+        }
+
+        int size = (id == LEG2JOINTS_COM) ? POSITION_VECTOR_SIZE : 16;
+        if (memcmp(A + 16*id, A_select + 16*id, size * sizeof(double)) != 0)
+        {
+            ++num_errors;
+        }
+    }
+    return (num_errors);
+}
+
+
+int main(int argc, char** argv)
+{
+    nao_igm nao;
+    struct timeval start, end;
+    int num_errors = 0;
+
+    jointState *states = new jointState[NUM_CONFIGURATIONS];
+    double A[LEG2JOINTS_OUTPUT_SIZE];
+    double A_select[LEG2JOINTS_OUTPUT_SIZE];
+
+
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+    double *LL = nao.left_foot_posture.data();
+    double *RL = nao.right_foot_posture.data();
+
+
+    srand(1);
+    for (int i = 0; i < NUM_CONFIGURATIONS; ++i)
+    {
+        for (int j = 0; j < JOINTS_NUM; ++j)
+        {
+            states[i].q[j] = jointState::q_lower_bound[j] +
+                (jointState::q_upper_bound[j] - jointState::q_lower_bound[j]) * rand() / RAND_MAX;
+        }
+        states[i].trig.update(states[i].q);
+    }
+
+
+    // single frames and random subsets
+    for (int i = 0; i < NUM_CONFIGURATIONS; ++i)
+    {
+        jointState &s = states[i];
+        unsigned int frames =
+            (i < LEG2JOINTS_FRAMES_NUM) ? LEG2JOINTS_FRAME(i) : (rand() & LEG2JOINTS_ALL_FRAMES);
+
+        LLeg2Joints(s.q, LL, A);
+        LLeg2Joints_select(s.q, LL, frames, A_select);
+        num_errors += compare(A, A_select, frames);
+        LLeg2Joints_select_trig(s.trig.sin_q, s.trig.cos_q, LL, frames, A_select);
+        num_errors += compare(A, A_select, frames);
+
+        RLeg2Joints(s.q, RL, A);
+        RLeg2Joints_select(s.q, RL, frames, A_select);
+        num_errors += compare(A, A_select, frames);
+        RLeg2Joints_select_trig(s.trig.sin_q, s.trig.cos_q, RL, frames, A_select);
+        num_errors += compare(A, A_select, frames);
+    }
+    printf(" errors = %d\n", num_errors);
+
+
+    // timing
+    const int test_N = NUM_CONFIGURATIONS * NUM_REPETITIONS;
+    const char *names[] = {"all frames", "torso", "right ankle", "lower body", NULL};
+    const unsigned int subsets[] = {
+        LEG2JOINTS_ALL_FRAMES,
+        LEG2JOINTS_FRAME(LEG2JOINTS_TORSO),
+        LEG2JOINTS_FRAME(R_ANKLE_ROLL),
+        LEG2JOINTS_FRAME(LEG2JOINTS_TORSO)
+            | LEG2JOINTS_FRAME(LEG2JOINTS_LEFT_FOOT)
+            | LEG2JOINTS_FRAME(LEG2JOINTS_RIGHT_FOOT)
+            | LEG2JOINTS_FRAME(LEG2JOINTS_COM)};
+
+    gettimeofday(&start,0);
+    for (int k = 0; k < NUM_REPETITIONS; ++k)
+    {
+        for (int i = 0; i < NUM_CONFIGURATIONS; ++i)
+        {
+            LLeg2Joints_trig(states[i].trig.sin_q, states[i].trig.cos_q, LL, A);
+        }
+    }
+    gettimeofday(&end,0);
+    printf(" time (LLeg2Joints_trig) = %e\n", getTime(start, end)/test_N);
+
+    for (int j = 0; names[j] != NULL; ++j)
+    {
+        gettimeofday(&start,0);
+        for (int k = 0; k < NUM_REPETITIONS; ++k)
+        {
+            for (int i = 0; i < NUM_CONFIGURATIONS; ++i)
+            {
+                LLeg2Joints_select_trig(states[i].trig.sin_q, states[i].trig.cos_q, LL, subsets[j], A);
+            }
+        }
+        gettimeofday(&end,0);
+        printf(" time (LLeg2Joints_select_trig, %s) = %e\n", names[j], getTime(start, end)/test_N);
+    }
+
+    delete [] states;
+
+    if (num_errors != 0)
+    {
+        cout << "Selected frames differ!" << endl;
+        return (1);
+    }
+    return (0);
+}
@@ -0,0 +1,332 @@
+// test_no_alloc.cpp
+//
+// Check that the real-time interface does not allocate memory: malloc(),
+// free(), operator new / delete and friends are interposed and counted
+// while init(), igm() in all modes of the solver, forward kinematics, etc.
+// are called. Starting and stopping of threads is not checked.
+//
+// The interposition relies on glibc (__libc_malloc() and friends). If the
+// library is compiled with IGM_TRACE_ENABLE the timeline is recorded during
+// the checks, since the hooks must not allocate either.
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <malloc.h>
+#include <new>
+
+#include "nao_igm.h"
+
+using namespace std;
+
+
+extern "C" void *__libc_malloc (size_t);
+extern "C" void *__libc_calloc (size_t, size_t);
+extern "C" void *__libc_realloc (void *, size_t);
+extern "C" void *__libc_memalign (size_t, size_t);
+extern "C" void __libc_free (void *);
+
+
+/// Nonzero while the allocations are counted.
+static int alloc_check = 0;
+/// The number of allocations and deallocations while alloc_check is set.
+static int num_allocations = 0;
+
+
+static void countAllocation ()
+{
+    if (__atomic_load_n (&alloc_check, __ATOMIC_RELAXED) != 0)
+    {
+        __atomic_add_fetch (&num_allocations, 1, __ATOMIC_RELAXED);
+    }
+}
+
+
+extern "C" void *malloc (size_t size)
+{
+    countAllocation();
+    return (__libc_malloc(size));
+}
+
+extern "C" void *calloc (size_t num, size_t size)
+{
+    countAllocation();
+    return (__libc_calloc(num, size));
+}
+
+extern "C" void *realloc (void *ptr, size_t size)
+{
+    countAllocation();
+    return (__libc_realloc(ptr, size));
+}
+
+extern "C" void *memalign (size_t alignment, size_t size)
+{
+    countAllocation();
+    return (__libc_memalign(alignment, size));
+}
+
+extern "C" void *aligned_alloc (size_t alignment, size_t size)
+{
+    countAllocation();
+    return (__libc_memalign(alignment, size));
+}
+
+extern "C" int posix_memalign (void **ptr, size_t alignment, size_t size)
+{
+    countAllocation();
+    *ptr = __libc_memalign(alignment, size);
+    return ((*ptr == NULL) ? ENOMEM : 0);
+}
+
+extern "C" void free (void *ptr)
+{
+    if (ptr != NULL)
+    {
+        countAllocation();
+    }
+    __libc_free(ptr);
+}
+
+
+void *operator new (size_t size)
+{
+    countAllocation();
+    void *ptr = __libc_malloc(size);
+    if (ptr == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    return (ptr);
+}
+
+void *operator new[] (size_t size)
+{
+    return (operator new(size));
+}
+
+void operator delete (void *ptr) throw()
+{
+    free(ptr);
+}
+
+void operator delete[] (void *ptr) throw()
+{
+    free(ptr);
+}
+
+void operator delete (void *ptr, size_t) throw()
+{
+    free(ptr);
+}
+
+void operator delete[] (void *ptr, size_t) throw()
+{
+    free(ptr);
+}
+
+
+
+/**
+ * Call 'code' with counting of allocations, 'result' is set to 1 if memory
+ * is allocated.
+ */
+#define CHECK_NO_ALLOC(name, code) \
+    { \
+        num_allocations = 0; \
+        __atomic_store_n (&alloc_check, 1, __ATOMIC_SEQ_CST); \
+        code; \
+        __atomic_store_n (&alloc_check, 0, __ATOMIC_SEQ_CST); \
+        printf(" %-40s allocations = %d\n", name, num_allocations); \
+        if (num_allocations != 0) \
+        { \
+            result = 1; \
+        } \
+    }
+
+
+#define NUM_PROBLEMS 4
+
+
+int main(int argc, char** argv)
+{
+    nao_igm nao;
+    int result = 0;
+
+    double ref_angles[LOWER_JOINTS_NUM];
+    double CoM[POSITION_VECTOR_SIZE];
+    double swing_foot_posture[16];
+    double feet[4][POSITION_VECTOR_SIZE];
+    jointState state;
+    jointState q0;
+    int iter = 0;
+
+#ifdef IGM_TRACE_ENABLE
+    igmTimeline::enable(true);
+#endif
+
+    // the problem from test_igm_3_1
+    CHECK_NO_ALLOC("init", nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0));
+    q0 = nao.state_model;
+    memcpy(ref_angles, q0.q, sizeof(ref_angles));
+
+    nao.getSwingFootPosture (nao.state_sensor, nao.left_foot_posture.data());
+    nao.left_foot_posture =
+        (nao.left_foot_posture) *
+        Translation<double,3>(-0.02,0.01,0.02) *
+        AngleAxisd(0.1, Vector3d::UnitX()) *
+        AngleAxisd(0.1, Vector3d::UnitY()) *
+        AngleAxisd(0.1, Vector3d::UnitZ());
+
+    nao.getCoM (nao.state_sensor, nao.CoM_position);
+    nao.CoM_position[0] += 0.03;
+    nao.CoM_position[1] += 0.02;
+    nao.CoM_position[2] -= 0.01;
+
+
+    // forward kinematics
+    CHECK_NO_ALLOC("getCoM", nao.getCoM(nao.state_sensor, CoM));
+    CHECK_NO_ALLOC("getSwingFootPosture", nao.getSwingFootPosture(nao.state_sensor, swing_foot_posture));
+    CHECK_NO_ALLOC("getSwingFootPostureCoM", nao.getSwingFootPostureCoM(nao.state_model, swing_foot_posture, CoM));
+    CHECK_NO_ALLOC("getFeetPositions", nao.getFeetPositions(feet[0], feet[1], feet[2], feet[3]));
+    CHECK_NO_ALLOC("readSensors", nao.readSensors());
+    CHECK_NO_ALLOC("sensor_mailbox.write", nao.sensor_mailbox.write(q0.q));
+
+
+    // modes of the solver
+    const igmOptions default_options = nao.options;
+    for (int mode = 0; mode < 9; ++mode)
+    {
+        const char *names[] = {
+            "igm (default)",
+            "igm (incremental_trig)",
+            "igm (IGM_JACOBIAN_CHORD)",
+            "igm (IGM_JACOBIAN_BROYDEN, residual_tol)",
+            "igm (reduced_kkt)",
+            "igm (IGM_PRECISION_FLOAT)",
+            "igm (IGM_PRECISION_MIXED)",
+            "igm (flush_denormals)",
+            "igmTrack"};
+
+        nao.options = default_options;
+        switch (mode)
+        {
+            case 1:
+                nao.options.incremental_trig = true;
+                break;
+            case 2:
+                nao.options.jacobian_update = IGM_JACOBIAN_CHORD;
+                break;
+            case 3:
+                nao.options.jacobian_update = IGM_JACOBIAN_BROYDEN;
+                nao.options.residual_tol = 1e-6;
+                break;
+            case 4:
+                nao.options.reduced_kkt = true;
+                break;
+            case 5:
+                nao.options.precision = IGM_PRECISION_FLOAT;
+                break;
+            case 6:
+                nao.options.precision = IGM_PRECISION_MIXED;
+                break;
+            case 7:
+                nao.options.flush_denormals = true;
+                break;
+            default:
+                break;
+        }
+
+        nao.state_model = q0;
+        if (mode < 8)
+        {
+            CHECK_NO_ALLOC(names[mode], iter = nao.igm(ref_angles, 1.2, 0.0015, 20));
+        }
+        else
+        {
+            CHECK_NO_ALLOC(names[mode], iter = nao.igmTrack(0.01 * mode, ref_angles, 1.2, 0.0015, 20));
+        }
+        if (iter < 0)
+        {
+            cout << "The solver failed!" << endl;
+            result = 1;
+        }
+    }
+    nao.options = default_options;
+
+    int deadline_iter;
+    nao.state_model = q0;
+    CHECK_NO_ALLOC("igmDeadline", nao.igmDeadline(ref_angles, 1.2, 0.0015, 1e-3, deadline_iter));
+
+    state = q0;
+    const igmModel &model = nao;
+    CHECK_NO_ALLOC("igmModel::solve", iter = model.solve(state, ref_angles, 1.2, 0.0015, 20));
+    CHECK_NO_ALLOC("switchSupportFoot", nao.switchSupportFoot());
+    nao.switchSupportFoot();
+
+
+    // the speculative solver, the thread is started before checking
+    if (nao.startSpeculation() == 0)
+    {
+        nao.state_model = q0;
+        CHECK_NO_ALLOC("igmSpeculative", iter = nao.igmSpeculative(ref_angles, 1.2, 0.0015, 20));
+        nao.stopSpeculation();
+    }
+
+
+    // batches
+    igmSupportFoot support_foot[NUM_PROBLEMS];
+    double support_foot_postures[NUM_PROBLEMS][16];
+    double swing_foot_postures[NUM_PROBLEMS][16];
+    double CoM_positions[NUM_PROBLEMS][POSITION_VECTOR_SIZE];
+    double refs[NUM_PROBLEMS][LOWER_JOINTS_NUM];
+    double q[NUM_PROBLEMS][JOINTS_NUM];
+    int iters[NUM_PROBLEMS];
+
+    for (int i = 0; i < NUM_PROBLEMS; ++i)
+    {
+        support_foot[i] = IGM_SUPPORT_RIGHT;
+        memcpy(support_foot_postures[i], nao.right_foot_posture.data(), sizeof(support_foot_postures[i]));
+        memcpy(swing_foot_postures[i], nao.left_foot_posture.data(), sizeof(swing_foot_postures[i]));
+        memcpy(CoM_positions[i], nao.CoM_position, sizeof(CoM_positions[i]));
+        memcpy(refs[i], ref_angles, sizeof(refs[i]));
+        memcpy(q[i], q0.q, sizeof(q[i]));
+    }
+
+    igmBatch batches[2];
+    for (int i = 0; i < 2; ++i)
+    {
+        batches[i].size = NUM_PROBLEMS / 2;
+        batches[i].support_foot = support_foot + i*NUM_PROBLEMS/2;
+        batches[i].support_foot_posture = support_foot_postures[i*NUM_PROBLEMS/2];
+        batches[i].swing_foot_posture = swing_foot_postures[i*NUM_PROBLEMS/2];
+        batches[i].CoM_position = CoM_positions[i*NUM_PROBLEMS/2];
+        batches[i].ref_angles = refs[i*NUM_PROBLEMS/2];
+        batches[i].q = q[i*NUM_PROBLEMS/2];
+        batches[i].iter = iters + i*NUM_PROBLEMS/2;
+    }
+
+    CHECK_NO_ALLOC("igmBatch::solve", batches[0].solve(1.2, 0.0015, 20));
+    batches[0].vectorize = false;
+    CHECK_NO_ALLOC("igmBatch::solve (not vectorized)", batches[0].solve(1.2, 0.0015, 20));
+
+    igmPool pool;
+    if (pool.start(2) == 0)
+    {
+        CHECK_NO_ALLOC("igmPool::solve", pool.solve(batches, 2, 1.2, 0.0015, 20));
+        pool.stop();
+    }
+
+
+    if (result != 0)
+    {
+        cout << "Memory is allocated!" << endl;
+    }
+
+    return (result);
+}
@@ -0,0 +1,135 @@
+// test_residual.cpp
+//
+// Compare the cost of residual-only versions of from_LLeg_3() / from_RLeg_3()
+// with the full functions and with the forward kinematics. Solve the
+// problem from test_igm_3_1 with and without residual checks.
+
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+
+#include <sys/time.h>
+#include <time.h>
+
+#include "nao_igm.h"
+#include "maple_functions.h"
+#include "igm_solver.h"
+
+using namespace std;
+
+
+double getTime(struct timeval &start, struct timeval &end)
+{
+    return (end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec));
+}
+
+
+int main(int argc, char** argv)
+{
+    nao_igm nao;
+
+    struct timeval start, end;
+    int test_N = 10000;
+    int result = 0;
+
+
+    // set initial configuration
+    jointState q0;
+
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+    q0 = nao.state_model;
+
+
+    nao.getSwingFootPosture (nao.state_sensor, nao.left_foot_posture.data());
+    nao.left_foot_posture =
+        (nao.left_foot_posture) *
+        Translation<double,3>(-0.02,0.01,0.02) *
+        AngleAxisd(0.1, Vector3d::UnitX()) *
+        AngleAxisd(0.1, Vector3d::UnitY()) *
+        AngleAxisd(0.1, Vector3d::UnitZ());
+
+    nao.getCoM (nao.state_sensor, nao.CoM_position);
+    nao.CoM_position[0] += 0.03;
+    nao.CoM_position[1] += 0.02;
+    nao.CoM_position[2] -= 0.01;
+
+
+    // generated functions
+    double out[IGM_KERNEL_OUTPUT_SIZE];
+    double err[IGM_NUM_CONSTRAINTS];
+    double swing_foot[16];
+    double CoM[POSITION_VECTOR_SIZE];
+
+    gettimeofday(&start,0);
+    for (int i = 0; i < test_N; i++)
+    {
+        from_RLeg_3 (q0.q, nao.right_foot_posture.data(), nao.left_foot_posture.data(), nao.CoM_position, out);
+    }
+    gettimeofday(&end,0);
+    printf(" time (from_RLeg_3) = % e\n", getTime(start, end)/test_N);
+
+    gettimeofday(&start,0);
+    for (int i = 0; i < test_N; i++)
+    {
+        from_RLeg_3_residual (q0.q, nao.right_foot_posture.data(), nao.left_foot_posture.data(), nao.CoM_position, err);
+    }
+    gettimeofday(&end,0);
+    printf(" time (from_RLeg_3_residual) = % e\n", getTime(start, end)/test_N);
+
+    gettimeofday(&start,0);
+    for (int i = 0; i < test_N; i++)
+    {
+        RLeg2LLeg (q0.q, nao.right_foot_posture.data(), swing_foot);
+        RLeg2CoM (q0.q, nao.right_foot_posture.data(), CoM);
+    }
+    gettimeofday(&end,0);
+    printf(" time (RLeg2LLeg + RLeg2CoM) = % e\n", getTime(start, end)/test_N);
+
+    if (memcmp(err, out + IGM_NUM_CONSTRAINTS*LOWER_JOINTS_NUM, sizeof(err)) != 0)
+    {
+        cout << "Residuals differ (right)!" << endl;
+        result = 1;
+    }
+
+    from_LLeg_3 (q0.q, nao.right_foot_posture.data(), nao.left_foot_posture.data(), nao.CoM_position, out);
+    from_LLeg_3_residual (q0.q, nao.right_foot_posture.data(), nao.left_foot_posture.data(), nao.CoM_position, err);
+    if (memcmp(err, out + IGM_NUM_CONSTRAINTS*LOWER_JOINTS_NUM, sizeof(err)) != 0)
+    {
+        cout << "Residuals differ (left)!" << endl;
+        result = 1;
+    }
+
+
+    // igm with residual checks
+    test_N = 1000;
+    const double residual_tol[] = {0.0, 1e-5};
+    for (int k = 0; k < 2; ++k)
+    {
+        nao.options.residual_tol = residual_tol[k];
+
+        int iter;
+        gettimeofday(&start,0);
+        for (int i = 0; i < test_N; i++)
+        {
+            nao.state_model = q0;
+            iter = nao.igm(q0.q, 1.2, 0.0015, 20);
+        }
+        gettimeofday(&end,0);
+        printf(" time (igm, residual_tol = %g) = % f\n", residual_tol[k], getTime(start, end)/test_N);
+        cout << "iter = " << iter << endl;
+
+        // the solution must be accepted without iterations
+        iter = nao.igm(q0.q, 1.2, 0.0015, 20);
+        cout << "iter (restart from the solution) = " << iter << endl;
+
+        if ((k > 0) && (iter != 0))
+        {
+            result = 1;
+        }
+    }
+
+    return (result);
+}
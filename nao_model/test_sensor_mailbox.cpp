@@ -0,0 +1,226 @@
+// test_sensor_mailbox.cpp
+//
+// A writer thread publishes joint angles at 1 kHz, the reader polls the
+// latest snapshot in a loop. The latency of reading is reported for
+// jointStateMailbox and for a mailbox guarded by a mutex. All angles of a
+// snapshot are equal to the number of the snapshot, so that torn reads are
+// detected.
+
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#include <pthread.h>
+#include <time.h>
+
+#include "nao_igm.h"
+
+using namespace std;
+
+
+#define TEST_DURATION 1.0
+#define WRITE_PERIOD_NS 1000000
+#define MAX_SAMPLES 4000000
+
+
+double getTime()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (t.tv_sec + 1e-9 * t.tv_nsec);
+}
+
+
+/**
+ * Mailbox guarded by a mutex.
+ */
+class lockedMailbox
+{
+    public:
+        lockedMailbox()
+        {
+            pthread_mutex_init(&mutex, NULL);
+            fresh = false;
+        }
+
+        ~lockedMailbox()
+        {
+            pthread_mutex_destroy(&mutex);
+        }
+
+        void write (const double *q_)
+        {
+            pthread_mutex_lock(&mutex);
+            memcpy(q, q_, sizeof(q));
+            fresh = true;
+            pthread_mutex_unlock(&mutex);
+        }
+
+        bool read (jointState &state)
+        {
+            bool result = false;
+            pthread_mutex_lock(&mutex);
+            if (fresh)
+            {
+                memcpy(state.q, q, sizeof(q));
+                fresh = false;
+                result = true;
+            }
+            pthread_mutex_unlock(&mutex);
+            return (result);
+        }
+
+    private:
+        pthread_mutex_t mutex;
+        double q[JOINTS_NUM];
+        bool fresh;
+};
+
+
+template <class t_Mailbox>
+class mailboxTest
+{
+    public:
+        t_Mailbox mailbox;
+        bool stop;
+        int num_written;
+
+
+        static void *writer (void *arg)
+        {
+            mailboxTest *test = static_cast<mailboxTest *>(arg);
+            struct timespec t;
+            double q[JOINTS_NUM];
+
+            clock_gettime(CLOCK_MONOTONIC, &t);
+            for (test->num_written = 1; !__atomic_load_n(&test->stop, __ATOMIC_RELAXED); ++test->num_written)
+            {
+                for (int i = 0; i < JOINTS_NUM; ++i)
+                {
+                    q[i] = test->num_written;
+                }
+                test->mailbox.write(q);
+
+                t.tv_nsec += WRITE_PERIOD_NS;
+                if (t.tv_nsec >= 1000000000)
+                {
+                    t.tv_nsec -= 1000000000;
+                    ++t.tv_sec;
+                }
+                clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &t, NULL);
+            }
+            return (NULL);
+        }
+
+
+        /**
+         * Poll the mailbox for TEST_DURATION seconds, returns the number of
+         * errors (torn or outdated snapshots).
+         */
+        int run (const char *name, double *latency)
+        {
+            jointState state;
+            pthread_t thread;
+            int num_samples = 0;
+            int num_read = 0;
+            int num_errors = 0;
+            double last = 0.0;
+
+            stop = false;
+            if (pthread_create(&thread, NULL, writer, this) != 0)
+            {
+                cout << "Cannot start a thread!" << endl;
+                return (1);
+            }
+
+            double finish = getTime() + TEST_DURATION;
+            for (double now = 0.0; now < finish; )
+            {
+                double start = getTime();
+                bool fresh = mailbox.read(state);
+                now = getTime();
+
+                if (num_samples < MAX_SAMPLES)
+                {
+                    latency[num_samples] = now - start;
+                    ++num_samples;
+                }
+
+                if (fresh)
+                {
+                    ++num_read;
+                    for (int i = 1; i < JOINTS_NUM; ++i)
+                    {
+                        if (state.q[i] != state.q[0])
+                        {
+                            ++num_errors;
+                            break;
+                        }
+                    }
+                    if (state.q[0] <= last)
+                    {
+                        ++num_errors;
+                    }
+                    last = state.q[0];
+                }
+            }
+
+            __atomic_store_n(&stop, true, __ATOMIC_RELAXED);
+            pthread_join(thread, NULL);
+
+
+            sort (latency, latency + num_samples);
+            printf("%s:\n", name);
+            printf(" snapshots: written = %d, read = %d, errors = %d\n", num_written, num_read, num_errors);
+            printf(" read latency: median = %e, p99 = %e, p99.99 = %e, max = %e\n",
+                    latency[num_samples / 2],
+                    latency[(num_samples / 100) * 99],
+                    latency[(num_samples / 10000) * 9999],
+                    latency[num_samples - 1]);
+
+            return (num_errors);
+        }
+};
+
+
+int main(int argc, char** argv)
+{
+    double *latency = new double[MAX_SAMPLES];
+    int result = 0;
+
+    mailboxTest<jointStateMailbox> *triple = new mailboxTest<jointStateMailbox>;
+    if (triple->run("triple buffer", latency) != 0)
+    {
+        result = 1;
+    }
+    delete triple;
+
+    mailboxTest<lockedMailbox> *locked = new mailboxTest<lockedMailbox>;
+    locked->run("mutex", latency);
+    delete locked;
+
+
+    // snapshots are consumed by nao_igm
+    nao_igm nao;
+    jointState q0;
+    q0.q[L_KNEE_PITCH] += 0.1;
+    nao.sensor_mailbox.write(q0.q);
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+    if ((nao.state_model.q[L_KNEE_PITCH] != q0.q[L_KNEE_PITCH]) || nao.readSensors())
+    {
+        cout << "Snapshot is not consumed by init()!" << endl;
+        result = 1;
+    }
+
+    delete [] latency;
+
+    if (result != 0)
+    {
+        cout << "Test failed!" << endl;
+    }
+    return (result);
+}
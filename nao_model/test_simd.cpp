@@ -0,0 +1,145 @@
+// test_simd.cpp
+//
+// Compare SIMD versions of from_LLeg_3() / from_RLeg_3() with the scalar
+// functions and measure time per configuration.
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <sys/time.h>
+#include <time.h>
+
+#include "nao_igm.h"
+#include "maple_functions.h"
+
+using namespace std;
+
+
+#define A_SIZE 130
+
+
+double getTime(struct timeval &start, struct timeval &end)
+{
+    return (end.tv_sec - start.tv_sec + 0.000001 * (end.tv_usec - start.tv_usec));
+}
+
+
+double maxDifference(const int n, const double *a, const double *b)
+{
+    double max_diff = 0.0;
+    for (int i = 0; i < n; ++i)
+    {
+        double diff = fabs(a[i] - b[i]) / (1.0 + fabs(b[i]));
+        if (diff > max_diff)
+        {
+            max_diff = diff;
+        }
+    }
+    return (max_diff);
+}
+
+
+int main(int argc, char** argv)
+{
+    struct timeval start, end;
+    const int conf_N = 1001; // not a multiple of SIMD width on purpose
+    const int test_N = 100;
+
+    nao_igm nao;
+    jointState q0;
+
+    nao.init (
+            IGM_SUPPORT_RIGHT,
+            0.0, 0.05, 0.0,
+            0.0, 0.0, 0.0);
+    nao.getSwingFootPosture (nao.state_sensor, nao.left_foot_posture.data());
+    nao.getCoM (nao.state_sensor, nao.CoM_position);
+
+
+    double *q = new double[JOINTS_NUM*conf_N];
+    double *LL = new double[16*conf_N];
+    double *RL = new double[16*conf_N];
+    double *CoM = new double[POSITION_VECTOR_SIZE*conf_N];
+    double *A_scalar = new double[A_SIZE*conf_N];
+    double *A_simd = new double[A_SIZE*conf_N];
+
+    srand(1);
+    for (int i = 0; i < conf_N; ++i)
+    {
+        for (int j = 0; j < JOINTS_NUM; ++j)
+        {
+            q[i*JOINTS_NUM + j] = q0.q[j] + 0.5 * (2.0*rand()/RAND_MAX - 1.0);
+        }
+        memcpy(LL + 16*i, nao.left_foot_posture.data(), 16*sizeof(double));
+        memcpy(RL + 16*i, nao.right_foot_posture.data(), 16*sizeof(double));
+        memcpy(CoM + 3*i, nao.CoM_position, 3*sizeof(double));
+    }
+
+    cout << "SIMD width = " << igmSIMDWidth() << endl;
+
+
+    // left foot
+    gettimeofday(&start,0);
+    for (int k = 0; k < test_N; ++k)
+    {
+        for (int i = 0; i < conf_N; ++i)
+        {
+            from_LLeg_3 (q + i*JOINTS_NUM, LL + 16*i, RL + 16*i, CoM + 3*i, A_scalar + i*A_SIZE);
+        }
+    }
+    gettimeofday(&end,0);
+    printf(" time (from_LLeg_3, scalar) = % e\n", getTime(start, end) / (test_N*conf_N));
+
+    gettimeofday(&start,0);
+    for (int k = 0; k < test_N; ++k)
+    {
+        from_LLeg_3_multi (conf_N, q, LL, RL, CoM, A_simd);
+    }
+    gettimeofday(&end,0);
+    printf(" time (from_LLeg_3, multi)  = % e\n", getTime(start, end) / (test_N*conf_N));
+
+    double diff_left = maxDifference(A_SIZE*conf_N, A_simd, A_scalar);
+    cout << "max relative difference (left) = " << diff_left << endl;
+
+
+    // right foot
+    gettimeofday(&start,0);
+    for (int k = 0; k < test_N; ++k)
+    {
+        for (int i = 0; i < conf_N; ++i)
+        {
+            from_RLeg_3 (q + i*JOINTS_NUM, RL + 16*i, LL + 16*i, CoM + 3*i, A_scalar + i*A_SIZE);
+        }
+    }
+    gettimeofday(&end,0);
+    printf(" time (from_RLeg_3, scalar) = % e\n", getTime(start, end) / (test_N*conf_N));
+
+    gettimeofday(&start,0);
+    for (int k = 0; k < test_N; ++k)
+    {
+        from_RLeg_3_multi (conf_N, q, RL, LL, CoM, A_simd);
+    }
+    gettimeofday(&end,0);
+    printf(" time (from_RLeg_3, multi)  = % e\n", getTime(start, end) / (test_N*conf_N));
+
+    double diff_right = maxDifference(A_SIZE*conf_N, A_simd, A_scalar);
+    cout << "max relative difference (right) = " << diff_right << endl;
+
+
+    delete [] q;
+    delete [] LL;
+    delete [] RL;
+    delete [] CoM;
+    delete [] A_scalar;
+    delete [] A_simd;
+
+    if ((diff_left > 1e-12) || (diff_right > 1e-12))
+    {
+        cout << "SIMD and scalar results differ!" << endl;
+        return (1);
+    }
+    return (0);
+}